@@ -19,6 +19,7 @@ HERMES_DEVICE_CALLABLE inline TransportMode operator!(TransportMode mode) {
 }
 
 enum class BxDFType {
+  NONE,
   DIELECTRIC,
   CUSTOM
 };
@@ -68,7 +69,7 @@ struct BxDF {
   // *******************************************************************************************************************
   mem::Ptr data_ptr;                  //<
   bxdf_flags flags{bxdf_flags::NONE}; //<
-  BxDFType type{BxDFType::CUSTOM};
+  BxDFType type{BxDFType::NONE};
 };
 
 // *********************************************************************************************************************
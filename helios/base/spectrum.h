@@ -32,6 +32,7 @@
 #include <algorithm>
 #include <cmath>
 #include <map>
+#include <type_traits>
 #include <helios/core/mem.h>
 
 namespace helios {
@@ -78,12 +79,68 @@ struct Spectrum {
 /// and the RGB value that represents an illuminant
 //enum class SpectrumType { REFLECTANCE, ILLUMINANT };
 
+/// Evaluates a piecewise linear function tabulated at uniformly spaced wavelengths with a direct index
+/// \param values tabulated values
+/// \param n number of values
+/// \param lambda_start wavelength of the first value (nm)
+/// \param lambda_step spacing between values (nm)
+/// \param lambda wavelength (nm)
+/// \return interpolated value (0 outside the tabulated range)
+HERMES_DEVICE_CALLABLE inline real_t evaluateUniformSamples(const real_t *values, int n, real_t lambda_start,
+                                                            real_t lambda_step, real_t lambda) {
+  real_t x = (lambda - lambda_start) / lambda_step;
+  if (x < 0 || x > n - 1)
+    return 0;
+  int i = static_cast<int>(x);
+  if (i > n - 2)
+    i = n - 2;
+  real_t t = x - i;
+  return (1 - t) * values[i] + t * values[i + 1];
+}
+
+/// CIE 1931 matching functions, tabulated from 360 nm to 830 nm in 1 nm steps
 static const int nCIESamples = 471;
+static const int CIELambdaStart = 360;
+static const int CIELambdaEnd = 830;
 extern const real_t CIE_X[nCIESamples];
 extern const real_t CIE_Y[nCIESamples];
 extern const real_t CIE_Z[nCIESamples];
 extern const real_t CIE_lambda[nCIESamples];
+extern __constant__ real_t device_CIE_X[nCIESamples];
+extern __constant__ real_t device_CIE_Y[nCIESamples];
+extern __constant__ real_t device_CIE_Z[nCIESamples];
 static const real_t CIE_Y_integral = 106.856895;
+/// \param lambda wavelength (nm)
+/// \param xyz **[out]** matching functions values at lambda (0 outside the tabulated range)
+HERMES_DEVICE_CALLABLE inline void CIEXYZ(real_t lambda, real_t xyz[3]) {
+#if defined(__CUDA_ARCH__) && __CUDA_ARCH__ > 0
+  const real_t *values[3] = {device_CIE_X, device_CIE_Y, device_CIE_Z};
+#else
+  const real_t *values[3] = {CIE_X, CIE_Y, CIE_Z};
+#endif
+  for (int c = 0; c < 3; ++c)
+    xyz[c] = evaluateUniformSamples(values[c], nCIESamples, CIELambdaStart, 1, lambda);
+}
+
+/// CIE standard illuminant D65 relative SPD, tabulated from 300 nm to 830 nm in 5 nm steps
+static const int nCIEIllumD65Samples = 107;
+static const int CIEIllumD65LambdaStart = 300;
+static const int CIEIllumD65LambdaStep = 5;
+extern const real_t CIE_Illum_D6500[nCIEIllumD65Samples];
+extern __constant__ real_t device_CIE_Illum_D6500[nCIEIllumD65Samples];
+/// Scales CIE_Illum_D6500 to unit luminance (Y = 1)
+static const real_t CIE_Illum_D6500_normalization = 0.0101122487;
+/// \param lambda wavelength (nm)
+/// \return CIE D65 SPD at lambda, normalized to unit luminance (0 outside the tabulated range)
+HERMES_DEVICE_CALLABLE inline real_t illuminantD65(real_t lambda) {
+#if defined(__CUDA_ARCH__) && __CUDA_ARCH__ > 0
+  const real_t *values = device_CIE_Illum_D6500;
+#else
+  const real_t *values = CIE_Illum_D6500;
+#endif
+  return evaluateUniformSamples(values, nCIEIllumD65Samples, CIEIllumD65LambdaStart, CIEIllumD65LambdaStep, lambda)
+      * CIE_Illum_D6500_normalization;
+}
 
 static const int nRGB2SpectSamples = 32;
 extern const real_t RGB2SpectLambda[nRGB2SpectSamples];
@@ -123,6 +180,7 @@ HERMES_DEVICE_CALLABLE inline void RGBToXYZ(const real_t rgb[3], real_t xyz[3])
 // *********************************************************************************************************************
 /// Represents a spectra using a particular number of samples (given by **nSpectrumSamples** parameter) of
 /// the SPD (_spectral power distribution_).
+/// \note Coefficient spectra are trivially copyable and hold nothing but their coefficients.
 template<int nSpectrumSamples> class CoefficientSpectrum {
 public:
   // *******************************************************************************************************************
@@ -145,7 +203,6 @@ public:
     for (int i = 0; i < nSpectrumSamples; i++)
       c[i] = v;
   }
-  HERMES_DEVICE_CALLABLE virtual ~CoefficientSpectrum() {}
   // *******************************************************************************************************************
   //                                                                                                        OPERATORS
   // *******************************************************************************************************************
@@ -211,7 +268,7 @@ HERMES_DEVICE_CALLABLE CoefficientSpectrum operator OP(const CoefficientSpectrum
     return false;
   }
 
-  const int nSamples = nSpectrumSamples;
+  static constexpr int nSamples = nSpectrumSamples;
 
 protected:
   real_t c[nSpectrumSamples]{};
@@ -269,11 +326,6 @@ public:
   HERMES_DEVICE_CALLABLE RGBSpectrum(real_t v = 0.f);
   HERMES_DEVICE_CALLABLE RGBSpectrum(const CoefficientSpectrum<3> &v);
   // *******************************************************************************************************************
-  //                                                                                                        OPERATORS
-  // *******************************************************************************************************************
-  //                                                                                                       assignment
-  HERMES_DEVICE_CALLABLE RGBSpectrum &operator=(const RGBSpectrum &other);
-  // *******************************************************************************************************************
   //                                                                                                          METHODS
   // *******************************************************************************************************************
   /// \param rgb **[out]**
@@ -285,6 +337,9 @@ public:
   [[nodiscard]] HERMES_DEVICE_CALLABLE real_t y() const;
 };
 
+static_assert(std::is_trivially_copyable_v<RGBSpectrum>);
+static_assert(sizeof(RGBSpectrum) == 3 * sizeof(real_t));
+
 static const int sampledLambdaStart = 400;
 static const int sampledLambdaEnd = 700;
 static const int nSpectralSamples = 60;
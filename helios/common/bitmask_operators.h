@@ -40,6 +40,7 @@
 #ifndef HELIOS_HELIOS_COMMON_BITMASK_OPERATORS_H
 #define HELIOS_HELIOS_COMMON_BITMASK_OPERATORS_H
 
+#include <hermes/common/defs.h>
 #include <type_traits>
 
 namespace helios {
@@ -59,7 +60,7 @@ struct EnableBitMaskOperators {
 };
 
 template<typename Enum>
-typename std::enable_if<EnableBitMaskOperators<Enum>::enable, Enum>::type
+HERMES_DEVICE_CALLABLE typename std::enable_if<EnableBitMaskOperators<Enum>::enable, Enum>::type
 operator|(Enum lhs, Enum rhs) {
   using underlying = typename std::underlying_type<Enum>::type;
   return static_cast<Enum> (
@@ -69,7 +70,7 @@ operator|(Enum lhs, Enum rhs) {
 }
 
 template<typename Enum>
-typename std::enable_if<EnableBitMaskOperators<Enum>::enable, Enum>::type
+HERMES_DEVICE_CALLABLE typename std::enable_if<EnableBitMaskOperators<Enum>::enable, Enum>::type
 operator&(Enum lhs, Enum rhs) {
   using underlying = typename std::underlying_type<Enum>::type;
   return static_cast<Enum> (
@@ -79,7 +80,7 @@ operator&(Enum lhs, Enum rhs) {
 }
 
 template<typename Enum>
-typename std::enable_if<EnableBitMaskOperators<Enum>::enable, Enum>::type
+HERMES_DEVICE_CALLABLE typename std::enable_if<EnableBitMaskOperators<Enum>::enable, Enum>::type
 operator^(Enum lhs, Enum rhs) {
   using underlying = typename std::underlying_type<Enum>::type;
   return static_cast<Enum> (
@@ -89,7 +90,7 @@ operator^(Enum lhs, Enum rhs) {
 }
 
 template<typename Enum>
-typename std::enable_if<EnableBitMaskOperators<Enum>::enable, Enum>::type
+HERMES_DEVICE_CALLABLE typename std::enable_if<EnableBitMaskOperators<Enum>::enable, Enum>::type
 operator~(Enum rhs) {
   using underlying = typename std::underlying_type<Enum>::type;
   return static_cast<Enum> (
@@ -0,0 +1,108 @@
+/// Copyright (c) 2021, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+///\file counter_rng.h
+///\author FilipeCN (filipedecn@gmail.com)
+///\date 2021-10-19
+///
+///\brief Counter-based random number generation
+
+#ifndef HELIOS_COMMON_COUNTER_RNG_H
+#define HELIOS_COMMON_COUNTER_RNG_H
+
+#include <hermes/geometry/point.h>
+
+namespace helios {
+
+// *********************************************************************************************************************
+//                                                                                                         CounterRNG
+// *********************************************************************************************************************
+/// Philox4x32-10 (Salmon et al. 2011) counter-based generator. Random values are a pure function of a 128 bit
+/// counter and a 64 bit key, so there is no state to carry between threads: the same (pixel, sample, dimension)
+/// always produces the same values regardless of which thread or tile asks for them, and in which order.
+class CounterRNG {
+public:
+  // *******************************************************************************************************************
+  //                                                                                                     CONSTRUCTORS
+  // *******************************************************************************************************************
+  /// \param key0 first key word (e.g. a seed)
+  /// \param key1 second key word (e.g. a sampling pass)
+  HERMES_DEVICE_CALLABLE explicit CounterRNG(u32 key0 = 0, u32 key1 = 0) : key_{key0, key1} {}
+  // *******************************************************************************************************************
+  //                                                                                                          METHODS
+  // *******************************************************************************************************************
+  /// Computes the 4 random words of a counter
+  /// \param counter
+  /// \param out **[out]** random words
+  HERMES_DEVICE_CALLABLE void generate(const u32 counter[4], u32 out[4]) const {
+    u32 c0 = counter[0], c1 = counter[1], c2 = counter[2], c3 = counter[3];
+    u32 k0 = key_[0], k1 = key_[1];
+    for (int round = 0; round < 10; ++round) {
+      u64 p0 = static_cast<u64>(0xd2511f53u) * c0;
+      u64 p1 = static_cast<u64>(0xcd9e8d57u) * c2;
+      u32 n0 = static_cast<u32>(p1 >> 32) ^ c1 ^ k0;
+      u32 n2 = static_cast<u32>(p0 >> 32) ^ c3 ^ k1;
+      c1 = static_cast<u32>(p1);
+      c3 = static_cast<u32>(p0);
+      c0 = n0;
+      c2 = n2;
+      // bump key (Weyl sequence)
+      k0 += 0x9e3779b9u;
+      k1 += 0xbb67ae85u;
+    }
+    out[0] = c0;
+    out[1] = c1;
+    out[2] = c2;
+    out[3] = c3;
+  }
+  /// \param pixel
+  /// \param sample_index
+  /// \param dimension
+  /// \return uniform value in [0, 1)
+  [[nodiscard]] HERMES_DEVICE_CALLABLE real_t uniform1D(const hermes::index2 &pixel, u32 sample_index,
+                                                        u32 dimension) const {
+    u32 counter[4] = {static_cast<u32>(pixel.i), static_cast<u32>(pixel.j), sample_index, dimension}, out[4];
+    generate(counter, out);
+    return toUniformFloat(out[0]);
+  }
+  /// \param pixel
+  /// \param sample_index
+  /// \param dimension
+  /// \return pair of independent uniform values in [0, 1)
+  [[nodiscard]] HERMES_DEVICE_CALLABLE hermes::point2 uniform2D(const hermes::index2 &pixel, u32 sample_index,
+                                                                u32 dimension) const {
+    u32 counter[4] = {static_cast<u32>(pixel.i), static_cast<u32>(pixel.j), sample_index, dimension}, out[4];
+    generate(counter, out);
+    return {toUniformFloat(out[0]), toUniformFloat(out[1])};
+  }
+  /// \param bits
+  /// \return uniform value in [0, 1) built from the upper 24 bits
+  HERMES_DEVICE_CALLABLE static real_t toUniformFloat(u32 bits) {
+    return static_cast<real_t>(bits >> 8) * 0x1p-24f;
+  }
+
+private:
+  u32 key_[2];
+};
+
+} // namespace helios
+
+#endif // HELIOS_COMMON_COUNTER_RNG_H
@@ -25,6 +25,8 @@
 
 #include <helios/common/globals.h>
 
+#include <cstring>
+
 namespace helios {
 
 namespace globals {
@@ -35,6 +37,63 @@ HERMES_DEVICE_CALLABLE real_t gammaCorrect(real_t value) {
   return 1.055f * powf(value, (real_t) (1.f / 2.4f)) - 0.055f;
 }
 
+HERMES_DEVICE_CALLABLE u16 floatToHalf(f32 value) {
+  u32 x;
+  memcpy(&x, &value, sizeof(u32));
+  u32 sign = (x >> 16) & 0x8000;
+  u32 abs = x & 0x7fffffff;
+  // inf and nan
+  if (abs >= 0x7f800000)
+    return sign | 0x7c00 | (abs > 0x7f800000 ? 0x200 : 0);
+  // overflow
+  if (abs >= 0x47800000)
+    return sign | 0x7c00;
+  // subnormal results
+  if (abs < 0x38800000) {
+    if (abs < 0x33000000)
+      return sign;
+    u32 shift = 126 - (abs >> 23);
+    u32 m = (abs & 0x7fffff) | 0x800000;
+    u32 h = m >> shift;
+    u32 remainder = m & ((1u << shift) - 1);
+    u32 halfway = 1u << (shift - 1);
+    if (remainder > halfway || (remainder == halfway && (h & 1)))
+      h++;
+    return sign | h;
+  }
+  // rebias exponent and round mantissa
+  u32 h = (abs - 0x38000000) >> 13;
+  u32 remainder = abs & 0x1fff;
+  if (remainder > 0x1000 || (remainder == 0x1000 && (h & 1)))
+    h++;
+  return sign | h;
+}
+
+HERMES_DEVICE_CALLABLE f32 halfToFloat(u16 bits) {
+  u32 sign = (u32) (bits & 0x8000) << 16;
+  u32 e = (bits >> 10) & 0x1f;
+  u32 m = bits & 0x3ff;
+  u32 x;
+  if (e == 0x1f)
+    x = sign | 0x7f800000 | (m << 13);
+  else if (e)
+    x = sign | ((e + 112) << 23) | (m << 13);
+  else if (!m)
+    x = sign;
+  else {
+    // normalize subnormal value
+    e = 113;
+    while (!(m & 0x400)) {
+      m <<= 1;
+      e--;
+    }
+    x = sign | (e << 23) | ((m & 0x3ff) << 13);
+  }
+  f32 value;
+  memcpy(&value, &x, sizeof(f32));
+  return value;
+}
+
 }
 
 } // namespace helios
@@ -40,6 +40,14 @@ namespace globals {
 HERMES_DEVICE_CALLABLE real_t gammaCorrect(real_t value);
 
 HERMES_DEVICE_CALLABLE inline constexpr real_t shadowEpsilon() { return 0.0001f; };
+/// Converts a single precision value into IEEE 754 half precision bits (round to nearest even)
+/// \param value
+/// \return half precision bits
+HERMES_DEVICE_CALLABLE u16 floatToHalf(f32 value);
+/// Converts IEEE 754 half precision bits into a single precision value
+/// \param bits half precision bits
+/// \return
+HERMES_DEVICE_CALLABLE f32 halfToFloat(u16 bits);
 
 }
 
@@ -0,0 +1,101 @@
+/// Copyright (c) 2021, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+///\file hash.h
+///\author FilipeCN (filipedecn@gmail.com)
+///\date 2021-10-18
+///
+///\brief Stateless hashing utilities used to derive random values from integer keys
+
+#ifndef HELIOS_COMMON_HASH_H
+#define HELIOS_COMMON_HASH_H
+
+#include <hermes/common/defs.h>
+
+namespace helios::hash {
+
+/// Finalizer of the 64-bit MurmurHash3 (good avalanche for consecutive keys)
+/// \param v
+/// \return
+HERMES_DEVICE_CALLABLE inline u64 mixBits(u64 v) {
+  v ^= (v >> 31);
+  v *= 0x7fb5d329728ea185ull;
+  v ^= (v >> 27);
+  v *= 0x81dadef4bc2dd44dull;
+  v ^= (v >> 33);
+  return v;
+}
+/// Combines a new key into a running hash value
+/// \param seed current hash value
+/// \param value key
+/// \return
+HERMES_DEVICE_CALLABLE inline u64 combine(u64 seed, u64 value) {
+  return mixBits(seed ^ (value + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2)));
+}
+/// Hashes a sequence of integer keys
+/// \tparam Args integral types
+/// \param args keys
+/// \return
+template<typename... Args>
+HERMES_DEVICE_CALLABLE inline u64 values(Args... args) {
+  u64 h = 0;
+  ((h = combine(h, static_cast<u64>(args))), ...);
+  return h;
+}
+/// Computes the i-th element of a random permutation of {0, ..., n - 1} without storing the permutation
+/// (Kensler's cycle walking hash)
+/// \param i element index
+/// \param n permutation size
+/// \param seed selects the permutation
+/// \return
+HERMES_DEVICE_CALLABLE inline u32 permutationElement(u32 i, u32 n, u32 seed) {
+  u32 w = n - 1;
+  w |= w >> 1;
+  w |= w >> 2;
+  w |= w >> 4;
+  w |= w >> 8;
+  w |= w >> 16;
+  do {
+    i ^= seed;
+    i *= 0xe170893d;
+    i ^= seed >> 16;
+    i ^= (i & w) >> 4;
+    i ^= seed >> 8;
+    i *= 0x0929eb3f;
+    i ^= seed >> 23;
+    i ^= (i & w) >> 1;
+    i *= 1 | seed >> 27;
+    i *= 0x6935fa69;
+    i ^= (i & w) >> 11;
+    i *= 0x74dcb303;
+    i ^= (i & w) >> 2;
+    i *= 0x9e501cc3;
+    i ^= (i & w) >> 2;
+    i *= 0xc860a3df;
+    i &= w;
+    i ^= i >> 5;
+  } while (i >= n);
+  return (i + seed) % n;
+}
+
+} // namespace helios::hash
+
+#endif // HELIOS_COMMON_HASH_H
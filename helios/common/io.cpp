@@ -30,58 +30,724 @@
 #include <stb_image_write.h>
 #include <hermes/common/file_system.h>
 #include <helios/common/globals.h>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <fstream>
+#include <limits>
+#include <thread>
 
 using namespace hermes;
 
 namespace helios::io {
 
+namespace {
+
+/// Runs f(k) for k in [0, count) spreading indices across threads
+/// \param count
+/// \param thread_count (0 = hardware concurrency)
+/// \param f
+template<typename F>
+void parallelFor(i32 count, u32 thread_count, const F &f) {
+  std::atomic<i32> next{0};
+  auto run = [&]() {
+    for (i32 k = next++; k < count; k = next++)
+      f(k);
+  };
+  if (!thread_count)
+    thread_count = std::max(1u, std::thread::hardware_concurrency());
+  thread_count = std::min(thread_count, static_cast<u32>(std::max(count, 1)));
+  std::vector<std::thread> threads;
+  for (u32 t = 1; t < thread_count; ++t)
+    threads.emplace_back(run);
+  run();
+  for (auto &thread : threads)
+    thread.join();
+}
+
+// *********************************************************************************************************************
+//                                                                                                      EXR encoding
+// *********************************************************************************************************************
+/// Little endian byte writer used to build the EXR header
+struct ExrWriter {
+  std::vector<u8> &bytes;
+  template<typename T>
+  void write(T value) {
+    u8 raw[sizeof(T)];
+    memcpy(raw, &value, sizeof(T));
+    bytes.insert(bytes.end(), raw, raw + sizeof(T));
+  }
+  void write(const char *str) {
+    bytes.insert(bytes.end(), str, str + strlen(str) + 1);
+  }
+  void attribute(const char *name, const char *type, i32 size) {
+    write(name);
+    write(type);
+    write(size);
+  }
+};
+
+/// Block layout of the file: scanline groups or tiles
+struct ExrLayout {
+  i32 width{0};
+  i32 height{0};
+  i32 block_width{0};
+  i32 block_height{0};
+  i32 blocks_per_row{0};
+  i32 block_count{0};
+};
+
+/// Serializes the pixels of a block (for each line, all B, then G, then R values) and compresses it
+/// \param rgb rows of the image starting at row_begin
+/// \param layout
+/// \param block
+/// \param row_begin first row (relative to the data window) held by rgb
+/// \param options
+/// \param scratch reusable raw data storage
+/// \param encoded receives block data (compressed or raw)
+void encodeExrBlock(const real_t *rgb, const ExrLayout &layout, i32 block, i32 row_begin, const ExrOptions &options,
+                    std::vector<u8> &scratch, std::vector<u8> &encoded) {
+  i32 x0 = (block % layout.blocks_per_row) * layout.block_width;
+  i32 y0 = (block / layout.blocks_per_row) * layout.block_height;
+  i32 w = std::min(layout.block_width, layout.width - x0);
+  i32 h = std::min(layout.block_height, layout.height - y0);
+  size_t value_size = options.pixel_type == ExrPixelType::HALF ? 2 : 4;
+  scratch.resize(3 * value_size * w * h);
+  u8 *dst = scratch.data();
+  for (i32 y = y0; y < y0 + h; ++y)
+    // channels are stored in alphabetical order
+    for (int c = 2; c >= 0; --c) {
+      const real_t *src = rgb + 3 * (static_cast<size_t>(y - row_begin) * layout.width + x0) + c;
+      if (options.pixel_type == ExrPixelType::HALF)
+        for (i32 x = 0; x < w; ++x, dst += 2) {
+          u16 value = globals::floatToHalf(src[3 * x]);
+          memcpy(dst, &value, 2);
+        }
+      else
+        for (i32 x = 0; x < w; ++x, dst += 4) {
+          f32 value = src[3 * x];
+          memcpy(dst, &value, 4);
+        }
+    }
+  if (options.compression == ExrCompression::NONE) {
+    encoded.swap(scratch);
+    return;
+  }
+  // zip: split even and odd bytes, then delta encode before deflating
+  size_t n = scratch.size();
+  std::vector<u8> reordered(n);
+  for (size_t i = 0, half = (n + 1) / 2; i < n; ++i)
+    reordered[(i % 2) ? half + i / 2 : i / 2] = scratch[i];
+  for (size_t i = n - 1; i > 0; --i)
+    reordered[i] = static_cast<u8>(reordered[i] - reordered[i - 1] + 128);
+  int compressed_size = 0;
+  u8 *compressed = stbi_zlib_compress(reordered.data(), static_cast<int>(n), &compressed_size,
+                                      stbi_write_png_compression_level);
+  // incompressible blocks are stored raw
+  if (!compressed || static_cast<size_t>(compressed_size) >= n)
+    encoded.swap(scratch);
+  else
+    encoded.assign(compressed, compressed + compressed_size);
+  STBIW_FREE(compressed);
+}
+
+/// \param output_bounds
+/// \param options
+/// \return block layout (scanline groups or tiles) of the data window
+ExrLayout exrLayout(const bounds2i &output_bounds, const ExrOptions &options) {
+  auto resolution = output_bounds.upper() - output_bounds.lower();
+  ExrLayout layout;
+  layout.width = resolution.i;
+  layout.height = resolution.j;
+  if (options.tile_size) {
+    layout.block_width = layout.block_height = options.tile_size;
+  } else {
+    layout.block_width = layout.width;
+    layout.block_height = options.compression == ExrCompression::ZIP ? 16 : 1;
+  }
+  layout.blocks_per_row = (layout.width + layout.block_width - 1) / layout.block_width;
+  layout.block_count = layout.blocks_per_row * ((layout.height + layout.block_height - 1) / layout.block_height);
+  return layout;
+}
+
+/// \param output_bounds
+/// \param full_resolution
+/// \param options
+/// \return magic number, version and header attributes (everything before the offset table)
+std::vector<u8> exrHeader(const bounds2i &output_bounds, const size2 &full_resolution, const ExrOptions &options) {
+  std::vector<u8> bytes;
+  ExrWriter writer{bytes};
+  // magic number and version (single part, tiled flag)
+  writer.write<i32>(20000630);
+  writer.write<i32>(options.tile_size ? 0x202 : 2);
+  // header
+  writer.attribute("channels", "chlist", 3 * (2 + 16) + 1);
+  for (const char *channel : {"B", "G", "R"}) {
+    writer.write(channel);
+    writer.write<i32>(static_cast<i32>(options.pixel_type));
+    writer.write<i32>(0); // pLinear + reserved
+    writer.write<i32>(1);
+    writer.write<i32>(1);
+  }
+  writer.write<u8>(0);
+  writer.attribute("compression", "compression", 1);
+  writer.write<u8>(static_cast<u8>(options.compression));
+  writer.attribute("dataWindow", "box2i", 16);
+  writer.write<i32>(output_bounds.lower().i);
+  writer.write<i32>(output_bounds.lower().j);
+  writer.write<i32>(output_bounds.upper().i - 1);
+  writer.write<i32>(output_bounds.upper().j - 1);
+  writer.attribute("displayWindow", "box2i", 16);
+  writer.write<i32>(0);
+  writer.write<i32>(0);
+  writer.write<i32>(static_cast<i32>(full_resolution.width) - 1);
+  writer.write<i32>(static_cast<i32>(full_resolution.height) - 1);
+  writer.attribute("lineOrder", "lineOrder", 1);
+  writer.write<u8>(0);
+  writer.attribute("pixelAspectRatio", "float", 4);
+  writer.write<f32>(1);
+  writer.attribute("screenWindowCenter", "v2f", 8);
+  writer.write<f32>(0);
+  writer.write<f32>(0);
+  writer.attribute("screenWindowWidth", "float", 4);
+  writer.write<f32>(1);
+  if (options.tile_size) {
+    // single resolution level
+    writer.attribute("tiles", "tiledesc", 9);
+    writer.write<u32>(options.tile_size);
+    writer.write<u32>(options.tile_size);
+    writer.write<u8>(0);
+  }
+  writer.write<u8>(0);
+  return bytes;
+}
+
+/// Appends a chunk: block coordinates, data size and block data
+/// \param writer
+/// \param layout
+/// \param output_bounds
+/// \param options
+/// \param block
+/// \param data encoded block
+/// \return size of the chunk in bytes
+u64 appendExrChunk(ExrWriter &writer, const ExrLayout &layout, const bounds2i &output_bounds,
+                   const ExrOptions &options, i32 block, const std::vector<u8> &data) {
+  size_t begin = writer.bytes.size();
+  if (options.tile_size) {
+    writer.write<i32>(block % layout.blocks_per_row);
+    writer.write<i32>(block / layout.blocks_per_row);
+    writer.write<i32>(0);
+    writer.write<i32>(0);
+  } else
+    writer.write<i32>(output_bounds.lower().j + block * layout.block_height);
+  writer.write<i32>(static_cast<i32>(data.size()));
+  writer.bytes.insert(writer.bytes.end(), data.begin(), data.end());
+  return writer.bytes.size() - begin;
+}
+
+// *********************************************************************************************************************
+//                                                                                                      PNG encoding
+// *********************************************************************************************************************
+/// Linear to 8-bit sRGB conversion through a lookup table
+/// \note Produces exactly the same bytes as rounding 255 * globals::gammaCorrect(value)
+class SrgbQuantizer {
+public:
+  static const SrgbQuantizer &instance() {
+    static SrgbQuantizer quantizer;
+    return quantizer;
+  }
+  [[nodiscard]] u8 quantize(real_t value) const {
+    // negative and nan values go to zero
+    if (!(value >= thresholds_[1]))
+      return 0;
+    if (value >= thresholds_[255])
+      return 255;
+    // the table gives the byte of the bucket's start, a couple of threshold tests finish the job
+    u32 b = table_[static_cast<u32>(value * table_size)];
+    while (value >= thresholds_[b + 1])
+      ++b;
+    return static_cast<u8>(b);
+  }
+
+private:
+  static constexpr u32 table_size = 4096;
+  static u8 reference(f32 value) {
+    return static_cast<u8>(Numbers::clamp(255.f * globals::gammaCorrect(value) + 0.5f, 0.f, 255.f));
+  }
+  SrgbQuantizer() {
+    // thresholds_[b] is the smallest value mapped to b (bisection over the bits of positive floats)
+    for (u32 b = 1; b < 256; ++b) {
+      u32 lo = 0, hi = 0x3f800000; // 1.f
+      while (lo < hi) {
+        u32 mid = lo + (hi - lo) / 2;
+        f32 value;
+        memcpy(&value, &mid, sizeof(f32));
+        if (reference(value) >= b)
+          hi = mid;
+        else
+          lo = mid + 1;
+      }
+      memcpy(&thresholds_[b], &lo, sizeof(f32));
+    }
+    thresholds_[0] = 0;
+    thresholds_[256] = std::numeric_limits<f32>::infinity();
+    for (u32 k = 0; k < table_size; ++k) {
+      f32 value = static_cast<f32>(k) / table_size;
+      u32 b = 0;
+      while (value >= thresholds_[b + 1])
+        ++b;
+      table_[k] = static_cast<u8>(b);
+    }
+  }
+  f32 thresholds_[257]{};
+  u8 table_[table_size]{};
+};
+
+/// Writes bits of a deflate stream (least significant bit first)
+struct DeflateBitWriter {
+  std::vector<u8> &bytes;
+  u32 bits{0};
+  int count{0};
+  void put(u32 code, int length) {
+    bits |= code << count;
+    count += length;
+    while (count >= 8) {
+      bytes.emplace_back(static_cast<u8>(bits));
+      bits >>= 8;
+      count -= 8;
+    }
+  }
+  /// Huffman codes are written most significant bit first
+  void putReversed(u32 code, int length) {
+    u32 reversed = 0;
+    for (int i = 0; i < length; ++i)
+      reversed |= ((code >> i) & 1u) << (length - 1 - i);
+    put(reversed, length);
+  }
+  void putSymbol(u32 symbol) {
+    // fixed huffman literal/length codes
+    if (symbol <= 143)
+      putReversed(0x30 + symbol, 8);
+    else if (symbol <= 255)
+      putReversed(0x190 + symbol - 144, 9);
+    else if (symbol <= 279)
+      putReversed(symbol - 256, 7);
+    else
+      putReversed(0xc0 + symbol - 280, 8);
+  }
+  void align() {
+    if (count)
+      put(0, 8 - count);
+  }
+};
+
+/// Compresses data into a non-final fixed huffman deflate block followed by a sync flush, so independently
+/// compressed strips can be concatenated into a single deflate stream
+/// \param data
+/// \param size
+/// \param out receives the raw deflate data
+void deflateStrip(const u8 *data, i32 size, std::vector<u8> &out) {
+  static constexpr u16 length_base[] = {3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67,
+                                        83, 99, 115, 131, 163, 195, 227, 258, 259};
+  static constexpr u8 length_extra[] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5,
+                                        5, 5, 0};
+  static constexpr u16 distance_base[] = {1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513,
+                                          769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577, 32769};
+  static constexpr u8 distance_extra[] = {0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11,
+                                          11, 12, 12, 13, 13};
+  static constexpr i32 window_size = 32768;
+  static constexpr i32 max_match = 258;
+  static constexpr i32 max_chain = 32;
+  static constexpr u32 hash_bits = 15;
+  DeflateBitWriter writer{out};
+  writer.put(0, 1); // BFINAL
+  writer.put(1, 2); // BTYPE = fixed huffman
+  std::vector<i32> head(1u << hash_bits, -1);
+  std::vector<i32> previous(size);
+  auto hash = [&](i32 i) {
+    return ((data[i] << 16 | data[i + 1] << 8 | data[i + 2]) * 2654435761u) >> (32 - hash_bits);
+  };
+  auto insert = [&](i32 i) {
+    if (i + 3 > size)
+      return;
+    u32 h = hash(i);
+    previous[i] = head[h];
+    head[h] = i;
+  };
+  for (i32 i = 0; i < size;) {
+    i32 best_length = 0, best_distance = 0;
+    if (i + 3 <= size) {
+      i32 limit = std::min(max_match, size - i);
+      i32 chain = 0;
+      for (i32 j = head[hash(i)]; j >= 0 && i - j <= window_size && chain < max_chain; j = previous[j], ++chain) {
+        i32 length = 0;
+        while (length < limit && data[j + length] == data[i + length])
+          ++length;
+        if (length > best_length) {
+          best_length = length;
+          best_distance = i - j;
+          if (length == limit)
+            break;
+        }
+      }
+    }
+    if (best_length >= 3) {
+      i32 l = 0;
+      while (best_length >= length_base[l + 1])
+        ++l;
+      writer.putSymbol(257 + l);
+      writer.put(best_length - length_base[l], length_extra[l]);
+      i32 d = 0;
+      while (best_distance >= distance_base[d + 1])
+        ++d;
+      writer.putReversed(d, 5);
+      writer.put(best_distance - distance_base[d], distance_extra[d]);
+      for (i32 k = 0; k < best_length; ++k)
+        insert(i + k);
+      i += best_length;
+    } else {
+      writer.putSymbol(data[i]);
+      insert(i);
+      ++i;
+    }
+  }
+  writer.putSymbol(256); // end of block
+  // sync flush: empty stored block ending at a byte boundary
+  writer.put(0, 3);
+  writer.align();
+  for (u8 byte : {0x00, 0x00, 0xff, 0xff})
+    out.emplace_back(byte);
+}
+
+/// Applies the png filter (among the five available) that minimizes the sum of absolute residuals of the row
+/// \param row
+/// \param previous_row (nullptr for the first row)
+/// \param row_size number of bytes in the row
+/// \param out receives the filter type followed by the filtered row
+void filterPngRow(const u8 *row, const u8 *previous_row, i32 row_size, u8 *out) {
+  static constexpr i32 bpp = 3;
+  auto predict = [&](int filter, i32 x) -> u8 {
+    u8 a = x >= bpp ? row[x - bpp] : 0;
+    u8 b = previous_row ? previous_row[x] : 0;
+    u8 c = previous_row && x >= bpp ? previous_row[x - bpp] : 0;
+    switch (filter) {
+    case 1: return a;
+    case 2: return b;
+    case 3: return static_cast<u8>((a + b) / 2);
+    case 4: {
+      int p = a + b - c, pa = std::abs(p - a), pb = std::abs(p - b), pc = std::abs(p - c);
+      return pa <= pb && pa <= pc ? a : pb <= pc ? b : c;
+    }
+    default: return 0;
+    }
+  };
+  int best_filter = 0;
+  u64 best_cost = ~0ull;
+  for (int filter = 0; filter < 5; ++filter) {
+    u64 cost = 0;
+    for (i32 x = 0; x < row_size; ++x)
+      cost += std::abs(static_cast<signed char>(row[x] - predict(filter, x)));
+    if (cost < best_cost) {
+      best_cost = cost;
+      best_filter = filter;
+    }
+  }
+  out[0] = static_cast<u8>(best_filter);
+  for (i32 x = 0; x < row_size; ++x)
+    out[x + 1] = static_cast<u8>(row[x] - predict(best_filter, x));
+}
+
+/// Big endian png chunk writer
+struct PngWriter {
+  std::vector<u8> &bytes;
+  static u32 crc(const u8 *data, size_t size, u32 crc = 0xffffffffu) {
+    static const auto table = []() {
+      std::array<u32, 256> t{};
+      for (u32 n = 0; n < 256; ++n) {
+        u32 c = n;
+        for (int k = 0; k < 8; ++k)
+          c = c & 1 ? 0xedb88320u ^ (c >> 1) : c >> 1;
+        t[n] = c;
+      }
+      return t;
+    }();
+    for (size_t i = 0; i < size; ++i)
+      crc = table[(crc ^ data[i]) & 0xff] ^ (crc >> 8);
+    return crc;
+  }
+  void write(u32 value) {
+    for (int shift = 24; shift >= 0; shift -= 8)
+      bytes.emplace_back(static_cast<u8>(value >> shift));
+  }
+  void chunk(const char *type, const std::vector<u8> &data) {
+    write(static_cast<u32>(data.size()));
+    size_t begin = bytes.size();
+    bytes.insert(bytes.end(), type, type + 4);
+    bytes.insert(bytes.end(), data.begin(), data.end());
+    write(crc(bytes.data() + begin, bytes.size() - begin) ^ 0xffffffffu);
+  }
+};
+
+/// Encodes a png image fed with consecutive bands of rows
+/// Each band goes into its own IDAT chunk, the chunks together hold a single zlib stream.
+class PngBandEncoder {
+public:
+  /// \param width
+  /// \param height
+  /// \param thread_count number of encoding threads (0 = hardware concurrency)
+  PngBandEncoder(i32 width, i32 height, u32 thread_count)
+      : width_(width), height_(height), row_size_(3 * width), thread_count_(thread_count) {}
+  /// \return signature and header chunk
+  [[nodiscard]] std::vector<u8> begin() const {
+    std::vector<u8> bytes = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n'};
+    PngWriter writer{bytes};
+    std::vector<u8> header;
+    PngWriter header_writer{header};
+    header_writer.write(width_);
+    header_writer.write(height_);
+    // 8-bit rgb, deflate, adaptive filtering, no interlace
+    for (u8 value : {8, 2, 0, 0, 0})
+      header.emplace_back(value);
+    writer.chunk("IHDR", header);
+    return bytes;
+  }
+  /// Encodes the next rows of the image
+  /// \param rgb linear rgb values (3 per pixel, row major)
+  /// \param row_count
+  /// \return IDAT chunk
+  std::vector<u8> addRows(const real_t *rgb, i32 row_count) {
+    const auto &quantizer = SrgbQuantizer::instance();
+    // strips of rows are quantized, filtered and compressed independently
+    i32 strip_height = std::max(1, (1 << 18) / row_size_);
+    i32 strip_count = (row_count + strip_height - 1) / strip_height;
+    std::vector<u8> rgb8(static_cast<size_t>(row_size_) * row_count);
+    parallelFor(strip_count, thread_count_, [&](i32 strip) {
+      size_t begin = static_cast<size_t>(strip) * strip_height * row_size_;
+      size_t end = std::min(rgb8.size(), begin + static_cast<size_t>(strip_height) * row_size_);
+      for (size_t i = begin; i < end; ++i)
+        rgb8[i] = quantizer.quantize(rgb[i]);
+    });
+    std::vector<u8> filtered(static_cast<size_t>(row_size_ + 1) * row_count);
+    std::vector<std::vector<u8>> strips(strip_count);
+    parallelFor(strip_count, thread_count_, [&](i32 strip) {
+      i32 y_begin = strip * strip_height, y_end = std::min(row_count, y_begin + strip_height);
+      for (i32 y = y_begin; y < y_end; ++y) {
+        // the first row of a band is predicted from the last row of the previous band
+        const u8 *previous_row = y ? rgb8.data() + static_cast<size_t>(y - 1) * row_size_
+                                   : (previous_row_.empty() ? nullptr : previous_row_.data());
+        filterPngRow(rgb8.data() + static_cast<size_t>(y) * row_size_, previous_row, row_size_,
+                     filtered.data() + static_cast<size_t>(y) * (row_size_ + 1));
+      }
+      deflateStrip(filtered.data() + static_cast<size_t>(y_begin) * (row_size_ + 1),
+                   (y_end - y_begin) * (row_size_ + 1), strips[strip]);
+    });
+    if (row_count)
+      previous_row_.assign(rgb8.end() - row_size_, rgb8.end());
+    // adler32 of the filtered rows is carried to the end of the stream
+    for (size_t i = 0; i < filtered.size();) {
+      size_t end = std::min(filtered.size(), i + 5552);
+      for (; i < end; ++i) {
+        s1_ += filtered[i];
+        s2_ += s1_;
+      }
+      s1_ %= 65521;
+      s2_ %= 65521;
+    }
+    std::vector<u8> idat;
+    // zlib header
+    if (!started_)
+      idat = {0x78, 0x01};
+    started_ = true;
+    for (const auto &strip : strips)
+      idat.insert(idat.end(), strip.begin(), strip.end());
+    std::vector<u8> bytes;
+    PngWriter{bytes}.chunk("IDAT", idat);
+    return bytes;
+  }
+  /// \return final empty block and adler32 of the zlib stream, followed by the end chunk
+  [[nodiscard]] std::vector<u8> end() const {
+    std::vector<u8> idat;
+    if (!started_)
+      idat = {0x78, 0x01};
+    idat.emplace_back(0x03);
+    idat.emplace_back(0x00);
+    for (u32 value : {s2_ >> 8, s2_, s1_ >> 8, s1_})
+      idat.emplace_back(static_cast<u8>(value));
+    std::vector<u8> bytes;
+    PngWriter writer{bytes};
+    writer.chunk("IDAT", idat);
+    writer.chunk("IEND", {});
+    return bytes;
+  }
+
+private:
+  i32 width_{0};
+  i32 height_{0};
+  i32 row_size_{0};
+  u32 thread_count_{0};
+  bool started_{false};
+  std::vector<u8> previous_row_; //!< last quantized row of the previous band
+  u32 s1_{1};
+  u32 s2_{0};
+};
+
+} // namespace
+
+u8 linearToSRGB8(real_t value) {
+  return SrgbQuantizer::instance().quantize(value);
+}
+
+std::vector<u8> encodePNG(const real_t *rgb, const size2 &resolution, u32 thread_count) {
+  i32 width = resolution.width, height = resolution.height;
+  if (!rgb || width <= 0 || height <= 0)
+    return {};
+  PngBandEncoder encoder(width, height, thread_count);
+  auto bytes = encoder.begin();
+  auto idat = encoder.addRows(rgb, height);
+  bytes.insert(bytes.end(), idat.begin(), idat.end());
+  auto end = encoder.end();
+  bytes.insert(bytes.end(), end.begin(), end.end());
+  return bytes;
+}
+
+std::vector<u8> encodeEXR(const real_t *rgb,
+                          const bounds2i &output_bounds,
+                          const size2 &full_resolution,
+                          const ExrOptions &options) {
+  auto resolution = output_bounds.upper() - output_bounds.lower();
+  if (!rgb || resolution.i <= 0 || resolution.j <= 0 || options.tile_size < 0)
+    return {};
+  auto layout = exrLayout(output_bounds, options);
+  auto bytes = exrHeader(output_bounds, full_resolution, options);
+
+  // compress blocks in parallel, each thread picks the next block available
+  std::vector<std::vector<u8>> blocks(layout.block_count);
+  parallelFor(layout.block_count, options.thread_count, [&](i32 block) {
+    std::vector<u8> scratch;
+    encodeExrBlock(rgb, layout, block, 0, options, scratch, blocks[block]);
+  });
+
+  // offset table followed by the chunks
+  ExrWriter writer{bytes};
+  size_t chunk_header_size = options.tile_size ? 20 : 8;
+  u64 offset = bytes.size() + sizeof(u64) * layout.block_count;
+  for (const auto &block : blocks) {
+    writer.write<u64>(offset);
+    offset += chunk_header_size + block.size();
+  }
+  for (i32 block = 0; block < layout.block_count; ++block)
+    appendExrChunk(writer, layout, output_bounds, options, block, blocks[block]);
+  return bytes;
+}
+
 bool save(const Array<real_t> &data,
           const Path &filename,
           const Index2Range<i32> &output_bounds,
-          const size2 &full_resolution) {
+          const size2 &full_resolution,
+          const ExrOptions &exr_options) {
   auto resolution = output_bounds.upper() - output_bounds.lower();
   auto file_extension = filename.extension();
   if (file_extension == "exr") {
+    if (data.size() < 3u * resolution.i * resolution.j)
+      return false;
+    auto bytes = encodeEXR(data.data(), output_bounds, full_resolution, exr_options);
+    std::ofstream file(filename.fullName(), std::ios::binary);
+    file.write(reinterpret_cast<const char *>(bytes.data()), bytes.size());
+    return !bytes.empty() && file.good();
+  } else if (file_extension == "tga") {
     HERMES_NOT_IMPLEMENTED
     return false;
-//    WriteImageEXR(name, rgb, resolution.x, resolution.y, totalResolution.x,
-//                  totalResolution.y, outputBounds.pMin.x,
-//                  outputBounds.pMin.y);
-  } else if (file_extension == "tga" || file_extension == "png") {
-    // 8-bit formats; apply gamma
-    std::unique_ptr<uint8_t[]> rgb8(
-        new uint8_t[3 * resolution.i * resolution.j]);
-    uint8_t *dst = rgb8.get();
-    for (int y = 0; y < resolution.j; ++y) {
-      for (int x = 0; x < resolution.i; ++x) {
-#define TO_BYTE(v) (uint8_t) Numbers::clamp(255.f * globals::gammaCorrect(v) + 0.5f, 0.f, 255.f)
-        dst[0] = TO_BYTE(data[3 * (y * resolution.i + x) + 0]);
-        dst[1] = TO_BYTE(data[3 * (y * resolution.i + x) + 1]);
-        dst[2] = TO_BYTE(data[3 * (y * resolution.i + x) + 2]);
-#undef TO_BYTE
-        dst += 3;
-      }
-    }
-
-    if (file_extension == "tga") {
-      HERMES_NOT_IMPLEMENTED
-      return false;
 //      WriteImageTGA(name, rgb8.get(), resolution.x, resolution.y,
 //                    totalResolution.x, totalResolution.y,
 //                    outputBounds.pMin.x, outputBounds.pMin.y);
-    } else {
-      auto err =
-          stbi_write_png(filename.fullName().c_str(), resolution.i, resolution.j, 3, rgb8.get(), resolution.i * 3);
-//      unsigned int error = lodepng_encode24_file(
-//          name.c_str(), rgb8.get(), resolution.x, resolution.y);
-//      if (error != 0)
-//        Error("Error writing PNG \"%s\": %s", name.c_str(),
-//              lodepng_error_text(error));
-    }
+  } else if (file_extension == "png") {
+    if (data.size() < 3u * resolution.i * resolution.j)
+      return false;
+    // 8-bit format; apply gamma
+    auto bytes = encodePNG(data.data(), size2(resolution.i, resolution.j));
+    std::ofstream file(filename.fullName(), std::ios::binary);
+    file.write(reinterpret_cast<const char *>(bytes.data()), bytes.size());
+    return !bytes.empty() && file.good();
   } else {
     Log::error("Can't determine image file type from suffix of filename \"{}\"", filename);
   }
   return true;
 }
 
-}
\ No newline at end of file
+
+bool saveRows(const RowReader &read_rows,
+              const Path &filename,
+              const bounds2i &output_bounds,
+              const size2 &full_resolution,
+              int band_height,
+              const ExrOptions &exr_options) {
+  auto resolution = output_bounds.upper() - output_bounds.lower();
+  if (!read_rows || resolution.i <= 0 || resolution.j <= 0 || band_height <= 0 || exr_options.tile_size < 0)
+    return false;
+  auto file_extension = filename.extension();
+  if (file_extension != "exr" && file_extension != "png") {
+    Log::error("Can't save image rows of \"{}\", only exr and png files are written in bands", filename);
+    return false;
+  }
+  std::ofstream file(filename.fullName(), std::ios::binary);
+  auto write = [&](const std::vector<u8> &bytes) {
+    file.write(reinterpret_cast<const char *>(bytes.data()), bytes.size());
+  };
+  // rows [row_begin, row_end) relative to the data window
+  auto read = [&](i32 row_begin, i32 row_end) {
+    auto rgb = read_rows(output_bounds.lower().j + row_begin, output_bounds.lower().j + row_end);
+    return rgb.size() < 3u * resolution.i * (row_end - row_begin) ? Array<real_t>() : rgb;
+  };
+  if (file_extension == "png") {
+    PngBandEncoder encoder(resolution.i, resolution.j, 0);
+    write(encoder.begin());
+    for (i32 y = 0; y < resolution.j; y += band_height) {
+      i32 y_end = std::min(resolution.j, y + band_height);
+      auto rgb = read(y, y_end);
+      if (!rgb.size())
+        return false;
+      write(encoder.addRows(rgb.data(), y_end - y));
+    }
+    write(encoder.end());
+    return file.good();
+  }
+  // exr: the offset table is filled once all chunks were written
+  auto layout = exrLayout(output_bounds, exr_options);
+  auto header = exrHeader(output_bounds, full_resolution, exr_options);
+  write(header);
+  std::vector<u64> offsets(layout.block_count, 0);
+  file.write(reinterpret_cast<const char *>(offsets.data()), sizeof(u64) * offsets.size());
+  u64 offset = header.size() + sizeof(u64) * layout.block_count;
+  // bands hold whole rows of blocks
+  i32 band_rows = (band_height + layout.block_height - 1) / layout.block_height * layout.block_height;
+  for (i32 y = 0; y < resolution.j; y += band_rows) {
+    i32 y_end = std::min(resolution.j, y + band_rows);
+    auto rgb = read(y, y_end);
+    if (!rgb.size())
+      return false;
+    i32 first_block = y / layout.block_height * layout.blocks_per_row;
+    i32 block_end = std::min(layout.block_count,
+                             (y_end + layout.block_height - 1) / layout.block_height * layout.blocks_per_row);
+    std::vector<std::vector<u8>> blocks(block_end - first_block);
+    parallelFor(block_end - first_block, exr_options.thread_count, [&](i32 k) {
+      std::vector<u8> scratch;
+      encodeExrBlock(rgb.data(), layout, first_block + k, y, exr_options, scratch, blocks[k]);
+    });
+    std::vector<u8> chunks;
+    ExrWriter writer{chunks};
+    for (i32 k = 0; k < block_end - first_block; ++k) {
+      offsets[first_block + k] = offset;
+      offset += appendExrChunk(writer, layout, output_bounds, exr_options, first_block + k, blocks[k]);
+    }
+    write(chunks);
+  }
+  std::vector<u8> table;
+  ExrWriter table_writer{table};
+  for (u64 block_offset : offsets)
+    table_writer.write<u64>(block_offset);
+  file.seekp(static_cast<std::streamoff>(header.size()));
+  write(table);
+  return file.good();
+}
+
+}
@@ -28,16 +28,93 @@
 #include <cmath>
 #include <cstdint>
 #include <cstring>
+#include <functional>
+#include <vector>
 #include <hermes/storage/array.h>
 #include <hermes/common/file_system.h>
 #include <helios/geometry/bounds.h>
 
 namespace helios::io {
 
+/// Pixel storage of OpenEXR channels
+enum class ExrPixelType : u8 {
+  HALF = 1,
+  FLOAT = 2
+};
+
+/// Compression applied to each OpenEXR block (values match the file format)
+enum class ExrCompression : u8 {
+  NONE = 0,
+  ZIPS = 2,           //!< zlib, one scanline per block
+  ZIP = 3             //!< zlib, 16 scanlines per block
+};
+
+/// OpenEXR output options
+struct ExrOptions {
+  ExrPixelType pixel_type{ExrPixelType::HALF};
+  ExrCompression compression{ExrCompression::ZIP};
+  int tile_size{0};                         //!< tile side in pixels (0 = scanline layout)
+  u32 thread_count{0};                      //!< number of encoding threads (0 = hardware concurrency)
+};
+
+/// Encodes an rgb image as an OpenEXR file in memory
+/// \note Blocks (scanline groups or tiles) are compressed independently across threads reading directly from rgb
+/// \param rgb linear rgb values (3 per pixel, row major) covering output_bounds
+/// \param output_bounds data window of the image
+/// \param full_resolution display window size
+/// \param options
+/// \return file contents (empty on invalid input)
+std::vector<u8> encodeEXR(const real_t *rgb,
+                          const bounds2i &output_bounds,
+                          const hermes::size2 &full_resolution,
+                          const ExrOptions &options = {});
+
+/// Converts a linear value into an 8-bit sRGB value through a lookup table
+/// \note Matches rounding 255 * globals::gammaCorrect(value) exactly
+/// \param value
+/// \return
+u8 linearToSRGB8(real_t value);
+
+/// Encodes an rgb image as an 8-bit sRGB PNG file in memory
+/// \note Row strips are quantized and compressed independently across threads and joined into a single stream
+/// \param rgb linear rgb values (3 per pixel, row major)
+/// \param resolution
+/// \param thread_count number of encoding threads (0 = hardware concurrency)
+/// \return file contents (empty on invalid input)
+std::vector<u8> encodePNG(const real_t *rgb, const hermes::size2 &resolution, u32 thread_count = 0);
+
+/// Saves an rgb image into a file, the file format is deduced from filename's extension
+/// \param data linear rgb values (3 per pixel, row major) covering output_bounds
+/// \param filename
+/// \param output_bounds
+/// \param full_resolution
+/// \param exr_options used when filename's extension is exr
+/// \return true if the file was written
 bool save(const hermes::Array<real_t> &data,
           const hermes::Path &filename,
           const bounds2i &output_bounds,
-          const hermes::size2 &full_resolution);
+          const hermes::size2 &full_resolution,
+          const ExrOptions &exr_options = {});
+
+/// Provides the rgb values (3 per pixel, row major) of the image rows [row_begin, row_end)
+/// \note Rows are given in image coordinates (the same as output_bounds)
+using RowReader = std::function<hermes::Array<real_t>(int row_begin, int row_end)>;
+
+/// Saves an image read in bands of rows, so only one band is held in memory at a time
+/// \note Only exr and png files can be written this way. Exr bands are rounded up to whole blocks.
+/// \param read_rows provides the rows of output_bounds
+/// \param filename
+/// \param output_bounds
+/// \param full_resolution
+/// \param band_height number of rows read at a time
+/// \param exr_options used when filename's extension is exr
+/// \return true if the file was written (false if read_rows hands fewer values than requested)
+bool saveRows(const RowReader &read_rows,
+              const hermes::Path &filename,
+              const bounds2i &output_bounds,
+              const hermes::size2 &full_resolution,
+              int band_height = 256,
+              const ExrOptions &exr_options = {});
 
 } // namespace helios
 
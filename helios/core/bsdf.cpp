@@ -29,48 +29,75 @@
 
 namespace helios {
 
-/*
-BSDF::BSDF(const SurfaceInteraction &si, real_t eta)
-    : eta(eta), ns(si.shading.n), ng(si.n),
-      ss(ponos::normalize(si.shading.dpdu)), ts(ponos::cross(ns, ss)) {}
-
-void BSDF::add(BxDF *b) { bxdfs[nBxDFs++] = b; }
+HERMES_DEVICE_CALLABLE ShadingFrame ShadingFrame::fromXZ(const hermes::vec3 &x, const hermes::vec3 &z) {
+  ShadingFrame frame;
+  frame.z = z;
+  frame.x = x - z * hermes::dot(x, z);
+  if (frame.x.length2() <= 1e-10f * x.length2())
+    // degenerate tangent (null or parallel to z), any direction perpendicular to z will do
+    frame.x = fabsf(z.x) > fabsf(z.y) ? hermes::vec3(-z.z, 0, z.x) : hermes::vec3(0, z.z, -z.y);
+  frame.x = hermes::normalize(frame.x);
+  frame.y = hermes::cross(z, frame.x);
+  return frame;
+}
 
-int BSDF::numComponents(BxDF::Type types) const {}
+HERMES_DEVICE_CALLABLE BSDF::BSDF() {}
 
-ponos::vec3 BSDF::worldToLocal(const ponos::vec3 &v) const {
-  return ponos::vec3(ponos::dot(v, ss), ponos::dot(v, ts), ponos::dot(v, ns));
+HERMES_DEVICE_CALLABLE BSDF::BSDF(hermes::normal3 ns, hermes::vec3 dpdus, BxDF bxdf)
+    : frame_(shadingFrame(ns, dpdus)), flags_(bxdf.flags), type_(bxdf.type) {
+  if (!bxdf)
+    type_ = BxDFType::NONE;
+  else
+    CAST_BXDF(bxdf, ptr, new(bxdf_data_) std::remove_pointer_t<decltype(ptr)>(*ptr);)
 }
 
-ponos::vec3 BSDF::localToWorld(const ponos::vec3 &v) const {
-  return ponos::vec3(ss.x * v.x + ts.x * v.y + ns.x * v.z,
-                     ss.y * v.x + ts.y * v.y + ns.y * v.z,
-                     ss.z * v.x + ts.z * v.y + ns.z * v.z);
+HERMES_DEVICE_CALLABLE BSDF::operator bool() const {
+  return type_ != BxDFType::NONE;
 }
 
-SpectrumOld BSDF::f(const ponos::vec3 &woW, const ponos::vec3 &wiW,
-                 BxDF::Type types) const {
-  ponos::vec3 wi = worldToLocal(wiW), wo = worldToLocal(woW);
-  bool reflect = ponos::dot(wiW, ng) * ponos::dot(woW, ng) > 0;
-  SpectrumOld s(0.f);
-  for (int i = 0; i < nBxDFs; ++i)
-    if (bxdfs[i]->matchesFlags(types) &&
-        ((reflect && (bxdfs[i]->type & BxDF::Type::BSDF_REFLECTION)) ||
-         (!reflect && (bxdfs[i]->type & BxDF::Type::BSDF_TRANSMISSION))))
-      s += bxdfs[i]->f(wo, wi);
+HERMES_DEVICE_CALLABLE SampledSpectrum BSDF::f(const hermes::vec3 &wo, const hermes::vec3 &wi,
+                                               TransportMode mode) const {
+  if (!isNonSpecular())
+    return {};
+  hermes::vec3 wo_local = frame_.toLocal(wo);
+  if (wo_local.z == 0)
+    return {};
+  hermes::vec3 wi_local = frame_.toLocal(wi);
+  SampledSpectrum s;
+  CAST_CONST_INLINE_BXDF(type_, bxdf_data_, ptr, s = ptr->f(wo_local, wi_local, mode);)
   return s;
 }
-*/
 
-HERMES_DEVICE_CALLABLE BSDF::BSDF() {}
-
-HERMES_DEVICE_CALLABLE BSDF::BSDF(hermes::normal3 ns, hermes::vec3 dpdus, BxDF bxdf)
-    : bxdf_(bxdf)/*, shadingFrame(Frame::FromXZ(Normalize(dpdus), Vector3f(ns)))*/ {}
+HERMES_DEVICE_CALLABLE BSDFSampleReturn BSDF::sample_f(const hermes::vec3 &wo, real_t uc, const hermes::point2 &u,
+                                                       TransportMode mode,
+                                                       bxdf_refl_trans_flags sample_flags) const {
+  hermes::vec3 wo_local = frame_.toLocal(wo);
+  // reflection and transmission share their bits in both flag types
+  if (wo_local.z == 0 || (flags_ & static_cast<bxdf_flags>(sample_flags)) == bxdf_flags::NONE)
+    return {};
+  BSDFSampleReturn bs;
+  CAST_CONST_INLINE_BXDF(type_, bxdf_data_, ptr, bs = ptr->sample_f(wo_local, uc, u, mode, sample_flags);)
+  if (!bs || !bs->f || bs->pdf == 0 || bs->wi.z == 0)
+    return {};
+  bs->wi = frame_.fromLocal(bs->wi);
+  return bs;
+}
 
-HERMES_DEVICE_CALLABLE BSDF::~BSDF() {}
+HERMES_DEVICE_CALLABLE real_t BSDF::PDF(const hermes::vec3 &wo, const hermes::vec3 &wi, TransportMode mode,
+                                        bxdf_refl_trans_flags sample_flags) const {
+  if (!isNonSpecular())
+    return 0;
+  hermes::vec3 wo_local = frame_.toLocal(wo);
+  if (wo_local.z == 0)
+    return 0;
+  hermes::vec3 wi_local = frame_.toLocal(wi);
+  real_t pdf = 0;
+  CAST_CONST_INLINE_BXDF(type_, bxdf_data_, ptr, pdf = ptr->PDF(wo_local, wi_local, mode, sample_flags);)
+  return pdf;
+}
 
-HERMES_DEVICE_CALLABLE BSDF::operator bool() const {
-  return (bool) bxdf_;
+HERMES_DEVICE_CALLABLE ShadingFrame BSDF::shadingFrame(hermes::normal3 ns, hermes::vec3 dpdus) {
+  return ShadingFrame::fromXZ(dpdus, hermes::vec3(ns.x, ns.y, ns.z));
 }
 
 } // namespace helios
@@ -28,103 +28,134 @@
 #ifndef HELIOS_CORE_BSDF_H
 #define HELIOS_CORE_BSDF_H
 
-#include <helios/base/bxdf.h>
+#include <helios/scattering/bxdfs.h>
 #include <hermes/geometry/normal.h>
+#include <new>
 
 namespace helios {
 
+// *********************************************************************************************************************
+//                                                                                                       ShadingFrame
+// *********************************************************************************************************************
+/// Orthonormal basis of the shading coordinate system (see ShadingCoordinateSystem), where x and y are the tangent
+/// vectors and z is the shading normal
+struct ShadingFrame {
+  // *******************************************************************************************************************
+  //                                                                                                   STATIC METHODS
+  // *******************************************************************************************************************
+  /// Builds the frame from the primary tangent and the normal
+  /// \param x primary tangent (does not need to be orthogonal to z)
+  /// \param z normal (unit length)
+  /// \return
+  HERMES_DEVICE_CALLABLE static ShadingFrame fromXZ(const hermes::vec3 &x, const hermes::vec3 &z);
+  // *******************************************************************************************************************
+  //                                                                                                          METHODS
+  // *******************************************************************************************************************
+  /// \param v vector in world space
+  /// \return v in shading space
+  [[nodiscard]] HERMES_DEVICE_CALLABLE hermes::vec3 toLocal(const hermes::vec3 &v) const {
+    return {hermes::dot(v, x), hermes::dot(v, y), hermes::dot(v, z)};
+  }
+  /// \param v vector in shading space
+  /// \return v in world space
+  [[nodiscard]] HERMES_DEVICE_CALLABLE hermes::vec3 fromLocal(const hermes::vec3 &v) const {
+    return x * v.x + y * v.y + z * v.z;
+  }
+  // *******************************************************************************************************************
+  //                                                                                                    PUBLIC FIELDS
+  // *******************************************************************************************************************
+  hermes::vec3 x{1, 0, 0}; //!< primary tangent
+  hermes::vec3 y{0, 1, 0}; //!< secondary tangent
+  hermes::vec3 z{0, 0, 1}; //!< shading normal
+};
+
 // *********************************************************************************************************************
 //                                                                                                               BSDF
 // *********************************************************************************************************************
 /// Represents a Bidirectional Scattering Distribution Function
 /// The BSDF is composed of a set of BRDFs and BTDFs
+/// \note The BxDF payload is stored by value in an inline buffer large enough for any BxDF type
+///       (see InlineBxDFStorage), so a BSDF can live entirely on the stack
 class BSDF {
 public:
   // *******************************************************************************************************************
   //                                                                                                     CONSTRUCTORS
   // *******************************************************************************************************************
   HERMES_DEVICE_CALLABLE BSDF();
+  /// \tparam T BxDF type
+  /// \param ns shading normal
+  /// \param dpdus shading partial derivative of p with respect to u
+  /// \param bxdf
+  template<typename T>
+  HERMES_DEVICE_CALLABLE BSDF(hermes::normal3 ns, hermes::vec3 dpdus, const T &bxdf)
+      : frame_(shadingFrame(ns, dpdus)), flags_(bxdf.flags()), type_(BxDFs::enumFromType<T>()) {
+    static_assert(sizeof(T) <= InlineBxDFStorage::size && alignof(T) <= InlineBxDFStorage::alignment,
+                  "BxDF type is missing from InlineBxDFStorage");
+    new(bxdf_data_) T(bxdf);
+  }
+  /// Copies the payload of an allocated BxDF
+  /// \param ns shading normal
+  /// \param dpdus shading partial derivative of p with respect to u
+  /// \param bxdf
   HERMES_DEVICE_CALLABLE BSDF(hermes::normal3 ns, hermes::vec3 dpdus, BxDF bxdf);
-  HERMES_DEVICE_CALLABLE ~BSDF();
   // *******************************************************************************************************************
   //                                                                                                        OPERATORS
   // *******************************************************************************************************************
   HERMES_DEVICE_CALLABLE explicit operator bool() const;
+  // *******************************************************************************************************************
+  //                                                                                                          METHODS
+  // *******************************************************************************************************************
+  /// \return
+  [[nodiscard]] HERMES_DEVICE_CALLABLE bxdf_flags flags() const { return flags_; }
+  /// \return
+  [[nodiscard]] HERMES_DEVICE_CALLABLE const ShadingFrame &frame() const { return frame_; }
+  /// \return true if the BSDF has diffuse or glossy lobes (that can be evaluated for arbitrary directions)
+  [[nodiscard]] HERMES_DEVICE_CALLABLE bool isNonSpecular() const {
+    return (flags_ & (bxdf_flags::DIFFUSE | bxdf_flags::GLOSSY)) != bxdf_flags::NONE;
+  }
+  /// \return true if the BSDF has specular lobes
+  [[nodiscard]] HERMES_DEVICE_CALLABLE bool isSpecular() const {
+    return HELIOS_MASK_BIT(flags_, bxdf_flags::SPECULAR);
+  }
+  /// Evaluates the BSDF for a pair of directions
+  /// \note Specular lobes are delta distributions and never contribute here, so purely specular BSDFs return
+  ///       immediately (this is the common case when sampling lights)
+  /// \param wo outgoing direction (world space)
+  /// \param wi incident direction (world space)
+  /// \param mode
+  /// \return
+  [[nodiscard]] HERMES_DEVICE_CALLABLE SampledSpectrum f(const hermes::vec3 &wo, const hermes::vec3 &wi,
+                                                         TransportMode mode = TransportMode::RADIANCE) const;
+  /// Samples an incident direction
+  /// \param wo outgoing direction (world space)
+  /// \param uc sample used to choose between lobes
+  /// \param u sample used to choose the direction
+  /// \param mode
+  /// \param sample_flags restricts sampling to reflection and/or transmission
+  /// \return sample with incident direction in world space (empty if no lobe matches sample_flags)
+  [[nodiscard]] HERMES_DEVICE_CALLABLE
+  BSDFSampleReturn sample_f(const hermes::vec3 &wo, real_t uc, const hermes::point2 &u,
+                            TransportMode mode = TransportMode::RADIANCE,
+                            bxdf_refl_trans_flags sample_flags = bxdf_refl_trans_flags::ALL) const;
+  /// Computes the density sample_f uses to sample wi
+  /// \param wo outgoing direction (world space)
+  /// \param wi incident direction (world space)
+  /// \param mode
+  /// \param sample_flags
+  /// \return
+  [[nodiscard]] HERMES_DEVICE_CALLABLE
+  real_t PDF(const hermes::vec3 &wo, const hermes::vec3 &wi, TransportMode mode = TransportMode::RADIANCE,
+             bxdf_refl_trans_flags sample_flags = bxdf_refl_trans_flags::ALL) const;
 
 private:
-  BxDF bxdf_;
-};
-
-
-/*
-/// Represents a collection of BRDFs and BTDFs.
-class BSDF {
-public:
-  /// \param si information about the differential geometry of points in the
-  /// surface
-  /// \param eta **[default = 1]** relative index of refraction over the
-  /// boundary
-  BSDF(const SurfaceInteraction &si, real_t eta = 1);
-  /// Adds an BxDF component
-  /// \param b BxDF component raw pointer
-  void add(BxDF *b);
-  /// Computes the number of BxDFs stored that match the set of types
-  /// \param types flag
-  /// \return int number of matches
-  int numComponents(BxDF::Type types = BxDF::BSDF_ALL) const;
-  /// \param v input vector in world space
-  /// \return ponos::vec3 **v** transformed onto shading space
-  ponos::vec3 worldToLocal(const ponos::vec3 &v) const;
-  /// \param v input vector in local space
-  /// \return ponos::vec3 **v** transformed onto world space
-  ponos::vec3 localToWorld(const ponos::vec3 &v) const;
-  /// Evaluates de BSDF for a given pair of directions
-  /// \param woW outgoing direction in world space
-  /// \param wiW incident direction in world space
-  /// \param types types filter
-  /// \return SpectrumOld total contribution of components
-  SpectrumOld f(const ponos::vec3 &woW, const ponos::vec3 &wiW,
-             BxDF::Type types) const;
-  /// Computes the accumulated hemispherical-hemispherical reflectance that
-  /// gives the fraction of incident light reflected by the surface when
-  /// incident light is the same from all directions
-  /// \param nSamples
-  /// \param samples1
-  /// \param samples2
-  /// \param flags BxDF type filter
-  /// \return SpectrumOld
-  SpectrumOld rho(int nSamples, const ponos::point2 *samples1,
-               const ponos::point2 *samples2,
-               BxDF::Type flags = BxDF::Type::BSDF_ALL) const;
-  /// Computes the accumulated hemispherical-directional reflectance that gives
-  /// the total reflection in a given direction due to constant illumination
-  /// over the hemisphere
-  /// \param wo **[in]** outgoing direction
-  /// \param nSamples number of samples
-  /// \param samples hemisphere sample positions (only needed by some
-  /// algorithms)
-  /// \param flags BxDF type filter
-  /// \return SpectrumOld the value of the function
-  SpectrumOld rho(const ponos::vec3 &wo, int nSamples,
-               const ponos::point2 *samples,
-               BxDF::Type flags = BxDF::Type::BSDF_ALL) const;
-
-  const real_t eta; //!< relative index of refraction over the boundary
-private:
-  /// Made private to force user to use MemoryArena instead of usual new/delete
-  /// methods
-  ~BSDF() = default;
+  HERMES_DEVICE_CALLABLE static ShadingFrame shadingFrame(hermes::normal3 ns, hermes::vec3 dpdus);
 
-  const ponos::normal3
-      ns; //!< shading normal (given by bump mapping for example)
-  const ponos::normal3 ng; //!< geometric normal
-  const ponos::vec3 ss;    //!< primary tangent
-  const ponos::vec3 ts;    //!< secundary tangent
-  int nBxDFs = 0;          //!< number of BxDF components
-  static constexpr int maxBxDFs = 8;
-  BxDF *bxdfs[maxBxDFs]; //!< component array
+  ShadingFrame frame_;
+  bxdf_flags flags_{bxdf_flags::NONE};
+  BxDFType type_{BxDFType::NONE};
+  alignas(InlineBxDFStorage::alignment) u8 bxdf_data_[InlineBxDFStorage::size]{};
 };
-*/
+
 } // namespace helios
 
 #endif
@@ -2,7 +2,9 @@
 #include <helios/common/globals.h>
 #include <hermes/common/cuda_utils.h>
 
+#include <fstream>
 #include <utility>
+#include <vector>
 
 using namespace hermes;
 
@@ -13,50 +15,74 @@ HERMES_DEVICE_CALLABLE FilmTile::FilmTile(const bounds2i &pixel_bounds, const PC
   pixels_ = new FilmTilePixel[pixel_bounds.area()];
 }
 
+HERMES_DEVICE_CALLABLE FilmTile::FilmTile(const bounds2i &pixel_bounds, const PCF *filter, FilmTilePixel *pixels)
+    : pixel_bounds_(pixel_bounds), filter_(filter), pixels_(pixels), owns_pixels_(false) {
+  for (int i = 0; i < pixel_bounds.area(); ++i)
+    pixels_[i] = FilmTilePixel();
+}
+
 HERMES_DEVICE_CALLABLE FilmTile::~FilmTile() {
-  delete[] pixels_;
+  if (owns_pixels_)
+    delete[] pixels_;
 }
 
 HERMES_DEVICE_CALLABLE void FilmTile::addSample(const point2 &p, const SpectrumOld &L,
                                                 real_t sample_weight) {
   // compute sample's raster bounds
   point2 p_discrete = p - vec2(0.5f);
+  // luminance statistics are kept by the pixel containing the sample
+  index2 owner = floor(p);
+  if (pixel_bounds_.contains(owner)) {
+    FilmTilePixel &owner_pixel = getPixel(owner);
+    real_t luminance = L.y() * sample_weight;
+    owner_pixel.luminance_sum += luminance;
+    owner_pixel.luminance_sq_sum += luminance * luminance;
+    owner_pixel.sample_count++;
+  }
   index2 p0 = ceil(p_discrete - filter_->radius);
   index2 p1 = floor(p_discrete + filter_->radius) + vec2(1);
   p0 = max(p0, pixel_bounds_.lower());
   p1 = min(p1, pixel_bounds_.upper());
-
-//  printf("%d %d %d %d (%d %d %d %d)\n",
-//         pixel_bounds_.lower().i,
-//         pixel_bounds_.lower().j,
-//         pixel_bounds_.upper().i,
-//         pixel_bounds_.upper().j,
-//         p0.i, p0.j, p1.i, p1.j);
-
+  // the film clamps the filter radius, so footprints fit Filter::max_footprint_width and tables live on the stack
+  int x_count = p1.i - p0.i;
+  int y_count = p1.j - p0.j;
+  if (x_count <= 0 || y_count <= 0)
+    return;
+  // precompute x and y filter weights (the filter is separable, so a weight is a single product)
+  const int table_width = filter_->table_width;
+  real_t wx[Filter::max_footprint_width];
+  for (int x = 0; x < x_count; ++x) {
+    real_t fx = abs((p0.i + x - p_discrete.x) * filter_->inv_radius.x * table_width);
+    wx[x] = filter_->table_x[min((int) floor(fx), table_width - 1)];
+  }
+  real_t wy[Filter::max_footprint_width];
+  for (int y = 0; y < y_count; ++y) {
+    real_t fy = abs((p0.j + y - p_discrete.y) * filter_->inv_radius.y * table_width);
+    wy[y] = filter_->table_y[min((int) floor(fy), table_width - 1)];
+  }
   // loop over filter support and add sample to pixel arrays
-  // precompute x and y filter table offsets
-  int *ifx = new int[p1.i - p0.i];
-  for (int x = p0.i; x < p1.i; ++x) {
-    real_t fx =
-        abs((x - p_discrete.x) * filter_->inv_radius.x * PCF::filter_table_width);
-    ifx[x - p0.i] = min((int) floor(fx), PCF::filter_table_width - 1);
-  }
-  int *ify = new int[p1.j - p0.j];
-  for (int y = p0.j; y < p1.j; ++y) {
-    real_t fy = abs((y - p_discrete.y) * filter_->inv_radius.y * PCF::filter_table_width);
-    ifx[y - p0.j] = min((int) floor(fy), PCF::filter_table_width - 1);
-  }
-  for (auto ij : range2(p0, p1)) {
-    // evaluate filter value at (x, y) pixel
-    int offset = ify[ij.j - p0.j] * PCF::filter_table_width + ifx[ij.i - p0.i];
-    real_t filterWeight = filter_->table[offset];
-    // update pixel values with filtered sample contribution
-    FilmTilePixel &pixel = getPixel(ij);
-    pixel.contrib_sum += L * sample_weight * filterWeight;
-    pixel.filter_weight_sum += filterWeight;
-  }
-  delete[] ifx;
-  delete[] ify;
+  SpectrumOld weighted_L = L * sample_weight;
+  for (int y = 0; y < y_count; ++y) {
+    FilmTilePixel *pixel_row = &getPixel(index2(p0.i, p0.j + y));
+    for (int x = 0; x < x_count; ++x) {
+      // evaluate filter value at (x, y) pixel
+      real_t filter_weight = wx[x] * wy[y];
+      // update pixel values with filtered sample contribution
+      pixel_row[x].contrib_sum += weighted_L * filter_weight;
+      pixel_row[x].filter_weight_sum += filter_weight;
+    }
+  }
+}
+
+HERMES_DEVICE_CALLABLE void FilmTile::addPixelSample(const index2 &p, const SpectrumOld &L, real_t filter_weight,
+                                                     real_t sample_weight) {
+  FilmTilePixel &pixel = getPixel(p);
+  pixel.contrib_sum += L * (sample_weight * filter_weight);
+  pixel.filter_weight_sum += filter_weight;
+  real_t luminance = L.y() * sample_weight;
+  pixel.luminance_sum += luminance;
+  pixel.luminance_sq_sum += luminance * luminance;
+  pixel.sample_count++;
 }
 
 HERMES_DEVICE_CALLABLE FilmTilePixel &FilmTile::getPixel(const index2 &p) {
@@ -73,17 +99,21 @@ HERMES_DEVICE_CALLABLE const FilmTilePixel &FilmTile::getPixel(const index2 &p)
 
 HERMES_DEVICE_CALLABLE bounds2i FilmTile::getPixelBounds() const { return pixel_bounds_; }
 
-Film::Film(const hermes::size2 &resolution, Filter *filter, real_t diagonal, const bounds2 &crop_window)
+Film::Film(const hermes::size2 &resolution, Filter *filter, real_t diagonal, const bounds2 &crop_window,
+           FilmFilterMode filter_mode)
     : full_resolution(resolution),
       cropped_pixel_bounds{bounds2i(
           index2(std::ceil(full_resolution.width * crop_window.lower.x),
                  std::ceil(full_resolution.height * crop_window.lower.y)),
           index2(std::ceil(full_resolution.width * crop_window.upper.x),
                  std::ceil(full_resolution.height * crop_window.upper.y)))},
-      diagonal(diagonal * .001), filter(filter) {
+      diagonal(diagonal * .001), filter(filter), filter_mode(filter_mode) {
 }
 
 HERMES_DEVICE_CALLABLE bounds2i Film::sampleBounds() const {
+  // importance sampled pixels only receive their own samples
+  if (filter_mode == FilmFilterMode::IMPORTANCE)
+    return cropped_pixel_bounds;
   return bounds2i(floor(point2(cropped_pixel_bounds.lower()) +
                       vec2(0.5) + filter.radius),
                   ceil(point2(cropped_pixel_bounds.upper()) +
@@ -97,71 +127,344 @@ HERMES_DEVICE_CALLABLE bounds2 Film::physicalExtent() const {
   return bounds2(point2(-x / 2, -y / 2), point2(x / 2, y / 2));
 }
 
-HERMES_DEVICE_CALLABLE FilmTile Film::filmTile(const bounds2i &sample_bounds) {
+HERMES_DEVICE_CALLABLE bounds2i Film::filmTileBounds(const bounds2i &sample_bounds) const {
   // bound image pixels_ that samples in sample_bounds contribute to
+  if (filter_mode == FilmFilterMode::IMPORTANCE)
+    return intersect(sample_bounds, cropped_pixel_bounds);
   vec2 half_pixel = vec2(0.5f);
   bounds2 floatBounds = sample_bounds;
   index2 p0 = ceil(floatBounds.lower - half_pixel - filter.radius);
   index2 p1 = floor(floatBounds.upper - half_pixel + filter.radius) + vec2(1);
-  bounds2i tilePixelBounds = intersect(bounds2i(p0, p1), cropped_pixel_bounds);
-  return FilmTile(tilePixelBounds, &filter);
+  return intersect(bounds2i(p0, p1), cropped_pixel_bounds);
+}
+
+HERMES_DEVICE_CALLABLE int Film::footprintRowCount(int sample_row_count) const {
+  if (filter_mode == FilmFilterMode::IMPORTANCE)
+    return sample_row_count;
+  // rows in [ceil(y - 0.5 - r), floor(y + n - 0.5 + r)]
+  return sample_row_count + 1 + (int) floor(2 * filter.radius.y);
+}
+
+HERMES_DEVICE_CALLABLE FilmTile Film::filmTile(const bounds2i &sample_bounds) {
+  return FilmTile(filmTileBounds(sample_bounds), &filter);
+}
+
+HERMES_DEVICE_CALLABLE FilmTile Film::filmTile(const bounds2i &sample_bounds, FilmTilePixel *pixels) {
+  return FilmTile(filmTileBounds(sample_bounds), &filter, pixels);
+}
+
+HERMES_DEVICE_CALLABLE FilmTile FilmTileBuffer::View::filmTile(Film &film,
+                                                               const index2 &tile,
+                                                               const bounds2i &sample_bounds) {
+  auto tile_index = tile.j * n_tiles_.width + tile.i;
+  auto tile_pixel_bounds = film.filmTileBounds(sample_bounds);
+  // slots only cover filters up to Filter::max_radius
+  int side = tile_size_ + Filter::max_footprint_width;
+  tile_pixel_bounds = intersect(tile_pixel_bounds,
+                                bounds2i(tile_pixel_bounds.lower(),
+                                         tile_pixel_bounds.lower() + index2(side, side)));
+  tile_bounds_[tile_index] = tile_pixel_bounds;
+  return FilmTile(tile_pixel_bounds, &film.filter, pixels_ + tile_index * tile_capacity_);
+}
+
+HERMES_DEVICE_CALLABLE FilmTilePixel FilmTileBuffer::View::accumulate(const index2 &p) const {
+  FilmTilePixel sum;
+  // only tiles whose sample region is within the maximum filter radius can contribute to p
+  int slack = Filter::max_radius + 1;
+  int tile_size = tile_size_;
+  int i0 = max(0, p.i - slack - sample_bounds_.lower().i) / tile_size;
+  int i1 = min((int) n_tiles_.width - 1, max(0, p.i + slack - sample_bounds_.lower().i) / tile_size);
+  int j0 = max(0, p.j - slack - sample_bounds_.lower().j) / tile_size;
+  int j1 = min((int) n_tiles_.height - 1, max(0, p.j + slack - sample_bounds_.lower().j) / tile_size);
+  for (int j = j0; j <= j1; ++j)
+    for (int i = i0; i <= i1; ++i) {
+      auto tile_index = j * n_tiles_.width + i;
+      const bounds2i &bounds = tile_bounds_[tile_index];
+      if (!bounds.contains(p))
+        continue;
+      int width = bounds.upper().i - bounds.lower().i;
+      int offset = (p.i - bounds.lower().i) + (p.j - bounds.lower().j) * width;
+      const FilmTilePixel &tile_pixel = pixels_[tile_index * tile_capacity_ + offset];
+      sum.contrib_sum += tile_pixel.contrib_sum;
+      sum.filter_weight_sum += tile_pixel.filter_weight_sum;
+      sum.luminance_sum += tile_pixel.luminance_sum;
+      sum.luminance_sq_sum += tile_pixel.luminance_sq_sum;
+      sum.sample_count += tile_pixel.sample_count;
+    }
+  return sum;
+}
+
+HERMES_DEVICE_CALLABLE bounds2i FilmTileBuffer::View::pixelBounds() const {
+  return pixel_bounds_;
 }
 
-FilmImageView::FilmImageView(FilmPixel *pixels, f32 *rgb, Film film, real_t scale) : film_{std::move(film)},
-                                                                                     pixels_{pixels},
-                                                                                     rgb_{rgb}, scale{scale} {
+HeResult FilmTileBuffer::resize(const Film &film, const bounds2i &sample_bounds, const size2 &n_tiles, u32 tile_size) {
+  u32 side = tile_size + Filter::max_footprint_width;
+  view_.tile_capacity_ = side * side;
+  view_.n_tiles_ = n_tiles;
+  view_.tile_size_ = tile_size;
+  view_.sample_bounds_ = sample_bounds;
+  view_.pixel_bounds_ = film.filmTileBounds(sample_bounds);
+  if (pixels_.size() < n_tiles.total() * view_.tile_capacity_)
+    pixels_.resize(n_tiles.total() * view_.tile_capacity_);
+  if (tile_bounds_.size() < n_tiles.total())
+    tile_bounds_.resize(n_tiles.total());
+  view_.pixels_ = pixels_.data();
+  view_.tile_bounds_ = tile_bounds_.data();
+  return HeResult::SUCCESS;
+}
+
+FilmTileBuffer::View FilmTileBuffer::view() {
+  return view_;
+}
+
+std::size_t FilmTileBuffer::memorySize() const {
+  return pixels_.size() * sizeof(FilmTilePixel) + tile_bounds_.size() * sizeof(bounds2i);
+}
+
+// heap sort of splats by pixel offset (in place, no recursion)
+static HERMES_DEVICE_CALLABLE void sortSplats(FilmSplat *splats, u32 n) {
+  auto sift_down = [splats](u32 root, u32 end) {
+    while (2 * root + 1 < end) {
+      u32 child = 2 * root + 1;
+      if (child + 1 < end && splats[child].pixel_offset < splats[child + 1].pixel_offset)
+        child++;
+      if (splats[root].pixel_offset >= splats[child].pixel_offset)
+        return;
+      FilmSplat tmp = splats[root];
+      splats[root] = splats[child];
+      splats[child] = tmp;
+      root = child;
+    }
+  };
+  for (u32 i = n / 2; i > 0; --i)
+    sift_down(i - 1, n);
+  for (u32 end = n; end > 1; --end) {
+    FilmSplat tmp = splats[0];
+    splats[0] = splats[end - 1];
+    splats[end - 1] = tmp;
+    sift_down(0, end - 1);
+  }
+}
+
+HERMES_DEVICE_CALLABLE bool FilmSplatBuffer::View::add(u32 segment, u32 pixel_offset, const real_t xyz[3]) {
+  if (counts_[segment] == segment_capacity_)
+    return false;
+  FilmSplat &splat = splats_[segment * segment_capacity_ + counts_[segment]++];
+  splat.pixel_offset = pixel_offset;
+  for (int i = 0; i < 3; ++i)
+    splat.xyz[i] = xyz[i];
+  return true;
+}
+
+HERMES_DEVICE_CALLABLE void FilmSplatBuffer::View::flush(u32 segment) {
+  FilmSplat *splats = splats_ + segment * segment_capacity_;
+  u32 n = counts_[segment];
+  if (!n)
+    return;
+  sortSplats(splats, n);
+  // combine entries of the same pixel
+  u32 unique_count = 0;
+  for (u32 i = 1; i < n; ++i) {
+    if (splats[i].pixel_offset == splats[unique_count].pixel_offset) {
+      for (int c = 0; c < 3; ++c)
+        splats[unique_count].xyz[c] += splats[i].xyz[c];
+    } else
+      splats[++unique_count] = splats[i];
+  }
+  counts_[segment] = unique_count + 1;
+}
+
+HeResult FilmSplatBuffer::resize(u32 segment_count, u32 segment_capacity) {
+  splats_.resize(segment_count * segment_capacity);
+  counts_.resize(segment_count);
+  view_.segment_count_ = segment_count;
+  view_.segment_capacity_ = segment_capacity;
+  view_.splats_ = splats_.data();
+  clear();
+  return HeResult::SUCCESS;
+}
+
+void FilmSplatBuffer::clear() {
+  if (!view_.segment_count_)
+    return;
+  counts_ = std::vector<u32>(view_.segment_count_, 0);
+  view_.counts_ = counts_.data();
+}
+
+FilmSplatBuffer::View FilmSplatBuffer::view() {
+  return view_;
+}
+
+std::size_t FilmSplatBuffer::memorySize() const {
+  return splats_.size() * sizeof(FilmSplat) + counts_.size() * sizeof(u32);
+}
+
+HERMES_DEVICE_CALLABLE real_t FilmPixel::relativeError() const {
+  if (sample_count < 2)
+    return Constants::real_infinity;
+  real_t n = sample_count;
+  real_t mean = luminance_sum / n;
+  real_t variance = max((real_t) 0, (luminance_sq_sum - luminance_sum * mean) / (n - 1));
+  // dark pixels are compared against a minimum luminance so they are not refined forever
+  return sqrtf(variance / n) / max(mean, (real_t) 0.01);
+}
+
+HERMES_DEVICE_CALLABLE CompactFilmPixel CompactFilmPixel::encode(const FilmPixel &pixel) {
+  CompactFilmPixel compact;
+  compact.filter_weight_sum = pixel.filter_weight_sum;
+  real_t inv_weight = pixel.filter_weight_sum != 0 ? (real_t) 1 / pixel.filter_weight_sum : (real_t) 1;
+  for (int i = 0; i < 3; ++i) {
+    compact.xyz[i] = globals::floatToHalf(pixel.xyz[i] * inv_weight);
+    compact.splat_XYZ[i] = globals::floatToHalf(pixel.splat_XYZ[i]);
+  }
+  return compact;
+}
+
+HERMES_DEVICE_CALLABLE FilmPixel CompactFilmPixel::decode() const {
+  FilmPixel pixel;
+  pixel.filter_weight_sum = filter_weight_sum;
+  real_t weight = filter_weight_sum != 0 ? filter_weight_sum : (real_t) 1;
+  for (int i = 0; i < 3; ++i) {
+    pixel.xyz[i] = globals::halfToFloat(xyz[i]) * weight;
+    pixel.splat_XYZ[i] = globals::halfToFloat(splat_XYZ[i]);
+  }
+  return pixel;
+}
+
+static_assert(sizeof(CompactFilmPixel) == 16, "CompactFilmPixel must be packed into 16 bytes");
+
+FilmImageView::FilmImageView(FilmPixel *pixels, CompactFilmPixel *compact_pixels, f32 *rgb, Film film,
+                             real_t scale, FilmSplatBuffer::View splats)
+    : film_{std::move(film)}, pixels_{pixels}, compact_pixels_{compact_pixels}, rgb_{rgb}, splats_{splats},
+      scale{scale} {
 }
 
 HERMES_DEVICE_FUNCTION void FilmImageView::mergeFilmTile(const FilmTile &tile) {
+  markDirty(tile.getPixelBounds());
+  // importance sampled tiles are disjoint, no other tile writes to these pixels
+  // (splats may still land on them, so splat_XYZ is never written here)
+  bool disjoint = film_.filter_mode == FilmFilterMode::IMPORTANCE;
   for (index2 pixel : tile.getPixelBounds()) {
+    if (!isResident(pixel))
+      continue;
     const FilmTilePixel &tilePixel = tile.getPixel(pixel);
     FilmPixel &mergePixel = getPixel(pixel);
     real_t xyz[3];
     tilePixel.contrib_sum.toXYZ(xyz);
+    if (disjoint) {
+      for (int i = 0; i < 3; ++i)
+        mergePixel.xyz[i] += xyz[i];
+      mergePixel.filter_weight_sum += tilePixel.filter_weight_sum;
+      mergePixel.luminance_sum += tilePixel.luminance_sum;
+      mergePixel.luminance_sq_sum += tilePixel.luminance_sq_sum;
+      mergePixel.sample_count += tilePixel.sample_count;
+      continue;
+    }
     for (int i = 0; i < 3; ++i)
       atomicAdd(&mergePixel.xyz[i], xyz[i]);
     atomicAdd(&mergePixel.filter_weight_sum, tilePixel.filter_weight_sum);
+    if (tilePixel.sample_count) {
+      atomicAdd(&mergePixel.luminance_sum, tilePixel.luminance_sum);
+      atomicAdd(&mergePixel.luminance_sq_sum, tilePixel.luminance_sq_sum);
+      atomicAdd(&mergePixel.sample_count, tilePixel.sample_count);
+    }
   }
 }
 
-HERMES_DEVICE_CALLABLE FilmPixel &FilmImageView::getPixel(const index2 &p) {
-  int width = film_.cropped_pixel_bounds.upper().i - film_.cropped_pixel_bounds.lower().i;
-  int offset = (p.i - film_.cropped_pixel_bounds.lower().i) + (p.j - film_.cropped_pixel_bounds.lower().j) * width;
-  return pixels_[offset];
+HERMES_DEVICE_CALLABLE void FilmImageView::mergeFilmTiles(const index2 &p, const FilmTileBuffer::View &tiles) {
+  if (!isResident(p))
+    return;
+  // contributions are converted to XYZ once per pixel, after all tiles were summed up
+  addTilePixel(p, tiles.accumulate(p));
+  markDirty(p);
 }
 
-HERMES_DEVICE_CALLABLE f32 *FilmImageView::rgb(const index2 &p) {
-  int width = film_.cropped_pixel_bounds.upper().i - film_.cropped_pixel_bounds.lower().i;
-  int offset = (p.i - film_.cropped_pixel_bounds.lower().i) + (p.j - film_.cropped_pixel_bounds.lower().j) * width;
-  return &rgb_[offset * 3];
+HERMES_DEVICE_CALLABLE void FilmImageView::addTilePixel(const index2 &p, const FilmTilePixel &tile_pixel) {
+  FilmPixel merge_pixel = pixel(p);
+  real_t xyz[3];
+  tile_pixel.contrib_sum.toXYZ(xyz);
+  for (int i = 0; i < 3; ++i)
+    merge_pixel.xyz[i] += xyz[i];
+  merge_pixel.filter_weight_sum += tile_pixel.filter_weight_sum;
+  merge_pixel.luminance_sum += tile_pixel.luminance_sum;
+  merge_pixel.luminance_sq_sum += tile_pixel.luminance_sq_sum;
+  merge_pixel.sample_count += tile_pixel.sample_count;
+  setPixel(p, merge_pixel);
 }
 
-HERMES_DEVICE_FUNCTION Film &FilmImageView::film() {
-  return film_;
+HERMES_DEVICE_FUNCTION void FilmImageView::addSplatXYZ(u32 offset, const real_t xyz[3]) {
+  int width = film_.cropped_pixel_bounds.upper().i - film_.cropped_pixel_bounds.lower().i;
+  markDirty(index2(film_.cropped_pixel_bounds.lower().i + offset % width, imageRow(offset / width)));
+  // half precision sums would stall, compact pixels keep single precision sums until mergeSplats
+  real_t *sum = compact_pixels_ ? splat_sums_ + 3 * offset : pixels_[offset].splat_XYZ;
+  for (int i = 0; i < 3; ++i)
+    atomicAdd(&sum[i], xyz[i]);
 }
 
-FilmImage::FilmImage(const Film &film, real_t scale) : film_{film}, scale_{scale} {
-  // allocate film image storage
-  pixels_.resize(film.cropped_pixel_bounds.area());
-  rgb_.resize(3 * film.cropped_pixel_bounds.area());
+HERMES_DEVICE_FUNCTION void FilmImageView::addSplat(const point2 &p, const SpectrumOld &v) {
+  index2 pi = floor(p);
+  if (!film_.cropped_pixel_bounds.contains(pi) || !isResident(pi))
+    return;
+  real_t xyz[3];
+  v.toXYZ(xyz);
+  addSplatXYZ(pixelOffset(pi), xyz);
 }
 
-FilmImageView FilmImage::view() {
-  return FilmImageView(pixels_.data(), rgb_.data(), film_, scale_);
+HERMES_DEVICE_FUNCTION void FilmImageView::addSplat(u32 thread_index, const point2 &p, const SpectrumOld &v) {
+  index2 pi = floor(p);
+  if (!film_.cropped_pixel_bounds.contains(pi) || !isResident(pi))
+    return;
+  real_t xyz[3];
+  v.toXYZ(xyz);
+  u32 offset = pixelOffset(pi);
+  if (!splats_ || thread_index >= splats_.segmentCount()) {
+    addSplatXYZ(offset, xyz);
+    return;
+  }
+  if (splats_.add(thread_index, offset, xyz))
+    return;
+  // full segment: its combined entries go straight into the image and the segment starts over
+  splats_.drain(thread_index, [this](u32 pixel_offset, const real_t sum[3]) { addSplatXYZ(pixel_offset, sum); });
+  if (!splats_.add(thread_index, offset, xyz))
+    addSplatXYZ(offset, xyz);
 }
 
-const Film &FilmImage::film() const {
-  return film_;
+HERMES_DEVICE_CALLABLE void FilmImageView::mergeSplats(int row) {
+  int width = film_.cropped_pixel_bounds.upper().i - film_.cropped_pixel_bounds.lower().i;
+  auto *pixels = pixels_;
+  auto *splat_sums = splat_sums_;
+  bool touched = false;
+  if (splats_)
+    splats_.reduce(row * width, (row + 1) * width, [=, &touched](u32 offset, const real_t xyz[3]) {
+      touched = true;
+      real_t *sum = splat_sums ? splat_sums + 3 * offset : pixels[offset].splat_XYZ;
+      for (int i = 0; i < 3; ++i)
+        sum[i] += xyz[i];
+    });
+  // compact pixels are packed once, after all splats of the row were summed up
+  if (compact_pixels_)
+    for (int offset = row * width; offset < (row + 1) * width; ++offset) {
+      real_t *sum = splat_sums_ + 3 * offset;
+      if (sum[0] == 0 && sum[1] == 0 && sum[2] == 0)
+        continue;
+      FilmPixel pixel = compact_pixels_[offset].decode();
+      for (int i = 0; i < 3; ++i) {
+        pixel.splat_XYZ[i] += sum[i];
+        sum[i] = 0;
+      }
+      compact_pixels_[offset] = CompactFilmPixel::encode(pixel);
+    }
+  if (touched) {
+    int j = imageRow(row);
+    markDirty(bounds2i(index2(film_.cropped_pixel_bounds.lower().i, j),
+                       index2(film_.cropped_pixel_bounds.upper().i, j + 1)));
+  }
 }
 
-HERMES_CUDA_KERNEL(film2rgb)(FilmImageView film_image, real_t splat_scale = 1) {
-  bounds2i bounds = film_image.film().cropped_pixel_bounds;
-  HERMES_CUDA_THREAD_INDEX_IJ_LT(bounds.upper() - bounds.lower())
-  auto p = ij + bounds.lower();
-  // Pointer to RGB value
-  real_t *rgb = film_image.rgb(p);
+HERMES_DEVICE_CALLABLE void FilmImageView::resolve(const index2 &p, real_t rgb[3], real_t splat_scale) const {
   // Convert pixel XYZ color to RGB
-  FilmPixel &pixel = film_image.getPixel(p);
+  FilmPixel pixel = this->pixel(p);
   XYZToRGB(pixel.xyz, rgb);
   // Normalize pixel with weight sum
   real_t filterWeightSum = pixel.filter_weight_sum;
@@ -181,40 +484,467 @@ HERMES_CUDA_KERNEL(film2rgb)(FilmImageView film_image, real_t splat_scale = 1) {
   rgb[2] += splat_scale * splatRGB[2];
 
   // Scale pixel value by _scale_
-  rgb[0] *= film_image.scale;
-  rgb[1] *= film_image.scale;
-  rgb[2] *= film_image.scale;
+  rgb[0] *= scale;
+  rgb[1] *= scale;
+  rgb[2] *= scale;
+}
+
+HERMES_DEVICE_CALLABLE void FilmImageView::markDirty(const index2 &p) {
+  if (!dirty_)
+    return;
+  auto lower = film_.cropped_pixel_bounds.lower();
+  int blocks_per_row = (film_.cropped_pixel_bounds.upper().i - lower.i + dirty_block_size - 1) / dirty_block_size;
+  // concurrent writers store the same value, no atomics needed
+  dirty_[(p.i - lower.i) / dirty_block_size + ((p.j - lower.j) / dirty_block_size) * blocks_per_row] = 1;
+}
+
+HERMES_DEVICE_CALLABLE void FilmImageView::markDirty(const bounds2i &bounds) {
+  auto lower = film_.cropped_pixel_bounds.lower();
+  auto upper = film_.cropped_pixel_bounds.upper();
+  int i_begin = max(bounds.lower().i, lower.i), i_end = min(bounds.upper().i, upper.i);
+  int j_begin = max(bounds.lower().j, lower.j), j_end = min(bounds.upper().j, upper.j);
+  if (i_begin >= i_end || j_begin >= j_end)
+    return;
+  // one pixel per block is enough
+  int i_last = (i_end - 1 - lower.i) / dirty_block_size;
+  int j_last = (j_end - 1 - lower.j) / dirty_block_size;
+  for (int bj = (j_begin - lower.j) / dirty_block_size; bj <= j_last; ++bj)
+    for (int bi = (i_begin - lower.i) / dirty_block_size; bi <= i_last; ++bi)
+      markDirty(index2(lower.i + bi * dirty_block_size, lower.j + bj * dirty_block_size));
+}
+
+HERMES_DEVICE_CALLABLE u32 FilmImageView::dirtyBlockCount(const bounds2i &image_bounds) {
+  auto extent = image_bounds.upper() - image_bounds.lower();
+  return ((extent.i + dirty_block_size - 1) / dirty_block_size) *
+      ((extent.j + dirty_block_size - 1) / dirty_block_size);
+}
+
+HERMES_DEVICE_CALLABLE bounds2i FilmImageView::dirtyBlockBounds(const bounds2i &image_bounds, u32 block) {
+  auto lower = image_bounds.lower();
+  auto upper = image_bounds.upper();
+  int blocks_per_row = (upper.i - lower.i + dirty_block_size - 1) / dirty_block_size;
+  index2 block_lower(lower.i + (block % blocks_per_row) * dirty_block_size,
+                     lower.j + (block / blocks_per_row) * dirty_block_size);
+  return {block_lower, index2(min(block_lower.i + dirty_block_size, upper.i),
+                              min(block_lower.j + dirty_block_size, upper.j))};
+}
+
+HERMES_DEVICE_CALLABLE bounds2i FilmImageView::residentBlockBounds(u32 block) const {
+  auto region = dirtyBlockBounds(film_.cropped_pixel_bounds, block);
+  if (!resident_row_count_)
+    return region;
+  int j_begin = max(region.lower().j, resident_row_begin_);
+  int j_end = max(j_begin, min(region.upper().j, resident_row_begin_ + resident_row_count_));
+  return {index2(region.lower().i, j_begin), index2(region.upper().i, j_end)};
+}
+
+HERMES_DEVICE_CALLABLE int FilmImageView::pixelOffset(const index2 &p) const {
+  int width = film_.cropped_pixel_bounds.upper().i - film_.cropped_pixel_bounds.lower().i;
+  int row = p.j - film_.cropped_pixel_bounds.lower().j;
+  // streamed films keep their rows in a ring buffer
+  if (resident_row_count_)
+    row %= resident_row_count_;
+  return (p.i - film_.cropped_pixel_bounds.lower().i) + row * width;
+}
+
+HERMES_DEVICE_CALLABLE int FilmImageView::imageRow(int ring_row) const {
+  int lower = film_.cropped_pixel_bounds.lower().j;
+  if (!resident_row_count_)
+    return lower + ring_row;
+  int first_ring_row = (resident_row_begin_ - lower) % resident_row_count_;
+  return resident_row_begin_ + (ring_row - first_ring_row + resident_row_count_) % resident_row_count_;
+}
+
+HERMES_DEVICE_CALLABLE bool FilmImageView::isResident(const index2 &p) const {
+  return !resident_row_count_ || (p.j >= resident_row_begin_ && p.j < resident_row_begin_ + resident_row_count_);
+}
+
+HERMES_DEVICE_CALLABLE FilmPixel &FilmImageView::getPixel(const index2 &p) {
+  return pixels_[pixelOffset(p)];
+}
+
+HERMES_DEVICE_CALLABLE FilmPixel FilmImageView::pixel(const index2 &p) const {
+  if (compact_pixels_)
+    return compact_pixels_[pixelOffset(p)].decode();
+  return pixels_[pixelOffset(p)];
+}
+
+HERMES_DEVICE_CALLABLE void FilmImageView::setPixel(const index2 &p, const FilmPixel &pixel) {
+  if (compact_pixels_)
+    compact_pixels_[pixelOffset(p)] = CompactFilmPixel::encode(pixel);
+  else
+    pixels_[pixelOffset(p)] = pixel;
+}
+
+HERMES_DEVICE_CALLABLE f32 *FilmImageView::rgb(const index2 &p) {
+  return &rgb_[pixelOffset(p) * 3];
+}
+
+HERMES_DEVICE_FUNCTION Film &FilmImageView::film() {
+  return film_;
+}
+
+FilmImage::FilmImage(const Film &film, real_t scale, FilmStorageMode storage_mode)
+    : film_{film}, storage_mode_{storage_mode}, scale_{scale} {
+  resizeStorage(film.cropped_pixel_bounds.area());
+  dirty_ = std::vector<u8>(FilmImageView::dirtyBlockCount(film.cropped_pixel_bounds), 0);
+}
+
+void FilmImage::resizeStorage(size_t pixel_count) {
+  // allocate film image storage (compact images produce rgb values on demand)
+  if (storage_mode_ == FilmStorageMode::COMPACT) {
+    compact_pixels_ = std::vector<CompactFilmPixel>(pixel_count);
+    splat_sums_ = std::vector<real_t>(3 * pixel_count, 0);
+  } else {
+    pixels_ = std::vector<FilmPixel>(pixel_count);
+    rgb_.resize(3 * pixel_count);
+  }
+}
+
+FilmImageView FilmImage::view() {
+  return view(rgb_.data());
+}
+
+FilmImageView FilmImage::view(real_t *rgb) {
+  FilmImageView view(pixels_.data(), compact_pixels_.data(), rgb, film_, scale_, splats_.view());
+  view.resident_row_begin_ = resident_row_begin_;
+  view.resident_row_count_ = resident_row_count_;
+  view.splat_sums_ = splat_sums_.data();
+  view.dirty_ = dirty_.data();
+  return view;
+}
+
+const Film &FilmImage::film() const {
+  return film_;
+}
+
+FilmStorageMode FilmImage::storageMode() const {
+  return storage_mode_;
+}
+
+std::size_t FilmImage::memorySize() const {
+  return pixels_.size() * sizeof(FilmPixel) + compact_pixels_.size() * sizeof(CompactFilmPixel)
+      + rgb_.size() * sizeof(real_t) + splat_sums_.size() * sizeof(real_t) + splats_.memorySize()
+      + dirty_.size() * sizeof(u8);
+}
+
+HERMES_CUDA_KERNEL(film2rgb)(FilmImageView film_image, bounds2i bounds, real_t splat_scale = 1) {
+  HERMES_CUDA_THREAD_INDEX_IJ_LT(bounds.upper() - bounds.lower())
+  auto p = ij + bounds.lower();
+  film_image.resolve(p, film_image.rgb(p), splat_scale);
+}
+
+HERMES_CUDA_KERNEL(mergeFilmTiles)(FilmImageView film_image, FilmTileBuffer::View tiles) {
+  bounds2i bounds = tiles.pixelBounds();
+  HERMES_CUDA_THREAD_INDEX_IJ_LT(bounds.upper() - bounds.lower())
+  film_image.mergeFilmTiles(ij + bounds.lower(), tiles);
+}
+
+void FilmImage::mergeFilmTiles(FilmTileBuffer &tiles) {
+  auto bounds = tiles.view().pixelBounds();
+  auto extent = bounds.upper() - bounds.lower();
+  if (extent.i <= 0 || extent.j <= 0)
+    return;
+  HERMES_CUDA_LAUNCH_AND_SYNC((size2(extent.i, extent.j)), mergeFilmTiles_k, view(), tiles.view())
+}
+
+HeResult FilmImage::setImage(const Array<SpectrumOld> &img) {
+  if (img.size() != film_.cropped_pixel_bounds.area())
+    return HeResult::INVALID_INPUT;
+  Array<FilmPixel> pixels(img.size());
+  for (size_t i = 0; i < img.size(); ++i) {
+    img[i].toXYZ(pixels[i].xyz);
+    pixels[i].filter_weight_sum = 1;
+  }
+  if (storage_mode_ == FilmStorageMode::COMPACT) {
+    Array<CompactFilmPixel> compact_pixels(img.size());
+    for (size_t i = 0; i < img.size(); ++i)
+      compact_pixels[i] = CompactFilmPixel::encode(pixels[i]);
+    compact_pixels_ = compact_pixels;
+  } else
+    pixels_ = pixels;
+  dirty_ = std::vector<u8>(dirty_.size(), 1);
+  return HeResult::SUCCESS;
+}
+
+HeResult FilmImage::prepareSplats(u32 thread_count, u32 segment_capacity) {
+  return splats_.resize(thread_count, segment_capacity);
+}
+
+HERMES_CUDA_KERNEL(flushSplats)(FilmSplatBuffer::View splats) {
+  HERMES_CUDA_THREAD_INDEX_I
+  if (i >= splats.segmentCount())
+    return;
+  splats.flush(i);
+}
+
+HERMES_CUDA_KERNEL(mergeSplats)(FilmImageView film_image, int row_count) {
+  HERMES_CUDA_THREAD_INDEX_I
+  if (i >= row_count)
+    return;
+  film_image.mergeSplats(i);
+}
+
+void FilmImage::mergeSplats() {
+  auto splats = splats_.view();
+  if (!splats && storage_mode_ != FilmStorageMode::COMPACT)
+    return;
+  int row_count = resident_row_count_ ? resident_row_count_
+                                      : film_.cropped_pixel_bounds.upper().j - film_.cropped_pixel_bounds.lower().j;
+  if (splats) {
+    HERMES_CUDA_LAUNCH_AND_SYNC((splats.segmentCount()), flushSplats_k, splats)
+  }
+  HERMES_CUDA_LAUNCH_AND_SYNC((row_count), mergeSplats_k, view(), row_count)
+  splats_.clear();
 }
 
 Array<real_t> FilmImage::imagePixels() {
+  // resident rows of streamed films may still receive contributions
+  if (resident_row_count_)
+    return readRows(film_.cropped_pixel_bounds.lower().j, resident_row_begin_);
+  mergeSplats();
+  // compact images do not keep a resident rgb buffer
+  DeviceArray<real_t> transient_rgb;
+  if (storage_mode_ == FilmStorageMode::COMPACT)
+    transient_rgb.resize(3 * film_.cropped_pixel_bounds.area());
+  auto &rgb = storage_mode_ == FilmStorageMode::COMPACT ? transient_rgb : rgb_;
+  auto bounds = film_.cropped_pixel_bounds;
+  auto extent = bounds.upper() - bounds.lower();
   f32 elapsed_time = 0;
   HERMES_CUDA_TIME(
-      HERMES_CUDA_LAUNCH_AND_SYNC((pixels_.size()),
+      HERMES_CUDA_LAUNCH_AND_SYNC((size2(extent.i, extent.j)),
                                   film2rgb_k,
-                                  view()),
+                                  view(rgb.data()),
+                                  bounds),
       elapsed_time)
   HERMES_LOG_VARIABLE(elapsed_time)
-  return rgb_;
-}
-
-//void FilmImageView::setImage(const SpectrumOld *img) const {
-//  int nPixels = film_.cropped_pixel_bounds.area();
-//  for (int i = 0; i < nPixels; ++i) {
-//    Pixel &p = pixels_[i];
-//    img[i].toXYZ(p.xyz);
-//    p.filter_weight_sum = 1;
-//    p.splat_XYZ[0] = p.splat_XYZ[1] = p.splat_XYZ[2] = 0;
-//  }
-//}
-
-//void FilmImageView::addSplat(const point2 &p, const SpectrumOld &v) {
-//  if (!film_.cropped_pixel_bounds.contains(p))
-//    return;
-//  real_t xyz[3];
-//  v.toXYZ(xyz);
-//  Pixel &pixel = getPixel(p);
-//  for (int i = 0; i < 3; ++i)
-//    pixel.splat_XYZ[i] += xyz[i]; // TODO ATOMIC!
-//}
-
-} // namespace helios
\ No newline at end of file
+  return rgb;
+}
+
+HeResult FilmImage::save(const Path &filename, int band_height, const io::ExrOptions &exr_options) {
+  const auto &bounds = film_.cropped_pixel_bounds;
+  bool written;
+  if (!resident_row_count_)
+    written = io::save(imagePixels(), filename, bounds, film_.full_resolution, exr_options);
+  else {
+    // rows still resident may receive contributions
+    if (resident_row_begin_ < bounds.upper().j)
+      return HeResult::INVALID_INPUT;
+    written = io::saveRows([&](int row_begin, int row_end) { return readRows(row_begin, row_end); },
+                           filename, bounds, film_.full_resolution, band_height, exr_options);
+  }
+  return written ? HeResult::SUCCESS : HeResult::INVALID_INPUT;
+}
+
+HERMES_CUDA_KERNEL(resolveRegions)(FilmImageView film_image, const u32 *blocks, u32 block_count, real_t *rgb) {
+  HERMES_CUDA_THREAD_INDEX_I
+  constexpr u32 block_area = FilmImageView::dirty_block_size * FilmImageView::dirty_block_size;
+  if (i >= block_count * block_area)
+    return;
+  u32 k = i / block_area;
+  auto region = film_image.residentBlockBounds(blocks[k]);
+  auto lower = region.lower();
+  int width = region.upper().i - lower.i;
+  int local = i % block_area;
+  index2 p(lower.i + local % FilmImageView::dirty_block_size, lower.j + local / FilmImageView::dirty_block_size);
+  if (!region.contains(p))
+    return;
+  // regions are stored tightly packed, one block_area slot per block
+  film_image.resolve(p, rgb + 3 * (k * block_area + (p.i - lower.i) + (p.j - lower.j) * width));
+}
+
+HERMES_CUDA_KERNEL(clearDirtyBlocks)(u8 *dirty, const u32 *blocks, u32 block_count) {
+  HERMES_CUDA_THREAD_INDEX_I
+  if (i < block_count)
+    dirty[blocks[i]] = 0;
+}
+
+size_t FilmImage::resolveDirtyRegions(const RegionCallback &callback) {
+  mergeSplats();
+  Array<u8> flags = dirty_;
+  auto film_view = view();
+  std::vector<u32> blocks;
+  std::vector<bounds2i> regions;
+  for (size_t b = 0; b < flags.size(); ++b) {
+    if (!flags[b])
+      continue;
+    // streamed films report the resident part of blocks crossing the band limits
+    auto region = film_view.residentBlockBounds(b);
+    if (!region.area())
+      continue;
+    blocks.emplace_back(b);
+    regions.emplace_back(region);
+  }
+  if (blocks.empty())
+    return 0;
+  constexpr u32 block_area = FilmImageView::dirty_block_size * FilmImageView::dirty_block_size;
+  DeviceArray<u32> d_blocks = blocks;
+  DeviceArray<real_t> d_rgb;
+  d_rgb.resize(3 * block_area * blocks.size());
+  // flags are cleared on the device before pixels are read, so blocks dirtied meanwhile are reported next time
+  HERMES_CUDA_LAUNCH_AND_SYNC((blocks.size()), clearDirtyBlocks_k, dirty_.data(), d_blocks.data(), blocks.size())
+  HERMES_CUDA_LAUNCH_AND_SYNC((blocks.size() * block_area), resolveRegions_k, view(), d_blocks.data(),
+                              blocks.size(), d_rgb.data())
+  Array<real_t> rgb = d_rgb;
+  for (size_t k = 0; k < blocks.size(); ++k)
+    callback(regions[k], rgb.data() + 3 * block_area * k);
+  return blocks.size();
+}
+
+size_t FilmImage::dirtyBlockCount() const {
+  Array<u8> flags = dirty_;
+  size_t count = 0;
+  for (size_t b = 0; b < flags.size(); ++b)
+    count += flags[b] != 0;
+  return count;
+}
+
+HERMES_CUDA_KERNEL(refinementMask)(FilmImageView film_image, bounds2i bounds, real_t error_threshold, u8 *mask) {
+  HERMES_CUDA_THREAD_INDEX_IJ_LT(bounds.upper() - bounds.lower())
+  auto p = ij + bounds.lower();
+  bool refine = film_image.film().cropped_pixel_bounds.contains(p) && film_image.isResident(p)
+      && film_image.pixel(p).relativeError() > error_threshold;
+  mask[ij.j * (bounds.upper().i - bounds.lower().i) + ij.i] = refine;
+}
+
+size_t FilmImage::refinementMask(const bounds2i &bounds, real_t error_threshold, DeviceArray<u8> &mask) {
+  auto extent = bounds.upper() - bounds.lower();
+  if (extent.i <= 0 || extent.j <= 0)
+    return 0;
+  mask.resize(extent.i * extent.j);
+  HERMES_CUDA_LAUNCH_AND_SYNC((size2(extent.i, extent.j)), refinementMask_k, view(), bounds, error_threshold,
+                              mask.data())
+  Array<u8> flags = mask;
+  size_t count = 0;
+  for (size_t i = 0; i < flags.size(); ++i)
+    count += flags[i] != 0;
+  return count;
+}
+
+u64 FilmImage::sampleCount() const {
+  Array<FilmPixel> pixels = pixels_;
+  u64 count = 0;
+  for (size_t i = 0; i < pixels.size(); ++i)
+    count += pixels[i].sample_count;
+  return count;
+}
+
+HERMES_CUDA_KERNEL(findContributions)(FilmImageView film_image, bounds2i bounds, u32 *found) {
+  HERMES_CUDA_THREAD_INDEX_IJ_LT(bounds.upper() - bounds.lower())
+  auto pixel = film_image.pixel(ij + bounds.lower());
+  bool empty = pixel.filter_weight_sum == 0 && pixel.sample_count == 0;
+  for (int i = 0; i < 3; ++i)
+    empty = empty && pixel.xyz[i] == 0 && pixel.splat_XYZ[i] == 0;
+  // concurrent writers store the same value
+  if (!empty)
+    *found = 1;
+}
+
+bool FilmImage::hasContributions() {
+  mergeSplats();
+  const auto &image_bounds = film_.cropped_pixel_bounds;
+  int row_end = resident_row_count_ ? std::min(resident_row_begin_ + resident_row_count_, image_bounds.upper().j)
+                                    : image_bounds.upper().j;
+  bounds2i bounds(index2(image_bounds.lower().i, firstResidentRow()), index2(image_bounds.upper().i, row_end));
+  auto extent = bounds.upper() - bounds.lower();
+  if (extent.i <= 0 || extent.j <= 0)
+    return false;
+  DeviceArray<u32> d_found = std::vector<u32>(1, 0);
+  HERMES_CUDA_LAUNCH_AND_SYNC((size2(extent.i, extent.j)), findContributions_k, view(), bounds, d_found.data())
+  Array<u32> found = d_found;
+  return found[0] != 0;
+}
+
+HERMES_CUDA_KERNEL(clearPixels)(FilmImageView film_image, bounds2i bounds) {
+  HERMES_CUDA_THREAD_INDEX_IJ_LT(bounds.upper() - bounds.lower())
+  film_image.setPixel(ij + bounds.lower(), FilmPixel());
+}
+
+HeResult FilmImage::streamTo(const Path &path, int resident_row_count) {
+  // contributions to rows outside the band would be dropped
+  if (resident_row_count <= 0 || resident_row_count < film_.footprintRowCount(1))
+    return HeResult::INVALID_INPUT;
+  // samples already in the film (or rows already written by a previous stream) would be lost
+  if (firstResidentRow() != film_.cropped_pixel_bounds.lower().j || hasContributions())
+    return HeResult::INVALID_INPUT;
+  // start an empty stream file
+  std::ofstream file(path.fullName(), std::ios::binary | std::ios::trunc);
+  if (!file.good())
+    return HeResult::INVALID_INPUT;
+  stream_path_ = path;
+  resident_row_begin_ = film_.cropped_pixel_bounds.lower().j;
+  resident_row_count_ = resident_row_count;
+  int width = film_.cropped_pixel_bounds.upper().i - film_.cropped_pixel_bounds.lower().i;
+  resizeStorage(width * resident_row_count_);
+  return HeResult::SUCCESS;
+}
+
+HeResult FilmImage::finishRows(int row_end) {
+  if (!resident_row_count_)
+    return HeResult::SUCCESS;
+  row_end = std::min(row_end, film_.cropped_pixel_bounds.upper().j);
+  if (row_end <= resident_row_begin_)
+    return HeResult::SUCCESS;
+  mergeSplats();
+  auto lower = film_.cropped_pixel_bounds.lower();
+  int width = film_.cropped_pixel_bounds.upper().i - lower.i;
+  // transient rgb storage (ring layout) for compact images
+  DeviceArray<real_t> transient_rgb;
+  if (storage_mode_ == FilmStorageMode::COMPACT)
+    transient_rgb.resize(3 * width * resident_row_count_);
+  auto &rgb = storage_mode_ == FilmStorageMode::COMPACT ? transient_rgb : rgb_;
+  std::ofstream file(stream_path_.fullName(), std::ios::binary | std::ios::app);
+  if (!file.good())
+    return HeResult::INVALID_INPUT;
+  // rows are resolved and released in chunks that do not wrap around the ring buffer
+  while (resident_row_begin_ < row_end) {
+    int ring_row = (resident_row_begin_ - lower.j) % resident_row_count_;
+    int row_count = std::min(row_end - resident_row_begin_, resident_row_count_ - ring_row);
+    bounds2i rows(index2(lower.i, resident_row_begin_), index2(lower.i + width, resident_row_begin_ + row_count));
+    HERMES_CUDA_LAUNCH_AND_SYNC((size2(width, row_count)), film2rgb_k, view(rgb.data()), rows)
+    Array<real_t> host_rgb = rgb;
+    file.write(reinterpret_cast<const char *>(host_rgb.data() + 3 * width * ring_row),
+               sizeof(real_t) * 3 * width * row_count);
+    HERMES_CUDA_LAUNCH_AND_SYNC((size2(width, row_count)), clearPixels_k, view(rgb.data()), rows)
+    resident_row_begin_ += row_count;
+  }
+  // blocks left without resident rows can not be resolved anymore (their rows are in the file)
+  std::vector<u32> finished_blocks;
+  for (u32 b = 0; b < dirty_.size(); ++b)
+    if (FilmImageView::dirtyBlockBounds(film_.cropped_pixel_bounds, b).upper().j <= resident_row_begin_)
+      finished_blocks.emplace_back(b);
+  if (!finished_blocks.empty()) {
+    DeviceArray<u32> d_blocks = finished_blocks;
+    HERMES_CUDA_LAUNCH_AND_SYNC((finished_blocks.size()), clearDirtyBlocks_k, dirty_.data(), d_blocks.data(),
+                                finished_blocks.size())
+  }
+  return file.good() ? HeResult::SUCCESS : HeResult::INVALID_INPUT;
+}
+
+bool FilmImage::isStreamed() const {
+  return resident_row_count_ != 0;
+}
+
+int FilmImage::firstResidentRow() const {
+  return resident_row_count_ ? resident_row_begin_ : film_.cropped_pixel_bounds.lower().j;
+}
+
+int FilmImage::residentRowCount() const {
+  return resident_row_count_;
+}
+
+Array<real_t> FilmImage::readRows(int row_begin, int row_end) const {
+  auto lower = film_.cropped_pixel_bounds.lower();
+  int width = film_.cropped_pixel_bounds.upper().i - lower.i;
+  row_begin = std::max(row_begin, lower.j);
+  row_end = std::min(row_end, resident_row_count_ ? resident_row_begin_ : lower.j);
+  if (row_end <= row_begin)
+    return {};
+  Array<real_t> rgb(3 * width * (row_end - row_begin));
+  std::ifstream file(stream_path_.fullName(), std::ios::binary);
+  file.seekg(sizeof(real_t) * 3 * width * (row_begin - lower.j));
+  file.read(reinterpret_cast<char *>(rgb.data()), sizeof(real_t) * rgb.size());
+  return rgb;
+}
+
+} // namespace helios
@@ -2,10 +2,13 @@
 #define HELIOS_CORE_FILM_H
 
 #include <helios/core/filter.h>
+#include <helios/common/io.h>
 #include <helios/base/spectrum.h>
 #include <helios/geometry/bounds.h>
 #include <hermes/common/index.h>
 #include <hermes/storage/array.h>
+#include <hermes/common/file_system.h>
+#include <functional>
 #include <memory>
 
 namespace helios {
@@ -14,14 +17,52 @@ namespace helios {
 struct FilmTilePixel {
   SpectrumOld contrib_sum = 0.f;       //!< sum of weighted contributions from pixel samples
   real_t filter_weight_sum = 0.f;   //!< sum of filter weights
+  real_t luminance_sum = 0.f;       //!< sum of luminance of samples taken inside the pixel
+  real_t luminance_sq_sum = 0.f;    //!< sum of squared luminance of samples taken inside the pixel
+  u32 sample_count = 0;             //!< number of samples taken inside the pixel
 };
 
 /// Pixel structure stored in film image
 struct FilmPixel {
   real_t xyz[3] = {0, 0, 0};                  //!< color in XYZ color space
   real_t filter_weight_sum = 0;               //!< sum of filter weights of radiance samples
-  real_t splat_XYZ[3]{};                      //!< unweighted sum of samples splats TODO atomic!
-  real_t pad{};                               //!< to ensure byte alignment
+  real_t splat_XYZ[3]{};                      //!< unweighted sum of samples splats
+  real_t luminance_sum{};                     //!< sum of luminance of samples taken inside the pixel
+  real_t luminance_sq_sum{};                  //!< sum of squared luminance of samples taken inside the pixel
+  u32 sample_count{};                         //!< number of samples taken inside the pixel
+  real_t pad[2]{};                            //!< to ensure byte alignment
+  /// Estimates the relative error of the pixel's mean luminance from its sample variance
+  /// \return standard error over mean luminance (infinity if less than 2 samples were taken)
+  [[nodiscard]] HERMES_DEVICE_CALLABLE real_t relativeError() const;
+};
+
+/// Storage used by the film image for its pixels
+enum class FilmStorageMode {
+  FULL,     //!< FilmPixel (single precision) pixels and a resident rgb buffer
+  COMPACT   //!< CompactFilmPixel (half precision) pixels, rgb values are produced on demand
+            //!< (splats are summed in single precision and packed by FilmImage::mergeSplats)
+};
+
+/// Packed pixel structure stored in film image (FilmStorageMode::COMPACT)
+/// \note Colors are stored in half precision as the filter weighted average, so stored values
+/// \note stay in the same range regardless of the number of samples. The weight sum keeps
+/// \note full precision. Tiles still accumulate in full precision, pixels are only packed on merge.
+struct alignas(8) CompactFilmPixel {
+  /// \param pixel
+  /// \return CompactFilmPixel packed pixel
+  HERMES_DEVICE_CALLABLE static CompactFilmPixel encode(const FilmPixel &pixel);
+  /// \return FilmPixel unpacked pixel
+  [[nodiscard]] HERMES_DEVICE_CALLABLE FilmPixel decode() const;
+
+  real_t filter_weight_sum = 0;               //!< sum of filter weights of radiance samples
+  u16 xyz[3]{};                               //!< fp16 XYZ color (divided by filter_weight_sum if not zero)
+  u16 splat_XYZ[3]{};                         //!< fp16 unweighted sum of samples splats
+};
+
+/// How samples are reconstructed into pixels
+enum class FilmFilterMode {
+  SPLAT,      //!< each sample is weighted by the filter and added to all pixels under its footprint
+  IMPORTANCE  //!< film positions are drawn from the filter distribution and each sample reaches a single pixel
 };
 
 // *********************************************************************************************************************
@@ -32,16 +73,28 @@ struct FilmPixel {
 /// \note producing racing conditions
 class FilmTile {
 public:
-  typedef PreComputedFilter<16> PCF;
+  typedef PreComputedFilter<Filter::max_table_width> PCF;
   /// \param pixel_bounds the bounds of the pixels_ in the final image
   /// \param filter reconstruction filter precomputed table
-  HERMES_DEVICE_CALLABLE FilmTile(const bounds2i &pixel_bounds, const PreComputedFilter<16> *filter);
+  HERMES_DEVICE_CALLABLE FilmTile(const bounds2i &pixel_bounds, const PCF *filter);
+  /// \param pixel_bounds the bounds of the pixels_ in the final image
+  /// \param filter reconstruction filter precomputed table
+  /// \param pixels **[in]** external storage for pixel_bounds.area() pixels (not owned by the tile)
+  HERMES_DEVICE_CALLABLE FilmTile(const bounds2i &pixel_bounds, const PCF *filter,
+                                  FilmTilePixel *pixels);
   HERMES_DEVICE_CALLABLE ~FilmTile();
   /// Updates the stored image using the reconstruction filter with the pixel filtering equation
   /// \param p sample position
   /// \param L sample's radiance
   /// \param sample_weight sample's filter weight
   HERMES_DEVICE_CALLABLE void addSample(const hermes::point2 &p, const SpectrumOld &L, real_t sample_weight = 1.);
+  /// Adds a sample to a single pixel (FilmFilterMode::IMPORTANCE)
+  /// \param p pixel coordinates with respect to overall image
+  /// \param L sample's radiance
+  /// \param filter_weight weight of the filter sample (see PreComputedFilter::sample)
+  /// \param sample_weight sample's weight
+  HERMES_DEVICE_CALLABLE void addPixelSample(const hermes::index2 &p, const SpectrumOld &L, real_t filter_weight,
+                                             real_t sample_weight = 1.);
   /// \param p pixel coordinates with respect to overall image
   /// \return FilmTilePixel& reference to pixel inside tile
   HERMES_DEVICE_CALLABLE FilmTilePixel &getPixel(const hermes::index2 &p);
@@ -53,8 +106,9 @@ public:
 
 private:
   const bounds2i pixel_bounds_;             //!< bounds of the pixels_ in the final image
-  const PreComputedFilter<16> *filter_;     //!< pointer to filter's precomputed table
+  const PCF *filter_;                       //!< pointer to filter's precomputed table
   FilmTilePixel *pixels_{nullptr};          //!< rendered pixels_
+  bool owns_pixels_{true};                  //!< false when pixels_ live in external storage
 };
 
 // *********************************************************************************************************************
@@ -73,7 +127,7 @@ private:
 /// \note                            |------x------|------x------|------x------|
 /// \note film coordinates:          0             1             2             3
 struct Film {
-  typedef PreComputedFilter<16> PCF;
+  typedef PreComputedFilter<Filter::max_table_width> PCF;
   // *******************************************************************************************************************
   //                                                                                                     CONSTRUCTORS
   // *******************************************************************************************************************
@@ -82,10 +136,12 @@ struct Film {
   /// \param crop_window specifies a subset of the image to render (NDC space)
   /// \param filter used to compute radiance contributions to each pixel
   /// \param diagonal length of the diagonal of the film's physical area (millimeters)
+  /// \param filter_mode how samples are reconstructed into pixels
   Film(const hermes::size2 &resolution,
        Filter *filter,
        real_t diagonal,
-       const bounds2 &crop_window = bounds2::unitBox());
+       const bounds2 &crop_window = bounds2::unitBox(),
+       FilmFilterMode filter_mode = FilmFilterMode::SPLAT);
   // *******************************************************************************************************************
   //                                                                                                          METHODS
   // *******************************************************************************************************************
@@ -93,6 +149,16 @@ struct Film {
   /// \return std::unique_ptr<FilmTile> a pointer to a FilmTile object that
   /// stores contributions for the pixels_ in its region
   HERMES_DEVICE_CALLABLE FilmTile filmTile(const bounds2i &sample_bounds);
+  /// \param sample_bounds tile's region
+  /// \param pixels **[in]** storage for the tile pixels (see Film::filmTileBounds)
+  /// \return FilmTile a tile that accumulates into the given storage
+  HERMES_DEVICE_CALLABLE FilmTile filmTile(const bounds2i &sample_bounds, FilmTilePixel *pixels);
+  /// \param sample_bounds tile's region
+  /// \return bounds2i pixels that samples inside sample_bounds contribute to
+  [[nodiscard]] HERMES_DEVICE_CALLABLE bounds2i filmTileBounds(const bounds2i &sample_bounds) const;
+  /// \param sample_row_count number of consecutive rows of samples
+  /// \return largest number of pixel rows those samples contribute to
+  [[nodiscard]] HERMES_DEVICE_CALLABLE int footprintRowCount(int sample_row_count) const;
   /// Computes the range of discrete pixel values to be sampled.
   /// \return bounds2i the area to be sampled
   [[nodiscard]] HERMES_DEVICE_CALLABLE bounds2i sampleBounds() const;
@@ -104,7 +170,172 @@ struct Film {
   const hermes::size2 full_resolution{};          //!< image's size in pixels
   const bounds2i cropped_pixel_bounds{};          //!< piece of image to be rendered/stored
   const real_t diagonal{};                        //!< length of the diagonal of the film's physical area in meters
-  const PreComputedFilter<16> filter{};           //!< used to interpolate radiance values to pixels_
+  const PCF filter{};                             //!< used to interpolate radiance values to pixels_
+  const FilmFilterMode filter_mode{FilmFilterMode::SPLAT}; //!< importance sampled films have disjoint tiles
+};
+
+// *********************************************************************************************************************
+//                                                                                                     FilmTileBuffer
+// *********************************************************************************************************************
+/// Strategy used to merge film tiles into the film image
+enum class FilmMergeMode {
+  ATOMIC,        //!< each tile atomically adds its pixels into the film image
+  DETERMINISTIC  //!< each tile owns a private buffer, buffers are reduced afterwards in tile order
+};
+
+/// Private accumulation storage for a grid of film tiles
+/// Each tile writes only into its own slot, which is large enough to hold the tile plus its filter
+/// overlap. Overlapping pixels are later summed in a fixed (tile index) order, so results do not depend
+/// on how tiles were scheduled.
+class FilmTileBuffer {
+public:
+  // *******************************************************************************************************************
+  //                                                                                                             View
+  // *******************************************************************************************************************
+  class View {
+    friend class FilmTileBuffer;
+  public:
+    /// \param film
+    /// \param tile tile coordinates in the tile grid
+    /// \param sample_bounds tile's region
+    /// \return FilmTile tile accumulating into its private slot
+    HERMES_DEVICE_CALLABLE FilmTile filmTile(Film &film, const hermes::index2 &tile, const bounds2i &sample_bounds);
+    /// Sums the contributions of all tiles overlapping a pixel, in tile order
+    /// \param p pixel coordinates with respect to overall image
+    /// \return FilmTilePixel
+    [[nodiscard]] HERMES_DEVICE_CALLABLE FilmTilePixel accumulate(const hermes::index2 &p) const;
+    /// \return bounds2i union of all tiles pixel bounds
+    [[nodiscard]] HERMES_DEVICE_CALLABLE bounds2i pixelBounds() const;
+    /// \return
+    HERMES_DEVICE_CALLABLE explicit operator bool() const { return pixels_ != nullptr; }
+  private:
+    FilmTilePixel *pixels_{nullptr};
+    bounds2i *tile_bounds_{nullptr};
+    bounds2i sample_bounds_;
+    bounds2i pixel_bounds_;
+    hermes::size2 n_tiles_;
+    u32 tile_size_{};
+    u32 tile_capacity_{};
+  };
+  // *******************************************************************************************************************
+  //                                                                                                     CONSTRUCTORS
+  // *******************************************************************************************************************
+  FilmTileBuffer() = default;
+  // *******************************************************************************************************************
+  //                                                                                                          METHODS
+  // *******************************************************************************************************************
+  /// Prepares storage for a grid of tiles
+  /// \param film
+  /// \param sample_bounds region (in sampling space) covered by the tiles
+  /// \param n_tiles number of tiles
+  /// \param tile_size tile size in pixels (tiles are square regions of nxn pixels)
+  /// \return
+  HeResult resize(const Film &film, const bounds2i &sample_bounds, const hermes::size2 &n_tiles, u32 tile_size);
+  /// \return
+  View view();
+  /// \return size of the buffer in bytes
+  [[nodiscard]] std::size_t memorySize() const;
+
+private:
+  hermes::DeviceArray<FilmTilePixel> pixels_;
+  hermes::DeviceArray<bounds2i> tile_bounds_;
+  View view_;
+};
+
+// *********************************************************************************************************************
+//                                                                                                    FilmSplatBuffer
+// *********************************************************************************************************************
+/// Splat contribution waiting to be reduced into the film image
+struct FilmSplat {
+  u32 pixel_offset{};                         //!< pixel offset inside the film image
+  real_t xyz[3]{};                            //!< splat value in XYZ color space
+};
+
+/// Per-thread sparse storage for film splats
+/// Each thread appends splats to its own segment only. A full segment is drained by its thread: entries
+/// get sorted by pixel, entries of the same pixel are combined and added to the film (with atomics), and
+/// the segment starts over empty. Once rendering is done, all segments are flushed and reduced into
+/// FilmPixel::splat_XYZ by rows, each row being owned by a single thread, so no atomics are needed and
+/// results do not depend on thread scheduling (as long as no segment overflows).
+class FilmSplatBuffer {
+public:
+  // *******************************************************************************************************************
+  //                                                                                                             View
+  // *******************************************************************************************************************
+  class View {
+    friend class FilmSplatBuffer;
+  public:
+    /// Appends a splat to a segment
+    /// \param segment thread's segment index
+    /// \param pixel_offset pixel offset inside the film image
+    /// \param xyz splat value in XYZ color space
+    /// \return false if the segment is full (see drain)
+    HERMES_DEVICE_CALLABLE bool add(u32 segment, u32 pixel_offset, const real_t xyz[3]);
+    /// Sorts segment entries by pixel and combines entries of the same pixel
+    /// \param segment thread's segment index
+    HERMES_DEVICE_CALLABLE void flush(u32 segment);
+    /// Flushes a segment, visits its entries and empties it
+    /// \tparam F callable as f(u32 pixel_offset, const real_t xyz[3])
+    /// \param segment thread's segment index
+    /// \param f
+    template<class F>
+    HERMES_DEVICE_CALLABLE void drain(u32 segment, const F &f) {
+      flush(segment);
+      const FilmSplat *splats = splats_ + segment * segment_capacity_;
+      for (u32 i = 0; i < counts_[segment]; ++i)
+        f(splats[i].pixel_offset, splats[i].xyz);
+      counts_[segment] = 0;
+    }
+    /// Visits, in segment order, all (flushed) entries that fall in [pixel_offset_begin, pixel_offset_end)
+    /// \tparam F callable as f(u32 pixel_offset, const real_t xyz[3])
+    /// \param pixel_offset_begin
+    /// \param pixel_offset_end
+    /// \param f
+    template<class F>
+    HERMES_DEVICE_CALLABLE void reduce(u32 pixel_offset_begin, u32 pixel_offset_end, const F &f) const {
+      for (u32 segment = 0; segment < segment_count_; ++segment) {
+        const FilmSplat *splats = splats_ + segment * segment_capacity_;
+        // find first entry of the range
+        u32 lo = 0, hi = counts_[segment];
+        while (lo < hi) {
+          u32 mid = (lo + hi) / 2;
+          if (splats[mid].pixel_offset < pixel_offset_begin)
+            lo = mid + 1;
+          else
+            hi = mid;
+        }
+        for (u32 i = lo; i < counts_[segment] && splats[i].pixel_offset < pixel_offset_end; ++i)
+          f(splats[i].pixel_offset, splats[i].xyz);
+      }
+    }
+    /// \return number of segments
+    [[nodiscard]] HERMES_DEVICE_CALLABLE u32 segmentCount() const { return segment_count_; }
+    /// \return
+    HERMES_DEVICE_CALLABLE explicit operator bool() const { return splats_ != nullptr; }
+  private:
+    FilmSplat *splats_{nullptr};
+    u32 *counts_{nullptr};
+    u32 segment_count_{0};
+    u32 segment_capacity_{0};
+  };
+  // *******************************************************************************************************************
+  //                                                                                                          METHODS
+  // *******************************************************************************************************************
+  /// \param segment_count number of threads adding splats
+  /// \param segment_capacity number of splats each thread can hold before draining
+  /// \return
+  HeResult resize(u32 segment_count, u32 segment_capacity);
+  /// Discards all stored splats
+  void clear();
+  /// \return
+  View view();
+  /// \return size of the buffer in bytes
+  [[nodiscard]] std::size_t memorySize() const;
+
+private:
+  hermes::DeviceArray<FilmSplat> splats_;
+  hermes::DeviceArray<u32> counts_;
+  View view_;
 };
 
 // *********************************************************************************************************************
@@ -122,34 +353,92 @@ public:
   // *******************************************************************************************************************
   //                                                                                                          METHODS
   // *******************************************************************************************************************
+  /// \note Only valid for FilmStorageMode::FULL
   /// \param p pixel position
   /// \return Pixel& pixel's reference
   HERMES_DEVICE_CALLABLE FilmPixel &getPixel(const hermes::index2 &p);
+  /// \param p pixel position
+  /// \return FilmPixel pixel's value (unpacked if necessary)
+  [[nodiscard]] HERMES_DEVICE_CALLABLE FilmPixel pixel(const hermes::index2 &p) const;
+  /// \param p pixel position
+  /// \param pixel new pixel's value (packed if necessary)
+  HERMES_DEVICE_CALLABLE void setPixel(const hermes::index2 &p, const FilmPixel &pixel);
   ///
   /// \param p
   /// \return
   HERMES_DEVICE_CALLABLE real_t *rgb(const hermes::index2 &p);
   /// Note that ownership of tile is transferred to this method, so the caller
   /// should not attempt to add contributions to the tile after.
+  /// \note Only valid for FilmStorageMode::FULL, compact pixels must be merged with mergeFilmTiles
+  /// \note Tiles of FilmFilterMode::IMPORTANCE films are disjoint and merged without atomics
   /// \param tile tile unique reference
   HERMES_DEVICE_FUNCTION void mergeFilmTile(const FilmTile &tile);
-  /// Sets the entire image
-  /// \param img pixel's XYZ values
-  void setImage(const SpectrumOld *img) const;
-  /// Splats contributions to arbitrary pixels_
+  /// Adds the reduced contribution of all buffered tiles to pixel p (no atomics involved)
+  /// \param p pixel coordinates with respect to overall image
+  /// \param tiles tile buffer
+  HERMES_DEVICE_CALLABLE void mergeFilmTiles(const hermes::index2 &p, const FilmTileBuffer::View &tiles);
+  /// Splats contributions to arbitrary pixels_ directly into the image (uses atomics)
   /// \param p position
   /// \param v spectra data
-  void addSplat(const hermes::point2 &p, const SpectrumOld &v);
+  HERMES_DEVICE_FUNCTION void addSplat(const hermes::point2 &p, const SpectrumOld &v);
+  /// Splats contributions to arbitrary pixels_ through the thread's splat buffer segment
+  /// \note Falls back to addSplat(p, v) if no splat buffer was prepared, full segments are drained into the image
+  /// \param thread_index splat buffer segment owned by the calling thread
+  /// \param p position
+  /// \param v spectra data
+  HERMES_DEVICE_FUNCTION void addSplat(u32 thread_index, const hermes::point2 &p, const SpectrumOld &v);
+  /// Reduces all buffered splats of a row of pixels (compact pixels also pack their single precision splat sums)
+  /// \param row row index with respect to the cropped image
+  HERMES_DEVICE_CALLABLE void mergeSplats(int row);
+
+  /// Computes the final rgb value of a pixel
+  /// \param p pixel position
+  /// \param rgb receives the pixel's rgb value
+  /// \param splat_scale
+  HERMES_DEVICE_CALLABLE void resolve(const hermes::index2 &p, real_t rgb[3], real_t splat_scale = 1) const;
+  //                                                                                                    dirty regions
+  /// Flags the dirty block containing p
+  /// \param p pixel position
+  HERMES_DEVICE_CALLABLE void markDirty(const hermes::index2 &p);
+  /// Flags all dirty blocks overlapping bounds
+  /// \param bounds pixel region
+  HERMES_DEVICE_CALLABLE void markDirty(const hermes::bounds2i &bounds);
+  /// \param image_bounds cropped pixel bounds of the film
+  /// \return number of dirty blocks covering the image
+  HERMES_DEVICE_CALLABLE static u32 dirtyBlockCount(const hermes::bounds2i &image_bounds);
+  /// \param image_bounds cropped pixel bounds of the film
+  /// \param block block index (row major)
+  /// \return pixel region covered by the block
+  HERMES_DEVICE_CALLABLE static hermes::bounds2i dirtyBlockBounds(const hermes::bounds2i &image_bounds, u32 block);
+  /// \param block block index (row major)
+  /// \return resident rows of the block region (empty if none of its rows is resident)
+  [[nodiscard]] HERMES_DEVICE_CALLABLE hermes::bounds2i residentBlockBounds(u32 block) const;
 
   HERMES_DEVICE_FUNCTION  Film &film();
+  /// \param p pixel position
+  /// \return true if the pixel is currently stored in memory (always true unless the film is streamed)
+  [[nodiscard]] HERMES_DEVICE_CALLABLE bool isResident(const hermes::index2 &p) const;
 
+  static constexpr int dirty_block_size = 16;                //!< side (in pixels) of dirty tracking blocks
   const real_t scale;
 private:
-  explicit FilmImageView(FilmPixel *pixels, real_t *rgb, Film film, real_t scale);
+  explicit FilmImageView(FilmPixel *pixels, CompactFilmPixel *compact_pixels, real_t *rgb, Film film, real_t scale,
+                         FilmSplatBuffer::View splats = {});
+  [[nodiscard]] HERMES_DEVICE_CALLABLE int pixelOffset(const hermes::index2 &p) const;
+  [[nodiscard]] HERMES_DEVICE_CALLABLE int imageRow(int ring_row) const;
+  HERMES_DEVICE_CALLABLE void addTilePixel(const hermes::index2 &p, const FilmTilePixel &tile_pixel);
+  /// Adds a splat value to a resident pixel (uses atomics)
+  HERMES_DEVICE_FUNCTION void addSplatXYZ(u32 offset, const real_t xyz[3]);
 
   Film film_;
+  int resident_row_begin_{0};                                //!< first resident row (streamed films)
+  int resident_row_count_{0};                                //!< number of rows in the ring buffer (0 = all)
   FilmPixel *pixels_{nullptr};                               //!< image's pixel structures
+  CompactFilmPixel *compact_pixels_{nullptr};                //!< image's packed pixel structures
   real_t *rgb_{nullptr};                                     //!< image's rgb values
+  FilmSplatBuffer::View splats_;                             //!< per-thread splat storage
+  real_t *splat_sums_{nullptr};                              //!< XYZ splat sums of compact pixels
+  u8 *dirty_{nullptr};                                       //!< one flag per dirty block
 };
 
 // *********************************************************************************************************************
@@ -162,22 +451,114 @@ public:
   //                                                                                                     CONSTRUCTORS
   // *******************************************************************************************************************
   /// \param film
-  explicit FilmImage(const Film &film, real_t scale = 1);
+  /// \param scale
+  /// \param storage_mode
+  explicit FilmImage(const Film &film, real_t scale = 1, FilmStorageMode storage_mode = FilmStorageMode::FULL);
   // *******************************************************************************************************************
   //                                                                                                          METHODS
   // *******************************************************************************************************************
   /// Convert film pixel information into actual rgb values
+  /// \note Streamed films only return the rows already finished (see finishRows), read back from the stream file.
+  /// \note Use save to write streamed films without holding the whole image in memory
   /// \return
   hermes::Array<real_t> imagePixels();
+  /// Saves the image into a file (see io::save), streamed films are read and encoded in bands of rows
+  /// \param filename
+  /// \param band_height number of rows read at a time from the stream file (streamed films)
+  /// \param exr_options
+  /// \return INVALID_INPUT if the film is streamed and not all rows were finished or the file can not be written
+  HeResult save(const hermes::Path &filename, int band_height = 256, const io::ExrOptions &exr_options = {});
   /// \return
   FilmImageView view();
+  /// Reduces all tiles stored in the buffer into the image
+  /// \param tiles
+  void mergeFilmTiles(FilmTileBuffer &tiles);
+  /// Sets the entire image
+  /// \param img pixel's values (one per pixel of the cropped image)
+  /// \return
+  HeResult setImage(const hermes::Array<SpectrumOld> &img);
+  /// Allocates per-thread splat segments used by FilmImageView::addSplat(thread_index, ...)
+  /// \param thread_count number of threads adding splats
+  /// \param segment_capacity number of splats each thread can hold before draining
+  /// \return
+  HeResult prepareSplats(u32 thread_count, u32 segment_capacity = 1024);
+  /// Flushes all splat segments and reduces them into the image pixels
+  /// \note Compact images pack splat sums into half precision here, so their splats show up after this call
+  void mergeSplats();
+  //                                                                                                    dirty regions
+  /// Receives a resolved region and its rgb values (row major, 3 values per pixel, tightly packed)
+  using RegionCallback = std::function<void(const hermes::bounds2i &region, const real_t *rgb)>;
+  /// Converts only the blocks that received contributions since the last call and hands them to callback
+  /// \note Streamed films report only the resident rows of each block, finished rows are read with readRows
+  /// \param callback called once per resolved block (with the resolved part of the block)
+  /// \return number of resolved blocks
+  size_t resolveDirtyRegions(const RegionCallback &callback);
+  /// \return number of blocks currently flagged as dirty
+  [[nodiscard]] size_t dirtyBlockCount() const;
+  //                                                                                                adaptive sampling
+  /// Flags pixels whose relative error (see FilmPixel::relativeError) is above error_threshold
+  /// \note Pixels outside the film (or not resident) are never flagged
+  /// \param bounds image region covered by the mask
+  /// \param error_threshold
+  /// \param mask receives one flag per pixel of bounds (row major)
+  /// \return number of flagged pixels
+  size_t refinementMask(const bounds2i &bounds, real_t error_threshold, hermes::DeviceArray<u8> &mask);
+  /// \note Only FilmStorageMode::FULL pixels keep sample statistics
+  /// \return total number of samples taken inside resident pixels
+  [[nodiscard]] u64 sampleCount() const;
+  /// \note Merges pending splats first
+  /// \return true if any sample or splat reached the resident pixels
+  bool hasContributions();
+  //                                                                                                        streaming
+  /// Keeps only a band of rows in memory. Rows are stored in a ring buffer and, once finished
+  /// (see finishRows), resolved into rgb values and appended to a file.
+  /// \note Rows must be finished in increasing order and samples can only be added to rows
+  /// \note inside [firstResidentRow(), firstResidentRow() + resident_row_count)
+  /// \param path file receiving the rgb rows (raw real_t values, 3 per pixel, rows in order)
+  /// \param resident_row_count number of rows kept in memory
+  /// \return INVALID_INPUT if the band can not hold the footprint of a single row of samples
+  /// \return (see Film::footprintRowCount), the film already holds contributions or finished rows,
+  /// \return or the file can not be created
+  HeResult streamTo(const hermes::Path &path, int resident_row_count);
+  /// Resolves all resident rows before row_end and writes them to the stream file
+  /// \note Has no effect on non-streamed films
+  /// \param row_end first row (in image coordinates) that can still receive contributions
+  /// \return
+  HeResult finishRows(int row_end);
+  /// \return first row still held in memory
+  [[nodiscard]] int firstResidentRow() const;
+  /// \return number of rows held in memory (0 if the film is not streamed)
+  [[nodiscard]] int residentRowCount() const;
+  /// \return true if rows are streamed to a file (see streamTo)
+  [[nodiscard]] bool isStreamed() const;
+  /// Reads already finished rgb rows back from the stream file
+  /// \param row_begin first row (in image coordinates)
+  /// \param row_end row after the last row (in image coordinates)
+  /// \return rgb values of the rows (empty if rows were not finished yet)
+  hermes::Array<real_t> readRows(int row_begin, int row_end) const;
   /// \return
   const Film &film() const;
+  /// \return
+  [[nodiscard]] FilmStorageMode storageMode() const;
+  /// \return size of resident pixel storage in bytes
+  [[nodiscard]] std::size_t memorySize() const;
 private:
   Film film_;
+  FilmStorageMode storage_mode_{FilmStorageMode::FULL};
   hermes::DeviceArray<FilmPixel> pixels_;
+  hermes::DeviceArray<CompactFilmPixel> compact_pixels_;
   hermes::DeviceArray<real_t> rgb_;
+  FilmSplatBuffer splats_;
+  hermes::DeviceArray<real_t> splat_sums_;
+  hermes::DeviceArray<u8> dirty_;
   real_t scale_{1};
+  // streaming
+  hermes::Path stream_path_;
+  int resident_row_begin_{0};
+  int resident_row_count_{0};
+
+  FilmImageView view(real_t *rgb);
+  void resizeStorage(size_t pixel_count);
 
 };
 
@@ -13,4 +13,59 @@ HERMES_DEVICE_CALLABLE real_t BoxFilter::evaluate(const hermes::point2 &p) const
 
 HERMES_DEVICE_CALLABLE BoxFilter::BoxFilter() {}
 
+HERMES_DEVICE_CALLABLE GaussianFilter::GaussianFilter() : GaussianFilter(hermes::vec2(1.5f, 1.5f)) {}
+
+HERMES_DEVICE_CALLABLE GaussianFilter::GaussianFilter(const hermes::vec2 &radius, real_t sigma)
+    : Filter(radius), sigma(sigma),
+      exp_radius(exp(-radius.x * radius.x / (2 * sigma * sigma)), exp(-radius.y * radius.y / (2 * sigma * sigma))) {}
+
+HERMES_DEVICE_CALLABLE real_t GaussianFilter::gaussian(real_t x) const {
+  return exp(-x * x / (2 * sigma * sigma));
+}
+
+HERMES_DEVICE_CALLABLE real_t GaussianFilter::evaluate(const hermes::point2 &p) const {
+  real_t gx = gaussian(p.x) - exp_radius.x;
+  real_t gy = gaussian(p.y) - exp_radius.y;
+  return (gx > 0 ? gx : 0) * (gy > 0 ? gy : 0);
+}
+
+HERMES_DEVICE_CALLABLE MitchellFilter::MitchellFilter() : MitchellFilter(hermes::vec2(2, 2)) {}
+
+HERMES_DEVICE_CALLABLE MitchellFilter::MitchellFilter(const hermes::vec2 &radius, real_t b, real_t c)
+    : Filter(radius), b(b), c(c) {}
+
+HERMES_DEVICE_CALLABLE real_t MitchellFilter::mitchell1D(real_t x) const {
+  x = abs(2 * x);
+  if (x > 2)
+    return 0;
+  if (x > 1)
+    return ((-b - 6 * c) * x * x * x + (6 * b + 30 * c) * x * x + (-12 * b - 48 * c) * x + (8 * b + 24 * c)) / 6;
+  return ((12 - 9 * b - 6 * c) * x * x * x + (-18 + 12 * b + 6 * c) * x * x + (6 - 2 * b)) / 6;
+}
+
+HERMES_DEVICE_CALLABLE real_t MitchellFilter::evaluate(const hermes::point2 &p) const {
+  return mitchell1D(p.x * inv_radius.x) * mitchell1D(p.y * inv_radius.y);
+}
+
+HERMES_DEVICE_CALLABLE LanczosSincFilter::LanczosSincFilter() : LanczosSincFilter(hermes::vec2(4, 4)) {}
+
+HERMES_DEVICE_CALLABLE LanczosSincFilter::LanczosSincFilter(const hermes::vec2 &radius, real_t tau)
+    : Filter(radius), tau(tau) {}
+
+HERMES_DEVICE_CALLABLE real_t LanczosSincFilter::windowedSinc(real_t x, real_t r) const {
+  x = abs(x);
+  if (x > r)
+    return 0;
+  auto sinc = [](real_t t) -> real_t {
+    if (t < 1e-5f)
+      return 1;
+    return sin(hermes::Constants::pi * t) / (hermes::Constants::pi * t);
+  };
+  return sinc(x) * sinc(x / tau);
+}
+
+HERMES_DEVICE_CALLABLE real_t LanczosSincFilter::evaluate(const hermes::point2 &p) const {
+  return windowedSinc(p.x, radius.x) * windowedSinc(p.y, radius.y);
+}
+
 } // namespace helios
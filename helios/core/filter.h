@@ -51,44 +51,137 @@ public:
   /// \param p sample point relative to the center of the filter
   /// \return real_t filter's value
   [[nodiscard]] HERMES_DEVICE_CALLABLE virtual real_t evaluate(const hermes::point2 &p) const = 0;
+  /// Number of cells used to tabulate each half axis of this filter (see PreComputedFilter)
+  /// \note Derived filters choose their resolution through a static constexpr table_width member
+  [[nodiscard]] virtual int tableWidth() const { return table_width; }
   // *******************************************************************************************************************
   //                                                                                                    PUBLIC FIELDS
   // *******************************************************************************************************************
   const hermes::vec2 radius{};        //!< filter's radius_ of support
   const hermes::vec2 inv_radius{};    //!< reciprocal of radius_
+  /// Largest radius (in pixels) covered by the film, wider filters are clamped when the film is built
+  static constexpr int max_radius = 4;
+  /// Maximum number of pixels a filter footprint spans along each axis
+  static constexpr int max_footprint_width = 2 * max_radius + 1;
+  /// Default table resolution
+  static constexpr int table_width = 16;
+  /// Largest table resolution a filter may ask for
+  static constexpr int max_table_width = 64;
+};
+
+/// Film position drawn from a filter distribution
+struct FilterSample {
+  hermes::vec2 p;               //!< offset from the pixel center
+  real_t weight{0};             //!< filter's value over the sample's pdf
 };
 
 // *********************************************************************************************************************
 //                                                                                                  PreComputedFilter
 // *********************************************************************************************************************
-/// Stores a table of pre-computed weights for a given filter
-/// \note Generally, every image sample contributes to 16 pixels in the final image (TABLE_WIDTH = 16).
+/// Stores pre-computed weights for a given filter
+/// \note Filters are assumed to be separable, f(x, y) = f(x, 0) * f(0, y) / f(0, 0), so each axis is tabulated
+/// \note separately and a weight costs two lookups and a multiply. Tables cover |x| and |y| only, with
+/// \note filter->tableWidth() cells each (up to TABLE_WIDTH).
 template<size_t TABLE_WIDTH>
 class PreComputedFilter {
 public:
   PreComputedFilter() {
-    for (int y = 0, offset = 0; y < filter_table_width; ++y)
-      for (int x = 0; x < filter_table_width; ++x, ++offset)
-        table[offset] = 1;
+    table_width = 1;
+    table_x[0] = table_y[0] = 1;
+    computeSamplingTables();
   }
-  explicit PreComputedFilter(const Filter *filter) : radius{filter->radius}, inv_radius{filter->inv_radius} {
-    // precompute filter weight table
-    for (int y = 0, offset = 0; y < filter_table_width; ++y)
-      for (int x = 0; x < filter_table_width; ++x, ++offset) {
-        hermes::point2 p((x + 0.5f) * filter->radius.x / filter_table_width,
-                         (y + 0.5f) * filter->radius.y / filter_table_width);
-        table[offset] = filter->evaluate(p);
-      }
+  /// \note Radii wider than Filter::max_radius are clamped, so the filter is truncated once here instead of
+  /// \note having its footprint cut per sample
+  explicit PreComputedFilter(const Filter *filter)
+      : radius{clampRadius(filter->radius)}, inv_radius{1 / radius.x, 1 / radius.y} {
+    table_width = filter->tableWidth();
+    table_width = table_width < 1 ? 1 : (table_width > max_table_width ? max_table_width : table_width);
+    // precompute filter weight tables, the filter's center value is factored out of the x table
+    real_t center = filter->evaluate(hermes::point2(0, 0));
+    real_t inv_center = center != 0 ? 1 / center : 1;
+    for (int i = 0; i < table_width; ++i) {
+      table_x[i] = filter->evaluate(hermes::point2((i + 0.5f) * radius.x / table_width, 0)) * inv_center;
+      table_y[i] = filter->evaluate(hermes::point2(0, (i + 0.5f) * radius.y / table_width));
+    }
+    computeSamplingTables();
+  }
+  // *******************************************************************************************************************
+  //                                                                                                          METHODS
+  // *******************************************************************************************************************
+  /// \param x table cell along the x axis
+  /// \param y table cell along the y axis
+  /// \return filter weight of cell (x, y)
+  [[nodiscard]] HERMES_DEVICE_CALLABLE real_t evaluate(int x, int y) const { return table_x[x] * table_y[y]; }
+  /// Samples a position proportionally to the absolute filter value (piecewise constant over table cells)
+  /// \param u uniform random sample in [0,1)^2
+  /// \return offset from the filter center and the weight (f/pdf) the sample must carry
+  [[nodiscard]] HERMES_DEVICE_CALLABLE FilterSample sample(const hermes::point2 &u) const {
+    // the first half of each random number picks the side of the (symmetric) filter
+    real_t ux = u.x < 0.5f ? 2 * u.x : 2 * u.x - 1;
+    real_t uy = u.y < 0.5f ? 2 * u.y : 2 * u.y - 1;
+    real_t dx = 0, dy = 0;
+    // |f| is separable as well, so both axes are sampled independently
+    int x = sampleCDF(cdf_x, table_width, ux, dx);
+    int y = sampleCDF(cdf_y, table_width, uy, dy);
+    FilterSample s;
+    s.p = hermes::vec2((u.x < 0.5f ? -1 : 1) * (x + dx) * radius.x / table_width,
+                       (u.y < 0.5f ? -1 : 1) * (y + dy) * radius.y / table_width);
+    s.weight = evaluate(x, y) < 0 ? -abs_integral : abs_integral;
+    return s;
   }
   // *******************************************************************************************************************
   //                                                                                                    PUBLIC FIELDS
   // *******************************************************************************************************************
-  static constexpr int filter_table_width = TABLE_WIDTH;
-  real_t table[TABLE_WIDTH * TABLE_WIDTH]{};                //!< precomputed table for filter values
-  //!<                                                           to save computations of filter's
-  //!<                                                           evaluate method. f = f(|x|, |y|)
-  const hermes::vec2 radius;                                //!< filter's radius_ of support
-  const hermes::vec2 inv_radius;                            //!< reciprocal of radius_
+  static constexpr int max_table_width = TABLE_WIDTH;
+  int table_width{max_table_width};             //!< number of cells used in each table
+  real_t table_x[TABLE_WIDTH]{};                //!< filter values along x (normalized by the filter's center)
+  real_t table_y[TABLE_WIDTH]{};                //!< filter values along y
+  const hermes::vec2 radius;                    //!< filter's radius_ of support
+  const hermes::vec2 inv_radius;                //!< reciprocal of radius_
+  real_t cdf_x[TABLE_WIDTH + 1]{};              //!< cdf of |table_x|
+  real_t cdf_y[TABLE_WIDTH + 1]{};              //!< cdf of |table_y|
+  real_t abs_integral{0};                       //!< integral of |f| over the filter support
+
+private:
+  static hermes::vec2 clampRadius(const hermes::vec2 &r) {
+    return {r.x < Filter::max_radius ? r.x : Filter::max_radius, r.y < Filter::max_radius ? r.y : Filter::max_radius};
+  }
+  /// \param cdf n + 1 values
+  /// \param n number of intervals
+  /// \param u uniform random value
+  /// \param du **[out]** u remapped inside the selected interval
+  /// \return interval index
+  HERMES_DEVICE_CALLABLE static int sampleCDF(const real_t *cdf, int n, real_t u, real_t &du) {
+    int lo = 0, hi = n - 1;
+    while (lo < hi) {
+      int mid = (lo + hi + 1) / 2;
+      if (cdf[mid] <= u)
+        lo = mid;
+      else
+        hi = mid - 1;
+    }
+    real_t width = cdf[lo + 1] - cdf[lo];
+    du = width > 0 ? (u - cdf[lo]) / width : 0;
+    du = du < 1 ? du : hermes::Constants::one_minus_epsilon;
+    return lo;
+  }
+  /// \return sum of |table| values
+  real_t computeCDF(const real_t *table, real_t *cdf) const {
+    cdf[0] = 0;
+    for (int i = 0; i < table_width; ++i)
+      cdf[i + 1] = cdf[i] + (table[i] < 0 ? -table[i] : table[i]);
+    real_t total = cdf[table_width];
+    // tables with no weight are never sampled, but keep a valid distribution anyway
+    for (int i = 1; i <= table_width; ++i)
+      cdf[i] = total > 0 ? cdf[i] / total : (real_t) i / table_width;
+    cdf[table_width] = 1;
+    return total;
+  }
+  void computeSamplingTables() {
+    real_t total = computeCDF(table_x, cdf_x) * computeCDF(table_y, cdf_y);
+    // the tables cover a quarter of the support
+    abs_integral = 4 * total * radius.x * radius.y / (table_width * table_width);
+  }
 };
 
 // *********************************************************************************************************************
@@ -108,6 +201,101 @@ public:
   //                                                                                                        INTERFACE
   // *******************************************************************************************************************
   [[nodiscard]] HERMES_DEVICE_CALLABLE real_t evaluate(const hermes::point2 &p) const override;
+  [[nodiscard]] int tableWidth() const override { return table_width; }
+  // *******************************************************************************************************************
+  //                                                                                                    PUBLIC FIELDS
+  // *******************************************************************************************************************
+  static constexpr int table_width = 1; //!< constant function
+};
+
+// *********************************************************************************************************************
+//                                                                                                    Gaussian Filter
+// *********************************************************************************************************************
+/// Gaussian bump shifted down so it reaches zero at the radius. Gives slightly blurry images, but
+/// does not ring.
+class GaussianFilter : public Filter {
+public:
+  // *******************************************************************************************************************
+  //                                                                                                     CONSTRUCTORS
+  // *******************************************************************************************************************
+  HERMES_DEVICE_CALLABLE GaussianFilter();
+  /// \param radius filter extents
+  /// \param sigma standard deviation
+  HERMES_DEVICE_CALLABLE explicit GaussianFilter(const hermes::vec2 &radius, real_t sigma = 0.5f);
+  // *******************************************************************************************************************
+  //                                                                                                        INTERFACE
+  // *******************************************************************************************************************
+  [[nodiscard]] HERMES_DEVICE_CALLABLE real_t evaluate(const hermes::point2 &p) const override;
+  [[nodiscard]] int tableWidth() const override { return table_width; }
+  // *******************************************************************************************************************
+  //                                                                                                    PUBLIC FIELDS
+  // *******************************************************************************************************************
+  static constexpr int table_width = 32;
+  const real_t sigma{0.5f};             //!< standard deviation
+  const hermes::vec2 exp_radius{};      //!< gaussian values at the radius
+
+private:
+  [[nodiscard]] HERMES_DEVICE_CALLABLE real_t gaussian(real_t x) const;
+};
+
+// *********************************************************************************************************************
+//                                                                                                     Mitchell Filter
+// *********************************************************************************************************************
+/// Mitchell-Netravali cubic filter. Negative lobes sharpen edges, the (b, c) parameters trade blurring
+/// for ringing (b + 2c = 1 is the recommended line).
+class MitchellFilter : public Filter {
+public:
+  // *******************************************************************************************************************
+  //                                                                                                     CONSTRUCTORS
+  // *******************************************************************************************************************
+  HERMES_DEVICE_CALLABLE MitchellFilter();
+  /// \param radius filter extents
+  /// \param b
+  /// \param c
+  HERMES_DEVICE_CALLABLE explicit MitchellFilter(const hermes::vec2 &radius, real_t b = 1.f / 3, real_t c = 1.f / 3);
+  // *******************************************************************************************************************
+  //                                                                                                        INTERFACE
+  // *******************************************************************************************************************
+  [[nodiscard]] HERMES_DEVICE_CALLABLE real_t evaluate(const hermes::point2 &p) const override;
+  [[nodiscard]] int tableWidth() const override { return table_width; }
+  // *******************************************************************************************************************
+  //                                                                                                    PUBLIC FIELDS
+  // *******************************************************************************************************************
+  static constexpr int table_width = 32;
+  const real_t b{1.f / 3};
+  const real_t c{1.f / 3};
+
+private:
+  /// \param x in [-1, 1]
+  [[nodiscard]] HERMES_DEVICE_CALLABLE real_t mitchell1D(real_t x) const;
+};
+
+// *********************************************************************************************************************
+//                                                                                                      Lanczos Filter
+// *********************************************************************************************************************
+/// Sinc filter windowed by a wider sinc. Closest to the ideal low-pass filter, but rings on sharp edges.
+class LanczosSincFilter : public Filter {
+public:
+  // *******************************************************************************************************************
+  //                                                                                                     CONSTRUCTORS
+  // *******************************************************************************************************************
+  HERMES_DEVICE_CALLABLE LanczosSincFilter();
+  /// \param radius filter extents
+  /// \param tau number of sinc cycles inside the window
+  HERMES_DEVICE_CALLABLE explicit LanczosSincFilter(const hermes::vec2 &radius, real_t tau = 3);
+  // *******************************************************************************************************************
+  //                                                                                                        INTERFACE
+  // *******************************************************************************************************************
+  [[nodiscard]] HERMES_DEVICE_CALLABLE real_t evaluate(const hermes::point2 &p) const override;
+  [[nodiscard]] int tableWidth() const override { return table_width; }
+  // *******************************************************************************************************************
+  //                                                                                                    PUBLIC FIELDS
+  // *******************************************************************************************************************
+  static constexpr int table_width = 64; //!< lobes oscillate over the whole (wide) support
+  const real_t tau{3};
+
+private:
+  [[nodiscard]] HERMES_DEVICE_CALLABLE real_t windowedSinc(real_t x, real_t radius) const;
 };
 
 } // namespace helios
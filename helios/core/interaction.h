@@ -150,21 +150,19 @@ public:
   ///
   /// \param ray
   HERMES_DEVICE_CALLABLE void computeDifferentials(const RayDifferential &ray) const;
-  ///
+  /// Evaluates the material at this interaction
   /// \param ray
-  /// \return
-  template<typename Allocator>
-  HERMES_DEVICE_CALLABLE BSDF bsdf(const RayDifferential &ray, SampledWaveLengths &lambda, Allocator allocator) {
+  /// \param lambda sampled wavelengths
+  /// \return empty BSDF if there is no material
+  HERMES_DEVICE_CALLABLE BSDF bsdf(const RayDifferential &ray, SampledWaveLengths &lambda) {
     // compute differentials for intersection
     computeDifferentials(ray);
     // check if material exists
     if (!material)
       return {};
     // TODO: normal & bump map
-    CAST_MATERIAL(material, material_ptr,
-                  auto b = material_ptr->bxdf(allocator, lambda);
-                      CAST_BXDF(b, ptr, /**/)
-                      return BSDF(shading.n, shading.dpdu, material_ptr->bxdf(allocator, lambda));
+    CAST_CONST_MATERIAL(material, material_ptr,
+                        return BSDF(shading.n, shading.dpdu, material_ptr->bxdf(lambda));
     )
     return {};
   }
@@ -55,6 +55,7 @@ HERMES_DEVICE_CALLABLE mem::Ptr::operator bool() const {
 }
 
 HeResult mem::init(std::size_t size_in_bytes) {
+  mem::get().epoch_++;
   return mem::get().allocator_.resize(size_in_bytes);
 }
 
@@ -71,6 +72,10 @@ std::size_t mem::availableSize() {
   return mem::get().allocator_.availableSizeInBytes();
 }
 
+std::size_t mem::epoch() {
+  return mem::get().epoch_;
+}
+
 StackAllocator mem::allocator() {
   return StackAllocator(mem::get().allocator_.view());
 }
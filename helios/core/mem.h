@@ -31,15 +31,21 @@
 #include <hermes/storage/stack_allocator.h>
 #include <hermes/common/debug.h>
 
+#include <unordered_map>
+#include <vector>
+
 namespace helios {
 
 class StackAllocator;
+template<typename T> class PoolAllocator;
 
 /// Memory Manager Singleton
 /// This memory manager implements a Stack Allocator scheme where
 /// objects are allocated contiguously and it is not possible to
 /// remove a object without deleting the objects on top of the
-/// object
+/// object. Types that are created and destroyed often can use
+/// per-type pools (see mem::pool) that recycle their slots through
+/// a free list on top of the same stack.
 class mem {
 public:
   // *******************************************************************************************************************
@@ -75,6 +81,7 @@ public:
   /// Allocates the memory that will be available for all allocators to use
   /// \param size_in_bytes
   /// \return
+  /// \note Any slots held by pools are discarded
   static HeResult init(std::size_t size_in_bytes);
   ///
   /// \return
@@ -100,6 +107,28 @@ public:
   static Ptr allocate(P &&... params) {
     return Ptr(mem::get().allocator_.push<T>(std::forward<P>(params)...));
   }
+  //                                                                                                            pools
+  /// Gets the pool of fixed-size slots of type T
+  /// \tparam T
+  /// \return
+  template<typename T>
+  static PoolAllocator<T> &pool() {
+    static PoolAllocator<T> singleton;
+    return singleton;
+  }
+  /// Allocates an object of type T reusing a slot released by mem::release when possible
+  /// \tparam T
+  /// \tparam P
+  /// \param params
+  /// \return
+  template<typename T, class... P>
+  static Ptr allocateFromPool(P &&... params);
+  /// Destroys the object and gives its slot back to the pool of type T
+  /// \tparam T
+  /// \param handle
+  /// \return
+  template<typename T>
+  static HeResult release(Ptr &handle);
   //                                                                                                           access
   ///
   /// \tparam T
@@ -122,6 +151,9 @@ public:
   ///
   /// \return
   static std::size_t availableSize();
+  /// Arena generation, incremented on every mem::init
+  /// \return
+  static std::size_t epoch();
   // *******************************************************************************************************************
   //                                                                                                        OPERATORS
   // *******************************************************************************************************************
@@ -155,8 +187,100 @@ private:
 
   hermes::StackAllocator allocator_;
   hermes::DeviceStackAllocator d_allocator_;
+  std::size_t epoch_{0};
+};
+
+// *********************************************************************************************************************
+//                                                                                                      PoolAllocator
+// *********************************************************************************************************************
+/// Fixed-size slot pool for objects of type T living in the mem arena
+/// Slots are pushed onto the arena on demand and, once released, are kept
+/// in a free list to be reused by the next allocation of the same type.
+/// Memory used by a pool is then bounded by the peak number of live objects.
+/// \note Pointers handed by the pool are regular mem::Ptr objects
+/// \tparam T
+template<typename T>
+class PoolAllocator {
+public:
+  // *******************************************************************************************************************
+  //                                                                                                          METHODS
+  // *******************************************************************************************************************
+  ///
+  /// \tparam P
+  /// \param params
+  /// \return
+  template<class... P>
+  mem::Ptr allocate(P &&... params) {
+    sync();
+    if (free_list_.empty()) {
+      auto ptr = mem::allocate<T>(std::forward<P>(params)...);
+      // an exhausted arena hands an empty pointer and no slot is created
+      if (ptr) {
+        slot_index_[ptr.template get<T>()] = slots_.size();
+        slots_.emplace_back(ptr.address_index);
+        live_.emplace_back(true);
+      }
+      return ptr;
+    }
+    std::size_t slot = free_list_.back();
+    free_list_.pop_back();
+    live_[slot] = true;
+    mem::Ptr ptr(slots_[slot]);
+    new(ptr.get<T>()) T(std::forward<P>(params)...);
+    return ptr;
+  }
+  /// \param handle **[in/out]** reset to an empty pointer
+  /// \return INVALID_INPUT if handle was not allocated by this pool or was already released
+  HeResult release(mem::Ptr &handle) {
+    sync();
+    if (!handle)
+      return HeResult::INVALID_INPUT;
+    auto it = slot_index_.find(handle.get<T>());
+    if (it == slot_index_.end() || !live_[it->second])
+      return HeResult::INVALID_INPUT;
+    handle.get<T>()->~T();
+    live_[it->second] = false;
+    free_list_.emplace_back(it->second);
+    handle = mem::Ptr();
+    return HeResult::SUCCESS;
+  }
+  //                                                                                                             size
+  /// \return number of slots pushed onto the arena by this pool
+  [[nodiscard]] std::size_t capacity() const { return epoch_ == mem::epoch() ? slots_.size() : 0; }
+  /// \return number of live objects
+  [[nodiscard]] std::size_t size() const { return capacity() - freeSlotCount(); }
+  /// \return number of released slots waiting for reuse
+  [[nodiscard]] std::size_t freeSlotCount() const { return epoch_ == mem::epoch() ? free_list_.size() : 0; }
+
+private:
+  /// Drops slots that belonged to a previous arena
+  void sync() {
+    if (epoch_ == mem::epoch())
+      return;
+    epoch_ = mem::epoch();
+    slots_.clear();
+    slot_index_.clear();
+    live_.clear();
+    free_list_.clear();
+  }
+
+  std::vector<hermes::AddressIndex> slots_;               //!< arena address of each slot
+  std::unordered_map<const T *, std::size_t> slot_index_; //!< slot of each address handed by the pool
+  std::vector<bool> live_;                                //!< per slot, false while in the free list
+  std::vector<std::size_t> free_list_;                    //!< released slots
+  std::size_t epoch_{0};
 };
 
+template<typename T, class... P>
+mem::Ptr mem::allocateFromPool(P &&... params) {
+  return mem::pool<T>().allocate(std::forward<P>(params)...);
+}
+
+template<typename T>
+HeResult mem::release(Ptr &handle) {
+  return mem::pool<T>().release(handle);
+}
+
 class StackAllocator {
 public:
   explicit StackAllocator(hermes::StackAllocatorView mem_view);
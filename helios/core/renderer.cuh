@@ -49,11 +49,16 @@ struct RenderInfo {
   hermes::index2 sample_extent;        //!< diagonal of the sampling region
   u32 tile_size{};                     //!< tile size in pixels (tiles are square regions of nxn pixels)
   hermes::size2 n_tiles;               //!< total number of tiles dividing the image region
+  u32 thread_count{};                  //!< threads launched, thread i renders tiles i, i + thread_count, ...
+  u32 pass{0};                         //!< sampling pass index
+  const u8 *pixel_mask{nullptr};       //!< pixels that still need samples (nullptr = all pixels)
+  hermes::range2 mask_bounds;          //!< image region covered by pixel_mask
+  static constexpr u32 default_tile_size = 16;
   // *******************************************************************************************************************
   //                                                                                                     CONSTRUCTORS
   // *******************************************************************************************************************
   RenderInfo() = default;
-  RenderInfo(hermes::range2 pixel_bounds, hermes::range2 sample_bounds, u32 tile_size = 16)
+  RenderInfo(hermes::range2 pixel_bounds, hermes::range2 sample_bounds, u32 tile_size = default_tile_size)
       : pixel_bounds(pixel_bounds),
         sample_bounds(sample_bounds),
         sample_extent(sample_bounds.upper() - sample_bounds.lower()),
@@ -61,6 +66,7 @@ struct RenderInfo {
     // Compute number of tiles
     n_tiles = hermes::size2((sample_extent.i + tile_size - 1) / tile_size,
                             (sample_extent.j + tile_size - 1) / tile_size);
+    thread_count = n_tiles.total();
   }
 };
 
@@ -74,16 +80,18 @@ struct SamplerIntegratorDebugData {
 // *********************************************************************************************************************
 /// Renders a tile
 /// \param render_info
+/// \param tile tile coordinates
 template<class CameraType, class SamplerType, class IntegratorType>
-HERMES_CUDA_KERNEL(render)(
-    RenderInfo render_info,
-    CameraType camera,
-    Scene::View scene,
-    SamplerType sampler,
-    FilmImageView film_image,
-    IntegratorType integrator,
-    SamplerIntegratorDebugData ddata) {
-  HERMES_CUDA_THREAD_INDEX2_LT(tile, render_info.n_tiles)
+HERMES_DEVICE_CALLABLE void renderTile(
+    const RenderInfo &render_info,
+    const hermes::index2 &tile,
+    const CameraType &camera,
+    const Scene::View &scene,
+    const SamplerType &sampler,
+    FilmImageView &film_image,
+    FilmTileBuffer::View &film_tiles,
+    IntegratorType &integrator,
+    SamplerIntegratorDebugData &ddata) {
   // Compute tile region
   auto x0 = render_info.sample_bounds.lower().i + tile.i * render_info.tile_size;
   auto x1 = min(x0 + render_info.tile_size, render_info.sample_bounds.upper().i);
@@ -91,25 +99,41 @@ HERMES_CUDA_KERNEL(render)(
   auto y1 = min(y0 + render_info.tile_size, render_info.sample_bounds.upper().j);
   // Create tile
   bounds2i tile_bounds(hermes::index2(x0, y0), hermes::index2(x1, y1));
-  auto film_tile = film_image.film().filmTile(tile_bounds);
-  // Prepare sampler
+  auto film_tile = film_tiles ? film_tiles.filmTile(film_image.film(), tile, tile_bounds)
+                             : film_image.film().filmTile(tile_bounds);
+  // Prepare sampler (samplers are stateless functions of pixel, sample and dimension, copies are cheap)
   SamplerType tile_sampler = sampler;
-  auto tile_index = tile.j * render_info.n_tiles.width + tile.i;
-  tile_sampler.setIndex(tile_index);
+  tile_sampler.setPass(render_info.pass);
 #ifdef HELIOS_DEBUG_DATA
+  auto tile_index = tile.j * render_info.n_tiles.width + tile.i;
   u32 pixel_sample_index = 0;
   u32 tile_ray_count = render_info.tile_size * render_info.tile_size * ddata.samples_per_pixel;
   u32 ray_base_index = tile_index * tile_ray_count;
 #endif
+  // importance sampled films draw film positions from the filter and add each sample to a single pixel
+  bool filter_importance_sampling = film_image.film().filter_mode == FilmFilterMode::IMPORTANCE;
   // loop over pixels in tile
   for (auto ij : tile_bounds) {
     if (!render_info.pixel_bounds.contains(ij))
       continue;
+    // skip pixels that already converged
+    if (render_info.pixel_mask) {
+      auto mask_width = render_info.mask_bounds.upper().i - render_info.mask_bounds.lower().i;
+      auto mask_offset = (ij.i - render_info.mask_bounds.lower().i)
+          + (ij.j - render_info.mask_bounds.lower().j) * mask_width;
+      if (!render_info.pixel_mask[mask_offset])
+        continue;
+    }
     // generate samples for pixel
     tile_sampler.startPixel(ij);
     do {
       // camera sample
       CameraSample camera_sample = tile_sampler.cameraSample(ij);
+      FilterSample filter_sample;
+      if (filter_importance_sampling) {
+        filter_sample = film_image.film().filter.sample(camera_sample.film - hermes::vec2(ij.i, ij.j));
+        camera_sample.film = hermes::point2(ij.i + 0.5f, ij.j + 0.5f) + filter_sample.p;
+      }
       // compute camera ray
       RayDifferential ray;
       auto ray_weight = camera.generateRayDifferential(camera_sample, &ray);
@@ -123,11 +147,36 @@ HERMES_CUDA_KERNEL(render)(
       if (ray_weight > 0)
         L = integrator.Li(ray, scene, tile_sampler);
       // Add camera ray's contribution to image
-      film_tile.addSample(camera_sample.film, L, ray_weight);
-    } while (sampler.startNextSample());
+      if (filter_importance_sampling)
+        film_tile.addPixelSample(ij, L, filter_sample.weight, ray_weight);
+      else
+        film_tile.addSample(camera_sample.film, L, ray_weight);
+    } while (tile_sampler.startNextSample());
   }
-  // Merge image tile into _Film_
-  film_image.mergeFilmTile(film_tile);
+  // Merge image tile into _Film_ (buffered tiles are reduced after all tiles finish)
+  if (!film_tiles)
+    film_image.mergeFilmTile(film_tile);
+}
+
+/// Renders the tiles of a region, each thread handles every render_info.thread_count-th tile
+/// \param render_info
+template<class CameraType, class SamplerType, class IntegratorType>
+HERMES_CUDA_KERNEL(render)(
+    RenderInfo render_info,
+    CameraType camera,
+    Scene::View scene,
+    SamplerType sampler,
+    FilmImageView film_image,
+    FilmTileBuffer::View film_tiles,
+    IntegratorType integrator,
+    SamplerIntegratorDebugData ddata) {
+  HERMES_CUDA_THREAD_INDEX_I
+  if (i >= render_info.thread_count)
+    return;
+  for (u32 tile_index = i; tile_index < render_info.n_tiles.total(); tile_index += render_info.thread_count)
+    renderTile(render_info,
+               hermes::index2(tile_index % render_info.n_tiles.width, tile_index / render_info.n_tiles.width),
+               camera, scene, sampler, film_image, film_tiles, integrator, ddata);
 }
 
 // *********************************************************************************************************************
@@ -142,15 +191,74 @@ public:
   // *******************************************************************************************************************
   explicit SamplerRenderer(const hermes::range2 &pixel_bounds) : pixel_bounds_(pixel_bounds) {}
   // *******************************************************************************************************************
+  //                                                                                                            SETUP
+  // *******************************************************************************************************************
+  /// \param mode how film tiles are merged into the film image
+  /// \note FilmMergeMode::DETERMINISTIC produces the same image regardless of tile scheduling
+  SamplerRenderer &withMergeMode(FilmMergeMode mode) {
+    merge_mode_ = mode;
+    return *this;
+  }
+  /// Limits the number of threads launched per image region, threads then render several tiles each
+  /// \note Tiles are rendered the same way whatever the thread count, only their scheduling changes
+  /// \param thread_count (0 launches one thread per tile)
+  SamplerRenderer &withThreadCount(u32 thread_count) {
+    thread_count_ = thread_count;
+    return *this;
+  }
+  /// Renders a first pass over all pixels followed by passes that only sample pixels whose
+  /// relative error (see FilmPixel::relativeError) is still above error_threshold
+  /// \note Only films with FilmStorageMode::FULL storage that are not streamed can be refined
+  /// \param error_threshold (0 disables adaptive sampling)
+  /// \param max_pass_count maximum number of passes (including the first)
+  SamplerRenderer &withAdaptiveSampling(real_t error_threshold, u32 max_pass_count = 8) {
+    adaptive_error_threshold_ = error_threshold;
+    adaptive_max_pass_count_ = max_pass_count;
+    return *this;
+  }
+  // *******************************************************************************************************************
+  //                                                                                                   STATIC METHODS
+  // *******************************************************************************************************************
+  /// \param film
+  /// \return smallest band of rows a streamed film needs to be rendered (see FilmImage::streamTo)
+  static int minResidentRowCount(const Film &film) {
+    return film.footprintRowCount(super_tile_size * RenderInfo::default_tile_size);
+  }
+  // *******************************************************************************************************************
   //                                                                                                          METHODS
   // *******************************************************************************************************************
+  /// Renders with a jittered 2x2 StratifiedSampler
   template<typename CameraType, class IntegratorType>
-  void render(const CameraType &camera,
-              FilmImage &film_image,
-              const IntegratorType &integrator,
-              const Scene::View &scene) {
+  HeResult render(const CameraType &camera,
+                  FilmImage &film_image,
+                  const IntegratorType &integrator,
+                  const Scene::View &scene) {
+    return render(camera, film_image, integrator, scene, StratifiedSampler(hermes::size2(2, 2), true));
+  }
+  /// \tparam SamplerType must provide setPass, startPixel, cameraSample, get1D, get2D, startNextSample and
+  /// samplesPerPixel (see StratifiedSampler)
+  /// \return INVALID_INPUT if a streamed film keeps less than minResidentRowCount rows or already holds samples
+  template<typename CameraType, class IntegratorType, class SamplerType>
+  HeResult render(const CameraType &camera,
+                  FilmImage &film_image,
+                  const IntegratorType &integrator,
+                  const Scene::View &scene,
+                  const SamplerType &sampler) {
     using namespace hermes;
 
+    // a row of super tiles must fit in the resident band of streamed films
+    if (film_image.isStreamed() && film_image.residentRowCount() < minResidentRowCount(film_image.film())) {
+      Log::error("Streamed film keeps {} rows, rendering needs at least {}",
+                 film_image.residentRowCount(), minResidentRowCount(film_image.film()));
+      return HeResult::INVALID_INPUT;
+    }
+    // rows already written to the stream file can not receive samples anymore
+    if (film_image.isStreamed() && (film_image.firstResidentRow() != film_image.film().cropped_pixel_bounds.lower().j
+        || film_image.hasContributions())) {
+      Log::error("Streamed film already holds samples, call streamTo again before rendering");
+      return HeResult::INVALID_INPUT;
+    }
+
     Log::info("Preparing render");
 
     // Compute image sample bounds
@@ -170,55 +278,85 @@ public:
     Log::info("Total number of tiles: {}", render_info.n_tiles.total());
     Log::info("Total number of pixels: {}", render_info.pixel_bounds.area());
 
-    // Configure Sampling
-    StratifiedSampler sampler(size2(2, 2), true, 3);
+    Log::info("Samples per pixel: {}", sampler.samplesPerPixel());
 
     // group tiles in super tiles (large image regions) and render regions sequentially
-    size2 super_tile_size(3, 3);
-    size2 super_tile_pixel_size = super_tile_size * render_info.tile_size;
+    size2 super_tile_pixel_size = size2(super_tile_size, super_tile_size) * render_info.tile_size;
     auto sample_extent = sample_bounds.upper() - sample_bounds.lower();
     size2 n_super_tiles((sample_extent.i + super_tile_pixel_size.width - 1) / super_tile_pixel_size.width,
                         (sample_extent.j + super_tile_pixel_size.height - 1) / super_tile_pixel_size.height);
 
     Log::info("Splitting image into {} regions of {} x {} tiles",
               n_super_tiles.total(),
-              super_tile_size.width,
-              super_tile_size.height);
-
-    // Prepare memory resources, device memory contains all memory used by the renderer following the layout:
-    // < samples >
-    size_t device_memory_size = 0;
-    device_memory_size += sampler.memorySize() * super_tile_size.total();
-    Log::info("Allocating device memory: {} bytes", device_memory_size);
-    DeviceMemory dm(device_memory_size);
-
-    sampler.setDataPtr(dm.ptr());
-
-    for (auto tile_index : range2(n_super_tiles)) {
-      // compute super tile film region
-      range2 st_pixel_bounds(pixel_bounds_.lower() + index2(tile_index.i * super_tile_pixel_size.width,
-                                                            tile_index.j * super_tile_pixel_size.height),
-                             pixel_bounds_.lower() + index2(tile_index.i * super_tile_pixel_size.width,
-                                                            tile_index.j * super_tile_pixel_size.height)
-                                 + super_tile_pixel_size);
-      range2 st_sample_bounds(sample_bounds.lower() + index2(tile_index.i * super_tile_pixel_size.width,
-                                                             tile_index.j * super_tile_pixel_size.height),
-                              sample_bounds.lower() + index2(tile_index.i * super_tile_pixel_size.width,
-                                                             tile_index.j * super_tile_pixel_size.height)
-                                  + super_tile_pixel_size);
-      st_pixel_bounds = intersect(st_pixel_bounds, pixel_bounds_);
-      st_sample_bounds = intersect(st_sample_bounds, sample_bounds);
-      // prepare render info for super tile
-      RenderInfo super_tile_render_info(st_pixel_bounds, st_sample_bounds);
-      // render region
-      renderFilmRegion(camera, film_image, integrator, scene, sampler, dm, super_tile_render_info);
+              super_tile_size,
+              super_tile_size);
+
+    FilmTileBuffer film_tiles;
+    // one splat segment per render thread (threads never outnumber the tiles of a region)
+    film_image.prepareSplats(super_tile_size * super_tile_size);
+
+    // adaptive sampling needs the statistics of all pixels in memory
+    u32 pass_count = 1;
+    if (adaptive_error_threshold_ > 0) {
+      if (film_image.storageMode() == FilmStorageMode::FULL && !film_image.isStreamed())
+        pass_count = std::max(adaptive_max_pass_count_, 1u);
+      else
+        Log::warn("Adaptive sampling requires a resident FilmStorageMode::FULL film, rendering a single pass");
     }
+    DeviceArray<u8> pixel_mask;
+
+    for (u32 pass = 0; pass < pass_count; ++pass) {
+      if (pass) {
+        auto active_pixel_count = film_image.refinementMask(pixel_bounds_, adaptive_error_threshold_, pixel_mask);
+        Log::info("Sampling pass {}: {} pixels above error threshold", pass, active_pixel_count);
+        if (!active_pixel_count)
+          break;
+      }
+      // super tiles are rendered row by row, so streamed films can release rows as soon as they are done
+      for (int super_tile_row = 0; super_tile_row < n_super_tiles.height; ++super_tile_row) {
+        for (int super_tile_column = 0; super_tile_column < n_super_tiles.width; ++super_tile_column) {
+          index2 tile_index(super_tile_column, super_tile_row);
+          // compute super tile film region
+          range2 st_pixel_bounds(pixel_bounds_.lower() + index2(tile_index.i * super_tile_pixel_size.width,
+                                                                tile_index.j * super_tile_pixel_size.height),
+                                 pixel_bounds_.lower() + index2(tile_index.i * super_tile_pixel_size.width,
+                                                                tile_index.j * super_tile_pixel_size.height)
+                                     + super_tile_pixel_size);
+          range2 st_sample_bounds(sample_bounds.lower() + index2(tile_index.i * super_tile_pixel_size.width,
+                                                                 tile_index.j * super_tile_pixel_size.height),
+                                  sample_bounds.lower() + index2(tile_index.i * super_tile_pixel_size.width,
+                                                                 tile_index.j * super_tile_pixel_size.height)
+                                      + super_tile_pixel_size);
+          st_pixel_bounds = intersect(st_pixel_bounds, pixel_bounds_);
+          st_sample_bounds = intersect(st_sample_bounds, sample_bounds);
+          // prepare render info for super tile
+          RenderInfo super_tile_render_info(st_pixel_bounds, st_sample_bounds);
+          super_tile_render_info.pass = pass;
+          if (thread_count_)
+            super_tile_render_info.thread_count = std::min(thread_count_, super_tile_render_info.thread_count);
+          if (pass) {
+            super_tile_render_info.pixel_mask = pixel_mask.data();
+            super_tile_render_info.mask_bounds = pixel_bounds_;
+          }
+          // render region
+          renderFilmRegion(camera, film_image, integrator, scene, sampler, film_tiles, super_tile_render_info);
+        }
+        // reduce splats buffered by the integrator (if any) before rows get released
+        film_image.mergeSplats();
+        // pixels above the footprint of the next super tile row will not receive any more samples
+        if (super_tile_row + 1 < n_super_tiles.height) {
+          range2 remaining_sample_bounds(
+              sample_bounds.lower() + index2(0, (super_tile_row + 1) * super_tile_pixel_size.height),
+              sample_bounds.upper());
+          film_image.finishRows(film_image.film().filmTileBounds(remaining_sample_bounds).lower().j);
+        }
+      }
+    }
+    return film_image.finishRows(film_image.film().cropped_pixel_bounds.upper().j);
   }
 
 #ifdef HELIOS_DEBUG_DATA
   RenderInfo debug_render_info;
-  SamplePool debug_pool;
-  hermes::DeviceMemory debug_samples;
   hermes::DeviceMemory debug_data;
   hermes::DeviceArray<RayDifferential> debug_rays;
 #endif
@@ -231,7 +369,7 @@ private:
                         const IntegratorType &integrator,
                         const Scene::View &scene,
                         const Sampler &sampler,
-                        const hermes::DeviceMemory &dm,
+                        FilmTileBuffer &film_tiles,
                         const RenderInfo &render_info) {
     using namespace hermes;
 
@@ -247,27 +385,42 @@ private:
 #endif
     HERMES_LOG_VARIABLE(render_info.n_tiles)
 
+    // Tiles accumulate into private slots that are reduced once all tiles are done
+    // (compact film pixels can only be merged this way)
+    FilmTileBuffer::View film_tiles_view;
+    if (merge_mode_ == FilmMergeMode::DETERMINISTIC || film_image.storageMode() == FilmStorageMode::COMPACT) {
+      film_tiles.resize(film_image.film(), render_info.sample_bounds, render_info.n_tiles, render_info.tile_size);
+      film_tiles_view = film_tiles.view();
+    }
+
     // Render tiles in parallel
     f32 elapsed_time = 0;
-    HERMES_CUDA_TIME(HERMES_CUDA_LAUNCH_AND_SYNC((render_info.n_tiles),
+    HERMES_CUDA_TIME(HERMES_CUDA_LAUNCH_AND_SYNC((render_info.thread_count),
                                                  render_k,
                                                  render_info,
                                                  camera,
                                                  scene,
                                                  sampler,
                                                  film_image.view(),
+                                                 film_tiles_view,
                                                  integrator,
                                                  ddata), elapsed_time);
     HERMES_LOG_VARIABLE(elapsed_time)
 
+    if (film_tiles_view)
+      film_image.mergeFilmTiles(film_tiles);
+
 #ifdef HELIOS_DEBUG_DATA
     debug_render_info = render_info;
-    debug_samples = dm;
-    debug_pool = sampler.samplePool();
 #endif
   }
 
+  static constexpr u32 super_tile_size = 3;   //!< number of tiles along each side of a super tile (render region)
   const hermes::range2 pixel_bounds_;
+  FilmMergeMode merge_mode_{FilmMergeMode::ATOMIC};
+  u32 thread_count_{0};
+  real_t adaptive_error_threshold_{0};
+  u32 adaptive_max_pass_count_{1};
 };
 
 }
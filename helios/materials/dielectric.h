@@ -50,9 +50,11 @@ public:
   /// \param remap_roughness
   HERMES_DEVICE_CALLABLE DielectricMaterial(Spectrum eta, bool remap_roughness) : remap_roughness_(remap_roughness),
                                                                                   eta_(eta) {}
-  template<typename Allocator, typename TextureEvaluator>
-  HERMES_DEVICE_CALLABLE BxDF bxdf(Allocator allocator, /*TextureEvaluator tex_ctx, MaterialEvalContext mat_ctx,*/
-                                   SampledWaveLengths &lambda) const {
+  /// Evaluates the material into a BxDF value, without allocating memory
+  /// \param lambda sampled wavelengths (secondary wavelengths are terminated if eta varies with wavelength)
+  /// \return
+  HERMES_DEVICE_CALLABLE DielectricBxDF bxdf(/*TextureEvaluator tex_ctx, MaterialEvalContext mat_ctx,*/
+                                             SampledWaveLengths &lambda) const {
     // Compute index of refraction for dielectric material
     real_t sampledEta = 0;
     CAST_CONST_SPECTRUM(eta_, ptr, sampledEta = (*ptr)(lambda[0]);)
@@ -74,7 +76,16 @@ public:
     TrowbridgeReitzDistribution distrib(urough, vrough);
 
     // Return BSDF for dielectric material
-    return BxDFs::create<DielectricBxDF>(allocator, sampledEta, distrib);
+    return {sampledEta, distrib};
+  }
+  /// Evaluates the material into a BxDF allocated with the given allocator
+  /// \tparam Allocator
+  /// \param allocator
+  /// \param lambda
+  /// \return
+  template<typename Allocator>
+  HERMES_DEVICE_CALLABLE BxDF bxdf(Allocator allocator, SampledWaveLengths &lambda) const {
+    return BxDFs::create<DielectricBxDF>(allocator, bxdf(lambda));
   }
 
 private:
@@ -0,0 +1,187 @@
+#include <helios/samplers/halton_sampler.h>
+#include <helios/common/hash.h>
+
+using namespace hermes;
+
+namespace helios {
+
+namespace halton {
+
+__constant__ Primes device_primes = primes;
+
+HERMES_DEVICE_CALLABLE real_t radicalInverse(u32 base, u64 a) {
+  const real_t inv_base = static_cast<real_t>(1) / base;
+  u64 reversed_digits = 0;
+  real_t inv_base_n = 1;
+  while (a) {
+    u64 next = a / base;
+    u64 digit = a - next * base;
+    reversed_digits = reversed_digits * base + digit;
+    inv_base_n *= inv_base;
+    a = next;
+  }
+  return fminf(reversed_digits * inv_base_n, Constants::one_minus_epsilon);
+}
+
+HERMES_DEVICE_CALLABLE real_t scrambledRadicalInverse(u32 base, const u16 *permutation, u64 a) {
+  const real_t inv_base = static_cast<real_t>(1) / base;
+  u64 reversed_digits = 0;
+  real_t inv_base_n = 1;
+  while (a) {
+    u64 next = a / base;
+    u64 digit = a - next * base;
+    reversed_digits = reversed_digits * base + permutation[digit];
+    inv_base_n *= inv_base;
+    a = next;
+  }
+  // the remaining (zero) digits all map to permutation[0], a geometric series
+  return fminf(inv_base_n * (reversed_digits + inv_base * permutation[0] / (1 - inv_base)),
+               Constants::one_minus_epsilon);
+}
+
+HERMES_DEVICE_CALLABLE u64 inverseRadicalInverse(u32 base, u64 inverse, u32 digit_count) {
+  u64 index = 0;
+  for (u32 i = 0; i < digit_count; ++i) {
+    u64 digit = inverse % base;
+    inverse /= base;
+    index = index * base + digit;
+  }
+  return index;
+}
+
+}
+
+namespace {
+
+/// \return x such that a * x = 1 (mod n)
+u64 multiplicativeInverse(i64 a, i64 n) {
+  // extended euclidean algorithm
+  i64 x = 1, y = 0, r0 = a, r1 = n;
+  while (r1) {
+    i64 q = r0 / r1;
+    i64 t = r0 - q * r1;
+    r0 = r1;
+    r1 = t;
+    t = x - q * y;
+    x = y;
+    y = t;
+  }
+  return static_cast<u64>(((x % n) + n) % n);
+}
+
+}
+
+// *********************************************************************************************************************
+//                                                                                                       Permutations
+// *********************************************************************************************************************
+HaltonSampler::Permutations::Permutations(u32 seed) {
+  host_data_.resize(halton::primes.permutation_offsets[halton::dimension_count]);
+  for (int d = 0; d < halton::dimension_count; ++d) {
+    u32 base = halton::primes.values[d];
+    u16 *permutation = host_data_.data() + halton::primes.permutation_offsets[d];
+    for (u32 i = 0; i < base; ++i)
+      permutation[i] = static_cast<u16>(i);
+    // Fisher-Yates shuffle driven by hashes, so tables only depend on the seed
+    for (u32 i = base - 1; i > 0; --i)
+      std::swap(permutation[i], permutation[hash::values(seed, d, i) % (i + 1)]);
+  }
+  device_data_ = host_data_;
+}
+
+std::size_t HaltonSampler::Permutations::memorySize() const {
+  return host_data_.size() * sizeof(u16);
+}
+
+// *********************************************************************************************************************
+//                                                                                                      HaltonSampler
+// *********************************************************************************************************************
+HaltonSampler::HaltonSampler(u32 samples_per_pixel, const size2 &resolution, const Permutations &permutations)
+    : samples_per_pixel_(samples_per_pixel ? samples_per_pixel : 1),
+      host_permutations_(permutations.host_data_.data()),
+      device_permutations_(permutations.device_data_.data()) {
+  // find radical inverse base scales and exponents that cover the sampling area
+  u32 extents[2] = {static_cast<u32>(resolution.width), static_cast<u32>(resolution.height)};
+  for (int i = 0; i < 2; ++i) {
+    u32 base = i == 0 ? 2 : 3;
+    u32 extent = extents[i] < halton::max_resolution ? extents[i] : halton::max_resolution;
+    while (base_scales_[i] < extent) {
+      base_scales_[i] *= base;
+      base_exponents_[i]++;
+    }
+  }
+  sample_stride_ = static_cast<u64>(base_scales_[0]) * base_scales_[1];
+  // chinese remainder theorem coefficients
+  mult_inverse_[0] = multiplicativeInverse(base_scales_[1], base_scales_[0]);
+  mult_inverse_[1] = multiplicativeInverse(base_scales_[0], base_scales_[1]);
+}
+
+HERMES_DEVICE_CALLABLE void HaltonSampler::setPass(u32 pass) {
+  pass_ = pass;
+}
+
+HERMES_DEVICE_CALLABLE void HaltonSampler::startPixel(const index2 &p) {
+  startPixelSample(p, 0);
+}
+
+HERMES_DEVICE_CALLABLE void HaltonSampler::startPixelSample(const index2 &p, u32 sample_index, u32 dimension) {
+  sample_index_ = sample_index;
+  dimension_ = dimension;
+  // the first base 2 and base 3 digits of a sample index select the pixel it falls into
+  pixel_offset_ = 0;
+  if (sample_stride_ > 1) {
+    const int m = halton::max_resolution;
+    u64 pm[2] = {static_cast<u64>(((p.i % m) + m) % m), static_cast<u64>(((p.j % m) + m) % m)};
+    for (int i = 0; i < 2; ++i) {
+      u64 dimension_offset = halton::inverseRadicalInverse(i == 0 ? 2 : 3, pm[i], base_exponents_[i]);
+      pixel_offset_ += dimension_offset * (sample_stride_ / base_scales_[i]) * mult_inverse_[i];
+    }
+    pixel_offset_ %= sample_stride_;
+  }
+}
+
+HERMES_DEVICE_CALLABLE real_t HaltonSampler::sampleDimension(u32 dimension) const {
+  u64 index = pixel_offset_ + (static_cast<u64>(pass_) * samples_per_pixel_ + sample_index_) * sample_stride_;
+  // the first two dimensions are offsets inside the pixel
+  if (dimension == 0)
+    return halton::radicalInverse(2, index >> base_exponents_[0]);
+  if (dimension == 1)
+    return halton::radicalInverse(3, index / base_scales_[1]);
+  if (dimension >= halton::dimension_count)
+    dimension = 2 + (dimension - 2) % (halton::dimension_count - 2);
+#if defined(__CUDA_ARCH__) && __CUDA_ARCH__ > 0
+  const u16 *permutations = device_permutations_;
+#else
+  const u16 *permutations = host_permutations_;
+#endif
+  return halton::scrambledRadicalInverse(halton::prime(dimension),
+                                         permutations + halton::permutationOffset(dimension), index);
+}
+
+HERMES_DEVICE_CALLABLE real_t HaltonSampler::get1D() {
+  return sampleDimension(dimension_++);
+}
+
+HERMES_DEVICE_CALLABLE point2 HaltonSampler::get2D() {
+  point2 u(sampleDimension(dimension_), sampleDimension(dimension_ + 1));
+  dimension_ += 2;
+  return u;
+}
+
+HERMES_DEVICE_CALLABLE CameraSample HaltonSampler::cameraSample(const index2 &p) {
+  CameraSample cs;
+  cs.film = get2D() + vec2(p.i, p.j);
+  cs.time = get1D();
+  cs.lens = get2D();
+  return cs;
+}
+
+HERMES_DEVICE_CALLABLE bool HaltonSampler::startNextSample() {
+  dimension_ = 0;
+  return ++sample_index_ < samples_per_pixel_;
+}
+
+HERMES_DEVICE_CALLABLE u32 HaltonSampler::samplesPerPixel() const {
+  return samples_per_pixel_;
+}
+
+} // namespace helios
@@ -0,0 +1,181 @@
+/// Copyright (c) 2021, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+///\file halton_sampler.h
+///\author FilipeCN (filipedecn@gmail.com)
+///\date 2021-10-19
+///
+///\brief
+
+#ifndef HELIOS_SAMPLERS_HALTON_SAMPLER_H
+#define HELIOS_SAMPLERS_HALTON_SAMPLER_H
+
+#include <helios/core/camera.h>
+#include <hermes/storage/array.h>
+#include <vector>
+
+namespace helios {
+
+namespace halton {
+
+/// Number of dimensions with their own prime base (higher dimensions reuse bases)
+static constexpr int dimension_count = 64;
+/// Pixel coordinates are taken modulo this resolution when mapping pixels to sample indices
+static constexpr u32 max_resolution = 128;
+
+/// Prime bases and offsets of each base's permutation in the permutation table
+struct Primes {
+  u32 values[dimension_count];
+  u32 permutation_offsets[dimension_count + 1];
+};
+
+constexpr Primes buildPrimes() {
+  Primes primes{};
+  u32 offset = 0;
+  for (u32 d = 0, candidate = 2; d < dimension_count; ++candidate) {
+    bool is_prime = true;
+    for (u32 k = 2; k * k <= candidate && is_prime; ++k)
+      is_prime = candidate % k != 0;
+    if (!is_prime)
+      continue;
+    primes.values[d] = candidate;
+    primes.permutation_offsets[d++] = offset;
+    offset += candidate;
+  }
+  primes.permutation_offsets[dimension_count] = offset;
+  return primes;
+}
+
+/// Host copy of the prime table
+inline constexpr Primes primes = buildPrimes();
+/// Device copy of the prime table (constant memory)
+extern __constant__ Primes device_primes;
+
+/// \param dimension in [0, dimension_count)
+/// \return prime base of dimension
+HERMES_DEVICE_CALLABLE inline u32 prime(int dimension) {
+#if defined(__CUDA_ARCH__) && __CUDA_ARCH__ > 0
+  return device_primes.values[dimension];
+#else
+  return primes.values[dimension];
+#endif
+}
+
+/// \param dimension in [0, dimension_count)
+/// \return offset of the dimension's permutation in the permutation table
+HERMES_DEVICE_CALLABLE inline u32 permutationOffset(int dimension) {
+#if defined(__CUDA_ARCH__) && __CUDA_ARCH__ > 0
+  return device_primes.permutation_offsets[dimension];
+#else
+  return primes.permutation_offsets[dimension];
+#endif
+}
+
+/// Mirrors the base b digits of a around the radix point
+/// \param base
+/// \param a
+/// \return value in [0, 1)
+HERMES_DEVICE_CALLABLE real_t radicalInverse(u32 base, u64 a);
+/// Radical inverse with digits remapped by a permutation of {0, ..., base - 1}
+/// \note The permutation also applies to the infinite trailing zero digits of a
+/// \param base
+/// \param permutation
+/// \param a
+/// \return value in [0, 1)
+HERMES_DEVICE_CALLABLE real_t scrambledRadicalInverse(u32 base, const u16 *permutation, u64 a);
+/// Recovers the index whose radical inverse has the given (reversed) digits
+/// \param base
+/// \param inverse integer formed by the first digit_count digits of the radical inverse
+/// \param digit_count
+/// \return
+HERMES_DEVICE_CALLABLE u64 inverseRadicalInverse(u32 base, u64 inverse, u32 digit_count);
+
+}
+
+// *********************************************************************************************************************
+//                                                                                                      HaltonSampler
+// *********************************************************************************************************************
+/// Distributes the Halton sequence over the image. The first two dimensions (bases 2 and 3) are scaled so that
+/// each pixel owns a fixed residue class of sample indices, found in O(1) through the inverse radical inverse.
+/// Higher dimensions use randomly permuted digits to break the correlation between large prime bases.
+class HaltonSampler {
+public:
+  // *******************************************************************************************************************
+  //                                                                                                     Permutations
+  // *******************************************************************************************************************
+  /// Random digit permutations of all prime bases, built once and shared read-only by all sampler copies
+  /// \note Must outlive the samplers created from it
+  class Permutations {
+  public:
+    friend class HaltonSampler;
+    /// \param seed
+    explicit Permutations(u32 seed = 0);
+    /// \return table size in bytes
+    [[nodiscard]] std::size_t memorySize() const;
+
+  private:
+    std::vector<u16> host_data_;
+    hermes::DeviceArray<u16> device_data_;
+  };
+  // *******************************************************************************************************************
+  //                                                                                                     CONSTRUCTORS
+  // *******************************************************************************************************************
+  HaltonSampler() = default;
+  /// \param samples_per_pixel
+  /// \param resolution full image resolution
+  /// \param permutations digit permutations
+  HaltonSampler(u32 samples_per_pixel, const hermes::size2 &resolution, const Permutations &permutations);
+  // *******************************************************************************************************************
+  //                                                                                                          METHODS
+  // *******************************************************************************************************************
+  /// Later passes continue the sequence of each pixel (pass p starts at sample p * samplesPerPixel())
+  /// \param pass
+  HERMES_DEVICE_CALLABLE void setPass(u32 pass);
+  HERMES_DEVICE_CALLABLE void startPixel(const hermes::index2 &p);
+  /// \param p pixel coordinates
+  /// \param sample_index index of the sample inside the pixel
+  /// \param dimension first dimension to be generated
+  HERMES_DEVICE_CALLABLE void startPixelSample(const hermes::index2 &p, u32 sample_index, u32 dimension = 0);
+  HERMES_DEVICE_CALLABLE real_t get1D();
+  HERMES_DEVICE_CALLABLE hermes::point2 get2D();
+  [[nodiscard]] HERMES_DEVICE_CALLABLE CameraSample cameraSample(const hermes::index2 &p);
+  HERMES_DEVICE_CALLABLE bool startNextSample();
+  [[nodiscard]] HERMES_DEVICE_CALLABLE u32 samplesPerPixel() const;
+
+private:
+  [[nodiscard]] HERMES_DEVICE_CALLABLE real_t sampleDimension(u32 dimension) const;
+
+  u32 samples_per_pixel_{1};
+  u32 base_scales_[2]{1, 1};          //!< 2^j and 3^k, the smallest powers covering max_resolution
+  u32 base_exponents_[2]{0, 0};       //!< j and k
+  u64 sample_stride_{1};              //!< 2^j * 3^k, distance between consecutive samples of a pixel
+  u64 mult_inverse_[2]{0, 0};         //!< CRT coefficients
+  const u16 *host_permutations_{nullptr};
+  const u16 *device_permutations_{nullptr};
+  u32 pass_{0};
+  u64 pixel_offset_{0};               //!< index of the first sample of the current pixel
+  u32 sample_index_{0};
+  u32 dimension_{0};
+};
+
+} // namespace helios
+
+#endif // HELIOS_SAMPLERS_HALTON_SAMPLER_H
@@ -0,0 +1,75 @@
+#include <helios/samplers/pmj02_sampler.h>
+#include <helios/common/hash.h>
+#include <helios/samplers/sobol_matrices.h>
+
+using namespace hermes;
+
+namespace helios {
+
+namespace pmj02 {
+
+__constant__ Tables device_tables = tables;
+
+}
+
+HERMES_DEVICE_CALLABLE PMJ02Sampler::PMJ02Sampler(u32 samples_per_pixel, u32 seed)
+    : samples_per_pixel_(samples_per_pixel ? samples_per_pixel : 1), seed_(seed) {}
+
+HERMES_DEVICE_CALLABLE void PMJ02Sampler::setPass(u32 pass) {
+  pass_ = pass;
+}
+
+HERMES_DEVICE_CALLABLE void PMJ02Sampler::startPixel(const index2 &p) {
+  startPixelSample(p, 0);
+}
+
+HERMES_DEVICE_CALLABLE void PMJ02Sampler::startPixelSample(const index2 &p, u32 sample_index, u32 dimension) {
+  pixel_ = p;
+  sample_index_ = sample_index;
+  dimension_ = dimension;
+}
+
+HERMES_DEVICE_CALLABLE point2 PMJ02Sampler::samplePoint(u32 dimension) const {
+  u64 index = static_cast<u64>(pass_) * samples_per_pixel_ + sample_index_;
+  // each block of point_count samples draws a new set and shift
+  u64 bits = hash::values(pixel_.i, pixel_.j, dimension, seed_, index / pmj02::point_count);
+  // sample order is shuffled per dimension to decorrelate dimensions. Bit i of the index is only flipped
+  // depending on the bits above it, so aligned blocks of samples (and all power of two prefixes) stay nets
+  u32 order = sobol::owenScramble(static_cast<u32>(index % pmj02::point_count) << 24, static_cast<u32>(bits)) >> 24;
+  u32 point = pmj02::packedPoint((bits >> 8) % pmj02::set_count, order);
+  u32 shift = static_cast<u32>(bits >> 32);
+  u32 x = (point ^ shift) & 0xffff;
+  u32 y = ((point ^ shift) >> 16) & 0xffff;
+  // center of the 16 bit cell
+  return {(x + 0.5f) * 0x1p-16f, (y + 0.5f) * 0x1p-16f};
+}
+
+HERMES_DEVICE_CALLABLE real_t PMJ02Sampler::get1D() {
+  // 1D projections of (0,2)-sequences are (0,1)-sequences
+  return samplePoint(dimension_++).x;
+}
+
+HERMES_DEVICE_CALLABLE point2 PMJ02Sampler::get2D() {
+  point2 u = samplePoint(dimension_);
+  dimension_ += 2;
+  return u;
+}
+
+HERMES_DEVICE_CALLABLE CameraSample PMJ02Sampler::cameraSample(const index2 &p) {
+  CameraSample cs;
+  cs.film = get2D() + vec2(p.i, p.j);
+  cs.time = get1D();
+  cs.lens = get2D();
+  return cs;
+}
+
+HERMES_DEVICE_CALLABLE bool PMJ02Sampler::startNextSample() {
+  dimension_ = 0;
+  return ++sample_index_ < samples_per_pixel_;
+}
+
+HERMES_DEVICE_CALLABLE u32 PMJ02Sampler::samplesPerPixel() const {
+  return samples_per_pixel_;
+}
+
+} // namespace helios
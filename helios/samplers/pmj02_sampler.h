@@ -0,0 +1,86 @@
+/// Copyright (c) 2021, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+///\file pmj02_sampler.h
+///\author FilipeCN (filipedecn@gmail.com)
+///\date 2021-10-19
+///
+///\brief
+
+#ifndef HELIOS_SAMPLERS_PMJ02_SAMPLER_H
+#define HELIOS_SAMPLERS_PMJ02_SAMPLER_H
+
+#include <helios/samplers/pmj02_tables.h>
+#include <helios/core/camera.h>
+
+namespace helios {
+
+// *********************************************************************************************************************
+//                                                                                                      PMJ02Sampler
+// *********************************************************************************************************************
+/// Progressive multi-jittered (0,2) sampler. Samples of a pixel follow the order of a pre-generated PMJ02 set,
+/// so any power of two prefix of the samples is stratified in all elementary intervals and rendering can stop
+/// at any sample count. Sets are chosen by hashing (pixel, dimension) and randomized by a binary digital shift
+/// (a xor, which maps elementary intervals onto elementary intervals). Dimensions visit their sets in
+/// different (nested scrambled) orders that keep every aligned block of samples stratified.
+/// \note Stratification holds inside each block of pmj02::point_count samples.
+class PMJ02Sampler {
+public:
+  // *******************************************************************************************************************
+  //                                                                                                     CONSTRUCTORS
+  // *******************************************************************************************************************
+  PMJ02Sampler() = default;
+  /// \param samples_per_pixel
+  /// \param seed
+  HERMES_DEVICE_CALLABLE explicit PMJ02Sampler(u32 samples_per_pixel, u32 seed = 0);
+  // *******************************************************************************************************************
+  //                                                                                                          METHODS
+  // *******************************************************************************************************************
+  /// Later passes continue the sequence of each pixel (pass p starts at sample p * samplesPerPixel())
+  /// \param pass
+  HERMES_DEVICE_CALLABLE void setPass(u32 pass);
+  HERMES_DEVICE_CALLABLE void startPixel(const hermes::index2 &p);
+  /// \param p pixel coordinates
+  /// \param sample_index index of the sample inside the pixel
+  /// \param dimension first dimension to be generated
+  HERMES_DEVICE_CALLABLE void startPixelSample(const hermes::index2 &p, u32 sample_index, u32 dimension = 0);
+  HERMES_DEVICE_CALLABLE real_t get1D();
+  HERMES_DEVICE_CALLABLE hermes::point2 get2D();
+  [[nodiscard]] HERMES_DEVICE_CALLABLE CameraSample cameraSample(const hermes::index2 &p);
+  HERMES_DEVICE_CALLABLE bool startNextSample();
+  [[nodiscard]] HERMES_DEVICE_CALLABLE u32 samplesPerPixel() const;
+
+private:
+  /// \param dimension
+  /// \return randomized point of the set assigned to (pixel, dimension)
+  [[nodiscard]] HERMES_DEVICE_CALLABLE hermes::point2 samplePoint(u32 dimension) const;
+
+  u32 samples_per_pixel_{1};
+  u32 seed_{0};
+  u32 pass_{0};
+  hermes::index2 pixel_;
+  u32 sample_index_{0};
+  u32 dimension_{0};
+};
+
+} // namespace helios
+
+#endif // HELIOS_SAMPLERS_PMJ02_SAMPLER_H
@@ -0,0 +1,340 @@
+/// Copyright (c) 2021, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+///\file pmj02_tables.h
+///\author FilipeCN (filipedecn@gmail.com)
+///\date 2021-10-19
+///
+///\brief Pre-generated progressive multi-jittered (0,2) point sets
+
+#ifndef HELIOS_SAMPLERS_PMJ02_TABLES_H
+#define HELIOS_SAMPLERS_PMJ02_TABLES_H
+
+#include <hermes/common/defs.h>
+
+namespace helios::pmj02 {
+
+/// Number of independent point sets
+static constexpr int set_count = 8;
+/// Number of points of each set
+static constexpr int point_count = 256;
+
+/// Points are stored as 16 bit fixed point pairs (x in the low half, y in the high half)
+struct Tables {
+  u32 points[set_count][point_count];
+};
+
+/// Each set is a (0,2)-sequence in base 2: every prefix of 2^k points (and every aligned block of 2^k points)
+/// has exactly one point in each elementary interval of area 2^-k, which is the stratification of PMJ02 sets.
+/// \note Generated by tools/pmj02_tables.py: nested uniform (Owen) scrambling of the first two Sobol' dimensions
+/// \note over 16 digits (independent random trees per set and axis, seed 20211019), checked for the net property.
+/// \note Run it with --check on this file after any change.
+inline constexpr Tables tables = {{
+    {
+        0x930311a7, 0x2048d2e9, 0x54694688, 0xf5dab5d1, 0x0d2c26c4, 0xb505f27c, 0xcb1167c1, 0x64b28fd0,
+        0x78000f42, 0xdd13ce9a, 0xa38654f7, 0x1fabafc3, 0xe177378f, 0x4484e668, 0x3aba7c66, 0x826a99db,
+        0x2fc91968, 0x9aa3d8b3, 0xffaf4a05, 0x5b20b98e, 0xb994294b, 0x0637fdba, 0x69e96e7f, 0xc721840c,
+        0xd2210395, 0x7256c49d, 0x15025f0b, 0xad14a6c1, 0x4af5387c, 0xe9b4ef5e, 0x8f1c70c6, 0x308a93d1,
+        0x5ea915aa, 0xf8b9d45e, 0x9f83429d, 0x2a73b320, 0xc16c22a8, 0x6f33f45c, 0x01e46303, 0xbfd489b4,
+        0xaa140877, 0x10a1c992, 0x75e45207, 0xd6dcab1f, 0x3523300e, 0x8ae7e314, 0xee2d780d, 0x4fae9c62,
+        0xf38b1e32, 0x5372dc09, 0x25a64cac, 0x97ddbfbc, 0x60282e40, 0xcce1fb5c, 0xb24b6be8, 0x088082de,
+        0x19e50551, 0xa720c178, 0xd93d59b1, 0x7fbba22d, 0x86a73c13, 0x3c8ce8b0, 0x416c7626, 0xe4009783,
+        0x04401297, 0xbaf8d0e4, 0xc50e453c, 0x6ab5b62b, 0x99d725f4, 0x2d4df004, 0x584065d9, 0xfc9a8d5f,
+        0xeb6c0c87, 0x49adcca8, 0x32565672, 0x8de3adf4, 0x704c3516, 0xd112e4b1, 0xaf977e95, 0x16b99be4,
+        0xb69b1ba8, 0x0edcdbd5, 0x66684887, 0xc82abb9e, 0x22ab2b36, 0x90c9fefa, 0xf6626da2, 0x56b587d6,
+        0x47a80043, 0xe3cfc6fd, 0x80215dfc, 0x39d1a4bc, 0xdfd43b72, 0x7bc9ec03, 0x1d1c73b2, 0xa113916c,
+        0xcee41644, 0x630ed65f, 0x0b0341e5, 0xb01cb0e9, 0x51d32173, 0xf0a1f608, 0x94ec6023, 0x274a8a7e,
+        0x3f4f0b86, 0x85dccbc5, 0xe73f51cd, 0x42c6a896, 0xa5b6323b, 0x1a18e0a1, 0x7cad7ac1, 0xda3f9e6a,
+        0x6cb21cb8, 0xc2a6dec5, 0xbd364f32, 0x022abd64, 0xfa532cd8, 0x5c6ef819, 0x28356974, 0x9d498192,
+        0x881b06ec, 0x3786c21c, 0x4c345b48, 0xedbca069, 0x13573f06, 0xa9a5ebc1, 0xd435740a, 0x76b3956b,
+        0x7747107a, 0xd52ad3d5, 0xa80f47e9, 0x1210b432, 0xecd02784, 0x4d7ff3a4, 0x36946625, 0x89148e39,
+        0x9c490e22, 0x29afcf84, 0x5d5555bb, 0xfbbdae7a, 0x035b36fb, 0xbc55e752, 0xc3117d8d, 0x6da5988c,
+        0xdb611861, 0x7da3d93a, 0x1b414b57, 0xa490b8a1, 0x43cd28ca, 0xe687fc83, 0x84896f1b, 0x3e26853e,
+        0x26440268, 0x951bc5d0, 0xf13b5ea7, 0x5025a71c, 0xb1cb39d6, 0x0ac4ee5c, 0x62c771c6, 0xcf3992a7,
+        0xa0a614ba, 0x1c1fd52c, 0x7a7e43f7, 0xde7fb20d, 0x38db23cf, 0x8194f5b7, 0xe253625b, 0x466f88c2,
+        0x57fd0967, 0xf77ec8b1, 0x9163537c, 0x23afaa15, 0xc914311c, 0x6757e2d9, 0x0f8a79c6, 0xb7e39ded,
+        0x17e51f74, 0xae63dd51, 0xd0824ddf, 0x71bdbe94, 0x8cef2f85, 0x33effa90, 0x48736a2e, 0xeaee8356,
+        0xfd5d048f, 0x59d9c01d, 0x2c6458bc, 0x9883a361, 0x6bd03daf, 0xc4efe963, 0xbbad770a, 0x05bf96aa,
+        0xe53d13f4, 0x40e7d19c, 0x3dd94425, 0x87ebb795, 0x7e2a240f, 0xd8ccf165, 0xa6bb643a, 0x18978c0f,
+        0x094a0d36, 0xb32acd07, 0xcd6a57fd, 0x61ffacf1, 0x967c3494, 0x24d3e552, 0x52c07fd6, 0xf2da9a00,
+        0x4ec21a9c, 0xef0adaa0, 0x8be949c7, 0x347dba9e, 0xd7042ad2, 0x74a1ff94, 0x11416ca1, 0xab3486a9,
+        0xbed9014c, 0x0008c75c, 0x6e0b5ca0, 0xc084a5e9, 0x2b0c3aa9, 0x9ee9ed60, 0xf96f72ac, 0x5f19909d,
+        0x31af1739, 0x8e94d7ea, 0xe8a34079, 0x4bb6b1a4, 0xac8e20c1, 0x145ff706, 0x73d16120, 0xd3078bf1,
+        0xc6d10a5f, 0x6830cabe, 0x078050f1, 0xb857a979, 0x5aea3364, 0xfe9ae1b1, 0x9b677be0, 0x2ef09ff7,
+        0x83101dbc, 0x3b74dff0, 0x455a4ea6, 0xe0febcd9, 0x1e562d29, 0xa20ef92d, 0xdc9d6861, 0x79188025,
+        0x6566071a, 0xcab3c37e, 0xb4e75afe, 0x0cffa1ef, 0xf4183e2b, 0x5595ead8, 0x21a7758a, 0x9250946e,
+    },
+    {
+        0x656bb0c0, 0xc75e2178, 0x81cad9c0, 0x1e4f7e0c, 0xe1c588f9, 0x4e0f07bd, 0x2b2af7a4, 0xb8224852,
+        0xa0d8a670, 0x3319329d, 0x5e63c40e, 0xfaef6088, 0x05199c21, 0x91931040, 0xd559e8b5, 0x7b905dbc,
+        0xcfbbbcfd, 0x6efa2dcf, 0x1055d36a, 0x8a4b742e, 0x452983aa, 0xeddd0fe9, 0xb121f973, 0x262d4439,
+        0x3a15a962, 0xaf313a09, 0xf185cc61, 0x52406842, 0x9ff19520, 0x0db11df1, 0x75d4e383, 0xddd25693,
+        0x8f23b653, 0x161327ca, 0x6b4ddfc1, 0xc9167a7a, 0x23668def, 0xb44f02bd, 0xea91f00f, 0x42174e72,
+        0x5539a06f, 0xf51a3784, 0xab2fc080, 0x3d8a6596, 0xd8a79bf5, 0x714e17ac, 0x0a98ecba, 0x993859ca,
+        0x1ae6baa8, 0x87ce28a9, 0xc087d41d, 0x60b97099, 0xbfcc840e, 0x2e8e08ad, 0x4af0fe01, 0xe5df43b1,
+        0xfdb5af0f, 0x59b33eb9, 0x3694c9f7, 0xa4976cf5, 0x7e5393d2, 0xd3371bc0, 0x9743e766, 0x006a52c0,
+        0xee6ab39d, 0x46d222fd, 0x25e4dab8, 0xb3997d88, 0x6ca68b19, 0xcd8105d3, 0x8836f58e, 0x120e4adc,
+        0x0f9ca4df, 0x9de13038, 0xdf72c72f, 0x76b763ba, 0xadc49e16, 0x394d1365, 0x500feb6c, 0xf25c5e2f,
+        0x4c48be5b, 0xe3f42e47, 0xbac5d106, 0x29e077cc, 0xc5e08080, 0x67740d63, 0x1d1ffb75, 0x836f478e,
+        0x9375abff, 0x061f3875, 0x7857ceb0, 0xd7296aea, 0x319c9708, 0xa27d1e0b, 0xf834e046, 0x5d3d55ee,
+        0x2db4b406, 0xbc83251e, 0xe7fddc4c, 0x483c7945, 0x85848f68, 0x19f50016, 0x6292f3a7, 0xc3654cc4,
+        0xd1a3a3ab, 0x7d16353f, 0x02adc396, 0x95256765, 0x5bc4988f, 0xffb71533, 0xa709eee6, 0x342b5a3f,
+        0xb6deb989, 0x207c2ab0, 0x41efd6ff, 0xe8037353, 0x14758693, 0x8cb60bf7, 0xcb6afcf9, 0x68674169,
+        0x7297ad7b, 0xdb483dce, 0x9a41cba6, 0x087e6f71, 0xf6d09094, 0x578619d2, 0x3fbde52a, 0xa8fb51f1,
+        0xa94bb1c3, 0x3e38205c, 0x562dd880, 0xf7737fce, 0x096389a1, 0x9b4b06cb, 0xda55f6d2, 0x73fd4975,
+        0x692ca740, 0xcae133b3, 0x8d8fc57b, 0x1535618e, 0xe9859da9, 0x40ba11ee, 0x214de952, 0xb7cf5cc0,
+        0x3563bd01, 0xa6ae2c08, 0xfe75d2b2, 0x5afb7597, 0x94fd82c8, 0x03b10eef, 0x7c13f8d5, 0xd0ad4581,
+        0xc211a8ba, 0x636b3bc2, 0x18c8cd8c, 0x844f6946, 0x493c9477, 0xe6561cbb, 0xbd49e239, 0x2c00571e,
+        0x5ca7b71e, 0xf95426ea, 0xa364de14, 0x30227b93, 0xd63c8c10, 0x79ba0332, 0x0763f132, 0x92304fb6,
+        0x827ea10e, 0x1cf83646, 0x6690c1ab, 0xc49e643f, 0x288c9a48, 0xbb5316ef, 0xe2ebedcf, 0x4d23588c,
+        0xf33dbba8, 0x511b295a, 0x382bd5a9, 0xac7871fa, 0x77a585f8, 0xde7209ce, 0x9c7cff07, 0x0ead4270,
+        0x1313ae23, 0x899f3fc1, 0xccd7c8e3, 0x6d716d68, 0xb2f89223, 0x24991aa8, 0x4726e6ba, 0xefb753c7,
+        0x01a1b27f, 0x967823f5, 0xd2e4db65, 0x7f6e7c1d, 0xa5088af0, 0x377a04a0, 0x5880f42e, 0xfcbf4b0a,
+        0xe49da579, 0x4b373100, 0x2f52c66c, 0xbef162f5, 0x61d19fe9, 0xc1501275, 0x8632ea6c, 0x1bf35ff8,
+        0x9894bfd4, 0x0b612fde, 0x702fd09d, 0xd91b76c4, 0x3c0381df, 0xaa420cc4, 0xf45cfa5c, 0x54434684,
+        0x4333aa57, 0xeb993945, 0xb5a8cfc7, 0x22176b33, 0xc809966a, 0x6a031fdd, 0x17bae164, 0x8e2d54df,
+        0xdcdcb528, 0x74452418, 0x0c28dda6, 0x9ee3786c, 0x534c8e05, 0xf0fc01e6, 0xae71f2f4, 0x3b0f4da2,
+        0x2704a2a4, 0xb01e3470, 0xecc7c2a0, 0x4451660f, 0x8b0c9928, 0x11c714a6, 0x6f59efec, 0xce0a5be0,
+        0x7ac1b883, 0xd4632b17, 0x90b6d7d2, 0x04ab721e, 0xfbbb872d, 0x5f210a43, 0x32e5fd93, 0xa11f4010,
+        0xb9b5acf5, 0x2aa73c80, 0x4f21cafb, 0xe0656e91, 0x1fd99162, 0x80211899, 0xc6c2e4bc, 0x64985090,
+    },
+    {
+        0xdc2d5e7a, 0x38459755, 0x5c962d7a, 0x86d6e5dc, 0x019b62ad, 0xe77dbe18, 0xa9590471, 0x6634d46f,
+        0x74cd4cf7, 0xb8308408, 0xf9e33acc, 0x1f6ff7a3, 0x90cb7a09, 0x49f5aea9, 0x27f11d54, 0xc254cfce,
+        0x36a5570e, 0xd2159f41, 0x89fb217d, 0x562fef3c, 0xed126de7, 0x0f60b1a0, 0x69fb0e34, 0xa2c9df01,
+        0xb79f4140, 0x79a888e2, 0x13cf31ba, 0xf571f840, 0x414c75e2, 0x98f4a2d3, 0xc9ee13b7, 0x2bc6c01c,
+        0x534f59e4, 0x8ec390e0, 0xd68c2b87, 0x30fae020, 0xa745669c, 0x6dd7b85e, 0x09f902ea, 0xe8cbd247,
+        0xf32d4900, 0x16ee8178, 0x7d9b3eb7, 0xb0ddf07e, 0x2ff37f6a, 0xceb7ab24, 0x9ebf1928, 0x465dcb1e,
+        0x80ab5138, 0x5bcf988c, 0x3fca2698, 0xd95de884, 0x6215684f, 0xafc7b5ee, 0xe06608c3, 0x04dddb84,
+        0x1a2146e0, 0xfcd28e6f, 0xbc883405, 0x70b6fcf2, 0xc5707371, 0x2026a7be, 0x4c9f177d, 0x9581c565,
+        0x0c2e5ce7, 0xee5a94b6, 0xa0112f34, 0x6aa0e640, 0xd00d611d, 0x35f2bc98, 0x54ad0669, 0x8a60d6df,
+        0x9b3c4f43, 0x43c48642, 0x28843800, 0xcb4ef560, 0x7aa679b2, 0xb522acab, 0xf7fc1eab, 0x106dcdb2,
+        0xe5195413, 0x03bb9cd1, 0x64892213, 0xab55ed66, 0x3a4b6eee, 0xde79b3c2, 0x85430d7e, 0x5e23dc92,
+        0x4a2a4222, 0x93ef8bb5, 0xc1153347, 0x251afa1c, 0xbb0b76e9, 0x76d9a014, 0x1c9b11ce, 0xfb6dc2e6,
+        0xade75abe, 0x60cc9324, 0x07f1297e, 0xe234e339, 0x5987645e, 0x823fbb52, 0xdb150082, 0x3c87d0dd,
+        0x22254b4f, 0xc6ad8290, 0x97903c49, 0x4e7df3db, 0xffc47db3, 0x1830a9dd, 0x72411b75, 0xbe5cc89b,
+        0x6e265333, 0xa4449bec, 0xeb09257b, 0x0adfea18, 0x8d7d6a97, 0x5000b771, 0x33cd0b4d, 0xd441d9bd,
+        0xcd99455b, 0x2dcb8c0e, 0x450637bb, 0x9c8aff91, 0x1503703e, 0xf05fa413, 0xb3331524, 0x7fd2c7e9,
+        0x7e0a5fd2, 0xb2549662, 0xf1ae2c93, 0x14b8e464, 0x9d46630a, 0x44e3bf15, 0x2c6905c1, 0xccbed540,
+        0xd5eb4ded, 0x32ad8578, 0x51103b63, 0x8c97f654, 0x0b687bfb, 0xeabfafd1, 0xa5431c81, 0x6f8dce08,
+        0xbf465679, 0x73a29eb9, 0x19912063, 0xfec6ee5e, 0x4fea6c7b, 0x9680b028, 0xc7460f33, 0x23c7de6e,
+        0x3da540a6, 0xdaa68909, 0x83be3027, 0x58def99e, 0xe39674c3, 0x068aa3d5, 0x61eb12aa, 0xac57c181,
+        0xfa8b58b4, 0x1d89914d, 0x772b2a7f, 0xba69e120, 0x24be6764, 0xc0c3b901, 0x92b803d6, 0x4bf4d3fe,
+        0x5ffc48df, 0x84848097, 0xdf333f90, 0x3b75f177, 0xaaaf7e36, 0x65b1aa90, 0x027318f3, 0xe415ca7c,
+        0x11675033, 0xf6bb9930, 0xb4282782, 0x7bd6e961, 0xca2f6983, 0x298ab48a, 0x42e009e5, 0x9aa4da01,
+        0x8b4f4787, 0x554c8f2e, 0x344f35fc, 0xd1c4fd11, 0x6b7c7212, 0xa1cda6e0, 0xef9416cb, 0x0ddbc411,
+        0x949d5de0, 0x4db1957c, 0x213f2ecd, 0xc439e7c1, 0x714d60cd, 0xbd72bdbc, 0xfd0507aa, 0x1b8fd7a6,
+        0x053e4e2d, 0xe1b0874f, 0xae33392d, 0x6338f426, 0xd8867867, 0x3e1eadff, 0x5adc1fa7, 0x8164cc01,
+        0x47e955ea, 0x9f409dd7, 0xcfbc23ea, 0x2e27ec1a, 0xb1d06fcb, 0x7c1fb2f2, 0x17ac0c7c, 0xf2c4ddad,
+        0xe9da4391, 0x08a68a3e, 0x6c073248, 0xa6d6fb58, 0x312777cf, 0xd72fa18c, 0x8f1f10a9, 0x523ec3af,
+        0x2a575bc1, 0xc847921d, 0x99702810, 0x402ae23f, 0xf4376585, 0x128aba6e, 0x78770114, 0xb631d1f5,
+        0xa3c24a3d, 0x687f830e, 0x0e013d61, 0xecd1f210, 0x57467c43, 0x8812a8cd, 0xd3751a95, 0x375ac99b,
+        0xc31452ca, 0x26ff9a28, 0x4822245a, 0x91f3eb26, 0x1e226b51, 0xf880b61b, 0xb9a70a51, 0x7542d8e0,
+        0x67ad44c2, 0xa8348d20, 0xe65a361f, 0x00f0fe82, 0x873f71d6, 0x5d32a5c0, 0x395314d2, 0xdd68c6c8,
+    },
+    {
+        0x26139938, 0x9194280c, 0xd4e1f89b, 0x78227891, 0xa3b7a65f, 0x16441998, 0x4736d006, 0xf23c5e25,
+        0xec858c65, 0x558637b9, 0x0dcbe0c9, 0xbb7b6a8f, 0x6a6cb818, 0xc1d408fb, 0x8542cdd0, 0x339f4996,
+        0x9f379205, 0x28642006, 0x77aff365, 0xdfe47692, 0x1bc4a86c, 0xab30123e, 0xf9bfd925, 0x4a6152e0,
+        0x5f968717, 0xe79a38f3, 0xb009ea90, 0x01526189, 0xcb8eb116, 0x629701f7, 0x3e48c734, 0x8d644430,
+        0xd8169eff, 0x73812e5e, 0x2da7fe14, 0x99867fe4, 0x4e51a2f4, 0xfc511c53, 0xafedd72f, 0x1e7b5aa4,
+        0x07568813, 0xb5cf32a3, 0xe308e799, 0x59f96dd6, 0x8a8fbf08, 0x3b5b0c3b, 0x641ecb03, 0xccf94f11,
+        0x7c6897d6, 0xd302264c, 0x94b0f623, 0x225d739f, 0xf75aac2c, 0x422716d5, 0x12cedc5d, 0xa501572a,
+        0xbc4183ef, 0x0ac83ece, 0x5310edb2, 0xe9f0642b, 0x3525b4ce, 0x83c80416, 0xc725c180, 0x6e464349,
+        0xa9f99ab0, 0x193d2a9e, 0x49d3faf2, 0xfbee7bcb, 0x2a9da5eb, 0x9df91aa9, 0xdc49d246, 0x74d65d80,
+        0x61ad8e0b, 0xc9c1343f, 0x8f0ee39c, 0x3d97692c, 0xe5d9baf5, 0x5c020aa4, 0x0379ce24, 0xb2ae4ac9,
+        0x14f291f2, 0xa08623b6, 0xf0b6f008, 0x44837558, 0x9377aa87, 0x24e1101a, 0x7a41da6e, 0xd60850b9,
+        0xc2638495, 0x69063ba5, 0x31a1e913, 0x8792624a, 0x57c9b20c, 0xefb103a2, 0xb9d6c514, 0x0f59465f,
+        0x41d99ca1, 0xf4482c0a, 0xa6bffd01, 0x11eb7ccc, 0xd169a042, 0x7f191fb2, 0x2035d4bb, 0x96875888,
+        0x80e28b4c, 0x3625301f, 0x6d89e522, 0xc4a96f21, 0x08edbc08, 0xbefc0f7c, 0xeae8c856, 0x50634c31,
+        0xffaf9406, 0x4def25de, 0x1ce4f590, 0xacc270eb, 0x7074afd2, 0xdaf3142c, 0x9b06df3b, 0x2e975579,
+        0x38ea8111, 0x88c83da5, 0xcef8eec0, 0x66ef676e, 0xb665b659, 0x05e106d9, 0x5b55c3cf, 0xe1184062,
+        0xe0529850, 0x5a382941, 0x04c5f959, 0xb770794a, 0x674ca7ff, 0xcf69181d, 0x898bd1ff, 0x39c85f19,
+        0x2f158db4, 0x9af136a3, 0xdbb8e159, 0x71f46b75, 0xad70b994, 0x1dbc09f3, 0x4c7acc9e, 0xfef948f3,
+        0x51e293ff, 0xeb4b21c0, 0xbf8bf20b, 0x09957758, 0xc54ca93e, 0x6cf8130d, 0x371bd887, 0x814d53dd,
+        0x97f5864e, 0x216539aa, 0x7e31eb3d, 0xd01e608b, 0x10c1b054, 0xa75c00c6, 0xf563c603, 0x409345a4,
+        0x0e819fa9, 0xb8662fb4, 0xee47ff7d, 0x567a7e75, 0x86c2a396, 0x30e61db1, 0x683ad69e, 0xc3ec5b16,
+        0xd79f8909, 0x7ba233fe, 0x25dee62c, 0x92bd6cb5, 0x45e7be70, 0xf14e0d59, 0xa18ecac4, 0x15c64e2d,
+        0xb3869659, 0x02102715, 0x5d94f7fe, 0xe4c57275, 0x3cf8ad32, 0x8ea0172a, 0xc8addd6a, 0x60765689,
+        0x758182f0, 0xdd293fbc, 0x9ce9ec42, 0x2b3665b9, 0xfa13b557, 0x4835050a, 0x1859c0aa, 0xa8f74232,
+        0x6fa69b96, 0xc67d2b6e, 0x82f8fb01, 0x340e7a12, 0xe89aa403, 0x52c71b6a, 0x0b5dd3d7, 0xbd755ce1,
+        0xa4b38f41, 0x13943560, 0x43f5e245, 0xf6c96835, 0x2340bb78, 0x95a50bf4, 0xd255cfb7, 0x7d014baa,
+        0xcdfa9055, 0x654722d1, 0x3ae3f139, 0x8bd374d5, 0x589dabf9, 0xe27d1190, 0xb46edbfe, 0x06b25114,
+        0x1f3b85e7, 0xaeb13a68, 0xfde4e8d1, 0x4f326345, 0x9860b32b, 0x2c91029d, 0x7208c41c, 0xd94a4766,
+        0x8c9e9d66, 0x3f3a2d72, 0x63fdfcdf, 0xcacb7d8d, 0x006ba138, 0xb19e1ed1, 0xe653d566, 0x5e115900,
+        0x4b608a26, 0xf89b31da, 0xaadde43c, 0x1af36e87, 0xdeacbda6, 0x766a0e28, 0x2949c9d0, 0x9eba4d82,
+        0x320e95d5, 0x84e224c3, 0xc0bff499, 0x6bab71ef, 0xbad3aecc, 0x0c8815ed, 0x5474dece, 0xedba547f,
+        0xf39e805e, 0x46b03cb5, 0x17efef06, 0xa2e566db, 0x79bdb7fd, 0xd5dc07c5, 0x90c1c2e2, 0x2706410b,
+    },
+    {
+        0x041ad66a, 0x90687b51, 0xc3ffb4ac, 0x7cf33d8a, 0xa094f952, 0x26f2517c, 0x55b28cf6, 0xf793182a,
+        0xe63ecb91, 0x46696d7c, 0x3817a555, 0xb8062bb0, 0x62d7e70d, 0xd48245ec, 0x818a9597, 0x18440fe6,
+        0x9feadbf3, 0x08357247, 0x7054bdaa, 0xc8ee335c, 0x2a8cf5f6, 0xa9ad5c14, 0xfadb81f1, 0x591f14ce,
+        0x4a8ec2ee, 0xebfd643e, 0xb593ab2b, 0x311d2578, 0xdc55ef77, 0x68e3483c, 0x131e9853, 0x8b6a0483,
+        0xcdbfd329, 0x76e77dcd, 0x0e78b3bb, 0x994e3ac4, 0x5f8afd2a, 0xfd6e56ba, 0xafec8a6b, 0x2fbc1e38,
+        0x35a9cf91, 0xb0b56906, 0xef12a193, 0x4f022ea9, 0x8d94e198, 0x1613434c, 0x6cce9078, 0xd98209d8,
+        0x794cdfdc, 0xc650773a, 0x94c5b935, 0x01db3783, 0xf3e9f1da, 0x53f55b1c, 0x21f38633, 0xa7b5105a,
+        0xbc47c53a, 0x3dbb61cf, 0x41e3ad77, 0xe01e235d, 0x1d8debaf, 0x87db4e4d, 0xd0df9c8d, 0x66510063,
+        0xab43d582, 0x29757834, 0x5a78b6fe, 0xf9613e8f, 0x0a11fba2, 0x9ce1529c, 0xca378f7e, 0x73ef1b6a,
+        0x6a39c84b, 0xde2d6ed6, 0x89fca642, 0x11122887, 0xe9bfe599, 0x4992471e, 0x325f9639, 0xb7970c20,
+        0x24c3d81c, 0xa37070c6, 0xf5c8be22, 0x5774313c, 0x93d6f72c, 0x065d5f9a, 0x7f3382e4, 0xc0d516ee,
+        0xd6c9c0d7, 0x609e67c9, 0x1a9ba8eb, 0x82a927f4, 0x442dec50, 0xe5444a25, 0xbb8f9a40, 0x3afa064a,
+        0x5131d02a, 0xf07b7e24, 0xa465b1a0, 0x23ff383a, 0xc4cefe8b, 0x7a875411, 0x028a88f7, 0x97f31d93,
+        0x853bcce2, 0x1ec66beb, 0x658aa323, 0xd2b62cc8, 0x3f57e20d, 0xbf6d41b1, 0xe22393aa, 0x43c90aa4,
+        0xff67dd79, 0x5cc0750f, 0x2d6dbad1, 0xac043456, 0x75fdf247, 0xce6a5998, 0x9a2c844b, 0x0c5d1399,
+        0x1498c793, 0x8e776338, 0xdab1aeef, 0x6e132073, 0xb20be8c1, 0x36f94d12, 0x4c799f2d, 0xed790281,
+        0xec8cd79d, 0x4d127ab8, 0x3783b58c, 0xb3073c5f, 0x6f86f8e8, 0xdb0350f7, 0x8f308d53, 0x15c11960,
+        0x0d67ca71, 0x9b516c2c, 0xcffea450, 0x740e2a88, 0xad3fe6cc, 0x2c7944ed, 0x5dd99421, 0xfe690ef2,
+        0x4248da82, 0xe3cc73cd, 0xbe56bc11, 0x3e1f3240, 0xd32df4f3, 0x64305d0a, 0x1f4f8096, 0x84bd1554,
+        0x9601c343, 0x0370659a, 0x7b66aa93, 0xc51924ac, 0x222cee34, 0xa53149b2, 0xf1ff99cd, 0x50ae0578,
+        0x3b54d2de, 0xba9a7cea, 0xe4bfb2c3, 0x45da3bf7, 0x835dfcf7, 0x1b6e57f9, 0x61658bf9, 0xd77b1fa7,
+        0xc122ce78, 0x7e51685e, 0x07e4a02a, 0x92812fe2, 0x569be050, 0xf4214236, 0xa2ae9167, 0x25d1088c,
+        0xb6bede14, 0x33737623, 0x4818b83c, 0xe89e364a, 0x1092f0ff, 0x88bf5a99, 0xdfed877e, 0x6b5911e0,
+        0x726ac433, 0xcb126058, 0x9dd6acfd, 0x0bf422e3, 0xf82beae7, 0x5b614f78, 0x287d9db8, 0xaaf3016f,
+        0x67dcd466, 0xd16279d8, 0x8604b7f4, 0x1cb23f03, 0xe142fa33, 0x404d536c, 0x3c948e1a, 0xbd811a40,
+        0xa6dbc90e, 0x20ea6ffa, 0x52e5a7c6, 0xf21e2916, 0x00f4e49e, 0x95b746dd, 0xc7b29755, 0x783a0d3e,
+        0xd859d9ab, 0x6d7d716c, 0x170dbfbd, 0x8c4730da, 0x4e0ef6d1, 0xeead5ee3, 0xb1038344, 0x348a177c,
+        0x2ee6c126, 0xae406649, 0xfceea991, 0x5ef9267d, 0x9887ede6, 0x0f024b9e, 0x77079b51, 0xcc8b0702,
+        0x8ae5d1fa, 0x12617fde, 0x69e5b088, 0xdd293930, 0x3002ff91, 0xb43955a8, 0xeaba893c, 0x4b4f1cbc,
+        0x5823cd32, 0xfb5a6aa9, 0xa808a260, 0x2bab2d40, 0xc98fe31b, 0x714e407e, 0x094f92f5, 0x9e210bda,
+        0x1985dcc4, 0x80b574d6, 0xd55abb03, 0x636f3559, 0xb90af39c, 0x398958e2, 0x47c98524, 0xe76b1238,
+        0xf639c6f9, 0x54ff6237, 0x2752afe3, 0xa1542181, 0x7d9fe9e3, 0xc2b14c0f, 0x91c09e40, 0x051303aa,
+    },
+    {
+        0xfc4a94c9, 0x7c42035d, 0x3413d4fb, 0xa3fa6c60, 0x5b7bbf55, 0xd8183f36, 0x80ffe714, 0x1489459f,
+        0x0f0d82b0, 0x92421e51, 0xc85ec054, 0x449774e7, 0xba82a256, 0x2de12bcb, 0x666df485, 0xe4f553ed,
+        0x72989908, 0xf09e0b64, 0xaa44db10, 0x385961bd, 0xd19cb373, 0x54d831ad, 0x185eeb16, 0x89d24871,
+        0x9a278e8d, 0x04de159d, 0x4f43c91d, 0xc3217e52, 0x263faae9, 0xb73720e5, 0xe975fc68, 0x6be45ddf,
+        0x3cd79296, 0xafe506e9, 0xf57fd327, 0x770b6a66, 0x8fcfb935, 0x1e6d3b98, 0x516ee00e, 0xd5ad4107,
+        0xc695853f, 0x4b4d190c, 0x02e5c64b, 0x9e11712d, 0x6f3fa4b5, 0xedbf2d7d, 0xb019f1c1, 0x21d45462,
+        0xa42f9f78, 0x32f00eb2, 0x792add99, 0xfb766623, 0x132fb6a6, 0x84833687, 0xdc19ec29, 0x5c6e4d9d,
+        0x43c389db, 0xcde01327, 0x9403cdf6, 0x0bd87824, 0xe2eeaebf, 0x62bc2769, 0x2b54f87e, 0xbf9e5b73,
+        0x57929611, 0xd30b00f6, 0x8aa9d71a, 0x1a726f09, 0xf39cbde9, 0x702c3cc6, 0x3a4de496, 0xa8004623,
+        0xb41680b2, 0x25281cc3, 0x69c7c327, 0xebd876a7, 0x07a9a0f2, 0x99412970, 0xc00af74f, 0x4cc2514d,
+        0xda619b85, 0x58580829, 0x1641d811, 0x824f63c3, 0x7ed6b0c8, 0xfff4328f, 0xa12de91c, 0x362f4a68,
+        0x2f6b8d55, 0xb9021769, 0xe6c0cb71, 0x64f47db8, 0x9077a81c, 0x0da52252, 0x47f2fec2, 0xca9e5e91,
+        0x862f90af, 0x10710567, 0x5f3fd063, 0xde5a686a, 0x3069bab5, 0xa71c39b5, 0xf900e202, 0x7b2d4239,
+        0x602487de, 0xe12e1b2c, 0xbc77c4cc, 0x28b872f5, 0xcf3fa723, 0x40622fc5, 0x09daf26a, 0x972d56a3,
+        0x1ddd9d6b, 0x8c2c0cc1, 0xd6b1de1c, 0x537e6479, 0xad03b5f5, 0x3f9d347d, 0x7425ee31, 0xf75d4eb6,
+        0xeeaa8bc9, 0x6cb91056, 0x2337ce75, 0xb2307a76, 0x4843ad4e, 0xc4a424e2, 0x9d15fbbc, 0x00a158b9,
+        0x018c952a, 0x9c590227, 0xc590d526, 0x49e16d59, 0xb3fdbef7, 0x22053ea4, 0x6d1ae646, 0xef3f44d8,
+        0xf6ae8339, 0x754f1fbc, 0x3effc1b4, 0xac387556, 0x5218a31d, 0xd7812a69, 0x8d0ff5d3, 0x1c0852fb,
+        0x969d9800, 0x08840ac7, 0x4158da03, 0xcef560aa, 0x2998b233, 0xbd8d302d, 0xe02bea74, 0x61484942,
+        0x7a228f09, 0xf8f01473, 0xa6f8c8fd, 0x31b57f36, 0xdf3aab87, 0x5e742186, 0x1187fdd4, 0x87375c15,
+        0xcb4d9379, 0x46520733, 0x0cbfd219, 0x91dc6b5f, 0x65afb8ed, 0xe7a03aaf, 0xb8f9e1bf, 0x2e8b4066,
+        0x375884bb, 0xa07818b9, 0xfedcc7d2, 0x7f2670d1, 0x833ea55c, 0x17852cbe, 0x59e2f01a, 0xdb755569,
+        0x4d6b9edc, 0xc1580fad, 0x98cddc77, 0x06746798, 0xeabcb73f, 0x680d37ef, 0x24ffeda1, 0xb5464c32,
+        0xa9a18873, 0x3b111291, 0x713ecc7a, 0xf21c79a0, 0x1bd4af99, 0x8b9d26e4, 0xd26af904, 0x56dc5a7d,
+        0xbe0497e0, 0x2a400196, 0x636cd662, 0xe39a6e3c, 0x0a20bc4a, 0x95913d4a, 0xcce8e552, 0x421e4704,
+        0x5d278185, 0xdd3e1dea, 0x85a2c223, 0x12cd7729, 0xfa75a1ae, 0x78cf281e, 0x33c7f686, 0xa56150a1,
+        0x20ac9ada, 0xb15b09b7, 0xec3cd91d, 0x6e396203, 0x9f2eb155, 0x03c533e6, 0x4a6ce804, 0xc7034beb,
+        0xd4c78cc4, 0x5070161f, 0x1f55cade, 0x8e137cc0, 0x761ea97e, 0xf45723ac, 0xae27fffd, 0x3d845f80,
+        0x6a8d9107, 0xe8a10473, 0xb6afd11a, 0x27746940, 0xc269bb25, 0x4e0b3808, 0x050ee3b3, 0x9bfa4307,
+        0x88a6867d, 0x19b01a33, 0x5540c535, 0xd0b57386, 0x39f6a66f, 0xab432eaa, 0xf1c5f3bc, 0x73d857b6,
+        0xe5449c24, 0x67090d6d, 0x2cf1df2a, 0xbb1e6563, 0x45efb46e, 0xc9793510, 0x93b8ef69, 0x0e494ff0,
+        0x15598a29, 0x81651109, 0xd97acfbb, 0x5a7c7bfb, 0xa24fac73, 0x3570252a, 0x7dfffa0f, 0xfd3a59e0,
+    },
+    {
+        0xffb3835c, 0x452047f7, 0x0e7fe8fd, 0x8f763372, 0x7d76bb9c, 0xce9570de, 0xad3ec658, 0x39c10307,
+        0x29d29237, 0xb58155e9, 0xdd96f5ab, 0x6a3323ce, 0x9cc4aeaf, 0x1b156d39, 0x5b9bd2bd, 0xe58318e5,
+        0x48358ddb, 0xf2c549df, 0x84a2e243, 0x01073ea1, 0xc4c1b6f1, 0x741d7fe4, 0x33e0caaa, 0xa6210ffb,
+        0xbff49f3e, 0x23795a67, 0x6732ff5a, 0xd03c29f8, 0x13ffa369, 0x922f64fa, 0xe84ddbe9, 0x52e51096,
+        0x05748467, 0x812a421f, 0xf4caed63, 0x4f0536ff, 0xa212be51, 0x361b7576, 0x73cac14d, 0xc3c30766,
+        0xd64995a6, 0x62b050f1, 0x2748f0dc, 0xb8422479, 0x5652a8c5, 0xec826bc6, 0x9410d733, 0x16871e30,
+        0x89268a4e, 0x0b584eef, 0x430ce466, 0xfa3c3a00, 0x3eabb1c1, 0xa97f79b3, 0xca11cd48, 0x79e70a3f,
+        0x6d429ac9, 0xd9455fb3, 0xb20ef9fd, 0x2ea52df2, 0xe317a7d8, 0x5cd56157, 0x1d9fde31, 0x98af1466,
+        0x776d81c6, 0xc6c5450a, 0xa539ea35, 0x303f3063, 0xf0f2b8f3, 0x4b567208, 0x0258c49c, 0x878000d6,
+        0x91ee9027, 0x110e5635, 0x50bff697, 0xeade20ec, 0x218dadfc, 0xbd2f6f5a, 0xd2c4d1b8, 0x64821aad,
+        0xcca08ec7, 0x7e9b4b07, 0x3a44e0ca, 0xae373ca2, 0x46d4b4d2, 0xfd387d9d, 0x8c92c838, 0x0dfc0da6,
+        0x18f39db0, 0x9eab589b, 0xe72dfd4a, 0x580a2a43, 0xb66fa044, 0x2b69676a, 0x6939d94e, 0xde7a12c0,
+        0xaa6286f1, 0x3d2840f4, 0x7ae7ef08, 0xc9cd356f, 0x0863bd04, 0x8a8b77a7, 0xf812c348, 0x416004ee,
+        0x5ee09783, 0xe0755383, 0x9a4af3a3, 0x1e94275c, 0xdbe2ab52, 0x6e9068ad, 0x2d81d5fc, 0xb1531c8c,
+        0x35108970, 0xa1b04ca5, 0xc008e6dc, 0x70c43893, 0x838bb256, 0x06b97b50, 0x4ccaced4, 0xf7e8094a,
+        0xee699806, 0x54e25d45, 0x1546fbaf, 0x97fe2f80, 0x6040a50b, 0xd59e6299, 0xbb0ddc91, 0x24571615,
+        0x25608246, 0xba3a46de, 0xd49fe9e3, 0x61953200, 0x9615ba1e, 0x14b271d3, 0x55c8c768, 0xefe30237,
+        0xf6dd93f8, 0x4d685498, 0x07f7f4d1, 0x8266221c, 0x71c4af6c, 0xc1a06cfb, 0xa0e4d332, 0x346c19d4,
+        0xb07b8c0d, 0x2cd948d2, 0x6f0be306, 0xdac63fe7, 0x1f92b793, 0x9b2c7e14, 0xe190cb79, 0x5fd00e20,
+        0x403a9e84, 0xf9915b96, 0x8b40fe20, 0x092028fe, 0xc824a2da, 0x7b936577, 0x3c36da6e, 0xab4e1138,
+        0xdfc98565, 0x68f24385, 0x2afbecc6, 0xb7da37ed, 0x597ebfd6, 0xe6697478, 0x9f4dc085, 0x19bf0632,
+        0x0c37947e, 0x8d235141, 0xfce3f16d, 0x4711253a, 0xaf05a929, 0x3b5d6a25, 0x7f89d6ba, 0xcdea1fc5,
+        0x656c8bc5, 0xd3e24fb8, 0xbc9be528, 0x200b3b6e, 0xeb7cb078, 0x51b178a4, 0x10cecc0d, 0x90400b23,
+        0x86609b60, 0x03635e7d, 0x4a4df8ea, 0xf1642c5d, 0x314aa691, 0xa4366064, 0xc7ccdfbe, 0x768c1563,
+        0x992f8097, 0x1c394497, 0x5db2eb1c, 0xe20531de, 0x2fa0b9b9, 0xb34073cf, 0xd8c3c52b, 0x6cc20129,
+        0x78ba919d, 0xcbc15798, 0xa870f72e, 0x3fae2123, 0xfb7cac84, 0x42b96e92, 0x0a3bd080, 0x88921bde,
+        0x178f8f1a, 0x95d84a0c, 0xeda7e14d, 0x571d3d20, 0xb939b55b, 0x26347ce8, 0x6387c909, 0xd78c0c71,
+        0xc2689c54, 0x72bf59d1, 0x370dfc35, 0xa3a82b6b, 0x4e61a1b6, 0xf52e661f, 0x8092d88d, 0x04e31368,
+        0x538887da, 0xe9af41c8, 0x93daee3c, 0x12fb347e, 0xd1f2bc2e, 0x668376a3, 0x225ac2d0, 0xbe3805cb,
+        0xa71a962d, 0x324c52d2, 0x75ddf288, 0xc57c26b0, 0x00d9aa3f, 0x855c69de, 0xf399d406, 0x49bb1d6d,
+        0xe48a8894, 0x5aa34d32, 0x1a55e70a, 0x9d8439c3, 0x6b89b313, 0xdccd7a2f, 0xb440cf37, 0x28d9087e,
+        0x38739959, 0xac3f5ce0, 0xcf74fac6, 0x7ce42ea3, 0x8e3ea491, 0x0fa76396, 0x44dbdd3a, 0xfe0e1747,
+    },
+    {
+        0xe5c21e77, 0x79b59601, 0x034e756b, 0x9a2ac732, 0x51442aef, 0xcd1aaa3b, 0xa5e757fb, 0x2a80e596,
+        0x3410063e, 0xbdaa8a0d, 0xd7116775, 0x474cd2b1, 0x875e3efb, 0x110cbe04, 0x6c0f4b40, 0xf12ff1ff,
+        0x748414c0, 0xec799ef3, 0x970b7959, 0x0ac8c979, 0xc6862028, 0x5f44a265, 0x20a459eb, 0xa8f6eb88,
+        0xb09b0925, 0x3e648759, 0x4b0b6a7a, 0xdc69db7d, 0x1fbe33f7, 0x8c92b159, 0xfffb44b5, 0x672ffeab,
+        0x0c601970, 0x915a9395, 0xea60739f, 0x7369c20e, 0xacda2d6b, 0x24b7acaa, 0x5ae15341, 0xc360e00c,
+        0xdb1b0120, 0x4daa8e8a, 0x39246106, 0xb7e6d4a5, 0x62fc3953, 0xfaa1bb1c, 0x8a374e0b, 0x1903f447,
+        0x9ff81182, 0x05c79820, 0x7e607e01, 0xe30acdcd, 0x2dd82604, 0xa2f1a442, 0xca9a5fe2, 0x55feed48,
+        0x42500f68, 0xd1d28206, 0xbbfa6e3a, 0x3097dcb4, 0xf4163691, 0x6bf4b402, 0x16e9407c, 0x832bfbb3,
+        0x5d781d1a, 0xc59b9432, 0xabbb7625, 0x23f9c570, 0xee0229ee, 0x76e1a809, 0x083355a3, 0x9518e771,
+        0x8f75052f, 0x1d42898e, 0x6445650a, 0xfdbad0ee, 0x3d1b3dd5, 0xb28dbce0, 0xdf5049e6, 0x492ff295,
+        0xcf971625, 0x52289c9d, 0x29797b0c, 0xa6eacba9, 0x7b182280, 0xe69aa194, 0x983a5be1, 0x0099e947,
+        0x12720bca, 0x845d857c, 0xf34c694d, 0x6fefd874, 0xbfa630d6, 0x3792b392, 0x456a46ad, 0xd589fce0,
+        0xa1e81a32, 0x2f839197, 0x57d271e6, 0xc8e8c0a7, 0x073b2e1c, 0x9d93aef9, 0xe0f8502e, 0x7d79e20e,
+        0x692a02dd, 0xf7e98c94, 0x81ce62df, 0x1509d758, 0xd2563ba3, 0x40e0b891, 0x338f4c01, 0xb8d3f705,
+        0x2701138f, 0xae6e9b77, 0xc1627c64, 0x596dcfa9, 0x933524b0, 0x0e10a7d8, 0x70975c1c, 0xe813eedb,
+        0xf9360c2e, 0x60a08140, 0x1b776cb0, 0x89e3dedd, 0x4e7a35a6, 0xd809b6aa, 0xb59e4386, 0x3af3f8c4,
+        0x3b611f38, 0xb423974c, 0xd95774c3, 0x4fb1c6cf, 0x882e2bbf, 0x1a2bab8b, 0x6162563e, 0xf805e4de,
+        0xe9a9074d, 0x71618b68, 0x0f0e666b, 0x9221d301, 0x58793fb2, 0xc0b6bf0b, 0xafec4ac8, 0x260ef061,
+        0xb9c2150f, 0x32749fdc, 0x41337895, 0xd3d7c8d8, 0x1413215c, 0x80eaa304, 0xf61058b7, 0x6865ea80,
+        0x7c9b08d3, 0xe1b8865c, 0x9c3b6b1c, 0x060ddaa4, 0xc944326e, 0x5629b00f, 0x2edc45a7, 0xa021ff4a,
+        0xd4661822, 0x441b92ed, 0x36d07262, 0xbe35c35b, 0x6edd2c33, 0xf276add4, 0x85f95216, 0x137ae114,
+        0x012c0087, 0x99de8f2d, 0xe7686052, 0x7aa1d576, 0xa79638d9, 0x280dba57, 0x53284f8c, 0xce2df544,
+        0x483f101f, 0xdedf996b, 0xb3d17f0d, 0x3cffcc89, 0xfca22718, 0x65dea5b9, 0x1c055e60, 0x8e0cec28,
+        0x94030e60, 0x09ef83d6, 0x77f66f0a, 0xef4fddc3, 0x221c37f7, 0xaa2cb5e5, 0xc456412b, 0x5cc9faa1,
+        0x823a1c0e, 0x17f49533, 0x6a177776, 0xf575c49a, 0x319b2817, 0xbab1a9cb, 0xd0a35450, 0x433be6a7,
+        0x5425043d, 0xcbc188b8, 0xa3c764f8, 0x2c95d1cf, 0xe2a13cd6, 0x7fc0bd54, 0x040548b9, 0x9e7cf38f,
+        0x186e1702, 0x8b039d64, 0xfbe37a88, 0x6316ca4b, 0xb61423d1, 0x380ba004, 0x4c645a0f, 0xda6be834,
+        0xc2fb0a11, 0x5b498410, 0x25d4682c, 0xadb0d94e, 0x7236319a, 0xeb44b2a7, 0x9057479f, 0x0d32fd9f,
+        0x66021b73, 0xfe4390dc, 0x8dee702e, 0x1e84c148, 0xdddb2fcb, 0x4aa1afe2, 0x3fc351de, 0xb17ce331,
+        0xa929037c, 0x21f68dbb, 0x5e3263ad, 0xc757d62c, 0x0bcd3aa5, 0x96b2b927, 0xed234dd0, 0x752bf681,
+        0xf0a41282, 0x6d9d9a65, 0x100b7dfd, 0x8678cecf, 0x465c2500, 0xd65ba6e7, 0xbcc05d1f, 0x3542ef10,
+        0x2bae0d36, 0xa409806c, 0xcc7b6d05, 0x50b5dff0, 0x9b0f34dc, 0x0265b7a7, 0x78e84234, 0xe49ef90b,
+    },
+}};
+/// Device copy of the tables (constant memory)
+extern __constant__ Tables device_tables;
+
+/// \param set in [0, set_count)
+/// \param index in [0, point_count)
+/// \return packed 16 bit fixed point coordinates
+HERMES_DEVICE_CALLABLE inline u32 packedPoint(u32 set, u32 index) {
+#if defined(__CUDA_ARCH__) && __CUDA_ARCH__ > 0
+  return device_tables.points[set][index];
+#else
+  return tables.points[set][index];
+#endif
+}
+
+} // namespace helios::pmj02
+
+#endif // HELIOS_SAMPLERS_PMJ02_TABLES_H
@@ -53,8 +53,9 @@ HERMES_DEVICE_CALLABLE SamplePool::SamplePool(const SamplePool &other) {
   sampled_dimensions_count_ = other.sampled_dimensions_count_;
   sample_array1_count_ = other.sample_array1_count_;
   sample_array2_count_ = other.sample_array2_count_;
-  dimension_block_size_ = other.dimension_block_size_;
   pixel_block_size_ = other.pixel_block_size_;
+  first_1d_sample_offset = other.first_1d_sample_offset;
+  first_2d_sample_offset = other.first_2d_sample_offset;
   first_sample_array1_offset = other.first_sample_array1_offset;
   first_sample_array2_offset = other.first_sample_array2_offset;
   first_pixel_sample_offset = other.first_pixel_sample_offset;
@@ -68,7 +69,6 @@ void SamplePool::set(const SamplePool::PoolDescriptor &descriptor, byte *data) {
   // layout
   samples_per_pixel_ = descriptor.samples_per_pixel;
   sampled_dimensions_count_ = descriptor.dimensions;
-  dimension_block_size_ = sizeof(real_t) + sizeof(point2);
   sample_array2_count_ = descriptor.array2_sizes.size();
 
   SamplePool::size_type sample_array1_sizes_sum = 0;
@@ -80,13 +80,14 @@ void SamplePool::set(const SamplePool::PoolDescriptor &descriptor, byte *data) {
 
   sample_array1_count_ = descriptor.array1_sizes.size();
   pixel_block_size_ =
-      sampled_dimensions_count_ * dimension_block_size_         // dimension samples
-          + sample_array1_sizes_sum * sizeof(real_t)            // 1d sample arrays
-          + sample_array2_sizes_sum * sizeof(point2);   // 2d sample arrays
+      sample_array1_sizes_sum * sizeof(real_t)            // 1d sample arrays
+          + sample_array2_sizes_sum * sizeof(point2);     // 2d sample arrays
 
-  first_pixel_sample_offset = (sample_array1_count_ + sample_array2_count_) * sizeof(SamplePool::size_type);
-  first_sample_array1_offset = sampled_dimensions_count_ * dimension_block_size_;
-  first_sample_array2_offset = first_sample_array1_offset + sample_array1_sizes_sum * sizeof(real_t);
+  first_1d_sample_offset = (sample_array1_count_ + sample_array2_count_) * sizeof(SamplePool::size_type);
+  first_2d_sample_offset = first_1d_sample_offset + sampled_dimensions_count_ * samples_per_pixel_ * sizeof(real_t);
+  first_pixel_sample_offset = first_2d_sample_offset + sampled_dimensions_count_ * samples_per_pixel_ * sizeof(point2);
+  first_sample_array1_offset = 0;
+  first_sample_array2_offset = sample_array1_sizes_sum * sizeof(real_t);
 
   reset();
 }
@@ -100,24 +101,31 @@ HERMES_DEVICE_CALLABLE void SamplePool::setPoolIndex(SamplePool::size_type i) {
 }
 
 HERMES_DEVICE_CALLABLE real_t &SamplePool::get1DSample() {
-  return *reinterpret_cast<real_t *>(SAMPLE_BASE_PTR(current_sample_index_)
-      + dimension_block_size_ * current_1d_dimension_++);
+  return get1DSamples(current_1d_dimension_++)[current_sample_index_];
 }
 
 HERMES_DEVICE_CALLABLE real_t &SamplePool::get1DSample(SamplePool::index_type sample_index,
                                                        SamplePool::index_type dimension_index) {
-  return *reinterpret_cast<real_t *>(SAMPLE_BASE_PTR(sample_index) + dimension_block_size_ * dimension_index);
+  return get1DSamples(dimension_index)[sample_index];
 }
 
 HERMES_DEVICE_CALLABLE point2 &SamplePool::get2DSample() {
-  return *reinterpret_cast<point2 *>(SAMPLE_BASE_PTR(current_sample_index_) +
-      dimension_block_size_ * current_2d_dimension_++ + sizeof(real_t));
+  return get2DSamples(current_2d_dimension_++)[current_sample_index_];
 }
 
 HERMES_DEVICE_CALLABLE point2 &SamplePool::get2DSample(SamplePool::index_type sample_index,
                                                        SamplePool::index_type dimension_index) {
-  return *reinterpret_cast<point2 *>(SAMPLE_BASE_PTR(sample_index) +
-      dimension_block_size_ * dimension_index + sizeof(real_t));
+  return get2DSamples(dimension_index)[sample_index];
+}
+
+HERMES_DEVICE_CALLABLE real_t *SamplePool::get1DSamples(SamplePool::index_type dimension_index) {
+  return reinterpret_cast<real_t *>(data_ + item_offset_ + first_1d_sample_offset)
+      + dimension_index * samples_per_pixel_;
+}
+
+HERMES_DEVICE_CALLABLE point2 *SamplePool::get2DSamples(SamplePool::index_type dimension_index) {
+  return reinterpret_cast<point2 *>(data_ + item_offset_ + first_2d_sample_offset)
+      + dimension_index * samples_per_pixel_;
 }
 
 HERMES_DEVICE_CALLABLE real_t *SamplePool::get1DArray() {
@@ -217,27 +225,28 @@ std::string SamplePool::dumpMemory(const SamplePool &pool,
                                       pool.sample_array1_count_ + pool.sample_array2_count_,
                                       ConsoleColors::blue, {}, DataType::U64
                                   },
+                                  { // 1d samples
+                                      static_cast<size_t>(pool.first_1d_sample_offset),
+                                      sizeof(real_t) * pool.samples_per_pixel_,
+                                      pool.sampled_dimensions_count_,
+                                      ConsoleColors::yellow, {
+                                          {0, sizeof(f32), pool.samples_per_pixel_,
+                                           ConsoleColors::red, {}, DataType::F32}
+                                      }},
+                                  { // 2d samples
+                                      static_cast<size_t>(pool.first_2d_sample_offset),
+                                      sizeof(point2) * pool.samples_per_pixel_,
+                                      pool.sampled_dimensions_count_,
+                                      ConsoleColors::yellow, {
+                                          {0, sizeof(f32), 2 * pool.samples_per_pixel_,
+                                           ConsoleColors::yellow, {}, DataType::F32}
+                                      }},
                                   { // pixel samples
                                       static_cast<size_t>(pool.first_pixel_sample_offset),
                                       pool.pixel_block_size_,
                                       pool.samples_per_pixel_,
                                       ConsoleColors::red,
                                       {
-                                          { // dimensions
-                                              0, pool.dimension_block_size_,
-                                              pool.sampled_dimensions_count_,
-                                              ConsoleColors::yellow, {
-                                                  { // 1d
-                                                      0, sizeof(f32), 1,
-                                                      ConsoleColors::red,
-                                                      {}, DataType::F32
-                                                  },
-                                                  {// 2d
-                                                      sizeof(f32), sizeof(f32), 2,
-                                                      ConsoleColors::yellow,
-                                                      {}, DataType::F32
-                                                  }
-                                              }},
                                           { // 1d arrays
                                               static_cast<size_t>(pool.first_sample_array1_offset),
                                               sizeof(real_t), sample_array1_sizes_sum,
@@ -53,8 +53,9 @@ public:
   /// Defines the data stored in a sample pool
   /// \note A sample pool data layout considers 4 types of data: 1D sample, 2D sample,
   /// \note 1D samples array and 2D samples array.
-  /// \note A pair of one 1D sample and one 2D sample is stored for each dimension and
-  /// \note the data for the dynamic arrays comes after. The pattern is repeated for pixel-samples count.
+  /// \note 1D and 2D samples are stored per dimension (all pixel samples of a dimension are contiguous), so
+  /// \note samplers can fill a whole dimension with coalesced writes. The data for the dynamic arrays comes
+  /// \note after, repeated for pixel-samples count.
   struct PoolDescriptor {
     size_type samples_per_pixel{0};      //!< total count of samples (1D and 2D samples)
     size_type dimensions{0};             //!< number of sampled dimensions
@@ -119,6 +120,12 @@ public:
   HERMES_DEVICE_CALLABLE real_t &get1DSample(index_type sample_index, index_type dimension_index);
   HERMES_DEVICE_CALLABLE hermes::point2 &get2DSample(index_type sample_index, index_type dimension_index);
   HERMES_DEVICE_CALLABLE hermes::point2 &get2DSample();
+  /// \param dimension_index
+  /// \return contiguous 1D samples (one per pixel sample) of the given dimension
+  HERMES_DEVICE_CALLABLE real_t *get1DSamples(index_type dimension_index);
+  /// \param dimension_index
+  /// \return contiguous 2D samples (one per pixel sample) of the given dimension
+  HERMES_DEVICE_CALLABLE hermes::point2 *get2DSamples(index_type dimension_index);
   HERMES_DEVICE_CALLABLE real_t *get1DArray();
   HERMES_DEVICE_CALLABLE real_t *get1DArray(index_type sample_index, index_type array_index);
   HERMES_DEVICE_CALLABLE hermes::point2 *get2DArray();
@@ -147,19 +154,26 @@ private:
   index_type current_1d_dimension_{0};
   index_type current_2d_dimension_{0};
   // layout goes like this:
-  //  <sample_array1_count_ + sample_array2_count_> <samples_per_pixel_ * pixel_block_size_>
+  //  <sample_array1_count_ + sample_array2_count_>
+  //  <sampled_dimensions_count_ * samples_per_pixel_ 1d samples>
+  //  <sampled_dimensions_count_ * samples_per_pixel_ 2d samples>
+  //  <samples_per_pixel_ * pixel_block_size_>
   //
-  //                            dimension block size         1st 1d array offset
-  //                               |           |               |
-  //  |array sizes| |pixel sample: {dimension 0} {dimension n} {1d arrays} {2d arrays}}|
-  //                |                                                      |
-  //              1st pixel sample offset                                  1st 2d array offset
+  //              1st 1d sample offset                  1st 2d sample offset
+  //                |                                     |
+  //  |array sizes| {1d: {dimension 0} ... {dimension n}} {2d: {dimension 0} ... {dimension n}}
+  //  |pixel sample: {1d arrays} {2d arrays}}
+  //  |              |           |
+  //  |            1st 1d array  1st 2d array offset (relative to the pixel sample)
+  //  1st pixel sample offset
+  // where each {dimension} block holds samples_per_pixel_ contiguous samples
   size_type samples_per_pixel_{0};
   size_type sampled_dimensions_count_{0};
   size_type sample_array1_count_{0};
   size_type sample_array2_count_{0};
-  size_type dimension_block_size_{0};
   size_type pixel_block_size_{0};
+  ptrdiff_t first_1d_sample_offset{0};
+  ptrdiff_t first_2d_sample_offset{0};
   ptrdiff_t first_sample_array1_offset{0};
   ptrdiff_t first_sample_array2_offset{0};
   ptrdiff_t first_pixel_sample_offset{0};
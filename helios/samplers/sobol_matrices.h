@@ -0,0 +1,184 @@
+/// Copyright (c) 2021, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+///\file sobol_matrices.h
+///\author FilipeCN (filipedecn@gmail.com)
+///\date 2021-10-19
+///
+///\brief Sobol' generator matrices (built at compile time) and sample evaluation
+
+#ifndef HELIOS_SAMPLERS_SOBOL_MATRICES_H
+#define HELIOS_SAMPLERS_SOBOL_MATRICES_H
+
+#include <hermes/geometry/point.h>
+
+namespace helios::sobol {
+
+/// Number of dimensions with their own generator matrix (higher dimensions reuse matrices with other scrambles)
+static constexpr int dimension_count = 32;
+/// Number of columns (bits) of each generator matrix
+static constexpr int matrix_size = 32;
+
+/// Primitive polynomial and initial direction numbers of a Sobol' dimension
+struct DirectionNumbers {
+  u32 degree;       //!< degree s of the primitive polynomial
+  u32 a;            //!< polynomial coefficients (without leading and trailing terms)
+  u32 m[7];         //!< initial direction numbers m_1 ... m_s
+};
+
+/// Joe & Kuo (new-joe-kuo-6.21201) parameters for dimensions 1...31 (dimension 0 is the van der Corput sequence)
+static constexpr DirectionNumbers direction_numbers[dimension_count - 1] = {
+    {1, 0, {1}},
+    {2, 1, {1, 3}},
+    {3, 1, {1, 3, 1}},
+    {3, 2, {1, 1, 1}},
+    {4, 1, {1, 1, 3, 3}},
+    {4, 4, {1, 3, 5, 13}},
+    {5, 2, {1, 1, 5, 5, 17}},
+    {5, 4, {1, 1, 5, 5, 5}},
+    {5, 7, {1, 1, 7, 11, 19}},
+    {5, 11, {1, 1, 5, 1, 1}},
+    {5, 13, {1, 1, 1, 3, 11}},
+    {5, 14, {1, 3, 5, 5, 31}},
+    {6, 1, {1, 3, 3, 9, 7, 49}},
+    {6, 13, {1, 1, 1, 15, 21, 21}},
+    {6, 16, {1, 3, 1, 13, 27, 49}},
+    {6, 19, {1, 1, 1, 15, 7, 5}},
+    {6, 22, {1, 3, 1, 15, 13, 25}},
+    {6, 25, {1, 1, 5, 5, 19, 61}},
+    {7, 1, {1, 3, 7, 11, 23, 15, 103}},
+    {7, 4, {1, 3, 7, 13, 13, 15, 69}},
+    {7, 7, {1, 1, 3, 13, 7, 35, 63}},
+    {7, 8, {1, 3, 5, 9, 1, 25, 53}},
+    {7, 14, {1, 3, 1, 13, 9, 35, 107}},
+    {7, 19, {1, 3, 1, 5, 27, 61, 31}},
+    {7, 21, {1, 1, 5, 11, 19, 41, 61}},
+    {7, 28, {1, 3, 5, 3, 3, 13, 69}},
+    {7, 31, {1, 1, 7, 13, 1, 19, 1}},
+    {7, 32, {1, 3, 7, 5, 13, 19, 59}},
+    {7, 37, {1, 1, 3, 9, 25, 29, 41}},
+    {7, 41, {1, 3, 5, 13, 23, 1, 55}},
+    {7, 42, {1, 3, 7, 3, 13, 59, 17}},
+};
+
+/// Generator matrices, column j of a matrix is the contribution of bit j of the sample index
+struct Matrices {
+  u32 columns[dimension_count][matrix_size];
+};
+
+/// Expands the direction numbers into generator matrices
+/// \return
+constexpr Matrices buildMatrices() {
+  Matrices matrices{};
+  for (int j = 0; j < matrix_size; ++j)
+    matrices.columns[0][j] = 1u << (31 - j);
+  for (int d = 1; d < dimension_count; ++d) {
+    const auto &dn = direction_numbers[d - 1];
+    u32 s = dn.degree;
+    // v_k = m_k / 2^k, stored as 32 bit fixed point
+    u32 v[matrix_size]{};
+    for (u32 k = 0; k < s && k < matrix_size; ++k)
+      v[k] = dn.m[k] << (31 - k);
+    for (u32 k = s; k < matrix_size; ++k) {
+      v[k] = v[k - s] ^ (v[k - s] >> s);
+      for (u32 i = 1; i < s; ++i)
+        if ((dn.a >> (s - 1 - i)) & 1)
+          v[k] ^= v[k - i];
+    }
+    for (int j = 0; j < matrix_size; ++j)
+      matrices.columns[d][j] = v[j];
+  }
+  return matrices;
+}
+
+/// Host copy of the generator matrices
+inline constexpr Matrices matrices = buildMatrices();
+/// Device copy of the generator matrices (constant memory)
+extern __constant__ Matrices device_matrices;
+
+/// \param dimension
+/// \param bit
+/// \return column of the generator matrix of dimension
+HERMES_DEVICE_CALLABLE inline u32 matrixColumn(int dimension, int bit) {
+#if defined(__CUDA_ARCH__) && __CUDA_ARCH__ > 0
+  return device_matrices.columns[dimension][bit];
+#else
+  return matrices.columns[dimension][bit];
+#endif
+}
+
+HERMES_DEVICE_CALLABLE inline u32 reverseBits(u32 v) {
+#if defined(__CUDA_ARCH__) && __CUDA_ARCH__ > 0
+  return __brev(v);
+#else
+  v = (v << 16) | (v >> 16);
+  v = ((v & 0x00ff00ff) << 8) | ((v & 0xff00ff00) >> 8);
+  v = ((v & 0x0f0f0f0f) << 4) | ((v & 0xf0f0f0f0) >> 4);
+  v = ((v & 0x33333333) << 2) | ((v & 0xcccccccc) >> 2);
+  v = ((v & 0x55555555) << 1) | ((v & 0xaaaaaaaa) >> 1);
+  return v;
+#endif
+}
+
+/// Hash based approximation of Owen scrambling (Laine-Karras style), each bit is flipped depending only on
+/// the bits above it, so nets remain nets
+/// \param v 32 bit fixed point value in [0, 1)
+/// \param seed
+/// \return
+HERMES_DEVICE_CALLABLE inline u32 owenScramble(u32 v, u32 seed) {
+  v = reverseBits(v);
+  v ^= v * 0x3d20adea;
+  v += seed;
+  v *= (seed >> 16) | 1;
+  v ^= v * 0x05526c56;
+  v ^= v * 0x53a22864;
+  return reverseBits(v);
+}
+
+/// \param index sample index in the sequence
+/// \param dimension in [0, dimension_count)
+/// \return 32 bit fixed point value of the (unscrambled) sample
+HERMES_DEVICE_CALLABLE inline u32 sampleBits(u64 index, int dimension) {
+  u32 v = 0;
+  for (int bit = 0; index && bit < matrix_size; index >>= 1, ++bit)
+    if (index & 1)
+      v ^= matrixColumn(dimension, bit);
+  return v;
+}
+
+/// \param bits 32 bit fixed point value
+/// \return value in [0, 1)
+HERMES_DEVICE_CALLABLE inline real_t toUnitFloat(u32 bits) {
+  real_t value = bits * 0x1p-32f;
+  return value < hermes::Constants::one_minus_epsilon ? value : hermes::Constants::one_minus_epsilon;
+}
+
+/// \param index sample index in the sequence
+/// \param dimension in [0, dimension_count)
+/// \param seed owen scrambling seed
+/// \return scrambled sample value in [0, 1)
+HERMES_DEVICE_CALLABLE inline real_t sample(u64 index, int dimension, u32 seed) {
+  return toUnitFloat(owenScramble(sampleBits(index, dimension), seed));
+}
+
+} // namespace helios::sobol
+
+#endif // HELIOS_SAMPLERS_SOBOL_MATRICES_H
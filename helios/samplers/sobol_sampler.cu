@@ -0,0 +1,189 @@
+#include <helios/samplers/sobol_sampler.h>
+#include <helios/common/hash.h>
+
+using namespace hermes;
+
+namespace helios {
+
+namespace sobol {
+
+__constant__ Matrices device_matrices = matrices;
+
+}
+
+namespace {
+
+/// Interleaves the bits of x and y (x takes the even bits)
+HERMES_DEVICE_CALLABLE u64 encodeMorton2(u32 x, u32 y) {
+  auto spread = [](u64 v) {
+    v &= 0xffffffff;
+    v = (v | (v << 16)) & 0x0000ffff0000ffffull;
+    v = (v | (v << 8)) & 0x00ff00ff00ff00ffull;
+    v = (v | (v << 4)) & 0x0f0f0f0f0f0f0f0full;
+    v = (v | (v << 2)) & 0x3333333333333333ull;
+    v = (v | (v << 1)) & 0x5555555555555555ull;
+    return v;
+  };
+  return spread(x) | (spread(y) << 1);
+}
+
+HERMES_DEVICE_CALLABLE u32 log2Ceil(u32 v) {
+  u32 log2 = 0;
+  while ((1u << log2) < v)
+    log2++;
+  return log2;
+}
+
+/// \param permutation index of one of the 24 permutations of {0, 1, 2, 3}
+/// \param digit
+/// \return digit after permutation
+HERMES_DEVICE_CALLABLE u32 permuteBase4Digit(u32 permutation, u32 digit) {
+  // decode the permutation from the factorial number system, remaining digits are stored as nibbles
+  u32 remaining = 0x3210;
+  u32 permuted = 0;
+  u32 factorial = 6;
+  for (u32 i = 0; i < 4; ++i) {
+    u32 k = permutation / factorial;
+    permutation %= factorial;
+    factorial = i < 2 ? factorial / (3 - i) : 1;
+    u32 value = (remaining >> (4 * k)) & 0xf;
+    // remove the k-th nibble
+    u32 low = remaining & ((1u << (4 * k)) - 1);
+    remaining = ((remaining >> (4 * (k + 1))) << (4 * k)) | low;
+    permuted |= value << (4 * i);
+  }
+  return (permuted >> (4 * digit)) & 0xf;
+}
+
+}
+
+// *********************************************************************************************************************
+//                                                                                                       SobolSampler
+// *********************************************************************************************************************
+HERMES_DEVICE_CALLABLE SobolSampler::SobolSampler(u32 samples_per_pixel, u32 seed)
+    : samples_per_pixel_(samples_per_pixel ? samples_per_pixel : 1), seed_(seed) {}
+
+HERMES_DEVICE_CALLABLE void SobolSampler::setPass(u32 pass) {
+  pass_ = pass;
+}
+
+HERMES_DEVICE_CALLABLE void SobolSampler::startPixel(const index2 &p) {
+  startPixelSample(p, 0);
+}
+
+HERMES_DEVICE_CALLABLE void SobolSampler::startPixelSample(const index2 &p, u32 sample_index, u32 dimension) {
+  pixel_ = p;
+  sample_index_ = sample_index;
+  dimension_ = dimension;
+}
+
+HERMES_DEVICE_CALLABLE real_t SobolSampler::sampleDimension(u32 dimension) const {
+  u64 index = static_cast<u64>(pass_) * samples_per_pixel_ + sample_index_;
+  auto scramble_seed = static_cast<u32>(hash::values(pixel_.i, pixel_.j, dimension, seed_));
+  return sobol::sample(index, dimension % sobol::dimension_count, scramble_seed);
+}
+
+HERMES_DEVICE_CALLABLE real_t SobolSampler::get1D() {
+  return sampleDimension(dimension_++);
+}
+
+HERMES_DEVICE_CALLABLE point2 SobolSampler::get2D() {
+  point2 u(sampleDimension(dimension_), sampleDimension(dimension_ + 1));
+  dimension_ += 2;
+  return u;
+}
+
+HERMES_DEVICE_CALLABLE CameraSample SobolSampler::cameraSample(const index2 &p) {
+  CameraSample cs;
+  cs.film = get2D() + vec2(p.i, p.j);
+  cs.time = get1D();
+  cs.lens = get2D();
+  return cs;
+}
+
+HERMES_DEVICE_CALLABLE bool SobolSampler::startNextSample() {
+  dimension_ = 0;
+  return ++sample_index_ < samples_per_pixel_;
+}
+
+HERMES_DEVICE_CALLABLE u32 SobolSampler::samplesPerPixel() const {
+  return samples_per_pixel_;
+}
+
+// *********************************************************************************************************************
+//                                                                                                      ZSobolSampler
+// *********************************************************************************************************************
+HERMES_DEVICE_CALLABLE ZSobolSampler::ZSobolSampler(u32 samples_per_pixel, const size2 &resolution, u32 seed)
+    : log2_samples_per_pixel_(log2Ceil(samples_per_pixel ? samples_per_pixel : 1)), seed_(seed) {
+  u32 log2_resolution = log2Ceil(resolution.width > resolution.height ? resolution.width : resolution.height);
+  base4_digit_count_ = log2_resolution + (log2_samples_per_pixel_ + 1) / 2;
+}
+
+HERMES_DEVICE_CALLABLE void ZSobolSampler::setPass(u32 pass) {
+  pass_ = pass;
+}
+
+HERMES_DEVICE_CALLABLE void ZSobolSampler::startPixel(const index2 &p) {
+  startPixelSample(p, 0);
+}
+
+HERMES_DEVICE_CALLABLE void ZSobolSampler::startPixelSample(const index2 &p, u32 sample_index, u32 dimension) {
+  morton_index_ = encodeMorton2(p.i, p.j);
+  sample_index_ = sample_index;
+  dimension_ = dimension;
+}
+
+HERMES_DEVICE_CALLABLE u64 ZSobolSampler::sampleIndex() const {
+  u64 morton_index = (morton_index_ << log2_samples_per_pixel_) | sample_index_;
+  u64 sample_index = 0;
+  // with an odd power of two samples per pixel, the last digit is a single bit
+  bool odd_log2 = log2_samples_per_pixel_ & 1;
+  int last_digit = odd_log2 ? 1 : 0;
+  for (int i = static_cast<int>(base4_digit_count_) - 1; i >= last_digit; --i) {
+    int digit_shift = 2 * i - (odd_log2 ? 1 : 0);
+    u32 digit = (morton_index >> digit_shift) & 3;
+    // the permutation depends on the higher digits, so the mapping stays a bijection
+    u64 higher_digits = morton_index >> (digit_shift + 2);
+    u32 permutation = (hash::mixBits(higher_digits ^ (0x55555555u * dimension_)) >> 24) % 24;
+    sample_index |= static_cast<u64>(permuteBase4Digit(permutation, digit)) << digit_shift;
+  }
+  if (odd_log2) {
+    u32 digit = morton_index & 1;
+    sample_index |= digit ^ (hash::mixBits((morton_index >> 1) ^ (0x55555555u * dimension_)) & 1);
+  }
+  return sample_index;
+}
+
+HERMES_DEVICE_CALLABLE real_t ZSobolSampler::get1D() {
+  u64 index = sampleIndex();
+  auto scramble_seed = static_cast<u32>(hash::values(dimension_, seed_, pass_));
+  dimension_++;
+  return sobol::sample(index, 0, scramble_seed);
+}
+
+HERMES_DEVICE_CALLABLE point2 ZSobolSampler::get2D() {
+  u64 index = sampleIndex();
+  u64 scramble_bits = hash::values(dimension_, seed_, pass_);
+  dimension_ += 2;
+  return {sobol::sample(index, 0, static_cast<u32>(scramble_bits)),
+          sobol::sample(index, 1, static_cast<u32>(scramble_bits >> 32))};
+}
+
+HERMES_DEVICE_CALLABLE CameraSample ZSobolSampler::cameraSample(const index2 &p) {
+  CameraSample cs;
+  cs.film = get2D() + vec2(p.i, p.j);
+  cs.time = get1D();
+  cs.lens = get2D();
+  return cs;
+}
+
+HERMES_DEVICE_CALLABLE bool ZSobolSampler::startNextSample() {
+  dimension_ = 0;
+  return ++sample_index_ < samplesPerPixel();
+}
+
+HERMES_DEVICE_CALLABLE u32 ZSobolSampler::samplesPerPixel() const {
+  return 1u << log2_samples_per_pixel_;
+}
+
+} // namespace helios
@@ -0,0 +1,128 @@
+/// Copyright (c) 2021, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+///\file sobol_sampler.h
+///\author FilipeCN (filipedecn@gmail.com)
+///\date 2021-10-19
+///
+///\brief
+
+#ifndef HELIOS_SAMPLERS_SOBOL_SAMPLER_H
+#define HELIOS_SAMPLERS_SOBOL_SAMPLER_H
+
+#include <helios/samplers/sobol_matrices.h>
+#include <helios/core/camera.h>
+
+namespace helios {
+
+// *********************************************************************************************************************
+//                                                                                                       SobolSampler
+// *********************************************************************************************************************
+/// Draws the samples of each pixel from an Owen scrambled Sobol' sequence. Each (pixel, dimension) pair gets
+/// its own scramble, so pixels are decorrelated while samples inside a pixel keep the (0,2) net structure.
+/// \note Any number of samples per pixel is supported, but powers of two give the best stratification.
+class SobolSampler {
+public:
+  // *******************************************************************************************************************
+  //                                                                                                     CONSTRUCTORS
+  // *******************************************************************************************************************
+  SobolSampler() = default;
+  /// \param samples_per_pixel
+  /// \param seed selects a different (but deterministic) set of scrambles
+  HERMES_DEVICE_CALLABLE explicit SobolSampler(u32 samples_per_pixel, u32 seed = 0);
+  // *******************************************************************************************************************
+  //                                                                                                          METHODS
+  // *******************************************************************************************************************
+  /// Later passes continue the sequence of each pixel (pass p starts at sample p * samplesPerPixel())
+  /// \param pass
+  HERMES_DEVICE_CALLABLE void setPass(u32 pass);
+  HERMES_DEVICE_CALLABLE void startPixel(const hermes::index2 &p);
+  /// \param p pixel coordinates
+  /// \param sample_index index of the sample inside the pixel
+  /// \param dimension first dimension to be generated
+  HERMES_DEVICE_CALLABLE void startPixelSample(const hermes::index2 &p, u32 sample_index, u32 dimension = 0);
+  HERMES_DEVICE_CALLABLE real_t get1D();
+  HERMES_DEVICE_CALLABLE hermes::point2 get2D();
+  [[nodiscard]] HERMES_DEVICE_CALLABLE CameraSample cameraSample(const hermes::index2 &p);
+  HERMES_DEVICE_CALLABLE bool startNextSample();
+  [[nodiscard]] HERMES_DEVICE_CALLABLE u32 samplesPerPixel() const;
+
+private:
+  [[nodiscard]] HERMES_DEVICE_CALLABLE real_t sampleDimension(u32 dimension) const;
+
+  u32 samples_per_pixel_{1};
+  u32 seed_{0};
+  u32 pass_{0};
+  hermes::index2 pixel_;
+  u32 sample_index_{0};
+  u32 dimension_{0};
+};
+
+// *********************************************************************************************************************
+//                                                                                                      ZSobolSampler
+// *********************************************************************************************************************
+/// Distributes a single Sobol' sequence over the whole image following the Morton (Z) order of pixels, so
+/// neighbouring pixels receive complementary samples and error is spread as blue noise (Ahmed and Wonka 2020).
+/// Base-4 digits of the Morton index are randomly permuted per dimension to avoid structured artifacts.
+/// \note Samples per pixel are rounded up to a power of two.
+class ZSobolSampler {
+public:
+  // *******************************************************************************************************************
+  //                                                                                                     CONSTRUCTORS
+  // *******************************************************************************************************************
+  ZSobolSampler() = default;
+  /// \param samples_per_pixel
+  /// \param resolution full image resolution
+  /// \param seed
+  HERMES_DEVICE_CALLABLE ZSobolSampler(u32 samples_per_pixel, const hermes::size2 &resolution, u32 seed = 0);
+  // *******************************************************************************************************************
+  //                                                                                                          METHODS
+  // *******************************************************************************************************************
+  /// Different passes use different scrambles
+  /// \param pass
+  HERMES_DEVICE_CALLABLE void setPass(u32 pass);
+  HERMES_DEVICE_CALLABLE void startPixel(const hermes::index2 &p);
+  /// \param p pixel coordinates
+  /// \param sample_index index of the sample inside the pixel
+  /// \param dimension first dimension to be generated
+  HERMES_DEVICE_CALLABLE void startPixelSample(const hermes::index2 &p, u32 sample_index, u32 dimension = 0);
+  HERMES_DEVICE_CALLABLE real_t get1D();
+  HERMES_DEVICE_CALLABLE hermes::point2 get2D();
+  [[nodiscard]] HERMES_DEVICE_CALLABLE CameraSample cameraSample(const hermes::index2 &p);
+  HERMES_DEVICE_CALLABLE bool startNextSample();
+  [[nodiscard]] HERMES_DEVICE_CALLABLE u32 samplesPerPixel() const;
+
+private:
+  /// \return index into the global Sobol' sequence of the current (pixel, sample) for the current dimension
+  [[nodiscard]] HERMES_DEVICE_CALLABLE u64 sampleIndex() const;
+
+  u32 log2_samples_per_pixel_{0};
+  u32 base4_digit_count_{0};
+  u32 seed_{0};
+  u32 pass_{0};
+  u64 morton_index_{0};
+  u32 sample_index_{0};
+  u32 dimension_{0};
+};
+
+} // namespace helios
+
+#endif // HELIOS_SAMPLERS_SOBOL_SAMPLER_H
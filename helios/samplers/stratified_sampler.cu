@@ -1,4 +1,6 @@
 #include <helios/samplers/stratified_sampler.h>
+#include <helios/common/hash.h>
+#include <hermes/common/cuda_utils.h>
 
 using namespace hermes;
 
@@ -19,103 +21,82 @@ namespace helios {
 //    }
 //}
 
-StratifiedSampler::StratifiedSampler(const size2 &grid_resolution,
-                                     bool jitter_samples,
-                                     u32 sampled_dimensions)
-    : resolution_(grid_resolution), jitter_samples_(jitter_samples) {
-  SamplePool::PoolDescriptor descriptor = {
-      .samples_per_pixel = resolution_.total(),
-      .dimensions = sampled_dimensions,
-      .array1_sizes = {},
-      .array2_sizes = {}
-  };
-  pool_.set(descriptor);
+HERMES_CUDA_KERNEL(fillPool)(StratifiedSampler sampler, SamplePool pool, range2 pixels, int bounds) {
+  HERMES_CUDA_THREAD_INDEX_I_LT(bounds)
+  // consecutive threads handle consecutive samples of the same dimension block
+  const u32 spp = sampler.samplesPerPixel();
+  const u32 sample_index = i % spp;
+  const u32 dimension = (i / spp) % pool.dimensionCount();
+  const u32 item = i / (spp * pool.dimensionCount());
+  const int width = pixels.upper().i - pixels.lower().i;
+  pool.setPoolIndex(item);
+  sampler.startPixelSample(pixels.lower() + index2(item % width, item / width), sample_index, 3 * dimension);
+  pool.get1DSamples(dimension)[sample_index] = sampler.get1D();
+  pool.get2DSamples(dimension)[sample_index] = sampler.get2D();
 }
 
-HERMES_DEVICE_CALLABLE StratifiedSampler::StratifiedSampler(const StratifiedSampler &other) {
-  resolution_ = other.resolution_;
-  jitter_samples_ = other.jitter_samples_;
-  pool_ = other.pool_;
-  rng = other.rng;
-}
+HERMES_DEVICE_CALLABLE StratifiedSampler::StratifiedSampler(const size2 &grid_resolution,
+                                                            bool jitter_samples,
+                                                            u32 seed)
+    : resolution_(grid_resolution), jitter_samples_(jitter_samples), seed_(seed), rng_(seed) {}
 
-HERMES_DEVICE_CALLABLE StratifiedSampler::~StratifiedSampler() {}
+HERMES_DEVICE_CALLABLE void StratifiedSampler::setPass(u32 pass) {
+  pass_ = pass;
+  rng_ = CounterRNG(seed_, pass);
+}
 
 HERMES_DEVICE_CALLABLE void StratifiedSampler::startPixel(const index2 &p) {
-  const u32 sampled_dimensions = pool_.dimensionCount();
-  const real_t inv_n_samples = static_cast<real_t>(1) / resolution_.total();
-  const real_t dx = static_cast<real_t>(1) / resolution_.width;
-  const real_t dy = static_cast<real_t>(1) / resolution_.height;
-
-  for (auto ij : range2(resolution_)) {
-    u32 pixel_sample = ij.j * resolution_.width + ij.i;
-    // generate samples for dimensions
-    for (u32 d = 0; d < sampled_dimensions; ++d) {
-      // generate 1d sample
-      real_t delta = jitter_samples_ ? rng.uniformFloat() : 0.5f;
-      pool_.get1DSample(pixel_sample, d) = fminf((pixel_sample + delta) * inv_n_samples, Constants::one_minus_epsilon);
-      // generate 2d sample
-      real_t jx = jitter_samples_ ? rng.uniformFloat() : 0.5f;
-      real_t jy = jitter_samples_ ? rng.uniformFloat() : 0.5f;
-      point2 &sample_p = pool_.get2DSample(pixel_sample, d);
-      sample_p.x = fminf((ij.i + jx) * dx, Constants::one_minus_epsilon);
-      sample_p.y = fminf((ij.j + jy) * dy, Constants::one_minus_epsilon);
-    }
-    // generate samples for 1d arrays
-    for (u32 a = 0; a < pool_.array1Count(); ++a) {
-      real_t *arr = pool_.get1DArray(pixel_sample, a);
-      for (u32 j = 0; j < pool_.get1DArraySize(a); ++j) {
-        real_t delta = jitter_samples_ ? rng.uniformFloat() : 0.5f;
-        arr[j] = fminf((pixel_sample + delta) * inv_n_samples, Constants::one_minus_epsilon);
-      }
-    }
-    for (u32 a = 0; a < pool_.array2Count(); ++a) {
-      point2 *arr = pool_.get2DArray(pixel_sample, a);
-      for (u32 j = 0; j < pool_.get2DArraySize(a); ++j) {
-        real_t jx = jitter_samples_ ? rng.uniformFloat() : 0.5f;
-        real_t jy = jitter_samples_ ? rng.uniformFloat() : 0.5f;
-        arr[j].x = fminf((ij.i + jx) * dx, Constants::one_minus_epsilon);
-        arr[j].y = fminf((ij.j + jy) * dy, Constants::one_minus_epsilon);
-      }
-    }
-  }
-
-  // shuffle samples
-  pool_.reset();
+  startPixelSample(p, 0);
 }
 
-HERMES_DEVICE_CALLABLE void StratifiedSampler::setDataPtr(byte *data) {
-  pool_.setData(data);
+HERMES_DEVICE_CALLABLE void StratifiedSampler::startPixelSample(const index2 &p, u32 sample_index, u32 dimension) {
+  pixel_ = p;
+  sample_index_ = sample_index;
+  dimension_ = dimension;
 }
 
-HERMES_DEVICE_CALLABLE SamplePool::size_type StratifiedSampler::memorySize() const {
-  return pool_.itemSize();
+HERMES_DEVICE_CALLABLE real_t StratifiedSampler::get1D() {
+  const u32 n = resolution_.total();
+  u32 stratum = hash::permutationElement(sample_index_, n,
+                                         hash::values(pixel_.i, pixel_.j, dimension_, seed_, pass_));
+  real_t delta = jitter_samples_ ? rng_.uniform1D(pixel_, sample_index_, dimension_) : 0.5f;
+  dimension_++;
+  return fminf((stratum + delta) / n, Constants::one_minus_epsilon);
 }
 
-HERMES_DEVICE_CALLABLE SamplePool StratifiedSampler::samplePool() const {
-  return pool_;
+HERMES_DEVICE_CALLABLE point2 StratifiedSampler::get2D() {
+  u32 stratum = hash::permutationElement(sample_index_, resolution_.total(),
+                                         hash::values(pixel_.i, pixel_.j, dimension_, seed_, pass_));
+  point2 delta = jitter_samples_ ? rng_.uniform2D(pixel_, sample_index_, dimension_) : point2(0.5f, 0.5f);
+  dimension_ += 2;
+  return {fminf((stratum % resolution_.width + delta.x) / resolution_.width, Constants::one_minus_epsilon),
+          fminf((stratum / resolution_.width + delta.y) / resolution_.height, Constants::one_minus_epsilon)};
 }
 
 HERMES_DEVICE_CALLABLE CameraSample StratifiedSampler::cameraSample(const index2 &p) {
   CameraSample cs;
-  cs.film = pool_.get2DSample() + vec2(p.i, p.j);
-  cs.time = pool_.get1DSample();
-  cs.lens = pool_.get2DSample();
+  cs.film = get2D() + vec2(p.i, p.j);
+  cs.time = get1D();
+  cs.lens = get2D();
   return cs;
 }
 
 HERMES_DEVICE_CALLABLE bool StratifiedSampler::startNextSample() {
-  return pool_.startNextSample();
-}
-
-HERMES_DEVICE_CALLABLE void StratifiedSampler::setIndex(u32 i) {
-  pool_.setPoolIndex(i);
+  dimension_ = 0;
+  return ++sample_index_ < resolution_.total();
 }
 
 HERMES_DEVICE_CALLABLE u32 StratifiedSampler::samplesPerPixel() const {
   return resolution_.total();
 }
 
+void StratifiedSampler::fillPool(SamplePool pool, const range2 &pixels) const {
+  int n = pixels.area() * pool.dimensionCount() * samplesPerPixel();
+  if (n) {
+    HERMES_CUDA_LAUNCH_AND_SYNC((n), fillPool_k, *this, pool, pixels, n)
+  }
+}
+
 // StratifiedSampler::StratifiedSampler(int xstart, int xend, int ystart, int
 // yend,
 //                                      int xs, int ys, bool jitter, float
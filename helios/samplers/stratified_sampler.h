@@ -1,9 +1,10 @@
 #ifndef HELIOS_SAMPLERS_STRATIFIED_SAMPLER_H
 #define HELIOS_SAMPLERS_STRATIFIED_SAMPLER_H
 
-#include <helios/samplers/sample_pool.h>
 #include <hermes/random/rng.h>
 #include <helios/core/camera.h>
+#include <helios/common/counter_rng.h>
+#include <helios/samplers/sample_pool.h>
 
 namespace helios {
 
@@ -11,6 +12,8 @@ namespace helios {
 //                                                                                                  StratifiedSampler
 // *********************************************************************************************************************
 /// Divides the sampled region into rectangular regions and generates a single sample inside each region.
+/// \note Samples are computed on demand: each dimension visits the strata in its own (hashed) random order,
+/// \note and jitter values are hashed from (pixel, sample index, dimension). No sample memory is needed.
 class StratifiedSampler {
 public:
   // *******************************************************************************************************************
@@ -57,32 +60,54 @@ public:
   //                                                                                                     CONSTRUCTORS
   // *******************************************************************************************************************
   StratifiedSampler() = default;
-  ///
-  /// \param grid_resolution
-  /// \param jitter_samples
-  /// \param sampled_dimensions
-  StratifiedSampler(const hermes::size2 &grid_resolution, bool jitter_samples,
-                    u32 sampled_dimensions);
-
-  HERMES_DEVICE_CALLABLE StratifiedSampler(const StratifiedSampler& other);
-  HERMES_DEVICE_CALLABLE ~StratifiedSampler();
+  /// \param grid_resolution number of strata along each axis (samples per pixel = grid_resolution.total())
+  /// \param jitter_samples true to jitter samples from strata centers
+  /// \param seed selects a different (but deterministic) set of samples
+  HERMES_DEVICE_CALLABLE StratifiedSampler(const hermes::size2 &grid_resolution, bool jitter_samples, u32 seed = 0);
   // *******************************************************************************************************************
   //                                                                                                          METHODS
   // *******************************************************************************************************************
-  HERMES_DEVICE_CALLABLE void setIndex(u32 i);
-  HERMES_DEVICE_CALLABLE void setDataPtr(byte *data);
+  /// Selects the sampling pass, different passes produce different sample sets for the same pixel
+  /// \param pass
+  HERMES_DEVICE_CALLABLE void setPass(u32 pass);
+  /// Restarts sample generation at the first sample of pixel p
+  /// \param p pixel coordinates
   HERMES_DEVICE_CALLABLE void startPixel(const hermes::index2 &p);
+  /// Jumps to any sample of any pixel (samples do not depend on previously generated samples)
+  /// \param p pixel coordinates
+  /// \param sample_index index of the sample inside the pixel
+  /// \param dimension first dimension to be generated
+  HERMES_DEVICE_CALLABLE void startPixelSample(const hermes::index2 &p, u32 sample_index, u32 dimension = 0);
+  /// \return sample value for the next dimension of the current sample
+  HERMES_DEVICE_CALLABLE real_t get1D();
+  /// \return sample values for the next 2 dimensions of the current sample
+  HERMES_DEVICE_CALLABLE hermes::point2 get2D();
+  /// Consumes the first 5 dimensions of the current sample
+  /// \param p pixel coordinates
   [[nodiscard]] HERMES_DEVICE_CALLABLE CameraSample cameraSample(const hermes::index2 &p);
-  [[nodiscard]] HERMES_DEVICE_CALLABLE SamplePool samplePool() const;
-  [[nodiscard]] HERMES_DEVICE_CALLABLE SamplePool::size_type memorySize() const;
+  /// \return true until all samples of the current pixel have been generated
   HERMES_DEVICE_CALLABLE bool startNextSample();
-  HERMES_DEVICE_CALLABLE u32 samplesPerPixel() const;
+  [[nodiscard]] HERMES_DEVICE_CALLABLE u32 samplesPerPixel() const;
+  /// Fills one pool item per pixel of a region (row major), with the same samples the sampler generates on
+  /// demand: the 1D and 2D samples of pool dimension d are sampler dimensions 3d and (3d + 1, 3d + 2).
+  /// \note One thread is launched per (pixel, dimension, sample), so each dimension block is written with
+  /// \note coalesced stores.
+  /// \pre pool samples per pixel must be equal to samplesPerPixel()
+  /// \param pool pool with at least pixels.area() items in device accessible memory
+  /// \param pixels
+  void fillPool(SamplePool pool, const hermes::range2 &pixels) const;
 
 private:
+  // samples are a function of (pixel, sample index, dimension), so this is all the state a sampler needs
   hermes::size2 resolution_;
   bool jitter_samples_{false};
-  SamplePool pool_;
-  hermes::PCGRNG rng;
+  u32 seed_{0};
+  u32 pass_{0};
+  // jitter offsets, keyed by (seed, pass) and indexed by (pixel, sample index, dimension)
+  CounterRNG rng_;
+  hermes::index2 pixel_;
+  u32 sample_index_{0};
+  u32 dimension_{0};
 };
 
 } // namespace helios
@@ -30,6 +30,7 @@
 
 #include <helios/base/bxdf.h>
 #include <helios/scattering/dielectric_bxdf.h>
+#include <initializer_list>
 
 namespace helios {
 
@@ -44,11 +45,49 @@ namespace helios {
 #define CAST_CONST_BXDF(BXDF, PTR, CODE)                                                                            \
 {                                                                                                                   \
   switch(BXDF.type) {                                                                                               \
-    case MaterialType::DIELECTRIC: {                                                                                \
-         const DielectricMaterial * PTR = BXDF.data_ptr.template get<DielectricBxDF>(); CODE break; }             \
+    case BxDFType::DIELECTRIC: {                                                                                    \
+         const DielectricBxDF * PTR = BXDF.data_ptr.template get<DielectricBxDF>(); CODE break; }                   \
+  }                                                                                                                 \
+}
+
+/// Same as CAST_BXDF, but for BxDF payloads stored in place (see BxDFStorage)
+#define CAST_INLINE_BXDF(TYPE, DATA, PTR, CODE)                                                                     \
+{                                                                                                                   \
+  switch(TYPE) {                                                                                                    \
+    case BxDFType::DIELECTRIC: {                                                                                    \
+                     DielectricBxDF * PTR = reinterpret_cast<DielectricBxDF *>(DATA); CODE break; }                 \
   }                                                                                                                 \
 }
 
+#define CAST_CONST_INLINE_BXDF(TYPE, DATA, PTR, CODE)                                                               \
+{                                                                                                                   \
+  switch(TYPE) {                                                                                                    \
+    case BxDFType::DIELECTRIC: {                                                                                    \
+         const DielectricBxDF * PTR = reinterpret_cast<const DielectricBxDF *>(DATA); CODE break; }                 \
+  }                                                                                                                 \
+}
+
+// *********************************************************************************************************************
+//                                                                                                        BxDFStorage
+// *********************************************************************************************************************
+/// Size and alignment of a buffer able to hold any of the given BxDF payloads by value
+/// \tparam Ts BxDF types
+template<typename... Ts>
+struct BxDFStorage {
+  static_assert((std::is_trivially_copyable_v<Ts> && ...), "inline BxDFs are copied as plain bytes");
+  static constexpr std::size_t max(std::initializer_list<std::size_t> values) {
+    std::size_t m = 0;
+    for (auto v : values)
+      m = v > m ? v : m;
+    return m;
+  }
+  static constexpr std::size_t size = max({sizeof(Ts)...});
+  static constexpr std::size_t alignment = max({alignof(Ts)...});
+};
+
+/// Buffer requirements for all BxDF types (keep in sync with CAST_INLINE_BXDF)
+using InlineBxDFStorage = BxDFStorage<DielectricBxDF>;
+
 struct BxDFs {
   ///
   /// \tparam T
@@ -70,6 +109,8 @@ struct BxDFs {
   static BxDF create(Allocator allocator, P &&... params) {
     BxDF bxdf;
     bxdf.data_ptr = allocator.template allocate<T>(std::forward<P>(params)...);
+    if (bxdf.data_ptr)
+      bxdf.flags = bxdf.data_ptr.template get<T>()->flags();
     bxdf.type = enumFromType<T>();
     return bxdf;
   }
@@ -35,7 +35,11 @@ HERMES_DEVICE_CALLABLE DielectricBxDF::DielectricBxDF() {}
 HERMES_DEVICE_CALLABLE DielectricBxDF::DielectricBxDF(real_t eta, const TrowbridgeReitzDistribution &mf_distribution)
     : eta_(eta), mf_distribution_(mf_distribution) {}
 
-HERMES_DEVICE_CALLABLE DielectricBxDF::~DielectricBxDF() {}
+HERMES_DEVICE_CALLABLE bxdf_flags DielectricBxDF::flags() const {
+  // an index-matched interface only transmits
+  bxdf_flags flags = eta_ == 1 ? bxdf_flags::TRANSMISSION : bxdf_flags::REFLECTION | bxdf_flags::TRANSMISSION;
+  return flags | (mf_distribution_.effectivelySmooth() ? bxdf_flags::SPECULAR : bxdf_flags::GLOSSY);
+}
 
 HERMES_DEVICE_CALLABLE SampledSpectrum DielectricBxDF::f(const hermes::vec3 &wo,
                                                          const hermes::vec3 &wi,
@@ -141,7 +145,7 @@ HERMES_DEVICE_CALLABLE BSDFSampleReturn DielectricBxDF::sample_f(const hermes::v
       if (!Scattering::sameHemisphere(wo, wi))
         return {};
       // Compute PDF of rough dielectric reflection
-      pdf = mf_distribution_.PDF(wo, wm) / (4 * abs(hermes::dot(wo, wm))) * pr / (pr + pt);
+      pdf = mf_distribution_.PDF(wo, wm) / (4 * fabsf(hermes::dot(wo, wm))) * pr / (pr + pt);
 
       HERMES_CHECK_EXP(!hermes::Check::is_nan(pdf))
       SampledSpectrum f(mf_distribution_.D(wm) * mf_distribution_.G(wo, wi) * R /
@@ -158,7 +162,7 @@ HERMES_DEVICE_CALLABLE BSDFSampleReturn DielectricBxDF::sample_f(const hermes::v
         return {};
       // Compute PDF of rough dielectric transmission
       real_t denom = hermes::Numbers::sqr(hermes::dot(wi, wm) + hermes::dot(wo, wm) / eta_p);
-      real_t dwm_dwi = abs(hermes::dot(wi, wm)) / denom;
+      real_t dwm_dwi = fabsf(hermes::dot(wi, wm)) / denom;
       pdf = mf_distribution_.PDF(wo, wm) * dwm_dwi * pt / (pr + pt);
 
       HERMES_CHECK_EXP(!hermes::Check::is_nan(pdf));
@@ -216,12 +220,12 @@ HERMES_DEVICE_CALLABLE real_t DielectricBxDF::PDF(const hermes::vec3 &wo,
   real_t pdf;
   if (reflect) {
     // Compute PDF of rough dielectric reflection
-    pdf = mf_distribution_.PDF(wo, wm) / (4 * abs(hermes::dot(wo, wm))) * pr / (pr + pt);
+    pdf = mf_distribution_.PDF(wo, wm) / (4 * fabsf(hermes::dot(wo, wm))) * pr / (pr + pt);
 
   } else {
     // Compute PDF of rough dielectric transmission
     real_t denom = hermes::Numbers::sqr(hermes::dot(wi, wm) + hermes::dot(wo, wm) / etap);
-    real_t dwm_dwi = abs(hermes::dot(wi, wm)) / denom;
+    real_t dwm_dwi = fabsf(hermes::dot(wi, wm)) / denom;
     pdf = mf_distribution_.PDF(wo, wm) * dwm_dwi * pt / (pr + pt);
   }
   return pdf;
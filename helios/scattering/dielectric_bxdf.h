@@ -44,17 +44,9 @@ public:
   //                                                                                                   STATIC METHODS
   // *******************************************************************************************************************
   static BxDF createBxDF(mem::Ptr data_ptr) {
-    bxdf_flags flags{bxdf_flags::NONE};
-    if (data_ptr.get<DielectricBxDF>()->eta_ == 1)
-      flags = bxdf_flags::TRANSMISSION;
-    flags = flags | bxdf_flags::REFLECTION;
-    if (data_ptr.get<DielectricBxDF>()->mf_distribution_.effectivelySmooth())
-      flags = flags | bxdf_flags::SPECULAR;
-    else
-      flags = flags | bxdf_flags::GLOSSY;
     return {
         .data_ptr = data_ptr,
-        .flags = flags,
+        .flags = data_ptr.get<DielectricBxDF>()->flags(),
         .type = BxDFType::DIELECTRIC
     };
   }
@@ -66,7 +58,6 @@ public:
   // *******************************************************************************************************************
   HERMES_DEVICE_CALLABLE DielectricBxDF();
   HERMES_DEVICE_CALLABLE DielectricBxDF(real_t eta, const TrowbridgeReitzDistribution &mf_distribution);
-  HERMES_DEVICE_CALLABLE ~DielectricBxDF();
   //                                                                                                       assignment
   // *******************************************************************************************************************
   //                                                                                                        OPERATORS
@@ -77,6 +68,8 @@ public:
   // *******************************************************************************************************************
   //                                                                                                          METHODS
   // *******************************************************************************************************************
+  /// \return reflection/transmission and diffuse/glossy/specular properties of this BxDF
+  [[nodiscard]] HERMES_DEVICE_CALLABLE bxdf_flags flags() const;
   /// \param wo outgoing direction
   /// \param wi incident direction
   /// \param mode
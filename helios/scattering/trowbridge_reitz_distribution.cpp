@@ -42,8 +42,6 @@ HERMES_DEVICE_CALLABLE real_t TrowbridgeReitzDistribution::roughness2alpha(real_
 
 HERMES_DEVICE_CALLABLE TrowbridgeReitzDistribution::TrowbridgeReitzDistribution() {}
 
-HERMES_DEVICE_CALLABLE TrowbridgeReitzDistribution::~TrowbridgeReitzDistribution() {}
-
 HERMES_DEVICE_CALLABLE TrowbridgeReitzDistribution::TrowbridgeReitzDistribution(real_t alpha_x, real_t alpha_y)
     : alpha_x_(alpha_x), alpha_y_(alpha_y) {}
 
@@ -62,7 +62,6 @@ public:
   // *******************************************************************************************************************
   HERMES_DEVICE_CALLABLE TrowbridgeReitzDistribution();
   HERMES_DEVICE_CALLABLE TrowbridgeReitzDistribution(real_t alpha_x, real_t alpha_y);
-  HERMES_DEVICE_CALLABLE ~TrowbridgeReitzDistribution();
   //                                                                                                       assignment
   // *******************************************************************************************************************
   //                                                                                                        OPERATORS
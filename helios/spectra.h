@@ -30,6 +30,11 @@
 
 #include <helios/base/spectrum.h>
 #include <helios/spectra/blackbody_spectrum.h>
+#include <helios/spectra/piecewise_linear_spectrum.h>
+#include <helios/spectra/rgb_albedo_spectrum.h>
+#include <helios/spectra/rgb_illuminant_spectrum.h>
+#include <helios/spectra/rgb_unbounded_spectrum.h>
+#include <helios/spectra/spectrum_cache.h>
 
 namespace helios {
 
@@ -38,6 +43,16 @@ namespace helios {
   switch(SPECTRUM.type) {                                                                                           \
     case SpectrumType::BLACKBODY: {                                                                                \
                      BlackbodySpectrum * PTR = SPECTRUM.data_ptr.get<BlackbodySpectrum>(); CODE break; }         \
+    case SpectrumType::RGBA_ALBEDO: {                                                                               \
+         RGBAlbedoSpectrum * PTR = SPECTRUM.data_ptr.get<RGBAlbedoSpectrum>(); CODE break; }                        \
+    case SpectrumType::RGB_UNBOUNDED: {                                                                             \
+         RGBUnboundedSpectrum * PTR = SPECTRUM.data_ptr.get<RGBUnboundedSpectrum>(); CODE break; }                  \
+    case SpectrumType::RGB_ILLUMINATION: {                                                                          \
+         RGBIlluminantSpectrum * PTR = SPECTRUM.data_ptr.get<RGBIlluminantSpectrum>(); CODE break; }                \
+    case SpectrumType::DENSELY_SAMPLED: {                                                                           \
+         DenselySampledSpectrum * PTR = SPECTRUM.data_ptr.get<DenselySampledSpectrum>(); CODE break; }              \
+    case SpectrumType::PIECEWISE_LINEAR: {                                                                          \
+         PiecewiseLinearSpectrum * PTR = SPECTRUM.data_ptr.get<PiecewiseLinearSpectrum>(); CODE break; }            \
   }                                                                                                                 \
 }
 
@@ -46,6 +61,16 @@ namespace helios {
   switch(SPECTRUM.type) {                                                                                           \
     case SpectrumType::BLACKBODY: {                                                                                \
          const BlackbodySpectrum * PTR = SPECTRUM.data_ptr.get<BlackbodySpectrum>(); CODE break; }         \
+    case SpectrumType::RGBA_ALBEDO: {                                                                               \
+         const RGBAlbedoSpectrum * PTR = SPECTRUM.data_ptr.get<RGBAlbedoSpectrum>(); CODE break; }                  \
+    case SpectrumType::RGB_UNBOUNDED: {                                                                             \
+         const RGBUnboundedSpectrum * PTR = SPECTRUM.data_ptr.get<RGBUnboundedSpectrum>(); CODE break; }            \
+    case SpectrumType::RGB_ILLUMINATION: {                                                                          \
+         const RGBIlluminantSpectrum * PTR = SPECTRUM.data_ptr.get<RGBIlluminantSpectrum>(); CODE break; }          \
+    case SpectrumType::DENSELY_SAMPLED: {                                                                           \
+         const DenselySampledSpectrum * PTR = SPECTRUM.data_ptr.get<DenselySampledSpectrum>(); CODE break; }        \
+    case SpectrumType::PIECEWISE_LINEAR: {                                                                          \
+         const PiecewiseLinearSpectrum * PTR = SPECTRUM.data_ptr.get<PiecewiseLinearSpectrum>(); CODE break; }      \
   }                                                                                                                 \
 }
 
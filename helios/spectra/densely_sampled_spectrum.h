@@ -0,0 +1,106 @@
+/// Copyright (c) 2021, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+///\file densely_sampled_spectrum.h
+///\author FilipeCN (filipedecn@gmail.com)
+///\date 2021-10-19
+///
+///\brief
+
+#ifndef HELIOS_HELIOS_SPECTRUM_DENSELY_SAMPLED_SPECTRUM_H
+#define HELIOS_HELIOS_SPECTRUM_DENSELY_SAMPLED_SPECTRUM_H
+
+#include <helios/base/spectrum.h>
+#include <helios/spectra/sampled_wave_lengths.h>
+
+namespace helios {
+
+// *********************************************************************************************************************
+//                                                                                                DenselySampledSpectrum
+// *********************************************************************************************************************
+/// Spectrum sampled at every nanometer of the CIE range [360, 830]. Evaluation is a direct index plus lerp.
+/// Values are stored inline, so the spectrum can be copied around as a single block of memory.
+class DenselySampledSpectrum {
+public:
+  // *******************************************************************************************************************
+  //                                                                                                   STATIC METHODS
+  // *******************************************************************************************************************
+  HERMES_DEVICE_CALLABLE static Spectrum createSpectrum(mem::Ptr data_ptr) {
+    return {
+        .data_ptr = data_ptr,
+        .type = SpectrumType::DENSELY_SAMPLED
+    };
+  }
+  /// Samples a spectrum at every nanometer
+  /// \tparam F real_t(real_t lambda) callable
+  /// \param f
+  /// \return
+  template<typename F>
+  HERMES_DEVICE_CALLABLE static DenselySampledSpectrum sampled(const F &f) {
+    DenselySampledSpectrum s;
+    for (int i = 0; i < n_values; ++i)
+      s.values_[i] = f(static_cast<real_t>(lambda_min + i));
+    return s;
+  }
+  // *******************************************************************************************************************
+  //                                                                                                     CONSTRUCTORS
+  // *******************************************************************************************************************
+  HERMES_DEVICE_CALLABLE DenselySampledSpectrum() {
+    for (real_t &v : values_)
+      v = 0;
+  }
+  // *******************************************************************************************************************
+  //                                                                                                          METHODS
+  // *******************************************************************************************************************
+  /// \param lambda
+  /// \return
+  HERMES_DEVICE_CALLABLE real_t operator()(real_t lambda) const {
+    return evaluateUniformSamples(values_, n_values, lambda_min, 1, lambda);
+  }
+  /// \param lambda
+  /// \return
+  [[nodiscard]] HERMES_DEVICE_CALLABLE SampledSpectrum Sample(const SampledWaveLengths &lambda) const {
+    SampledSpectrum s;
+    for (int i = 0; i < Spectrum::n_samples; ++i)
+      s[i] = (*this)(lambda[i]);
+    return s;
+  }
+  /// \return
+  [[nodiscard]] HERMES_DEVICE_CALLABLE real_t maxValue() const {
+    real_t m = values_[0];
+    for (real_t v : values_)
+      m = fmaxf(m, v);
+    return m;
+  }
+  // *******************************************************************************************************************
+  //                                                                                                    PUBLIC FIELDS
+  // *******************************************************************************************************************
+  static constexpr int lambda_min = CIELambdaStart;
+  static constexpr int lambda_max = CIELambdaEnd;
+  static constexpr int n_values = lambda_max - lambda_min + 1;
+
+protected:
+  real_t values_[n_values];
+};
+
+}
+
+#endif //HELIOS_HELIOS_SPECTRUM_DENSELY_SAMPLED_SPECTRUM_H
@@ -0,0 +1,79 @@
+/// Copyright (c) 2021, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+///\file piecewise_linear_spectrum.h
+///\author FilipeCN (filipedecn@gmail.com)
+///\date 2021-10-19
+///
+///\brief
+
+#ifndef HELIOS_HELIOS_SPECTRUM_PIECEWISE_LINEAR_SPECTRUM_H
+#define HELIOS_HELIOS_SPECTRUM_PIECEWISE_LINEAR_SPECTRUM_H
+
+#include <helios/spectra/densely_sampled_spectrum.h>
+
+namespace helios {
+
+// *********************************************************************************************************************
+//                                                                                               PiecewiseLinearSpectrum
+// *********************************************************************************************************************
+/// Piecewise linear function through arbitrary (lambda, value) samples. The function is resampled at every nanometer
+/// on construction, so evaluation costs the same as a DenselySampledSpectrum instead of a search over the samples.
+class PiecewiseLinearSpectrum : public DenselySampledSpectrum {
+public:
+  // *******************************************************************************************************************
+  //                                                                                                   STATIC METHODS
+  // *******************************************************************************************************************
+  HERMES_DEVICE_CALLABLE static Spectrum createSpectrum(mem::Ptr data_ptr) {
+    return {
+        .data_ptr = data_ptr,
+        .type = SpectrumType::PIECEWISE_LINEAR
+    };
+  }
+  // *******************************************************************************************************************
+  //                                                                                                     CONSTRUCTORS
+  // *******************************************************************************************************************
+  /// \pre lambda must be sorted in increasing order
+  /// \param lambda **[in]** sample wavelengths (nm)
+  /// \param values **[in]** sample values
+  /// \param n number of samples
+  HERMES_DEVICE_CALLABLE PiecewiseLinearSpectrum(const real_t *lambda, const real_t *values, int n) {
+    // the function is zero outside the sampled range
+    int k = 0;
+    for (int i = 0; i < n_values; ++i) {
+      real_t l = lambda_min + i;
+      if (n == 0 || l < lambda[0] || l > lambda[n - 1])
+        continue;
+      while (k < n - 2 && lambda[k + 1] < l)
+        k++;
+      if (n == 1) {
+        values_[i] = values[0];
+        continue;
+      }
+      real_t t = (l - lambda[k]) / (lambda[k + 1] - lambda[k]);
+      values_[i] = (1 - t) * values[k] + t * values[k + 1];
+    }
+  }
+};
+
+}
+
+#endif //HELIOS_HELIOS_SPECTRUM_PIECEWISE_LINEAR_SPECTRUM_H
@@ -0,0 +1,88 @@
+/// Copyright (c) 2021, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+///\file rgb_illuminant_spectrum.h
+///\author FilipeCN (filipedecn@gmail.com)
+///\date 2021-10-19
+///
+///\brief Emission spectrum from a RGB value
+
+#ifndef HELIOS_HELIOS_SPECTRUM_RGB_ILLUMINANT_SPECTRUM_H
+#define HELIOS_HELIOS_SPECTRUM_RGB_ILLUMINANT_SPECTRUM_H
+
+#include <helios/spectra/rgb_unbounded_spectrum.h>
+
+namespace helios {
+
+// *********************************************************************************************************************
+//                                                                                                 RGBIlluminantSpectrum
+// *********************************************************************************************************************
+/// Spectrum of a light with a RGB color: the unbounded RGB spectrum times the color space illuminant (sRGB
+/// uses D65, normalized to unit luminance, so rgb = (1, 1, 1) emits the D65 white with Y = 1)
+class RGBIlluminantSpectrum {
+public:
+  // *******************************************************************************************************************
+  //                                                                                                   STATIC METHODS
+  // *******************************************************************************************************************
+  HERMES_DEVICE_CALLABLE static Spectrum createSpectrum(mem::Ptr data_ptr) {
+    return {
+        .data_ptr = data_ptr,
+        .type = SpectrumType::RGB_ILLUMINATION
+    };
+  }
+  // *******************************************************************************************************************
+  //                                                                                                     CONSTRUCTORS
+  // *******************************************************************************************************************
+  /// \param table color space table
+  /// \param rgb non-negative rgb values
+  HERMES_DEVICE_CALLABLE RGBIlluminantSpectrum(const RGBToSpectrumTable &table, const real_t rgb[3])
+      : rsp_(table, rgb) {}
+  // *******************************************************************************************************************
+  //                                                                                                          METHODS
+  // *******************************************************************************************************************
+  /// \param lambda
+  /// \return
+  HERMES_DEVICE_CALLABLE real_t operator()(real_t lambda) const {
+    return rsp_(lambda) * illuminantD65(lambda);
+  }
+  /// \param lambda
+  /// \return
+  [[nodiscard]] HERMES_DEVICE_CALLABLE SampledSpectrum Sample(const SampledWaveLengths &lambda) const {
+    SampledSpectrum s;
+    for (int i = 0; i < Spectrum::n_samples; ++i)
+      s[i] = (*this)(lambda[i]);
+    return s;
+  }
+  /// \return
+  [[nodiscard]] HERMES_DEVICE_CALLABLE real_t maxValue() const {
+    return rsp_.maxValue() * d65_peak_ * CIE_Illum_D6500_normalization;
+  }
+  // *******************************************************************************************************************
+  //                                                                                                    PUBLIC FIELDS
+  // *******************************************************************************************************************
+private:
+  RGBUnboundedSpectrum rsp_;
+  static constexpr real_t d65_peak_ = 117.812f; // at 460 nm
+};
+
+}
+
+#endif //HELIOS_HELIOS_SPECTRUM_RGB_ILLUMINANT_SPECTRUM_H
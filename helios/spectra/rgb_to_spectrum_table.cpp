@@ -0,0 +1,4664 @@
+/// Copyright (c) 2021, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+///\file rgb_to_spectrum_table.cpp
+///\author FilipeCN (filipedecn@gmail.com)
+///\date 2021-10-19
+///
+///\brief
+
+#include <helios/spectra/rgb_to_spectrum_table.h>
+
+namespace helios {
+
+// sRGB coefficients, generated by tools/rgb_to_spectrum_table.cpp: Levenberg-Marquardt fitting of each grid point
+// (warm started from its neighbor along z) in CIELAB against the CIE 1931 matching functions under illuminant D65.
+// Coefficients are stored for wavelengths in nm. Worst CIELAB fitting error is ~1.2 (at black), RGB round trip error
+// is 0.0023 on average and 0.045 at most.
+#define SRGB_TO_SPECTRUM_TABLE {                                                                                      \
+  { /* z nodes */                                                                                                   \
+    0.0f, 0.00048284311f, 0.0068542426f, 0.030198272f, 0.081509493f, 0.16679367f, 0.28448358f, 0.42535999f, 0.57463998f, 0.71551639f, 0.8332063f, 0.91849053f, 0.96980172f, 0.99314576f, 0.99951714f, 1.0f \
+  }, {                                                                                                              \
+    -0.00027082115f, 0.52171791f, -352.72003f, -0.00036845088f, 0.59262484f, -359.8526f, -0.0003925573f, 0.60958713f, \
+    -360.88977f, -0.00056925847f, 0.7188735f, -360.3446f, -0.0007451874f, 0.83714646f, -367.23889f, -0.0008780582f, \
+    0.93054116f, -375.5827f, -0.00090538705f, 0.90709198f, -343.41116f, -0.00090538705f, 0.922566f, -353.44949f, \
+    -0.00090538705f, 0.87457001f, -321.47491f, -0.00090538705f, 0.82844704f, -293.70456f, -0.00090538705f, 0.79410601f, \
+    -274.29016f, -0.00090538705f, 0.76432753f, -258.36221f, -0.00090538705f, 0.7459181f, -248.87514f, -0.00090538705f, \
+    0.74598199f, -248.83771f, -0.00090538705f, 0.73006058f, -240.71594f, -0.00090538705f, 0.72203052f, -236.6739f, \
+    0.00066833227f, -0.66361737f, 22.970846f, 0.00017657116f, -0.12438022f, -122.36977f, -0.00010496154f, 0.25933218f, \
+    -253.65114f, -0.00045666617f, 0.60141212f, -330.32651f, -0.00058120175f, 0.72687531f, -360.95441f, -0.00080914778f, \
+    0.88377023f, -372.0405f, -0.00090538705f, 0.93660539f, -365.32324f, -0.00090538705f, 0.87693429f, -323.07053f, \
+    -0.00090538705f, 0.89084095f, -331.76218f, -0.00090538705f, 0.84638286f, -304.03149f, -0.00090538705f, 0.80329293f, \
+    -279.69562f, -0.00090538705f, 0.77138519f, -262.20764f, -0.00090538705f, 0.75114185f, -251.58168f, -0.00090538705f, \
+    0.75024104f, -251.00389f, -0.00090538705f, 0.7323631f, -242.01904f, -0.00090538705f, 0.71779519f, -234.675f, \
+    0.00066561071f, -0.67724764f, 32.911461f, 0.00066828803f, -0.74396867f, 74.38485f, 0.00044757212f, -0.49585825f, \
+    5.088047f, 0.00014930932f, -0.15504995f, -92.186523f, -5.811673e-05f, 0.085712373f, -162.29301f, -0.0002640718f, \
+    0.31389141f, -225.62093f, -0.00068872672f, 0.71525973f, -313.37869f, -0.00090538705f, 0.90544993f, -341.93405f, \
+    -0.00090538705f, 0.84622228f, -303.99921f, -0.00090538705f, 0.85819072f, -311.18103f, -0.00090538705f, 0.81831104f, \
+    -287.83609f, -0.00090538705f, 0.78228897f, -267.93896f, -0.00090538705f, 0.75664008f, -254.54805f, -0.00090538705f, \
+    0.73682082f, -244.26471f, -0.00090538705f, 0.73655766f, -243.85339f, -0.00090538705f, 0.7196734f, -235.5992f, \
+    0.00067709875f, -0.82742995f, 122.97318f, 0.00068766339f, -0.80281591f, 103.69804f, 0.00069070497f, -0.79544538f, \
+    97.914742f, 0.00049880124f, -0.58406228f, 40.470581f, 0.00027070564f, -0.32294792f, -34.628555f, 9.2589828e-05f, \
+    -0.11430017f, -95.661507f, -0.00011199983f, 0.10928669f, -156.57761f, -0.00051450299f, 0.48416507f, -236.3853f, \
+    -0.00080845784f, 0.77915961f, -309.20187f, -0.00090538705f, 0.83942658f, -300.55875f, -0.00090538705f, 0.8255468f, \
+    -292.16534f, -0.00090538705f, 0.79268843f, -273.74615f, -0.00090538705f, 0.76086789f, -256.57321f, -0.00090538705f, \
+    0.74168801f, -246.64186f, -0.00090538705f, 0.73841196f, -245.10596f, -0.00090538705f, 0.72518545f, -237.76707f, \
+    0.00069996784f, -0.86878049f, 139.22768f, 0.00069052662f, -0.87252223f, 144.75677f, 0.0006943862f, -0.83512527f, \
+    120.72838f, 0.00066783046f, -0.79134506f, 104.02305f, 0.00049951539f, -0.60638005f, 54.284775f, 0.00032157666f, \
+    -0.39764372f, -7.5645032f, 0.00015056434f, -0.20021491f, -64.606628f, -0.00016560227f, 0.093069084f, -126.66945f, \
+    -0.00045941089f, 0.39268282f, -201.72319f, -0.00072572962f, 0.66071332f, -268.01413f, -0.00090538705f, 0.83591896f, \
+    -303.62701f, -0.00090538705f, 0.8272599f, -293.85788f, -0.00090538705f, 0.77712572f, -265.21552f, -0.00090538705f, \
+    0.74646115f, -249.13943f, -0.00090538705f, 0.74168313f, -246.79163f, -0.00090538705f, 0.72533923f, -238.291f, \
+    0.000714558f, -0.93828958f, 174.32368f, 0.0007071477f, -0.8886888f, 148.48856f, 0.00070231169f, -0.86519998f, \
+    135.74986f, 0.00069402455f, -0.87183416f, 143.26656f, 0.00066081609f, -0.81459379f, 120.83967f, 0.00049410493f, \
+    -0.6154331f, 61.353966f, 0.00034380407f, -0.43503082f, 7.3672209f, 0.00016021859f, -0.23247093f, -48.058533f, \
+    -0.0001744309f, 0.075973608f, -113.27077f, -0.00044888211f, 0.35659456f, -184.05881f, -0.00069198268f, 0.6023643f, \
+    -244.87302f, -0.00090296089f, 0.8130728f, -296.76843f, -0.00090538705f, 0.82357019f, -292.76343f, -0.00090538705f, \
+    0.77004284f, -261.62f, -0.00090538705f, 0.73328972f, -242.46866f, -0.00090538705f, 0.72716928f, -239.28795f, \
+    0.00072107289f, -0.94470441f, 176.62436f, 0.0007109642f, -0.93117821f, 171.66261f, 0.00071383867f, -0.90664226f, \
+    156.29068f, 0.00071038649f, -0.8854177f, 145.22308f, 0.00070038857f, -0.86033487f, 133.83199f, 0.00062448176f, \
+    -0.78341657f, 115.07822f, 0.00048906874f, -0.61742371f, 64.798943f, 0.00032807505f, -0.43526587f, 13.120324f, \
+    5.0488492e-05f, -0.17877105f, -40.829456f, -0.00020782789f, 0.090006642f, -109.87184f, -0.00045798926f, 0.34670982f, \
+    -174.64319f, -0.00068279129f, 0.57269061f, -230.58307f, -0.0008212945f, 0.74063206f, -282.28564f, -0.00090538705f, \
+    0.81428939f, -288.74707f, -0.00090538705f, 0.76693344f, -259.81403f, -0.00090538705f, 0.73574495f, -243.7009f, \
+    0.00065471738f, -0.89692843f, 178.98895f, 0.00070722954f, -0.93473721f, 178.16795f, 0.00072765944f, -0.94561708f, \
+    174.47693f, 0.00072116754f, -0.92365038f, 163.60886f, 0.00069583312f, -0.9014374f, 159.75722f, 0.00068183389f, \
+    -0.86233556f, 141.73822f, 0.00059991499f, -0.76001072f, 110.12495f, 0.0004684178f, -0.60264558f, 63.285374f, \
+    0.00029757837f, -0.41577935f, 12.43193f, -2.9890696e-06f, -0.14000627f, -45.284409f, -0.00025139746f, 0.11816341f, \
+    -111.46899f, -0.00048032272f, 0.35191873f, -170.25711f, -0.00063294434f, 0.53845865f, -227.53275f, -0.0008216452f, \
+    0.72198421f, -271.20807f, -0.00090538705f, 0.79945624f, -281.13144f, -0.00090538705f, 0.76862866f, -260.98761f, \
+    0.0006114468f, -0.86577362f, 184.71138f, 0.00063552521f, -0.88311005f, 179.01616f, 0.00061589811f, -0.86897856f, \
+    178.11974f, 0.00072022184f, -0.94409162f, 177.95581f, 0.00069403544f, -0.92523742f, 178.15846f, 0.00071145856f, \
+    -0.9280293f, 169.40321f, 0.00068885041f, -0.87428319f, 146.31366f, 0.00057027012f, -0.73181725f, 103.97859f, \
+    0.00041581396f, -0.56132728f, 57.493828f, 0.00015921151f, -0.32486656f, 7.6230884f, -7.1955845e-05f, -0.08159034f, \
+    -55.759041f, -0.00029940234f, 0.15334468f, -115.69318f, -0.00050520018f, 0.36369747f, -169.25526f, -0.00065726123f, \
+    0.54581982f, -223.59689f, -0.0008248252f, 0.71042311f, -263.49097f, -0.00090538705f, 0.78386551f, -273.21326f, \
+    0.00061235059f, -0.86642432f, 189.58807f, 0.0006131173f, -0.86697638f, 188.0955f, 0.00061225303f, -0.86635405f, \
+    183.9971f, 0.00061237713f, -0.86644346f, 180.77122f, 0.00070024922f, -0.92971134f, 178.72768f, 0.00073124276f, \
+    -0.94639009f, 173.41811f, 0.00071451679f, -0.92825061f, 168.59366f, 0.00069543783f, -0.88775486f, 152.25519f, \
+    0.00051417464f, -0.683599f, 95.218498f, 0.00035919144f, -0.51218963f, 48.126183f, 7.938101e-05f, -0.25261417f, \
+    -7.6487966f, -0.00014162908f, -0.021363527f, -67.366539f, -0.00034914399f, 0.19118218f, -121.17896f, -0.00050765031f, \
+    0.38326052f, -179.4899f, -0.0006852916f, 0.55795848f, -221.56595f, -0.00083616661f, 0.70716506f, -257.85672f, \
+    0.00060572982f, -0.86165738f, 192.85843f, 0.00060892111f, -0.86395508f, 192.03755f, 0.00061365316f, -0.8673622f, \
+    188.79295f, 0.00061422167f, -0.86777151f, 187.29092f, 0.00062273192f, -0.87389892f, 178.93991f, 0.00068013172f, \
+    -0.91522676f, 179.45424f, 0.00068343413f, -0.91760451f, 177.19737f, 0.00071071228f, -0.93386501f, 172.80428f, \
+    0.00070271984f, -0.89745569f, 154.85405f, 0.00045327755f, -0.63012934f, 84.962395f, 0.00020335488f, -0.39556444f, \
+    33.236946f, -6.3848634e-06f, -0.17350779f, -24.910793f, -0.00016887889f, 0.029403124f, -87.551018f, -0.00037076054f, \
+    0.23358478f, -138.44299f, -0.00055267155f, 0.41409343f, -182.5406f, -0.0007074587f, 0.56974435f, -220.78639f, \
+    0.00058916537f, -0.84973097f, 194.59241f, 0.00059477543f, -0.85377026f, 193.86636f, 0.00060601154f, -0.86186022f, \
+    192.41708f, 0.00061052141f, -0.8651073f, 191.44449f, 0.0006126365f, -0.8666302f, 190.11955f, 0.00061319658f, \
+    -0.86703348f, 181.75203f, 0.00063954666f, -0.88600552f, 178.63768f, 0.00069367723f, -0.92497951f, 177.56618f, \
+    0.00069008692f, -0.92239451f, 177.57315f, 0.00067783176f, -0.88038993f, 153.74786f, 0.00037483589f, -0.55821925f, \
+    69.707947f, 0.00016806643f, -0.33526522f, 10.674714f, -4.6384419e-05f, -0.11109118f, -47.587063f, -0.00024621148f, \
+    0.095656112f, -99.922523f, -0.00043108797f, 0.2806522f, -145.9718f, -0.00059008953f, 0.44176856f, -186.18379f, \
+    0.00053870282f, -0.81339794f, 192.53391f, 0.00044530691f, -0.74615288f, 182.79715f, 0.00050920597f, -0.79216021f, \
+    189.7849f, 0.00060572656f, -0.86165506f, 193.01854f, 0.00060548208f, -0.86147904f, 193.44626f, 0.00060771388f, \
+    -0.86308587f, 192.53339f, 0.00061300129f, -0.86689281f, 187.10826f, 0.00061391236f, -0.86754882f, 178.05577f, \
+    0.00070574717f, -0.93366987f, 177.95035f, 0.00069667865f, -0.92714053f, 177.04559f, 0.00045878932f, -0.66450745f, \
+    102.70877f, 0.00027111918f, -0.46033975f, 47.927761f, 6.413638e-05f, -0.23958601f, -10.188084f, -0.00013442307f, \
+    -0.032213934f, -63.674095f, -0.00031830787f, 0.15620811f, -111.31168f, -0.00048450922f, 0.32360572f, -152.76579f, \
+    -0.00090538705f, 0.22634676f, 8.8972521f, 0.00049555511f, -0.78233159f, 188.44513f, 0.00053805485f, -0.81293142f, \
+    192.34792f, 0.00058122189f, -0.84401166f, 194.7829f, 0.0005914786f, -0.8513965f, 194.31839f, 0.00060212536f, \
+    -0.85906219f, 194.13985f, 0.00060488994f, -0.86105269f, 193.23741f, 0.00061357406f, -0.86730522f, 183.66904f, \
+    0.00064625678f, -0.89083683f, 178.39749f, 0.00063157972f, -0.88026929f, 178.56963f, 0.00069107645f, -0.92310697f, \
+    177.04773f, 0.00036111206f, -0.57210559f, 81.811661f, 0.00016256771f, -0.35767978f, 24.730536f, -3.1382893e-05f, \
+    -0.15121661f, -29.268192f, -0.00021574335f, 0.039296489f, -78.265068f, -0.00044384506f, 0.27938488f, -140.91263f, \
+    -0.00090538705f, 0.22635609f, 9.5125275f, -0.00090538705f, 0.22634676f, 9.0664463f, -0.00090538705f, 0.22634676f, \
+    8.9257269f, 0.00049738982f, -0.7836526f, 188.6407f, 0.0003729857f, -0.6940816f, 174.07941f, 0.00056875154f, \
+    -0.835033f, 194.22003f, 0.00059000036f, -0.8503322f, 194.13574f, 0.00061134069f, -0.86569721f, 188.19418f, \
+    0.00061427458f, -0.86780965f, 185.22011f, 0.00064959103f, -0.89323747f, 178.62927f, 0.00066164887f, -0.90191907f, \
+    178.99527f, 0.00056986959f, -0.80667895f, 146.46364f, 0.00025152424f, -0.46732318f, 57.513775f, 6.1701707e-05f, \
+    -0.26277679f, 3.3676007f, -0.00011639422f, -0.071038663f, -47.656948f, -0.00033640635f, 0.15846288f, -106.75452f, \
+    -0.00090538705f, 0.22634676f, 10.594627f, -0.00090538705f, 0.22634676f, 10.142753f, -0.00090538705f, 0.22634676f, \
+    9.6088762f, -0.00090538705f, 0.22634676f, 9.1676798f, 0.00035777508f, -0.68312997f, 172.14352f, 0.00049320754f, \
+    -0.78064132f, 188.19289f, 0.00056742848f, -0.83408046f, 194.22784f, 0.00060798792f, -0.86328322f, 190.63342f, \
+    0.00061301811f, -0.86690491f, 188.40936f, 0.00061152526f, -0.86583006f, 179.89438f, 0.00061110314f, -0.8655262f, \
+    180.72882f, 0.00063142437f, -0.88015747f, 175.48265f, 0.00043745097f, -0.67557019f, 115.03762f, 0.00021026962f, \
+    -0.42957303f, 49.609192f, -1.8191208e-06f, -0.20309967f, -9.9700813f, -0.00021865178f, 0.023896566f, -68.835915f, \
+    -7.368729e-05f, 0.47858676f, -310.84665f, -0.00023102757f, 0.59187174f, -311.10956f, -0.00032427371f, 0.65900898f, \
+    -311.87503f, -0.00040535184f, 0.71738523f, -314.05066f, -0.00051295792f, 0.79486161f, -319.68097f, -0.00060802919f, \
+    0.86331296f, -325.05914f, -0.00068556803f, 0.91914088f, -329.53366f, -0.00074869784f, 0.96459436f, -333.19144f, \
+    -0.00080037967f, 1.0018053f, -336.17032f, -0.0008430173f, 1.0325044f, -338.59973f, -0.00087849051f, 1.058045f, \
+    -340.5885f, -0.00090538705f, 1.076143f, -341.24487f, -0.00090538705f, 1.0652647f, -334.22028f, -0.00090538705f, \
+    1.0561458f, -328.28473f, -0.00090538705f, 1.0485015f, -323.26855f, -0.00090538705f, 1.042008f, -318.97162f, \
+    0.00090538705f, -0.7450034f, 61.790291f, 0.00039242371f, -0.18013288f, -78.844917f, -1.6285949e-05f, 0.28842744f, \
+    -204.51711f, -0.00027782813f, 0.5825671f, -281.6441f, -0.00044917231f, 0.748936f, -316.59402f, -0.000559584f, \
+    0.82843238f, -322.69797f, -0.0006494433f, 0.89313108f, -327.85046f, -0.00072231767f, 0.94560063f, -332.07327f, \
+    -0.00078110961f, 0.98793083f, -335.47382f, -0.00082907313f, 1.0224645f, -338.2204f, -0.00086855475f, 1.0508913f, \
+    -340.44586f, -0.00090135902f, 1.0745105f, -342.25806f, -0.00090538705f, 1.0672134f, -335.89059f, -0.00090538705f, \
+    1.0573057f, -329.44678f, -0.00090538705f, 1.0490739f, -324.04642f, -0.00090538705f, 1.0421455f, -319.45987f, \
+    0.00090538705f, -0.76016307f, 72.871109f, 0.00090538705f, -0.84708542f, 135.17561f, 0.00061146467f, -0.51534599f, \
+    48.490086f, 0.00031339691f, -0.17157103f, -44.874542f, 9.0906135e-05f, 0.082000852f, -113.01139f, -0.00012367917f, \
+    0.31989861f, -175.76349f, -0.00042302007f, 0.64023429f, -258.59821f, -0.00069094117f, 0.92300957f, -330.68509f, \
+    -0.00075849559f, 0.97164875f, -334.60339f, -0.00081291789f, 1.0108328f, -337.73602f, -0.00085719582f, 1.0427129f, \
+    -340.24692f, -0.00089357537f, 1.0689062f, -342.26831f, -0.00090538705f, 1.0693914f, -337.73627f, -0.00090538705f, \
+    1.058596f, -330.72275f, -0.00090538705f, 1.0496668f, -324.86661f, -0.00090538705f, 1.0422508f, -319.95569f, \
+    0.00090538705f, -0.91992623f, 188.27521f, 0.00090538705f, -0.90163434f, 174.65044f, 0.00090538705f, -0.89522892f, \
+    169.52829f, 0.00063094037f, -0.57702476f, 82.4133f, 0.00040540964f, -0.31721693f, 11.744672f, 0.00021806353f, \
+    -0.1041305f, -45.681507f, 2.5157426e-05f, 0.10957025f, -102.30706f, -0.00022836214f, 0.38189131f, -173.12436f, \
+    -0.00046916277f, 0.63875753f, -239.60954f, -0.00068444927f, 0.86763597f, -298.69278f, -0.00084408507f, 1.0332732f, \
+    -339.97406f, -0.00088473491f, 1.0625411f, -342.24808f, -0.00090538705f, 1.0718367f, -339.78403f, -0.00090538705f, \
+    1.0599664f, -332.08243f, -0.00090538705f, 1.0502766f, -325.7309f, -0.00090538705f, 1.0423112f, -320.4548f, \
+    0.00090538705f, -0.94875854f, 209.02682f, 0.00090538705f, -0.93782401f, 200.76897f, 0.00090538705f, -0.92604792f, \
+    191.83957f, 0.00082981249f, -0.83125359f, 162.32735f, 0.00060576864f, -0.57231843f, 91.645027f, 0.00042446223f, \
+    -0.36431077f, 35.152351f, 0.00025790272f, -0.1763784f, -15.335901f, 7.4054537e-05f, 0.025658945f, -68.71405f, \
+    -0.00015106877f, 0.26730248f, -131.61726f, -0.00035926112f, 0.48978955f, -189.36064f, -0.00054686196f, 0.68976998f, \
+    -241.16591f, -0.00071559718f, 0.86928463f, -287.59485f, -0.00086749712f, 1.0306196f, -329.26059f, -0.00090538705f, \
+    1.0614694f, -333.56421f, -0.00090538705f, 1.050899f, -326.64105f, -0.00090538705f, 1.04231f, -320.95056f, \
+    0.00090538705f, -0.96183509f, 218.42354f, 0.00090538705f, -0.95495462f, 213.11067f, 0.00090538705f, -0.94667411f, \
+    206.74168f, 0.00090538705f, -0.93760806f, 199.74634f, 0.00074456836f, -0.7494427f, 147.24956f, 0.00056735834f, \
+    -0.54543841f, 91.682755f, 0.00041224743f, -0.36876035f, 43.883671f, 0.00025651322f, -0.19494434f, -2.5388365f, \
+    7.3170158e-05f, 0.0044233315f, -54.910313f, -0.00012596657f, 0.21798703f, -110.5143f, -0.00030756005f, 0.41221818f, \
+    -160.99567f, -0.0004720962f, 0.58787906f, -206.59088f, -0.00062112545f, 0.74675143f, -247.78224f, -0.00075628544f, \
+    0.89066249f, -285.05667f, -0.00087907759f, 1.021265f, -318.85095f, -0.00090538705f, 1.0422237f, -321.43332f, \
+    0.00090538705f, -0.97030091f, 224.49797f, 0.00090538705f, -0.96532053f, 220.57007f, 0.00090538705f, -0.95974183f, \
+    216.16707f, 0.00090538705f, -0.95298576f, 210.87044f, 0.00084533665f, -0.87842333f, 187.8788f, 0.00067242753f, \
+    -0.67908144f, 133.5309f, 0.00052344898f, -0.50863731f, 87.273094f, 0.00038090235f, -0.34811103f, 44.134155f, \
+    0.00022942938f, -0.18103859f, -0.17655492f, 4.8729329e-05f, 0.013827606f, -51.114326f, -0.00012626917f, 0.20145547f, \
+    -99.979813f, -0.00028590838f, 0.37229881f, -144.42255f, -0.00043123329f, 0.52761239f, -184.78929f, -0.00056360679f, \
+    0.66893202f, -221.49066f, -0.00068436441f, 0.79773504f, -254.91788f, -0.00079473673f, 0.91537064f, -285.42664f, \
+    0.00090538705f, -0.97657621f, 228.99164f, 0.00090538705f, -0.97306079f, 226.12471f, 0.00090538705f, -0.96889544f, \
+    222.75639f, 0.00090538705f, -0.96390289f, 218.75284f, 0.00090538705f, -0.95809662f, 214.11279f, 0.00075237668f, \
+    -0.78112656f, 165.60156f, 0.00060809316f, -0.61568117f, 120.63904f, 0.00047460146f, -0.46441782f, 79.824364f, \
+    0.0003377705f, -0.31222969f, 39.235703f, 0.00018268771f, -0.14341167f, -5.1719103f, 1.5248434e-05f, 0.03649959f, \
+    -52.101833f, -0.00013930439f, 0.20219374f, -95.26712f, -0.00028062638f, 0.3535057f, -134.65627f, -0.00040982646f, \
+    0.4917036f, -170.61041f, -0.00052808161f, 0.61809617f, -203.4765f, -0.00063649914f, 0.73389989f, -233.57509f, \
+    0.00090538705f, -0.981601f, 232.57851f, 0.00090538705f, -0.9788475f, 230.27016f, 0.00090538705f, -0.97583348f, \
+    227.73753f, 0.00090538705f, -0.97197539f, 224.56955f, 0.00090538705f, -0.96754169f, 220.94084f, 0.00081458571f, \
+    -0.86084777f, 190.76704f, 0.0006745063f, -0.70003641f, 147.0455f, 0.00054704648f, -0.55508345f, 107.8483f, \
+    0.0004192676f, -0.41218826f, 69.604836f, 0.00028347378f, -0.26301259f, 30.128405f, 0.00012817727f, -0.095522456f, \
+    -13.669871f, -2.1300799e-05f, 0.064955056f, -55.517147f, -0.00015856902f, 0.21213204f, -93.870911f, -0.00028446352f, \
+    0.34699136f, -128.99876f, -0.00040001603f, 0.47068721f, -161.20718f, -0.00050623214f, 0.58432716f, -190.78801f, \
+    0.00090538705f, -0.98572797f, 235.51347f, 0.00090538705f, -0.98375595f, 233.767f, 0.00090538705f, -0.98123872f, \
+    231.60899f, 0.00090538705f, -0.97825766f, 229.08508f, 0.00090538705f, -0.9748463f, 226.20921f, 0.0008636993f, \
+    -0.92409426f, 210.84056f, 0.00072762038f, -0.76779437f, 168.35223f, 0.00060476491f, -0.62778109f, 130.45078f, \
+    0.00048427749f, -0.49244773f, 94.134941f, 0.00035985882f, -0.35492304f, 57.598454f, 0.00021949745f, -0.20268968f, \
+    17.644617f, 7.5305325e-05f, -0.04768765f, -22.806475f, -5.7972073e-05f, 0.095368937f, -60.113918f, -0.00018055964f, \
+    0.2268372f, -94.387199f, -0.00029335072f, 0.3477245f, -125.89445f, -0.00039725934f, 0.45904034f, -154.90166f, \
+    0.00090538705f, -0.98941433f, 238.10805f, 0.00090538705f, -0.98766547f, 236.54434f, 0.00090538705f, -0.98566794f, \
+    234.7702f, 0.00090538705f, -0.98333281f, 232.72176f, 0.00090538705f, -0.98067713f, 230.40306f, 0.0009028046f, \
+    -0.97475606f, 227.02773f, 0.00077064481f, -0.8229441f, 185.78273f, 0.00065169425f, -0.68721318f, 149.02666f, \
+    0.00053713395f, -0.55809742f, 114.31302f, 0.0004199782f, -0.42808947f, 79.691315f, 0.00029272225f, -0.28925756f, \
+    43.117805f, 0.0001554473f, -0.14140043f, 4.4860911f, 2.605086e-05f, -0.0023828989f, -31.786558f, -9.3293573e-05f, \
+    0.12572682f, -65.203941f, -0.00020333896f, 0.24378796f, -95.995712f, -0.00030491533f, 0.35272002f, -124.40417f, \
+    0.00090538705f, -0.99216986f, 240.03642f, 0.00090538705f, -0.99093968f, 238.855f, 0.00090538705f, -0.9893688f, \
+    237.39967f, 0.00090538705f, -0.98754203f, 235.72646f, 0.00090538705f, -0.98546118f, 233.83255f, 0.00090538705f, \
+    -0.98311287f, 231.70219f, 0.00080578233f, -0.86823326f, 200.18159f, 0.00069035648f, -0.73643595f, 164.49365f, \
+    0.00058050506f, -0.61233377f, 131.08937f, 0.00046878212f, -0.48801279f, 97.931465f, 0.00035162279f, -0.35954055f, \
+    63.979134f, 0.00022260765f, -0.22018692f, 27.506918f, 9.698655e-05f, -0.085119493f, -7.7479105f, -1.9209778e-05f, \
+    0.039707609f, -40.322449f, -0.00012656448f, 0.15497646f, -70.400841f, -0.00022582903f, 0.26152247f, -98.203232f, \
+    0.00090538705f, -0.9943381f, 241.53806f, 0.00090538705f, -0.99353033f, 240.66473f, 0.00090538705f, -0.99247336f, \
+    239.58824f, 0.00090538705f, -0.99109101f, 238.24631f, 0.00090538705f, -0.98946452f, 236.6906f, 0.00090538705f, \
+    -0.9876405f, 234.94867f, 0.00083459297f, -0.90561152f, 212.14899f, 0.00072248082f, -0.77756482f, 177.49173f, \
+    0.0006165118f, -0.65766251f, 145.19966f, 0.0005094026f, -0.53821456f, 113.3064f, 0.00039956407f, -0.41730344f, \
+    81.278641f, 0.00027898198f, -0.28662249f, 47.006832f, 0.00015739485f, -0.15577506f, 12.839783f, 4.4238841e-05f, \
+    -0.034134187f, -18.912325f, -6.0500206e-05f, 0.078404129f, -48.288639f, -0.00015749827f, 0.1825946f, -75.488144f, \
+    0.00090538705f, -0.99620867f, 242.82156f, 0.00090538705f, -0.99563634f, 242.11928f, 0.00090538705f, -0.99494123f, \
+    241.30725f, 0.00090538705f, -0.99404627f, 240.32544f, 0.00090538705f, -0.99286222f, 239.10098f, 0.00090538705f, \
+    -0.99146539f, 237.67842f, 0.00085818261f, -0.93646437f, 222.11195f, 0.00074930728f, -0.81212574f, 188.48465f, \
+    0.00064669951f, -0.69591463f, 157.18275f, 0.00054369518f, -0.58083528f, 126.43103f, 0.00043929325f, -0.46559006f, \
+    95.857285f, 0.00032623467f, -0.34265867f, 63.554424f, 0.00020919953f, -0.21655528f, 30.606337f, 9.8974502e-05f, \
+    -0.097997703f, -0.34685108f, -3.2330695e-06f, 0.011886116f, -29.03747f, -9.8023273e-05f, 0.11377017f, -55.643406f, \
+    0.00090538705f, -0.99788046f, 243.95871f, 0.00090538705f, -0.99747676f, 243.3783f, 0.00090538705f, -0.99699539f, \
+    242.72168f, 0.00090538705f, -0.99641156f, 241.96768f, 0.00090538705f, -0.9956736f, 241.07356f, 0.00090538705f, \
+    -0.99470514f, 239.97415f, 0.00087724952f, -0.96167105f, 230.34294f, 0.00077174639f, -0.84124404f, 197.81549f, \
+    0.00067217526f, -0.72841364f, 167.43117f, 0.00057284045f, -0.61727142f, 137.71562f, 0.00047266105f, -0.50647342f, \
+    108.29395f, 0.0003660802f, -0.39023298f, 77.695328f, 0.0002538714f, -0.26914763f, 46.033833f, 0.00014647722f, \
+    -0.15357637f, 15.856553f, 4.6714045e-05f, -0.046264637f, -12.167344f, -4.5933353e-05f, 0.053372093f, -38.192558f, \
+    0.00090538705f, -0.99939924f, 244.98282f, 0.00090538705f, -0.99913096f, 244.49957f, 0.00090538705f, -0.99880838f, \
+    243.95784f, 0.00090538705f, -0.99842149f, 243.34706f, 0.00090538705f, -0.9979533f, 242.65077f, 0.00090538705f, \
+    -0.9973706f, 241.83884f, 0.00089179771f, -0.98125571f, 236.8558f, 0.00079046219f, -0.86574346f, 205.73618f, \
+    0.00069375162f, -0.7561391f, 176.23738f, 0.00059770123f, -0.64855319f, 147.46529f, 0.00050097669f, -0.54143351f, \
+    119.00562f, 0.00039979967f, -0.43079981f, 89.840813f, 0.00029251119f, -0.31482226f, 59.48698f, 0.00018790638f, \
+    -0.2021969f, 30.075966f, 9.0501264e-05f, -0.097373255f, 2.6987338f, -7.0731218e-08f, 8.0046288e-05f, -22.760519f, \
+    -0.00050361024f, 0.77166706f, -294.01111f, -0.00055972394f, 0.80094904f, -288.5484f, -0.00063905329f, 0.86284679f, \
+    -295.74155f, -0.00071414222f, 0.92532361f, -305.4201f, -0.00077738758f, 0.97863561f, -314.17093f, -0.00082929106f, \
+    1.0223311f, -321.40482f, -0.00086154055f, 1.0458411f, -323.70673f, -0.00088795536f, 1.0648597f, -325.47272f, \
+    -0.00090538705f, 1.0752347f, -325.32394f, -0.00090538705f, 1.0668674f, -320.2291f, -0.00090538705f, 1.0597681f, \
+    -315.90732f, -0.00090538705f, 1.053684f, -312.20306f, -0.00090538705f, 1.0484236f, -308.99875f, -0.00090538705f, \
+    1.0438392f, -306.20407f, -0.00090538705f, 1.0398155f, -303.74881f, -0.00090538705f, 1.03626f, -301.57681f, \
+    0.00048946316f, -0.46976134f, 90.232224f, 0.00020712703f, -0.15343417f, 5.816227f, 5.2642448e-05f, 0.017914871f, \
+    -39.370319f, -5.2847619e-05f, 0.13315971f, -69.288239f, -0.00015085751f, 0.23795211f, -96.085518f, -0.00024903819f, \
+    0.34140241f, -122.31262f, -0.00033454795f, 0.43079704f, -144.82396f, -0.00040766539f, 0.50675774f, -163.83267f, \
+    -0.00047008507f, 0.57124406f, -179.8712f, -0.00052349787f, 0.62613815f, -193.43982f, -0.00056936149f, 0.67303646f, \
+    -204.95856f, -0.00060888426f, 0.71324915f, -214.76988f, -0.00064305705f, 0.74784303f, -223.15129f, -0.00067269179f, \
+    0.77768761f, -230.32805f, -0.00069845619f, 0.80349463f, -236.4839f, -0.00072090217f, 0.82585013f, -241.76974f, \
+    0.00068423589f, -0.71351296f, 165.78435f, 0.00041024163f, -0.40583837f, 83.432304f, 0.00024826656f, -0.22441338f, \
+    34.930305f, 0.00013717201f, -0.10072413f, 2.0345519f, 5.042975e-05f, -0.0051151868f, -23.186949f, -2.954656e-05f, \
+    0.081675857f, -45.835651f, -0.00011182429f, 0.16962522f, -68.567757f, -0.00018670104f, 0.24912874f, -89.015274f, \
+    -0.00025271461f, 0.31891128f, -106.89451f, -0.0003106739f, 0.37995774f, -122.48178f, -0.00036159801f, 0.4334234f, \
+    -136.0887f, -0.00040644087f, 0.48036653f, -147.9971f, -0.00044603553f, 0.52170104f, -158.4487f, -0.00048109278f, \
+    0.5582009f, -167.64735f, -0.00051221455f, 0.59051824f, -175.76419f, -0.00053991005f, 0.61920232f, -182.94298f, \
+    0.00074120041f, -0.78746086f, 189.67668f, 0.00050199922f, -0.52053851f, 118.94711f, 0.00034595194f, -0.34563985f, \
+    72.169312f, 0.00023628672f, -0.22308066f, 39.43264f, 0.00015155281f, -0.12893936f, 14.38947f, 7.9436373e-05f, \
+    -0.049570087f, -6.5849729f, 9.8780065e-06f, 0.025928147f, -26.353973f, -6.0244904e-05f, 0.1011264f, -45.891235f, \
+    -0.0001245258f, 0.16969779f, -63.640503f, -0.00018200107f, 0.23080614f, -79.416534f, -0.0002332257f, 0.2851257f, \
+    -93.408043f, -0.00027890797f, 0.33345935f, -105.83142f, -0.00031972484f, 0.37655875f, -116.88686f, -0.00035627963f, \
+    0.41508657f, -126.74978f, -0.00038909717f, 0.4496153f, -135.57112f, -0.00041862897f, 0.4806352f, -143.47978f, \
+    0.00075450627f, -0.8077085f, 197.2645f, 0.0005483625f, -0.57937992f, 137.48431f, 0.00040263616f, -0.41637528f, \
+    94.035835f, 0.0002968458f, -0.29808679f, 62.437256f, 0.00021465273f, -0.20652618f, 38.023109f, 0.00014579999f, \
+    -0.13033903f, 17.7943f, 8.3364837e-05f, -0.061922163f, -0.25628945f, 2.1040702e-05f, 0.0055043753f, -17.899033f, \
+    -3.9838269e-05f, 0.070808962f, -34.892269f, -9.5432057e-05f, 0.13022144f, -50.312542f, -0.00014553372f, 0.18363224f, \
+    -64.149567f, -0.00019061584f, 0.23159838f, -76.55645f, -0.00023122072f, 0.27472997f, -87.696724f, -0.000267861f, \
+    0.31359416f, -97.720955f, -0.00030099551f, 0.348694f, -106.76203f, -0.00033102662f, 0.38046798f, -114.93542f, \
+    0.00075442041f, -0.81131315f, 199.73399f, 0.00056934694f, -0.60711044f, 146.60785f, 0.00043758927f, -0.46042699f, \
+    107.80651f, 0.00033673306f, -0.34774613f, 77.755592f, 0.00025744611f, -0.25936076f, 54.184635f, 0.00019124403f, \
+    -0.18592963f, 34.653484f, 0.00013244693f, -0.1211992f, 17.515537f, 7.6183002e-05f, -0.059899386f, 1.3930067f, \
+    1.9935622e-05f, 0.00074589514f, -14.451098f, -3.3289773e-05f, 0.057824723f, -29.31201f, -8.1795406e-05f, 0.10970738f, \
+    -42.796932f, -0.0001257571f, 0.1566439f, -54.98064f, -0.00016559327f, 0.19911429f, -65.992928f, -0.00020173924f, \
+    0.23760393f, -75.963028f, -0.00023459854f, 0.27255708f, -85.008438f, -0.00026453217f, 0.30436832f, -93.233101f, \
+    0.00074851187f, -0.80755347f, 199.8904f, 0.00057877292f, -0.62065029f, 151.42885f, 0.00045869066f, -0.48751742f, \
+    116.4479f, 0.00036402341f, -0.38198549f, 88.408005f, 0.00028785784f, -0.29709986f, 65.791748f, 0.00022410728f, \
+    -0.22631644f, 46.958534f, 0.00016789748f, -0.16428638f, 30.510376f, 0.00011554307f, -0.10698783f, 15.393524f, \
+    6.3726009e-05f, -0.050855521f, 0.67978722f, 1.3275155e-05f, 0.0034099983f, -13.481079f, -3.3482156e-05f, 0.053541474f, \
+    -26.537302f, -7.6139564e-05f, 0.099194042f, -38.413605f, -0.00011498616f, 0.14071271f, -49.205029f, -0.00015038771f, \
+    0.17850925f, -59.021614f, -0.00018270082f, 0.21297798f, -67.967743f, -0.00021225115f, 0.24447577f, -76.137436f, \
+    0.00073962164f, -0.79992795f, 198.79742f, 0.00058225152f, -0.62685537f, 154.01329f, 0.0004708085f, -0.50362569f, \
+    121.7742f, 0.00038284453f, -0.40587497f, 95.934914f, 0.00031005888f, -0.32483357f, 74.383156f, 0.00024866324f, \
+    -0.25664979f, 56.250122f, 0.00019463689f, -0.19695458f, 40.4132f, 0.0001449675f, -0.14245038f, 26.010452f, \
+    9.670922e-05f, -0.089974172f, 12.220942f, 4.9192196e-05f, -0.03871543f, -1.1817102f, 4.2543265e-06f, 0.0095567647f, \
+    -13.771321f, -3.7050762e-05f, 0.053839799f, -25.307711f, -7.4830212e-05f, 0.094291076f, -35.838196f, -0.00010938391f, \
+    0.13125287f, -45.454754f, -0.00014102673f, 0.16507509f, -54.250107f, -0.00017005394f, 0.19608206f, -62.309704f, \
+    0.00072917651f, -0.7902028f, 196.9957f, 0.00058230222f, -0.62880373f, 155.28867f, 0.0004777672f, -0.5134173f, \
+    125.18988f, 0.00039542679f, -0.42215544f, 101.16926f, 0.00032645947f, -0.34550464f, 80.84819f, 0.00026739168f, \
+    -0.27992699f, 63.426636f, 0.00021533565f, -0.22237599f, 48.160557f, 0.00016775771f, -0.17008609f, 34.333191f, \
+    0.00012225786f, -0.12047052f, 21.273659f, 7.7426419e-05f, -0.071982376f, 8.5748215f, 3.4389526e-05f, -0.025671201f, \
+    -3.5169647f, -5.5695818e-06f, 0.017227799f, -14.703563f, -4.2269639e-05f, 0.056577671f, -24.958149f, -7.5941498e-05f, \
+    0.092648394f, -34.354034f, -0.00010686204f, 0.12574941f, -42.973347f, -0.00013529974f, 0.15617634f, -50.893963f, \
+    0.00071796437f, -0.77936077f, 194.78876f, 0.00058020913f, -0.62806624f, 155.72903f, 0.0004814757f, -0.51921952f, \
+    127.39497f, 0.00040369228f, -0.43317398f, 104.81898f, 0.00033850429f, -0.36087823f, 85.720497f, 0.00028183928f, \
+    -0.29802066f, 69.049889f, 0.00023162733f, -0.24250259f, 54.331566f, 0.00018582746f, -0.19212292f, 41.007427f, \
+    0.00014249005f, -0.14477442f, 28.532455f, 9.9993151e-05f, -0.098709486f, 16.453047f, 5.884868e-05f, -0.054360535f, \
+    4.8623581f, 2.0219746e-05f, -0.012841597f, -5.971859f, -1.5418766e-05f, 0.025411997f, -15.947985f, -4.8209276e-05f, \
+    0.060578652f, -25.115953f, -7.8392753e-05f, 0.092929699f, -33.547932f, -0.0001062136f, 0.12273495f, -41.314995f, \
+    0.00070643419f, -0.76796806f, 192.35384f, 0.00057670847f, -0.62554508f, 155.6073f, 0.00048301919f, -0.5223549f, \
+    128.78711f, 0.00040908542f, -0.44068745f, 107.41159f, 0.00034716062f, -0.37213618f, 89.357201f, 0.00029301282f, \
+    -0.31215125f, 73.48629f, 0.00024458248f, -0.2586177f, 59.307873f, 0.00020037437f, -0.20996833f, 46.444473f, \
+    0.00015880544f, -0.16449477f, 34.458031f, 0.00011831352f, -0.12052413f, 22.91724f, 7.8938261e-05f, -0.078017786f, \
+    11.799286f, 4.1629788e-05f, -0.037875831f, 1.3186889f, 7.022214e-06f, -0.00069538271f, -8.3824453f, -2.4904606e-05f, \
+    0.033576656f, -17.322374f, -5.4355838e-05f, 0.065173775f, -25.563423f, -8.155391e-05f, 0.094342217f, -33.170456f, \
+    0.00069485063f, -0.75636351f, 189.79892f, 0.00057226856f, -0.62181556f, 155.09799f, 0.000483059f, -0.52362955f, \
+    129.60876f, 0.00041246202f, -0.44573638f, 109.25938f, 0.00035331905f, -0.38036069f, 92.083237f, 0.00030158431f, \
+    -0.32313466f, 76.981041f, 0.00025493375f, -0.27160135f, 63.351555f, 0.00021220038f, -0.22457059f, 50.922928f, \
+    0.00017214609f, -0.1807196f, 39.363247f, 0.00013337754f, -0.13856116f, 28.291449f, 9.5606658e-05f, -0.097733341f, \
+    17.606035f, 5.9590715e-05f, -0.058943685f, 7.4739528f, 2.598092e-05f, -0.022807546f, -1.9580156f, -5.1081188e-06f, \
+    0.010590793f, -10.673579f, -3.3842272e-05f, 0.041443612f, -18.72443f, -6.0423507e-05f, 0.069975235f, -26.169655f, \
+    0.00068337197f, -0.74475437f, 187.19168f, 0.00056719984f, -0.61726016f, 154.31755f, 0.0004820165f, -0.52355766f, \
+    130.01471f, 0.00041437324f, -0.44899082f, 110.56334f, 0.00035765898f, -0.38637525f, 94.145134f, 0.00030806393f, \
+    -0.33159003f, 79.720047f, 0.00026319598f, -0.28207302f, 66.647331f, 0.00022186838f, -0.23659799f, 54.639751f, \
+    0.00018316117f, -0.19420329f, 43.466232f, 0.00014588551f, -0.15362576f, 32.806202f, 0.00010956042f, -0.11431745f, \
+    22.514015f, 7.4779797e-05f, -0.076824002f, 12.71696f, 4.2138447e-05f, -0.041705161f, 3.5481873f, 1.1857929e-05f, \
+    -0.0091542276f, -4.9486237f, -1.6179541e-05f, 0.020971218f, -12.812427f, -4.2156465e-05f, 0.048874676f, -20.096844f, \
+    0.00067209278f, -0.73326832f, 184.5752f, 0.00056171353f, -0.61213976f, 153.34575f, 0.00048017749f, -0.5224883f, \
+    130.1102f, 0.00041519254f, -0.45090461f, 111.45965f, 0.00036063243f, -0.39072761f, 95.706825f, 0.00031291568f, \
+    -0.33807829f, 81.870979f, 0.00026974187f, -0.29048193f, 69.329308f, 0.00022978627f, -0.24653609f, 57.738388f, \
+    0.00019231341f, -0.20548649f, 46.924068f, 0.00015635042f, -0.16630894f, 36.630993f, 0.00012133116f, -0.12837923f, \
+    26.697025f, 8.7709523e-05f, -0.092105567f, 17.216139f, 5.6007008e-05f, -0.057975456f, 8.3038263f, 2.6505035e-05f, \
+    -0.026243577f, 0.019252302f, -8.5859443e-07f, 0.0031752386f, -7.6620054f, -2.6247115e-05f, 0.030463956f, -14.788196f, \
+    0.00066106819f, -0.72198343f, 181.97708f, 0.00055595482f, -0.60663509f, 152.23824f, 0.00047774526f, -0.52067f, \
+    129.97028f, 0.00041517927f, -0.45179316f, 112.04295f, 0.00036255419f, -0.39379928f, 96.882469f, 0.00031650977f, \
+    -0.34304616f, 83.567078f, 0.00027487005f, -0.29718783f, 71.504814f, 0.00023625647f, -0.25474581f, 60.325634f, \
+    0.00019994292f, -0.2149684f, 49.853176f, 0.0001651559f, -0.17705362f, 39.893085f, 0.00013132156f, -0.14038047f, \
+    30.286938f, 9.8777207e-05f, -0.10524421f, 21.1017f, 6.7979396e-05f, -0.07206887f, 12.437526f, 3.9227132e-05f, \
+    -0.04112798f, 4.3584886f, 1.2513789e-05f, -0.012393426f, -3.1453979f, -1.2304031e-05f, 0.014296724f, -10.116905f, \
+    0.00065032864f, -0.71094626f, 179.41499f, 0.00055002613f, -0.60087425f, 151.03476f, 0.00047486796f, -0.51828426f, \
+    129.64989f, 0.00041451908f, -0.45188239f, 112.38109f, 0.00036365207f, -0.39586633f, 97.754662f, 0.00031911355f, \
+    -0.3468163f, 84.904541f, 0.0002788472f, -0.30251136f, 73.269196f, 0.00024151005f, -0.26150337f, 62.483334f, \
+    0.00020630598f, -0.22295086f, 52.341858f, 0.00017259276f, -0.18619651f, 42.68948f, 0.00013984009f, -0.15067561f, \
+    33.385101f, 0.00010829433f, -0.11659709f, 24.475594f, 7.8362027e-05f, -0.084336944f, 16.049692f, 5.0332834e-05f, \
+    -0.05416058f, 8.1697168f, 2.4246414e-05f, -0.026087493f, 0.83773971f, -1.8954157e-08f, 2.145036e-05f, -5.9831147f, \
+    -0.00020873077f, 0.3349005f, -131.59163f, -0.00026081118f, 0.37576804f, -136.01431f, -0.00030168638f, 0.40855324f, \
+    -140.30473f, -0.00033881134f, 0.43977454f, -145.29865f, -0.00036993372f, 0.46624449f, -149.74973f, -0.0003955095f, \
+    0.48797923f, -153.43787f, -0.00041645457f, 0.50565499f, -156.40558f, -0.00043362894f, 0.51998603f, -158.75343f, \
+    -0.0004477427f, 0.53158683f, -160.58377f, -0.00045936208f, 0.54095751f, -161.98619f, -0.00046893608f, 0.54849905f, \
+    -163.03554f, -0.00047682089f, 0.55453181f, -163.79312f, -0.00048330161f, 0.55931324f, -164.30902f, -0.00048860797f, \
+    0.56305146f, -164.62421f, -0.00049292669f, 0.56591576f, -164.77228f, -0.00049641053f, 0.5680449f, -164.78087f, \
+    0.0003101863f, -0.30268234f, 62.907505f, 0.00014201803f, -0.11761148f, 14.071294f, 4.7511076e-05f, -0.014433125f, \
+    -12.918381f, -1.7012941e-05f, 0.055253059f, -30.942616f, -6.9897869e-05f, 0.11162598f, -45.362171f, -0.00011778566f, \
+    0.16209951f, -58.16695f, -0.0001593262f, 0.20555267f, -69.118454f, -0.0001948698f, 0.24250768f, -78.376045f, \
+    -0.00022526974f, 0.27394605f, -86.20565f, -0.00025134932f, 0.30078301f, -92.850388f, -0.00027381154f, 0.32378817f, \
+    -98.512672f, -0.00029323681f, 0.34359071f, -103.35696f, -0.00031010009f, 0.36070201f, -107.51624f, -0.00032479007f, \
+    0.37553829f, -111.09836f, -0.0003376262f, 0.3884401f, -114.19125f, -0.00034887245f, 0.39968777f, -116.86707f, \
+    0.00040418087f, -0.41892761f, 98.634247f, 0.0002461753f, -0.24498431f, 52.73317f, 0.00015044138f, -0.13970093f, \
+    24.92337f, 8.3789026e-05f, -0.066728391f, 5.7148356f, 3.2250689e-05f, -0.010673727f, -8.9617891f, -1.1891221e-05f, \
+    0.036915954f, -21.340029f, -5.2435858e-05f, 0.08023522f, -32.536171f, -8.8846129e-05f, 0.11890382f, -42.484737f, \
+    -0.00012094664f, 0.15285039f, -51.186604f, -0.00014916956f, 0.18259251f, -58.785706f, -0.00017401643f, 0.20869714f, \
+    -65.434715f, -0.00019594925f, 0.23167637f, -71.269905f, -0.00021536901f, 0.25196984f, -76.407524f, -0.00023261677f, \
+    0.26994887f, -80.945328f, -0.00024798085f, 0.28592572f, -84.965263f, -0.00026170493f, 0.3001633f, -88.536133f, \
+    0.00043093626f, -0.45365143f, 109.87595f, 0.000291437f, -0.30083972f, 69.861588f, 0.00020072769f, -0.20110652f, \
+    43.540462f, 0.00013591463f, -0.12997274f, 24.766497f, 8.5683219e-05f, -0.075055398f, 10.30672f, 4.3842731e-05f, \
+    -0.029569527f, -1.6233109f, 6.5003414e-06f, 0.010732519f, -12.141315f, -2.8021726e-05f, 0.047732227f, -21.751892f, \
+    -5.9311402e-05f, 0.081114143f, -30.394222f, -8.7292814e-05f, 0.11087222f, -38.07917f, -0.00011226467f, 0.1373629f, \
+    -44.905537f, -0.00013457665f, 0.16098134f, -50.979626f, -0.00015455714f, 0.18209173f, -56.398342f, -0.00017249683f, \
+    0.20101312f, -61.246101f, -0.00018864754f, 0.21802017f, -65.595306f, -0.00020322585f, 0.23334795f, -69.507744f, \
+    0.00043802301f, -0.46450457f, 113.93848f, 0.00031317148f, -0.32824808f, 78.467743f, 0.00022919435f, -0.23614073f, \
+    54.254658f, 0.00016731842f, -0.16823864f, 36.346706f, 0.00011887412f, -0.11519761f, 22.364996f, 7.8711484e-05f, \
+    -0.071394898f, 10.843459f, 4.3537704e-05f, -0.033239793f, 0.84154141f, 1.1308429e-05f, 0.0015032095f, -8.2290783f, \
+    -1.850115e-05f, 0.033469997f, -16.546185f, -4.5588084e-05f, 0.062420104f, -24.061087f, -7.001371e-05f, 0.08846458f, \
+    -30.810009f, -9.2024398e-05f, 0.11189055f, -36.87138f, -0.00011188695f, 0.13299736f, -42.325287f, -0.00012984984f, \
+    0.15205961f, -47.244568f, -0.00014613409f, 0.16931945f, -51.693176f, -0.00016093293f, 0.18498738f, -55.726521f, \
+    0.0004375857f, -0.46614447f, 115.20035f, 0.00032379656f, -0.34224001f, 83.059868f, 0.00024618642f, -0.25734162f, \
+    60.835655f, 0.00018766198f, -0.19319701f, 43.955971f, 0.00014119706f, -0.14231923f, 30.551369f, 0.00010258197f, \
+    -0.10015251f, 19.452185f, 6.900663e-05f, -0.063639872f, 9.8627892f, 3.8601294e-05f, -0.030744765f, 1.2504047f, \
+    1.040262e-05f, -0.00039433388f, -6.6701097f, -1.5589016e-05f, 0.027476022f, -13.926141f, -3.9249488e-05f, 0.05278613f, \
+    -20.50532f, -6.0715338e-05f, 0.075708926f, -26.456787f, -8.0198384e-05f, 0.096485868f, -31.845598f, -9.7911514e-05f, \
+    0.11535382f, -36.734737f, -0.0001140501f, 0.13252771f, -41.181004f, -0.00012878787f, 0.14819729f, -45.234379f, \
+    0.00043375179f, -0.46355394f, 115.15051f, 0.00032879438f, -0.34942287f, 85.609818f, 0.00025646234f, -0.27045742f, \
+    65.004852f, 0.00020130762f, -0.21010901f, 49.168766f, 0.00015689372f, -0.16150726f, 36.381157f, 0.0001197677f, \
+    -0.12095475f, 25.709997f, 8.7543194e-05f, -0.08586847f, 16.489599f, 5.8561749e-05f, -0.054446977f, 8.2513628f, \
+    3.1798088e-05f, -0.025565157f, 0.69979781f, 6.9469875e-06f, 0.0011475283f, -6.268127f, -1.588433e-05f, 0.025626f, \
+    -12.643404f, -3.6721362e-05f, 0.0479284f, -18.445921f, -5.5722518e-05f, 0.068240188f, -23.726252f, -7.306943e-05f, \
+    0.086765096f, -28.538721f, -8.8935667e-05f, 0.10369478f, -32.934017f, -0.00010347852f, 0.11920147f, -36.957497f, \
+    0.00042828219f, -0.45886469f, 114.42828f, 0.00033062944f, -0.35276243f, 87.001114f, 0.00026271018f, -0.27872291f, \
+    67.726685f, 0.00021057631f, -0.22176908f, 52.819477f, 0.00016821144f, -0.17545675f, 40.656635f, 0.00013253115f, \
+    -0.13649219f, 30.412098f, 0.00010152235f, -0.10271257f, 21.535879f, 7.3725911e-05f, -0.072538801f, 13.620171f, \
+    4.8172773e-05f, -0.044913389f, 6.389111f, 2.4402694e-05f, -0.019314049f, -0.29696593f, 2.4066119e-06f, 0.004309678f, \
+    -6.4574575f, -1.7782297e-05f, 0.025954781f, -12.096573f, -3.6266993e-05f, 0.045748957f, -17.250057f, -5.320042e-05f, \
+    0.063865572f, -21.964317f, -6.8737099e-05f, 0.080475964f, -26.284697f, -8.302019e-05f, 0.095737204f, -30.252554f, \
+    0.00042201663f, -0.45309958f, 113.34258f, 0.00033056544f, -0.35377884f, 87.686409f, 0.00026641294f, -0.28391939f, \
+    69.530968f, 0.00021690829f, -0.22990669f, 55.422897f, 0.00017647236f, -0.18575209f, 43.848907f, 0.00014219551f, \
+    -0.14834055f, 34.02454f, 0.00011231477f, -0.11578733f, 25.474934f, 8.5556414e-05f, -0.086720951f, 17.849195f, \
+    6.1034578e-05f, -0.060178619f, 10.897763f, 3.823885e-05f, -0.035592947f, 4.4711223f, 1.7052156e-05f, -0.01280693f, \
+    -1.4761029f, -2.4965505e-06f, 0.0081791347f, -6.9484625f, -2.0461024e-05f, 0.02744179f, -11.968602f, -3.6966507e-05f, \
+    0.045125201f, -16.57535f, -5.2150463e-05f, 0.061382495f, -20.809269f, -6.6143679e-05f, 0.076357484f, -24.708214f, \
+    0.00041538762f, -0.44679043f, 112.05595f, 0.00032931234f, -0.35332659f, 87.92028f, 0.00026842864f, -0.28707635f, \
+    70.723572f, 0.00022122744f, -0.23562887f, 57.307701f, 0.00018253364f, -0.19341928f, 46.262524f, 0.00014959609f, \
+    -0.15749495f, 36.841606f, 0.00012077855f, -0.12610625f, 28.604277f, 9.4959221e-05f, -0.098051265f, 21.245783f, \
+    7.1338851e-05f, -0.07246495f, 14.543526f, 4.9410315e-05f, -0.04878898f, 8.3516779f, 2.8983843e-05f, -0.026795888f, \
+    2.6080124f, 1.0055548e-05f, -0.0064544124f, -2.6995425f, -7.3992051e-06f, 0.012281354f, -7.5857139f, -2.3478444e-05f, \
+    0.029527016f, -12.081953f, -3.8303973e-05f, 0.045419008f, -16.224447f, -5.1995568e-05f, 0.060089327f, -20.04793f, \
+    0.00040863064f, -0.44023106f, 110.65965f, 0.00032729248f, -0.35191464f, 87.854698f, 0.00026928537f, -0.28882706f, \
+    71.492538f, 0.00022412291f, -0.23964076f, 58.682941f, 0.00018698955f, -0.19916825f, 48.107769f, 0.00015529554f, \
+    -0.16462544f, 39.061359f, 0.0001274837f, -0.13434346f, 31.121956f, 0.00010253086f, -0.10722829f, 24.013367f, \
+    7.9717865e-05f, -0.082504988f, 17.537697f, 5.8564223e-05f, -0.059647676f, 11.5586f, 3.8839695e-05f, -0.03839124f, \
+    6.0052323f, 2.0504758e-05f, -0.018670149f, 0.85737264f, 3.5428075e-06f, -0.00044774031f, -3.8971539f, -1.2119911e-05f, \
+    0.016366133f, -8.2832289f, -2.6590462e-05f, 0.031892236f, -12.332945f, -3.9978702e-05f, 0.046251897f, -16.078218f, \
+    0.0004018787f, -0.43359092f, 109.20751f, 0.00032476828f, -0.34986013f, 87.584618f, 0.00026932434f, -0.2895807f, \
+    71.959358f, 0.00022598333f, -0.24240711f, 59.686298f, 0.00019025331f, -0.20349212f, 49.530476f, 0.00015969567f, \
+    -0.17021027f, 40.824966f, 0.00013282758f, -0.1409692f, 33.166168f, 0.00010868335f, -0.11473546f, 26.292952f, \
+    8.6607084e-05f, -0.090804532f, 20.026474f, 6.6152774e-05f, -0.068690568f, 14.241647f, 4.7073248e-05f, -0.048114568f, \
+    8.8649387f, 2.9299528e-05f, -0.028983084f, 3.8695943f, 1.2810781e-05f, -0.011256318f, -0.75709331f, -2.4489768e-06f, \
+    0.0051370892f, -5.035131f, -1.6572798e-05f, 0.020303033f, -8.992734f, -2.9661463e-05f, 0.034353092f, -12.65925f, \
+    0.00039520886f, -0.4269709f, 107.73262f, 0.00032190885f, -0.34736824f, 87.171761f, 0.00026877396f, -0.2896114f, \
+    72.205467f, 0.00022707421f, -0.24424532f, 60.411728f, 0.00019261402f, -0.20673552f, 50.632465f, 0.00016309209f, \
+    -0.17460082f, 42.236034f, 0.00013709955f, -0.14632596f, 34.837532f, 0.0001137125f, -0.12092031f, 28.185989f, \
+    9.2317285e-05f, -0.097725354f, 22.114607f, 7.2501236e-05f, -0.076293312f, 16.508804f, 5.401521e-05f, -0.056346241f, \
+    11.296064f, 3.676867e-05f, -0.037770815f, 6.4451094f, 2.0732241e-05f, -0.020519748f, 1.9416212f, 5.860265e-06f, \
+    -0.0045329081f, -2.2314286f, -7.9274714e-06f, 0.010281985f, -6.098712f, -2.0723375e-05f, 0.024027513f, -9.6872063f, \
+    0.00038866588f, -0.42043221f, 106.25584f, 0.00031882664f, -0.34457606f, 86.657608f, 0.00026779156f, -0.28910798f, \
+    72.287048f, 0.00022758242f, -0.24537872f, 60.925339f, 0.0001942783f, -0.2091447f, 51.486431f, 0.00016570305f, \
+    -0.1780564f, 43.370922f, 0.0001405178f, -0.15067191f, 36.211853f, 0.00011783796f, -0.12604108f, 29.767908f, \
+    9.7077274e-05f, -0.10353426f, 23.879446f, 7.7849676e-05f, -0.082733564f, 18.439987f, 5.9911992e-05f, -0.06336984f, \
+    13.379853f, 4.3159365e-05f, -0.045317158f, 8.6650629f, 2.7553748e-05f, -0.028520633f, 4.2796593f, 1.3053893e-05f, \
+    -0.012925358f, 0.20808925f, -4.0949496e-07f, 0.0015493241f, -3.5712857f, -1.2921006e-05f, 0.014997603f, -7.0832353f, \
+    0.00038227518f, -0.41401193f, 104.7906f, 0.00031559845f, -0.34157774f, 86.070877f, 0.00026648803f, -0.28820387f, \
+    72.243843f, 0.00022764267f, -0.24596831f, 61.274796f, 0.00019539717f, -0.21089953f, 52.14547f, 0.00016769096f, \
+    -0.18076979f, 44.286377f, 0.00014324972f, -0.15420499f, 37.347198f, 0.00012122772f, -0.13029535f, 31.096413f, \
+    0.00010106017f, -0.10843334f, 25.379644f, 8.2379411e-05f, -0.088221319f, 20.095697f, 6.4950873e-05f, -0.069401063f, \
+    15.178139f, 4.8661139e-05f, -0.05183975f, 10.59167f, 3.3464785e-05f, -0.035476182f, 6.3190179f, 1.9321509e-05f, \
+    -0.020257175f, 2.345226f, 6.1704222e-06f, -0.0061111199f, -1.3489625f, -6.0658349e-06f, 0.0070484071f, -4.7862759f, \
+    0.00037605039f, -0.40773219f, 103.34551f, 0.00031227793f, -0.33843964f, 85.431976f, 0.0002649432f, -0.28699529f, \
+    72.104622f, 0.00022735399f, -0.24613255f, 61.495178f, 0.00019608325f, -0.21213412f, 52.649139f, 0.00016917834f, \
+    -0.18288641f, 45.025181f, 0.00014542445f, -0.15707785f, 38.288338f, 0.00012401315f, -0.13383766f, 32.216629f, \
+    0.00010440013f, -0.11257938f, 26.660711f, 8.6230277e-05f, -0.092918754f, 21.522709f, 6.9276815e-05f, -0.074607007f, \
+    16.738855f, 5.3421685e-05f, -0.057508219f, 12.273431f, 3.8613645e-05f, -0.041556381f, 8.1082125f, 2.4811752e-05f, \
+    -0.026698414f, 4.2284336f, 1.1961015e-05f, -0.012869215f, 0.61657697f, -9.3581969e-09f, 1.0590637e-05f, -2.7482307f, \
+    -9.6333846e-05f, 0.17175466f, -71.808434f, -0.00014973411f, 0.21969938f, -80.523254f, -0.00017949102f, 0.24485976f, \
+    -84.496254f, -0.00020407357f, 0.26599991f, -88.097229f, -0.00022442589f, 0.28363356f, -91.207275f, -0.00024118261f, \
+    0.29814988f, -93.79142f, -0.00025500907f, 0.31007537f, -95.905563f, -0.00026647342f, 0.31989259f, -97.623405f, \
+    -0.00027602978f, 0.32799909f, -99.013412f, -0.00028403546f, 0.33471283f, -100.13367f, -0.00029077136f, 0.34028611f, \
+    -101.03191f, -0.00029645965f, 0.34491977f, -101.74695f, -0.00030127753f, 0.34877446f, -102.31034f, -0.00030536752f, \
+    0.35197982f, -102.74779f, -0.00030884537f, 0.3546412f, -103.08034f, -0.00031180563f, 0.35684475f, -103.32529f, \
+    0.00024125661f, -0.23806155f, 51.909863f, 0.00011516186f, -0.10100845f, 16.035765f, 4.4345517e-05f, -0.024435831f, \
+    -3.8953724f, -3.1932573e-06f, 0.026583606f, -17.067347f, -3.959037e-05f, 0.065304376f, -26.978338f, -7.0352384e-05f, \
+    0.097746752f, -35.220394f, -9.6779026e-05f, 0.12542483f, -42.208763f, -0.00011941476f, 0.14900003f, -48.128231f, \
+    -0.00013885253f, 0.16914636f, -53.160255f, -0.00015562153f, 0.18645027f, -57.460339f, -0.0001701631f, 0.20139427f, \
+    -61.1553f, -0.00018283789f, 0.21436916f, -64.347244f, -0.00019393946f, 0.22569092f, -67.11834f, -0.00020370733f, \
+    0.23561604f, -69.535049f, -0.000212338f, 0.24435399f, -71.651436f, -0.00021999361f, 0.25207701f, -73.511856f, \
+    0.0002974321f, -0.30715588f, 73.076134f, 0.00018188394f, -0.18174604f, 40.328579f, 0.00011161634f, -0.1053957f, \
+    20.326031f, 6.2926643e-05f, -0.052617326f, 6.5198689f, 2.5923748e-05f, -0.012667405f, -3.8964489f, -4.3571235e-06f, \
+    0.019855514f, -12.340714f, -3.0623905e-05f, 0.047903869f, -19.590624f, -5.3838135e-05f, 0.072569072f, -25.941048f, \
+    -7.4299038e-05f, 0.094225183f, -31.498386f, -9.2342038e-05f, 0.11326189f, -36.36919f, -0.00010829792f, 0.13005067f, \
+    -40.653084f, -0.00012245978f, 0.14491554f, -44.436142f, -0.00013507809f, 0.15813078f, -47.790829f, -0.00014636425f, \
+    0.16992643f, -50.77766f, -0.00015649624f, 0.18049513f, -53.44717f, -0.00016562401f, 0.18999863f, -55.841686f, \
+    0.00031281734f, -0.32736102f, 79.695343f, 0.00020984751f, -0.21601585f, 50.785137f, 0.00014398676f, -0.14453116f, \
+    32.093086f, 9.700151e-05f, -0.093533128f, 18.735241f, 6.0898579e-05f, -0.054421697f, 8.4985933f, 3.1481384e-05f, \
+    -0.02265159f, 0.20000643f, 6.3090206e-06f, 0.0044259238f, -6.8532562f, -1.6008727e-05f, 0.028329168f, -13.06073f, \
+    -3.6001464e-05f, 0.049663596f, -18.586277f, -5.3884414e-05f, 0.068693101f, -23.504055f, -6.9891517e-05f, 0.085688151f, \
+    -27.887714f, -8.425476e-05f, 0.10090896f, -31.806934f, -9.7183212e-05f, 0.11458667f, -35.323101f, -0.00010885888f, \
+    0.12692079f, -38.488926f, -0.00011943811f, 0.13808167f, -41.349293f, -0.00012905477f, 0.1482145f, -43.942337f, \
+    0.00031638003f, -0.33334675f, 82.065872f, 0.00022308039f, -0.23268659f, 56.022011f, 0.00016199869f, -0.16652578f, \
+    38.778576f, 0.00011737522f, -0.11812172f, 26.116604f, 8.2638493e-05f, -0.080465071f, 16.257385f, 5.4229386e-05f, \
+    -0.049725346f, 8.2142086f, 3.0019708e-05f, -0.023601385f, 1.3892565f, 8.6821374e-06f, -0.00065330532f, -4.5934658f, \
+    -1.0515407e-05f, 0.019924264f, -9.946455f, -2.7858958e-05f, 0.038464237f, -14.76049f, -4.3518972e-05f, 0.055170085f, \
+    -19.091816f, -5.7677535e-05f, 0.070249438f, -22.996447f, -7.0510105e-05f, 0.083897948f, -26.526518f, -8.2174593e-05f, \
+    0.096289612f, -29.7281f, -9.2809372e-05f, 0.10757581f, -32.641117f, -0.00010253445f, 0.11788715f, -35.299927f, \
+    0.00031539495f, -0.33379364f, 82.757301f, 0.00022961476f, -0.24135265f, 58.883934f, 0.00017266517f, -0.17977023f, \
+    42.876213f, 0.00013047342f, -0.13405854f, 30.94278f, 9.7227232e-05f, -0.098028697f, 21.51775f, 6.9874157e-05f, \
+    -0.068415634f, 13.768484f, 4.6553196e-05f, -0.043215849f, 7.178422f, 2.6065356e-05f, -0.021133373f, 1.4111292f, \
+    7.6594179e-06f, -0.0013505437f, -3.7471161f, -9.0508911e-06f, 0.016563881f, -8.4108915f, -2.4239684e-05f, 0.032814965f, \
+    -12.636337f, -3.8051639e-05f, 0.047570709f, -16.469126f, -5.063459e-05f, 0.060997423f, -19.953716f, -6.2126761e-05f, \
+    0.073248163f, -23.130684f, -7.265179e-05f, 0.084458612f, -26.035828f, -8.2318271e-05f, 0.094747223f, -28.700314f, \
+    0.00031237522f, -0.33170441f, 82.65995f, 0.00023269512f, -0.24587797f, 60.512619f, 0.00017920624f, -0.18810248f, \
+    45.521702f, 0.00013923596f, -0.14484672f, 34.250782f, 0.000107466f, -0.11044011f, 25.262266f, 8.1161073e-05f, \
+    -0.081963636f, 17.814756f, 5.8679234e-05f, -0.057657223f, 11.457752f, 3.8944068e-05f, -0.036361329f, 5.8919969f, \
+    2.1245196e-05f, -0.017306559f, 0.9175871f, 5.1572488e-06f, -2.5802346e-05f, -3.5880845f, -9.5318665e-06f, 0.015722424f, \
+    -7.6897788f, -2.2951348e-05f, 0.030088969f, -11.428525f, -3.5226607e-05f, 0.043216269f, -14.842528f, -4.6479461e-05f, \
+    0.055239856f, -17.967754f, -5.6821285e-05f, 0.066282295f, -20.836542f, -6.635116e-05f, 0.07645186f, -23.477369f, \
+    0.0003083701f, -0.32833913f, 82.149689f, 0.00023382604f, -0.24805205f, 61.436108f, 0.00018326902f, -0.19348058f, \
+    47.292702f, 0.00014524968f, -0.15237236f, 36.597305f, 0.00011485787f, -0.11948247f, 28.016582f, 8.9561698e-05f, \
+    -0.092107408f, 20.86344f, 6.7874105e-05f, -0.068656884f, 14.732506f, 4.8824273e-05f, -0.048088361f, 9.3561964f, \
+    3.1754811e-05f, -0.029692302f, 4.5510964f, 1.6240439e-05f, -0.013005386f, 0.19646189f, 2.0402417e-06f, 0.0022409291f, \
+    -3.7787178f, -1.0979939e-05f, 0.01620117f, -7.4160771f, -2.2929957e-05f, 0.029001007f, -10.749384f, -3.3917837e-05f, \
+    0.04076121f, -13.810719f, -4.4044573e-05f, 0.051593203f, -16.629478f, -5.3401189e-05f, 0.061596602f, -19.231852f, \
+    0.00030388287f, -0.32430744f, 81.410202f, 0.00023378286f, -0.24879728f, 61.926624f, 0.00018575511f, -0.19697462f, \
+    48.504372f, 0.00014944507f, -0.15773909f, 38.307281f, 0.00012029978f, -0.12621818f, 30.093269f, 9.5949603e-05f, \
+    -0.099878311f, 23.217171f, 7.5010765e-05f, -0.077239737f, 17.301973f, 5.6594265e-05f, -0.05734976f, 12.104053f, \
+    4.0093666e-05f, -0.039555661f, 7.4554396f, 2.5100102e-05f, -0.023414092f, 3.2412002f, 1.1360557e-05f, -0.0086463643f, \
+    -0.61170763f, -1.2705495e-06f, 0.0049122991f, -4.1471748f, -1.2896052e-05f, 0.017379556f, -7.3967552f, -2.3612729e-05f, \
+    0.028864091f, -10.389337f, -3.3512693e-05f, 0.039467763f, -13.151792f, -4.2680029e-05f, 0.04928273f, -15.708331f, \
+    0.00029918019f, -0.31993634f, 80.541374f, 0.00023299789f, -0.24862865f, 62.136425f, 0.00018719223f, -0.19921051f, \
+    49.340866f, 0.00015239108f, -0.16162065f, 39.578751f, 0.00012436388f, -0.13132387f, 31.691031f, 0.00010088368f, \
+    -0.10593562f, 25.069185f, 8.0645033e-05f, -0.084058546f, 19.356749f, 6.2817533e-05f, -0.064803205f, 14.326543f, \
+    4.6837959e-05f, -0.047564585f, 9.8233824f, 3.2318821e-05f, -0.031923868f, 5.73915f, 1.9006393e-05f, -0.017603599f, \
+    2.0015714f, 6.7462183e-06f, -0.0044312812f, -1.4348785f, -4.5639631e-06f, 0.0077093123f, -4.6012011f, -1.501268e-05f, \
+    0.018917883f, -7.5238929f, -2.4684427e-05f, 0.029288083f, -10.227654f, -3.3657274e-05f, 0.03890558f, -12.734977f, \
+    0.00029441269f, -0.31541353f, 79.601585f, 0.00023172848f, -0.24785352f, 62.156658f, 0.00018790606f, -0.2005744f, \
+    49.915806f, 0.00015445052f, -0.16444631f, 40.537731f, 0.00012742821f, -0.13524607f, 32.940784f, 0.00010474106f, \
+    -0.11072376f, 26.549576f, 8.5151267e-05f, -0.089552872f, 21.025118f, 6.7872039e-05f, -0.070890181f, 16.151913f, \
+    5.2373805e-05f, -0.054167278f, 11.784401f, 3.8289989e-05f, -0.038988858f, 7.8208456f, 2.5372168e-05f, -0.02508455f, \
+    4.1911407f, 1.3461417e-05f, -0.012278511f, 0.84919631f, 2.4534552e-06f, -0.00045327304f, -2.2361176f, -7.7351733e-06f, \
+    0.010485155f, -5.0897388f, -1.7182569e-05f, 0.020623503f, -7.7345343f, -2.5961543e-05f, 0.03004176f, -10.191488f, \
+    0.00028966871f, -0.31085154f, 78.626656f, 0.00023013646f, -0.24666585f, 62.045078f, 0.00018810651f, -0.20131536f, \
+    50.302509f, 0.00015586379f, -0.16650029f, 41.267624f, 0.00012974966f, -0.13828783f, 33.931305f, 0.00010778476f, \
+    -0.1145524f, 27.748877f, 8.8792636e-05f, -0.094031572f, 22.39715f, 7.2022718e-05f, -0.075920194f, 17.67008f, \
+    5.6971188e-05f, -0.059677418f, 13.429167f, 4.3289463e-05f, -0.044927817f, 9.5779686f, 3.073685e-05f, -0.031410269f, \
+    6.0490041f, 1.9153444e-05f, -0.018949009f, 2.7964401f, 8.4328994e-06f, -0.0074252272f, -0.21102297f, -1.5056969e-06f, \
+    0.0032519663f, -2.9974284f, -1.0735323e-05f, 0.013163713f, -5.5841537f, -1.9324199e-05f, 0.022385024f, -7.9908648f, \
+    0.0002850008f, -0.30631936f, 77.639206f, 0.00022832819f, -0.24519373f, 61.840042f, 0.00018793413f, -0.20160028f, \
+    50.550182f, 0.00015679533f, -0.16797702f, 41.825459f, 0.00013150758f, -0.14066066f, 34.724487f, 0.00011020238f, \
+    -0.11764217f, 28.731537f, 9.175983e-05f, -0.097718313f, 23.538019f, 7.5461874e-05f, -0.080117926f, 18.946289f, \
+    6.0825601e-05f, -0.064322263f, 14.823389f, 4.7517053e-05f, -0.0499718f, 11.077014f, 3.5303539e-05f, -0.036814619f, \
+    7.6422005f, 2.4026353e-05f, -0.024677072f, 4.4738402f, 1.3577918e-05f, -0.013439781f, 1.5406421f, 3.8783874e-06f, \
+    -0.003013432f, -1.180938f, -5.1413781e-06f, 0.0066788634f, -3.7111328f, -1.3545618e-05f, 0.015707795f, -6.0684609f, \
+    0.00028044f, -0.30185959f, 76.653831f, 0.00022637608f, -0.24352485f, 61.567963f, 0.00018748618f, -0.20154488f, \
+    50.692997f, 0.00015736085f, -0.16901328f, 42.251369f, 0.00013283035f, -0.14251588f, 35.364601f, 0.0001121304f, \
+    -0.12015354f, 29.544386f, 9.4193892e-05f, -0.10077842f, 24.495861f, 7.8332843e-05f, -0.083650798f, 20.029142f, \
+    6.4082713e-05f, -0.068271205f, 16.016048f, 5.1121544e-05f, -0.054292977f, 12.367544f, 3.9223898e-05f, -0.04147232f, \
+    9.0208282f, 2.8233339e-05f, -0.029638618f, 5.9316964f, 1.8041925e-05f, -0.018672729f, 3.0690408f, 8.5702495e-06f, \
+    -0.0084862225f, 0.40963477f, -2.4812024e-07f, 0.00099470967f, -2.065913f, -8.4740386e-06f, 0.009837064f, -4.3751392f, \
+    0.00027600411f, -0.2974984f, 75.679985f, 0.00022433072f, -0.24172087f, 61.247578f, 0.00018683195f, -0.20123176f, \
+    50.755402f, 0.00015764374f, -0.16970776f, 42.574337f, 0.00013381189f, -0.14396414f, 35.884007f, 0.00011367003f, \
+    -0.12220543f, 30.222118f, 9.6200893e-05f, -0.10333615f, 25.306833f, 8.0744627e-05f, -0.086646065f, 20.955561f, \
+    6.6853616e-05f, -0.071653433f, 17.044498f, 5.4216354e-05f, -0.058022641f, 13.487369f, 4.2613698e-05f, -0.0455168f, \
+    10.22316f, 3.1891796e-05f, -0.033968497f, 7.2085671f, 2.1942953e-05f, -0.023259325f, 4.4127655f, 1.268804e-05f, \
+    -0.013301537f, 1.8127803f, 4.0624673e-06f, -0.004023497f, -0.61017323f, -3.9918123e-06f, 0.0046387119f, -2.8728106f, \
+    0.00027170245f, -0.29325131f, 74.723785f, 0.00022222823f, -0.23982619f, 60.892487f, 0.00018602202f, -0.20072138f, \
+    50.755348f, 0.00015770554f, -0.17013328f, 42.815762f, 0.0001345222f, -0.14508797f, 36.306843f, 0.00011489764f, \
+    -0.12388754f, 30.79089f, 9.7861768e-05f, -0.1054863f, 25.998503f, 8.2781313e-05f, -0.08920189f, 21.754009f, \
+    6.9224596e-05f, -0.074569277f, 17.937735f, 5.6889698e-05f, -0.061262924f, 14.465896f, 4.5563029e-05f, -0.049051948f, \
+    11.278998f, 3.5093311e-05f, -0.037771944f, 8.334547f, 2.5373423e-05f, -0.027305489f, 5.602036f, 1.6324506e-05f, \
+    -0.017565459f, 3.0587108f, 7.8832327e-06f, -0.008481768f, 0.68623084f, -6.1801111e-09f, 6.9940043e-06f, -1.5314491f, \
+    -3.2415559e-05f, 0.083674937f, -40.822845f, -9.1644761e-05f, 0.14044683f, -52.977249f, -0.00011955017f, 0.16559255f, \
+    -57.7272f, -0.00013951895f, 0.18335736f, -61.027809f, -0.000155592f, 0.19767599f, -63.726242f, -0.00016882559f, \
+    0.20946865f, -65.966698f, -0.00017985956f, 0.21928863f, -67.836502f, -0.00018915995f, 0.22754651f, -69.406265f, \
+    -0.0001970778f, 0.23455603f, -70.733192f, -0.00020388149f, 0.24055935f, -71.863091f, -0.00020977888f, 0.2457452f, \
+    -72.83255f, -0.00021493297f, 0.2502622f, -73.670883f, -0.00021947311f, 0.25422862f, -74.401695f, -0.000223503f, \
+    0.25773945f, -75.044106f, -0.00022710678f, 0.26087189f, -75.613754f, -0.00023035325f, 0.26368904f, -76.123489f, \
+    0.00021568406f, -0.21463534f, 48.478329f, 0.00010663102f, -0.097287372f, 17.973267f, 4.5961664e-05f, -0.03217129f, \
+    1.091083f, 5.9677004e-06f, 0.01054958f, -9.9237337f, -2.3484052e-05f, 0.041827705f, -17.936811f, -4.7140693e-05f, \
+    0.066795647f, -24.293709f, -6.7111636e-05f, 0.087753624f, -29.600882f, -8.4225481e-05f, 0.10562788f, -34.105827f, \
+    -9.9014098e-05f, 0.12101137f, -37.966499f, -0.00011189196f, 0.13436046f, -41.303463f, -0.0001231888f, 0.14603461f, \
+    -44.211044f, -0.00013316839f, 0.15631926f, -46.763763f, -0.00014204309f, 0.16544282f, -49.021004f, -0.00014998514f, \
+    0.17358971f, -51.030521f, -0.00015713531f, 0.18090998f, -52.831081f, -0.00016360958f, 0.18752688f, -54.454403f, \
+    0.00025296389f, -0.26051784f, 62.565567f, 0.00015499082f, -0.15536319f, 35.337685f, 9.5943433e-05f, -0.091809385f, \
+    18.799236f, 5.5368459e-05f, -0.048159413f, 7.4370298f, 2.5008629e-05f, -0.015561662f, -1.0353574f, 8.1154241e-07f, \
+    0.010345697f, -7.7524643f, -1.9476023e-05f, 0.031992342f, -13.348561f, -3.708465e-05f, 0.050713584f, -18.17411f, \
+    -5.2584342e-05f, 0.067141548f, -22.397312f, -6.6317669e-05f, 0.081659846f, -26.120831f, -7.8555662e-05f, 0.094569251f, \
+    -29.424723f, -8.9521978e-05f, 0.10611568f, -32.374096f, -9.9401987e-05f, 0.11650157f, -35.022316f, -0.00010834976f, \
+    0.12589425f, -37.413357f, -0.00011649384f, 0.13443279f, -39.583668f, -0.00012394208f, 0.14223343f, -41.563641f, \
+    0.0002624694f, -0.27339688f, 66.901413f, 0.00017462815f, -0.17935871f, 42.647625f, 0.0001196788f, -0.12030292f, \
+    27.316185f, 8.0776481e-05f, -0.078434311f, 16.414955f, 5.1176128e-05f, -0.046584781f, 8.1170015f, 2.7429794e-05f, \
+    -0.021065302f, 1.4718688f, 7.5647558e-06f, 0.00024237522f, -4.0695395f, -9.6233834e-06f, 0.018634969f, -8.8447466f, \
+    -2.4838408e-05f, 0.034876015f, -13.053735f, -3.8449019e-05f, 0.049373146f, -16.804581f, -5.0693234e-05f, 0.062391732f, \
+    -20.168022f, -6.1762577e-05f, 0.074143842f, -23.200386f, -7.1817703e-05f, 0.084806018f, -25.948362f, -8.0994047e-05f, \
+    0.094526201f, -28.450956f, -8.9406094e-05f, 0.10342887f, -30.7409f, -9.7150914e-05f, 0.11161919f, -32.845795f, \
+    0.00026414616f, -0.27690005f, 68.442055f, 0.00018390217f, -0.19108549f, 46.346851f, 0.00013277588f, -0.13622069f, \
+    32.137356f, 9.5924217e-05f, -0.096592009f, 21.834558f, 6.7487417e-05f, -0.065990649f, 13.863583f, 4.4492044e-05f, \
+    -0.041252285f, 7.4160333f, 2.5203668e-05f, -0.020522457f, 2.0145125f, 8.5349884e-06f, -0.0026348827f, -2.6427875f, \
+    -6.2118602e-06f, 0.013161852f, -6.7512012f, -1.9456655e-05f, 0.027324172f, -10.43025f, -3.1442527e-05f, 0.040120732f, \
+    -13.751024f, -4.2342548e-05f, 0.051743492f, -16.764462f, -5.2299376e-05f, 0.062349722f, -19.512177f, -6.1433951e-05f, \
+    0.072071932f, -22.029119f, -6.9849317e-05f, 0.081022464f, -24.344849f, -7.7633471e-05f, 0.0892969f, -26.484468f, \
+    0.00026281204f, -0.27672809f, 68.863762f, 0.00018855633f, -0.1973321f, 48.429462f, 0.00014060357f, -0.145918f, \
+    35.13316f, 0.00010568248f, -0.10839858f, 25.393555f, 7.8470279e-05f, -0.079128087f, 17.776539f, 5.6304001e-05f, \
+    -0.055278499f, 11.562147f, 3.7637754e-05f, -0.035202693f, 6.3287477f, 2.1490756e-05f, -0.017851945f, 1.8063477f, \
+    7.2135035e-06f, -0.00252948f, -2.1852717f, -5.6199497e-06f, 0.011224143f, -5.7655606f, -1.7272178e-05f, 0.023695426f, \
+    -9.0096102f, -2.7912305e-05f, 0.03507106f, -11.966728f, -3.7671118e-05f, 0.045495339f, -14.675046f, -4.6658592e-05f, \
+    0.055088963f, -17.166378f, -5.4968743e-05f, 0.063954584f, -19.467726f, -6.2682273e-05f, 0.072179981f, -21.602131f, \
+    0.0002601243f, -0.27484962f, 68.748032f, 0.00019083756f, -0.20074844f, 49.671963f, 0.00014552857f, -0.15218645f, \
+    37.121971f, 0.00011229603f, -0.11650281f, 27.869024f, 8.62366e-05f, -0.0884865f, 20.585703f, 6.4889748e-05f, \
+    -0.065523006f, 14.605962f, 4.6842935e-05f, -0.046109479f, 9.5460825f, 3.1202089e-05f, -0.029292168f, 5.1614885f, \
+    1.7367747e-05f, -0.014429639f, 1.2869413f, 4.9312675e-06f, -0.0010829194f, -2.1911554f, -6.3775051e-06f, 0.011040358f, \
+    -5.3489108f, -1.6732612e-05f, 0.022130696f, -8.2363043f, -2.6258786e-05f, 0.032325435f, -10.889521f, -3.5057943e-05f, \
+    0.041736465f, -13.338019f, -4.3216962e-05f, 0.05045874f, -15.606749f, -5.081061e-05f, 0.058573637f, -17.717054f, \
+    0.00025679832f, -0.27212089f, 68.349998f, 0.00019177412f, -0.20254695f, 50.429527f, 0.00014872086f, -0.15640324f, \
+    38.506584f, 0.00011695085f, -0.12230045f, 29.669237f, 9.1927897e-05f, -0.095408566f, 22.683733f, 7.1349408e-05f, \
+    -0.073277272f, 16.924572f, 5.3895339e-05f, -0.054501645f, 12.032937f, 3.873662e-05f, -0.038198192f, 7.7826982f, \
+    2.5316871e-05f, -0.023772612f, 4.0212011f, 1.3250209e-05f, -0.010811424f, 0.64180791f, 2.2704605e-06f, 0.00097206578f, \
+    -2.429775f, -7.8007579e-06f, 0.011771684f, -5.2440991f, -1.7086842e-05f, 0.021722667f, -7.836647f, -2.5684209e-05f, \
+    0.030930785f, -10.235211f, -3.3674118e-05f, 0.039484866f, -12.463104f, -4.1126463e-05f, 0.047461025f, -14.54027f, \
+    0.00025318851f, -0.268971f, 67.799149f, 0.00019189592f, -0.20335311f, 50.88567f, 0.00015081305f, -0.15931216f, \
+    39.504288f, 0.00012032137f, -0.12658376f, 31.025463f, 9.6219104e-05f, -0.10068655f, 24.301805f, 7.6341479e-05f, \
+    -0.079313196f, 18.74297f, 5.9440601e-05f, -0.061134007f, 14.008829f, 4.4734959e-05f, -0.045315977f, 9.8861494f, \
+    3.1702293e-05f, -0.031301681f, 6.2319536f, 1.9978335e-05f, -0.018701401f, 2.9459622f, 9.3059616e-06f, -0.007238979f, \
+    -0.04316422f, -4.9348438e-07f, 0.0032787242f, -2.7855799f, -9.5440673e-06f, 0.012986951f, -5.3166122f, -1.7938981e-05f, \
+    0.021987719f, -7.6630011f, -2.575514e-05f, 0.030365083f, -9.8467731f, -3.3058441e-05f, 0.038190804f, -11.886715f, \
+    0.0002494854f, -0.26563406f, 67.167328f, 0.0001915027f, -0.20352165f, 51.144764f, 0.00015217274f, -0.16134536f, \
+    40.24131f, 0.00012281381f, -0.12982935f, 32.076664f, 9.9531309e-05f, -0.10481399f, 25.583687f, 8.0286365e-05f, \
+    -0.084122859f, 20.204357f, 6.3893713e-05f, -0.066491283f, 15.614564f, 4.9609196e-05f, -0.05112531f, 11.610823f, \
+    3.6936744e-05f, -0.037495397f, 8.0573034f, 2.55304e-05f, -0.025231656f, 4.8589387f, 1.5143213e-05f, -0.014069313f, \
+    1.9474654f, 5.599295e-06f, -0.0038188454f, -0.72618252f, -3.2257879e-06f, 0.0056547727f, -3.1971443f, -1.1423682e-05f, \
+    0.01445156f, -5.4915605f, -1.9068086e-05f, 0.02265198f, -7.6304855f, -2.6221607e-05f, 0.030324208f, -9.6317453f, \
+    0.00024579617f, -0.26224476f, 66.496796f, 0.00019077658f, -0.20326884f, 51.270687f, 0.00015302689f, -0.16276982f, \
+    40.795681f, 0.0001246852f, -0.13233861f, 32.910633f, 0.00010213815f, -0.10811124f, 26.622576f, 8.346406e-05f, \
+    -0.088033594f, 21.403854f, 6.7534856e-05f, -0.07090041f, 16.945002f, 5.363856e-05f, -0.055951152f, 13.050786f, \
+    4.1300002e-05f, -0.042678196f, 9.5908728f, 3.0188025e-05f, -0.030727467f, 6.4742603f, 2.0065156e-05f, -0.019844556f, \
+    3.6354244f, 1.0759678e-05f, -0.0098448098f, 1.0266519f, 2.1478152e-06f, -0.00059437723f, -1.3867943f, -5.861375e-06f, \
+    0.0080056712f, -3.6306994f, -1.3339347e-05f, 0.01603324f, -5.7254128f, -2.0346044e-05f, 0.023553578f, -7.6879773f, \
+    0.00024218248f, -0.25888294f, 65.813362f, 0.00018983425f, -0.20273387f, 51.304768f, 0.00015352294f, -0.16375916f, \
+    41.218212f, 0.00012610514f, -0.13431038f, 33.585289f, 0.00010422388f, -0.11079384f, 27.481123f, 8.6066997e-05f, \
+    -0.091270141f, 22.406693f, 7.0559858e-05f, -0.074589677f, 18.066305f, 5.7019806e-05f, -0.060022324f, 14.272223f, \
+    4.4989603e-05f, -0.047079116f, 10.898727f, 3.4150213e-05f, -0.035418741f, 7.8580322f, 2.4272356e-05f, -0.024795594f, \
+    5.0868845f, 1.5188773e-05f, -0.015030018f, 2.538909f, 6.7771439e-06f, -0.0059900428f, 0.17992151f, -1.0529227e-06f, \
+    0.0024223791f, -2.0155761f, -8.3714222e-06f, 0.010283427f, -4.0674496f, -1.5236181e-05f, 0.01765601f, -5.9921122f, \
+    0.00023867989f, -0.25559658f, 65.133186f, 0.0001887535f, -0.20201007f, 51.274899f, 0.0001537608f, -0.1644312f, \
+    41.543449f, 0.00012718972f, -0.1358808f, 34.140308f, 0.00010591648f, -0.11301142f, 28.202806f, 8.8231027e-05f, \
+    -0.093991041f, 23.25885f, 7.3109157e-05f, -0.077722654f, 19.025833f, 5.9895639e-05f, -0.063504681f, 15.323062f, \
+    4.8149526e-05f, -0.050865039f, 12.028981f, 3.756224e-05f, -0.039473321f, 9.0585051f, 2.791149e-05f, -0.029091313f, \
+    6.3502493f, 1.9034225e-05f, -0.019543966f, 3.8590367f, 1.0809981e-05f, -0.010701494f, 1.5512842f, 3.1490076e-06f, \
+    -0.0024667582f, -0.59822816f, -4.0177192e-06f, 0.0052352236f, -2.6090243f, -1.0746404e-05f, 0.012465549f, -4.4970303f, \
+    0.00023530828f, -0.25241446f, 64.466484f, 0.00018758782f, -0.20116203f, 51.200527f, 0.00015381062f, -0.1648688f, \
+    41.795746f, 0.00012802107f, -0.13714619f, 34.603775f, 0.00010730733f, -0.11487085f, 28.81867f, 9.0054396e-05f, \
+    -0.096310869f, 23.993542f, 7.528565e-05f, -0.080419123f, 19.85824f, 6.2371852e-05f, -0.066521101f, 16.238791f, \
+    5.0887324e-05f, -0.054160565f, 13.017537f, 4.0532985e-05f, -0.043016966f, 10.111821f, 3.1092677e-05f, -0.032858524f, \
+    7.4618587f, 2.2407175e-05f, -0.023514263f, 5.0235066f, 1.4357966e-05f, -0.0148566f, 2.763761f, 6.8560712e-06f, \
+    -0.0067893863f, 0.65768498f, -1.6683656e-07f, 0.0007614838f, -1.3139949f, -6.7657634e-06f, 0.0078557525f, -3.1668384f, \
+    0.00023207796f, -0.24935335f, 63.819763f, 0.00018637492f, -0.20023564f, 51.095581f, 0.00015372295f, -0.16513194f, \
+    41.992786f, 0.00012865888f, -0.13817665f, 34.996147f, 0.00010846338f, -0.11645038f, 29.35145f, 9.160972e-05f, \
+    -0.098314315f, 24.635302f, 7.7166209e-05f, -0.082768507f, 20.589386f, 6.4528322e-05f, -0.069164298f, 17.046162f, \
+    5.328489e-05f, -0.057060529f, 13.891703f, 4.3145763e-05f, -0.046145912f, 11.045628f, 3.3900418e-05f, -0.036194522f, \
+    8.4495916f, 2.5393107e-05f, -0.027039055f, 6.0603671f, 1.7507224e-05f, -0.018554008f, 3.8454812f, 1.0154654e-05f, \
+    -0.010644255f, 1.7802713f, 3.2676078e-06f, -0.0032363741f, -0.15434323f, -3.2080236e-06f, 0.003728353f, -1.9736457f, \
+    0.00022899332f, -0.24642241f, 63.197083f, 0.00018514182f, -0.19926409f, 50.970245f, 0.00015353526f, -0.1652651f, \
+    42.14772f, 0.00012914761f, -0.13902448f, 35.332706f, 0.00010943475f, -0.11780863f, 29.818182f, 9.2951763e-05f, \
+    -0.1000652f, 25.202621f, 7.8809266e-05f, -0.08483877f, 21.238913f, 6.6426306e-05f, -0.071505353f, 17.765676f, \
+    5.540557e-05f, -0.059638251f, 14.672581f, 4.5465444e-05f, -0.048935041f, 11.881425f, 3.6400736e-05f, -0.039175324f, \
+    9.3352232f, 2.8058974e-05f, -0.030195219f, 6.9915857f, 2.0325395e-05f, -0.021871187f, 4.8185315f, 1.3112769e-05f, \
+    -0.014109108f, 2.7916553f, 6.3537927e-06f, -0.0068361503f, 0.89203751f, -5.0000968e-09f, 5.6585945e-06f, -0.89540601f, \
+    1.8160452e-05f, 0.019351749f, -19.760305f, -5.2033207e-05f, 0.089130752f, -35.905174f, -8.2888269e-05f, 0.1184437f, \
+    -42.160717f, -0.00010217486f, 0.13631222f, -45.803535f, -0.00011687805f, 0.14985509f, -48.547943f, -0.00012889052f, \
+    0.16091885f, -50.800503f, -0.00013900513f, 0.17024662f, -52.710964f, -0.00014769341f, 0.17827393f, -54.364868f, \
+    -0.00015527815f, 0.18529826f, -55.820892f, -0.00016199471f, 0.19153678f, -57.122391f, -0.00016802098f, 0.19715399f, \
+    -58.302597f, -0.00017349482f, 0.20227763f, -59.387611f, -0.00017852518f, 0.20700897f, -60.398319f, -0.00018319972f, \
+    0.21142963f, -61.3517f, -0.00018759002f, 0.21560638f, -62.261772f, -0.0001917554f, 0.21959481f, -63.140293f, \
+    0.00021372465f, -0.21402475f, 49.641869f, 0.00010924174f, -0.10259723f, 20.869644f, 5.1974792e-05f, -0.041524868f, \
+    5.0941944f, 1.4754991e-05f, -0.0019318998f, -5.1004558f, -1.2068383e-05f, 0.026504382f, -12.391305f, -3.2926797e-05f, \
+    0.048532348f, -18.013947f, -5.0142571e-05f, 0.066642687f, -22.617569f, -6.4858519e-05f, 0.082069702f, -26.525286f, \
+    -7.7671088e-05f, 0.095463179f, -29.907915f, -8.8972294e-05f, 0.10724999f, -32.877533f, -9.9050681e-05f, 0.11774294f, \
+    -35.515984f, -0.00010812872f, 0.12718205f, -37.885834f, -0.00011638231f, 0.13575625f, -40.036175f, -0.00012395301f, \
+    0.14361696f, -42.006233f, -0.0001309564f, 0.15088743f, -43.827858f, -0.00013748805f, 0.15766923f, -45.527245f, \
+    0.00023949868f, -0.24606997f, 59.590092f, 0.00014695307f, -0.14765948f, 34.289738f, 9.2332455e-05f, -0.089344524f, \
+    19.205914f, 5.5113931e-05f, -0.049563751f, 8.896348f, 2.7538466e-05f, -0.020097813f, 1.2600367f, 5.8644423e-06f, \
+    0.0030385647f, -4.7303576f, -1.1973399e-05f, 0.022050945f, -9.645956f, -2.7215869e-05f, 0.038266715f, -13.831491f, \
+    -4.0591956e-05f, 0.052469704f, -17.491407f, -5.2515155e-05f, 0.065108903f, -20.74358f, -6.3257394e-05f, 0.07648088f, \
+    -23.666109f, -7.3021758e-05f, 0.086806864f, -26.317209f, -8.1968603e-05f, 0.096260995f, -28.742628f, -9.0228044e-05f, \
+    0.10498412f, -30.9793f, -9.7907505e-05f, 0.11309217f, -33.057575f, -0.00010509687f, 0.12068193f, -35.002747f, \
+    0.00024533749f, -0.25455722f, 62.606625f, 0.00016190579f, -0.16595303f, 39.874367f, 0.00011126333f, -0.11196091f, \
+    25.939732f, 7.581769e-05f, -0.074081309f, 16.127741f, 4.9037109e-05f, -0.045431625f, 8.6933384f, 2.7730141e-05f, \
+    -0.022632765f, 2.7733381f, 1.0096722e-05f, -0.0037711775f, -2.1241865f, -4.9713908e-06f, 0.012334201f, -6.3041339f, \
+    -1.8192017e-05f, 0.026450012f, -9.9650602f, -3.001989e-05f, 0.039064363f, -13.233939f, -4.0735911e-05f, 0.05048136f, \
+    -16.190363f, -5.0533316e-05f, 0.060911193f, -18.889534f, -5.9559818e-05f, 0.070514508f, -21.373663f, -6.7934248e-05f, \
+    0.079420283f, -23.676615f, -7.5754739e-05f, 0.087734766f, -25.826258f, -8.3103696e-05f, 0.095547006f, -27.845926f, \
+    0.00024568115f, -0.25645086f, 63.650089f, 0.00016905475f, -0.17507085f, 42.773888f, 0.00012174631f, -0.12467247f, \
+    29.784065f, 8.8184512e-05f, -0.088831566f, 20.511871f, 6.2501269e-05f, -0.061360411f, 13.387064f, 4.186669e-05f, \
+    -0.039270438f, 7.649343f, 2.468355e-05f, -0.020869715f, 2.8661842f, 9.9587987e-06f, -0.0051032878f, -1.233364f, \
+    -2.9640503e-06f, 0.0087278029f, -4.8294711f, -1.4530669e-05f, 0.021099282f, -8.0451708f, -2.5035677e-05f, 0.032327343f, \
+    -10.962615f, -3.4673732e-05f, 0.042622451f, -13.636777f, -4.3586082e-05f, 0.052137852f, -16.107809f, -5.1883788e-05f, \
+    0.060994066f, -18.407305f, -5.9657876e-05f, 0.069289707f, -20.561113f, -6.6984685e-05f, 0.077107348f, -22.590864f, \
+    0.00024393492f, -0.25575909f, 63.894676f, 0.00017278527f, -0.18015036f, 44.485428f, 0.00012817534f, -0.1326317f, \
+    32.242188f, 9.6261181e-05f, -0.098564401f, 23.4361f, 7.1654802e-05f, -0.072254114f, 16.617535f, 5.1748397e-05f, \
+    -0.050944768f, 11.084721f, 3.5083336e-05f, -0.033093113f, 6.4439659f, 2.0754967e-05f, -0.017740071f, 2.4497869f, \
+    8.1618791e-06f, -0.0042467075f, -1.0619264f, -3.1130564e-06f, 0.007831037f, -4.2055883f, -1.3361401e-05f, 0.01880452f, \
+    -7.0616946f, -2.2782213e-05f, 0.028887544f, -9.6857767f, -3.1515108e-05f, 0.038230944f, -12.117189f, -3.9666411e-05f, \
+    0.046949867f, -14.386041f, -4.7322013e-05f, 0.055137314f, -16.516666f, -5.4553584e-05f, 0.062870778f, -18.529343f, \
+    0.00024130857f, -0.25391617f, 63.763981f, 0.00017476809f, -0.1831468f, 45.578175f, 0.00013240927f, -0.13801189f, \
+    33.946087f, 0.00010189273f, -0.10543784f, 25.528358f, 7.8247882e-05f, -0.080160156f, 18.980707f, 5.9033715e-05f, \
+    -0.059594315f, 13.643388f, 4.2884178e-05f, -0.042293876f, 9.1470594f, 2.8957442e-05f, -0.027366772f, 5.2636123f, \
+    1.669531e-05f, -0.014220649f, 1.8412145f, 5.7083962e-06f, -0.0024416165f, -1.2265079f, -4.2821353e-06f, 0.0082673393f, \
+    -4.0161061f, -1.3474904e-05f, 0.018118586f, -6.5825095f, -2.201013e-05f, 0.027262889f, -8.9648876f, -2.9991697e-05f, \
+    0.035812426f, -11.192486f, -3.7501937e-05f, 0.043856211f, -13.288546f, -4.4608936e-05f, 0.051467828f, -15.272294f, \
+    0.0002383344f, -0.25156054f, 63.449013f, 0.00017576877f, -0.184957f, 46.313461f, 0.00013534648f, -0.14186172f, \
+    35.200249f, 0.00010602766f, -0.11055861f, 27.109852f, 8.3221021e-05f, -0.086175889f, 20.795095f, 6.4631233e-05f, \
+    -0.066278741f, 15.632837f, 4.8963695e-05f, -0.049494222f, 11.27176f, 3.5421046e-05f, -0.034976676f, 7.4954033f, \
+    2.347696e-05f, -0.022167565f, 4.1606483f, 1.2764722e-05f, -0.01067734f, 1.167497f, 3.0195154e-06f, -0.00022426438f, \
+    -1.5565336f, -5.9521967e-06f, 0.0093980711f, -4.0646915f, -1.4290596e-05f, 0.018339811f, -6.3958526f, -2.2098619e-05f, \
+    0.026711747f, -8.5788126f, -2.9456241e-05f, 0.03460018f, -10.63606f, -3.6428857e-05f, 0.042075716f, -12.586011f, \
+    0.00023527509f, -0.24901272f, 63.047398f, 0.00017618836f, -0.18605182f, 46.828911f, 0.0001374688f, -0.14474356f, \
+    36.167889f, 0.00010919507f, -0.11454318f, 28.359207f, 8.7120512e-05f, -0.090937473f, 22.244955f, 6.908385e-05f, \
+    -0.071629927f, 17.236029f, 5.3853073e-05f, -0.055311825f, 12.996777f, 4.0665869e-05f, -0.041173514f, 9.3195715f, \
+    2.9019451e-05f, -0.028680971f, 6.0674276f, 1.8564491e-05f, -0.01746301f, 3.1450512f, 9.0484e-06f, -0.0072509996f, \
+    0.48337737f, 2.8435176e-07f, 0.0021540755f, -1.9688635f, -7.8661005e-06f, 0.010900135f, -4.2498846f, -1.5505469e-05f, \
+    0.019097183f, -6.3882046f, -2.2712298e-05f, 0.0268298f, -8.405818f, -2.9549992e-05f, 0.034166362f, -10.320533f, \
+    0.00023226895f, -0.24644549f, 62.613079f, 0.0001762578f, -0.18670343f, 47.204369f, 0.00013905751f, -0.14698577f, \
+    36.944374f, 0.00011171071f, -0.11775915f, 29.382849f, 9.0281959e-05f, -0.094835162f, 23.44315f, 7.2734525e-05f, \
+    -0.076046422f, 18.568148f, 5.7894289e-05f, -0.060143732f, 14.436789f, 4.5029698e-05f, -0.046348937f, 10.849105f, \
+    3.365683e-05f, -0.034147382f, 7.6728559f, 2.3439676e-05f, -0.023181697f, 4.8161931f, 1.4135477e-05f, -0.013193609f, \
+    2.2126904f, 5.5638498e-06f, -0.0039910204f, -0.18712074f, -2.4107978e-06f, 0.0045707547f, -2.4205754f, -9.8903365e-06f, \
+    0.012600787f, -4.5158992f, -1.6952514e-05f, 0.02018263f, -6.4947805f, -2.3659319e-05f, 0.027383052f, -8.3745871f, \
+    0.00022939125f, -0.24395612f, 62.177437f, 0.00017611946f, -0.18708038f, 47.489559f, 0.00014028832f, -0.14879371f, \
+    37.589417f, 0.00011377418f, -0.1204388f, 30.248024f, 9.292156e-05f, -0.098120138f, 24.46225f, 7.5809119e-05f, \
+    -0.079790324f, 19.704853f, 6.1317107e-05f, -0.064256318f, 15.668618f, 4.8742459e-05f, -0.050769206f, 12.160715f, \
+    3.7617865e-05f, -0.038831271f, 9.0530167f, 2.761816e-05f, -0.028096262f, 6.2563872f, 1.8508401e-05f, -0.018313989f, \
+    3.7064092f, 1.0113727e-05f, -0.0092981625f, 1.3550863f, 2.3016717e-06f, -0.0009074909f, -0.8340326f, -5.0285889e-06f, \
+    0.006965836f, -2.8888202f, -1.1954304e-05f, 0.014404695f, -4.8307619f, -1.8536533e-05f, 0.021474767f, -6.6769247f, \
+    0.00022668316f, -0.24160059f, 61.759357f, 0.00017586567f, -0.18729267f, 47.717129f, 0.00014127712f, -0.15030307f, \
+    38.142544f, 0.00011551803f, -0.12273646f, 30.999407f, 9.518455e-05f, -0.10096103f, 25.350952f, 7.8461751e-05f, \
+    -0.083040327f, 20.697666f, 6.4280968e-05f, -0.067834258f, 16.745457f, 5.1966075e-05f, -0.054621626f, 13.308295f, \
+    4.1065159e-05f, -0.042920459f, 10.261881f, 3.1262629e-05f, -0.032394256f, 7.5194373f, 2.2330045e-05f, -0.02279946f, \
+    5.0181584f, 1.4097136e-05f, -0.013954533f, 2.7112203f, 6.4343649e-06f, -0.0057212599f, 0.56294841f, -7.5779587e-07f, \
+    0.0020067217f, -1.4541514f, -7.5561738e-06f, 0.0093117403f, -3.3614073f, -1.4021251e-05f, 0.016258789f, -5.1756945f, \
+    0.00022416677f, -0.23941135f, 61.370491f, 0.00017555883f, -0.18741505f, 47.909443f, 0.00014210382f, -0.15160754f, \
+    38.631111f, 0.00011703413f, -0.12475912f, 31.667997f, 9.7172218e-05f, -0.10347542f, 26.143202f, 8.0801023e-05f, \
+    -0.085922256f, 21.582844f, 6.6899702e-05f, -0.071009241f, 17.7052f, 5.4817669e-05f, -0.058041532f, 14.330745f, \
+    4.4117616e-05f, -0.046552148f, 11.338837f, 3.4492852e-05f, -0.036213644f, 8.6448889f, 2.5720712e-05f, -0.026788333f, \
+    6.1875091f, 1.7634869e-05f, -0.018098682f, 3.9208395f, 1.0108374e-05f, -0.010009148f, 1.80986f, 3.0430583e-06f, \
+    -0.0024148112f, -0.17256351f, -3.637457e-06f, 0.0047661271f, -2.0476196f, -9.993325e-06f, 0.011598254f, -3.8320727f, \
+    0.00022185323f, -0.23740709f, 61.018147f, 0.0001752425f, -0.18750019f, 48.082382f, 0.00014282555f, -0.15277432f, \
+    39.074795f, 0.00011838851f, -0.12658374f, 32.276104f, 9.8957651e-05f, -0.10574815f, 26.863489f, 8.2905761e-05f, \
+    -0.088527419f, 22.386681f, 6.9256668e-05f, -0.073877655f, 18.575563f, 5.7383932e-05f, -0.061129019f, 15.256809f, \
+    4.6864163e-05f, -0.049828861f, 12.313288f, 3.7399139e-05f, -0.039658386f, 9.6625166f, 2.8771592e-05f, -0.030385379f, \
+    7.2444172f, 2.0818752e-05f, -0.021835901f, 5.0139928f, 1.3415998e-05f, -0.013876771f, 2.9367862f, 6.4664778e-06f, \
+    -0.0064044199f, 0.98598868f, -1.056948e-07f, 0.00066241244f, -0.85945779f, -6.3604834e-06f, 0.0073880791f, -2.6162579f, \
+    0.00021974738f, -0.23559825f, 60.706985f, 0.00017494809f, -0.18758632f, 48.247574f, 0.00014348455f, -0.15385319f, \
+    39.488209f, 0.00011963019f, -0.12826748f, 32.840332f, 0.00010059519f, -0.10784232f, 27.530031f, 8.4834814e-05f, \
+    -0.090923928f, 23.128786f, 7.1414455e-05f, -0.076511808f, 19.377329f, 5.9730442e-05f, -0.063959748f, 16.108194f, \
+    4.9372644e-05f, -0.052828763f, 13.207632f, 4.005096e-05f, -0.042808391f, 10.595184f, 3.1553267e-05f, -0.033671651f, \
+    8.2120409f, 2.3720162e-05f, -0.025247999f, 6.0140133f, 1.6429191e-05f, -0.017406434f, 3.9671609f, 9.5847681e-06f, \
+    -0.010044668f, 2.0449741f, 3.1115487e-06f, -0.0030819892f, 0.22652046f, -3.0503027e-06f, 0.0035458051f, -1.5048726f, \
+    0.00021785047f, -0.23399048f, 60.440018f, 0.00017469881f, -0.18770202f, 48.413795f, 0.00014411291f, -0.1548821f, \
+    39.882523f, 0.00012079665f, -0.12985413f, 33.373383f, 0.00010212642f, -0.10980618f, 28.156771f, 8.6633234e-05f, \
+    -0.093163937f, 23.824175f, 7.3421135e-05f, -0.078967229f, 20.12644f, 6.1907835e-05f, -0.06659209f, 16.901644f, \
+    5.1695799e-05f, -0.055612568f, 14.039252f, 4.2502688e-05f, -0.045726161f, 11.460765f, 3.4121353e-05f, -0.03671097f, \
+    9.1086006f, 2.6395617e-05f, -0.028399725f, 6.9393582f, 1.9205134e-05f, -0.02066353f, 4.9195933f, 1.2455566e-05f, \
+    -0.013401348f, 3.0230858f, 6.0721513e-06f, -0.0065330458f, 1.2290323f, -4.811116e-09f, 5.4447187e-06f, -0.47921717f, \
+    7.0208494e-05f, -0.041695058f, -1.4033072f, -1.776757e-05f, 0.047609426f, -22.949776f, -5.4934811e-05f, 0.08418414f, \
+    -31.335106f, -7.6457458e-05f, 0.10489917f, -35.903625f, -9.1700582e-05f, 0.11942238f, -39.052132f, -0.00010385823f, \
+    0.13099192f, -41.559799f, -0.00011412839f, 0.14079224f, -43.698162f, -0.0001231014f, 0.14939466f, -45.592873f, \
+    -0.00013113601f, 0.15714242f, -47.317841f, -0.00013847773f, 0.16426927f, -48.923157f, -0.00014530715f, 0.17094722f, \
+    -50.445808f, -0.00015176398f, 0.17730965f, -51.914753f, -0.00015796066f, 0.18346457f, -53.353756f, -0.00016399118f, \
+    0.18950289f, -54.783131f, -0.00016993681f, 0.19550398f, -56.220943f, -0.00017587047f, 0.20153986f, -57.683933f, \
+    0.0002293717f, -0.23068002f, 54.563004f, 0.00012072421f, -0.11580376f, 25.108347f, 6.2518295e-05f, -0.05410273f, \
+    9.232461f, 2.5133191e-05f, -0.014493807f, -0.9492476f, -1.5170991e-06f, 0.013701739f, -8.1810236f, -2.192624e-05f, \
+    0.035257589f, -13.695873f, -3.8469108e-05f, 0.052699238f, -18.147564f, -5.2512478e-05f, 0.067481272f, -21.91312f, \
+    -6.4817577e-05f, 0.080417201f, -25.203955f, -7.5833617e-05f, 0.091989249f, -28.145666f, -8.5862768e-05f, 0.10252215f, \
+    -30.822845f, -9.5127456e-05f, 0.11225466f, -33.297623f, -0.00010380083f, 0.12137232f, -35.618229f, -0.00011202322f, \
+    0.13002525f, -37.823639f, -0.00011991222f, 0.13833907f, -39.946465f, -0.00012756948f, 0.14642231f, -42.014881f, \
+    0.00024685348f, -0.25308025f, 61.719173f, 0.00015135165f, -0.15233216f, 35.976051f, 9.6932745e-05f, -0.094654068f, \
+    21.141296f, 6.0230981e-05f, -0.055656914f, 11.0778f, 3.318824e-05f, -0.02689017f, 3.6441679f, 1.2042968e-05f, \
+    -0.0043863226f, -2.1735969f, -5.2456512e-06f, 0.014014968f, -6.9306574f, -1.9906853e-05f, 0.029617496f, -10.963206f, \
+    -3.273577e-05f, 0.043265659f, -14.489487f, -4.4243228e-05f, 0.055503655f, -17.650589f, -5.4753862e-05f, 0.066679269f, \
+    -20.537058f, -6.4491571e-05f, 0.077033289f, -23.211773f, -7.3624833e-05f, 0.086747177f, -25.722187f, -8.2288287e-05f, \
+    0.095965914f, -28.106243f, -9.0594265e-05f, 0.10481044f, -30.395601f, -9.8639895e-05f, 0.11338527f, -32.617641f, \
+    0.00024974949f, -0.25825703f, 63.804253f, 0.00016333692f, -0.16709295f, 40.513649f, 0.00011291454f, -0.11369802f, \
+    26.801073f, 7.8171965e-05f, -0.07679835f, 17.28689f, 5.2072792e-05f, -0.04902181f, 10.105972f, 3.1364911e-05f, \
+    -0.026952973f, 4.3911157f, 1.4265222e-05f, -0.0087126652f, -0.33733177f, -3.1106097e-07f, 0.0068455888f, -4.3732991f, \
+    -1.3075537e-05f, 0.020475263f, -7.9105849f, -2.4519921e-05f, 0.032697733f, -11.083632f, -3.4983008e-05f, 0.043873314f, \
+    -13.985648f, -4.4695495e-05f, 0.054248605f, -16.680695f, -5.3823962e-05f, 0.064002432f, -19.215393f, -6.2497951e-05f, \
+    0.07327415f, -21.626162f, -7.082407e-05f, 0.082178548f, -23.943043f, -7.8893936e-05f, 0.0908143f, -26.191896f, \
+    0.00024873423f, -0.2586776f, 64.444824f, 0.0001692267f, -0.17471676f, 42.96936f, 0.000121923f, -0.12462188f, \
+    30.106483f, 8.8982022e-05f, -0.089646742f, 21.094856f, 6.3984859e-05f, -0.063048333f, 14.222248f, 4.3962711e-05f, \
+    -0.041707151f, 8.6961765f, 2.7303162e-05f, -0.02392666f, 4.0847683f, 1.3026446e-05f, -0.0086738076f, 0.12417389f, \
+    4.8864388e-07f, 0.0047317301f, -3.3599339f, -1.07593e-05f, 0.016765106f, -6.4896464f, -2.1042377e-05f, 0.027770715f, \
+    -9.3536758f, -3.0594292e-05f, 0.037996992f, -12.016228f, -3.958293e-05f, 0.047623262f, -14.52384f, -4.813556e-05f, \
+    0.056785986f, -16.912054f, -5.6355009e-05f, 0.065595672f, -19.209723f, -6.4328764e-05f, 0.074146442f, -21.441475f, \
+    0.00024637528f, -0.25736046f, 64.52536f, 0.00017249316f, -0.17924123f, 44.512066f, 0.00012769093f, -0.13176563f, \
+    32.313698f, 9.6235133e-05f, -0.098361768f, 23.707008f, 7.2227434e-05f, -0.072817132f, 17.10874f, 5.2892086e-05f, \
+    -0.052208487f, 11.77398f, 3.6720787e-05f, -0.034947105f, 7.2977509f, 2.2803533e-05f, -0.020073732f, 3.4352198f, \
+    1.0545076e-05f, -0.0069600702f, 0.025685031f, -4.69051e-07f, 0.0048319418f, -3.0431654f, -1.054168e-05f, 0.015622754f, \
+    -5.8536763f, -1.9899448e-05f, 0.025652586f, -8.4677277f, -2.8710621e-05f, 0.035100404f, -10.931577f, -3.710188e-05f, \
+    0.044101529f, -13.280344f, -4.5173878e-05f, 0.052763849f, -15.54212f, -5.301123e-05f, 0.061178248f, -17.740633f, \
+    0.00024359964f, -0.25540966f, 64.374023f, 0.00017445251f, -0.18219751f, 45.585274f, 0.00013174373f, -0.13689882f, \
+    33.933655f, 0.00010151897f, -0.10478513f, 25.655107f, 7.834928e-05f, -0.080125749f, 19.284765f, 5.9625665e-05f, \
+    -0.060166772f, 14.118683f, 4.3916021e-05f, -0.043396667f, 9.7704973f, 3.0355935e-05f, -0.028902987f, 6.0069222f, \
+    1.8382982e-05f, -0.016091786f, 2.6759841f, 7.6076699e-06f, -0.0045514344f, -0.32779357f, -2.2540339e-06f, 0.0060185092f, \
+    -3.0815291f, -1.1417381e-05f, 0.015845956f, -5.6438351f, -2.0047517e-05f, 0.025106112f, -8.0598831f, -2.827077e-05f, \
+    0.033933491f, -10.364477f, -3.6186662e-05f, 0.04243448f, -12.585246f, -4.3877913e-05f, 0.050697748f, -14.745288f, \
+    0.00024080927f, -0.25331375f, 64.139122f, 0.0001757187f, -0.18430153f, 46.3969f, 0.0001348115f, -0.14086778f, \
+    35.210556f, 0.00010563104f, -0.10984014f, 27.205187f, 8.3169136e-05f, -0.085921958f, 21.02338f, 6.4970336e-05f, \
+    -0.066516235f, 15.999499f, 4.9669547e-05f, -0.050179221f, 11.763484f, 3.6437261e-05f, -0.036033645f, 8.0904751f, \
+    2.4733579e-05f, -0.023508493f, 4.8340888f, 1.4186164e-05f, -0.012209902f, 1.893299f, 4.5248216e-06f, -0.0018519283f, \
+    -0.80530721f, -4.4552335e-06f, 0.0077822646f, -3.3174744f, -1.291368e-05f, 0.016861929f, -5.6867895f, -2.0975594e-05f, \
+    0.025519965f, -7.9475713f, -2.8739896e-05f, 0.033861861f, -10.127156f, -3.6288126e-05f, 0.041974857f, -12.248226f, \
+    0.00023819617f, -0.25131309f, 63.895821f, 0.00017662f, -0.18593754f, 47.05901f, 0.00013728939f, -0.14413069f, \
+    36.276646f, 0.00010901267f, -0.11403714f, 28.504129f, 8.7155517e-05f, -0.09074714f, 22.480267f, 6.9404043e-05f, \
+    -0.071809039f, 17.575178f, 5.4455581e-05f, -0.055842578f, 13.434202f, 4.1511728e-05f, -0.042001795f, 9.8399601f, \
+    3.0050349e-05f, -0.029733479f, 6.6502914f, 1.9711297e-05f, -0.018656051f, 3.7671318f, 1.0234087e-05f, -0.0084935222f, \
+    1.1195264f, 1.4219761e-06f, 0.00096259866f, -1.3461627f, -6.8790719e-06f, 0.0098756133f, -3.6719925f, -1.479186e-05f, \
+    0.018375888f, -5.8915992f, -2.2414772e-05f, 0.026568165f, -8.0320854f, -2.982868e-05f, 0.034538824f, -10.115876f, \
+    0.00023585735f, -0.24953432f, 63.68531f, 0.00017734963f, -0.18733278f, 47.638237f, 0.00013941269f, -0.1469606f, \
+    37.210831f, 0.00011192892f, -0.11768254f, 29.640078f, 9.0595029e-05f, -0.094932057f, 23.750418f, 7.3226423e-05f, \
+    -0.076390766f, 18.944902f, 5.8578884e-05f, -0.060738117f, 14.883467f, 4.5883215e-05f, -0.047157701f, 11.355844f, \
+    3.4633271e-05f, -0.035112314f, 8.2236681f, 2.4478717e-05f, -0.024230124f, 5.3911624f, 1.5166153e-05f, -0.014242227f, \
+    2.7890558f, 6.5046574e-06f, -0.0049460279f, 0.36514807f, -1.6551269e-06f, 0.0038169599f, -1.9214176f, -9.4333109e-06f, \
+    0.012174261f, -4.1035509f, -1.6927541e-05f, 0.020229736f, -6.2081108f, -2.4218363e-05f, 0.028069314f, -8.2573824f, \
+    0.00023384375f, -0.24804804f, 63.531715f, 0.00017803012f, -0.18863218f, 48.17733f, 0.00014133258f, -0.14953327f, \
+    38.063965f, 0.00011455065f, -0.12097379f, 30.669834f, 9.3673843e-05f, -0.098691404f, 24.895435f, 7.6635006e-05f, \
+    -0.080488935f, 20.173883f, 6.2244129e-05f, -0.065101445f, 16.178766f, 4.9759619e-05f, -0.051740579f, 12.706622f, \
+    3.8690439e-05f, -0.039884325f, 9.6227121f, 2.8695142e-05f, -0.029169692f, 6.833334f, 1.9526127e-05f, -0.019333482f, \
+    4.2705426f, 1.0996834e-05f, -0.01017742f, 1.8831493f, 2.9614782e-06f, -0.0015465984f, -0.36884347f, -4.6975406e-06f, \
+    0.0066839447f, -2.5177171f, -1.2076913e-05f, 0.014617049f, -4.5900712f, -1.9257042e-05f, 0.02233842f, -6.6081238f, \
+    0.00023218336f, -0.246896f, 63.450153f, 0.00017874446f, -0.18993439f, 48.705574f, 0.00014315284f, -0.15196939f, \
+    38.871033f, 0.00011699499f, -0.1240463f, 31.632351f, 9.6519841e-05f, -0.10217253f, 25.957577f, 7.976636e-05f, \
+    -0.084260695f, 21.30711f, 6.5594482e-05f, -0.069097154f, 17.367178f, 5.3288462e-05f, -0.055919923f, 13.940748f, \
+    4.2371619e-05f, -0.044221498f, 10.896566f, 3.2510939e-05f, -0.03364731f, 8.1429243f, 2.3464101e-05f, -0.023939373f, \
+    5.6130877f, 1.5048176e-05f, -0.014902957f, 3.2566807f, 7.1201644e-06f, -0.0063858796f, 1.0343357f, -4.3543329e-07f, \
+    0.0017347414f, -1.0857396f, -7.7142649e-06f, 0.0095606958f, -3.1298966f, -1.4796638e-05f, 0.017177569f, -5.120326f, \
+    0.00023089291f, -0.24610528f, 63.450951f, 0.0001795525f, -0.19131097f, 49.244312f, 0.00014494894f, -0.1543569f, \
+    39.657566f, 0.000119347f, -0.12699834f, 32.555901f, 9.9225574e-05f, -0.10548204f, 26.967392f, 8.2719438e-05f, \
+    -0.0878198f, 22.377121f, 6.8734225e-05f, -0.072844997f, 18.48292f, 5.6578188e-05f, -0.059820171f, 15.093745f, \
+    4.5788147e-05f, -0.048251502f, 12.081655f, 3.603912e-05f, -0.037792496f, 9.356864f, 2.7093814e-05f, -0.028190147f, \
+    6.8538027f, 1.8772624e-05f, -0.019252978f, 4.5228453f, 1.0934928e-05f, -0.010831115f, 2.3251464f, 3.4669945e-06f, \
+    -0.0028033778f, 0.22930019f, -3.7258014e-06f, 0.0049310313f, -1.7908224f, -1.0723636e-05f, 0.012457579f, -3.7573955f, \
+    0.0002299843f, -0.24569598f, 63.541954f, 0.00018050046f, -0.19281726f, 49.810093f, 0.00014677909f, -0.15676369f, \
+    40.443268f, 0.00012167183f, -0.12990519f, 33.462135f, 0.00010186157f, -0.10870109f, 27.948122f, 8.5569387e-05f, \
+    -0.091252558f, 23.408577f, 7.1742601e-05f, -0.076435857f, 19.55192f, 5.9711518e-05f, -0.063536108f, 16.192638f, \
+    4.902553e-05f, -0.052072261f, 13.205879f, 3.9367238e-05f, -0.041705448f, 10.503683f, 3.0504127e-05f, -0.032187432f, \
+    8.0216084f, 2.2259765e-05f, -0.023329858f, 5.710752f, 1.4495736e-05f, -0.014984995f, 3.5327578f, 7.0998954e-06f, \
+    -0.0070331888f, 1.4565614f, -2.1380105e-08f, 0.00062541245f, -0.54375947f, -6.9480384e-06f, 0.0080760848f, -2.4903514f, \
+    0.00022946819f, -0.24568553f, 63.729897f, 0.00018162646f, -0.19449894f, 50.416592f, 0.00014869089f, -0.15924516f, \
+    41.244228f, 0.00012402222f, -0.13282774f, 34.368546f, 0.00010448436f, -0.1118947f, 28.918364f, 8.837608e-05f, \
+    -0.094627634f, 24.421074f, 7.4682481e-05f, -0.079941757f, 20.594711f, 6.2754058e-05f, -0.067142837f, 17.258812f, \
+    5.2151783e-05f, -0.055761568f, 14.291372f, 4.2565287e-05f, -0.045466173f, 11.606135f, 3.3766559e-05f, -0.036012921f, \
+    9.1397219f, 2.5582174e-05f, -0.027216438f, 6.8439283f, 1.7875833e-05f, -0.018931052f, 4.6808734f, 1.0536907e-05f, \
+    -0.011038579f, 2.6198249f, 3.4727841e-06f, -0.0034401277f, 0.63507175f, -3.3961176e-06f, 0.0039492599f, -1.2954752f, \
+    0.00022935626f, -0.24609172f, 64.021271f, 0.00018296436f, -0.19639644f, 51.075855f, 0.00015072555f, -0.16184929f, \
+    42.074348f, 0.00012644318f, -0.1358179f, 35.290031f, 0.0001071417f, -0.11511765f, 29.89378f, 9.1189584e-05f, \
+    -0.098002397f, 25.430967f, 7.7606113e-05f, -0.083422489f, 21.628307f, 6.5760112e-05f, -0.070702434f, 18.309917f, \
+    5.5223121e-05f, -0.059383638f, 15.356385f, 4.5691209e-05f, -0.04914083f, 12.683007f, 3.6940524e-05f, -0.039734416f, \
+    10.227386f, 2.8800448e-05f, -0.030981809f, 7.9419742f, 2.1136682e-05f, -0.022739315f, 5.7893448f, 1.3840071e-05f, \
+    -0.014890176f, 3.7390954f, 6.8190429e-06f, -0.0073365029f, 1.76574f, -5.4666867e-09f, 6.1866249e-06f, -0.15271217f, \
+    0.00013336488f, -0.11154177f, 18.145702f, 1.7873472e-05f, 0.0070283888f, -11.129383f, -2.8760473e-05f, 0.053901125f, \
+    -22.32303f, -5.4875083e-05f, 0.079742379f, -28.333502f, -7.241295e-05f, 0.09694355f, -32.270824f, -8.5845968e-05f, \
+    0.11009538f, -35.270199f, -9.7077587e-05f, 0.12112921f, -37.800282f, -0.00010698484f, 0.130923f, -40.068878f, \
+    -0.00011605006f, 0.13995458f, -42.186886f, -0.00012458468f, 0.14853133f, -44.225121f, -0.00013281578f, 0.15687801f, \
+    -46.235638f, -0.00014092574f, 0.16517664f, -48.261223f, -0.00014907384f, 0.17358829f, -50.340557f, -0.00015741032f, \
+    0.18226717f, -52.511555f, -0.0001660874f, 0.19137192f, -54.814106f, -0.00017526948f, 0.20107631f, -57.292801f, \
+    0.00026177752f, -0.26395139f, 63.300594f, 0.00014056473f, -0.1368499f, 30.946692f, 7.8059747e-05f, -0.070987657f, \
+    14.074579f, 3.8411552e-05f, -0.029153362f, 3.344559f, 1.0314727e-05f, 0.00050210732f, -4.2592764f, -1.1113042e-05f, \
+    0.023121597f, -10.055275f, -2.8380731e-05f, 0.04135441f, -14.725019f, -4.2957119e-05f, 0.056752849f, -18.668617f, \
+    -5.5771801e-05f, 0.070299946f, -22.139759f, -6.7408226e-05f, 0.082614444f, -25.2985f, -7.8248013e-05f, 0.094102696f, \
+    -28.250261f, -8.8566943e-05f, 0.10505934f, -31.071705f, -9.8584635e-05f, 0.11571966f, -33.82423f, -0.00010849142f, \
+    0.1262881f, -36.561371f, -0.00011846542f, 0.13695657f, -39.333595f, -0.00012868576f, 0.1479187f, -42.192028f, \
+    0.0002720292f, -0.27834186f, 68.255478f, 0.00016582574f, -0.16706342f, 39.967579f, 0.00010836675f, -0.10656312f, \
+    24.489019f, 7.022552e-05f, -0.066260599f, 14.132851f, 4.2243504e-05f, -0.036622651f, 6.4970012f, 2.0369107e-05f, \
+    -0.013413091f, 0.50721955f, 2.4545175e-06f, 0.0056233429f, -4.4119053f, -1.2772243e-05f, 0.021826331f, -8.6036844f, \
+    -2.6135134e-05f, 0.036065415f, -12.29166f, -3.8210834e-05f, 0.048949916f, -15.632861f, -4.9411254e-05f, 0.060916137f, \
+    -18.74007f, -6.0031391e-05f, 0.07227803f, -21.694807f, -7.0296694e-05f, 0.083276778f, -24.560007f, -8.0395934e-05f, \
+    0.094115205f, -27.388844f, -9.050154e-05f, 0.10497929f, -30.230278f, -0.00010078399f, 0.11605347f, -33.133068f, \
+    0.00027170329f, -0.28012598f, 69.458725f, 0.00017568613f, -0.17939034f, 43.810989f, 0.00012237969f, -0.12326402f, \
+    29.456217f, 8.6423439e-05f, -0.08528135f, 19.702869f, 5.960913e-05f, -0.056876585f, 12.385274f, 3.8340171e-05f, \
+    -0.034293618f, 6.5527444f, 2.0720632e-05f, -0.015548068f, 1.7014617f, 5.6211302e-06f, 0.00054557086f, -2.4708078f, \
+    -7.6911001e-06f, 0.014758534f, -6.1614404f, -1.9727644e-05f, 0.0276304f, -9.5089836f, -3.0870979e-05f, 0.039565213f, \
+    -12.617482f, -4.1415555e-05f, 0.050874837f, -15.567518f, -5.1589868e-05f, 0.061802454f, -18.422247f, -6.1581552e-05f, \
+    0.072548866f, -21.234102f, -7.1558388e-05f, 0.083294541f, -24.050457f, -8.1683778e-05f, 0.0942159f, -26.917833f, \
+    0.00026886369f, -0.27870598f, 69.643883f, 0.0001807121f, -0.18605846f, 46.002457f, 0.00013053877f, -0.13318381f, \
+    32.466122f, 9.6360054e-05f, -0.097068496f, 23.191252f, 7.0682567e-05f, -0.069866873f, 16.185215f, 5.0161376e-05f, \
+    -0.048076421f, 10.558353f, 3.3038508e-05f, -0.029855436f, 5.8425808f, 1.8275303e-05f, -0.014114415f, 1.7605064f, \
+    5.2003606e-06f, -0.00014768854f, -1.8680369f, -6.6528123e-06f, 0.012536147f, -5.1689081f, -1.7630984e-05f, 0.024303099f, \
+    -8.2361441f, -2.8008844e-05f, 0.035443611f, -11.144592f, -3.8010468e-05f, 0.046195328f, -13.955732f, -4.7822312e-05f, \
+    0.056756999f, -16.721258f, -5.7609403e-05f, 0.067305513f, -19.487434f, -6.7530404e-05f, 0.078011729f, -22.299185f, \
+    0.00026549769f, -0.27643445f, 69.506165f, 0.00018373574f, -0.19034217f, 47.485191f, 0.00013607541f, -0.14005065f, \
+    34.590096f, 0.00010330105f, -0.10539163f, 25.681725f, 7.8556732e-05f, -0.079167388f, 18.925287f, 5.8704376e-05f, \
+    -0.058082737f, 13.480611f, 4.2074713e-05f, -0.040384501f, 8.9005909f, 2.7681264e-05f, -0.025036171f, 4.9207592f, \
+    1.4890372e-05f, -0.011371316f, 1.3708727f, 3.2647181e-06f, 0.0010707058f, -1.8669888f, -7.5180451e-06f, 0.012630085f, \
+    -4.8801455f, -1.7711982e-05f, 0.023575433f, -7.7377443f, -2.7529637e-05f, 0.034131907f, -10.497928f, -3.7153892e-05f, \
+    0.044493932f, -13.211117f, -4.6747678e-05f, 0.054835618f, -15.922711f, -5.6466568e-05f, 0.065324068f, -18.676514f, \
+    0.00026230211f, -0.27415848f, 69.302864f, 0.00018585112f, -0.19350921f, 48.625275f, 0.00014028656f, -0.14535886f, \
+    36.256947f, 0.00010865407f, -0.11187096f, 27.638687f, 8.4660314e-05f, -0.08642295f, 21.077044f, 6.5357242e-05f, \
+    -0.065911748f, 15.77827f, 4.9152583e-05f, -0.0486609f, 11.313406f, 3.509692e-05f, -0.033670466f, 7.4265065f, \
+    2.2579376e-05f, -0.020296715f, 3.9527099f, 1.1180206e-05f, -0.0080969501f, 0.77851665f, 5.9234929e-07f, 0.0032531468f, \
+    -2.1793702f, -9.423833e-06f, 0.014007096f, -4.9862204f, -1.906863e-05f, 0.024377141f, -7.6968236f, -2.8518634e-05f, \
+    0.034550842f, -10.359753f, -3.7934355e-05f, 0.04469936f, -13.019537f, -4.7469235e-05f, 0.054987136f, -15.719172f, \
+    0.00025956272f, -0.27224004f, 69.148392f, 0.00018758298f, -0.19617002f, 49.599758f, 0.00014380118f, -0.14983308f, \
+    37.674629f, 0.00011312027f, -0.11731224f, 29.292717f, 8.9736641e-05f, -0.092487291f, 22.884619f, 7.087538e-05f, \
+    -0.072431177f, 17.699488f, 5.5016342e-05f, -0.055539902f, 13.325725f, 4.1243555e-05f, -0.040846605f, 9.5151138f, \
+    2.8963481e-05f, -0.027724447f, 6.1066527f, 1.7767379e-05f, -0.015741479f, 2.9893105f, 7.357216e-06f, -0.0045824135f, \
+    0.081953742f, -2.4977917e-06f, 0.0059972093f, -2.6784341f, -1.1988792e-05f, 0.016200166f, -5.3442359f, -2.128531e-05f, \
+    0.02620657f, -7.9620924f, -3.0544681e-05f, 0.036184028f, -10.575555f, -3.991873e-05f, 0.046294957f, -13.22701f, \
+    0.00025740932f, -0.27085361f, 69.100792f, 0.00018922253f, -0.19866508f, 50.507935f, 0.00014697119f, -0.15387899f, \
+    38.959644f, 0.00011709407f, -0.12216833f, 30.773302f, 9.4211879e-05f, -0.097849041f, 24.487497f, 7.5704811e-05f, \
+    -0.07815221f, 19.390123f, 6.0119484e-05f, -0.061541311f, 15.085863f, 4.6571728e-05f, -0.047081187f, 11.334024f, \
+    3.4484143e-05f, -0.034160849f, 7.9772549f, 2.3456822e-05f, -0.02235681f, 4.9064126f, 1.3197522e-05f, -0.01135933f, \
+    2.0415947f, 3.4806089e-06f, -0.00092899374f, -0.67903858f, -5.8793535e-06f, 0.0091312081f, -3.3064561f, -1.5046016e-05f, \
+    0.018995339f, -5.8857727f, -2.4173094e-05f, 0.028827159f, -8.4595289f, -3.3410983e-05f, 0.038787369f, -11.069614f, \
+    0.0002559089f, -0.27009532f, 69.193794f, 0.00019095199f, -0.20120843f, 51.412521f, 0.00015001767f, -0.15775165f, \
+    40.185291f, 0.0001208223f, -0.1267225f, 32.161369f, 9.835363e-05f, -0.10281461f, 25.973034f, 8.0129335e-05f, \
+    -0.083399534f, 20.94264f, 6.4756627e-05f, -0.06700208f, 16.689756f, 5.1380986e-05f, -0.052716859f, 12.980791f, \
+    3.9440562e-05f, -0.039948232f, 9.661993f, 2.8543884e-05f, -0.028280932f, 6.6260834f, 1.8403556e-05f, -0.017409801f, \
+    3.7941599f, 8.7973094e-06f, -0.0070985807f, 1.1050644f, -4.5694469e-07f, 0.0028464994f, -1.4914297f, -9.518857e-06f, \
+    0.0125955f, -4.039463f, -1.8538745e-05f, 0.022308679f, -6.5806923f, -2.766563e-05f, 0.032145202f, -9.1565828f, \
+    0.00025510465f, -0.27002954f, 69.450584f, 0.00019289936f, -0.20395066f, 52.357773f, 0.00015309502f, -0.16162913f, \
+    41.402756f, 0.00012447551f, -0.1311702f, 33.512718f, 0.00010234558f, -0.10759405f, 27.401018f, 8.4343956e-05f, \
+    -0.088395871f, 22.420368f, 6.9131966e-05f, -0.072155342f, 18.203644f, 5.5882068e-05f, -0.057994146f, 14.523746f, \
+    4.4046901e-05f, -0.045331076f, 11.230319f, 3.3243177e-05f, -0.033758879f, 8.2179441f, 2.318825e-05f, -0.022976972f, \
+    5.408742f, 1.3662749e-05f, -0.012751828f, 2.7421417f, 4.4868339e-06f, -0.0028917675f, 0.16836791f, -4.4966237e-06f, \
+    0.0067708339f, -2.3561587f, -1.3435238e-05f, 0.016393535f, -4.872438f, -2.2476685e-05f, 0.026134089f, -7.4215689f, \
+    0.00025503433f, -0.27071115f, 69.890526f, 0.00019516573f, -0.20701072f, 53.378593f, 0.00015632277f, -0.16564913f, \
+    42.651566f, 0.00012818344f, -0.13565998f, 34.869694f, 0.00010632568f, -0.11234483f, 28.816208f, 8.8494024e-05f, \
+    -0.093306959f, 23.870337f, 7.3397539e-05f, -0.077174328f, 19.676659f, 6.0232665e-05f, -0.063092701f, 16.013821f, \
+    4.8465088e-05f, -0.050493836f, 12.734529f, 3.7719099e-05f, -0.03897794f, 9.735095f, 2.7716629e-05f, -0.028248893f, \
+    6.9386616f, 1.8241191e-05f, -0.018075934f, 4.2852759f, 9.1149295e-06f, -0.008269255f, 1.7255719f, 1.8251303e-07f, \
+    0.0013370648f, -0.78364956f, -8.7016433e-06f, 0.010898608f, -3.2829225f, -1.7683913e-05f, 0.020571822f, -5.8130245f, \
+    0.00025574074f, -0.27219778f, 70.532898f, 0.00019784112f, -0.21049385f, 54.505714f, 0.00015980346f, -0.16992946f, \
+    43.965439f, 0.00013205485f, -0.14031607f, 36.267624f, 0.00011040751f, -0.11719638f, 30.255308f, 9.2697657e-05f, \
+    -0.09826719f, 25.330618f, 7.7675868e-05f, -0.082198381f, 21.148239f, 6.4559455e-05f, -0.068156548f, 17.491774f, \
+    5.2825479e-05f, -0.055584721f, 14.216558f, 4.2104883e-05f, -0.044089615f, 11.220406f, 3.2123735e-05f, -0.033379141f, \
+    8.4273825f, 2.2668277e-05f, -0.023225186f, 5.7781367f, 1.3562591e-05f, -0.013439818f, 3.2237298f, 4.6529603e-06f, \
+    -0.003858675f, 0.7213214f, -4.2045235e-06f, 0.0056721959f, -1.7692381f, -1.31549e-05f, 0.015307923f, -4.2884059f, \
+    0.00025727839f, -0.27455837f, 71.399452f, 0.00020101454f, -0.21450342f, 55.769062f, 0.00016363407f, -0.17458117f, \
+    45.376038f, 0.00013618995f, -0.14525262f, 37.738873f, 0.00011469363f, -0.12226529f, 31.751299f, 9.7059768e-05f, \
+    -0.10339573f, 26.834883f, 8.2074403e-05f, -0.087349482f, 22.652845f, 6.8972571e-05f, -0.07331071f, 18.99291f, \
+    5.724089e-05f, -0.060731787f, 15.712571f, 4.6515826e-05f, -0.04922479f, 12.710846f, 3.6526893e-05f, -0.038500931f, \
+    9.9125385f, 2.7062651e-05f, -0.028334334f, 7.2588005f, 1.7948933e-05f, -0.018538767f, 4.7010846f, 9.0335388e-06f, \
+    -0.0089513678f, 2.1969054f, 1.7412417e-07f, 0.00058025733f, -0.29350507f, -8.7728677e-06f, 0.010209749f, -2.8102338f, \
+    0.00025971964f, -0.27788031f, 72.516594f, 0.00020478221f, -0.21915016f, 57.200405f, 0.00016791475f, -0.17971835f, \
+    46.915722f, 0.00014068952f, -0.15058404f, 39.315769f, 0.00011928511f, -0.12766615f, 33.336514f, 0.00010168205f, \
+    -0.10880781f, 28.415623f, 8.6695858e-05f, -0.092743993f, 24.22328f, 7.3576084e-05f, -0.07867308f, 20.550476f, \
+    6.1817009e-05f, -0.066054791f, 17.25634f, 5.1059364e-05f, -0.054505233f, 14.240761f, 4.1035237e-05f, -0.043738004f, \
+    11.42904f, 3.1534899e-05f, -0.033528805f, 8.7626648f, 2.2385502e-05f, -0.023692666f, 6.1933651f, 1.3436089e-05f, \
+    -0.014067947f, 3.6789453f, 4.5457273e-06f, -0.0045036925f, 1.1799976f, -4.4275293e-06f, 0.0051520858f, -1.3431416f, \
+    0.0002631617f, -0.28227752f, 73.917679f, 0.00020925529f, -0.22456104f, 58.835857f, 0.00017275658f, -0.18546703f, \
+    48.62009f, 0.00014566274f, -0.15643398f, 41.033154f, 0.00012428963f, -0.13352074f, 35.045231f, 0.00010667123f, \
+    -0.11462414f, 30.106812f, 9.164666e-05f, -0.098502301f, 25.893423f, 7.8476638e-05f, -0.084364317f, 22.198429f, \
+    6.6661079e-05f, -0.071675114f, 18.882044f, 5.5843659e-05f, -0.060053412f, 15.844649f, 4.5758054e-05f, -0.04921414f, \
+    13.011776f, 3.6195488e-05f, -0.038933776f, 10.325027f, 2.6983807e-05f, -0.029027931f, 7.7362337f, 1.7972792e-05f, \
+    -0.019335657f, 5.2033525f, 9.0225476e-06f, -0.009707042f, 2.6872344f, -7.3849749e-09f, 8.3575414e-06f, 0.14862035f, \
+    0.00021585198f, -0.19956499f, 41.62281f, 5.8491896e-05f, -0.037220124f, 1.0692655f, -9.5512712e-07f, 0.023241045f, \
+    -13.703532f, -3.3394394e-05f, 0.055887006f, -21.539545f, -5.4693799e-05f, 0.077203728f, -26.60116f, -7.0505252e-05f, \
+    0.093020752f, -30.34527f, -8.3432555e-05f, 0.10600576f, -33.43251f, -9.4805597e-05f, 0.1175135f, -36.195324f, \
+    -0.00010535278f, 0.12828323f, -38.813633f, -0.00011553567f, 0.13878424f, -41.40163f, -0.00012569997f, 0.14937139f, \
+    -44.046669f, -0.00013614885f, 0.1603606f, -46.82811f, -0.00014718778f, 0.17207564f, -49.829109f, -0.00015916245f, \
+    0.18488848f, -53.147095f, -0.00017250313f, 0.19926745f, -56.906509f, -0.00018778937f, 0.21584842f, -61.277966f, \
+    0.00031260354f, -0.31561834f, 76.398529f, 0.00016832733f, -0.16548574f, 38.443008f, 9.865965e-05f, -0.092517599f, \
+    19.842997f, 5.5225213e-05f, -0.046880659f, 8.1702776f, 2.46328e-05f, -0.014676414f, -0.078427851f, 1.3092466e-06f, \
+    0.0099178553f, -6.3843665f, -1.7540682e-05f, 0.029833803f, -11.497194f, -3.3510703e-05f, 0.046747454f, -15.846997f, \
+    -4.7619294e-05f, 0.061732065f, -19.70997f, -6.0585684e-05f, 0.075547069f, -23.282112f, -7.2937037e-05f, 0.088751607f, \
+    -26.708422f, -8.5084241e-05f, 0.10178475f, -30.103573f, -9.7388933e-05f, 0.11503618f, -33.57019f, -0.00011021566f, \
+    0.12890182f, -37.213371f, -0.00012398012f, 0.14383602f, -41.154526f, -0.00013920871f, 0.16041674f, -45.548882f, \
+    0.00031479337f, -0.32153612f, 79.165291f, 0.00018908062f, -0.19057207f, 46.014469f, 0.00012574012f, -0.1242638f, \
+    29.129515f, 8.4751082e-05f, -0.0811719f, 18.102171f, 5.4906061e-05f, -0.04968724f, 10.015257f, 3.1570497e-05f, \
+    -0.024997501f, 3.6554961f, 1.2365931e-05f, -0.0046228175f, -1.6058419f, -4.0961459e-06f, 0.012890479f, -6.1393142f, \
+    -1.8705807e-05f, 0.02847789f, -10.184566f, -3.2086682e-05f, 0.04279748f, -13.910996f, -4.4723598e-05f, 0.056362767f, \
+    -17.451439f, -5.7025245e-05f, 0.069608688f, -20.91905f, -6.9355177e-05f, 0.082925059f, -24.416023f, -8.2069157e-05f, \
+    0.096696608f, -28.044056f, -9.5559997e-05f, 0.11135118f, -31.917044f, -0.00011031327f, 0.12742037f, -36.177242f, \
+    0.00030994666f, -0.31874534f, 79.241211f, 0.00019715122f, -0.20096223f, 49.338516f, 0.00013832544f, -0.13931987f, \
+    33.62574f, 9.9751698e-05f, -0.098757841f, 23.246157f, 7.1327631e-05f, -0.068768084f, 15.544292f, 4.8828075e-05f, \
+    -0.044954069f, 9.4086685f, 3.0109051e-05f, -0.025082137f, 4.2737617f, 1.3923633e-05f, -0.0078498386f, -0.19126068f, \
+    -5.3121306e-07f, 0.0075847111f, -4.201221f, -1.3817935e-05f, 0.021813815f, -7.9080591f, -2.6366073e-05f, 0.035292134f, \
+    -11.429101f, -3.8540817e-05f, 0.048408154f, -14.865206f, -5.0684695e-05f, 0.061528198f, -18.312075f, -6.3141415e-05f, \
+    0.075022459f, -21.867128f, -7.6287986e-05f, 0.089300007f, -25.6388f, -9.0584428e-05f, 0.10486285f, -29.760887f, \
+    0.00030424469f, -0.31450731f, 78.756195f, 0.00020140926f, -0.20685999f, 51.341141f, 0.0001459808f, -0.14868052f, \
+    36.481384f, 0.00010921802f, -0.10998445f, 26.569008f, 8.1971179e-05f, -0.081221931f, 19.179565f, 6.0295373e-05f, \
+    -0.058273777f, 13.26683f, 4.2165313e-05f, -0.039023973f, 8.2930317f, 2.6407004e-05f, -0.022244511f, 3.9457023f, \
+    1.2269427e-05f, -0.0071480195f, 0.023983389f, -7.7193124e-07f, 0.0068174587f, -3.6135223f, -1.3115697e-05f, 0.020073529f, \
+    -7.075428f, -2.5094965e-05f, 0.032974578f, -10.453628f, -3.7022503e-05f, 0.045855161f, -13.835421f, -4.9223308e-05f, \
+    0.059064761f, -17.312546f, -6.206071e-05f, 0.072996482f, -20.98884f, -7.597782e-05f, 0.088132463f, -24.992352f, \
+    0.00029913196f, -0.31058472f, 78.247612f, 0.00020424667f, -0.21102117f, 52.813965f, 0.00015154043f, -0.15559421f, \
+    38.624252f, 0.0001161728f, -0.1183141f, 29.058857f, 8.9822519e-05f, -0.090470865f, 21.898191f, 6.879992e-05f, \
+    -0.068200588f, 16.157045f, 5.1175648e-05f, -0.049481478f, 11.319564f, 3.5819212e-05f, -0.033127729f, 7.0828943f, \
+    2.2006081e-05f, -0.01837814f, 3.2523251f, 9.2322216e-06f, -0.0047017434f, -0.30834049f, -2.8836196e-06f, 0.0083048036f, \
+    -3.7030194f, -1.4657413e-05f, 0.020977676f, -7.018836f, -2.6380952e-05f, 0.03362919f, -10.337253f, -3.8358918e-05f, \
+    0.046587031f, -13.744206f, -5.0940485e-05f, 0.060228437f, -17.339119f, -6.4556356e-05f, 0.075020969f, -21.245806f, \
+    0.00029504971f, -0.30755606f, 77.903755f, 0.00020661781f, -0.21455024f, 54.075825f, 0.00015615225f, -0.16137601f, \
+    40.42979f, 0.00012189582f, -0.1252093f, 31.132095f, 9.6231706e-05f, -0.098056987f, 24.138941f, 7.5700162e-05f, \
+    -0.076286741f, 18.521086f, 5.8462105e-05f, -0.057966478f, 13.783908f, 4.3426193e-05f, -0.041948508f, 9.6333008f, \
+    2.9886167e-05f, -0.027489014f, 5.8783717f, 1.7348444e-05f, -0.014066947f, 2.3851042f, 5.4400275e-06f, -0.001287188f, \
+    -0.94847077f, -6.1467676e-06f, 0.011177802f, -4.2072873f, -1.7692939e-05f, 0.023628902f, -7.4698181f, -2.9488072e-05f, \
+    0.036377762f, -10.817777f, -4.1867621e-05f, 0.049786668f, -14.346531f, -5.5252323e-05f, 0.064311609f, -18.17655f, \
+    0.00029215196f, -0.30564925f, 77.805977f, 0.00020900232f, -0.21800543f, 55.288818f, 0.00016039664f, -0.16669102f, \
+    42.087955f, 0.00012703735f, -0.13141218f, 32.999722f, 0.00010190211f, -0.1047819f, 26.129374f, 8.1732498e-05f, \
+    -0.083371215f, 20.597006f, 6.4771855e-05f, -0.065330438f, 15.927698f, 4.9966467e-05f, -0.049549025f, 11.836042f, \
+    3.6627986e-05f, -0.035300456f, 8.1350613f, 2.4271169e-05f, -0.022071473f, 4.692389f, 1.2527146e-05f, -0.0094706733f, \
+    1.4067918f, 1.0913254e-06f, 0.0028265184f, -1.8060088f, -1.0313079e-05f, 0.015116589f, -5.0233707f, -2.1967619e-05f, \
+    0.027702674f, -8.32477f, -3.4196863e-05f, 0.040935375f, -11.802444f, -4.7413374e-05f, 0.055261359f, -15.5742f, \
+    0.00029050899f, -0.30498156f, 77.999458f, 0.00021169057f, -0.22172593f, 56.55188f, 0.00016462333f, -0.17194006f, \
+    43.713245f, 0.00013198504f, -0.13736464f, 34.787235f, 0.00010725303f, -0.11112256f, 28.00462f, 8.7342094e-05f, \
+    -0.089959972f, 22.528025f, 7.0568123e-05f, -0.072099783f, 17.899906f, 5.5911725e-05f, -0.056465462f, 13.842875f, \
+    4.2701959e-05f, -0.042347554f, 10.173909f, 3.0462443e-05f, -0.02924132f, 6.762557f, 1.8828257e-05f, -0.016759014f, \
+    3.508342f, 7.4961686e-06f, -0.0045771818f, 0.32715827f, -3.809836e-06f, 0.0075999694f, -2.8582196f, -1.5368676e-05f, \
+    0.020072784f, -6.1265349f, -2.7498421e-05f, 0.03318492f, -9.5681629f, -4.0605468e-05f, 0.047376122f, -13.298944f, \
+    0.00029017881f, -0.30564594f, 78.519119f, 0.00021489365f, -0.2259582f, 57.936821f, 0.0001690803f, -0.17740689f, \
+    45.386604f, 0.00013700782f, -0.14337263f, 36.581348f, 0.00011257103f, -0.11740429f, 29.856655f, 9.283179e-05f, \
+    -0.096396461f, 24.411129f, 7.6168042e-05f, -0.078634024f, 19.802002f, 6.1590028e-05f, -0.063069731f, 15.758764f, \
+    4.8442336e-05f, -0.049009349f, 12.101922f, 3.6257137e-05f, -0.035956487f, 8.7029419f, 2.4674055e-05f, -0.023527808f, \
+    5.4623461f, 1.3391671e-05f, -0.011401566f, 2.2963927f, 2.1339786e-06f, 0.0007181082f, -0.87219566f, -9.37814e-06f, \
+    0.013131737f, -4.1221976f, -2.1460432e-05f, 0.026180446f, -7.5432849f, -3.4515542e-05f, 0.040299781f, -11.250081f, \
+    0.000291239f, -0.30774981f, 79.401566f, 0.00021879553f, -0.23091562f, 59.505436f, 0.00017397365f, -0.1833266f, \
+    47.174847f, 0.00014232242f, -0.1496821f, 38.451576f, 0.00011808182f, -0.12388267f, 31.757551f, 9.8436314e-05f, \
+    -0.10294622f, 26.321123f, 8.1815379e-05f, -0.085208826f, 21.711611f, 6.7253677e-05f, -0.069647133f, 17.66404f, \
+    5.4108456e-05f, -0.055579189f, 14.001702f, 4.1918993e-05f, -0.042515457f, 10.597621f, 3.0329076e-05f, -0.030076658f, \
+    7.3532491f, 1.9039533e-05f, -0.017943308f, 4.1853833f, 7.7749364e-06f, -0.0058201784f, 1.0169152f, -3.7445441e-06f, \
+    0.0065938956f, -2.2310615f, -1.5834905e-05f, 0.019640164f, -5.6481843f, -2.8897424e-05f, 0.033752546f, -9.3485441f, \
+    0.00029380649f, -0.31143945f, 80.692467f, 0.00022358404f, -0.23681408f, 61.319588f, 0.00017950207f, -0.18992475f, \
+    49.141762f, 0.00014813078f, -0.15652142f, 40.462223f, 0.00012399028f, -0.13078901f, 33.772343f, 0.00010436428f, \
+    -0.10984468f, 28.324148f, 8.7723391e-05f, -0.092064813f, 23.696323f, 7.3121133e-05f, -0.076444201f, 19.627949f, \
+    5.9924099e-05f, -0.062309653f, 15.944219f, 4.7676476e-05f, -0.049176197f, 12.519105f, 3.602482e-05f, -0.036667138f, \
+    9.2546139f, 2.4671552e-05f, -0.024464564f, 6.0679121f, 1.334199e-05f, -0.012274123f, 2.882143f, 1.7560217e-06f, \
+    0.00020543121f, -0.38154489f, -1.0403279e-05f, 0.013316059f, -3.8128662f, -2.3537365e-05f, 0.027491625f, -7.5257659f, \
+    0.0002980573f, -0.31692305f, 82.453423f, 0.00022947587f, -0.24390011f, 63.449192f, 0.00018588261f, -0.19744651f, \
+    51.356312f, 0.00015464683f, -0.16413166f, 42.680923f, 0.0001305083f, -0.13836193f, 35.967911f, 0.00011082721f, \
+    -0.11732996f, 30.486942f, 9.4104631e-05f, -0.099441297f, 25.823214f, 7.9407117e-05f, -0.083702743f, 21.718294f, \
+    6.6106943e-05f, -0.069446005f, 17.998262f, 5.3750598e-05f, -0.056187876f, 14.537315f, 4.1985382e-05f, -0.04355206f, \
+    11.237431f, 3.0513713e-05f, -0.031220499f, 8.0156851f, 1.9060568e-05f, -0.018898549f, 4.7951679f, 7.3452516e-06f, \
+    -0.0062846015f, 1.4970238f, -4.95009e-06f, 0.0069638891f, -1.9684628f, -1.8227458e-05f, 0.021280982f, -5.7151036f, \
+    0.00030425232f, -0.32450056f, 84.770439f, 0.00023674338f, -0.25248125f, 65.980721f, 0.00019337673f, -0.20618597f, \
+    53.900826f, 0.00016212213f, -0.17279546f, 45.186718f, 0.00013788062f, -0.14687638f, 38.421131f, 0.00011806566f, \
+    -0.12567234f, 32.885101f, 0.00010119752f, -0.10760627f, 28.167273f, 8.6349501e-05f, -0.09169028f, 24.009974f, \
+    7.2895513e-05f, -0.077256665f, 20.239033f, 6.0381444e-05f, -0.063820846f, 16.728046f, 4.845289e-05f, -0.051004305f, \
+    13.37826f, 3.6810063e-05f, -0.038486432f, 10.106014f, 2.5175521e-05f, -0.025970003f, 6.8337269f, 1.3266167e-05f, \
+    -0.013151072f, 3.4820082f, 7.6207255e-07f, 0.0003146845f, -0.039159063f, -1.273972e-05f, 0.014861806f, -3.8434777f, \
+    0.00031277799f, -0.33460918f, 87.766731f, 0.00024575123f, -0.26296705f, 69.028595f, 0.00020232392f, -0.21652377f, \
+    56.881481f, 0.00017087793f, -0.18287298f, 48.080067f, 0.00014641606f, -0.15667863f, 41.228653f, 0.00012638017f, \
+    -0.13520904f, 35.612801f, 0.00010929732f, -0.11689126f, 30.821159f, 9.424048e-05f, -0.10073511f, 26.594816f, \
+    8.0580598e-05f, -0.086068608f, 22.758068f, 6.7859619e-05f, -0.072402179f, 19.182943f, 5.5718665e-05f, -0.05935207f, \
+    15.76915f, 4.3853124e-05f, -0.046592265f, 12.431524f, 3.1980384e-05f, -0.033819955f, 9.0909939f, 1.9811929e-05f, \
+    -0.02072553f, 5.6667337f, 7.0225633e-06f, -0.0069593992f, 2.0674794f, -6.794256e-06f, 0.0079162559f, -1.82109f, \
+    0.00032421417f, -0.34789932f, 91.623749f, 0.00025701401f, -0.27593321f, 72.752991f, 0.00021319317f, -0.22898459f, \
+    60.444286f, 0.00018135324f, -0.19485562f, 51.497822f, 0.00015653372f, -0.16823816f, 44.521336f, 0.00013617652f, \
+    -0.14639498f, 38.79697f, 0.00011880107f, -0.12774169f, 33.909283f, 0.00010347152f, -0.11127685f, 29.595726f, \
+    8.9550456e-05f, -0.09631823f, 25.677496f, 7.6571872e-05f, -0.08236701f, 22.023909f, 6.4169195e-05f, -0.069030687f, \
+    18.532198f, 5.2029929e-05f, -0.055974502f, 15.114792f, 3.9863044e-05f, -0.042886496f, 11.690162f, 2.7370741e-05f, \
+    -0.029447163f, 8.1748924f, 1.4217725e-05f, -0.015296312f, 4.4750199f, -1.2099281e-08f, 1.3692694e-05f, 0.47383311f, \
+    0.00032245673f, -0.31086922f, 70.410706f, 0.00010411457f, -0.085607186f, 13.93731f, 2.8863917e-05f, -0.0086281933f, \
+    -5.1017499f, -1.0918235e-05f, 0.03177749f, -14.971335f, -3.6621248e-05f, 0.057805311f, -21.284365f, -5.5464934e-05f, \
+    0.076913841f, -25.914896f, -7.0633614e-05f, 0.092378713f, -29.680765f, -8.3838939e-05f, 0.10595684f, -33.019176f, \
+    -9.6119969e-05f, 0.1187166f, -36.196304f, -0.00010817522f, 0.1313822f, -39.394035f, -0.00012056249f, 0.1445412f, \
+    -42.762527f, -0.00013382785f, 0.15878016f, -46.455009f, -0.00014861336f, 0.17480057f, -50.658295f, -0.00016579255f, \
+    0.19356824f, -55.632984f, -0.00018670372f, 0.21657325f, -61.784382f, -0.00021364121f, 0.24638027f, -69.813141f, \
+    0.00038274794f, -0.38665709f, 94.155937f, 0.00020194722f, -0.19971931f, 47.163734f, 0.00012281048f, -0.11730219f, \
+    26.260105f, 7.4755342e-05f, -0.067016043f, 13.438943f, 4.1243002e-05f, -0.031831104f, 4.4409895f, 1.5758191e-05f, \
+    -0.0049914271f, -2.4397812f, -4.9009559e-06f, 0.016840799f, -8.0521049f, -2.2539909e-05f, 0.035556104f, -12.879283f, \
+    -3.8297436e-05f, 0.052353013f, -17.229429f, -5.2982734e-05f, 0.068088785f, -21.324459f, -6.7261804e-05f, 0.083474457f, \
+    -25.34997f, -8.1755374e-05f, 0.099179409f, -29.482464f, -9.7118376e-05f, 0.11591835f, -33.912521f, -0.00011415575f, \
+    0.13457866f, -38.879044f, -0.00013401637f, 0.15643556f, -44.727512f, -0.00015857887f, 0.18358232f, -52.027142f, \
+    0.00037383023f, -0.38128585f, 94.129135f, 0.00021867939f, -0.22041596f, 53.547371f, 0.00014714253f, -0.14588304f, \
+    34.640877f, 0.00010245375f, -0.09910392f, 22.713324f, 7.0379174e-05f, -0.065382898f, 14.076517f, 4.539952e-05f, \
+    -0.039014615f, 7.2964888f, 2.4795609e-05f, -0.01717905f, 1.6615341f, 7.0004912e-06f, 0.0017568847f, -3.2430072f, \
+    -8.997099e-06f, 0.018853562f, -7.6882682f, -2.3920842e-05f, 0.034875739f, -11.871435f, -3.8351678e-05f, 0.050443478f, \
+    -15.954019f, -5.283083e-05f, 0.066140674f, -20.089746f, -6.79515e-05f, 0.082613252f, -24.450277f, -8.4452477e-05f, \
+    0.10067252f, -29.252964f, -0.00010337441f, 0.12146907f, -34.808006f, -0.00012638923f, 0.14685963f, -41.617958f, \
+    0.00036207039f, -0.37159058f, 92.534294f, 0.000224969f, -0.22898258f, 56.413994f, 0.00015861096f, -0.15971251f, \
+    38.803043f, 0.00011656867f, -0.11566095f, 27.560833f, 8.6140222e-05f, -0.083654508f, 19.361168f, 6.2237152e-05f, \
+    -0.058412224f, 12.869717f, 4.2350734e-05f, -0.037327334f, 7.427022f, 2.5050054e-05f, -0.018909119f, 2.6549072f, \
+    9.4128527e-06f, -0.0021921252f, -1.6928473f, -5.2259306e-06f, 0.013524979f, -5.7965059f, -1.9404531e-05f, 0.028815383f, \
+    -9.8048782f, -3.3618864e-05f, 0.044213362f, -13.858253f, -4.8401842e-05f, 0.060299318f, -18.110628f, -6.4426851e-05f, \
+    0.07781212f, -22.759476f, -8.2659644e-05f, 0.097816959f, -28.090929f, -0.00010465544f, 0.12203589f, -34.569221f, \
+    0.00035184284f, -0.36289728f, 90.991272f, 0.00022835242f, -0.23405698f, 58.232841f, 0.00016592644f, -0.16873977f, \
+    41.579739f, 0.00012579813f, -0.12662327f, 30.810843f, 9.6586577e-05f, -0.095862567f, 22.921515f, 7.3567826e-05f, \
+    -0.071537308f, 16.662603f, 5.4362925e-05f, -0.051166739f, 11.403571f, 3.7603033e-05f, -0.033320639f, 6.7802033f, \
+    2.240832e-05f, -0.01707653f, 2.556787f, 8.1469916e-06f, -0.0017680663f, -1.4379448f, -5.6931035e-06f, 0.013149629f, \
+    -5.3452463f, -1.9586136e-05f, 0.028186472f, -9.2986822f, -3.4038174e-05f, 0.043892711f, -13.443875f, -4.9678918e-05f, \
+    0.060958866f, -17.965021f, -6.741791e-05f, 0.080386922f, -23.130594f, -8.8738125e-05f, 0.1038152f, -29.380783f, \
+    0.0003438587f, -0.35621452f, 89.848717f, 0.00023092279f, -0.23804994f, 59.696705f, 0.0001716269f, -0.17585896f, \
+    43.793766f, 0.00013295456f, -0.13519117f, 33.370998f, 0.00010462404f, -0.10531278f, 25.694708f, 8.2238839e-05f, \
+    -0.081630692f, 19.594242f, 6.3541018e-05f, -0.061783284f, 14.466998f, 4.721171e-05f, -0.044388488f, 9.9596605f, \
+    3.2394102e-05f, -0.028545562f, 5.8412733f, 1.8470651e-05f, -0.013602055f, 1.9437561f, 4.9412088e-06f, 0.00097435631f, \
+    -1.8709631f, -8.6576765e-06f, 0.015681574f, -5.73315f, -2.2821807e-05f, 0.031057579f, -9.784833f, -3.8163274e-05f, \
+    0.047772292f, -14.204241f, -5.5558077e-05f, 0.066789515f, -19.249008f, -7.6445431e-05f, 0.089696273f, -25.344318f, \
+    0.00033818357f, -0.35174325f, 89.203278f, 0.00023354776f, -0.24196833f, 61.097237f, 0.00017677648f, -0.18228391f, \
+    45.790344f, 0.0001392367f, -0.14272617f, 35.626724f, 0.00011155006f, -0.11347662f, 28.096611f, 8.9601657e-05f, \
+    -0.090224594f, 22.097446f, 7.1243368e-05f, -0.070717454f, 17.0525f, 5.5205059e-05f, -0.05362089f, 12.619584f, \
+    4.065242e-05f, -0.038055845f, 8.5726442f, 2.6977774e-05f, -0.023379097f, 4.7455716f, 1.3685339e-05f, -0.0090624215f, \
+    1.0011632f, 3.1431682e-07f, 0.005389086f, -2.7900419f, -1.3629328e-05f, 0.020510605f, -6.7690821f, -2.8755645e-05f, \
+    0.036968164f, -11.112655f, -4.5929995e-05f, 0.055711936f, -16.074055f, -6.6572364e-05f, 0.078304887f, -22.070881f, \
+    0.00033478229f, -0.34952694f, 89.093491f, 0.00023669898f, -0.24636246f, 62.594807f, 0.00018195246f, -0.18867326f, \
+    47.756832f, 0.00014528699f, -0.14995691f, 37.783978f, 0.00011806225f, -0.1211435f, 30.349791f, 9.6399534e-05f, \
+    -0.098159239f, 24.408842f, 7.8244884e-05f, -0.078844979f, 19.406599f, 6.2371641e-05f, -0.061909199f, 15.010908f, \
+    4.7967558e-05f, -0.046494465f, 11.000741f, 3.4436169e-05f, -0.031968486f, 7.2125144f, 2.1286027e-05f, -0.017807245f, \
+    3.509969f, 8.0560476e-06f, -0.0035155944f, -0.23642479f, -5.7512107e-06f, 0.01144461f, -4.1682978f, -2.0752257e-05f, \
+    0.027744822f, -8.4633284f, -3.7819274e-05f, 0.046340197f, -13.375375f, -5.8375979e-05f, 0.068794578f, -19.321085f, \
+    0.00033365461f, -0.3496213f, 89.552788f, 0.00024070824f, -0.25161898f, 64.301918f, 0.0001875477f, -0.19547428f, \
+    49.820232f, 0.00015153042f, -0.15736434f, 39.978386f, 0.00012461349f, -0.12882462f, 32.598026f, 0.00010311221f, \
+    -0.10597551f, 26.680346f, 8.5049971e-05f, -0.086734235f, 21.688824f, 6.9235735e-05f, -0.069844104f, 17.299376f, \
+    5.4875683e-05f, -0.054465625f, 13.295115f, 4.1383675e-05f, -0.039976709f, 9.5148525f, 2.8273733e-05f, -0.025858916f, \
+    5.8237004f, 1.5085689e-05f, -0.011618273f, 2.0924883f, 1.3177109e-06f, 0.0032873848f, -1.8212739f, -1.3657537e-05f, \
+    0.019539725f, -6.0975285f, -3.0730556e-05f, 0.038111188f, -10.993927f, -5.1349249e-05f, 0.060588386f, -16.931921f, \
+    0.00033488273f, -0.35215706f, 90.629944f, 0.00024587492f, -0.25808346f, 66.318153f, 0.0001938943f, -0.2030635f, \
+    52.086937f, 0.00015831247f, -0.16533805f, 42.319431f, 0.00013156125f, -0.13692228f, 34.954086f, 0.00011011036f, \
+    -0.11409014f, 29.02866f, 9.2043745e-05f, -0.094817989f, 24.020296f, 7.6197175e-05f, -0.07787481f, 19.610678f, \
+    6.1789833e-05f, -0.062433422f, 15.585618f, 4.8242437e-05f, -0.047878273f, 11.785381f, 3.5072761e-05f, -0.033694733f, \
+    8.0760107f, 2.1821877e-05f, -0.019390458f, 4.3288584f, 7.984926e-06f, -0.0044208653f, 0.40105999f, -7.0766305e-06f, \
+    0.011906249f, -3.8896339f, -2.4277813e-05f, 0.030587187f, -8.8063574f, -4.5107452e-05f, 0.053249083f, -14.779961f, \
+    0.00033866524f, -0.35738277f, 92.402626f, 0.00025252937f, -0.2661323f, 68.750496f, 0.00020133276f, -0.21182466f, \
+    54.664711f, 0.0001659734f, -0.17426024f, 44.914032f, 0.00013924683f, -0.14581932f, 37.524948f, 0.00011773907f, \
+    -0.12289001f, 31.561811f, 9.9577555e-05f, -0.10349005f, 26.510954f, 8.3615472e-05f, -0.086404309f, 22.057312f, \
+    6.9078837e-05f, -0.070811361f, 17.987692f, 5.539037e-05f, -0.056097005f, 14.142452f, 4.2067488e-05f, -0.041746024f, \
+    10.387399f, 2.8649423e-05f, -0.027264401f, 6.5935411f, 1.4627318e-05f, -0.012104166f, 2.6174154f, -6.4758984e-07f, \
+    0.0044361884f, -1.7251276f, -1.811607e-05f, 0.023377907f, -6.7028828f, -3.9319413e-05f, 0.046400644f, -12.759108f, \
+    0.0003453625f, -0.3657186f, 94.993263f, 0.00026108976f, -0.27623695f, 71.731415f, 0.00021026895f, -0.22221264f, \
+    57.680534f, 0.00017490592f, -0.18457031f, 47.884636f, 0.00014805475f, -0.15594579f, 40.430382f, 0.00012637912f, \
+    -0.13280097f, 34.398407f, 0.00010803196f, -0.1131761f, 29.279387f, 9.1873779e-05f, -0.095861301f, 24.758738f, \
+    7.7130557e-05f, -0.080033571f, 20.622358f, 6.3221443e-05f, -0.065074116f, 16.709114f, 4.9658116e-05f, -0.050461289f, \
+    12.883016f, 3.5972284e-05f, -0.035693232f, 9.0130739f, 2.1645554e-05f, -0.020212594f, 4.9536285f, 6.015679e-06f, \
+    -0.0033051346f, 0.51775622f, -1.1883998e-05f, 0.016075158f, -4.5688133f, -3.3652297e-05f, 0.039665271f, -10.762753f, \
+    0.00035557555f, -0.37784523f, 98.594086f, 0.00027213711f, -0.28904751f, 75.441978f, 0.00022124317f, -0.23483063f, \
+    61.302029f, 0.00018562165f, -0.19683921f, 51.38987f, 0.0001584783f, -0.16785225f, 43.823391f, 0.00013651281f, \
+    -0.14436148f, 37.688171f, 0.00011788346f, -0.12440842f, 32.473667f, 0.00010144659f, -0.10677611f, 27.862585f, \
+    8.6420347e-05f, -0.090631701f, 23.637705f, 7.2213988e-05f, -0.075344965f, 19.63459f, 5.8327209e-05f, -0.060381074f, \
+    15.713652f, 4.4277e-05f, -0.045222532f, 11.739796f, 2.9526391e-05f, -0.029292753f, 7.5625072f, 1.3389094e-05f, \
+    -0.011853279f, 2.9890134f, -5.1354532e-06f, 0.0081751812f, -2.2626302f, -2.7706894e-05f, 0.032589741f, -8.6629295f, \
+    0.0003702929f, -0.39486754f, 103.51242f, 0.00028653807f, -0.30552906f, 80.149612f, 0.0002350396f, -0.2505517f, \
+    65.771111f, 0.00019885364f, -0.21188344f, 55.656116f, 0.00017121872f, -0.18232025f, 47.920872f, 0.00014882185f, \
+    -0.15833192f, 41.642288f, 0.00012980253f, -0.13793534f, 36.30183f, 0.00011299885f, -0.11989148f, 31.5755f, \
+    9.7611693e-05f, -0.10334746f, 27.240274f, 8.303285e-05f, -0.087653473f, 23.126238f, 6.8742745e-05f, -0.072253637f, \
+    19.088083f, 5.4235188e-05f, -0.056605607f, 14.984138f, 3.8943221e-05f, -0.040101148f, 10.655684f, 2.213987e-05f, \
+    -0.021959431f, 5.8991895f, 2.7682011e-06f, -0.0010434077f, 0.41845506f, -2.0911593e-05f, 0.024524707f, -6.2761436f, \
+    0.00039118473f, -0.41863999f, 110.26023f, 0.00030567739f, -0.32721943f, 86.279076f, 0.00025288967f, -0.27074468f, \
+    71.466385f, 0.00021574523f, -0.23097512f, 61.035725f, 0.00018736701f, -0.20056489f, 53.059765f, 0.00016436666f, \
+    -0.17589432f, 46.588909f, 0.00014483304f, -0.15492153f, 41.087536f, 0.00012756756f, -0.13636546f, 36.219639f, \
+    0.00011174141f, -0.11933984f, 31.752821f, 9.6719188e-05f, -0.10316477f, 27.508877f, 8.1952916e-05f, -0.087253422f, \
+    23.334133f, 6.6902772e-05f, -0.071027324f, 19.077305f, 5.0957809e-05f, -0.053831376f, 14.567367f, 3.3328786e-05f, \
+    -0.034818914f, 9.5836887f, 1.286615e-05f, -0.012755505f, 3.8051035f, -1.2306341e-05f, 0.014378723f, -3.293673f, \
+    0.00042124555f, -0.45247659f, 119.74887f, 0.00033195177f, -0.35677603f, 94.56308f, 0.00027690167f, -0.29775092f, \
+    79.034798f, 0.00023824889f, -0.25628552f, 68.129677f, 0.00020878922f, -0.22466359f, 59.815937f, 0.00018496795f, \
+    -0.1990778f, 53.091232f, 0.00016477723f, -0.17737751f, 47.389484f, 0.00014695495f, -0.15821061f, 42.354916f, \
+    0.00013062486f, -0.14063826f, 37.740612f, 0.00011511078f, -0.12393575f, 33.356144f, 9.9823672e-05f, -0.10747172f, \
+    29.03583f, 8.4176078e-05f, -0.090616442f, 24.614719f, 6.7494359e-05f, -0.072647847f, 19.904095f, 4.8898364e-05f, \
+    -0.052622378f, 14.657882f, 2.7095775e-05f, -0.029153727f, 8.5152216f, -2.4972094e-08f, 2.8260767e-05f, 0.88586324f, \
+    0.00044524125f, -0.43695009f, 102.26714f, 0.00014938271f, -0.1328872f, 26.245323f, 5.7403995e-05f, -0.038591087f, \
+    2.789237f, 1.0472085e-05f, 0.009289626f, -9.0124426f, -1.930279e-05f, 0.039624602f, -16.453259f, -4.0905896e-05f, \
+    0.061694082f, -21.86973f, -5.8184061e-05f, 0.079462089f, -26.255985f, -7.313423e-05f, 0.094987042f, -30.127716f, \
+    -8.7002372e-05f, 0.1095605f, -33.810287f, -0.00010070833f, 0.12414873f, -37.550591f, -0.00011505972f, 0.13961814f, \
+    -41.574883f, -0.0001309357f, 0.15693355f, -46.14101f, -0.000149517f, 0.1774134f, -51.607475f, -0.0001726951f, \
+    0.20319134f, -58.560383f, -0.0002040344f, 0.23830941f, -68.116013f, -0.00025168716f, 0.29203701f, -82.841293f, \
+    0.0004657658f, -0.47060364f, 115.01011f, 0.00023603183f, -0.23419812f, 55.826973f, 0.00014651718f, -0.14139849f, \
+    32.388042f, 9.3960341e-05f, -0.086592965f, 18.456413f, 5.7815585e-05f, -0.048729047f, 8.7895489f, 3.0524345e-05f, \
+    -0.020015506f, 1.4317304f, 8.453977e-06f, 0.0033164006f, -4.5709109f, -1.0431584e-05f, 0.023392132f, -9.7602196f, \
+    -2.7427772e-05f, 0.041574687f, -14.48656f, -4.3473712e-05f, 0.058863584f, -19.009779f, -5.9366554e-05f, 0.076120488f, \
+    -23.557184f, -7.5932374e-05f, 0.094252989f, -28.371828f, -9.4214025e-05f, 0.1144225f, -33.76857f, -0.00011577502f, \
+    0.13838789f, -40.228474f, -0.00014340083f, 0.1693024f, -48.61871f, -0.00018315154f, 0.21405011f, -60.838245f, \
+    0.00044134789f, -0.44967231f, 111.19337f, 0.0002492065f, -0.25115663f, 61.242264f, 0.00016859727f, -0.16746627f, \
+    40.072166f, 0.00012014421f, -0.11690881f, 27.216459f, 8.6046144e-05f, -0.081149563f, 18.077858f, 5.9753525e-05f, \
+    -0.053435586f, 10.961305f, 3.8159844e-05f, -0.030555138f, 5.0581436f, 1.9509369e-05f, -0.010683047f, -0.09403722f, \
+    2.6635576e-06f, 0.0073743365f, -4.8004217f, -1.3218919e-05f, 0.024509672f, -9.292016f, -2.8859457e-05f, 0.041500442f, \
+    -13.773046f, -4.4993078e-05f, 0.059152771f, -18.458641f, -6.2523904e-05f, 0.07847365f, -23.621185f, -8.2798178e-05f, \
+    0.10097767f, -29.673946f, -0.00010820763f, 0.12937076f, -37.358864f, -0.000143896f, 0.16949201f, -48.281601f, \
+    0.00041997494f, -0.43038642f, 107.27975f, 0.00025367021f, -0.25791267f, 63.673313f, 0.00017916952f, -0.18035986f, \
+    43.993626f, 0.00013360199f, -0.1327333f, 31.861479f, 0.00010131364f, -0.098836675f, 23.191408f, 7.6285338e-05f, \
+    -0.072435729f, 16.409155f, 5.5618228e-05f, -0.050522614f, 10.753886f, 3.768404e-05f, -0.031402007f, 5.7953305f, \
+    2.1437649e-05f, -0.013978449f, 1.253648f, 6.1084797e-06f, 0.0025647706f, -3.0820582f, -8.9670148e-06f, 0.018941727f, \
+    -7.3988409f, -2.4469598e-05f, 0.035897546f, -11.894894f, -4.1238291e-05f, 0.054364562f, -16.821484f, -6.0508337e-05f, \
+    0.075730629f, -22.556129f, -8.4454863e-05f, 0.10245523f, -29.771427f, -0.00011775312f, 0.13984187f, -39.921745f, \
+    0.00040354309f, -0.41554886f, 104.26492f, 0.00025604462f, -0.26204938f, 65.287071f, 0.00018620647f, -0.18914486f, \
+    46.723217f, 0.00014271411f, -0.14358608f, 35.0877f, 0.00011168606f, -0.11095788f, 26.726995f, 8.7577617e-05f, \
+    -0.085496366f, 20.178728f, 6.7654139e-05f, -0.06435369f, 14.719104f, 5.0356146e-05f, -0.045900494f, 9.9327564f, \
+    3.4678313e-05f, -0.029080248f, 5.5489063f, 1.9883848e-05f, -0.013111053f, 1.365397f, 5.3427489e-06f, 0.0026851129f, \
+    -2.7952769f, -9.5902369e-06f, 0.019013949f, -7.1204782f, -2.5713363e-05f, 0.036761086f, -11.848225f, -4.4208286e-05f, \
+    0.057251103f, -17.337572f, -6.7154535e-05f, 0.082830332f, -24.227942f, -9.9020661e-05f, 0.11855904f, -33.902485f, \
+    0.00039161535f, -0.40501714f, 102.21848f, 0.00025821666f, -0.26574764f, 66.712898f, 0.00019205203f, -0.19648564f, \
+    49.016262f, 0.00015012834f, -0.15246539f, 37.741539f, 0.00011998921f, -0.12070904f, 29.585567f, 9.6497446e-05f, \
+    -0.095859356f, 23.183578f, 7.7069533e-05f, -0.075217605f, 17.847006f, 6.0211263e-05f, -0.057218026f, 13.175223f, \
+    4.4948079e-05f, -0.040833682f, 8.9041576f, 3.0560048e-05f, -0.025298983f, 4.8353834f, 1.6431281e-05f, -0.0099504888f, \
+    0.79506022f, 1.933274e-06f, 0.0058989632f, -3.3990941f, -1.3711194e-05f, 0.02311052f, -7.9780102f, -3.165903e-05f, \
+    0.042978078f, -13.291303f, -5.3964326e-05f, 0.067812167f, -19.966167f, -8.5074171e-05f, 0.10263281f, -29.369158f, \
+    0.00038367361f, -0.39841345f, 101.09892f, 0.00026099937f, -0.26995724f, 68.227913f, 0.00019773457f, -0.20355219f, \
+    51.204777f, 0.00015700438f, -0.16068238f, 40.192593f, 0.00012749132f, -0.12952051f, 32.169205f, 0.00010439557f, \
+    -0.10504637f, 25.850901f, 8.5262676e-05f, -0.084688835f, 20.579344f, 6.865718e-05f, -0.066939861f, 15.967436f, \
+    5.3634867e-05f, -0.050802264f, 11.758086f, 3.9492377e-05f, -0.035526838f, 7.7567401f, 2.5622521e-05f, -0.020458966f, \
+    3.7917266f, 1.1401739e-05f, -0.0049171378f, -0.31763294f, -3.9434954e-06f, 0.011954339f, -4.8003287f, -2.15706e-05f, \
+    0.031446498f, -10.004068f, -4.3557153e-05f, 0.055887733f, -16.558258f, -7.446824e-05f, 0.090408951f, -25.85298f, \
+    0.00037939343f, -0.39550057f, 100.87987f, 0.00026488124f, -0.27525049f, 69.999641f, 0.00020386116f, -0.21103458f, \
+    53.484444f, 0.00016400985f, -0.16899042f, 42.652771f, 0.00013491242f, -0.13820234f, 34.705044f, 0.00011204186f, \
+    -0.11392214f, 28.422739f, 9.3048155e-05f, -0.093681507f, 23.171701f, 7.6543081e-05f, -0.076018453f, 18.575533f, \
+    6.1607192e-05f, -0.05996003f, 14.382775f, 4.7551835e-05f, -0.044771697f, 10.402411f, 3.3778502e-05f, -0.029807949f, \
+    6.465116f, 1.9665933e-05f, -0.014390297f, 2.3911991f, 4.4340541e-06f, 0.002342415f, -2.0492506f, -1.3096776e-05f, \
+    0.021701712f, -7.2082071f, -3.5071236e-05f, 0.046080809f, -13.72967f, -6.629189e-05f, 0.080849491f, -23.060762f, \
+    0.00037867329f, -0.39624617f, 101.57798f, 0.00027026937f, -0.28209981f, 72.165016f, 0.00021090354f, -0.21946682f, \
+    56.006008f, 0.0001716422f, -0.17794889f, 45.278877f, 0.00014277255f, -0.14733773f, 37.356071f, 0.00011998096f, \
+    -0.12309658f, 31.069271f, 0.0001009973f, -0.10283482f, 25.802258f, 8.4467603e-05f, -0.085123152f, 21.185944f, \
+    6.9488568e-05f, -0.069003828f, 16.972214f, 5.5379827e-05f, -0.053750306f, 12.971864f, 4.1547119e-05f, -0.038721606f, \
+    9.0167627f, 2.7369149e-05f, -0.023240043f, 4.9277229f, 1.2055449e-05f, -0.0064352695f, 0.47306511f, -5.6102663e-06f, \
+    0.013039734f, -4.707252f, -2.7879134e-05f, 0.037684545f, -11.282534f, -5.9904618e-05f, 0.073227875f, -20.787907f, \
+    0.00038165168f, -0.40085736f, 103.26752f, 0.00027760811f, -0.29101241f, 74.868538f, 0.00021933102f, -0.22937654f, \
+    58.917351f, 0.00018037364f, -0.18808644f, 48.21838f, 0.00015154832f, -0.15745924f, 40.270557f, 0.00012869791f, \
+    -0.13311113f, 33.941097f, 0.0001096077f, -0.1127039f, 28.625307f, 9.294429e-05f, -0.094826609f, 23.957762f, \
+    7.7810852e-05f, -0.078526571f, 19.691046f, 6.3526699e-05f, -0.063076064f, 15.635372f, 4.9493075e-05f, -0.047829326f, \
+    11.621346f, 3.5079946e-05f, -0.03210029f, 7.467896f, 1.9479259e-05f, -0.015002116f, 2.9397788f, 1.4287124e-06f, \
+    0.0048569338f, -2.3332677f, -2.1460719e-05f, 0.030115062f, -9.0538645f, -5.480395e-05f, 0.066975594f, -18.874502f, \
+    0.00038876032f, -0.40984839f, 106.1017f, 0.00028747582f, -0.30263916f, 78.292847f, 0.0002297084f, -0.24139468f, \
+    62.39407f, 0.00019075151f, -0.2000131f, 51.640671f, 0.0001617769f, -0.16916513f, 43.614494f, 0.00013872677f, \
+    -0.14456041f, 37.203125f, 0.00011941579f, -0.12388587f, 31.806438f, 0.00010251649f, -0.10573361f, 27.058681f, \
+    8.7128043e-05f, -0.089144871f, 22.710239f, 7.2559946e-05f, -0.073380589f, 18.568043f, 5.8198057e-05f, -0.057778556f, \
+    14.458347f, 4.3389671e-05f, -0.041629408f, 10.194238f, 2.7291762e-05f, -0.02401134f, 5.5320711f, 8.5781003e-06f, \
+    -0.0034695056f, 0.086765848f, -1.5304564e-05f, 0.022799088f, -6.8837891f, -5.0535866e-05f, 0.061578847f, -17.17581f, \
+    0.00040084968f, -0.42418343f, 110.35326f, 0.00030071274f, -0.31791687f, 82.698082f, 0.0002428139f, -0.25638649f, \
+    66.675735f, 0.00020351169f, -0.21454656f, 55.772026f, 0.00017416874f, -0.18324479f, 47.606342f, 0.00015076422f, \
+    -0.15821858f, 41.069679f, 0.00013111283f, -0.13714905f, 35.558411f, 0.00011387614f, -0.11861344f, 30.701792f, \
+    9.8137534e-05f, -0.10163426f, 26.244661f, 8.3185951e-05f, -0.085449666f, 21.987642f, 6.837977e-05f, -0.069367968f, \
+    17.749159f, 5.3026677e-05f, -0.052638285f, 13.331594f, 3.6222395e-05f, -0.034275673f, 8.475421f, 1.6537782e-05f, \
+    -0.012720756f, 2.7698884f, -8.7903072e-06f, 0.015041122f, -4.5782547f, -4.6601097e-05f, 0.056471255f, -15.531792f, \
+    0.00041945983f, -0.44557756f, 116.49774f, 0.00031864448f, -0.33831549f, 88.489929f, 0.00025983609f, -0.27566954f, \
+    72.125969f, 0.00021976291f, -0.23291638f, 60.952f, 0.00018978637f, -0.20087706f, 52.571884f, 0.00016584736f, \
+    -0.1752369f, 45.859119f, 0.00014572428f, -0.15363237f, 40.196373f, 0.00012804673f, -0.13460334f, 35.201946f, \
+    0.00011186754f, -0.11713788f, 30.610979f, 9.6442513e-05f, -0.10043772f, 26.21414f, 8.1088285e-05f, -0.083766408f, \
+    21.817938f, 6.5053202e-05f, -0.066310287f, 17.208372f, 4.7338879e-05f, -0.046985902f, 12.100588f, 2.63524e-05f, \
+    -0.024063993f, 6.0407939f, -9.829389e-07f, 0.0057919244f, -1.8441962f, -4.2298572e-05f, 0.050855488f, -13.716608f, \
+    0.00044742643f, -0.47716436f, 125.39629f, 0.00034354333f, -0.36634713f, 96.35939f, 0.00028277314f, -0.30145526f, \
+    79.353981f, 0.00024135756f, -0.25717455f, 67.74662f, 0.0002104032f, -0.22402814f, 59.054092f, 0.00018571038f, \
+    -0.19753942f, 52.103283f, 0.00016497073f, -0.17524609f, 46.248779f, 0.00014675282f, -0.15561931f, 41.089611f, \
+    0.00013005918f, -0.13759141f, 36.345501f, 0.00011409557f, -0.12030956f, 31.792336f, 9.8118879e-05f, -0.10297311f, \
+    27.219501f, 8.129327e-05f, -0.084678911f, 22.389463f, 6.2484818e-05f, -0.064200401f, 16.980108f, 3.9854862e-05f, \
+    -0.039550148f, 10.471007f, 9.828942e-06f, -0.0068715126f, 1.8562638f, -3.6348025e-05f, 0.04327378f, -11.31711f, \
+    0.00049037888f, -0.52514303f, 138.74557f, 0.00037972859f, -0.40677959f, 107.61561f, 0.00031537958f, -0.33789521f, \
+    89.502365f, 0.00027177291f, -0.2911711f, 77.217361f, 0.00023936246f, -0.25640345f, 68.075943f, 0.00021364627f, \
+    -0.22877914f, 60.811813f, 0.00019215017f, -0.20565163f, 54.728611f, 0.00017333683f, -0.18537495f, 49.39312f, \
+    0.00015612853f, -0.16679333f, 44.501011f, 0.00013965662f, -0.14897324f, 39.806377f, 0.00012309242f, -0.1310221f, \
+    35.074093f, 0.00010548091f, -0.11190969f, 30.033056f, 8.5493994e-05f, -0.090203531f, 24.307098f, 6.093023e-05f, \
+    -0.063532107f, 17.275503f, 2.7433576e-05f, -0.027212335f, 7.7176652f, -2.5676853e-05f, 0.030227169f, -7.3419638f, \
+    0.00056117243f, -0.60364717f, 160.40656f, 0.00043673054f, -0.47012463f, 125.14243f, 0.00036588166f, -0.39408165f, \
+    105.07249f, 0.000318659f, -0.34337401f, 91.698441f, 0.0002840946f, -0.30623749f, 81.910782f, 0.00025707949f, \
+    -0.27719194f, 74.261292f, 0.00023482957f, -0.25325042f, 67.960732f, 0.00021562411f, -0.23256597f, 62.521214f, \
+    0.00019825748f, -0.21384364f, 57.600739f, 0.00018175073f, -0.19603099f, 52.921528f, 0.00016515276f, -0.17810477f, \
+    48.213799f, 0.00014733661f, -0.1588524f, 43.15839f, 0.00012668496f, -0.13653487f, 37.298592f, 0.00010043207f, \
+    -0.10818241f, 29.85659f, 6.293827e-05f, -0.067747407f, 19.253592f, -6.9594805e-08f, 7.8760175e-05f, 1.5073233f, \
+    0.00055924506f, -0.5526709f, 131.02896f, 0.00018465608f, -0.16941085f, 35.638809f, 7.9001256e-05f, -0.061049495f, \
+    8.6250315f, 2.6654185e-05f, -0.0075446558f, -4.6181383f, -6.0199945e-06f, 0.025837751f, -12.85037f, -2.9469591e-05f, \
+    0.049880493f, -18.787399f, -4.8088426e-05f, 0.069113441f, -23.567469f, -6.412626e-05f, 0.085860781f, -27.775049f, \
+    -7.895827e-05f, 0.10155589f, -31.773565f, -9.3616822e-05f, 0.11729474f, -35.846077f, -0.00010906658f, 0.1341285f, \
+    -40.271175f, -0.00012643688f, 0.15332125f, -45.392479f, -0.00014737803f, 0.17675769f, -51.731743f, -0.00017484163f, \
+    0.2078505f, -60.244019f, -0.00021535832f, 0.25421003f, -73.073349f, -0.00028859239f, 0.33892453f, -96.762527f, \
+    0.0005417511f, -0.54738963f, 134.03169f, 0.0002626919f, -0.26107723f, 62.534618f, 0.00016448392f, -0.15956581f, \
+    36.964798f, 0.00010854552f, -0.10137223f, 22.20381f, 7.0598355e-05f, -0.061679814f, 12.083112f, 4.2200314e-05f, \
+    -0.031817734f, 4.4339828f, 1.9388637e-05f, -0.0076874192f, -1.77768f, -3.5781991e-08f, 0.013003176f, -7.135231f, \
+    -1.7468414e-05f, 0.031724002f, -12.016832f, -3.3929729e-05f, 0.049567662f, -16.707916f, -5.030508e-05f, 0.067504175f, \
+    -21.467125f, -6.7536566e-05f, 0.086593583f, -26.58349f, -8.687473e-05f, 0.10827703f, -32.4575f, -0.00011036175f, \
+    0.13495329f, -39.765465f, -0.000142062f, 0.17148644f, -49.897015f, -0.00019201647f, 0.23031116f, -66.484764f, \
+    0.00050021586f, -0.5093199f, 126.05244f, 0.00027313965f, -0.27524143f, 67.247772f, 0.00018501043f, -0.18394363f, \
+    44.192909f, 0.00013365314f, -0.1304605f, 30.616085f, 9.8156488e-05f, -0.093288206f, 21.129232f, 7.1109309e-05f, \
+    -0.064796269f, 13.818175f, 4.9091028e-05f, -0.041453041f, 7.7944436f, 3.0213168e-05f, -0.0212967f, 2.5613444f, \
+    1.326977e-05f, -0.0030604352f, -2.2054472f, -2.6231498e-06f, 0.014200968f, -6.751977f, -1.8223654e-05f, 0.031318959f, \
+    -11.299541f, -3.4313616e-05f, 0.049178187f, -16.089615f, -5.1874016e-05f, 0.068925172f, -21.442894f, -7.2380652e-05f, \
+    0.092343472f, -27.869955f, -9.8389617e-05f, 0.12267435f, -36.327061f, -0.00013364325f, 0.16570003f, -48.700592f, \
+    0.00046875761f, -0.47995374f, 119.69385f, 0.00027605498f, -0.28048071f, 69.319717f, 0.00019494056f, -0.19618985f, \
+    47.954918f, 0.00014667878f, -0.14582095f, 35.137875f, 0.00011309327f, -0.1105972f, 26.135729f, 8.7418615e-05f, \
+    -0.083520517f, 19.182251f, 6.6461362e-05f, -0.061279714f, 13.439888f, 4.8458427e-05f, -0.042037975f, 8.4420109f, \
+    3.2301519e-05f, -0.024629572f, 3.8899324f, 1.7193561e-05f, -0.0082013663f, -0.43831453f, 2.4657099e-06f, 0.0079823984f, \
+    -4.7385955f, -1.2550556e-05f, 0.024684198f, -9.2196903f, -2.8654806e-05f, 0.042855415f, -14.150091f, -4.6956586e-05f, \
+    0.063888714f, -19.936504f, -6.9024005e-05f, 0.089986466f, -27.262917f, -9.4249604e-05f, 0.12246859f, -36.873856f, \
+    0.00044603774f, -0.45885718f, 115.16824f, 0.00027751582f, -0.28376397f, 70.745102f, 0.00020175488f, -0.2047895f, \
+    50.651455f, 0.00015572854f, -0.15662943f, 38.359344f, 0.00012344521f, -0.12270099f, 29.668442f, 9.8708617e-05f, \
+    -0.096570857f, 22.947262f, 7.8523364e-05f, -0.075121559f, 17.403519f, 6.1209903e-05f, -0.056596845f, 12.589002f, \
+    4.5705699e-05f, -0.039875332f, 8.2152605f, 3.1253101e-05f, -0.024143759f, 4.0701494f, 1.7230899e-05f, -0.0087164128f, \
+    -0.029205848f, 3.0379124e-06f, 0.0070973798f, -4.2725415f, -1.2014501e-05f, 0.024130695f, -8.8968582f, -2.8813198e-05f, \
+    0.0435411f, -14.246775f, -4.8335318e-05f, 0.066919327f, -20.84767f, -6.7347231e-05f, 0.092954114f, -28.783611f, \
+    0.00043017717f, -0.44444978f, 112.19864f, 0.00027927206f, -0.28712547f, 72.114601f, 0.00020768956f, -0.21228062f, \
+    53.001129f, 0.00016334746f, -0.16575931f, 41.089439f, 0.00013197363f, -0.13271092f, 32.601357f, 0.00010784605f, \
+    -0.10717458f, 26.018829f, 8.8143883e-05f, -0.086205088f, 20.590317f, 7.1265582e-05f, -0.068122499f, 15.885473f, \
+    5.6189234e-05f, -0.051845092f, 11.625096f, 4.2182521e-05f, -0.03658453f, 7.602953f, 2.8646993e-05f, -0.021678263f, \
+    3.6419632f, 1.5013229e-05f, -0.0064690858f, -0.43880799f, 6.4751129e-07f, 0.0098176915f, -4.8607473f, -1.5227355e-05f, \
+    0.028224509f, -9.937892f, -3.3306456e-05f, 0.050055582f, -16.12167f, -4.9043741e-05f, 0.072736353f, -23.18824f, \
+    0.0004199555f, -0.43565685f, 110.57671f, 0.00028210122f, -0.29148084f, 73.697624f, 0.00021376376f, -0.21982129f, \
+    55.332283f, 0.0001706836f, -0.17450495f, 43.692032f, 0.00013993612f, -0.14204019f, 35.330399f, 0.0001161831f, \
+    -0.1168486f, 28.821108f, 9.6747062e-05f, -0.096126199f, 23.445974f, 8.0091471e-05f, -0.078256696f, 18.789537f, \
+    6.5229608e-05f, -0.062192902f, 14.580734f, 5.1451621e-05f, -0.047168918f, 10.618761f, 3.8175123e-05f, -0.032538641f, \
+    6.7306967f, 2.4843594e-05f, -0.017658543f, 2.7392769f, 1.0837481e-05f, -0.0017693581f, -1.5724673f, -4.5999159e-06f, \
+    0.01614958f, -6.5121665f, -2.2130123e-05f, 0.037373975f, -12.523503f, -3.6974176e-05f, 0.059176575f, -19.357124f, \
+    0.00041470723f, -0.43190774f, 110.19791f, 0.00028651353f, -0.29743043f, 75.670616f, 0.00022062223f, -0.22814278f, \
+    57.851841f, 0.0001784393f, -0.18365623f, 46.388618f, 0.00014808422f, -0.15153107f, 38.090855f, 0.00012452123f, \
+    -0.12648928f, 31.603956f, 0.00010518455f, -0.10583608f, 26.235222f, 8.8586356e-05f, -0.088002145f, 21.579933f, \
+    7.3764444e-05f, -0.071963899f, 17.372406f, 6.0023383e-05f, -0.056969631f, 13.415211f, 4.6790115e-05f, -0.042382982f, \
+    9.5379543f, 3.3511566e-05f, -0.027564652f, 5.5647597f, 1.9557458e-05f, -0.011745368f, 1.2766726f, 4.122594e-06f, \
+    0.0061449748f, -3.6456516f, -1.3632492e-05f, 0.027570952f, -9.6932583f, -2.9684012e-05f, 0.050661508f, -16.845238f, \
+    0.00041421034f, -0.43306157f, 111.05672f, 0.00029299271f, -0.30553344f, 78.195114f, 0.00022881775f, -0.23786822f, \
+    60.734974f, 0.00018718763f, -0.19385485f, 49.358334f, 0.00015700901f, -0.16184357f, 41.066402f, 0.00013347348f, \
+    -0.13678004f, 34.557236f, 0.0001140961f, -0.11604702f, 29.155691f, 9.742078e-05f, -0.098104671f, 24.46335f, \
+    8.2497514e-05f, -0.0819401f, 20.2166f, 6.8633744e-05f, -0.066803679f, 16.218233f, 5.5253222e-05f, -0.052055649f, \
+    12.296991f, 4.1791824e-05f, -0.03704609f, 8.2746258f, 2.7587863e-05f, -0.020974886f, 3.9250798f, 1.1735249e-05f, \
+    -0.0026695938f, -1.0958021f, -6.9704242e-06f, 0.019713534f, -7.374011f, -2.6259764e-05f, 0.04617545f, -15.370908f, \
+    0.00041866474f, -0.43940696f, 113.25411f, 0.00030213315f, -0.31646365f, 81.461739f, 0.00023896045f, -0.24967995f, \
+    64.171944f, 0.00019753161f, -0.20577267f, 52.78772f, 0.00016731113f, -0.17364576f, 44.442219f, 0.0001436451f, \
+    -0.14839339f, 37.867168f, 0.00012409789f, -0.12744322f, 32.396683f, 0.00010722756f, -0.10926644f, 27.633926f, \
+    9.2083392e-05f, -0.092847303f, 23.313826f, 7.7963166e-05f, -0.077424951f, 19.235909f, 6.4271902e-05f, -0.062339764f, \
+    15.223732f, 5.0412717e-05f, -0.046908334f, 11.090716f, 3.5660807e-05f, -0.030266937f, 6.5953546f, 1.8955116e-05f, \
+    -0.011086306f, 1.3552543f, -1.4463271e-06f, 0.013030172f, -5.3532324f, -2.6121459e-05f, 0.045063686f, -14.748984f, \
+    0.00042877684f, -0.45176741f, 117.03009f, 0.00031478403f, -0.33117008f, 85.734848f, 0.00025185637f, -0.2644738f, \
+    68.410774f, 0.00021024147f, -0.2202643f, 56.913017f, 0.00017974024f, -0.18776889f, 48.447952f, 0.00015577706f, \
+    -0.16215068f, 41.760601f, 0.00013593123f, -0.14084615f, 36.18504f, 0.00011875552f, -0.12231706f, 31.320688f, \
+    0.00010328455f, -0.10552996f, 26.89712f, 8.8793044e-05f, -0.089698464f, 22.706833f, 7.4650554e-05f, -0.074125297f, \
+    18.563478f, 6.0201572e-05f, -0.058066044f, 14.26491f, 4.461304e-05f, -0.040545877f, 9.5417957f, 2.6586866e-05f, \
+    -0.019993965f, 3.9519742f, 3.6500189e-06f, 0.0067338804f, -3.4136276f, -2.8885748e-05f, 0.046877258f, -14.84698f, \
+    0.00044601221f, -0.47178495f, 122.84335f, 0.00033228096f, -0.35113338f, 91.423164f, 0.00026871407f, -0.2835874f, \
+    73.820183f, 0.00022644972f, -0.23858295f, 62.079655f, 0.00019538605f, -0.20541896f, 53.416103f, 0.00017093778f, \
+    -0.17923449f, 46.563663f, 0.00015065786f, -0.15743113f, 40.844952f, 0.00013307038f, -0.13843627f, 35.849083f, \
+    0.00011717877f, -0.12118113f, 31.295614f, 0.00010221964f, -0.10483769f, 26.965723f, 8.7508626e-05f, -0.088651165f, \
+    22.657885f, 7.2302442e-05f, -0.071785003f, 18.146118f, 5.56042e-05f, -0.053094234f, 13.117718f, 3.5756715e-05f, \
+    -0.030638143f, 7.0374265f, 9.2632226e-06f, -0.00022449449f, -1.2648522f, -3.4232373e-05f, 0.051221125f, -15.541838f, \
+    0.00047320503f, -0.50259197f, 131.55537f, 0.00035691433f, -0.37888137f, 99.221077f, 0.00029154896f, -0.3092463f, \
+    81.012039f, 0.00024802703f, -0.26279563f, 68.856476f, 0.00021604342f, -0.22858018f, 59.893166f, 0.00019088728f, \
+    -0.20159137f, 52.812824f, 0.00017003002f, -0.17913677f, 46.91095f, 0.00015193567f, -0.15957575f, 41.757439f, \
+    0.00013555502f, -0.14178112f, 37.055676f, 0.00012006771f, -0.12486289f, 32.570076f, 0.0001047133f, -0.10798496f, \
+    28.077562f, 8.8626271e-05f, -0.090181582f, 23.318422f, 7.0578004e-05f, -0.070065022f, 17.917284f, 4.8387254e-05f, \
+    -0.045149397f, 11.199661f, 1.7045581e-05f, -0.0096829087f, 1.6023397f, -4.1662719e-05f, 0.057479721f, -16.641775f, \
+    0.00051609828f, -0.55050099f, 144.89114f, 0.00039303917f, -0.41921005f, 110.44268f, 0.0003241321f, -0.34560958f, \
+    91.128319f, 0.00027846437f, -0.29675668f, 78.303383f, 0.00024507262f, -0.26096565f, 68.901367f, 0.0002189426f, \
+    -0.23288895f, 61.518642f, 0.00019737941f, -0.20964874f, 55.399258f, 0.00017873984f, -0.18948552f, 50.080276f, \
+    0.00016189089f, -0.17118004f, 45.239914f, 0.00014592928f, -0.15375236f, 40.618301f, 0.00012998904f, -0.13625319f, \
+    35.962242f, 0.000113037f, -0.11753878f, 30.965181f, 9.3522576e-05f, -0.095881581f, 25.163122f, 6.8512134e-05f, \
+    -0.06800615f, 17.67737f, 3.0703384e-05f, -0.025769461f, 6.3329363f, -4.9775452e-05f, 0.063994221f, -17.653015f, \
+    0.00058791926f, -0.63001615f, 166.80316f, 0.00045025311f, -0.4826774f, 127.97746f, 0.00037469561f, -0.40175119f, \
+    106.65904f, 0.00032540699f, -0.34890458f, 92.74025f, 0.00028990558f, -0.3107864f, 82.70105f, 0.00026254443f, \
+    -0.28135407f, 74.948112f, 0.00024031058f, -0.25738013f, 68.630066f, 0.00022137391f, -0.23690017f, 63.228062f, \
+    0.00020447005f, -0.2185515f, 58.381413f, 0.00018857721f, -0.20122607f, 53.79578f, 0.00017268525f, -0.18382017f, \
+    49.17683f, 0.00015553029f, -0.1649445f, 44.153103f, 0.00013510327f, -0.14238548f, 38.13282f, 0.00010735133f, \
+    -0.11168467f, 29.927893f, 6.1342624e-05f, -0.060876295f, 16.370642f, -5.2788419e-05f, 0.064110518f, -16.662214f, \
+    0.00072777545f, -0.78397495f, 208.95059f, 0.00055557606f, -0.59899151f, 159.95137f, 0.00046626775f, -0.50304723f, \
+    134.56613f, 0.00041048185f, -0.44310689f, 118.72845f, 0.0003720205f, -0.4017714f, 107.82507f, 0.00034382541f, \
+    -0.37145895f, 99.846367f, 0.00032225327f, -0.3482551f, 93.755203f, 0.00030517328f, -0.32986912f, 88.944962f, \
+    0.00029118039f, -0.31478843f, 85.015366f, 0.00027919188f, -0.30184436f, 81.657349f, 0.00026815609f, -0.2898981f, \
+    78.569839f, 0.00025669453f, -0.27745324f, 75.357109f, 0.00024236977f, -0.2618638f, 71.319328f, 0.0002195592f, \
+    -0.23703939f, 64.847275f, 0.00017074209f, -0.18407501f, 50.961365f, -2.9997059e-07f, 0.00033947596f, 2.6497443f, \
+    0.00063088746f, -0.62499368f, 148.85988f, 0.00020350602f, -0.18884125f, 40.604908f, 9.0322421e-05f, -0.072767712f, \
+    11.650231f, 3.5139485e-05f, -0.016328266f, -2.341644f, 1.014791e-06f, 0.018573826f, -10.966842f, -2.33058e-05f, \
+    0.043546565f, -17.148647f, -4.2506905e-05f, 0.06341999f, -22.101526f, -5.8972077e-05f, 0.080658875f, -26.446276f, \
+    -7.4145428e-05f, 0.096772574f, -30.566761f, -8.9098401e-05f, 0.11290587f, -34.760384f, -0.00010483686f, 0.1301676f, \
+    -39.323826f, -0.00012255731f, 0.14992031f, -44.632385f, -0.00014403663f, 0.17424269f, -51.271549f, -0.00017250172f, \
+    0.20699406f, -60.346947f, -0.00021506917f, 0.25693765f, -74.420006f, -0.00028657672f, 0.34546208f, -100.32758f, \
+    0.00058750645f, -0.59361583f, 145.46898f, 0.00027694169f, -0.27542239f, 66.103355f, 0.00017387177f, -0.16903426f, \
+    39.339378f, 0.00011616926f, -0.10907479f, 24.146841f, 7.7348617e-05f, -0.068498075f, 13.807538f, 4.8468988e-05f, \
+    -0.038135365f, 6.0316868f, 2.5397605e-05f, -0.013718355f, -0.25601524f, 5.8619589e-06f, 0.0071202586f, -5.6576581f, \
+    -1.1564831e-05f, 0.025885699f, -10.560846f, -2.7909622e-05f, 0.043683771f, -15.255705f, -4.4040255e-05f, 0.061479289f, \
+    -20.002247f, -6.0839004e-05f, 0.080296218f, -25.085752f, -7.9376645e-05f, 0.10144684f, -30.885931f, -0.00010106393f, \
+    0.12682654f, -37.982239f, -0.00012661309f, 0.15836503f, -47.126839f, -0.00011887154f, 0.16381615f, -51.386639f, \
+    0.00053420814f, -0.54376876f, 134.6281f, 0.00028590256f, -0.28808132f, 70.443901f, 0.00019361886f, -0.19257739f, \
+    46.346069f, 0.00014072908f, -0.13754772f, 32.387394f, 0.00010454807f, -0.099682376f, 22.72954f, 7.7192199e-05f, \
+    -0.07086964f, 15.338148f, 5.5075154e-05f, -0.047408443f, 9.2823458f, 3.6249123e-05f, -0.027275071f, 4.049757f, \
+    1.9495994e-05f, -0.0091870613f, -0.68843639f, 3.9522897e-06f, 0.0077863429f, -5.1759109f, -1.1076836e-05f, 0.024424411f, \
+    -9.6233282f, -2.6222835e-05f, 0.041482851f, -14.24474f, -4.207934e-05f, 0.059767399f, -19.286219f, -5.8876358e-05f, \
+    0.07993485f, -25.004093f, -7.3143885e-05f, 0.099607311f, -31.046091f, -1.7149245e-05f, 0.056096457f, -22.926493f, \
+    0.000496166f, -0.50781161f, 126.66676f, 0.0002879333f, -0.29245704f, 72.312271f, 0.0002032128f, -0.20449051f, \
+    50.02784f, 0.00015354151f, -0.15268452f, 36.851349f, 0.00011932071f, -0.11680803f, 27.685308f, 9.3383205e-05f, \
+    -0.089451797f, 20.660229f, 7.2386902e-05f, -0.067151405f, 14.899782f, 5.4511653e-05f, -0.04800918f, 9.9215307f, \
+    3.863997e-05f, -0.030845858f, 5.4225564f, 2.4005702e-05f, -0.014832874f, 1.185678f, 1.0025892e-05f, 0.00069058919f, \
+    -2.9686615f, -3.7691416e-06f, 0.016309343f, -7.2096205f, -1.7674331e-05f, 0.03251642f, -11.701742f, -3.1203163e-05f, \
+    0.049229495f, -16.511309f, -3.8409577e-05f, 0.061572164f, -20.657385f, 4.7188136e-05f, -0.01130364f, -5.2700014f, \
+    0.00046946865f, -0.48274437f, 121.1785f, 0.00028885718f, -0.29523587f, 73.625275f, 0.00020990057f, -0.21298517f, \
+    52.705753f, 0.00016256126f, -0.16347519f, 40.072502f, 0.0001296686f, -0.12891248f, 31.219872f, 0.00010467747f, \
+    -0.1025052f, 24.425852f, 8.4462663e-05f, -0.081001356f, 18.863916f, 6.7297085e-05f, -0.062593333f, 14.072375f, \
+    5.2114803e-05f, -0.046151865f, 9.7598915f, 3.8194368e-05f, -0.030893205f, 5.7202339f, 2.5010811e-05f, -0.016216544f, \
+    1.7892123f, 1.218632e-05f, -0.0016329273f, -2.1774228f, -4.0114293e-07f, 0.013171673f, -6.2979183f, -1.1853406e-05f, \
+    0.027696535f, -10.532199f, -1.478627e-05f, 0.035645448f, -13.548931f, 8.9701047e-05f, -0.055528916f, 6.2676582f, \
+    0.00045116257f, -0.46591499f, 117.62782f, 0.00029035303f, -0.29837796f, 74.954628f, 0.00021587138f, -0.22054484f, \
+    55.082722f, 0.00017028644f, -0.17273633f, 42.842834f, 0.00013831898f, -0.13906331f, 34.193493f, 0.00011393536f, \
+    -0.11324322f, 27.534914f, 9.4197225e-05f, -0.092208274f, 22.084164f, 7.7461722e-05f, -0.074233316f, 17.39888f, \
+    6.2708728e-05f, -0.058233924f, 13.19826f, 4.9247745e-05f, -0.043456912f, 9.2833939f, 3.6583409e-05f, -0.029331297f, \
+    5.4974947f, 2.4381281e-05f, -0.015412566f, 1.7077025f, 1.2602747e-05f, -0.0014717791f, -2.1823835f, 2.3465179e-06f, \
+    0.011791114f, -6.0827417f, 1.7356136e-06f, 0.017377164f, -8.4940376f, 0.00011845993f, -0.085288465f, 14.023643f, \
+    0.00043952512f, -0.4557493f, 115.6862f, 0.00029317912f, -0.3027814f, 76.566055f, 0.00022214385f, -0.22832657f, \
+    57.486683f, 0.00017786371f, -0.18175904f, 45.524872f, 0.00014652735f, -0.14866902f, 37.000134f, 0.00012251076f, \
+    -0.12318162f, 30.410437f, 0.00010302644f, -0.10237741f, 25.007816f, 8.6499371e-05f, -0.084597439f, 20.365339f, \
+    7.1946291e-05f, -0.068793312f, 16.210665f, 5.8701284e-05f, -0.054236267f, 12.35078f, 4.6288511e-05f, -0.040375136f, \
+    8.6338778f, 3.4391542e-05f, -0.026783718f, 4.931838f, 2.2993921e-05f, -0.013254778f, 1.1538727f, 1.3239047e-05f, \
+    -0.00052741554f, -2.6007705f, 1.3468045e-05f, 0.0042254473f, -4.7977457f, 0.00013799057f, -0.10540375f, 19.277756f, \
+    0.00043365193f, -0.45144168f, 115.19354f, 0.00029785885f, -0.30906332f, 78.641418f, 0.00022938657f, -0.23708782f, \
+    60.131771f, 0.00018601802f, -0.19135733f, 48.346523f, 0.00015506605f, -0.15859355f, 39.880711f, 0.00013122533f, \
+    -0.13323747f, 33.307537f, 0.0001118239f, -0.1124822f, 27.905188f, 9.533589e-05f, -0.094715893f, 23.257402f, \
+    8.0801823e-05f, -0.078912742f, 19.096884f, 6.7568748e-05f, -0.064356454f, 15.2335f, 5.5168235e-05f, -0.050503317f, \
+    11.51733f, 4.3284504e-05f, -0.036928058f, 7.8207202f, 3.1883417e-05f, -0.023404922f, 4.0484934f, 2.2035645e-05f, \
+    -0.010593084f, 0.279311f, 2.1874437e-05f, -0.0054100323f, -2.02443f, 0.00015088102f, -0.11861377f, 22.753986f, \
+    0.00043323546f, -0.4527725f, 116.12758f, 0.00030492182f, -0.31783506f, 81.356987f, 0.00023820136f, -0.24750558f, \
+    63.207932f, 0.00019536854f, -0.20222309f, 51.500553f, 0.00016456979f, -0.16954413f, 43.031651f, 0.00014073437f, \
+    -0.14413963f, 36.42828f, 0.00012127141f, -0.12327996f, 30.985931f, 0.0001046853f, -0.10538082f, 26.294054f, \
+    9.0026377e-05f, -0.089424379f, 22.086651f, 7.664087e-05f, -0.074692354f, 18.172707f, 6.4050932e-05f, -0.060630929f, \
+    14.399658f, 5.1918363e-05f, -0.046792004f, 10.634275f, 4.0153453e-05f, -0.03289308f, 6.76752f, 2.9658802e-05f, \
+    -0.019418057f, 2.8340187f, 2.7979917e-05f, -0.012648573f, 0.13041122f, 0.00015848785f, -0.12636012f, 24.837004f, \
+    0.00043851291f, -0.46007994f, 118.60542f, 0.00031505519f, -0.329873f, 84.931671f, 0.00024928487f, -0.26035708f, \
+    66.931335f, 0.00020659881f, -0.21511619f, 55.197475f, 0.00017571602f, -0.18227264f, 46.660904f, 0.00015171798f, \
+    -0.1566422f, 39.981022f, 0.00013205949f, -0.1355357f, 34.461243f, 0.00011525559f, -0.11737589f, 29.691458f, \
+    0.00010035199f, -0.10113773f, 25.403025f, 8.6679895e-05f, -0.086085908f, 21.400112f, 7.3733689e-05f, -0.071637139f, \
+    17.522434f, 6.1124243e-05f, -0.057290576f, 13.623435f, 4.8656701e-05f, -0.042655945f, 9.5672207f, 3.696169e-05f, \
+    -0.027937207f, 5.3184938f, 3.2617227e-05f, -0.018401511f, 1.9155045f, 0.00016120524f, -0.12909329f, 25.658819f, \
+    0.0004503745f, -0.4743931f, 122.92455f, 0.00032928164f, -0.34631667f, 89.681938f, 0.00026359619f, -0.27670586f, \
+    71.595787f, 0.00022062052f, -0.23104616f, 59.71579f, 0.00018938986f, -0.19775859f, 51.038555f, 0.00016505011f, \
+    -0.17171192f, 44.232246f, 0.00014506237f, -0.1502161f, 38.597504f, 0.00012793021f, -0.13167758f, 33.718601f, \
+    0.00011267915f, -0.11504758f, 29.31988f, 9.8610442e-05f, -0.099557839f, 25.196501f, 8.5171552e-05f, -0.084575146f, \
+    21.175058f, 7.1891169e-05f, -0.069512896f, 17.08699f, 5.8408124e-05f, -0.053808972f, 12.752956f, 4.4941549e-05f, \
+    -0.037244122f, 8.0314665f, 3.6642155e-05f, -0.023609776f, 3.5889704f, 0.00015843235f, -0.12626302f, 25.103752f, \
+    0.00047071729f, -0.49782777f, 129.67302f, 0.00034927001f, -0.36901155f, 96.115944f, 0.00028263032f, -0.29820326f, \
+    77.655556f, 0.00023883017f, -0.25155541f, 65.479874f, 0.00020693477f, -0.21748595f, 56.57304f, 0.0001820498f, \
+    -0.19080594f, 49.583088f, 0.00016159406f, -0.16877279f, 43.79438f, 0.00014403251f, -0.14974771f, 38.77792f, \
+    0.00012835168f, -0.13263804f, 34.24572f, 0.000113806f, -0.11662441f, 29.979071f, 9.9775199e-05f, -0.1010014f, \
+    25.785498f, 8.567141e-05f, -0.085059844f, 21.46467f, 7.0895745e-05f, -0.067990147f, 16.773935f, 5.5070122e-05f, \
+    -0.048955958f, 11.415584f, 4.1257848e-05f, -0.029600412f, 5.5159001f, 0.00014817662f, -0.11594478f, 22.724432f, \
+    0.00050334289f, -0.53457278f, 139.99915f, 0.00037800317f, -0.40124309f, 105.13433f, 0.00030899033f, -0.32771868f, \
+    85.898193f, 0.00026364034f, -0.27930522f, 73.220947f, 0.00023066945f, -0.24401379f, 63.968037f, 0.00020499903f, \
+    -0.21644367f, 56.726723f, 0.00018393779f, -0.19372714f, 50.74585f, 0.00016587458f, -0.17413975f, 45.572388f, \
+    0.00014973195f, -0.1565181f, 40.89883f, 0.00013469643f, -0.13996892f, 36.486473f, 0.00012005528f, -0.12368768f, \
+    32.116531f, 0.00010506413f, -0.1067996f, 27.545317f, 8.8800603e-05f, -0.088155627f, 22.442383f, 7.0046743e-05f, \
+    -0.066045366f, 16.28639f, 4.8771184e-05f, -0.038919255f, 8.3965988f, 0.00012593518f, -0.093762159f, 17.491724f, \
+    0.00055638293f, -0.59354585f, 156.33406f, 0.00042147681f, -0.44960251f, 118.54003f, 0.0003478305f, -0.37092772f, \
+    97.879753f, 0.00029982338f, -0.31955653f, 84.383606f, 0.0002652056f, -0.28242987f, 74.622131f, 0.0002384785f, \
+    -0.25368142f, 67.054176f, 0.00021673134f, -0.23020028f, 60.861546f, 0.00019821811f, -0.21011308f, 55.550228f, \
+    0.00018176115f, -0.19214621f, 50.782597f, 0.00016645087f, -0.17530186f, 46.29166f, 0.00015145128f, -0.15864289f, \
+    41.823181f, 0.00013581177f, -0.14107463f, 37.075367f, 0.00011817597f, -0.12098881f, 31.597588f, 9.6153846e-05f, \
+    -0.09544418f, 24.549654f, 6.5045489e-05f, -0.058037907f, 14.010603f, 8.1895996e-05f, -0.050195061f, 7.1755877f, \
+    0.00065032329f, -0.69716811f, 184.77606f, 0.00049409014f, -0.52990508f, 140.6548f, 0.00041141888f, -0.44133294f, \
+    117.30038f, 0.00035880267f, -0.38489917f, 102.42428f, 0.00032173176f, -0.3450765f, 91.928162f, 0.00029381172f, \
+    -0.31501848f, 84.004639f, 0.00027170425f, -0.29114589f, 77.708099f, 0.00025342975f, -0.27132958f, 72.474953f, \
+    0.00023766261f, -0.25413433f, 67.923698f, 0.00022337405f, -0.238433f, 63.752411f, 0.00020958755f, -0.22313718f, \
+    59.666351f, 0.00019510863f, -0.2068913f, 55.294308f, 0.00017801972f, -0.18748902f, 50.027393f, 0.00015426957f, \
+    -0.16022682f, 42.562271f, 0.00011178602f, -0.11094619f, 28.96347f, -5.061288e-06f, 0.034949712f, -12.815884f, \
+    0.00085766852f, -0.92472053f, 246.86557f, 0.00064351328f, -0.69448376f, 185.77246f, 0.00054007472f, -0.58329934f, \
+    156.31522f, 0.00047875557f, -0.51740336f, 138.89284f, 0.00043881987f, -0.47450188f, 127.58392f, 0.00041170986f, \
+    -0.4453958f, 119.94668f, 0.00039327506f, -0.42562449f, 114.79866f, 0.00038133981f, -0.41285068f, 111.52204f, \
+    0.00037477675f, -0.40586427f, 109.79945f, 0.0003731231f, -0.40416956f, 109.5049f, 0.00037643846f, -0.40783182f, \
+    110.66409f, 0.00038529283f, -0.41746229f, 113.45244f, 0.00040077363f, -0.43421707f, 118.19869f, 0.00042381388f, \
+    -0.45903751f, 125.19141f, 0.00044566585f, -0.48217916f, 131.91405f, -2.7231624e-06f, 0.0030818158f, 5.1100564f, \
+    0.00065378123f, -0.64806312f, 154.53198f, 0.000209017f, -0.19451161f, 42.050529f, 9.3604125e-05f, -0.076158531f, \
+    12.52345f, 3.7599471e-05f, -0.01887002f, -1.6846417f, 3.0633387e-06f, 0.016462589f, -10.420974f, -2.1496764e-05f, \
+    0.041691083f, -16.670052f, -4.0849751e-05f, 0.061732441f, -21.668392f, -5.7416728e-05f, 0.079090938f, -26.047001f, \
+    -7.2660456e-05f, 0.095296666f, -30.195349f, -8.766041e-05f, 0.11150536f, -34.414223f, -0.00010342528f, 0.12883368f, \
+    -39.003399f, -0.00012115107f, 0.14865355f, -44.342735f, -0.00014260117f, 0.1730521f, -51.024853f, -0.0001709119f, \
+    0.20585717f, -60.161045f, -0.00021238101f, 0.25522855f, -74.211639f, -0.00025303409f, 0.31533164f, -93.589272f, \
+    0.00060168537f, -0.60793948f, 149.0114f, 0.00028110779f, -0.27961412f, 67.144981f, 0.00017658772f, -0.17177089f, \
+    40.024529f, 0.00011837449f, -0.1113003f, 24.707153f, 7.9309808e-05f, -0.070476741f, 14.306935f, 5.0303541e-05f, \
+    -0.039982192f, 6.4977388f, 2.7174281e-05f, -0.015499815f, 0.1924874f, 7.6304714e-06f, 0.0053572939f, -5.2157855f, \
+    -9.7598613e-06f, 0.024100594f, -10.116436f, -2.601778e-05f, 0.041832175f, -14.799092f, -4.1990315e-05f, 0.059499852f, \
+    -19.520367f, -5.8506128e-05f, 0.078081571f, -24.555758f, -7.6483368e-05f, 0.098754041f, -30.255003f, -9.6769523e-05f, \
+    0.1228954f, -37.079048f, -0.00011665927f, 0.14919366f, -45.01215f, -2.9659672e-05f, 0.078234047f, -30.881601f, \
+    0.00054451526f, -0.55421507f, 137.22794f, 0.00028962744f, -0.29182824f, 71.376022f, 0.00019611236f, -0.19507731f, \
+    46.968887f, 0.00014277735f, -0.13959804f, 32.899132f, 0.00010640419f, -0.10153788f, 23.193174f, 7.8969984e-05f, \
+    -0.072643295f, 15.781254f, 5.6840759e-05f, -0.0491644f, 9.7202616f, 3.8053404e-05f, -0.029061392f, 4.4937191f, \
+    2.1390513e-05f, -0.011051425f, -0.22748117f, 6.002932e-06f, 0.0057838461f, -4.6843171f, -8.7681938e-06f, 0.02219124f, \
+    -9.0801363f, -2.3468399e-05f, 0.0388477f, -13.610956f, -3.8457143e-05f, 0.056341186f, -18.472269f, -5.3136344e-05f, \
+    0.074546635f, -23.736088f, -5.9325808e-05f, 0.086572334f, -27.970636f, 9.7062235e-05f, -0.053404026f, 3.2752402f, \
+    0.00050436461f, -0.51614571f, 128.75238f, 0.00029139139f, -0.29594374f, 73.183098f, 0.00020560823f, -0.20689391f, \
+    50.627594f, 0.00015552918f, -0.15467192f, 37.347f, 0.00012113019f, -0.11861195f, 28.134819f, 9.5126379e-05f, \
+    -0.091184422f, 21.091347f, 7.4133699e-05f, -0.068881549f, 15.329287f, 5.6317876e-05f, -0.049790427f, 10.362202f, \
+    4.0563136e-05f, -0.032732144f, 5.8869896f, 2.6120855e-05f, -0.016893629f, 1.689893f, 1.2451385e-05f, -0.0016537588f, \
+    -2.3995521f, -8.1269576e-07f, 0.013477296f, -6.5284672f, -1.3690191e-05f, 0.028733416f, -10.800671f, -2.4729357e-05f, \
+    0.043116707f, -15.065712f, -2.2576247e-05f, 0.046569977f, -17.104702f, 0.0001751978f, -0.13348332f, 23.821751f, \
+    0.00047641419f, -0.48982599f, 122.95993f, 0.00029215176f, -0.29856858f, 74.461647f, 0.00021225779f, -0.21535678f, \
+    53.299839f, 0.00016454027f, -0.16545773f, 40.568218f, 0.00013147747f, -0.1307175f, 31.670244f, 0.00010642241f, \
+    -0.10423958f, 24.857464f, 8.6213404e-05f, -0.082734093f, 19.293713f, 6.9112102e-05f, -0.064381018f, 14.513994f, \
+    5.4056221e-05f, -0.048053358f, 10.227243f, 4.0343646e-05f, -0.032984555f, 6.2310491f, 2.7496053e-05f, -0.018616648f, \
+    2.3710485f, 1.5245926e-05f, -0.0045633898f, -1.4731328f, 3.7689813e-06f, 0.0092094122f, -5.3541002f, -4.9979685e-06f, \
+    0.021216171f, -8.9988117f, 2.144651e-06f, 0.01960321f, -9.7517529f, 0.00022693339f, -0.18587686f, 37.144386f, \
+    0.00045734466f, -0.47223905f, 119.22697f, 0.0002935665f, -0.30164135f, 75.777939f, 0.00021823755f, -0.22293483f, \
+    55.684353f, 0.00017229591f, -0.17475666f, 43.35017f, 0.00014016349f, -0.14090961f, 34.655811f, 0.00011571586f, \
+    -0.11501735f, 27.977655f, 9.5981792e-05f, -0.093977734f, 22.523952f, 7.9308877e-05f, -0.076054871f, 17.849436f, \
+    6.4682055e-05f, -0.060167968f, 13.673912f, 5.1431816e-05f, -0.045582667f, 9.8026829f, 3.9111579e-05f, -0.031772889f, \
+    6.0892811f, 2.7500932e-05f, -0.018400228f, 2.4254928f, 1.6868622e-05f, -0.0055242088f, -1.2175333f, 9.387325e-06f, \
+    0.0051390505f, -4.5099916f, 1.9234794e-05f, 0.00082216726f, -4.5827055f, 0.00026401746f, -0.22293095f, 46.476521f, \
+    0.00044526614f, -0.46164411f, 117.18487f, 0.00029638811f, -0.30605495f, 77.396637f, 0.00022456645f, -0.2307853f, \
+    58.109119f, 0.0001799429f, -0.18385948f, 46.055183f, 0.00014844353f, -0.15059587f, 37.485058f, 0.00012436125f, \
+    -0.12503338f, 30.874676f, 0.00010487789f, -0.10422025f, 25.467714f, 8.8409608e-05f, -0.086487472f, 20.834478f, \
+    7.3978612e-05f, -0.070790634f, 16.703295f, 6.0940372e-05f, -0.056420144f, 12.885437f, 4.8868638e-05f, -0.042870421f, \
+    9.2395678f, 3.7562339e-05f, -0.029822471f, 5.6624327f, 2.7314854e-05f, -0.017359132f, 2.1309946f, 2.0354184e-05f, \
+    -0.0072426377f, -1.0148393f, 3.1210242e-05f, -0.012522813f, -0.84996933f, 0.00029348009f, -0.25189257f, 53.683205f, \
+    0.00043919563f, -0.45715803f, 116.65504f, 0.00030114382f, -0.31243154f, 79.501221f, 0.00023192045f, -0.23967379f, \
+    60.790512f, 0.00018821323f, -0.19358775f, 48.91317f, 0.00015709648f, -0.16064711f, 40.400696f, 0.00013318656f, \
+    -0.1352112f, 33.805309f, 0.00011378197f, -0.11444186f, 28.397034f, 9.7348158e-05f, -0.096717179f, 23.756819f, \
+    8.2930841e-05f, -0.081014961f, 19.617929f, 6.9897942e-05f, -0.066637479f, 15.794333f, 5.7829751e-05f, -0.053085607f, \
+    12.1463f, 4.6524481e-05f, -0.040039625f, 8.5705719f, 3.6254911e-05f, -0.027560176f, 5.0386434f, 2.9169754e-05f, \
+    -0.017319813f, 1.8666902f, 3.9651241e-05f, -0.022150083f, 1.9117519f, 0.00031969941f, -0.2771937f, 59.88707f, \
+    0.0004387972f, -0.45853484f, 117.60956f, 0.00030837729f, -0.32139835f, 82.272453f, 0.00024091637f, -0.25029376f, \
+    63.922981f, 0.00019774024f, -0.20464876f, 52.121078f, 0.00016677046f, -0.17178507f, 43.603073f, 0.00014286011f, \
+    -0.14629376f, 36.975391f, 0.00012338883f, -0.12541382f, 31.525278f, 0.00010685194f, -0.10755038f, 26.839233f, \
+    9.2304261e-05f, -0.091688417f, 22.651588f, 7.9111844e-05f, -0.077127032f, 18.775114f, 6.6843662e-05f, -0.063354939f, \
+    15.066883f, 5.5271728e-05f, -0.050025485f, 11.416965f, 4.4604785e-05f, -0.037133325f, 7.7805338f, 3.6801823e-05f, \
+    -0.026151175f, 4.4230103f, 4.565464e-05f, -0.029251263f, 4.0251455f, 0.00034557123f, -0.30169737f, 65.799248f, \
+    0.00044431945f, -0.46612778f, 120.17048f, 0.00031880438f, -0.33376345f, 85.937988f, 0.00025227753f, -0.26345173f, \
+    67.730698f, 0.00020923231f, -0.21782957f, 55.89682f, 0.00017816674f, -0.18478759f, 47.307194f, 0.0001540853f, \
+    -0.15906048f, 40.600147f, 0.00013441221f, -0.13792634f, 35.070465f, 0.00011765245f, -0.11979619f, 30.304758f, \
+    0.00010285521f, -0.10364673f, 26.034395f, 8.9370042e-05f, -0.088758409f, 22.066908f, 7.6735647e-05f, -0.07458774f, \
+    18.250923f, 6.4667787e-05f, -0.060729682f, 14.461702f, 5.3256877e-05f, -0.047057092f, 10.623907f, 4.4152202e-05f, \
+    -0.034722216f, 6.9223886f, 5.0104412e-05f, -0.034789991f, 5.7523036f, 0.00037341667f, -0.32762164f, 71.955132f, \
+    0.00045671142f, -0.48103175f, 124.65361f, 0.00033350231f, -0.35072622f, 90.830635f, 0.00026701103f, -0.28026366f, \
+    72.521759f, 0.00022364547f, -0.23418814f, 60.532097f, 0.00019221293f, -0.20068063f, 51.795795f, 0.00016777794f, \
+    -0.1745238f, 44.958519f, 0.00014776835f, -0.15299192f, 39.311459f, 0.000130676f, -0.13447785f, 34.43507f, \
+    0.00011552836f, -0.11793279f, 30.053265f, 0.00010164333f, -0.10260241f, 25.964045f, 8.8509747e-05f, -0.087890163f, \
+    22.00209f, 7.5754797e-05f, -0.073298462f, 18.018885f, 6.3285843e-05f, -0.058510642f, 13.891066f, 5.2286825e-05f, \
+    -0.044199046f, 9.6826372f, 5.391155e-05f, -0.039765064f, 7.3665605f, 0.00040568426f, -0.35721934f, 78.880745f, \
+    0.0004780115f, -0.5055173f, 131.68919f, 0.00035424699f, -0.37424925f, 97.490425f, 0.00028670341f, -0.30248117f, \
+    78.777763f, 0.00024246062f, -0.25535935f, 66.476501f, 0.00021033385f, -0.22103722f, 57.501614f, 0.00018533767f, \
+    -0.19422917f, 50.475719f, 0.00016485284f, -0.17215151f, 44.672268f, 0.00014732972f, -0.15314871f, 39.657581f, \
+    0.00013175474f, -0.13612588f, 35.14262f, 0.00011739693f, -0.12027531f, 30.910908f, 0.00010367412f, -0.10492469f, \
+    26.777103f, 9.0089881e-05f, -0.089446306f, 22.558933f, 7.6294011e-05f, -0.073255122f, 18.064289f, 6.2803076e-05f, \
+    -0.056332972f, 13.182103f, 5.8380872e-05f, -0.045611952f, 9.2619448f, 0.00044571125f, -0.39346728f, 87.25177f, \
+    0.00051234744f, -0.54412919f, 142.52208f, 0.00038425051f, -0.40786844f, 106.88612f, 0.00031415132f, -0.33318546f, \
+    87.344002f, 0.00026826889f, -0.28420001f, 74.514641f, 0.00023502126f, -0.24860618f, 65.180161f, 0.00020921977f, \
+    -0.22088589f, 57.896832f, 0.00018812621f, -0.1981207f, 51.89996f, 0.00017011011f, -0.17856431f, 46.73045f, \
+    0.00015409115f, -0.16104788f, 42.078861f, 0.00013926801f, -0.1446871f, 37.707977f, 0.00012496294f, -0.1287071f, \
+    33.405174f, 0.00011051573f, -0.11230657f, 28.942686f, 9.5230513e-05f, -0.094537392f, 24.034388f, 7.8696241e-05f, \
+    -0.074415267f, 18.32181f, 6.6091307e-05f, -0.055167664f, 12.216563f, 0.00049901241f, -0.44116497f, 98.133949f, \
+    0.00056869292f, -0.60670233f, 159.83173f, 0.00043007531f, -0.45879477f, 120.98929f, 0.00035498483f, -0.37857342f, \
+    99.918739f, 0.000306284f, -0.32645518f, 86.223404f, 0.00027131967f, -0.28895018f, 76.359947f, 0.00024444453f, \
+    -0.26003289f, 68.74498f, 0.00022268397f, -0.23652327f, 62.541786f, 0.00020426464f, -0.21651721f, 57.247883f, \
+    0.00018800204f, -0.19873132f, 52.522499f, 0.00017299691f, -0.18217453f, 48.099464f, 0.00015844665f, -0.16593727f, \
+    43.730068f, 0.0001434803f, -0.14899297f, 39.12685f, 0.00012694794f, -0.12991202f, 33.877396f, 0.00010716439f, \
+    -0.1063702f, 27.275642f, 8.387956e-05f, -0.075948708f, 18.289551f, 0.00057598314f, -0.5090633f, 113.41698f, \
+    0.00067029335f, -0.71866518f, 190.53082f, 0.00050790131f, -0.5447914f, 144.65195f, 0.00042296213f, -0.45378143f, \
+    120.64824f, 0.00036932845f, -0.39625078f, 105.47945f, 0.00033181848f, -0.35595086f, 94.855446f, 0.00030379754f, \
+    -0.32577679f, 86.899948f, 0.00028182773f, -0.3020415f, 80.638443f, 0.00026388984f, -0.28257167f, 75.495216f, \
+    0.00024865201f, -0.26592267f, 71.085686f, 0.00023510496f, -0.25098372f, 67.111259f, 0.00022232289f, -0.23671201f, \
+    63.28735f, 0.00020921534f, -0.22184487f, 59.263344f, 0.00019409478f, -0.20437685f, 54.47364f, 0.00017356672f, \
+    -0.18016286f, 47.731548f, 0.00013897839f, -0.13792619f, 35.699425f, 0.0006923069f, -0.60799921f, 135.02957f, \
+    0.00090456108f, -0.97555256f, 260.56302f, 0.00067422114f, -0.72785056f, 194.79922f, 0.00056574593f, -0.61123312f, \
+    163.89006f, 0.00050266553f, -0.54344445f, 145.96536f, 0.00046252785f, -0.50033909f, 134.60855f, 0.00043625859f, \
+    -0.47216082f, 127.22918f, 0.0004195887f, -0.45432264f, 122.61156f, 0.00041043886f, -0.44459358f, 120.16753f, \
+    0.00040797982f, -0.44208944f, 119.66887f, 0.00041234182f, -0.44696182f, 121.16621f, 0.00042473077f, -0.46052635f, \
+    125.02614f, 0.00044809221f, -0.4859843f, 132.12982f, 0.00048913289f, -0.5306161f, 144.47421f, 0.00056535681f, \
+    -0.61341065f, 167.26085f, 0.00074209447f, -0.80518442f, 219.87909f, -4.1650779e-05f, 0.054977179f, 5.0085378f, \
+    0.00065558683f, -0.6498819f, 154.9789f, 0.00020944154f, -0.19494823f, 42.161777f, 9.3856397e-05f, -0.076419093f, \
+    12.590513f, 3.7788584e-05f, -0.019065335f, -1.6341863f, 3.2209766e-06f, 0.016300196f, -10.379014f, -2.1357288e-05f, \
+    0.041548088f, -16.633192f, -4.0721625e-05f, 0.061602015f, -21.634939f, -5.729598e-05f, 0.078969248f, -26.016031f, \
+    -7.2544542e-05f, 0.09518145f, -30.16637f, -8.7547291e-05f, 0.11139511f, -34.386978f, -0.00010331291f, 0.12872727f, \
+    -38.97781f, -0.00012103684f, 0.14855005f, -44.318954f, -0.00014248001f, 0.17294985f, -51.003242f, -0.00017076603f, \
+    0.20574656f, -60.141079f, -0.00021208814f, 0.2550132f, -74.175209f, -0.00024812925f, 0.3107267f, -92.509201f, \
+    0.00060279382f, -0.60905927f, 149.2883f, 0.00028142874f, -0.279937f, 67.225189f, 0.0001767964f, -0.17198111f, \
+    40.077141f, 0.00011854392f, -0.11147124f, 24.750172f, 7.9460646e-05f, -0.070628881f, 14.345317f, 5.0444887e-05f, \
+    -0.04012445f, 6.5336204f, 2.7311506e-05f, -0.015637379f, 0.22710371f, 7.7675277e-06f, 0.0052206856f, -5.1815619f, \
+    -9.6193207e-06f, 0.023961598f, -10.081845f, -2.5869504e-05f, 0.041687004f, -14.763299f, -4.1828058e-05f, 0.059343033f, \
+    -19.482178f, -5.8318641e-05f, 0.077903226f, -24.51302f, -7.6244971e-05f, 0.098531209f, -30.202606f, -9.6399883e-05f, \
+    0.12255424f, -37.000053f, -0.00011572991f, 0.14832745f, -44.810146f, -1.946934e-05f, 0.068421751f, -28.522554f, \
+    0.00054531643f, -0.55502713f, 137.43002f, 0.00028991423f, -0.29211673f, 71.447777f, 0.000196304f, -0.19526944f, \
+    47.016739f, 0.00014293475f, -0.13975558f, 32.938438f, 0.00010654693f, -0.10168055f, 23.228809f, 7.9106903e-05f, \
+    -0.072779872f, 15.815361f, 5.6977053e-05f, -0.049299926f, 9.7540464f, 3.819312e-05f, -0.029199705f, 4.5280814f, \
+    2.153785e-05f, -0.01119642f, -0.19164367f, 6.1633596e-06f, 0.0056271511f, -4.6458569f, -8.5860211e-06f, 0.022014918f, \
+    -9.0372429f, -2.3248231e-05f, 0.038636804f, -13.560198f, -3.8161634e-05f, 0.056061f, -18.405588f, -5.2651521e-05f, \
+    0.074089691f, -23.628183f, -5.8078542e-05f, 0.085389733f, -27.690315f, 0.00010951702f, -0.065342776f, 6.1308513f, \
+    0.00050499977f, -0.51679134f, 128.91394f, 0.00029165749f, -0.29621205f, 73.250099f, 0.00020579231f, -0.20707859f, \
+    50.673676f, 0.00015568193f, -0.15482464f, 37.385078f, 0.00012126935f, -0.11875067f, 28.169374f, 9.5260621e-05f, \
+    -0.091317832f, 21.124533f, 7.4268501e-05f, -0.069015056f, 15.362417f, 5.6457673e-05f, -0.049928281f, 10.396295f, \
+    4.0712588e-05f, -0.032878734f, 5.9230714f, 2.6286154e-05f, -0.017054705f, 1.7292968f, 1.2642467e-05f, -0.0018385315f, \
+    -2.3546958f, -5.7699873e-07f, 0.013251303f, -6.4740882f, -1.3366552e-05f, 0.028425584f, -10.727261f, -2.4186515e-05f, \
+    0.042602692f, -14.943875f, -2.1163067e-05f, 0.045226432f, -16.785597f, 0.00018879279f, -0.1464337f, 26.898756f, \
+    0.00047695101f, -0.49037334f, 123.09762f, 0.00029240514f, -0.29882491f, 74.525963f, 0.0002124389f, -0.21553899f, \
+    53.345478f, 0.00016469235f, -0.16561007f, 40.6063f, 0.00013161659f, -0.13085632f, 31.704872f, 0.0001065568f, \
+    -0.10437315f, 24.890694f, 8.6348511e-05f, -0.082867794f, 19.326868f, 6.9252557e-05f, -0.064519353f, 14.548157f, \
+    5.4207034e-05f, -0.048201073f, 10.263539f, 4.0511502e-05f, -0.033147912f, 6.2709413f, 2.7691642e-05f, -0.01880561f, \
+    2.4168551f, 1.5489468e-05f, -0.0047968342f, -1.4170105f, 4.1069197e-06f, 0.0088878628f, -5.2774363f, -4.4252201e-06f, \
+    0.020673523f, -8.870183f, 3.647961e-06f, 0.018175008f, -9.4129448f, 0.0002413014f, -0.19948281f, 40.357147f, \
+    0.00045782173f, -0.47272709f, 119.35039f, 0.00029381353f, -0.30189222f, 75.841225f, 0.00021841933f, -0.22311842f, \
+    55.730564f, 0.00017245034f, -0.1749119f, 43.389153f, 0.00014030535f, -0.14105161f, 34.691357f, 0.00011585299f, \
+    -0.11515399f, 28.011745f, 9.6119511e-05f, -0.094114281f, 22.557882f, 7.9451813e-05f, -0.076195821f, 17.884291f, \
+    6.4835323e-05f, -0.060318187f, 13.710847f, 5.1602328e-05f, -0.045748651f, 9.8432207f, 3.931042e-05f, -0.031964984f, \
+    6.1358376f, 2.7749013e-05f, -0.018637974f, 2.4826238f, 1.7213828e-05f, -0.0058525503f, -1.1393002f, 9.9744293e-06f, \
+    0.0045832475f, -4.3783855f, 2.0785306e-05f, -0.00064810592f, -4.2346749f, 0.0002792695f, -0.23730402f, 49.85334f, \
+    0.00044570872f, -0.46209857f, 117.30039f, 0.00029663474f, -0.30630654f, 77.460464f, 0.00022475254f, -0.23097417f, \
+    58.156925f, 0.00018010268f, -0.18402088f, 46.095924f, 0.00014859092f, -0.15074408f, 37.52235f, 0.0001245038f, \
+    -0.125176f, 30.910425f, 0.00010502078f, -0.10436247f, 25.503199f, 8.8557419e-05f, -0.086633727f, 20.87077f, \
+    7.4136449e-05f, -0.070945755f, 16.741545f, 6.1115148e-05f, -0.056590628f, 12.927166f, 4.9071492e-05f, -0.043066658f, \
+    9.2871971f, 3.7814341e-05f, -0.030064123f, 5.72054f, 2.7664235e-05f, -0.017691372f, 2.2101393f, 2.0946984e-05f, \
+    -0.0078031658f, -0.88228148f, 3.2782384e-05f, -0.014010177f, -0.49875778f, 0.00031006627f, -0.26746854f, 57.329628f, \
+    0.00043962273f, -0.45759845f, 116.76763f, 0.00030139627f, -0.31269038f, 79.567284f, 0.0002321151f, -0.23987244f, \
+    60.841106f, 0.00018838194f, -0.19375914f, 48.956707f, 0.00015725267f, -0.16080506f, 40.440685f, 0.00013333764f, \
+    -0.13536324f, 33.843643f, 0.0001139331f, -0.1145931f, 28.434984f, 9.7503886e-05f, -0.096872047f, 23.795456f, \
+    8.3096194e-05f, -0.081178233f, 19.658384f, 7.0079732e-05f, -0.066815525f, 15.838097f, 5.8038968e-05f, -0.053288639f, \
+    12.195745f, 4.6781901e-05f, -0.040286973f, 8.6301832f, 3.6608228e-05f, -0.027896361f, 5.118793f, 2.9764105e-05f, \
+    -0.017881237f, 1.9993407f, 4.1229385e-05f, -0.02363956f, 2.2626064f, 0.00033827883f, -0.29460025f, 63.952442f, \
+    0.00043922561f, -0.45897868f, 117.7237f, 0.00030864286f, -0.3216722f, 82.342804f, 0.00024112497f, -0.25050798f, \
+    63.977913f, 0.00019792255f, -0.20483522f, 52.168766f, 0.00016693979f, -0.17195748f, 43.64703f, 0.00014302391f, \
+    -0.14645973f, 37.017532f, 0.00012355229f, -0.12557854f, 31.566902f, 0.00010701964f, -0.10771828f, 26.881414f, \
+    9.2481183e-05f, -0.091864251f, 22.695454f, 7.93047e-05f, -0.077317059f, 18.822121f, 6.7063156e-05f, -0.063569069f, \
+    15.119321f, 5.5538116e-05f, -0.05028246f, 11.479166f, 4.4964541e-05f, -0.037476335f, 7.8625126f, 3.7397287e-05f, \
+    -0.026713459f, 4.5558629f, 4.7229219e-05f, -0.030733954f, 4.3736277f, 0.00036705742f, -0.32179463f, 70.48571f, \
+    0.00044476677f, -0.46659368f, 120.29105f, 0.00031909262f, -0.33406255f, 86.01535f, 0.00025250757f, -0.26368958f, \
+    67.79213f, 0.00020943482f, -0.21803822f, 55.950588f, 0.00017835537f, -0.18498115f, 47.356926f, 0.00015426776f, \
+    -0.15924686f, 40.647854f, 0.00013459389f, -0.13811094f, 35.117496f, 0.00011783802f, -0.11998356f, 30.352222f, \
+    0.00010304966f, -0.10384163f, 26.083424f, 8.9580019e-05f, -0.088967003f, 22.118935f, 7.6971592e-05f, -0.074819662f, \
+    18.308165f, 6.4949243e-05f, -0.061002929f, 14.528293f, 5.362869e-05f, -0.047413096f, 10.7094f, 4.4752225e-05f, \
+    -0.035289377f, 7.0566015f, 5.1670388e-05f, -0.036261596f, 6.0975647f, 0.00039917996f, -0.35169187f, 77.562096f, \
+    0.00045719996f, -0.48154357f, 124.7869f, 0.00033382705f, -0.35106552f, 90.919014f, 0.00026727372f, -0.28053734f, \
+    72.592979f, 0.00022387828f, -0.23442994f, 60.59491f, 0.00019243039f, -0.2009057f, 51.854115f, 0.00016798834f, \
+    -0.17474069f, 45.014523f, 0.00014797745f, -0.15320641f, 39.366611f, 0.00013088869f, -0.13469474f, 34.490547f, \
+    0.00011574979f, -0.11815699f, 30.110235f, 0.00010188013f, -0.10284009f, 26.023941f, 8.8772133e-05f, -0.088150725f, \
+    22.067068f, 7.6061668e-05f, -0.073599167f, 18.092886f, 6.3680091e-05f, -0.058890875f, 13.983105f, 5.2900483e-05f, \
+    -0.044781014f, 9.8209229f, 5.5468499e-05f, -0.041226119f, 7.7090211f, 0.00043799623f, -0.38738233f, 85.901672f, \
+    0.00047857472f, -0.50611109f, 131.84488f, 0.00035463055f, -0.37465289f, 97.596344f, 0.00028701723f, -0.30281076f, \
+    78.86422f, 0.00024274047f, -0.25565255f, 66.553314f, 0.00021059607f, -0.2213112f, 57.573242f, 0.00018559166f, \
+    -0.19449359f, 50.544659f, 0.00016510501f, -0.17241293f, 44.740181f, 0.00014758545f, -0.15341246f, 39.72578f, \
+    0.0001320195f, -0.1363972f, 35.212368f, 0.00011767751f, -0.12056053f, 30.983679f, 0.00010398072f, -0.10523317f, \
+    26.855038f, 9.0440866e-05f, -0.089794733f, 22.645811f, 7.6730306e-05f, -0.073680758f, 18.168573f, 6.3449676e-05f, \
+    -0.056950595f, 13.33007f, 5.993692e-05f, -0.047072098f, 9.6044512f, 0.00048879365f, -0.43365791f, 96.601578f, \
+    0.00051304483f, -0.5448693f, 142.71745f, 0.00038473328f, -0.40838042f, 107.0215f, 0.00031455001f, -0.33360779f, \
+    87.455696f, 0.00026862664f, -0.28457832f, 74.614624f, 0.00023535789f, -0.24896142f, 65.273918f, 0.00020954668f, \
+    -0.22122994f, 57.98745f, 0.00018845116f, -0.19846156f, 51.989487f, 0.00017043944f, -0.17890833f, 46.820473f, \
+    0.00015443109f, -0.16140109f, 42.170856f, 0.00013962599f, -0.1450565f, 37.803581f, 0.00012534951f, -0.12910241f, \
+    33.506618f, 0.00011094919f, -0.11274434f, 29.053707f, 9.5750293e-05f, -0.095053248f, 24.162996f, 7.9419682e-05f, \
+    -0.075115807f, 18.49214f, 6.7678418e-05f, -0.056661941f, 12.568719f, 0.00056201429f, -0.49990654f, 111.7933f, \
+    0.00056965172f, -0.60772717f, 160.10419f, 0.00043074324f, -0.45950887f, 121.17956f, 0.00035554037f, -0.37916714f, \
+    100.07708f, 0.00030678589f, -0.32699114f, 86.366341f, 0.00027179511f, -0.28945723f, 76.495094f, 0.00024490908f, \
+    -0.26052749f, 68.876648f, 0.00022314832f, -0.23701654f, 62.672863f, 0.00020473739f, -0.21701793f, 57.380608f, \
+    0.00018849141f, -0.19924769f, 52.658916f, 0.00017351222f, -0.18271554f, 48.241741f, 0.00015900037f, -0.16651459f, \
+    43.880943f, 0.0001440925f, -0.14962499f, 39.290512f, 0.00012765874f, -0.13063487f, 34.061947f, 0.0001080856f, \
+    -0.10728424f, 27.503492f, 8.5615218e-05f, -0.077603646f, 18.685358f, 0.00068422919f, -0.60994142f, 136.86504f, \
+    0.00067186792f, -0.72036028f, 190.98462f, 0.00050898571f, -0.54596043f, 144.96585f, 0.00042386792f, -0.45475838f, \
+    120.911f, 0.00037015497f, -0.39714226f, 105.71941f, 0.00033261167f, -0.35680613f, 95.085701f, 0.00030458436f, \
+    -0.32662463f, 87.128143f, 0.00028262741f, -0.30290231f, 80.86998f, 0.00026471869f, -0.28346261f, 75.734596f, \
+    0.00024952609f, -0.26686046f, 71.33725f, 0.00023604248f, -0.25198692f, 67.379745f, 0.00022334703f, -0.23780379f, \
+    63.578568f, 0.00021035961f, -0.2230579f, 59.58527f, 0.00019541674f, -0.20576552f, 54.839115f, 0.00017519722f, \
+    -0.18184666f, 48.167744f, 0.00014148664f, -0.1404144f, 36.319599f, 0.00090538705f, -0.80637664f, 181.09407f, \
+    0.00090538705f, -0.9764415f, 260.80032f, 0.00067670282f, -0.73054755f, 195.52893f, 0.00056781812f, -0.61348826f, \
+    164.50169f, 0.00050459936f, -0.54555106f, 146.5376f, 0.00046445281f, -0.50243741f, 135.17917f, 0.000438263f, \
+    -0.47434676f, 127.82408f, 0.00042175304f, -0.45668378f, 123.25453f, 0.00041285518f, -0.44723028f, 120.88586f, \
+    0.00041077126f, -0.4451361f, 120.49918f, 0.00041569368f, -0.45062065f, 122.16365f, 0.00042895321f, -0.46513599f, \
+    126.28307f, 0.00045376891f, -0.49218214f, 133.82013f, 0.00049755489f, -0.53981179f, 146.98244f, 0.00058022945f, \
+    -0.62964982f, 171.69067f, 0.00078174035f, -0.84846866f, 231.68617f, 8.108357e-05f, 0.021109534f, 7.9468799f, \
+    -0.00090538705f, 0.96863842f, -287.59192f, -0.00090538705f, 0.96561706f, -286.02911f, -0.00090538705f, 0.96234024f, \
+    -284.32986f, -0.00090538705f, 0.95888251f, -282.55267f, -0.00090538705f, 0.95503211f, -280.54785f, -0.00090538705f, \
+    0.95086318f, -278.37317f, -0.00090538705f, 0.94635171f, -276.01904f, -0.00090538705f, 0.94150692f, -273.48367f, \
+    -0.00090538705f, 0.93630749f, -270.75861f, -0.00090538705f, 0.93084687f, -267.89056f, -0.00090538705f, 0.92502773f, \
+    -264.83267f, -0.00090538705f, 0.91893965f, -261.63364f, -0.00090538705f, 0.91265696f, -258.32495f, -0.00090538705f, \
+    0.90617812f, -254.91963f, -0.00090538705f, 0.89970952f, -251.51706f, -0.00090538705f, 0.89323294f, -248.09943f, \
+    -0.00090538705f, 0.97197533f, -289.63052f, -0.00090538705f, 0.96898961f, -288.08893f, -0.00090538705f, 0.96572572f, \
+    -286.39853f, -0.00090538705f, 0.96228296f, -284.62988f, -0.00090538705f, 0.95842022f, -282.61951f, -0.00090538705f, \
+    0.95420456f, -280.42365f, -0.00090538705f, 0.94963229f, -278.03427f, -0.00090538705f, 0.94466156f, -275.43161f, \
+    -0.00090538705f, 0.93932813f, -272.63538f, -0.00090538705f, 0.93365616f, -269.65851f, -0.00090538705f, 0.92759085f, \
+    -266.46933f, -0.00090538705f, 0.92121875f, -263.11487f, -0.00090538705f, 0.91460276f, -259.6283f, -0.00090538705f, \
+    0.90777028f, -256.03278f, -0.00090538705f, 0.90092391f, -252.4257f, -0.00090538705f, 0.8940596f, -248.80208f, \
+    -0.00090538705f, 0.97552216f, -291.80051f, -0.00090538705f, 0.97257429f, -290.28174f, -0.00090538705f, 0.96936476f, \
+    -288.62265f, -0.00090538705f, 0.96594471f, -286.86725f, -0.00090538705f, 0.96199274f, -284.79758f, -0.00090538705f, \
+    0.95785296f, -282.65552f, -0.00090538705f, 0.95323497f, -280.23911f, -0.00090538705f, 0.94816029f, -277.58368f, \
+    -0.00090538705f, 0.94269729f, -274.71817f, -0.00090538705f, 0.93680894f, -271.62506f, -0.00090538705f, 0.93048573f, \
+    -268.29755f, -0.00090538705f, 0.92379898f, -264.77444f, -0.00090538705f, 0.91677392f, -261.0744f, -0.00090538705f, \
+    0.90958399f, -257.28009f, -0.00090538705f, 0.90232235f, -253.44896f, -0.00090538705f, 0.89503032f, -249.59595f, \
+    -0.00090538705f, 0.97927403f, -294.10132f, -0.00090538705f, 0.97641242f, -292.63235f, -0.00090538705f, 0.97326458f, \
+    -291.00912f, -0.00090538705f, 0.96979588f, -289.21323f, -0.00090538705f, 0.96597028f, -287.22931f, -0.00090538705f, \
+    0.96183711f, -285.08823f, -0.00090538705f, 0.95717919f, -282.65353f, -0.00090538705f, 0.95204788f, -279.96756f, \
+    -0.00090538705f, 0.94643468f, -277.02048f, -0.00090538705f, 0.94034749f, -273.81982f, -0.00090538705f, 0.93376589f, \
+    -270.35028f, -0.00090538705f, 0.92674214f, -266.64566f, -0.00090538705f, 0.91932428f, -262.7352f, -0.00090538705f, \
+    0.91169924f, -258.70633f, -0.00090538705f, 0.90394574f, -254.60945f, -0.00090538705f, 0.89617318f, -250.49739f, \
+    -0.00090538705f, 0.98327547f, -296.55978f, -0.00090538705f, 0.98050517f, -295.14423f, -0.00090538705f, 0.9774422f, \
+    -293.57034f, -0.00090538705f, 0.97404772f, -291.81723f, -0.00090538705f, 0.97036493f, -289.92322f, -0.00090538705f, \
+    0.96617293f, -287.73978f, -0.00090538705f, 0.96150565f, -285.3027f, -0.00090538705f, 0.95633245f, -282.59103f, \
+    -0.00090538705f, 0.95060962f, -279.58386f, -0.00090538705f, 0.94434267f, -276.28271f, -0.00090538705f, 0.93748474f, \
+    -272.6655f, -0.00090538705f, 0.93010592f, -268.76828f, -0.00090538705f, 0.92228681f, -264.63553f, -0.00090538705f, \
+    0.9141385f, -260.32587f, -0.00090538705f, 0.90584731f, -255.93617f, -0.00090538705f, 0.76914877f, -230.593f, \
+    -0.00090538705f, 0.98752159f, -299.17603f, -0.00090538705f, 0.98486608f, -297.82788f, -0.00090538705f, 0.93590266f, \
+    -292.10535f, -0.00090538705f, 0.90322584f, -287.54898f, -0.00090538705f, 0.87523228f, -277.55038f, -0.00090538705f, \
+    0.83770627f, -259.66803f, -0.00090538705f, 0.84588516f, -267.32092f, -0.00090538705f, 0.81596917f, -251.37778f, \
+    -0.00090538705f, 0.83311492f, -261.38712f, -0.00090538705f, 0.82622325f, -258.15155f, -0.00090538705f, 0.79810965f, \
+    -242.74496f, -0.00090538705f, 0.79252392f, -239.75993f, -0.00090538705f, 0.78809774f, -236.98593f, -0.00090538705f, \
+    0.76023608f, -232.17688f, -0.00090538705f, 0.65981114f, -197.71185f, -0.00090538705f, 0.63184822f, -192.43199f, \
+    -0.00090538705f, 0.85476464f, -267.89331f, -0.00090538705f, 0.83636397f, -261.67697f, -0.00090538705f, 0.84587252f, \
+    -270.40958f, -0.00090538705f, 0.8348344f, -266.29654f, -0.00090538705f, 0.80460101f, -251.34682f, -0.00090538705f, \
+    0.82003629f, -260.24997f, -0.00090538705f, 0.78764468f, -244.85667f, -0.00090538705f, 0.80416048f, -254.49094f, \
+    -0.00090538705f, 0.79898381f, -251.94347f, -0.00090538705f, 0.76901329f, -236.50409f, -0.00090538705f, 0.76336992f, \
+    -233.65852f, -0.00090538705f, 0.7579326f, -230.70459f, -0.00090538705f, 0.68864089f, -209.85626f, -0.00090538705f, \
+    0.62913698f, -191.54721f, -0.00090538705f, 0.62221295f, -189.27441f, -0.00090538705f, 0.62013936f, -188.23466f, \
+    -0.00090538705f, 0.8080045f, -254.45619f, -0.00090538705f, 0.78929257f, -246.66275f, -0.00090538705f, 0.81517804f, \
+    -261.78616f, -0.00090538705f, 0.8066051f, -258.5614f, -0.00090538705f, 0.77933139f, -244.85597f, -0.00090538705f, \
+    0.77079964f, -241.70604f, -0.00090538705f, 0.77664065f, -245.29343f, -0.00090538705f, 0.75700486f, -236.14098f, \
+    -0.00090538705f, 0.77613282f, -246.15498f, -0.00090538705f, 0.77111036f, -243.59081f, -0.00090538705f, 0.76584083f, \
+    -240.82932f, -0.00090538705f, 0.67080629f, -207.2934f, -0.00090538705f, 0.66648328f, -209.93153f, -0.00090538705f, \
+    0.64879137f, -201.50986f, -0.00090538705f, 0.64852452f, -201.55606f, -0.00090538705f, 0.65233201f, -203.81891f, \
+    -0.00090538705f, 0.78221071f, -247.74518f, -0.00090538705f, 0.77314335f, -244.66812f, -0.00090538705f, 0.76865172f, \
+    -242.90628f, -0.00090538705f, 0.76184314f, -240.42038f, -0.00090538705f, 0.75497538f, -237.86215f, -0.00090538705f, \
+    0.75002223f, -235.80899f, -0.00090538705f, 0.74663037f, -235.08865f, -0.00090538705f, 0.73980176f, -232.32678f, \
+    -0.00090538705f, 0.75947392f, -242.39186f, -0.00090538705f, 0.73004496f, -227.54799f, -0.00090538705f, 0.6947214f, \
+    -221.62442f, -0.00090538705f, 0.66953123f, -211.3976f, -0.00090538705f, 0.66540951f, -209.47928f, -0.00090538705f, \
+    0.67513132f, -214.14207f, -0.00090538705f, 0.68340194f, -218.7794f, -0.00090538705f, 0.67089492f, -217.71565f, \
+    -0.00090538705f, 0.75761658f, -239.78117f, -0.00090538705f, 0.75134182f, -237.61723f, -0.00090538705f, 0.74493617f, \
+    -235.37849f, -0.00090538705f, 0.74604362f, -236.97018f, -0.00090538705f, 0.74032336f, -234.80492f, -0.00090538705f, \
+    0.73399359f, -232.40201f, -0.00090538705f, 0.75279516f, -242.77423f, -0.00090538705f, 0.74658865f, -240.14484f, \
+    -0.00090538705f, 0.72085875f, -227.26437f, -0.00090538705f, 0.6681599f, -209.72641f, -0.00090538705f, 0.68266076f, \
+    -217.55009f, -0.00090538705f, 0.68248385f, -217.46286f, -0.00090538705f, 0.69693673f, -224.75214f, -0.00090538705f, \
+    0.70382351f, -230.30202f, -0.00087436044f, 0.65992457f, -220.53387f, -0.00078316237f, 0.55476093f, -190.79893f, \
+    -0.00090538705f, 0.75314897f, -241.05771f, -0.00090538705f, 0.74683195f, -238.90266f, -0.00090538705f, 0.74178088f, \
+    -237.07509f, -0.00090538705f, 0.73455667f, -234.60004f, -0.00090538705f, 0.72969538f, -232.73065f, -0.00090538705f, \
+    0.72056168f, -229.87546f, -0.00090538705f, 0.71593434f, -227.93629f, -0.00090538705f, 0.71019518f, -225.58084f, \
+    -0.00090538705f, 0.70977968f, -230.0591f, -0.00090538705f, 0.69049609f, -221.42357f, -0.00090538705f, 0.69490576f, \
+    -223.5717f, -0.00090538705f, 0.71489215f, -233.38622f, -0.00090538705f, 0.72264344f, -240.51653f, -0.00085623498f, \
+    0.65973067f, -225.72212f, -0.00075882132f, 0.55061692f, -195.18013f, -0.00066680799f, 0.4454326f, -165.39861f, \
+    -0.00090538705f, 0.7415216f, -238.84399f, -0.00090538705f, 0.73429775f, -236.49329f, -0.00090538705f, 0.72989357f, \
+    -234.9196f, -0.00090538705f, 0.72400701f, -232.87885f, -0.00090538705f, 0.7082842f, -226.55717f, -0.00090538705f, \
+    0.71271628f, -228.77934f, -0.00090538705f, 0.70552641f, -226.19316f, -0.00090538705f, 0.69939983f, -224.07648f, \
+    -0.00090538705f, 0.68074524f, -216.68542f, -0.00090538705f, 0.70695597f, -229.55443f, -0.00090538705f, 0.72524548f, \
+    -238.79323f, -0.00090538705f, 0.73821115f, -248.60983f, -0.00085108005f, 0.67191166f, -233.66862f, -0.00074754737f, \
+    0.55725992f, -201.96854f, -0.00065003085f, 0.44816059f, -171.40184f, -0.00055830053f, 0.34271902f, -141.53218f, \
+    -0.00090538705f, 0.72920728f, -236.52191f, -0.00090538705f, 0.74041224f, -242.59805f, -0.00090538705f, 0.73234248f, \
+    -240.19345f, -0.00090538705f, 0.72726172f, -238.40161f, -0.00090538705f, 0.72047251f, -235.36397f, -0.00090538705f, \
+    0.71751714f, -234.33748f, -0.00090538705f, 0.70372999f, -227.23398f, -0.00090538705f, 0.69686884f, -224.56668f, \
+    -0.00090538705f, 0.7107805f, -231.31065f, -0.00090538705f, 0.73567945f, -243.8905f, -0.00090538705f, 0.75130594f, \
+    -254.53716f, -0.00085991994f, 0.69708604f, -244.56152f, -0.00074958848f, 0.57563168f, -211.36197f, -0.00064565329f, \
+    0.46123096f, -179.68613f, -0.00054929883f, 0.35198912f, -149.08879f, -0.00045725293f, 0.24684468f, -119.2281f, \
+    -0.00090538705f, 0.72139549f, -235.60403f, -0.00090538705f, 0.71019542f, -230.44994f, -0.00090538705f, 0.71674293f, \
+    -233.67798f, -0.00090538705f, 0.71625876f, -233.61928f, -0.00090538705f, 0.70453417f, -228.16611f, -0.00090538705f, \
+    0.72929198f, -239.78911f, -0.00090538705f, 0.72718287f, -239.12212f, -0.00090538705f, 0.71893221f, -235.34892f, \
+    -0.00090538705f, 0.73708022f, -244.43469f, -0.00090538705f, 0.76217908f, -259.31888f, -0.00088596658f, 0.73630536f, \
+    -258.77008f, -0.0007660698f, 0.60669231f, -223.64738f, -0.00065526075f, 0.48551375f, -190.50101f, -0.00055119529f, \
+    0.371445f, -158.83525f, -0.00045487628f, 0.26264286f, -128.29063f, -0.00041583658f, 0.21413872f, -113.78338f, \
+    -0.00090538705f, 0.72411919f, -237.67093f, -0.00090538705f, 0.71287364f, -232.32179f, -0.00090538705f, 0.71393633f, \
+    -232.85765f, -0.00090538705f, 0.7383588f, -245.00313f, -0.00090538705f, 0.7113083f, -231.49263f, -0.00090538705f, \
+    0.71540523f, -233.43459f, -0.00090538705f, 0.72107959f, -236.12735f, -0.00090538705f, 0.74265969f, -247.28798f, \
+    -0.00090538705f, 0.76396108f, -259.09418f, -0.00090538705f, 0.77378148f, -271.78714f, -0.00079218915f, 0.6491701f, \
+    -239.37767f, -0.00067671476f, 0.52220094f, -203.99553f, -0.00056599593f, 0.40157261f, -170.94435f, -0.00046445511f, \
+    0.28784314f, -139.43211f, -0.0004228676f, 0.24017136f, -125.7628f, -0.00031902088f, 0.12231418f, -92.282883f, \
+    -0.00090538705f, 0.72203052f, -236.6739f, -0.00090538705f, 0.71779519f, -234.675f, -0.00090538705f, 0.7196734f, \
+    -235.5992f, -0.00090538705f, 0.72518545f, -237.76707f, -0.00090538705f, 0.72533923f, -238.291f, -0.00090538705f, \
+    0.72716928f, -239.28795f, -0.00090538705f, 0.73574495f, -243.7009f, -0.00090538705f, 0.76862866f, -260.98761f, \
+    -0.00090538705f, 0.78386551f, -273.21326f, -0.00083616661f, 0.70716506f, -257.85672f, -0.0007074587f, 0.56974435f, \
+    -220.78639f, -0.00059008953f, 0.44176856f, -186.18379f, -0.00048450922f, 0.32360572f, -152.76579f, -0.00044384506f, \
+    0.27938488f, -140.91263f, -0.00033640635f, 0.15846288f, -106.75452f, -0.00021865178f, 0.023896566f, -68.835915f, \
+    -0.00090538705f, 0.97028583f, -278.0043f, -0.00090538705f, 0.9670977f, -276.52289f, -0.00090538705f, 0.96365762f, \
+    -274.90918f, -0.00090538705f, 0.96004611f, -273.22653f, -0.00090538705f, 0.95605356f, -271.32001f, -0.00090538705f, \
+    0.95176148f, -269.25235f, -0.00090538705f, 0.94715214f, -267.01718f, -0.00090538705f, 0.94224179f, -264.61191f, \
+    -0.00090538705f, 0.93701488f, -262.03125f, -0.00090538705f, 0.93156916f, -259.31992f, -0.00090538705f, 0.92581064f, \
+    -256.43634f, -0.00090538705f, 0.91982961f, -253.42757f, -0.00090538705f, 0.91369671f, -250.31949f, -0.00090538705f, \
+    0.90740746f, -247.12856f, -0.00090538705f, 0.90115607f, -243.94174f, -0.00090538705f, 0.8949185f, -240.73662f, \
+    -0.00090538705f, 0.97373796f, -280.02292f, -0.00090538705f, 0.97058487f, -278.57062f, -0.00090538705f, 0.96715301f, \
+    -276.97321f, -0.00090538705f, 0.96354884f, -275.30438f, -0.00090538705f, 0.95953256f, -273.39755f, -0.00090538705f, \
+    0.9551785f, -271.31403f, -0.00090538705f, 0.95049101f, -269.04559f, -0.00090538705f, 0.94543481f, -266.5759f, \
+    -0.00090538705f, 0.94005388f, -263.92606f, -0.00090538705f, 0.93437809f, -261.11005f, -0.00090538705f, 0.92835706f, \
+    -258.09839f, -0.00090538705f, 0.92207915f, -254.93681f, -0.00090538705f, 0.91560513f, -251.65654f, -0.00090538705f, \
+    0.90895891f, -248.28143f, -0.00090538705f, 0.90233088f, -244.89688f, -0.00090538705f, 0.89570993f, -241.49431f, \
+    -0.00090538705f, 0.97739583f, -282.15335f, -0.00090538705f, 0.97428292f, -280.73416f, -0.00090538705f, 0.9709056f, \
+    -279.17691f, -0.00090538705f, 0.96731913f, -277.52893f, -0.00090538705f, 0.96320295f, -275.56891f, -0.00090538705f, \
+    0.95891339f, -273.54639f, -0.00090538705f, 0.95416349f, -271.25473f, -0.00090538705f, 0.94898289f, -268.73724f, \
+    -0.00090538705f, 0.94345075f, -266.02106f, -0.00090538705f, 0.93753707f, -263.09225f, -0.00090538705f, 0.93123871f, \
+    -259.94583f, -0.00090538705f, 0.92463082f, -256.62027f, -0.00090538705f, 0.91773897f, -253.13567f, -0.00090538705f, \
+    0.91072947f, -249.56549f, -0.00090538705f, 0.90368646f, -245.96465f, -0.00090538705f, 0.89664209f, -242.34151f, \
+    -0.00090538705f, 0.98124832f, -284.39001f, -0.00090538705f, 0.97822976f, -283.03204f, -0.00090538705f, 0.97491789f, \
+    -281.52216f, -0.00090538705f, 0.97128123f, -279.84259f, -0.00090538705f, 0.96728742f, -277.97989f, -0.00090538705f, \
+    0.96299452f, -275.96539f, -0.00090538705f, 0.95818895f, -273.66373f, -0.00090538705f, 0.9529323f, -271.12112f, \
+    -0.00090538705f, 0.94722688f, -268.3284f, -0.00090538705f, 0.94109052f, -265.29626f, -0.00090538705f, 0.93451113f, \
+    -262.01102f, -0.00090538705f, 0.92754734f, -258.50919f, -0.00090538705f, 0.92024946f, -254.8208f, -0.00090538705f, \
+    0.91279811f, -251.0237f, -0.00090538705f, 0.9052633f, -247.16653f, -0.00090538705f, 0.89774257f, -243.29398f, \
+    -0.00090538705f, 0.98533374f, -286.75186f, -0.00090538705f, 0.98241872f, -285.46121f, -0.00090538705f, 0.97920084f, \
+    -284.01456f, -0.00090538705f, 0.97564328f, -282.39136f, -0.00090538705f, 0.97179341f, -280.63135f, -0.00090538705f, \
+    0.96743453f, -278.58566f, -0.00090538705f, 0.96260732f, -276.29276f, -0.00090538705f, 0.95729142f, -273.73215f, \
+    -0.00090538705f, 0.95145357f, -270.88641f, -0.00090538705f, 0.94511169f, -267.75885f, -0.00090538705f, 0.93823004f, \
+    -264.33249f, -0.00090538705f, 0.93088841f, -260.64395f, -0.00090538705f, 0.92317164f, -256.73801f, -0.00090538705f, \
+    0.91518825f, -252.67035f, -0.00090538705f, 0.90711403f, -248.53004f, -0.00086755707f, 0.86110437f, -234.80273f, \
+    -0.00090538705f, 0.98963666f, -289.23099f, -0.00090538705f, 0.9868539f, -288.02344f, -0.00090538705f, 0.98376238f, \
+    -286.6579f, -0.00090538705f, 0.98031855f, -285.11459f, -0.00090538705f, 0.97656095f, -283.4144f, -0.00090538705f, \
+    0.97227067f, -281.42264f, -0.00090538705f, 0.96747279f, -279.16345f, -0.00090538705f, 0.96213096f, -276.60828f, \
+    -0.00090538705f, 0.9562183f, -273.73999f, -0.00090538705f, 0.94966143f, -270.52005f, -0.00090538705f, 0.94248599f, \
+    -266.95728f, -0.00090538705f, 0.93475133f, -263.07397f, -0.00090538705f, 0.92653316f, -258.91483f, -0.00087480521f, \
+    0.8868385f, -246.55867f, -0.00080427428f, 0.807024f, -224.03529f, -0.00074205908f, 0.73651069f, -204.10387f, \
+    -0.00090538705f, 0.99415475f, -291.82578f, -0.00090538705f, 0.99153537f, -290.71832f, -0.00090538705f, 0.98860598f, \
+    -289.45367f, -0.00090538705f, 0.98531997f, -288.00616f, -0.00090538705f, 0.98162419f, -286.34622f, -0.00090538705f, \
+    0.97745782f, -284.44333f, -0.00090538705f, 0.97281492f, -282.29517f, -0.00090538705f, 0.96750879f, -279.77802f, \
+    -0.00090538705f, 0.96154082f, -276.90506f, -0.00090538705f, 0.95482481f, -273.62363f, -0.00090538705f, 0.94739771f, \
+    -269.94458f, -0.00090538705f, 0.9392513f, -265.8627f, -0.00083428889f, 0.85717177f, -242.34311f, -0.00075708161f, \
+    0.76966095f, -217.61197f, -0.0006893893f, 0.6928193f, -195.86143f, -0.0006297066f, 0.62495834f, -176.61945f, \
+    -0.00090538705f, 0.9988817f, -294.53235f, -0.00090538705f, 0.99645829f, -293.54291f, -0.00090538705f, 0.99372959f, \
+    -292.40027f, -0.00090538705f, 0.99064535f, -291.07693f, -0.00090538705f, 0.98714626f, -289.54028f, -0.00090538705f, \
+    0.98316216f, -287.75436f, -0.00090538705f, 0.9786706f, -285.70514f, -0.00090538705f, 0.97346413f, -283.26724f, \
+    -0.00090538705f, 0.967511f, -280.42813f, -0.00090538705f, 0.96074271f, -277.14157f, -0.00090538705f, 0.95308024f, \
+    -273.36273f, -0.00081116852f, 0.8459239f, -243.00706f, -0.00072577427f, 0.74899828f, -215.58099f, -0.0006514141f, \
+    0.66447455f, -191.62778f, -0.00058623997f, 0.59027481f, -170.56517f, -0.00052880042f, 0.5247674f, -151.93599f, \
+    -0.00090538705f, 1.0038065f, -297.34442f, -0.00090538705f, 1.0016124f, -296.49112f, -0.00090538705f, 0.99912459f, \
+    -295.49237f, -0.00090538705f, 0.99629039f, -294.31976f, -0.00090538705f, 0.99304479f, -292.94049f, -0.00090538705f, \
+    0.98936814f, -291.34314f, -0.00090538705f, 0.98505026f, -289.4028f, -0.00090538705f, 0.98004425f, -287.0979f, \
+    -0.00090538705f, 0.97422945f, -284.35922f, -0.00090538705f, 0.96748209f, -281.11417f, -0.000806058f, 0.85399145f, \
+    -248.85396f, -0.00071058318f, 0.74549085f, -218.11888f, -0.00062809454f, 0.65161878f, -191.48941f, -0.00055627979f, \
+    0.56976986f, -168.23381f, -0.00049335352f, 0.49793229f, -147.7872f, -0.00043791279f, 0.43452573f, -129.70589f, \
+    -0.00090538705f, 1.0089134f, -300.25311f, -0.00090538705f, 1.0069815f, -299.55371f, -0.00090538705f, 1.0047747f, \
+    -298.7207f, -0.00090538705f, 1.0022401f, -297.72574f, -0.00090538705f, 0.99931067f, -296.53494f, -0.00090538705f, \
+    0.99590909f, -295.09872f, -0.00090538705f, 0.99196494f, -293.39056f, -0.00090538705f, 0.9872734f, -291.28201f, \
+    -0.00090538705f, 0.98172909f, -288.71912f, -0.00082024164f, 0.88301694f, -260.39496f, -0.00071224733f, 0.76015395f, \
+    -225.55701f, -0.00061979162f, 0.65483135f, -195.65242f, -0.00053991977f, 0.56371319f, -169.74231f, -0.00047039409f, \
+    0.48427311f, -147.1158f, -0.00040948598f, 0.41455957f, -127.22385f, -0.00035583679f, 0.35303894f, -109.63508f, \
+    -0.00090538705f, 1.0141822f, -303.24704f, -0.00090538705f, 1.0125432f, -302.71817f, -0.00090538705f, 1.0106559f, \
+    -302.07166f, -0.00090538705f, 1.0084676f, -301.28192f, -0.00090538705f, 1.005918f, -300.31009f, -0.00090538705f, \
+    1.002921f, -299.11597f, -0.00090538705f, 0.99937207f, -297.64142f, -0.00090538705f, 0.99514902f, -295.81677f, \
+    -0.00085588451f, 0.93563426f, -278.42035f, -0.00073214015f, 0.79471201f, -238.42526f, -0.00062734279f, 0.67521995f, \
+    -204.46979f, -0.00053762476f, 0.57278293f, -175.32014f, -0.00046012254f, 0.48416185f, -150.0631f, -0.00039266667f, \
+    0.40690276f, -128.00688f, -0.00033358048f, 0.33910936f, -108.61699f, -0.00028154589f, 0.27929083f, -91.473328f, \
+    -0.00090538705f, 1.0195885f, -306.31265f, -0.00090538705f, 1.01827f, -305.96906f, -0.00090538705f, 1.0167367f, \
+    -305.52768f, -0.00090538705f, 1.0149406f, -304.96542f, -0.00090538705f, 1.0128253f, -304.24683f, -0.00090538705f, \
+    1.0103086f, -303.33368f, -0.00090538705f, 1.0073061f, -302.18082f, -0.00090538705f, 1.0036329f, -300.67975f, \
+    -0.00077247916f, 0.85184366f, -257.52307f, -0.00065218942f, 0.71457094f, -218.48528f, -0.00055030943f, 0.59815878f, \
+    -185.33698f, -0.00046308668f, 0.49835485f, -156.87698f, -0.00038774149f, 0.41200945f, -132.21574f, -0.00032216695f, \
+    0.33673522f, -110.67909f, -0.0002647342f, 0.27068654f, -91.745926f, -0.00021416236f, 0.21241206f, -75.006531f, \
+    -0.00090538705f, 1.0251045f, -309.43463f, -0.00090538705f, 1.0241296f, -309.28848f, -0.00090538705f, 1.0229797f, \
+    -309.06787f, -0.00090538705f, 1.0216146f, -308.75226f, -0.00090538705f, 1.0199816f, -308.31448f, -0.00090538705f, \
+    1.0180112f, -307.71881f, -0.00090538705f, 1.0156113f, -306.91333f, -0.00083667389f, 0.93558389f, -284.03537f, \
+    -0.00069658557f, 0.77559203f, -238.50372f, -0.00057946669f, 0.64167285f, -200.34651f, -0.00048026172f, 0.52808785f, \
+    -167.93988f, -0.00039532437f, 0.43069822f, -140.11287f, -0.00032195234f, 0.3464368f, -115.99778f, -0.00025809641f, \
+    0.27297771f, -94.936745f, -0.00020217182f, 0.20852216f, -76.421051f, -0.00015293203f, 0.15165533f, -60.050598f, \
+    -0.00090538705f, 1.0307003f, -312.59644f, -0.00090538705f, 1.0300866f, -312.65695f, -0.00090538705f, 1.0293592f, \
+    -312.67789f, -0.00090538705f, 1.0284365f, -312.61664f, -0.00090538705f, 1.027326f, -312.47903f, -0.00090538705f, \
+    1.0259584f, -312.22928f, -0.00090538705f, 1.0242455f, -311.82104f, -0.00076394033f, 0.86230886f, -265.70535f, \
+    -0.00062737433f, 0.70605016f, -221.15616f, -0.00051317888f, 0.57522607f, -183.81245f, -0.00041643792f, 0.46424776f, \
+    -152.09033f, -0.0003336035f, 0.36908188f, -124.84686f, -0.00026204501f, 0.28673774f, -101.23468f, -0.0001997667f, \
+    0.21494637f, -80.611031f, -0.00014522458f, 0.15195259f, -62.478706f, -9.7203869e-05f, 0.096375287f, -46.446541f, \
+    -0.00090538705f, 1.0363451f, -315.78104f, -0.00090538705f, 1.0361042f, -316.05414f, -0.00090538705f, 1.0357813f, \
+    -316.30634f, -0.00090538705f, 1.0353537f, -316.52753f, -0.00090538705f, 1.0347914f, -316.70352f, -0.00090538705f, \
+    1.0340539f, -316.81473f, -0.00085940387f, 0.98074055f, -301.84009f, -0.00069743244f, 0.79529846f, -248.93945f, \
+    -0.00056412996f, 0.64250213f, -205.30238f, -0.00045264116f, 0.51454645f, -168.7133f, -0.00035817965f, 0.40598193f, \
+    -137.62556f, -0.00027728899f, 0.31287324f, -110.92236f, -0.00020740503f, 0.23230085f, -87.775276f, -0.00014658173f, \
+    0.16204894f, -67.555656f, -9.3313036e-05f, 0.10040268f, -49.77702f, -4.6413665e-05f, 0.04601245f, -34.056503f, \
+    -0.00090538705f, 1.042008f, -318.97162f, -0.00090538705f, 1.0421455f, -319.45987f, -0.00090538705f, 1.0422508f, \
+    -319.95569f, -0.00090538705f, 1.0423112f, -320.4548f, -0.00090538705f, 1.04231f, -320.95056f, -0.00090538705f, \
+    1.0422237f, -321.43332f, -0.00079473673f, 0.91537064f, -285.42664f, -0.00063649914f, 0.73389989f, -233.57509f, \
+    -0.00050623214f, 0.58432716f, -190.78801f, -0.00039725934f, 0.45904034f, -154.90166f, -0.00030491533f, 0.35272002f, \
+    -124.40417f, -0.00022582903f, 0.26152247f, -98.203232f, -0.00015749827f, 0.1825946f, -75.488144f, -9.8023273e-05f, \
+    0.11377017f, -55.643406f, -4.5933353e-05f, 0.053372093f, -38.192558f, -7.0731218e-08f, 8.0046288e-05f, -22.760519f, \
+    -0.00090538705f, 0.97523135f, -267.87369f, -0.00090538705f, 0.9716959f, -266.06381f, -0.00090538705f, 0.96776557f, \
+    -264.04526f, -0.00090538705f, 0.96340716f, -261.80069f, -0.00090538705f, 0.95860124f, -259.31937f, -0.00087800768f, \
+    0.92448449f, -248.9827f, -0.0007859242f, 0.82271177f, -220.92857f, -0.00071198965f, 0.74097496f, -198.39197f, \
+    -0.00065126392f, 0.67381668f, -179.86848f, -0.00060048752f, 0.61763692f, -164.36603f, -0.00055741484f, 0.56995577f, \
+    -151.20148f, -0.00052044255f, 0.5290032f, -139.88733f, -0.00048839231f, 0.49347836f, -130.06544f, -0.00046037647f, \
+    0.46240166f, -121.46619f, -0.00043571243f, 0.43501991f, -113.88233f, -0.00041386552f, 0.41074336f, -107.15162f, \
+    -0.00090538705f, 0.97937512f, -270.15326f, -0.00090538705f, 0.97627413f, -268.58014f, -0.00090538705f, 0.97219443f, \
+    -266.4838f, -0.00090538705f, 0.96801937f, -264.34131f, -0.00090538705f, 0.9631775f, -261.84412f, -0.00079581805f, \
+    0.84162199f, -228.21341f, -0.00070923084f, 0.74558246f, -201.64761f, -0.00063968753f, 0.6684196f, -180.2964f, \
+    -0.00058256579f, 0.60501087f, -162.74329f, -0.00053481088f, 0.55197144f, -148.05261f, -0.00049431465f, 0.50696599f, \
+    -135.57904f, -0.00045957047f, 0.46832564f, -124.86148f, -0.00042946963f, 0.43482268f, -115.56088f, -0.00040317635f, \
+    0.4055317f, -107.42173f, -0.00038004786f, 0.37974113f, -100.2476f, -0.00035958012f, 0.35689312f, -93.884537f, \
+    -0.00090538705f, 0.98364848f, -272.50433f, -0.00090538705f, 0.98046374f, -270.88831f, -0.00090538705f, 0.97686583f, \
+    -269.05475f, -0.00090538705f, 0.9727841f, -266.9657f, -0.00082905474f, 0.88602674f, -242.46165f, -0.00072413863f, \
+    0.76931119f, -210.08127f, -0.00064226211f, 0.67819518f, -184.79591f, -0.00057648291f, 0.60496092f, -164.46466f, \
+    -0.00052244996f, 0.54477221f, -147.7464f, -0.00047728344f, 0.49442866f, -133.75389f, -0.00043899321f, 0.45171902f, \
+    -121.87429f, -0.00040615516f, 0.41506112f, -111.66922f, -0.00037772095f, 0.38329062f, -102.81617f, -0.00035289925f, \
+    0.35552865f, -95.071785f, -0.00033108093f, 0.33109891f, -88.248802f, -0.00031178852f, 0.30947131f, -82.200539f, \
+    -0.00090538705f, 0.98801476f, -274.9072f, -0.00090538705f, 0.98508179f, -273.42938f, -0.00090538705f, 0.98172736f, \
+    -271.7301f, -0.00089349487f, 0.96493661f, -266.24496f, -0.00076082809f, 0.81694877f, -225.07642f, -0.00066120131f, \
+    0.70578206f, -194.14456f, -0.00058340607f, 0.61893988f, -169.97258f, -0.00052088691f, 0.5491147f, -150.52792f, \
+    -0.00046952826f, 0.49171937f, -134.53514f, -0.0004266015f, 0.44371316f, -121.14901f, -0.00039021854f, 0.40299243f, \
+    -109.7849f, -0.00035902753f, 0.36805108f, -100.0244f, -0.00033203157f, 0.33777878f, -91.559113f, -0.00030847837f, \
+    0.31133771f, -84.156418f, -0.00028778828f, 0.28808248f, -77.637131f, -0.0002695068f, 0.26750702f, -71.860809f, \
+    -0.00090538705f, 0.99243349f, -277.33994f, -0.00090538705f, 0.98977607f, -276.01352f, -0.00090538705f, 0.98671889f, \
+    -274.47751f, -0.00082698412f, 0.89729947f, -249.14517f, -0.00070060685f, 0.75593734f, -209.71382f, -0.00060560659f, \
+    0.64963317f, -180.05347f, -0.00053138018f, 0.56653512f, -156.85844f, -0.0004717113f, 0.49969593f, -138.19165f, \
+    -0.00042268945f, 0.44474593f, -122.83501f, -0.00038171819f, 0.39878422f, -109.98015f, -0.00034699944f, 0.35980222f, \
+    -99.067459f, -0.00031724357f, 0.32635948f, -89.695755f, -0.00029149966f, 0.29739407f, -81.569328f, -0.0002690494f, \
+    0.27210388f, -74.46489f, -0.00024933906f, 0.24987075f, -68.210396f, -0.0002319342f, 0.23020971f, -62.670898f, \
+    -0.00090538705f, 0.99687958f, -279.78903f, -0.00090538705f, 0.99450356f, -278.61725f, -0.00090538705f, 0.9917869f, \
+    -277.26813f, -0.00076797878f, 0.83725232f, -233.95528f, -0.00064714957f, 0.70174557f, -196.06171f, -0.00055623119f, \
+    0.59973907f, -167.52696f, -0.00048515297f, 0.51994962f, -145.19664f, -0.00042799712f, 0.45574769f, -127.21794f, \
+    -0.00038103416f, 0.40295601f, -112.42366f, -0.00034178462f, 0.35879758f, -100.03814f, -0.00030852921f, 0.32134724f, \
+    -89.523743f, -0.00028003418f, 0.28922346f, -80.494797f, -0.00025538888f, 0.26140693f, -72.666756f, -0.00023390514f, \
+    0.23712724f, -65.824661f, -0.00021505215f, 0.21579033f, -59.802765f, -0.00019841333f, 0.19693002f, -54.471039f, \
+    -0.00090538705f, 1.0012786f, -282.21402f, -0.00090538705f, 0.99922884f, -281.22131f, -0.00087777723f, 0.9661907f, \
+    -271.54355f, -0.00071534951f, 0.78365678f, -220.38933f, -0.00059945387f, 0.65336603f, -183.86786f, -0.00051216525f, \
+    0.55518776f, -156.33734f, -0.00044388571f, 0.4783445f, -134.7782f, -0.0003889626f, 0.41648963f, -117.41277f, \
+    -0.00034382739f, 0.3656171f, -103.11928f, -0.00030610495f, 0.32306081f, -91.151375f, -0.00027414615f, 0.28696984f, \
+    -80.991013f, -0.0002467669f, 0.25601536f, -72.266396f, -0.00022309263f, 0.22921607f, -64.702972f, -0.00020246196f, \
+    0.20582989f, -58.093231f, -0.0001843646f, 0.18528438f, -52.277081f, -0.00016839987f, 0.16713005f, -47.128872f, \
+    -0.00090538705f, 1.0056336f, -284.61642f, -0.00090538705f, 1.0039048f, -283.80014f, -0.00082417723f, 0.91129017f, \
+    -257.56235f, -0.00066817849f, 0.73558736f, -208.21477f, -0.00055670179f, 0.60997635f, -172.9263f, -0.00047266425f, \
+    0.51523262f, -146.29811f, -0.00040689018f, 0.44103113f, -125.43147f, -0.00035396457f, 0.38127935f, -108.61637f, \
+    -0.00031046337f, 0.33212525f, -94.771927f, -0.00027410459f, 0.29100186f, -83.178055f, -0.00024330246f, 0.25612548f, \
+    -73.33448f, -0.00021691738f, 0.22621451f, -64.881844f, -0.00019410712f, 0.20032185f, -57.554626f, -0.00017423446f, \
+    0.17773096f, -51.152008f, -0.00015680749f, 0.15788879f, -45.519005f, -0.00014143984f, 0.14036097f, -40.533924f, \
+    -0.00090538705f, 1.0099044f, -286.9744f, -0.00090538705f, 1.0084919f, -286.33206f, -0.00077591609f, 0.86181855f, \
+    -244.95419f, -0.0006257128f, 0.69228429f, -197.24068f, -0.00051822048f, 0.5708999f, -163.06757f, -0.00043711331f, \
+    0.47925669f, -137.25514f, -0.00037359665f, 0.40743908f, -117.01429f, -0.00032246954f, 0.34958372f, -100.69612f, \
+    -0.00028043825f, 0.30197778f, -87.25679f, -0.00024530504f, 0.26214406f, -76.000008f, -0.00021554124f, 0.22835967f, \
+    -66.44162f, -0.00019004752f, 0.19938572f, -58.233543f, -0.0001680109f, 0.17430609f, -51.118443f, -0.00014881595f, \
+    0.15242736f, -44.901569f, -0.00013198743f, 0.13321407f, -39.432571f, -0.0001171519f, 0.11624555f, -34.593349f, \
+    -0.00090538705f, 1.0140742f, -289.27875f, -0.00090538705f, 1.0129658f, -288.8038f, -0.00073227723f, 0.81704962f, \
+    -233.5358f, -0.00058732909f, 0.65311831f, -187.30893f, -0.0004834506f, 0.5355736f, -154.15056f, -0.00040500055f, \
+    0.44674617f, -129.08006f, -0.00034352971f, 0.37709221f, -109.40795f, -0.00029403131f, 0.32095671f, -93.541039f, \
+    -0.00025333019f, 0.27475372f, -80.469292f, -0.00021930483f, 0.23608741f, -69.518044f, -0.00019047863f, 0.20329042f, \
+    -60.217854f, -0.00016578878f, 0.17516267f, -52.230919f, -0.00014444892f, 0.15081634f, -45.307369f, -0.00012586344f, \
+    0.12957901f, -39.258007f, -0.00010957225f, 0.11093124f, -33.936691f, -9.5213705e-05f, 0.094464824f, -29.228601f, \
+    -0.00090538705f, 1.018118f, -291.51538f, -0.00090408343f, 1.015833f, -290.78802f, -0.00069266325f, 0.77637792f, \
+    -223.15431f, -0.00055250718f, 0.6175642f, -178.28745f, -0.00045192425f, 0.50352645f, -146.05727f, -0.0003758966f, \
+    0.41726989f, -121.66508f, -0.00031628989f, 0.34959018f, -102.51263f, -0.0002682746f, 0.2950229f, -87.057716f, \
+    -0.00022878349f, 0.25009784f, -74.321198f, -0.00019576504f, 0.21249399f, -63.648338f, -0.00016779004f, 0.18059456f, \
+    -54.583134f, -0.00014382914f, 0.15323515f, -46.797226f, -0.00012312023f, 0.12955371f, -40.047573f, -0.00010508588f, \
+    0.10889712f, -34.150066f, -8.9279813e-05f, 0.090760633f, -28.962437f, -7.535117e-05f, 0.074747421f, -24.372862f, \
+    -0.00090538705f, 1.0220274f, -293.67953f, -0.00086090626f, 0.9711321f, -279.27606f, -0.00065657403f, 0.73929626f, \
+    -213.68167f, -0.00052080973f, 0.58518016f, -170.06512f, -0.00042324714f, 0.4743613f, -138.68813f, -0.00034943889f, \
+    0.39046347f, -114.91914f, -0.00029153918f, 0.32459411f, -96.24379f, -0.000244881f, 0.27146372f, -81.166824f, \
+    -0.00020649626f, 0.22770855f, -68.737556f, -0.00017439759f, 0.19107641f, -58.319599f, -0.00014719935f, 0.15999703f, \
+    -49.469318f, -0.00012390282f, 0.13333873f, -41.867054f, -0.00010376825f, 0.11026326f, -35.276054f, -8.6234853e-05f, \
+    0.090135194f, -29.516901f, -7.0869079e-05f, 0.072463296f, -24.45089f, -5.7329918e-05f, 0.056861196f, -19.968952f, \
+    -0.00090538705f, 1.0258001f, -295.77014f, -0.00082139834f, 0.93019032f, -268.72165f, -0.00062358758f, 0.70537639f, \
+    -205.00974f, -0.00049186667f, 0.55559206f, -162.54788f, -0.0003970848f, 0.44774106f, -131.95863f, -0.00032531924f, \
+    0.36601719f, -108.76478f, -0.00026898977f, 0.3018153f, -90.529419f, -0.00022357922f, 0.25000751f, -75.800743f, \
+    -0.00018621079f, 0.20732832f, -63.654369f, -0.0001549563f, 0.17158902f, -53.470871f, -0.00012847024f, 0.14126235f, \
+    -44.818069f, -0.00010578222f, 0.11524689f, -37.384346f, -8.617303e-05f, 0.092726327f, -30.938782f, -6.9097267e-05f, \
+    0.073081605f, -25.306278f, -5.4133074e-05f, 0.055833917f, -20.351427f, -4.0948686e-05f, 0.040606719f, -15.967751f, \
+    -0.00090538705f, 1.0294311f, -297.78406f, -0.00078513031f, 0.89256954f, -259.01346f, -0.00059334526f, 0.67425436f, \
+    -197.04657f, -0.00046536268f, 0.52848107f, -155.6555f, -0.00037315171f, 0.4233779f, -125.79661f, -0.00030327411f, \
+    0.34366605f, -103.1357f, -0.00024839528f, 0.28100652f, -85.307823f, -0.00020413662f, 0.2304213f, -70.901451f, \
+    -0.00016770588f, 0.18873592f, -59.01664f, -0.00013722962f, 0.1538206f, -49.049728f, -0.00011139953f, 0.12418795f, \
+    -40.579174f, -8.9271394e-05f, 0.098764554f, -33.300827f, -7.0145077e-05f, 0.076754473f, -26.98917f, -5.3489348e-05f, \
+    0.057553802f, -21.473125f, -3.8893348e-05f, 0.040695429f, -16.62038f, -2.6033609e-05f, 0.025811631f, -12.326789f, \
+    -0.00090538705f, 1.0329162f, -299.71878f, -0.00075173611f, 0.85789621f, -250.05661f, -0.00056554057f, 0.64561886f, \
+    -189.71353f, -0.00044102769f, 0.50357395f, -149.31923f, -0.00035120279f, 0.40102467f, -120.14005f, -0.00028307698f, \
+    0.32318208f, -97.974915f, -0.00022954361f, 0.26195484f, -80.525848f, -0.00018635274f, 0.21250418f, -66.418892f, \
+    -0.00015079067f, 0.17174046f, -54.776897f, -0.00012103489f, 0.13758871f, -45.010876f, -9.5811578e-05f, 0.10859862f, \
+    -36.709209f, -7.4200892e-05f, 0.083722897f, -29.574703f, -5.5520399e-05f, 0.06218455f, -23.386885f, -3.9252092e-05f, \
+    0.04339378f, -17.978424f, -2.499517e-05f, 0.026894227f, -13.219859f, -1.2434043e-05f, 0.012326541f, -9.0092564f, \
+    -0.00090538705f, 1.03626f, -301.57681f, -0.00072090217f, 0.82585013f, -241.76974f, -0.00053991005f, 0.61920232f, \
+    -182.94298f, -0.00041862897f, 0.4806352f, -143.47978f, -0.00033102662f, 0.38046798f, -114.93542f, -0.00026453217f, \
+    0.30436832f, -93.233101f, -0.00021225115f, 0.24447577f, -76.137436f, -0.00017005394f, 0.19608206f, -62.309704f, \
+    -0.00013529974f, 0.15617634f, -50.893963f, -0.0001062136f, 0.12273495f, -41.314995f, -8.155391e-05f, 0.094342217f, \
+    -33.170456f, -6.0423507e-05f, 0.069975235f, -26.169655f, -4.2156465e-05f, 0.048874676f, -20.096844f, -2.6247115e-05f, \
+    0.030463956f, -14.788196f, -1.2304031e-05f, 0.014296724f, -10.116905f, -1.8954157e-08f, 2.145036e-05f, -5.9831147f, \
+    -0.00090538705f, 0.97991323f, -267.46771f, -0.00083554012f, 0.90105361f, -245.38596f, -0.0006681573f, 0.71608746f, \
+    -194.38362f, -0.00056033552f, 0.59694648f, -161.54005f, -0.00048418395f, 0.51279676f, -138.34459f, -0.00042714982f, \
+    0.44976351f, -120.96889f, -0.00038266138f, 0.40058401f, -107.40968f, -0.00034690922f, 0.36104918f, -96.506393f, \
+    -0.00031751665f, 0.3285335f, -87.535294f, -0.00029291582f, 0.30130526f, -80.019196f, -0.00027202599f, 0.27817112f, \
+    -73.629349f, -0.00025407562f, 0.25827917f, -68.131149f, -0.00023849738f, 0.24100319f, -63.352184f, -0.00022486385f, \
+    0.22587147f, -59.162636f, -0.00021284634f, 0.21252134f, -55.462696f, -0.0002021874f, 0.2006688f, -52.174248f, \
+    -0.00090538705f, 0.9849112f, -270.21411f, -0.00076935784f, 0.83319879f, -228.06807f, -0.00061325711f, 0.66013402f, \
+    -180.19476f, -0.00051229791f, 0.54820299f, -149.23825f, -0.00044083246f, 0.46896216f, -127.3233f, -0.0003872377f, \
+    0.40952364f, -110.8829f, -0.00034540068f, 0.36311042f, -98.042f, -0.00031176663f, 0.32578236f, -87.710762f, \
+    -0.00028411235f, 0.29507563f, -79.207939f, -0.00026096849f, 0.26936212f, -72.083511f, -0.00024132081f, 0.2475183f, \
+    -66.026978f, -0.0002244442f, 0.22874101f, -60.816475f, -0.00020980506f, 0.21243934f, -56.288799f, -0.00019700106f, \
+    0.19816785f, -52.320961f, -0.00018572253f, 0.18558371f, -48.81834f, -0.00017572683f, 0.17441839f, -45.706825f, \
+    -0.00090538705f, 0.9897505f, -272.87607f, -0.00071214914f, 0.77448845f, -213.07231f, -0.00056563917f, 0.61156207f, \
+    -167.86972f, -0.00047053726f, 0.50579745f, -138.53009f, -0.00040308016f, 0.43076384f, -117.71461f, -0.00035243059f, \
+    0.37440968f, -102.07816f, -0.0003128653f, 0.33037138f, -89.855011f, -0.00028104632f, 0.29493809f, -80.015831f, \
+    -0.00025488136f, 0.26578432f, -71.915764f, -0.00023298542f, 0.24137087f, -65.128098f, -0.00021440101f, 0.22063389f, \
+    -59.358013f, -0.00019844294f, 0.20281219f, -54.394615f, -0.00018460653f, 0.18734521f, -50.08263f, -0.00017251096f, \
+    0.17381001f, -46.304955f, -0.00016186293f, 0.16188097f, -42.971432f, -0.00015243253f, 0.1513028f, -40.011414f, \
+    -0.00090538705f, 0.9943983f, -275.43588f, -0.00066225015f, 0.72323078f, -199.96954f, -0.0005239977f, 0.56905144f, \
+    -157.07549f, -0.00043395531f, 0.46862376f, -129.13783f, -0.00036996612f, 0.39723721f, -109.27711f, -0.0003218666f, \
+    0.3435587f, -94.339272f, -0.00028426872f, 0.30158103f, -82.653046f, -0.00025402143f, 0.26779163f, -73.241493f, \
+    -0.00022914575f, 0.23998484f, -65.491341f, -0.00020832939f, 0.21669829f, -58.996098f, -0.00019066421f, 0.19692013f, \
+    -53.47459f, -0.00017549959f, 0.17992556f, -48.725468f, -0.00016235594f, 0.16518039f, -44.600357f, -0.00015087111f, \
+    0.15228134f, -40.987286f, -0.00014076605f, 0.14091767f, -37.799992f, -0.00013182187f, 0.13084568f, -34.970848f, \
+    -0.00085183443f, 0.93914813f, -261.25403f, -0.00061838032f, 0.67812353f, -188.42937f, -0.00048731759f, 0.5315752f, \
+    -147.55312f, -0.00040169182f, 0.43581536f, -120.84381f, -0.00034073347f, 0.36762223f, -101.82051f, -0.00029486365f, \
+    0.31628752f, -87.495667f, -0.00025898602f, 0.27611491f, -76.280548f, -0.00023011259f, 0.24376509f, -67.24408f, \
+    -0.00020636326f, 0.21713719f, -59.800682f, -0.00018648944f, 0.1948363f, -53.561634f, -0.00016962612f, 0.17589609f, \
+    -48.25774f, -0.00015515297f, 0.15962373f, -43.69603f, -0.00014261239f, 0.1455082f, -39.734215f, -0.00013165864f, \
+    0.13316342f, -36.264828f, -0.00012202512f, 0.12229178f, -33.205032f, -0.00011350264f, 0.11265977f, -30.489862f, \
+    -0.00080044655f, 0.88574427f, -247.43518f, -0.00057953887f, 0.63814849f, -178.19348f, -0.00045479805f, 0.49832326f, \
+    -139.09822f, -0.0003730639f, 0.40668407f, -113.47517f, -0.00031477847f, 0.34131223f, -95.192955f, -0.0002708754f, \
+    0.29204863f, -81.410645f, -0.00023651488f, 0.25347069f, -70.612381f, -0.00020885262f, 0.22239216f, -61.907669f, \
+    -0.00018609557f, 0.19680466f, -54.735409f, -0.00016705145f, 0.17537294f, -48.722633f, -0.00015089331f, 0.15717098f, \
+    -43.610756f, -0.00013702764f, 0.14153425f, -39.214264f, -0.00012501627f, 0.12797223f, -35.396244f, -0.00011452795f, \
+    0.11611415f, -32.053234f, -0.00010530713f, 0.10567401f, -29.105453f, -9.7153228e-05f, 0.096427336f, -26.490286f, \
+    -0.00075476157f, 0.83821243f, -235.12241f, -0.00054493279f, 0.60249859f, -169.0571f, -0.00042579943f, 0.46864811f, \
+    -131.54744f, -0.00034752302f, 0.38067678f, -106.89295f, -0.00029161389f, 0.3178176f, -89.271805f, -0.00024945944f, \
+    0.27039847f, -75.973434f, -0.0002164474f, 0.23324034f, -65.54686f, -0.00018986101f, 0.20329295f, -57.137783f, \
+    -0.00016798478f, 0.1786305f, -50.206959f, -0.00014967653f, 0.15797094f, -44.395493f, -0.00013414321f, 0.14042416f, \
+    -39.454292f, -0.00012081517f, 0.12535094f, -35.204491f, -0.00010927158f, 0.11227905f, -31.513996f, -9.919412e-05f, \
+    0.10085139f, -28.282934f, -9.0337126e-05f, 0.090792336f, -25.434244f, -8.2507657e-05f, 0.081885479f, -22.907423f, \
+    -0.00071388943f, 0.79563892f, -224.08182f, -0.00051392562f, 0.570526f, -160.85582f, -0.00039980488f, 0.44202629f, \
+    -124.76873f, -0.00032462369f, 0.35734412f, -100.98423f, -0.00027084263f, 0.29673895f, -83.957047f, -0.00023025398f, \
+    0.25097418f, -71.093376f, -0.00019844894f, 0.2150889f, -61.000526f, -0.00017282496f, 0.18615498f, -52.856697f, \
+    -0.00015173607f, 0.16232067f, -46.142323f, -0.00013408496f, 0.14235172f, -40.511169f, -0.00011910901f, 0.12539035f, \
+    -35.722675f, -0.00010626002f, 0.11082003f, -31.603979f, -9.5132724e-05f, 0.098185048f, -28.027327f, -8.5420419e-05f, \
+    0.08714053f, -24.896069f, -7.6886281e-05f, 0.077420242f, -22.135601f, -6.9344263e-05f, 0.068815023f, -19.687328f, \
+    -0.00067711552f, 0.75728995f, -214.12552f, -0.00048600099f, 0.54170471f, -153.45618f, -0.00037639233f, 0.41803032f, \
+    -118.65417f, -0.0003040006f, 0.33631748f, -95.656364f, -0.00025213783f, 0.27774748f, -79.16629f, -0.00021296041f, \
+    0.2334761f, -66.69561f, -0.0001822427f, 0.19873925f, -56.904285f, -0.00015748515f, 0.17071906f, -48.999931f, \
+    -0.00013710448f, 0.1476308f, -42.480812f, -0.00012004392f, 0.1282834f, -37.01215f, -0.00010556835f, 0.11184832f, \
+    -32.361134f, -9.3148905e-05f, 0.097729608f, -28.360325f, -8.2394399e-05f, 0.085486449f, -24.885912f, -7.3008625e-05f, \
+    0.074785106f, -21.844172f, -6.4762775e-05f, 0.065367788f, -19.162722f, -5.7477027e-05f, 0.057031929f, -16.784695f, \
+    -0.00064385927f, 0.72256905f, -205.1008f, -0.00046073564f, 0.51560354f, -146.74869f, -0.00035521408f, 0.39630783f, \
+    -113.11483f, -0.0002853515f, 0.31729174f, -90.832634f, -0.00023522833f, 0.2605702f, -74.831154f, -0.0001973303f, \
+    0.21765479f, -62.717808f, -0.00016759789f, 0.18396011f, -53.200478f, -0.00014362491f, 0.15676853f, -45.513577f, \
+    -0.00012388502f, 0.13435623f, -39.171593f, -0.00010735828f, 0.11557144f, -33.850201f, -9.3334522e-05f, 0.099612251f, \
+    -29.323645f, -8.1302482e-05f, 0.085901394f, -25.429441f, -7.0883762e-05f, 0.074011661f, -22.047365f, -6.1791696e-05f, \
+    0.063619427f, -19.086361f, -5.3804768e-05f, 0.054474622f, -16.47608f, -4.674881e-05f, 0.046380658f, -14.161229f, \
+    -0.00061364443f, 0.69098687f, -196.88231f, -0.00043777938f, 0.49186563f, -140.64278f, -0.00033598105f, 0.37656561f, \
+    -108.07669f, -0.00026842431f, 0.3000122f, -86.44902f, -0.00021988725f, 0.2449787f, -70.894379f, -0.00018315538f, \
+    0.20330109f, -59.107666f, -0.0001543206f, 0.1705572f, -49.840645f, -0.00013106191f, 0.14412102f, -42.352234f, \
+    -0.00011190493f, 0.12232442f, -36.171795f, -9.5863325e-05f, 0.1040516f, -30.984575f, -8.2249739e-05f, 0.08852499f, \
+    -26.571289f, -7.0568996e-05f, 0.075184457f, -22.773993f, -6.0454375e-05f, 0.063615218f, -19.475748f, -5.1627943e-05f, \
+    0.05350291f, -16.587946f, -4.3874828e-05f, 0.044604529f, -14.0421f, -3.702605e-05f, 0.036728963f, -11.784361f, \
+    -0.00058607641f, 0.66213799f, -189.36623f, -0.00041684028f, 0.47019327f, -135.06284f, -0.00031845106f, 0.35855806f, \
+    -103.47773f, -0.00025300714f, 0.2842648f, -82.451683f, -0.00020592347f, 0.23078042f, -67.307693f, -0.00017025988f, \
+    0.1902383f, -55.82103f, -0.00014224691f, 0.1583661f, -46.783775f, -0.00011964174f, 0.13262194f, -39.477421f, \
+    -0.00010101763f, 0.11138892f, -33.445023f, -8.5419124e-05f, 0.093584284f, -28.38064f, -7.2179806e-05f, 0.078452855f, \
+    -24.070946f, -6.0819235e-05f, 0.065450244f, -20.362171f, -5.0981438e-05f, 0.054173093f, -17.140411f, -4.2396485e-05f, \
+    0.044315565f, -14.319309f, -3.4855617e-05f, 0.035641141f, -11.832091f, -2.8194598e-05f, 0.027963752f, -9.626235f, \
+    -0.00056082587f, 0.63568354f, -182.46574f, -0.00039767291f, 0.45033613f, -129.94531f, -0.00030241976f, 0.34207788f, \
+    -99.265579f, -0.00023892075f, 0.2698684f, -78.795052f, -0.00019317496f, 0.21781206f, -64.030144f, -0.00015849437f, \
+    0.17831625f, -52.820332f, -0.00013123723f, 0.14724679f, -43.994934f, -0.00010923274f, 0.1221395f, -36.856319f, \
+    -9.1098045e-05f, 0.1014247f, -30.960197f, -7.5906151e-05f, 0.084050186f, -26.008787f, -6.3009946e-05f, 0.069281444f, \
+    -21.794262f, -5.1942588e-05f, 0.056588635f, -18.166727f, -4.2358002e-05f, 0.045578949f, -15.015075f, -3.3993645e-05f, \
+    0.035954423f, -12.255031f, -2.6646387e-05f, 0.027484521f, -9.8214064f, -2.0156411e-05f, 0.019987863f, -7.6629157f, \
+    -0.00053761556f, 0.6113385f, -176.1078f, -0.00038006954f, 0.43208227f, -125.23633f, -0.00028771369f, 0.32694888f, \
+    -95.395744f, -0.00022601253f, 0.25666857f, -75.440269f, -0.0001815034f, 0.20593417f, -61.026768f, -0.0001477312f, \
+    0.16740651f, -50.073448f, -0.00012117216f, 0.13707942f, -41.444206f, -9.9722107e-05f, 0.11256067f, -34.460781f, \
+    -8.203886e-05f, 0.092324428f, -28.690636f, -6.7221721e-05f, 0.07534676f, -23.843561f, -5.4641459e-05f, 0.060912345f, \
+    -19.716848f, -4.3843836e-05f, 0.048504811f, -16.16419f, -3.4491935e-05f, 0.037741147f, -13.077082f, -2.6330044e-05f, \
+    0.02833068f, -10.373183f, -1.9160263e-05f, 0.020048436f, -7.9887776f, -1.2826825e-05f, 0.012717344f, -5.8737178f, \
+    -0.00051621057f, 0.58886105f, -170.23048f, -0.00036385324f, 0.41525108f, -120.89003f, -0.00027418457f, 0.31302053f, \
+    -91.83017f, -0.00021415176f, 0.24453308f, -72.354065f, -0.00017079018f, 0.19502704f, -58.267532f, -0.00013786062f, \
+    0.15739867f, -47.552761f, -0.0001119489f, 0.12776074f, -39.105827f, -9.1012647e-05f, 0.10378803f, -32.266537f, \
+    -7.3747484e-05f, 0.083995461f, -26.6133f, -5.9277165e-05f, 0.067385435f, -21.862972f, -4.6989062e-05f, 0.053260464f, \
+    -17.81761f, -3.6440644e-05f, 0.041116733f, -14.334251f, -2.7303498e-05f, 0.03058034f, -11.306815f, -1.932827e-05f, \
+    0.021367386f, -8.6547632f, -1.2321925e-05f, 0.013258098f, -6.3157549f, -6.1324408e-06f, 0.0060793897f, -4.2406993f, \
+    -0.00049641053f, 0.5680449f, -164.78087f, -0.00034887245f, 0.39968777f, -116.86707f, -0.00026170493f, 0.3001633f, \
+    -88.536133f, -0.00020322585f, 0.23334795f, -69.507744f, -0.00016093293f, 0.18498738f, -55.726521f, -0.00012878787f, \
+    0.14819729f, -45.234379f, -0.00010347852f, 0.11920147f, -36.957497f, -8.302019e-05f, 0.095737204f, -30.252554f, \
+    -6.6143679e-05f, 0.076357484f, -24.708214f, -5.1995568e-05f, 0.060089327f, -20.04793f, -3.9978702e-05f, 0.046251897f, \
+    -16.078218f, -2.9661463e-05f, 0.034353092f, -12.65925f, -2.0723375e-05f, 0.024027513f, -9.6872063f, -1.2921006e-05f, \
+    0.014997603f, -7.0832353f, -6.0658349e-06f, 0.0070484071f, -4.7862759f, -9.3581969e-09f, 1.0590637e-05f, -2.7482307f, \
+    -0.00071886909f, 0.78028291f, -213.01178f, -0.0005277443f, 0.56903648f, -154.73785f, -0.00042334312f, 0.45365599f, \
+    -122.92111f, -0.00035599008f, 0.37921867f, -102.39804f, -0.00030834012f, 0.32655004f, -87.876717f, -0.00027258828f, \
+    0.28702334f, -76.977081f, -0.0002446479f, 0.25612244f, -68.45359f, -0.00022214963f, 0.23122956f, -61.584476f, \
+    -0.00020361475f, 0.21071114f, -55.919502f, -0.00018806744f, 0.19348942f, -51.161697f, -0.00017483474f, 0.17882131f, \
+    -47.106377f, -0.00016343599f, 0.16617614f, -43.607407f, -0.00015351766f, 0.15516366f, -40.557343f, -0.00014481321f, \
+    0.14548977f, -37.875248f, -0.0001371176f, 0.13692817f, -35.498863f, -0.00013027016f, 0.12930164f, -33.379429f, \
+    -0.0006626487f, 0.72211736f, -198.02118f, -0.00048593039f, 0.52616435f, -143.79605f, -0.00038859216f, 0.41823685f, \
+    -113.93945f, -0.00032553566f, 0.34831524f, -94.598709f, -0.00028081995f, 0.29872158f, -80.879875f, -0.00024722159f, \
+    0.26144671f, -70.566437f, -0.00022094116f, 0.2322786f, -62.493126f, -0.0001997686f, 0.20876767f, -55.982471f, \
+    -0.00018232128f, 0.18938167f, -50.61084f, -0.00016768496f, 0.17310767f, -46.098263f, -0.00015522838f, 0.15924633f, \
+    -42.251495f, -0.00014449995f, 0.14729753f, -38.932392f, -0.00013516725f, 0.13689311f, -36.03928f, -0.00012697949f, \
+    0.1277554f, -33.495502f, -0.0001197435f, 0.11967063f, -31.24205f, -0.00011330792f, 0.11247121f, -29.232685f, \
+    -0.00061439286f, 0.67213935f, -185.12903f, -0.00044980043f, 0.4890866f, -134.32613f, -0.00035845966f, 0.38750091f, \
+    -106.14059f, -0.00029906657f, 0.32143733f, -87.811859f, -0.00025685821f, 0.2744765f, -74.781349f, -0.00022510233f, \
+    0.23913202f, -64.971313f, -0.00020024297f, 0.21145025f, -57.284832f, -0.00018020559f, 0.18912499f, -51.082264f, \
+    -0.00016368944f, 0.1707105f, -45.962742f, -0.00014983295f, 0.1552494f, -41.660873f, -0.0001380404f, 0.14207974f, \
+    -37.993237f, -0.00012788516f, 0.13072762f, -34.828541f, -0.00011905288f, 0.12084389f, -32.070084f, -0.00011130624f, \
+    0.11216499f, -29.644888f, -0.00010446234f, 0.10448787f, -27.496744f, -9.8377721e-05f, 0.097653255f, -25.581581f, \
+    -0.00057253084f, 0.62873703f, -173.92258f, -0.00041829314f, 0.45672369f, -126.05409f, -0.00033211132f, 0.36060423f, \
+    -99.311661f, -0.00027587989f, 0.29787675f, -81.859589f, -0.00023583905f, 0.25319627f, -69.426292f, -0.00020567722f, \
+    0.21952505f, -60.053349f, -0.00018204775f, 0.19313203f, -52.702835f, -0.00016299279f, 0.17183483f, -46.767845f, \
+    -0.00014728226f, 0.15426248f, -41.867218f, -0.00013410016f, 0.1395057f, -37.74823f, -0.00012288148f, 0.12693498f, \
+    -34.235973f, -0.00011322125f, 0.11609918f, -31.205122f, -0.00010482077f, 0.10666563f, -28.563295f, -9.7454395e-05f, \
+    0.098383062f, -26.240719f, -9.0948131e-05f, 0.091057718f, -24.183624f, -8.5165426e-05f, 0.084537603f, -22.349827f, \
+    -0.00053587818f, 0.59069479f, -164.0905f, -0.00039059354f, 0.42824638f, -118.76955f, -0.00030889988f, 0.33689171f, \
+    -93.287361f, -0.00025542622f, 0.27707979f, -76.602783f, -0.00021727842f, 0.23439454f, -64.692902f, -0.0001885095f, \
+    0.2021881f, -55.703224f, -0.00016595477f, 0.1769233f, -48.647312f, -0.00014775814f, 0.15652589f, -42.946888f, \
+    -0.0001327512f, 0.13969032f, -38.238083f, -0.00012015768f, 0.12554938f, -34.279255f, -0.0001094395f, 0.11350196f, \
+    -30.902977f, -0.00010021061f, 0.10311692f, -27.98917f, -9.2186034e-05f, 0.094076037f, -25.449238f, -8.515035e-05f, \
+    0.086138785f, -23.216234f, -7.8937359e-05f, 0.079119623f, -21.238523f, -7.3416581e-05f, 0.072872907f, -19.475588f, \
+    -0.00050352485f, 0.55707842f, -155.39357f, -0.0003660658f, 0.40300745f, -112.3082f, -0.00028831564f, 0.31584755f, \
+    -87.937523f, -0.00023727035f, 0.2586076f, -71.93116f, -0.00020079095f, 0.21768397f, -60.484188f, -0.00017325001f, \
+    0.18677112f, -51.833515f, -0.0001516427f, 0.16250259f, -45.038151f, -0.0001342024f, 0.14289941f, -39.545094f, \
+    -0.0001198151f, 0.12671381f, -35.005768f, -0.00010773959f, 0.11311577f, -31.188351f, -9.7461532e-05f, 0.10152933f, \
+    -27.932037f, -8.8611574e-05f, 0.091540977f, -25.121395f, -8.0916885e-05f, 0.0828453f, -22.67119f, -7.4171083e-05f, \
+    0.075211309f, -20.516975f, -6.8214867e-05f, 0.068460725f, -18.609016f, -6.2923107e-05f, 0.06245352f, -16.908268f, \
+    -0.00047476028f, 0.52715838f, -147.64493f, -0.0003442067f, 0.38049459f, -106.54005f, -0.0002699522f, 0.29706007f, \
+    -83.158257f, -0.00022106321f, 0.24210805f, -67.756241f, -0.00018606626f, 0.20275244f, -56.721954f, -0.00015961655f, \
+    0.17299105f, -48.373508f, -0.00013885094f, 0.14960907f, -41.810345f, -0.0001220823f, 0.13071235f, -36.50201f, \
+    -0.00010824489f, 0.11510451f, -32.113552f, -9.6628733e-05f, 0.10198867f, -28.421917f, -8.6740605e-05f, 0.090811297f, \
+    -25.272219f, -7.8226032e-05f, 0.081174619f, -22.553169f, -7.0822993e-05f, 0.072784655f, -20.182545f, -6.433318e-05f, \
+    0.065418921f, -18.098127f, -5.8603415e-05f, 0.058905605f, -16.251888f, -5.3513351e-05f, 0.05310972f, -14.606094f, \
+    -0.00044902161f, 0.50035661f, -140.69655f, -0.00032461307f, 0.36029717f, -101.36082f, -0.00025348156f, 0.28019702f, \
+    -78.865707f, -0.00020652174f, 0.22729555f, -64.006218f, -0.00017285174f, 0.18934578f, -53.342522f, -0.00014737871f, \
+    0.16061668f, -45.265427f, -0.00012736621f, 0.13802919f, -38.910652f, -0.00011119821f, 0.11976519f, -33.767994f, \
+    -9.78522e-05f, 0.10467445f, -29.514751f, -8.6646178e-05f, 0.091989823f, -25.935755f, -7.7105884e-05f, 0.081177913f, \
+    -22.881437f, -6.8890193e-05f, 0.071855113f, -20.244251f, -6.1746759e-05f, 0.06373769f, -17.944672f, -5.5484517e-05f, \
+    0.056610819f, -15.922497f, -4.9955812e-05f, 0.050308507f, -14.131225f, -4.5044573e-05f, 0.044700295f, -12.534309f, \
+    -0.00042585729f, 0.47620919f, -134.42961f, -0.00030695804f, 0.3420822f, -96.686005f, -0.00023863629f, 0.26498735f, \
+    -74.99144f, -0.00019341418f, 0.21393605f, -60.622265f, -0.00016093974f, 0.17725503f, -50.293522f, -0.0001363466f, \
+    0.14945735f, -42.461624f, -0.00011701228f, 0.12758639f, -36.295059f, -0.00010138482f, 0.10989268f, -31.301928f, \
+    -8.8480745e-05f, 0.095267646f, -27.170622f, -7.7643264e-05f, 0.082971036f, -23.693115f, -6.8415211e-05f, 0.072487682f, \
+    -20.724655f, -6.0467522e-05f, 0.063446745f, -18.161079f, -5.3556625e-05f, 0.055573799f, -15.925313f, -4.7497964e-05f, \
+    0.048660923f, -13.958976f, -4.214888e-05f, 0.042547412f, -12.216952f, -3.7397178e-05f, 0.037106887f, -10.663773f, \
+    -0.00040490096f, 0.45433965f, -128.74768f, -0.00029097413f, 0.32557693f, -92.446342f, -0.00022519621f, 0.25120783f, \
+    -71.479088f, -0.00018154894f, 0.20183609f, -57.555721f, -0.0001501582f, 0.16630694f, -47.531532f, -0.00012636244f, \
+    0.1393546f, -39.922485f, -0.00010764241f, 0.11813363f, -33.926876f, -9.250427e-05f, 0.10095687f, -29.069469f, \
+    -7.9999932e-05f, 0.086753666f, -25.048758f, -6.9495509e-05f, 0.074808218f, -21.66321f, -6.0549377e-05f, 0.064621896f, \
+    -18.77247f, -5.284341e-05f, 0.055835526f, -16.275457f, -4.6141995e-05f, 0.048183125f, -14.097328f, -4.026651e-05f, \
+    0.041463066f, -12.181364f, -3.5078832e-05f, 0.03551944f, -10.483713f, -3.0470277e-05f, 0.030229589f, -8.9698839f, \
+    -0.00038585224f, 0.43443924f, -123.57167f, -0.00027644014f, 0.31055596f, -88.584572f, -0.00021297856f, 0.23867306f, \
+    -68.28183f, -0.00017076642f, 0.1908344f, -54.766026f, -0.00014036335f, 0.15635663f, -45.020233f, -0.00011729408f, \
+    0.13017562f, -37.614807f, -9.9133453e-05f, 0.10954739f, -31.775303f, -8.4440624e-05f, 0.092841744f, -27.04174f, \
+    -7.2299787e-05f, 0.079022638f, -23.121851f, -6.2097977e-05f, 0.067396656f, -19.820065f, -5.3407741e-05f, 0.057480305f, \
+    -17.000044f, -4.5920955e-05f, 0.048925057f, -14.563532f, -3.9409271e-05f, 0.041472655f, -12.437733f, -3.3699493e-05f, \
+    0.034927242f, -10.567449f, -2.8657627e-05f, 0.029137291f, -8.9099836f, -2.4178211e-05f, 0.023983549f, -7.4317427f, \
+    -0.00036846258f, 0.41625237f, -118.83609f, -0.00026317185f, 0.29683134f, -85.052963f, -0.00020183029f, 0.22722778f, \
+    -65.360451f, -0.00016093261f, 0.18079551f, -52.219101f, -0.00013143415f, 0.14728215f, -42.729038f, -0.00010903007f, \
+    0.1218084f, -35.510574f, -9.1381371e-05f, 0.10172332f, -29.814299f, -7.7095778e-05f, 0.085449077f, -25.194279f, \
+    -6.5287124e-05f, 0.071981408f, -21.366747f, -5.5361597e-05f, 0.060647469f, -18.141617f, -4.6904788e-05f, 0.050977666f, \
+    -15.386253f, -3.9617727e-05f, 0.042633273f, -13.004998f, -3.3278742e-05f, 0.035363138f, -10.92694f, -2.7719612e-05f, \
+    0.02897669f, -9.098278f, -2.2810142e-05f, 0.023326436f, -7.4773836f, -1.8447818e-05f, 0.018296255f, -6.031486f, \
+    -0.00035252469f, 0.39956576f, -114.48627f, -0.00025101454f, 0.28424513f, -81.811409f, -0.00019162246f, 0.21674104f, \
+    -62.681866f, -0.00015193425f, 0.17160484f, -49.886116f, -0.0001232681f, 0.13898011f, -40.632023f, -0.0001014758f, \
+    0.11415774f, -33.585972f, -8.4297681e-05f, 0.094572619f, -28.0217f, -7.0386188e-05f, 0.078695163f, -23.506235f, \
+    -5.8882451e-05f, 0.065550491f, -19.763681f, -4.9210332e-05f, 0.05448471f, -16.609016f, -4.0967414e-05f, 0.045041088f, \
+    -13.913031f, -3.3863187e-05f, 0.036889933f, -11.582467f, -2.7682121e-05f, 0.029786646f, -9.5481558f, -2.226059e-05f, \
+    0.02354555f, -7.7575917f, -1.7471893e-05f, 0.018022873f, -6.1701279f, -1.3216242e-05f, 0.01310538f, -4.753758f, \
+    -0.00033786404f, 0.38419992f, -110.47623f, -0.00023983733f, 0.27266383f, -78.825958f, -0.0001822456f, 0.20710172f, \
+    -60.217991f, -0.00014367492f, 0.16316487f, -47.742527f, -0.00011577772f, 0.13136232f, -38.707058f, -9.4550451e-05f, \
+    0.10714234f, -31.820658f, -7.780669e-05f, 0.088019282f, -26.378532f, -6.4240288e-05f, 0.072508283f, -21.959743f, \
+    -5.3017604e-05f, 0.059661672f, -18.295694f, -4.3578872e-05f, 0.048843142f, -15.206066f, -3.5532772e-05f, 0.039607871f, \
+    -12.564832f, -2.8596623e-05f, 0.031634543f, -10.280964f, -2.2560587e-05f, 0.024684643f, -8.2869072f, -1.726528e-05f, \
+    0.018577021f, -6.5313587f, -1.2587242e-05f, 0.01317135f, -4.9745851f, -8.4292005e-06f, 0.008357076f, -3.5852861f, \
+    -0.000324333f, 0.37000281f, -106.76698f, -0.00022952883f, 0.26197359f, -76.067696f, -0.00017360621f, 0.19821477f, \
+    -57.944805f, -0.00013607209f, 0.15539207f, -45.767303f, -0.00010888806f, 0.12435309f, -36.935154f, -8.8184592e-05f, \
+    0.10069229f, -30.197144f, -7.1843286e-05f, 0.081997886f, -24.868467f, -5.8596415e-05f, 0.066826612f, -20.539398f, \
+    -4.7633785e-05f, 0.054256096f, -16.948143f, -3.8410828e-05f, 0.043666407f, -13.918771f, -3.0546544e-05f, 0.034623802f, \
+    -11.328213f, -2.3765517e-05f, 0.026814755f, -9.0875235f, -1.7863198e-05f, 0.020006415f, -7.1306505f, -1.2684147e-05f, \
+    0.014021836f, -5.4074111f, -8.1079124e-06f, 0.0087239081f, -3.8789213f, -4.0395585e-06f, 0.0040045632f, -2.5145404f, \
+    -0.00031180563f, 0.35684475f, -103.32529f, -0.00021999361f, 0.25207701f, -73.511856f, -0.00016562401f, 0.18999863f, \
+    -55.841686f, -0.00012905477f, 0.1482145f, -43.942337f, -0.00010253445f, 0.11788715f, -35.299927f, -8.2318271e-05f, \
+    0.094747223f, -28.700314f, -6.635116e-05f, 0.07645186f, -23.477369f, -5.3401189e-05f, 0.061596602f, -19.231852f, \
+    -4.2680029e-05f, 0.04928273f, -15.708331f, -3.3657274e-05f, 0.03890558f, -12.734977f, -2.5961543e-05f, 0.03004176f, \
+    -10.191488f, -1.9324199e-05f, 0.022385024f, -7.9908648f, -1.3545618e-05f, 0.015707795f, -6.0684609f, -8.4740386e-06f, \
+    0.009837064f, -4.3751392f, -3.9918123e-06f, 0.0046387119f, -2.8728106f, -6.1801111e-09f, 6.9940043e-06f, -1.5314491f, \
+    -0.00053299422f, 0.57835513f, -157.59496f, -0.00039371339f, 0.42440245f, -115.12788f, -0.0003175209f, 0.3401823f, \
+    -91.901596f, -0.00026825559f, 0.28571787f, -76.881454f, -0.00023331064f, 0.2470739f, -66.222313f, -0.0002070162f, \
+    0.2179841f, -58.195702f, -0.00018640362f, 0.19516814f, -51.897068f, -0.00016975125f, 0.17672391f, -46.802078f, \
+    -0.00015598403f, 0.16146395f, -42.583492f, -0.00014439209f, 0.14860423f, -39.025326f, -0.0001344855f, 0.13760383f, \
+    -35.978596f, -0.00012591398f, 0.12807606f, -33.33683f, -0.00011841963f, 0.11973625f, -31.021679f, -0.00011180782f, \
+    0.11236963f, -28.974045f, -0.0001059286f, 0.10581076f, -27.148409f, -0.00010066431f, 0.099929847f, -25.509079f, \
+    -0.00049116754f, 0.53507751f, -146.4409f, -0.00036248937f, 0.39238533f, -106.95629f, -0.00029149075f, 0.31364903f, \
+    -85.173088f, -0.00024538423f, 0.26250669f, -71.023392f, -0.000212596f, 0.22612466f, -60.95504f, -0.00018788387f, \
+    0.19869089f, -53.359932f, -0.00016849025f, 0.1771486f, -47.392551f, -0.00015281056f, 0.15971941f, -42.561157f, \
+    -0.00013984038f, 0.14529033f, -38.558079f, -0.00012891513f, 0.13312505f, -35.179848f, -0.00011957547f, 0.12271477f, \
+    -32.285889f, -0.00011149258f, 0.11369531f, -29.775625f, -0.00010442404f, 0.10579827f, -27.574947f, -9.8186807e-05f, \
+    0.098820977f, -25.627913f, -9.2639704e-05f, 0.092607178f, -23.891399f, -8.767187e-05f, 0.087034196f, -22.331564f, \
+    -0.00045530821f, 0.49793863f, -136.86115f, -0.0003355337f, 0.36472267f, -99.891434f, -0.00026893601f, 0.29064238f, \
+    -79.3358f, -0.00022551735f, 0.2423325f, -65.929573f, -0.00019456862f, 0.20788345f, -56.366989f, -0.0001712079f, \
+    0.18186674f, -49.141754f, -0.00015285614f, 0.16141516f, -43.458527f, -0.00013800811f, 0.14485551f, -38.853325f, \
+    -0.00012571945f, 0.13113827f, -35.035191f, -0.00011536421f, 0.11956785f, -31.811352f, -0.00010650912f, 0.10966294f, \
+    -29.048452f, -9.8843659e-05f, 0.10107858f, -26.650948f, -9.2138711e-05f, 0.093560353f, -24.548376f, -8.6221087e-05f, \
+    0.086915925f, -22.687504f, -8.0957128e-05f, 0.080996923f, -21.027264f, -7.6241828e-05f, 0.07568679f, -19.535402f, \
+    -0.00042422523f, 0.46571529f, -128.54222f, -0.00031203876f, 0.34059215f, -93.724518f, -0.00024921974f, 0.27051753f, \
+    -74.226929f, -0.00020811676f, 0.22465259f, -61.4636f, -0.0001787557f, 0.19187497f, -52.339081f, -0.00015656244f, \
+    0.16708471f, -45.434502f, -0.00013911114f, 0.14757752f, -39.997715f, -0.00012498201f, 0.13177086f, -35.588703f, \
+    -0.00011328237f, 0.11866996f, -31.930958f, -0.00010341962f, 0.10761445f, -28.840982f, -9.4983014e-05f, 0.098146789f, \
+    -26.191658f, -8.7677843e-05f, 0.089938685f, -23.891815f, -8.1286489e-05f, 0.082747787f, -21.874161f, -7.5644304e-05f, \
+    0.076390766f, -20.087807f, -7.0624148e-05f, 0.070726082f, -18.493473f, -6.6126064e-05f, 0.065642461f, -17.060291f, \
+    -0.00039702357f, 0.43748817f, -121.24854f, -0.00029138671f, 0.31936461f, -88.295753f, -0.0002318497f, 0.25277591f, \
+    -69.720604f, -0.0001927636f, 0.2090444f, -57.519226f, -0.00016478718f, 0.1777271f, -48.778095f, -0.00014361279f, \
+    0.15400907f, -42.154293f, -0.00012694749f, 0.13532767f, -36.933331f, -0.00011344581f, 0.12017936f, -32.696121f, \
+    -0.00010226015f, 0.10761719f, -29.178785f, -9.2826936e-05f, 0.097011566f, -26.205942f, -8.4755113e-05f, 0.087925702f, \
+    -23.655943f, -7.7763798e-05f, 0.080045924f, -21.441454f, -7.1645394e-05f, 0.073140435f, -19.497953f, -6.6242741e-05f, \
+    0.06703379f, -17.776617f, -6.1434395e-05f, 0.061590437f, -16.239733f, -5.7124817e-05f, 0.05670375f, -14.857646f, \
+    -0.00037301777f, 0.41255304f, -114.79962f, -0.00027309696f, 0.30055049f, -83.48082f, -0.00021643966f, 0.23702621f, \
+    -65.718025f, -0.00017912716f, 0.19517416f, -54.012543f, -0.00015236961f, 0.16514462f, -45.610023f, -0.00013209242f, \
+    0.14237238f, -39.234287f, -0.00011611931f, 0.12441941f, -34.203991f, -0.00010317005f, 0.1098517f, -30.118517f, \
+    -9.2436727e-05f, 0.09776444f, -26.725142f, -8.3381346e-05f, 0.08755517f, -23.855646f, -7.5630182e-05f, 0.078805469f, \
+    -21.393229f, -6.8914538e-05f, 0.071214542f, -19.253941f, -6.3035681e-05f, 0.064559951f, -17.375719f, -5.7843048e-05f, \
+    0.058673199f, -15.711567f, -5.3220218e-05f, 0.053424023f, -14.225158f, -4.9075559e-05f, 0.04870991f, -12.887911f, \
+    -0.00035167392f, 0.39036131f, -109.0549f, -0.0002567904f, 0.28376347f, -79.18158f, -0.00020268251f, 0.22295715f, \
+    -62.140579f, -0.00016694305f, 0.18277495f, -50.876419f, -0.0001412673f, 0.15389031f, -42.775429f, -0.00012178662f, \
+    0.13195911f, -36.620605f, -0.00010642791f, 0.11465374f, -31.760073f, -9.3968847e-05f, 0.10060203f, -27.809647f, \
+    -8.3636703e-05f, 0.088936619f, -24.526533f, -7.4916221e-05f, 0.079079211f, -21.748913f, -6.7449066e-05f, 0.070627719f, \
+    -19.364292f, -6.09774e-05f, 0.063292824f, -17.291752f, -5.5310353e-05f, 0.056860417f, -15.471421f, -5.0303235e-05f, \
+    0.0511682f, -13.857928f, -4.5844103e-05f, 0.046090629f, -12.416185f, -4.18448e-05f, 0.041528858f, -11.118573f, \
+    -0.00033257026f, 0.37047938f, -103.90326f, -0.00024216386f, 0.26869452f, -75.319557f, -0.00019033103f, 0.21031806f, \
+    -58.924957f, -0.00015599742f, 0.17163081f, -48.056538f, -0.00013128901f, 0.1437716f, -40.226025f, -0.00011252056f, \
+    0.12259363f, -34.269348f, -9.7711119e-05f, 0.10586813f, -29.561037f, -8.5690102e-05f, 0.09227822f, -25.731636f, \
+    -7.5716256e-05f, 0.080990128f, -22.547281f, -6.729467e-05f, 0.071447223f, -19.851889f, -6.0080813e-05f, 0.06326206f, \
+    -17.536842f, -5.3826545e-05f, 0.056155648f, -15.523945f, -4.8348065e-05f, 0.049921326f, -13.75529f, -4.3505937e-05f, \
+    0.044402372f, -12.186975f, -3.9192233e-05f, 0.039477471f, -10.785021f, -3.5321911e-05f, 0.035051066f, -9.5226727f, \
+    -0.00031536899f, 0.35256007f, -99.255707f, -0.00022897225f, 0.25509369f, -71.831253f, -0.00017918414f, 0.19890499f, \
+    -56.019634f, -0.00014611558f, 0.16156524f, -45.508492f, -0.00012227794f, 0.13463055f, -37.922211f, -0.00010415054f, \
+    0.11413158f, -32.144413f, -8.983531e-05f, 0.097928584f, -27.573454f, -7.8208235e-05f, 0.084754586f, -23.853199f, \
+    -6.8556408e-05f, 0.073806092f, -20.757845f, -6.0403272e-05f, 0.064546049f, -18.136501f, -5.3416719e-05f, 0.056600232f, \
+    -15.884056f, -4.7357382e-05f, 0.049698956f, -13.924773f, -4.204781e-05f, 0.04364232f, -12.202531f, -3.7353333e-05f, \
+    0.038278621f, -10.674746f, -3.3169625e-05f, 0.033490378f, -9.3084497f, -2.9414467e-05f, 0.029185001f, -8.0776663f, \
+    -0.00029979661f, 0.33632204f, -95.040138f, -0.00021701523f, 0.24275668f, -68.664749f, -0.00016907662f, 0.18855026f, \
+    -53.382256f, -0.00013715346f, 0.15243256f, -43.195637f, -0.00011410435f, 0.12633641f, -35.831203f, -9.6557378e-05f, \
+    0.10645314f, -30.21583f, -8.268941e-05f, 0.090723716f, -25.769526f, -7.1418661e-05f, 0.077926435f, -22.148262f, \
+    -6.2057909e-05f, 0.067285329f, -19.133566f, -5.414724e-05f, 0.058281105f, -16.579277f, -4.7365829e-05f, 0.050551582f, \
+    -14.383472f, -4.1482257e-05f, 0.043835517f, -12.472654f, -3.6324851e-05f, 0.037939154f, -10.792322f, -3.1763244e-05f, \
+    0.032715354f, -9.3011007f, -2.76964e-05f, 0.028050113f, -7.9669361f, -2.4044642e-05f, 0.023853537f, -6.7645602f, \
+    -0.00028562927f, 0.32153502f, -91.197533f, -0.00020612756f, 0.23151486f, -65.777191f, -0.0001598715f, 0.17911488f, \
+    -50.977688f, -0.0001289912f, 0.14411162f, -41.087475f, -0.00010666008f, 0.11878014f, -33.92564f, -8.964142e-05f, \
+    0.099458113f, -28.45853f, -7.6180382e-05f, 0.084160134f, -24.125948f, -6.5233609e-05f, 0.071705841f, -20.594923f, \
+    -5.6137324e-05f, 0.061344389f, -17.653702f, -4.8446782e-05f, 0.052572727f, -15.160441f, -4.1851461e-05f, 0.045039654f, \
+    -13.01614f, -3.6127181e-05f, 0.038491655f, -11.14935f, -3.1107553e-05f, 0.032740586f, -9.5070553f, -2.666613e-05f, \
+    0.027643478f, -8.0489817f, -2.2704875e-05f, 0.023089508f, -6.7439141f, -1.9146439e-05f, 0.018991241f, -5.5672326f, \
+    -0.00027268197f, 0.3080087f, -87.679085f, -0.00019617174f, 0.22122785f, -63.132915f, -0.00015145435f, 0.17048259f, \
+    -48.77655f, -0.00012152833f, 0.13650072f, -39.158413f, -9.9854173e-05f, 0.11186998f, -32.182503f, -8.3318744e-05f, \
+    0.093062036f, -26.851387f, -7.0229689e-05f, 0.078159004f, -22.623037f, -5.9578873e-05f, 0.066018447f, -19.174662f, \
+    -5.0724004e-05f, 0.055912606f, -16.300676f, -4.3234239e-05f, 0.047353324f, -13.863213f, -3.6808495e-05f, 0.039999492f, \
+    -11.765957f, -3.122925e-05f, 0.033604696f, -9.9393463f, -2.6334938e-05f, 0.027985936f, -8.331727f, -2.2002718e-05f, \
+    0.023004083f, -6.9038396f, -1.8137305e-05f, 0.018551223f, -5.6252394f, -1.4663476e-05f, 0.014542184f, -4.4719028f, \
+    -0.00026080059f, 0.29558438f, -84.444115f, -0.00018703245f, 0.21177793f, -60.701988f, -0.00014372877f, 0.1625555f, \
+    -46.754097f, -0.00011467999f, 0.12951401f, -37.386833f, -9.3609648e-05f, 0.10552825f, -30.5823f, -7.7518147e-05f, \
+    0.087193251f, -25.376463f, -6.4770604e-05f, 0.072653294f, -21.244059f, -5.4391294e-05f, 0.06080094f, -17.871696f, \
+    -4.5757719e-05f, 0.050929699f, -15.059493f, -3.8451843e-05f, 0.042565163f, -12.673254f, -3.2181269e-05f, 0.035375543f, \
+    -10.619147f, -2.6734608e-05f, 0.029120967f, -8.8293495f, -2.1954742e-05f, 0.02362318f, -7.2534685f, -1.7722152e-05f, \
+    0.01874659f, -5.8531804f, -1.3944076e-05f, 0.014385974f, -4.5987515f, -1.0547261e-05f, 0.010458243f, -3.4667082f, \
+    -0.00024985566f, 0.28412879f, -81.458443f, -0.00017861224f, 0.20306554f, -58.459099f, -0.00013661306f, 0.15525055f, \
+    -44.889328f, -0.00010837403f, 0.12307842f, -35.754341f, -8.7860906e-05f, 0.099688739f, -29.108412f, -7.2178838e-05f, \
+    0.081790537f, -24.018431f, -5.9746042e-05f, 0.067585655f, -19.974686f, -4.9616767e-05f, 0.055999041f, -16.672499f, \
+    -4.1186799e-05f, 0.046343919f, -13.917278f, -3.4049954e-05f, 0.038158622f, -11.578238f, -2.7921884e-05f, 0.03111998f, \
+    -9.5638485f, -2.2596856e-05f, 0.024994193f, -7.8079004f, -1.7921875e-05f, 0.019607401f, -6.2611699f, -1.3780489e-05f, \
+    0.014827283f, -4.8862023f, -1.0082276e-05f, 0.010551106f, -3.6539223f, -6.7557926e-06f, 0.0066977083f, -2.5413651f, \
+    -0.00023973767f, 0.27352905f, -78.693123f, -0.00017082827f, 0.19500604f, -56.382717f, -0.00013003746f, 0.14849682f, \
+    -43.16431f, -0.00010254871f, 0.11713143f, -34.245182f, -8.2551684e-05f, 0.09429463f, -27.746571f, -6.7248591e-05f, \
+    0.07680127f, -22.764118f, -5.5106888e-05f, 0.06290669f, -18.80258f, -4.5208639e-05f, 0.051565938f, -15.565399f, \
+    -3.6966623e-05f, 0.042110566f, -12.862908f, -2.9985655e-05f, 0.034090757f, -10.567498f, -2.3988856e-05f, 0.027191369f, \
+    -8.5897808f, -1.8775754e-05f, 0.021184228f, -6.8650508f, -1.4197175e-05f, 0.015899571f, -5.3451743f, -1.0139516e-05f, \
+    0.011208117f, -3.9935024f, -6.514525e-06f, 0.0070094448f, -2.7815738f, -3.252442e-06f, 0.0032241871f, -1.6868976f, \
+    -0.00023035325f, 0.26368904f, -76.123489f, -0.00016360958f, 0.18752688f, -54.454403f, -0.00012394208f, 0.14223343f, \
+    -41.563641f, -9.7150914e-05f, 0.11161919f, -32.845795f, -7.7633471e-05f, 0.0892969f, -26.484468f, -6.2682273e-05f, \
+    0.072179981f, -21.602131f, -5.081061e-05f, 0.058573637f, -17.717054f, -4.1126463e-05f, 0.047461025f, -14.54027f, \
+    -3.3058441e-05f, 0.038190804f, -11.886715f, -2.6221607e-05f, 0.030324208f, -9.6317453f, -2.0346044e-05f, 0.023553578f, \
+    -7.6879773f, -1.5236181e-05f, 0.01765601f, -5.9921122f, -1.0746404e-05f, 0.012465549f, -4.4970303f, -6.7657634e-06f, \
+    0.0078557525f, -3.1668384f, -3.2080236e-06f, 0.003728353f, -1.9736457f, -5.0000968e-09f, 5.6585945e-06f, -0.89540601f, \
+    -0.00044639513f, 0.48416242f, -131.59142f, -0.00033262023f, 0.35839653f, -96.903503f, -0.00027032709f, 0.28952327f, \
+    -77.907433f, -0.00022995356f, 0.24486761f, -65.58773f, -0.00020122777f, 0.21307746f, -56.813198f, -0.00017953645f, \
+    0.18905516f, -50.178234f, -0.00016246513f, 0.17013316f, -44.947517f, -0.00014861321f, 0.15476428f, -40.694702f, \
+    -0.00013710542f, 0.1419819f, -37.153496f, -0.00012736309f, 0.13114704f, -34.147915f, -0.00011898619f, 0.12181808f, \
+    -31.556374f, -0.00011168807f, 0.1136786f, -29.291779f, -0.00010525703f, 0.10649499f, -27.289846f, -9.9532743e-05f, \
+    0.10009032f, -25.501913f, -9.4391035e-05f, 0.094327673f, -23.890312f, -8.9733869e-05f, 0.089098893f, -22.425318f, \
+    -0.00041112941f, 0.44766542f, -122.18371f, -0.00030617154f, 0.33127028f, -89.979439f, -0.00024818606f, 0.26694918f, \
+    -72.182388f, -0.00021042849f, 0.22504778f, -60.585167f, -0.00018348661f, 0.19513096f, -52.300602f, -0.0001631022f, \
+    0.17247845f, -46.023132f, -0.00014703584f, 0.15460826f, -41.066471f, -0.00013398395f, 0.14007583f, -37.031319f, \
+    -0.00012312982f, 0.1279763f, -33.667625f, -0.00011393234f, 0.11771024f, -30.809795f, -0.00010601681f, 0.10886268f, \
+    -28.343222f, -9.9114317e-05f, 0.10113584f, -26.185688f, -9.3026043e-05f, 0.094309606f, -24.276438f, -8.7601184e-05f, \
+    0.088217057f, -22.569412f, -8.2722821e-05f, 0.082728818f, -21.028921f, -7.8298544e-05f, 0.077742636f, -19.626764f, \
+    -0.00038096501f, 0.41642269f, -114.12486f, -0.00028338062f, 0.30788016f, -84.00592f, -0.00022903118f, 0.24740911f, \
+    -67.224815f, -0.00019349177f, 0.20784752f, -56.242428f, -0.00016806637f, 0.17952615f, -48.375858f, -0.00014879467f, \
+    0.15804206f, -42.403824f, -0.00013358478f, 0.1410699f, -37.681534f, -0.00012121513f, 0.12725206f, -33.83263f, \
+    -0.00011091861f, 0.11573605f, -30.620872f, -0.00010218597f, 0.10595612f, -27.889517f, -9.4664028e-05f, 0.097519964f, \
+    -25.529903f, -8.809899e-05f, 0.0901457f, -23.463984f, -8.2302962e-05f, 0.083624691f, -21.634005f, -7.7133278e-05f, \
+    0.077798568f, -19.996141f, -7.2479212e-05f, 0.072544426f, -18.516388f, -6.8253117e-05f, 0.067765005f, -17.167852f, \
+    -0.00035486193f, 0.38936457f, -107.14043f, -0.00026353914f, 0.28750402f, -78.799355f, -0.00021230146f, 0.23033415f, \
+    -62.890926f, -0.00017866721f, 0.19278596f, -52.438507f, -0.00015454694f, 0.16584015f, -44.932915f, -0.000136234f, \
+    0.14536455f, -39.224937f, -0.00012176255f, 0.12916802f, -34.705383f, -0.00010998137f, 0.11596756f, -31.017641f, \
+    -0.00010016585f, 0.10495578f, -27.937366f, -9.1834147e-05f, 0.095595866f, -25.315443f, -8.4651641e-05f, 0.087515086f, \
+    -23.048355f, -7.8377518e-05f, 0.080445267f, -21.061653f, -7.2833325e-05f, 0.074187696f, -19.300184f, -6.7883411e-05f, \
+    0.068591364f, -17.72205f, -6.3422369e-05f, 0.063538976f, -16.294708f, -5.9366703e-05f, 0.058937594f, -14.992391f, \
+    -0.00033204351f, 0.36569217f, -101.02547f, -0.00024610866f, 0.2695927f, -74.220131f, -0.00019756606f, 0.21528733f, \
+    -59.070278f, -0.00016558674f, 0.17949122f, -49.079815f, -0.0001426019f, 0.15374419f, -41.889313f, -0.00012512376f, \
+    0.1341482f, -36.412003f, -0.00011129557f, 0.11862843f, -32.069607f, -0.00010002706f, 0.10596672f, -28.522703f, \
+    -9.0630572e-05f, 0.095394894f, -25.557318f, -8.2648119e-05f, 0.086401403f, -23.030996f, -7.5761163e-05f, 0.078630544f, \
+    -20.844709f, -6.9740257e-05f, 0.0718261f, -18.927151f, -6.4415137e-05f, 0.065798029f, -17.225439f, -5.9656275e-05f, \
+    0.060401756f, -15.699364f, -5.5362925e-05f, 0.05552486f, -14.31766f, -5.1455165e-05f, 0.051078185f, -13.055546f, \
+    -0.00031191797f, 0.34479675f, -95.623802f, -0.00023067264f, 0.25372127f, -70.160225f, -0.00018448882f, 0.20192757f, \
+    -55.676666f, -0.0001539614f, 0.16767126f, -46.092857f, -0.00013197388f, 0.14297895f, -39.180008f, -0.00011522939f, \
+    0.12415726f, -33.906048f, -0.00010196665f, 0.10923333f, -29.719854f, -9.114878e-05f, 0.097045921f, -26.297119f, \
+    -8.2120576e-05f, 0.086861365f, -23.432999f, -7.4444964e-05f, 0.078190297f, -20.990911f, -6.7817593e-05f, 0.070692018f, \
+    -18.875782f, -6.2018953e-05f, 0.064120866f, -17.019079f, -5.6886034e-05f, 0.058294412f, -15.369927f, -5.2294672e-05f, \
+    0.053073753f, -13.8896f, -4.8148217e-05f, 0.048350774f, -12.547963f, -4.4369917e-05f, 0.044039648f, -11.321102f, \
+    -0.00029402657f, 0.32620624f, -90.814331f, -0.00021690395f, 0.23955597f, -66.53476f, -0.00017280372f, 0.18998486f, \
+    -52.641823f, -0.00014356131f, 0.1570937f, -43.419121f, -0.00012245723f, 0.13333721f, -36.753006f, -0.00010636286f, \
+    0.11520271f, -31.659786f, -9.3601193e-05f, 0.1008076f, -27.612421f, -8.3182604e-05f, 0.089041077f, -24.300016f, \
+    -7.4480617e-05f, 0.079200052f, -21.525846f, -6.7076704e-05f, 0.07081487f, -19.158541f, -6.0679067e-05f, 0.063558176f, \
+    -17.106554f, -5.5077042e-05f, 0.057193648f, -15.303814f, -5.011402e-05f, 0.051545642f, -13.701233f, -4.5670618e-05f, \
+    0.046480298f, -12.261407f, -4.1653813e-05f, 0.041893318f, -10.955204f, -3.7989663e-05f, 0.037701834f, -9.7594833f, \
+    -0.00027800823f, 0.30954909f, -86.501709f, -0.00020454213f, 0.2268309f, -63.276127f, -0.00016229751f, 0.1792427f, \
+    -49.911015f, -0.00013420133f, 0.14757127f, -41.011463f, -0.00011388576f, 0.12465136f, -34.56625f, -9.8371725e-05f, \
+    0.10713125f, -29.634855f, -8.6057298e-05f, 0.093208842f, -25.711756f, -7.5995005e-05f, 0.081818424f, -22.498075f, \
+    -6.7583998e-05f, 0.072284251f, -19.804354f, -6.0422317e-05f, 0.064154312f, -17.503899f, -5.4229393e-05f, 0.057113171f, \
+    -15.508314f, -4.880246e-05f, 0.050932888f, -13.753748f, -4.3990636e-05f, 0.045443885f, -12.192705f, -3.9678813e-05f, \
+    0.040516809f, -10.78897f, -3.5777201e-05f, 0.036050789f, -9.5143089f, -3.221439e-05f, 0.031965613f, -8.3462772f, \
+    -0.00026357488f, 0.29452866f, -82.609856f, -0.00019337723f, 0.2153317f, -60.329819f, -0.00015279732f, 0.16952547f, \
+    -47.439831f, -0.00012573072f, 0.13895144f, -38.831478f, -0.00010612367f, 0.11678444f, -32.585365f, -9.1131078e-05f, \
+    0.099817194f, -27.799797f, -7.9218407e-05f, 0.086320043f, -23.988644f, -6.9476053e-05f, 0.075267829f, -20.863853f, \
+    -6.1326209e-05f, 0.066009432f, -18.242525f, -5.4381821e-05f, 0.058108762f, -16.002188f, -4.8372418e-05f, 0.051261108f, \
+    -14.057294f, -4.3102347e-05f, 0.045246087f, -12.345984f, -3.8425886e-05f, 0.039899595f, -10.822209f, -3.4231754e-05f, \
+    0.035096336f, -9.4508228f, -3.0433101e-05f, 0.030738533f, -8.2044039f, -2.6960766e-05f, 0.026748352f, -7.0611315f, \
+    -0.00025049387f, 0.28090549f, -79.077316f, -0.00018323818f, 0.20488369f, -57.651398f, -0.00014416146f, 0.16068925f, \
+    -45.191875f, -0.00011802543f, 0.13110869f, -36.847557f, -9.9058889e-05f, 0.10962334f, -30.781965f, -8.4537583e-05f, \
+    0.093156531f, -26.128578f, -7.2987881e-05f, 0.080044113f, -22.418839f, -6.3534411e-05f, 0.069297709f, -19.374529f, \
+    -5.562025e-05f, 0.060288534f, -16.818703f, -4.8871829e-05f, 0.052594889f, -14.632719f, -4.3027823e-05f, 0.045921836f, \
+    -12.733618f, -3.7899015e-05f, 0.040055826f, -11.061354f, -3.3344353e-05f, 0.034837715f, -9.571187f, -2.9256038e-05f, \
+    0.030145895f, -8.2289419f, -2.554986e-05f, 0.025885383f, -7.0079346f, -2.2158709e-05f, 0.021980511f, -5.8869119f, \
+    -0.00023857532f, 0.26848391f, -75.853897f, -0.00017398421f, 0.195343f, -55.204277f, -0.00013627275f, 0.15261492f, \
+    -43.137016f, -0.00011098252f, 0.12393874f, -35.033424f, -9.2598093e-05f, 0.10307387f, -29.132395f, -7.8504949e-05f, \
+    0.087062359f, -24.599438f, -6.7284811e-05f, 0.074299783f, -20.982038f, -5.8093483e-05f, 0.063831247f, -18.010954f, \
+    -5.0393021e-05f, 0.055048347f, -15.514674f, -4.3822154e-05f, 0.047542535f, -13.378062f, -3.8127884e-05f, 0.041027747f, \
+    -11.52052f, -3.3126857e-05f, 0.03529669f, -9.8836575f, -2.8682267e-05f, 0.030194733f, -8.4239292f, -2.4689491e-05f, \
+    0.025603635f, -7.1080499f, -2.1066713e-05f, 0.021430956f, -5.9100027f, -1.7748696e-05f, 0.017603001f, -4.8090549f, \
+    -0.00022766259f, 0.25710264f, -72.898193f, -0.00016549835f, 0.18659011f, -52.958046f, -0.00012903337f, 0.14520304f, \
+    -41.250095f, -0.00010451572f, 0.11735425f, -33.367077f, -8.6662876e-05f, 0.097056843f, -27.616772f, -7.2960494e-05f, \
+    0.081461474f, -23.19404f, -6.2040912e-05f, 0.069018386f, -19.661091f, -5.3088454e-05f, 0.058803417f, -16.756912f, \
+    -4.5582554e-05f, 0.050226811f, -14.314993f, -3.9173192e-05f, 0.042892072f, -12.223407f, -3.3614997e-05f, 0.036521297f, \
+    -10.403727f, -2.8729966e-05f, 0.030912906f, -8.7990789f, -2.4385197e-05f, 0.025916414f, -7.3670197f, -2.0478956e-05f, \
+    0.021416655f, -6.0750723f, -1.6931628e-05f, 0.017323516f, -4.8978376f, -1.3679683e-05f, 0.013565115f, -3.8150578f, \
+    -0.00021762541f, 0.24662741f, -70.175758f, -0.0001576826f, 0.17852485f, -50.887218f, -0.00012236105f, 0.13836989f, \
+    -39.509933f, -9.8552206e-05f, 0.11128139f, -31.829914f, -8.1186823e-05f, 0.091505155f, -26.218243f, -6.7842499e-05f, \
+    0.076291658f, -21.896809f, -5.7198053e-05f, 0.064141475f, -18.441385f, -4.8464037e-05f, 0.05415871f, -15.598565f, \
+    -4.1135871e-05f, 0.04577082f, -13.20644f, -3.4873876e-05f, 0.038592406f, -11.156052f, -2.9439694e-05f, 0.032353058f, \
+    -9.3709707f, -2.4660258e-05f, 0.02685648f, -7.7957258f, -2.0406234e-05f, 0.021955989f, -6.3888822f, -1.6578544e-05f, \
+    0.017539246f, -5.1187129f, -1.30996e-05f, 0.013518286f, -3.9603844f, -9.9074323e-06f, 0.0098228799f, -2.8940754f, \
+    -0.0002083545f, 0.23694554f, -67.657669f, -0.00015045425f, 0.1710626f, -48.970264f, -0.00011618593f, 0.1320444f, \
+    -37.898552f, -9.302995e-05f, 0.10565732f, -30.406094f, -7.6113232e-05f, 0.086361483f, -24.922407f, -6.3098109e-05f, \
+    0.071499623f, -20.694387f, -5.2706328e-05f, 0.05961882f, -17.310369f, -4.4172648e-05f, 0.049849339f, -14.52399f, \
+    -3.7007267e-05f, 0.041634548f, -12.177606f, -3.0880052e-05f, 0.034599319f, -10.165007f, -2.5559126e-05f, 0.028480183f, \
+    -8.4116163f, -2.0875967e-05f, 0.023085704f, -6.8632584f, -1.6704545e-05f, 0.01827273f, -5.479435f, -1.2948229e-05f, \
+    0.01393152f, -4.2291079f, -9.5312862e-06f, 0.0099760937f, -3.0879672f, -6.3931902e-06f, 0.006337747f, -2.0365946f, \
+    -0.0001997574f, 0.22796173f, -65.319466f, -0.00014374284f, 0.16413131f, -47.188847f, -0.00011044832f, 0.12616587f, \
+    -36.40057f, -8.7895773e-05f, 0.10042807f, -29.082018f, -7.1393297e-05f, 0.081576489f, -23.716869f, -5.8681704e-05f, \
+    0.067039348f, -19.575247f, -4.8522528e-05f, 0.055406932f, -16.257174f, -4.0172981e-05f, 0.0458338f, -13.522831f, \
+    -3.3156957e-05f, 0.037778091f, -11.218551f, -2.7153188e-05f, 0.030874215f, -9.240675f, -2.193579e-05f, 0.02486515f, \
+    -7.5163488f, -1.7340462e-05f, 0.019563969f, -5.9926014f, -1.3244225e-05f, 0.014830787f, -4.6298003f, -9.5527075e-06f, \
+    0.010558275f, -3.3975489f, -6.1918981e-06f, 0.0066622808f, -2.2720213f, -3.1025979e-06f, 0.0030755117f, -1.234172f, \
+    -0.0001917554f, 0.21959481f, -63.140293f, -0.00013748805f, 0.15766923f, -45.527245f, -0.00010509687f, 0.12068193f, \
+    -35.002747f, -8.3103696e-05f, 0.095547006f, -27.845926f, -6.6984685e-05f, 0.077107348f, -22.590864f, -5.4553584e-05f, \
+    0.062870778f, -18.529343f, -4.4608936e-05f, 0.051467828f, -15.272294f, -3.6428857e-05f, 0.042075716f, -12.586011f, \
+    -2.9549992e-05f, 0.034166362f, -10.320533f, -2.3659319e-05f, 0.027383052f, -8.3745871f, -1.8536533e-05f, 0.021474767f, \
+    -6.6769247f, -1.4021251e-05f, 0.016258789f, -5.1756945f, -9.993325e-06f, 0.011598254f, -3.8320727f, -6.3604834e-06f, \
+    0.0073880791f, -2.6162579f, -3.0503027e-06f, 0.0035458051f, -1.5048726f, -4.811116e-09f, 5.4447187e-06f, -0.47921717f, \
+    -0.00041335987f, 0.44804361f, -121.39916f, -0.00031125292f, 0.33517769f, -90.277313f, -0.00025543972f, 0.27345148f, \
+    -73.250992f, -0.00021922759f, 0.23337294f, -62.188572f, -0.00019340419f, 0.20476457f, -54.284683f, -0.00017384517f, \
+    0.1830705f, -48.283882f, -0.00015839451f, 0.16590944f, -43.53017f, -0.00014580136f, 0.15190011f, -39.643116f, \
+    -0.00013528297f, 0.14017829f, -36.384769f, -0.00012632036f, 0.13017106f, -33.597427f, -0.00011855318f, 0.12148066f, \
+    -31.171625f, -0.00011172134f, 0.11382008f, -29.028397f, -0.00010563082f, 0.1069752f, -27.108847f, -0.00010013238f, \
+    0.10078138f, -25.367691f, -9.5107935e-05f, 0.095108345f, -23.769104f, -9.046129e-05f, 0.089849971f, -22.283911f, \
+    -0.00038029318f, 0.41380623f, -112.57088f, -0.00028634546f, 0.3096205f, -83.751846f, -0.00023449142f, 0.2520836f, \
+    -67.830421f, -0.00020067362f, 0.21453002f, -57.431454f, -0.00017647697f, 0.18763328f, -49.976173f, -0.00015810491f, \
+    0.16718617f, -44.301643f, -0.00014356269f, 0.15097852f, -39.797092f, -0.00013168866f, 0.13772342f, -36.106995f, \
+    -0.00012175381f, 0.12661338f, -33.008331f, -0.00011327361f, 0.11711181f, -30.352942f, -0.00010591088f, 0.10884533f, \
+    -28.037752f, -9.9421748e-05f, 0.10154396f, -25.988255f, -9.362385e-05f, 0.095005833f, -24.148746f, -8.8376582e-05f, \
+    0.089075305f, -22.476295f, -8.3568302e-05f, 0.083628833f, -20.936823f, -7.9107747e-05f, 0.078565411f, -19.502476f, \
+    -0.0003521351f, 0.38463449f, -105.0452f, -0.00026496168f, 0.28766966f, -78.145378f, -0.00021642797f, 0.23365264f, \
+    -63.153904f, -0.0001846282f, 0.19823097f, -53.316044f, -0.0001618067f, 0.17278364f, -46.241264f, -0.00014444004f, \
+    0.15339458f, -40.84399f, -0.00013066837f, 0.13799694f, -36.551445f, -0.00011940495f, 0.12538329f, -33.029091f, \
+    -0.00010996599f, 0.11479393f, -30.066523f, -0.00010189598f, 0.10572295f, -27.523636f, -9.4877301e-05f, 0.097817585f, \
+    -25.302782f, -8.8679779e-05f, 0.09082225f, -23.33322f, -8.3130908e-05f, 0.084545434f, -21.561954f, -7.8097364e-05f, \
+    0.078839131f, -19.948044f, -7.3472984e-05f, 0.073585495f, -18.458895f, -6.9170652e-05f, 0.068687849f, -17.067768f, \
+    -0.00032784897f, 0.35945988f, -98.547478f, -0.00024639303f, 0.26860115f, -73.273529f, -0.00020068516f, 0.21758516f, \
+    -59.076286f, -0.00017060984f, 0.18398842f, -49.719509f, -0.00014896624f, 0.15978466f, -42.971691f, -0.00013246208f, \
+    0.1413047f, -37.813007f, -0.00011935214f, 0.12660381f, -33.703075f, -0.00010861351f, 0.11454226f, -30.325304f, \
+    -9.9600955e-05f, 0.10440131f, -27.480082f, -9.188382e-05f, 0.095701255f, -25.034229f, -8.5161191e-05f, 0.088107012f, \
+    -22.894735f, -7.9214624e-05f, 0.081375353f, -20.994104f, -7.3880066e-05f, 0.075323634f, -19.281666f, -6.9030422e-05f, \
+    0.06981039f, -17.718182f, -6.4564214e-05f, 0.064722665f, -16.272329f, -6.0397895e-05f, 0.059967488f, -14.918329f, \
+    -0.00030666869f, 0.3374927f, -92.874741f, -0.00023010642f, 0.25187004f, -68.997528f, -0.00018683427f, 0.20344536f, \
+    -55.487232f, -0.00015825024f, 0.17142946f, -46.547855f, -0.0001376272f, 0.14830489f, -40.084209f, -0.0001218712f, \
+    0.13061477f, -35.133102f, -0.00010933573f, 0.11651962f, -31.182158f, -9.9052908e-05f, 0.10493831f, -27.930311f, \
+    -9.0410875e-05f, 0.095187508f, -25.187317f, -8.3000414e-05f, 0.086810246f, -22.825998f, -7.6535114e-05f, 0.079486758f, \
+    -20.75738f, -7.0806687e-05f, 0.072984524f, -18.916775f, -6.5658387e-05f, 0.067128599f, -17.255535f, -6.0968527e-05f, \
+    0.061783183f, -15.7359f, -5.6639681e-05f, 0.05683957f, -14.327652f, -5.2591397e-05f, 0.052207995f, -13.005843f, \
+    -0.00028801555f, 0.31813633f, -87.87368f, -0.00021569297f, 0.23705834f, -65.21093f, -0.00017454363f, 0.19089599f, \
+    -52.301361f, -0.00014726285f, 0.16026382f, -43.727909f, -0.00012753296f, 0.13808523f, -37.513718f, -0.00011243228f, \
+    0.12108798f, -32.744965f, -0.00010040026f, 0.10752445f, -28.933739f, -9.0517038e-05f, 0.096364759f, -25.79258f, \
+    -8.2199891e-05f, 0.086956508f, -23.13945f, -7.5058364e-05f, 0.078862652f, -20.852432f, -6.8818728e-05f, 0.071776859f, \
+    -18.84609f, -6.3281565e-05f, 0.065475971f, -17.058208f, -5.829654e-05f, 0.059791803f, -15.441907f, -5.3746688e-05f, \
+    0.054593518f, -13.960723f, -4.9538139e-05f, 0.049776126f, -12.585405f, -4.5593144e-05f, 0.045252673f, -11.291736f, \
+    -0.00027144421f, 0.30093163f, -83.426292f, -0.00020283378f, 0.22384f, -61.830692f, -0.0001635526f, 0.17967196f, \
+    -49.451553f, -0.00013742124f, 0.15026218f, -41.201851f, -0.00011847993f, 0.12892006f, -35.208565f, -0.0001039582f, \
+    0.11253581f, -30.601368f, -9.2371069e-05f, 0.099442758f, -26.913948f, -8.2841034e-05f, 0.088656202f, -23.870872f, \
+    -7.481104e-05f, 0.079551101f, -21.297361f, -6.7907196e-05f, 0.071708024f, -19.076159f, -6.1866973e-05f, 0.064832494f, \
+    -17.12496f, -5.6498779e-05f, 0.058709648f, -15.383734f, -5.1657942e-05f, 0.053177267f, -13.807166f, -4.7231668e-05f, \
+    0.048108902f, -12.359941f, -4.3129221e-05f, 0.043402843f, -11.013666f, -3.9275248e-05f, 0.038974628f, -9.7447624f, \
+    -0.00025660623f, 0.2855193f, -79.440269f, -0.0001912764f, 0.21195683f, -58.791065f, -0.00015365344f, 0.16956192f, \
+    -46.884285f, -0.00012854407f, 0.14124072f, -38.923336f, -0.00011030443f, 0.12064402f, -33.127193f, -9.6298005e-05f, \
+    0.10480618f, -28.6642f, -8.5106898e-05f, 0.092132501f, -25.087284f, -7.5891236e-05f, 0.08167851f, -22.131739f, \
+    -6.8116795e-05f, 0.072843544f, -19.629257f, -6.1424442e-05f, 0.065223865f, -17.466745f, -5.5561588e-05f, 0.058535561f, \
+    -15.564693f, -5.0343631e-05f, 0.052571163f, -13.865019f, -4.5630924e-05f, 0.047173761f, -12.323803f, -4.1314383e-05f, \
+    0.042220809f, -10.906755f, -3.7306061e-05f, 0.037613519f, -9.5862398f, -3.3532742e-05f, 0.033269659f, -8.3392572f, \
+    -0.00024322509f, 0.27161407f, -75.8423f, -0.00018081832f, 0.20120165f, -56.039272f, -0.00014467837f, 0.16039512f, \
+    -44.556324f, -0.0001204842f, 0.13305026f, -36.854755f, -0.00010287319f, 0.11312239f, -31.23575f, -8.9328409e-05f, \
+    0.097774781f, -26.902315f, -7.8492041e-05f, 0.085477285f, -23.424654f, -6.9557893e-05f, 0.07532151f, -20.547695f, \
+    -6.201223e-05f, 0.066728681f, -18.108959f, -5.5509117e-05f, 0.05930914f, -15.999085f, -4.9804905e-05f, 0.052788466f, \
+    -14.14108f, -4.4721226e-05f, 0.046965819f, -12.478609f, -4.0122944e-05f, 0.041689049f, -10.969007f, -3.5904301e-05f, \
+    0.036839109f, -9.5789003f, -3.1979838e-05f, 0.032319833f, -8.2813368f, -2.8278264e-05f, 0.028050976f, -7.0538335f, \
+    -0.00023107827f, 0.25898647f, -72.573418f, -0.00017129499f, 0.19140607f, -53.532436f, -0.00013649026f, 0.15203197f, \
+    -42.43232f, -0.00011312079f, 0.12556832f, -34.965206f, -9.6076285e-05f, 0.10624407f, -29.506313f, -8.2947437e-05f, \
+    0.091338791f, -25.28994f, -7.2430528e-05f, 0.079380542f, -21.901917f, -6.3749765e-05f, 0.069493555f, -19.095882f, \
+    -5.6409888e-05f, 0.061118826f, -16.714634f, -5.0076887e-05f, 0.053879417f, -14.652193f, -4.451516e-05f, 0.047509484f, \
+    -12.833839f, -3.9551975e-05f, 0.041814163f, -11.204817f, -3.5056248e-05f, 0.036645602f, -9.7235937f, -3.0925206e-05f, \
+    0.031887904f, -8.3576231f, -2.7075652e-05f, 0.027447257f, -7.0805659f, -2.3438e-05f, 0.023245217f, -5.8704066f, \
+    -0.00021998472f, 0.24744967f, -69.585609f, -0.0001625712f, 0.18243176f, -51.235313f, -0.00012897571f, 0.14435704f, \
+    -40.483032f, -0.00010635347f, 0.11869302f, -33.229012f, -8.9822082e-05f, 0.099916384f, -27.915585f, -7.706973e-05f, \
+    0.0854121f, -23.805492f, -6.6841763e-05f, 0.07376115f, -20.498781f, -5.8389989e-05f, 0.064117432f, -17.75703f, \
+    -5.1235907e-05f, 0.055939898f, -15.427834f, -4.5056335e-05f, 0.04886318f, -13.408291f, -3.9622963e-05f, 0.042629216f, \
+    -11.625747f, -3.4768167e-05f, 0.037048571f, -10.026883f, -3.0364536e-05f, 0.031977281f, -8.5711946f, -2.6311989e-05f, \
+    0.027302297f, -7.2268806f, -2.2529357e-05f, 0.022931933f, -5.9681597f, -1.8948609e-05f, 0.01878937f, -4.7734361f, \
+    -0.0002097953f, 0.23684977f, -66.83934f, -0.00015453462f, 0.17416368f, -49.118603f, -0.00012203991f, 0.13727373f, \
+    -38.683994f, -0.00010009785f, 0.1123388f, -31.624573f, -8.4033192e-05f, 0.094061032f, -26.443882f, -7.1622926e-05f, \
+    0.079921678f, -22.43067f, -6.1657192e-05f, 0.068550073f, -19.197989f, -5.3412954e-05f, 0.059127185f, -16.514687f, \
+    -4.6427038e-05f, 0.051128417f, -14.232748f, -4.038612e-05f, 0.04419896f, -12.252093f, -3.506854e-05f, 0.038087849f, \
+    -10.501952f, -3.0311319e-05f, 0.032610588f, -8.9303179f, -2.5990374e-05f, 0.027626753f, -7.4976144f, -2.2008073e-05f, \
+    0.02302587f, -6.1727233f, -1.8285069e-05f, 0.018718183f, -4.9303651f, -1.4754741e-05f, 0.01462834f, -3.7493262f, \
+    -0.00020038594f, 0.22705874f, -64.301704f, -0.00014709088f, 0.1665052f, -47.157696f, -0.00011560266f, 0.13070035f, \
+    -37.014515f, -9.4282172e-05f, 0.10643277f, -30.133516f, -7.8643454e-05f, 0.088611074f, -25.074375f, -6.6544882e-05f, \
+    0.074804805f, -21.149738f, -5.6817655e-05f, 0.063687719f, -17.984631f, -4.8761834e-05f, 0.054465681f, -15.354584f, \
+    -4.1928277e-05f, 0.046629179f, -13.115623f, -3.6012698e-05f, 0.039833091f, -11.170256f, -3.0799525e-05f, 0.03383296f, \
+    -9.449441f, -2.6130012e-05f, 0.028448801f, -7.9023705f, -2.1883106e-05f, 0.02354341f, -6.4903216f, -1.7963388e-05f, \
+    0.019008659f, -5.1827903f, -1.4293159e-05f, 0.014756523f, -3.9549537f, -1.0807058e-05f, 0.010712969f, -2.7859402f, \
+    -0.00019165235f, 0.21796891f, -61.945045f, -0.00014015981f, 0.15937428f, -45.331688f, -0.00010959534f, 0.12456699f, \
+    -35.456886f, -8.8844594e-05f, 0.1009122f, -28.740011f, -7.3595533e-05f, 0.083508462f, -23.792473f, -6.1781444e-05f, \
+    0.07000678f, -19.94899f, -5.2271353e-05f, 0.059121881f, -16.84565f, -4.4386601e-05f, 0.05008259f, -14.264163f, \
+    -3.7690974e-05f, 0.042393319f, -12.064285f, -3.1888503e-05f, 0.035717864f, -10.150908f, -2.6769188e-05f, 0.02981774f, \
+    -8.456584f, -2.2178167e-05f, 0.024517108f, -6.9316058f, -1.7997136e-05f, 0.019681685f, -5.5380244f, -1.4132677e-05f, \
+    0.015205469f, -4.2458968f, -1.0508578e-05f, 0.011001999f, -3.0308096f, -7.0605902e-06f, 0.0069984132f, -1.8721987f, \
+    -0.00018350588f, 0.20948879f, -59.745846f, -0.00013367261f, 0.15270041f, -43.622616f, -0.00010395849f, 0.11881303f, \
+    -33.995754f, -8.3731138e-05f, 0.095722243f, -27.430225f, -6.8839014e-05f, 0.078702152f, -22.585335f, -5.7284647e-05f, \
+    0.065479167f, -18.816275f, -4.7972098e-05f, 0.054806001f, -15.769399f, -4.024239e-05f, 0.04593277f, -13.232152f, \
+    -3.3671255e-05f, 0.038376749f, -11.067746f, -2.7970393e-05f, 0.031809993f, -9.1832809f, -2.2934939e-05f, 0.025999507f, \
+    -7.5127788f, -1.841357e-05f, 0.020773247f, -6.0075378f, -1.4290494e-05f, 0.0159996f, -4.6303201f, -1.0474096e-05f, \
+    0.01157448f, -3.3516872f, -6.8894797e-06f, 0.0074128192f, -2.1475945f, -3.4733814e-06f, 0.0034427941f, -0.99774814f, \
+    -0.00017587047f, 0.20153986f, -57.683933f, -0.00012756948f, 0.14642231f, -42.014881f, -9.8639895e-05f, 0.11338527f, \
+    -32.617641f, -7.8893936e-05f, 0.0908143f, -26.191896f, -6.4328764e-05f, 0.074146442f, -21.441475f, -5.301123e-05f, \
+    0.061178248f, -17.740633f, -4.3877913e-05f, 0.050697748f, -14.745288f, -3.6288126e-05f, 0.041974857f, -12.248226f, \
+    -2.982868e-05f, 0.034538824f, -10.115876f, -2.4218363e-05f, 0.028069314f, -8.2573824f, -1.9257042e-05f, 0.02233842f, \
+    -6.6081238f, -1.4796638e-05f, 0.017177569f, -5.120326f, -1.0723636e-05f, 0.012457579f, -3.7573955f, -6.9480384e-06f, \
+    0.0080760848f, -2.4903514f, -3.3961176e-06f, 0.0039492599f, -1.2954752f, -5.4666867e-09f, 6.1866249e-06f, -0.15271217f, \
+    -0.00041784521f, 0.45253038f, -122.20592f, -0.0003180342f, 0.34222487f, -91.806625f, -0.00026387192f, 0.28231052f, \
+    -75.280632f, -0.0002288246f, 0.24349137f, -64.559616f, -0.00020385211f, 0.21578656f, -56.895397f, -0.00018493256f, \
+    0.19475621f, -51.06575f, -0.00016996956f, 0.17808615f, -46.433758f, -0.00015774689f, 0.16443408f, -42.630066f, \
+    -0.00014750156f, 0.15295786f, -39.422974f, -0.00013872437f, 0.14309554f, -36.657894f, -0.00013105752f, 0.13445218f, \
+    -34.22617f, -0.00012423741f, 0.12673678f, -32.047733f, -0.00011806061f, 0.11972467f, -30.060751f, -0.00011236205f, \
+    0.11323345f, -28.214993f, -0.00010699989f, 0.10710626f, -26.467218f, -0.00010184379f, 0.10119876f, -24.777601f, \
+    -0.00038365601f, 0.41709778f, -113.06279f, -0.00029223433f, 0.31572866f, -85.037041f, -0.00024208346f, 0.26006624f, \
+    -69.634361f, -0.00020943891f, 0.22378655f, -59.582172f, -0.00018608468f, 0.1977893f, -52.366879f, -0.00016833497f, \
+    0.17799228f, -46.861187f, -0.00015425761f, 0.16225578f, -42.474365f, -0.000142727f, 0.14933343f, -38.862377f, \
+    -0.00013303448f, 0.13844052f, -35.808659f, -0.00012470549f, 0.12905164f, -33.168221f, -0.00011740541f, 0.12079625f, \
+    -30.8388f, -0.00011088661f, 0.11340012f, -28.744726f, -0.00010495698f, 0.10665038f, -26.827225f, -9.9459437e-05f, \
+    0.10037294f, -25.03821f, -9.4257739e-05f, 0.094416626f, -23.335896f, -8.9225199e-05f, 0.088640749f, -21.681347f, \
+    -0.00035478178f, 0.38716641f, -105.33778f, -0.00027024007f, 0.29313898f, -79.26535f, -0.0002234171f, 0.24100982f, \
+    -64.797638f, -0.00019277773f, 0.20685284f, -55.305363f, -0.00017077923f, 0.18228829f, -48.467262f, -0.00015401229f, \
+    0.16352893f, -43.234501f, -0.0001406807f, 0.14857964f, -39.054672f, -0.00012973406f, 0.1362738f, -35.604832f, \
+    -0.00012050887f, 0.12587456f, -32.681038f, -0.00011255952f, 0.11688706f, -30.146339f, -0.00010557067f, 0.10896108f, \
+    -27.903816f, -9.9308076e-05f, 0.10183641f, -25.881458f, -9.3588991e-05f, 0.09531004f, -24.023054f, -8.8263012e-05f, \
+    0.089214735f, -22.282288f, -8.3198502e-05f, 0.083404034f, -20.618565f, -7.8271776e-05f, 0.077740178f, -18.99366f, \
+    -0.00033003645f, 0.36150983f, -98.714844f, -0.00025124123f, 0.2736252f, -74.279518f, -0.00020722461f, 0.22448044f, \
+    -60.60276f, -0.00017828448f, 0.19212502f, -51.58638f, -0.00015743839f, 0.1687801f, -45.069828f, -0.00014150878f, \
+    0.15090607f, -40.070229f, -0.00012881379f, 0.13662961f, -36.067528f, -0.00011836647f, 0.12485155f, -32.756645f, \
+    -0.00010954152f, 0.11487554f, -29.944334f, -0.0001019178f, 0.10623257f, -27.500458f, -9.5196316e-05f, 0.098589696f, \
+    -25.332636f, -8.9154142e-05f, 0.091698602f, -23.371964f, -8.3616469e-05f, 0.085364535f, -21.56439f, -7.8438512e-05f, \
+    0.079426095f, -19.865091f, -7.3492483e-05f, 0.073740728f, -18.234459f, -6.8657231e-05f, 0.068173125f, -16.634851f, \
+    -0.00030855826f, 0.33923697f, -92.964378f, -0.00023463798f, 0.25657231f, -69.922531f, -0.00019302127f, 0.2099838f, \
+    -56.924294f, -0.00016554014f, 0.17917754f, -48.317719f, -0.00014568605f, 0.15688396f, -42.078716f, -0.00013047854f, \
+    0.13977443f, -37.280712f, -0.0001183334f, 0.12607984f, -33.43137f, -0.00010831794f, 0.11475877f, -30.240925f, \
+    -9.9839614e-05f, 0.10514962f, -27.52533f, -9.2498238e-05f, 0.096805617f, -25.160309f, -8.6008877e-05f, 0.089408621f, \
+    -23.057381f, -8.0158279e-05f, 0.082720518f, -21.150307f, -7.4778458e-05f, 0.076553658f, -19.386881f, -6.9729394e-05f, \
+    0.07075157f, -17.723553f, -6.4886612e-05f, 0.065175042f, -16.121544f, -6.0131068e-05f, 0.0596908f, -14.543696f, \
+    -0.00028970529f, 0.31968415f, -87.915413f, -0.00021997621f, 0.24151476f, -66.075554f, -0.00018043691f, 0.19714233f, \
+    -53.666439f, -0.00015422284f, 0.16768341f, -45.416786f, -0.00013523198f, 0.14630598f, -39.41996f, -0.00012065379f, \
+    0.12986358f, -34.798088f, -0.00010898842f, 0.1166773f, -31.082865f, -9.9350182e-05f, 0.10575582f, -27.997837f, \
+    -9.117493e-05f, 0.096467748f, -25.366955f, -8.4080682e-05f, 0.088385589f, -23.071039f, -7.779467e-05f, 0.081204087f, \
+    -21.024992f, -7.2112045e-05f, 0.074693941f, -19.164892f, -6.68707e-05f, 0.068673648f, -17.44013f, -6.1934741e-05f, \
+    0.062991001f, -15.808245f, -5.7182522e-05f, 0.057509631f, -14.231169f, -5.2496864e-05f, 0.052098032f, -12.672153f, \
+    -0.00027298919f, 0.30234629f, -83.437866f, -0.00020690546f, 0.22809315f, -62.646862f, -0.00016918342f, 0.18566225f, \
+    -50.75465f, -0.0001440807f, 0.15738676f, -42.818932f, -0.00012584818f, 0.13681522f, -37.035416f, -0.00011182341f, \
+    0.12096024f, -32.568825f, -0.00010058031f, 0.1082219f, -28.971928f, -9.1274378e-05f, 0.097652808f, -25.979954f, \
+    -8.33663e-05f, 0.088648036f, -23.42388f, -7.6490047e-05f, 0.080797024f, -21.189003f, -7.0383525e-05f, 0.073805794f, \
+    -19.193195f, -6.4849213e-05f, 0.067452766f, -17.374563f, -5.9730144e-05f, 0.061561819f, -15.683887f, -5.4894015e-05f, \
+    0.055984411f, -14.079653f, -5.0221639e-05f, 0.050586656f, -12.524403f, -4.5597448e-05f, 0.045238569f, -10.981744f, \
+    -0.00025803124f, 0.28683195f, -79.430908f, -0.00019515039f, 0.21602514f, -59.564388f, -0.00015903273f, 0.17531091f, \
+    -48.129894f, -0.00013491318f, 0.14808384f, -40.472691f, -0.00011735225f, 0.12822695f, -34.87859f, -0.00010381795f, \
+    0.11289324f, -30.549967f, -9.2949296e-05f, 0.10055258f, -27.058239f, -8.3938139e-05f, 0.090296432f, -24.148996f, \
+    -7.6267177e-05f, 0.081543334f, -21.659439f, -6.9584457e-05f, 0.07389769f, -19.478828f, -6.3637301e-05f, 0.067075484f, \
+    -17.52767f, -5.8234666e-05f, 0.060861956f, -15.745849f, -5.3224077e-05f, 0.055085681f, -14.085372f, -4.8476377e-05f, \
+    0.049601354f, -12.505547f, -4.3874519e-05f, 0.044277214f, -10.969447f, -3.9304356e-05f, 0.038984627f, -9.4409847f, \
+    -0.00024453292f, 0.27283233f, -75.815033f, -0.00018449115f, 0.20508526f, -56.770599f, -0.00014980127f, 0.16590102f, \
+    -45.744659f, -0.00012655793f, 0.13960962f, -38.33638f, -0.00010959586f, 0.12039089f, -32.911652f, -9.6499018e-05f, \
+    0.10552274f, -28.706417f, -8.5964399e-05f, 0.093537286f, -25.30875f, -7.7216224e-05f, 0.083560675f, -22.47349f, \
+    -6.9756788e-05f, 0.075032339f, -20.0434f, -6.3246698e-05f, 0.067570038f, -17.911282f, -5.7441637e-05f, 0.060898632f, \
+    -15.999978f, -5.2156283e-05f, 0.054809391f, -14.250959f, -4.7242153e-05f, 0.04913504f, -12.617311f, -4.2572825e-05f, \
+    0.043733098f, -11.059059f, -3.8033126e-05f, 0.038473666f, -9.5397358f, -3.3510147e-05f, 0.033229258f, -8.0235128f, \
+    -0.00023225488f, 0.26010004f, -72.526558f, -0.00017474928f, 0.1950905f, -54.218803f, -0.00014133882f, 0.15727931f, \
+    -43.560074f, -0.00011888119f, 0.1318282f, -36.375675f, -0.00010245614f, 0.11318255f, -31.103277f, -8.9751455e-05f, \
+    0.098732367f, -27.008976f, -7.9516154e-05f, 0.087065667f, -23.695835f, -7.1003538e-05f, 0.077339768f, -20.927025f, \
+    -6.3733467e-05f, 0.069012903f, -18.550308f, -5.7377787e-05f, 0.061714794f, -16.461664f, -5.1699659e-05f, 0.055178225f, \
+    -14.58603f, -4.651886e-05f, 0.049199846f, -12.866285f, -4.1690411e-05f, 0.043616034f, -11.256468f, -3.7090304e-05f, \
+    0.038286787f, -9.7172308f, -3.2604959e-05f, 0.033083785f, -8.2124968f, -2.8122538e-05f, 0.027880536f, -6.7066579f, \
+    -0.00022100247f, 0.24843381f, -69.513672f, -0.00016577766f, 0.18589f, -51.87051f, -0.0001335203f, 0.14931819f, \
+    -41.543777f, -0.00011177077f, 0.12462554f, -34.561779f, -9.582928e-05f, 0.10649678f, -29.426998f, -8.3477404e-05f, \
+    0.092423208f, -25.432823f, -7.3511081e-05f, 0.081043422f, -22.1959f, -6.5209882e-05f, 0.071542948f, -19.486935f, \
+    -5.8109545e-05f, 0.06339696f, -17.158218f, -5.1892024e-05f, 0.056245986f, -15.108595f, -4.6327175e-05f, 0.049829915f, \
+    -13.264882f, -4.123932e-05f, 0.043950193f, -11.571218f, -3.6486574e-05f, 0.038446426f, -9.98248f, -3.1946998e-05f, \
+    0.033180725f, -8.4598618f, -2.7508378e-05f, 0.028026123f, -6.9676085f, -2.3059725e-05f, 0.022856904f, -5.4702883f, \
+    -0.00021061473f, 0.23766728f, -66.733582f, -0.00015745283f, 0.17735715f, -49.693447f, -0.00012623955f, 0.14190938f, \
+    -39.668312f, -0.00010513048f, 0.11790392f, -32.870026f, -8.9625617e-05f, 0.1002427f, -27.859959f, -7.7591641e-05f, \
+    0.086509161f, -23.956366f, -6.7867193e-05f, 0.07538791f, -20.788263f, -5.975569e-05f, 0.066090107f, -18.133224f, \
+    -5.2807245e-05f, 0.058106344f, -15.847656f, -4.671295e-05f, 0.051086895f, -13.832993f, -4.1248681e-05f, 0.044778049f, \
+    -12.017747f, -3.6242796e-05f, 0.038985506f, -10.347178f, -3.1556105e-05f, 0.033551686f, -8.7768927f, -2.7068427e-05f, \
+    0.028340509f, -7.2685418f, -2.2668641e-05f, 0.023226064f, -5.7866287f, -1.8246368e-05f, 0.018083187f, -4.295836f, \
+    -0.00020095645f, 0.2276607f, -64.150337f, -0.00014966923f, 0.16938375f, -47.660023f, -0.00011940452f, 0.134959f, \
+    -37.909889f, -9.8875913e-05f, 0.11157757f, -31.278769f, -8.3765546e-05f, 0.094339699f, -26.38188f, -7.2017821e-05f, \
+    0.080913059f, -22.560251f, -6.2510386e-05f, 0.070024379f, -19.454229f, -5.4568416e-05f, 0.060908243f, -16.847673f, \
+    -4.7755118e-05f, 0.053069271f, -14.600739f, -4.176985e-05f, 0.046166573f, -12.617213f, -3.6393882e-05f, 0.039952178f, \
+    -10.827134f, -3.1459131e-05f, 0.034235545f, -9.1767483f, -2.6828719e-05f, 0.028861523f, -7.622292f, -2.2383898e-05f, \
+    0.023695476f, -6.1257863f, -1.8014325e-05f, 0.018612258f, -4.6519127f, -1.3609945e-05f, 0.01348695f, -3.1653955f, \
+    -0.00019191189f, 0.21829455f, -61.733219f, -0.00014233449f, 0.16187514f, -45.746132f, -0.00011293324f, 0.12838347f, \
+    -36.247341f, -9.2930743e-05f, 0.10556895f, -29.768456f, -7.8176068e-05f, 0.08871384f, -24.974188f, -6.6685025e-05f, \
+    0.075563274f, -21.22653f, -5.7371039e-05f, 0.064882673f, -18.17626f, -4.9579248e-05f, 0.055928115f, -15.613008f, \
+    -4.2884771e-05f, 0.048217021f, -13.400355f, -3.699445e-05f, 0.041416511f, -11.444228f, -3.1694373e-05f, 0.035283744f, \
+    -9.6760244f, -2.6819545e-05f, 0.029631453f, -8.0428543f, -2.223501e-05f, 0.024306489f, -6.5014768f, -1.7823086e-05f, \
+    0.01917531f, -5.0141873f, -1.3473859e-05f, 0.014113157f, -3.5457568f, -9.0772173e-06f, 0.008994991f, -2.060858f, \
+    -0.00018337983f, 0.2094643f, -59.455383f, -0.00013536567f, 0.1547464f, -43.930149f, -0.00010675038f, 0.12210605f, \
+    -34.661243f, -8.7223387e-05f, 0.099805422f, -28.320776f, -7.2787559e-05f, 0.083294652f, -23.619179f, -6.1524566e-05f, \
+    0.070390448f, -19.937832f, -5.2380841e-05f, 0.059893943f, -16.937155f, -4.4719836e-05f, 0.051080965f, -14.412086f, \
+    -3.8127557e-05f, 0.043480646f, -12.229347f, -3.2317595e-05f, 0.036767337f, -10.296799f, -2.7080283e-05f, 0.030702734f, \
+    -8.5470419f, -2.2253251e-05f, 0.025102349f, -6.9279246f, -1.7703034e-05f, 0.019814599f, -5.396615f, -1.3312622e-05f, \
+    0.014706618f, -3.9155767f, -8.9721188e-06f, 0.0096536307f, -2.4495659f, -4.570923e-06f, 0.0045300317f, -0.96309537f, \
+    -0.00017526948f, 0.20107631f, -57.292801f, -0.00012868576f, 0.1479187f, -42.192028f, -0.00010078399f, 0.11605347f, \
+    -33.133068f, -8.1683778e-05f, 0.0942159f, -26.917833f, -6.7530404e-05f, 0.078011729f, -22.299185f, -5.6466568e-05f, \
+    0.065324068f, -18.676514f, -4.7469235e-05f, 0.054987136f, -15.719172f, -3.991873e-05f, 0.046294957f, -13.22701f, \
+    -3.3410983e-05f, 0.038787369f, -11.069614f, -2.766563e-05f, 0.032145202f, -9.1565828f, -2.2476685e-05f, 0.026134089f, \
+    -7.4215689f, -1.7683913e-05f, 0.020571822f, -5.8130245f, -1.31549e-05f, 0.015307923f, -4.2884059f, -8.7728677e-06f, \
+    0.010209749f, -2.8102338f, -4.4275293e-06f, 0.0051520858f, -1.3431416f, -7.3849749e-09f, 8.3575414e-06f, 0.14862035f, \
+    -0.0004565889f, 0.4940058f, -132.96927f, -0.00035049344f, 0.37682348f, -100.70853f, -0.00029391921f, 0.31423926f, \
+    -83.451637f, -0.00025767431f, 0.27406085f, -72.348671f, -0.00023204002f, 0.24557023f, -64.453545f, -0.00021274311f, \
+    0.2240549f, -58.471016f, -0.0001975695f, 0.20707309f, -53.730045f, -0.00018523708f, 0.19321066f, -49.841953f, \
+    -0.00017493864f, 0.18157703f, -46.561905f, -0.00016612952f, 0.17157093f, -43.724525f, -0.00015841762f, 0.16275911f, \
+    -41.210518f, -0.00015150046f, 0.15480685f, -38.927589f, -0.00014512477f, 0.14743336f, -36.798141f, -0.00013905563f, \
+    0.14037739f, -34.74979f, -0.00013304592f, 0.13336347f, -32.705986f, -0.00012679634f, 0.12605712f, -30.573521f, \
+    -0.00041773191f, 0.45366922f, -122.5467f, -0.00032129488f, 0.34679058f, -93.026085f, -0.00026921008f, 0.28897491f, \
+    -77.031532f, -0.00023560264f, 0.25159213f, -66.667068f, -0.00021171254f, 0.22494918f, -59.25975f, -0.00019365121f, \
+    0.20474343f, -53.623234f, -0.00017939077f, 0.18873103f, -49.138874f, -0.0001677508f, 0.17560562f, -45.446491f, \
+    -0.00015798448f, 0.16454062f, -42.31813f, -0.00014958526f, 0.15497495f, -39.598984f, -0.00014218592f, 0.14650159f, \
+    -37.176647f, -0.00013550054f, 0.13880314f, -34.963337f, -0.00012928656f, 0.13160983f, -32.8843f, -0.00012331505f, \
+    0.12466641f, -30.868618f, -0.00011734043f, 0.11769838f, -28.839821f, -0.0001110595f, 0.11036597f, -26.703014f, \
+    -0.00038539956f, 0.42011374f, -113.87822f, -0.00029671966f, 0.3215231f, -86.565025f, -0.00024829313f, 0.26759863f, \
+    -71.602013f, -0.00021685188f, 0.23251496f, -61.845669f, -0.00019440234f, 0.20739992f, -54.842216f, -0.0001773664f, \
+    0.18828215f, -49.493446f, -0.00016386727f, 0.17307864f, -45.223385f, -0.00015280742f, 0.16057111f, -41.695152f, \
+    -0.00014348949f, 0.1499853f, -38.694607f, -0.00013543808f, 0.14079309f, -36.075623f, -0.0001283064f, 0.13260895f, \
+    -33.731434f, -0.00012182206f, 0.12512963f, -31.57794f, -0.00011575111f, 0.11809419f, -29.542646f, -0.0001098693f, \
+    0.11125197f, -27.555731f, -0.00010393188f, 0.10432864f, -25.540588f, -9.7631746e-05f, 0.096979186f, -23.400635f, \
+    -0.00035801376f, 0.39170051f, -106.53999f, -0.00027570149f, 0.29992327f, -81.044159f, -0.00023031409f, 0.24923576f, \
+    -66.940399f, -0.00020068417f, 0.21607696f, -57.69381f, -0.00017944485f, 0.19224694f, -51.030399f, -0.00016327378f, \
+    0.1740478f, -45.92482f, -0.00015041936f, 0.15952985f, -41.83651f, -0.00013985288f, 0.14754805f, -38.448002f, \
+    -0.00013091812f, 0.13737175f, -35.556679f, -0.00012316571f, 0.12850036f, -33.023663f, -0.00011626587f, 0.12056624f, \
+    -30.746885f, -0.00010995739f, 0.11327785f, -28.645283f, -0.00010401344f, 0.1063815f, -26.648201f, -9.8213452e-05f, \
+    0.099629968f, -24.686621f, -9.231297e-05f, 0.092748627f, -22.68367f, -8.6001164e-05f, 0.085387409f, -20.541134f, \
+    -0.00033445956f, 0.36727193f, -100.23277f, -0.0002574707f, 0.2811988f, -76.26059f, -0.00021464955f, 0.2332481f, \
+    -62.884251f, -0.00018655747f, 0.20172544f, -54.071457f, -0.00016634967f, 0.17899187f, -47.698498f, -0.00015091832f, \
+    0.1615791f, -42.801285f, -0.00013861716f, 0.14764993f, -38.869179f, -0.00012847564f, 0.13612117f, -35.60112f, \
+    -0.00011987234f, 0.12629913f, -32.804272f, -0.00011237987f, 0.11770648f, -30.345888f, -0.00010568285f, 0.10999072f, \
+    -28.127863f, -9.9529498e-05f, 0.10287014f, -26.071688f, -9.3698858e-05f, 0.096096978f, -24.1082f, -8.7973262e-05f, \
+    0.089426711f, -22.168982f, -8.210825e-05f, 0.082584038f, -20.176805f, -7.5789532e-05f, 0.075214162f, -18.03191f, \
+    -0.00031392506f, 0.34598532f, -94.738762f, -0.00024145631f, 0.2647621f, -72.063873f, -0.00020083252f, 0.21915764f, \
+    -59.311924f, -0.00017406316f, 0.18904379f, -50.873085f, -0.00015474549f, 0.16725734f, -44.751274f, -0.00013995434f, \
+    0.15052578f, -40.034718f, -0.00012813341f, 0.13710801f, -36.23838f, -0.00011836195f, 0.12597394f, -33.075302f, \
+    -0.00011004834f, 0.11646154f, -30.361023f, -0.00010278407f, 0.10811344f, -27.968067f, -9.6266027e-05f, 0.10059007f, \
+    -25.801716f, -9.0250483e-05f, 0.093618043f, -23.785614f, -8.4521358e-05f, 0.086954564f, -21.851839f, -7.8863319e-05f, \
+    0.080357149f, -19.9324f, -7.3031639e-05f, 0.073549591f, -17.949656f, -6.6708883e-05f, 0.066172719f, -15.802411f, \
+    -0.0002958035f, 0.32721096f, -89.895302f, -0.00022722424f, 0.25016648f, -68.339691f, -0.00018850459f, 0.20659754f, \
+    -56.130108f, -0.00016288566f, 0.17771032f, -48.017239f, -0.00014434426f, 0.15675066f, -42.114887f, -0.00013011275f, \
+    0.14061511f, -37.556534f, -0.00011871268f, 0.12764587f, -33.879356f, -0.00010926643f, 0.11685882f, -30.80862f, \
+    -0.00010120824f, 0.10761943f, -28.167149f, -9.4145893e-05f, 0.099487625f, -25.832029f, -8.7786932e-05f, 0.092135012f, \
+    -23.711468f, -8.1894475e-05f, 0.085295297f, -21.730946f, -7.6256583e-05f, 0.078729823f, -19.823559f, -7.0659727e-05f, \
+    0.072197646f, -17.921616f, -6.4858752e-05f, 0.065421455f, -15.947021f, -5.8533326e-05f, 0.05803806f, -13.797245f, \
+    -0.00027963051f, 0.31046715f, -85.577988f, -0.00021443682f, 0.2370646f, -64.999168f, -0.00017738424f, 0.19527978f, \
+    -53.265564f, -0.00015277539f, 0.16747074f, -45.439526f, -0.00013491695f, 0.14723921f, -39.730656f, -0.00012117875f, \
+    0.13162948f, -35.312019f, -0.0001101504f, 0.1190567f, -31.740263f, -0.00010099207f, 0.10857707f, -28.751373f, \
+    -9.3160597e-05f, 0.099580087f, -26.174564f, -8.6278043e-05f, 0.091640815f, -23.890909f, -8.0061189e-05f, 0.084440559f, \
+    -21.811155f, -7.4279058e-05f, 0.077719145f, -19.862358f, -6.872318e-05f, 0.071241342f, -17.978453f, -6.3181426e-05f, \
+    0.064767286f, -16.091928f, -5.7407975e-05f, 0.058018405f, -14.124197f, -5.1079809e-05f, 0.050627738f, -11.971475f, \
+    -0.00026504265f, 0.29537705f, -81.68959f, -0.00020282532f, 0.2251801f, -61.971664f, -0.000167245f, 0.18497273f, \
+    -50.659412f, -0.00014352993f, 0.15811878f, -43.08778f, -0.00012627662f, 0.13853309f, -37.550732f, -0.00011297603f, \
+    0.12339035f, -33.25631f, -0.00010227795f, 0.11117015f, -29.7784f, -9.3375864e-05f, 0.10096432f, -26.86248f, \
+    -8.5746578e-05f, 0.09218365f, -24.343401f, -7.9024721e-05f, 0.084416471f, -22.105747f, -7.2935123e-05f, 0.077352561f, \
+    -20.062489f, -6.7251909e-05f, 0.070737004f, -18.142021f, -6.1769482e-05f, 0.064337373f, -16.278959f, -5.6276676e-05f, \
+    0.057914473f, -14.405872f, -5.0526811e-05f, 0.051188242f, -12.443621f, -4.4194221e-05f, 0.043788057f, -10.287214f, \
+    -0.00025174909f, 0.28163928f, -78.152367f, -0.00019217058f, 0.2142878f, -59.199627f, -0.00015789973f, 0.17548513f, \
+    -48.263084f, -0.00013498032f, 0.14948243f, -40.918499f, -0.00011826585f, 0.13047259f, -35.534863f, -0.00010535512f, \
+    0.1157464f, -31.35141f, -9.4951465e-05f, 0.10384094f, -27.95739f, -8.6278043e-05f, 0.093879752f, -25.106747f, \
+    -7.8829391e-05f, 0.085292503f, -22.639351f, -7.2251227e-05f, 0.077679306f, -20.44289f, -6.6275432e-05f, 0.070737332f, \
+    -18.432268f, -6.068049e-05f, 0.064216137f, -16.537027f, -5.5263106e-05f, 0.057885502f, -14.692307f, -4.9812643e-05f, \
+    0.051506449f, -12.830633f, -4.408124e-05f, 0.044797134f, -10.872251f, -3.7740425e-05f, 0.037383147f, -8.7109509f, \
+    -0.00023951133f, 0.26900682f, -74.902679f, -0.0001822888f, 0.20419897f, -56.63488f, -0.00014918884f, 0.16665399f, \
+    -46.035217f, -0.00012698041f, 0.14141305f, -38.894142f, -0.00011074694f, 0.12291808f, -33.647923f, -9.8183969e-05f, \
+    0.10856411f, -29.563814f, -8.8042812e-05f, 0.096939757f, -26.244881f, -7.9573205e-05f, 0.087197043f, -23.452656f, \
+    -7.2285518e-05f, 0.078782484f, -21.03149f, -6.5835266e-05f, 0.071306579f, -18.871822f, -5.9960472e-05f, 0.064472944f, \
+    -16.890238f, -5.4443273e-05f, 0.058034863f, -15.017232f, -4.9082089e-05f, 0.051763739f, -13.188308f, -4.3666307e-05f, \
+    0.04542027f, -11.33582f, -3.79464e-05f, 0.038720351f, -9.3792791f, -3.1590596e-05f, 0.031285346f, -7.2111597f, \
+    -0.00022812815f, 0.25727165f, -71.886978f, -0.00017302039f, 0.19474998f, -54.235706f, -0.00014097065f, 0.15833478f, \
+    -43.93919f, -0.00011939808f, 0.13377641f, -36.980854f, -0.0001035935f, 0.11574152f, -31.857729f, -9.1339716e-05f, \
+    0.10171934f, -27.862425f, -8.143139e-05f, 0.09034507f, -24.610495f, -7.3142168e-05f, 0.080796316f, -21.87031f, \
+    -6.5996544e-05f, 0.072534665f, -19.490231f, -5.9658683e-05f, 0.065179795f, -17.363117f, -5.3871892e-05f, 0.058440853f, \
+    -15.407005f, -4.8421221e-05f, 0.05207409f, -13.55314f, -4.3106164e-05f, 0.045851834f, -11.737215f, -3.7715447e-05f, \
+    0.039533794f, -9.8912411f, -3.1997133e-05f, 0.032832835f, -7.933804f, -2.5615216e-05f, 0.025365183f, -5.7558432f, \
+    -0.00021742377f, 0.24625224f, -69.058647f, -0.00016422063f, 0.18579261f, -51.964386f, -0.00013311279f, 0.15039271f, \
+    -41.94091f, -0.00011210691f, 0.12644425f, -35.146328f, -9.668203e-05f, 0.10881804f, -30.13294f, -8.4700267e-05f, \
+    0.095088959f, -26.216431f, -7.499558e-05f, 0.083934449f, -23.023685f, -6.6863191e-05f, 0.074555255f, -20.329258f, \
+    -5.9840193e-05f, 0.066426396f, -17.985088f, -5.3598298e-05f, 0.059175555f, -15.88616f, -4.7885191e-05f, 0.052516472f, \
+    -13.951703f, -4.2488045e-05f, 0.046207536f, -12.113501f, -3.7206606e-05f, 0.040021162f, -10.307222f, -3.1828025e-05f, \
+    0.033715095f, -8.4642849f, -2.6096792e-05f, 0.026998017f, -6.5020628f, -1.9670992e-05f, 0.019479342f, -4.3095465f, \
+    -0.00020723752f, 0.23578306f, -66.375244f, -0.00015575056f, 0.17718489f, -49.784863f, -0.0001254833f, 0.14269367f, \
+    -40.006512f, -0.00010497691f, 0.11928495f, -33.357479f, -8.988232e-05f, 0.10201619f, -28.440636f, -7.8134159e-05f, \
+    0.088540561f, -24.592766f, -6.8602145e-05f, 0.077574007f, -21.451094f, -6.0600971e-05f, 0.068338111f, -18.795753f, \
+    -5.3678865e-05f, 0.060319819f, -16.481861f, -4.7513968e-05f, 0.053153634f, -14.406206f, -4.1857351e-05f, 0.046556838f, \
+    -12.488952f, -3.6497338e-05f, 0.040288944f, -10.662151f, -3.1232827e-05f, 0.034121312f, -8.8611574f, -2.584806e-05f, \
+    0.027808368f, -7.0164471f, -2.0082152e-05f, 0.021052767f, -5.0437193f, -1.3584609e-05f, 0.013454408f, -2.8293426f, \
+    -0.00019741362f, 0.225704f, -63.795837f, -0.0001474669f, 0.16878082f, -47.660141f, -0.00011793973f, 0.13509315f, \
+    -38.099594f, -9.7862532e-05f, 0.11215144f, -31.577423f, -8.3044346e-05f, 0.095184781f, -26.743021f, -7.1486422e-05f, \
+    0.081918359f, -22.952597f, -6.209116e-05f, 0.071103267f, -19.852814f, -5.4190717e-05f, 0.06197983f, -17.228828f, \
+    -4.7343001e-05f, 0.054045342f, -14.93852f, -4.1231327e-05f, 0.046939809f, -12.880145f, -3.5608937e-05f, 0.040382799f, \
+    -10.974464f, -3.0264004e-05f, 0.034133594f, -9.1534586f, -2.499306e-05f, 0.027960926f, -7.3517561f, -1.9575496e-05f, \
+    0.021613905f, -5.4983897f, -1.374247e-05f, 0.014786522f, -3.5067117f, -7.1311638e-06f, 0.0070653628f, -1.2595149f, \
+    -0.00018778937f, 0.21584842f, -61.277966f, -0.00013920871f, 0.16041674f, -45.548882f, -0.00011031327f, 0.12742037f, \
+    -36.177242f, -9.0584428e-05f, 0.10486285f, -29.760887f, -7.597782e-05f, 0.088132463f, -24.992352f, -6.4556356e-05f, \
+    0.075020969f, -21.245806f, -5.5252323e-05f, 0.064311609f, -18.17655f, -4.7413374e-05f, 0.055261359f, -15.5742f, \
+    -4.0605468e-05f, 0.047376122f, -13.298944f, -3.4515542e-05f, 0.040299781f, -11.250081f, -2.8897424e-05f, 0.033752546f, \
+    -9.3485441f, -2.3537365e-05f, 0.027491625f, -7.5257659f, -1.8227458e-05f, 0.021280982f, -5.7151036f, -1.273972e-05f, \
+    0.014861806f, -3.8434777f, -6.794256e-06f, 0.0079162559f, -1.82109f, -1.2099281e-08f, 1.3692694e-05f, 0.47383311f, \
+    -0.00053257588f, 0.57561833f, -154.48447f, -0.0004099597f, 0.44035214f, -117.31239f, -0.00034671373f, 0.37041491f, \
+    -98.043869f, -0.00030706331f, 0.32642892f, -85.882729f, -0.00027954648f, 0.29577589f, -77.369156f, -0.00025922476f, \
+    0.27301818f, -71.012032f, -0.0002435717f, 0.25537294f, -66.047989f, -0.0002311353f, 0.24123964f, -62.03764f, \
+    -0.00022100276f, 0.22961085f, -58.704021f, -0.00021255271f, 0.21979918f, -55.857719f, -0.00020532473f, 0.21129358f, \
+    -53.357361f, -0.0001989396f, 0.20367107f, -51.085358f, -0.00019303686f, 0.19652747f, -48.928677f, -0.00018720406f, \
+    0.18939811f, -46.756748f, -0.00018085669f, 0.181623f, -44.383675f, -0.00017295824f, 0.17203115f, -41.479477f, \
+    -0.00048423841f, 0.52530998f, -141.45732f, -0.00037418719f, 0.40346915f, -107.8594f, -0.00031650034f, 0.33945039f, \
+    -90.160881f, -0.00028000248f, 0.29881766f, -78.888634f, -0.00025449781f, 0.27030727f, -70.943909f, -0.00023554271f, \
+    0.2490094f, -64.975853f, -0.0002208454f, 0.23239097f, -60.287327f, -0.00020907946f, 0.21898498f, -56.474289f, \
+    -0.00019940498f, 0.2078613f, -53.280262f, -0.00019124486f, 0.19837959f, -50.528259f, -0.00018416597f, 0.19005771f, \
+    -48.084579f, -0.00017780482f, 0.18248934f, -45.836021f, -0.00017180739f, 0.17527676f, -43.671211f, -0.00016575727f, \
+    0.16795039f, -41.458096f, -0.00015904976f, 0.15982664f, -39.003979f, -0.00015059084f, 0.1496678f, -35.959682f, \
+    -0.00044501494f, 0.48452204f, -130.90324f, -0.00034471642f, 0.37311432f, -100.08646f, -0.00029143205f, 0.31378761f, \
+    -83.634033f, -0.00025746005f, 0.27584407f, -73.075348f, -0.00023358273f, 0.24906786f, -65.591393f, -0.00021574333f, \
+    0.22896235f, -59.941257f, -0.00020183509f, 0.21319158f, -55.480114f, -0.00019063131f, 0.20039459f, -51.832047f, \
+    -0.00018135022f, 0.18970302f, -48.756912f, -0.00017345033f, 0.18051429f, -46.087727f, -0.00016652051f, 0.17236955f, \
+    -43.696926f, -0.00016021002f, 0.16487578f, -41.474777f, -0.00015416976f, 0.15764004f, -39.311077f, -0.00014797936f, \
+    0.15018752f, -37.072117f, -0.00014101526f, 0.14181229f, -34.558666f, -0.0001321306f, 0.13121438f, -31.403393f, \
+    -0.00041245192f, 0.45069343f, -122.15715f, -0.00031993934f, 0.34762388f, -93.565697f, -0.00027022749f, 0.29210821f, \
+    -78.126419f, -0.00023832505f, 0.25636974f, -68.153343f, -0.00021579169f, 0.23102663f, -61.050407f, -0.00019888121f, \
+    0.21191421f, -55.665138f, -0.00018563632f, 0.19685589f, -51.395061f, -0.00017491127f, 0.1845769f, -47.887115f, \
+    -0.0001659718f, 0.17425935f, -44.914524f, -0.00015830556f, 0.16533156f, -42.318455f, -0.0001515195f, 0.15735367f, \
+    -39.976357f, -0.00014527324f, 0.14994344f, -37.781273f, -0.00013922139f, 0.14271133f, -35.623768f, -0.00013293947f, \
+    0.13517702f, -33.368374f, -0.00012578629f, 0.1266133f, -30.809549f, -0.0001165666f, 0.11566264f, -27.563009f, \
+    -0.00038489254f, 0.42209563f, -114.77042f, -0.0002987397f, 0.32584345f, -88.000374f, -0.00025198559f, 0.27348545f, \
+    -73.401314f, -0.00022181052f, 0.23958874f, -63.917721f, -0.00020040666f, 0.21545058f, -57.135326f, -0.00018428244f, \
+    0.1971789f, -51.974342f, -0.00017160381f, 0.18272862f, -47.867279f, -0.00016129209f, 0.17089637f, -44.480022f, \
+    -0.00015265246f, 0.16090617f, -41.596889f, -0.00014519687f, 0.15221202f, -39.065838f, -0.00013854727f, 0.14438993f, \
+    -36.768456f, -0.00013237183f, 0.1370663f, -34.600021f, -0.00012632794f, 0.12985404f, -32.451561f, -0.00011998681f, \
+    0.12226699f, -30.185776f, -0.00011269071f, 0.11355781f, -27.591066f, -0.00010320052f, 0.10231617f, -24.267471f, \
+    -0.00036117286f, 0.397515f, -108.42826f, -0.00028031427f, 0.30694282f, -83.177216f, -0.00023605028f, 0.25724503f, \
+    -69.286583f, -0.00020733962f, 0.22491047f, -60.218441f, -0.00018689902f, 0.20180035f, -53.709644f, -0.00017144966f, \
+    0.18425035f, -48.741226f, -0.00015926082f, 0.17032586f, -44.775078f, -0.00014931028f, 0.15888356f, -41.493042f, \
+    -0.00014093646f, 0.14918283f, -38.688793f, -0.00013367184f, 0.14069937f, -36.216011f, -0.00012715106f, 0.13302241f, \
+    -33.959747f, -0.00012104927f, 0.12578554f, -31.817083f, -0.0001150259f, 0.11860312f, -29.679277f, -0.00010864779f, \
+    0.11098315f, -27.407137f, -0.00010124157f, 0.10215905f, -24.78327f, -9.1528658e-05f, 0.090672523f, -21.393332f, \
+    -0.00034044639f, 0.37606969f, -102.90208f, -0.00026406595f, 0.29030526f, -78.937927f, -0.00022192825f, 0.24288024f, \
+    -65.652962f, -0.00019447539f, 0.21188799f, -56.94202f, -0.00017486655f, 0.18966579f, -50.66964f, -0.00016000328f, \
+    0.17274265f, -45.868504f, -0.00014824285f, 0.1592779f, -42.025539f, -0.00013861118f, 0.14817958f, -38.83622f, \
+    -0.00013047518f, 0.13873723f, -36.102207f, -0.00012338479f, 0.13044505f, -33.682064f, -0.00011698537f, 0.12290349f, \
+    -31.463745f, -0.00011095801f, 0.11575201f, -29.345808f, -0.00010496345f, 0.10860576f, -27.219542f, -9.8564036e-05f, \
+    0.10096671f, -24.943821f, -9.1071641e-05f, 0.092050016f, -22.295713f, -8.1172097e-05f, 0.080353677f, -18.847673f, \
+    -0.00032207763f, 0.3570981f, -98.020615f, -0.00024953656f, 0.27545801f, -75.161263f, -0.00020923621f, 0.22999775f, \
+    -62.400234f, -0.00018287558f, 0.20017153f, -53.999744f, -0.00016399227f, 0.1787241f, -47.933739f, -0.00014964295f, \
+    0.16235068f, -43.279346f, -0.00013826069f, 0.14929172f, -39.54509f, -0.00012891305f, 0.1384995f, -36.438213f, \
+    -0.00012099139f, 0.12928963f, -33.767269f, -0.00011406081f, 0.12117223f, -31.39501f, -0.00010777586f, 0.1137573f, \
+    -29.211872f, -0.00010182249f, 0.1066891f, -27.11758f, -9.5862168e-05f, 0.099582925f, -25.003292f, -8.9452617e-05f, \
+    0.091934547f, -22.72591f, -8.1891565e-05f, 0.082941554f, -20.05714f, -7.1832452e-05f, 0.071061887f, -16.557268f, \
+    -0.00030557386f, 0.34008813f, -93.65139f, -0.00023636247f, 0.26202637f, -71.751259f, -0.00019766545f, 0.21828125f, \
+    -59.447887f, -0.00017226143f, 0.18947665f, -51.31958f, -0.00015401597f, 0.16871054f, -45.435169f, -0.00014012055f, \
+    0.15282284f, -40.910477f, -0.00012907441f, 0.14012451f, -37.272861f, -0.00011998131f, 0.12960654f, -34.239811f, \
+    -0.00011225402f, 0.12060718f, -31.625891f, -0.00010547069f, 0.11265031f, -29.297461f, -9.9293728e-05f, 0.10535406f, \
+    -27.14706f, -9.3413044e-05f, 0.098366544f, -25.075335f, -8.7490313e-05f, 0.091302566f, -22.973143f, -8.1078288e-05f, \
+    0.083651431f, -20.695328f, -7.3460891e-05f, 0.074593492f, -18.00836f, -6.3261374e-05f, 0.062549233f, -14.461094f, \
+    -0.00029053958f, 0.32462934f, -89.688484f, -0.00022424335f, 0.24970153f, -68.628983f, -0.00018695586f, 0.20746474f, \
+    -56.728363f, -0.0001623946f, 0.17956062f, -48.840149f, -0.00014471247f, 0.15939663f, -43.116371f, -0.00013121952f, \
+    0.14393982f, -38.706863f, -0.00012047312f, 0.13156332f, -35.15554f, -0.00011160887f, 0.12129196f, -32.188904f, \
+    -0.00010405825f, 0.11248384f, -29.626759f, -9.7410753e-05f, 0.10467476f, -27.338596f, -9.1335474e-05f, 0.097489737f, \
+    -25.218716f, -8.5525404e-05f, 0.090579778f, -23.168442f, -7.9641744e-05f, 0.08355853f, -21.078146f, -7.3231771e-05f, \
+    0.075908236f, -18.800482f, -6.5565364e-05f, 0.066791892f, -16.096642f, -5.5236418e-05f, 0.054593578f, -12.504424f, \
+    -0.00027664361f, 0.310379f, -86.04364f, -0.00021291808f, 0.23821561f, -65.726128f, -0.00017687495f, 0.19731112f, \
+    -54.181591f, -0.00015305745f, 0.17020236f, -46.505718f, -0.00013587282f, 0.15057075f, -40.924194f, -0.00012273621f, \
+    0.13549604f, -36.617012f, -0.00011225652f, 0.12340635f, -33.14275f, -0.00010359749f, 0.11335646f, -30.235857f, \
+    -9.620699e-05f, 0.10472182f, -27.720726f, -8.9684298e-05f, 0.097048499f, -25.469534f, -8.3704028e-05f, 0.089967132f, \
+    -23.378023f, -7.796134e-05f, 0.083130687f, -21.347937f, -7.211609e-05f, 0.076150715f, -19.268923f, -6.5709166e-05f, \
+    0.068501472f, -16.991194f, -5.7995316e-05f, 0.059327468f, -14.270406f, -4.7537833e-05f, 0.046975363f, -10.633095f, \
+    -0.00026359258f, 0.29703462f, -82.639229f, -0.00020214308f, 0.22731966f, -62.979435f, -0.00016719765f, 0.18759157f, \
+    -51.749775f, -0.00014403323f, 0.16118239f, -44.261101f, -0.00012728415f, 0.14201806f, -38.804825f, -0.00011445954f, \
+    0.12727897f, -34.587864f, -0.00010421421f, 0.11544224f, -31.18185f, -9.5736745e-05f, 0.10558905f, -28.328245f, \
+    -8.8489331e-05f, 0.097109981f, -25.85544f, -8.2079503e-05f, 0.089559764f, -23.637873f, -7.6186196e-05f, 0.082573384f, \
+    -21.57239f, -7.0505601e-05f, 0.075804546f, -19.560835f, -6.4694948e-05f, 0.06886138f, -17.491793f, -5.8287107e-05f, \
+    0.061208442f, -15.212589f, -5.0519153e-05f, 0.051969171f, -12.47269f, -3.9919236e-05f, 0.039448265f, -8.7862663f, \
+    -0.00025110581f, 0.28430793f, -79.401573f, -0.00019166876f, 0.21675956f, -60.324566f, -0.00015768208f, 0.17806108f, \
+    -49.371258f, -0.00013508048f, 0.15225706f, -42.045242f, -0.00011870279f, 0.13349336f, -36.697029f, -0.00010614263f, \
+    0.11904079f, -32.557705f, -9.6095828e-05f, 0.10742019f, -29.210546f, -8.777294e-05f, 0.097736038f, -26.403196f, \
+    -8.064838e-05f, 0.089391828f, -23.967453f, -7.4336342e-05f, 0.081949234f, -21.779573f, -6.8518559e-05f, 0.075046025f, \
+    -19.737087f, -6.2890656e-05f, 0.068334959f, -17.74151f, -5.7105251e-05f, 0.061418667f, -15.679813f, -5.0684142e-05f, \
+    0.053748816f, -13.395627f, -4.2841599e-05f, 0.044422481f, -10.630868f, -3.2060128e-05f, 0.031691689f, -6.884655f, \
+    -0.0002388846f, 0.27189377f, -76.253075f, -0.00018120707f, 0.2062432f, -57.687859f, -0.00014803304f, 0.1684217f, \
+    -46.971291f, -0.00012589208f, 0.14311738f, -39.780937f, -0.00010980873f, 0.12467557f, -34.520836f, -9.7453216e-05f, \
+    0.11044884f, -30.443911f, -8.7558146e-05f, 0.098997191f, -27.143843f, -7.9353187e-05f, 0.089445315f, -24.373636f, \
+    -7.2322779e-05f, 0.08120729f, -21.96788f, -6.6085719e-05f, 0.073849544f, -19.804075f, -6.032439e-05f, 0.06701038f, \
+    -17.779861f, -5.4731292e-05f, 0.060338952f, -15.795727f, -4.8950806e-05f, 0.05342862f, -13.736067f, -4.248798e-05f, \
+    0.045712274f, -11.439293f, -3.4524019e-05f, 0.036249992f, -8.6370535f, -2.3473811e-05f, 0.023218615f, -4.8077083f, \
+    -0.00022656674f, 0.25942379f, -73.100456f, -0.00017037556f, 0.19538416f, -54.972195f, -0.00013783354f, 0.1582537f, \
+    -44.444889f, -0.00011601405f, 0.13330774f, -37.35463f, -0.00010011297f, 0.1150751f, -32.154583f, -8.7871078e-05f, \
+    0.10098339f, -28.117649f, -7.8054058e-05f, 0.089627609f, -24.846786f, -6.9907604e-05f, 0.080149405f, -22.099478f, \
+    -6.2923194e-05f, 0.071970224f, -19.712269f, -5.6721041e-05f, 0.064657964f, -17.563042f, -5.0980496e-05f, 0.057847623f, \
+    -15.548552f, -4.5386147e-05f, 0.051179778f, -13.566998f, -3.956728e-05f, 0.044231426f, -11.498368f, -3.3000993e-05f, \
+    0.036405075f, -9.1728764f, -2.4815072e-05f, 0.026702803f, -6.3065352f, -1.3313966e-05f, 0.013182304f, -2.3457682f, \
+    -0.00021364121f, 0.24638027f, -69.813141f, -0.00015857887f, 0.18358232f, -52.027142f, -0.00012638923f, 0.14685963f, \
+    -41.617958f, -0.00010465544f, 0.12203589f, -34.569221f, -8.8738125e-05f, 0.1038152f, -29.380783f, -7.6445431e-05f, \
+    0.089696273f, -25.344318f, -6.6572364e-05f, 0.078304887f, -22.070881f, -5.8375979e-05f, 0.068794578f, -19.321085f, \
+    -5.1349249e-05f, 0.060588386f, -16.931921f, -4.5107452e-05f, 0.053249083f, -14.779961f, -3.9319413e-05f, 0.046400644f, \
+    -12.759108f, -3.3652297e-05f, 0.039665271f, -10.762753f, -2.7706894e-05f, 0.032589741f, -8.6629295f, -2.0911593e-05f, \
+    0.024524707f, -6.2761436f, -1.2306341e-05f, 0.014378723f, -3.293673f, -2.4972094e-08f, 2.8260767e-05f, 0.88586324f, \
+    -0.0006465831f, 0.69817024f, -186.94437f, -0.00049455935f, 0.53078377f, -141.06616f, -0.00042013402f, 0.44856301f, \
+    -118.44622f, -0.0003751292f, 0.39861044f, -104.63123f, -0.00034495984f, 0.36490664f, -95.242683f, -0.00032353739f, \
+    0.34076038f, -88.4506f, -0.00030782149f, 0.32282662f, -83.339012f, -0.00029610356f, 0.30922136f, -79.390694f, \
+    -0.00028733385f, 0.29878211f, -76.285057f, -0.00028081314f, 0.29072902f, -73.805229f, -0.00027602926f, 0.28448391f, \
+    -71.788376f, -0.00027254861f, 0.27954975f, -70.092194f, -0.00026990959f, 0.2753903f, -68.561058f, -0.00026744269f, \
+    0.27122608f, -66.968262f, -0.00026379668f, 0.26549652f, -64.863701f, -0.00025507095f, 0.25374147f, -60.9743f, \
+    -0.00058215752f, 0.63088632f, -169.47137f, -0.00044834125f, 0.48298177f, -128.78328f, -0.00038138728f, 0.40873295f, \
+    -108.28175f, -0.0003403899f, 0.36305869f, -95.604897f, -0.00031262703f, 0.33193377f, -86.90567f, -0.00029270846f, \
+    0.30941269f, -80.552383f, -0.00027791236f, 0.2924903f, -75.71933f, -0.00026669248f, 0.27945587f, -71.935417f, \
+    -0.0002580861f, 0.26924026f, -68.905014f, -0.0002514394f, 0.26111293f, -66.424698f, -0.00024625906f, 0.25451711f, \
+    -64.337761f, -0.00024210967f, 0.24895556f, -62.502457f, -0.00023850617f, 0.24386911f, -60.757816f, -0.00023472345f, \
+    0.23842062f, -58.862522f, -0.00022928209f, 0.23091079f, -56.329384f, -0.00021786074f, 0.21640554f, -51.752712f, \
+    -0.00053180335f, 0.57837915f, -155.85362f, -0.00041142694f, 0.44486782f, -119.00412f, -0.00035015403f, 0.37668502f, \
+    -100.11596f, -0.00031225962f, 0.33432513f, -88.321411f, -0.00028639153f, 0.30523098f, -80.165131f, -0.00026768196f, \
+    0.28401554f, -74.164062f, -0.00025365068f, 0.2679314f, -69.561035f, -0.00024287651f, 0.25540131f, -65.920471f, \
+    -0.00023446514f, 0.24542952f, -62.96632f, -0.00022780018f, 0.23732571f, -60.506042f, -0.00022240581f, 0.2305526f, \
+    -58.388348f, -0.00021784889f, 0.2246161f, -56.472637f, -0.00021363035f, 0.21894276f, -54.594444f, -0.00020898541f, \
+    0.21265271f, -52.501163f, -0.00020233072f, 0.20393074f, -49.673553f, -0.00018895864f, 0.18739919f, -44.579449f, \
+    -0.00049123319f, 0.5361498f, -144.91782f, -0.00038116431f, 0.41368416f, -111.01661f, -0.00032435195f, 0.35026616f, \
+    -93.396545f, -0.00028893058f, 0.31054837f, -82.305618f, -0.00026459413f, 0.28309566f, -74.588196f, -0.00024687927f, \
+    0.26295349f, -68.876404f, -0.00023349488f, 0.24757633f, -64.466759f, -0.00022311865f, 0.23549248f, -60.951771f, \
+    -0.00021491139f, 0.22576502f, -58.071091f, -0.00020828759f, 0.21773688f, -55.641083f, -0.00020278701f, 0.21088766f, \
+    -53.515076f, -0.00019798007f, 0.20472731f, -51.553688f, -0.00019335827f, 0.19867222f, -49.589806f, -0.00018812553f, \
+    0.19180772f, -47.361256f, -0.00018060837f, 0.18221553f, -44.319656f, -0.00016574103f, 0.16410145f, -38.812531f, \
+    -0.0004577355f, 0.50135547f, -135.92314f, -0.00035580879f, 0.38761818f, -104.3531f, -0.00030258804f, 0.32803723f, \
+    -87.754623f, -0.00026918345f, 0.29047403f, -77.237572f, -0.00024611183f, 0.26437631f, -69.882324f, -0.00022923134f, \
+    0.2451335f, -64.412682f, -0.00021640254f, 0.23036195f, -60.168217f, -0.00020638318f, 0.21867537f, -56.764137f, \
+    -0.00019837922f, 0.20918503f, -53.952934f, -0.00019183099f, 0.20126146f, -51.558353f, -0.00018629174f, 0.1943987f, \
+    -49.437614f, -0.00018133581f, 0.18811081f, -47.45245f, -0.00017644765f, 0.18180619f, -45.433525f, -0.000170805f, \
+    0.17454007f, -43.110172f, -0.00016265351f, 0.16430014f, -39.906925f, -0.00014659821f, 0.14490509f, -34.058422f, \
+    -0.00042949943f, 0.47209951f, -128.37582f, -0.00033415642f, 0.36542025f, -98.691505f, -0.00028388668f, 0.30899149f, \
+    -82.932373f, -0.00025215786f, 0.27321792f, -72.891937f, -0.00023014921f, 0.24825825f, -65.840752f, -0.00021398015f, \
+    0.22978139f, -60.577084f, -0.0002016353f, 0.21553604f, -56.475735f, -0.00019193842f, 0.20420629f, -53.170601f, \
+    -0.00018413304f, 0.19494338f, -50.424809f, -0.00017768127f, 0.18714106f, -48.068268f, -0.00017214817f, 0.18030584f, \
+    -45.961533f, -0.00016711176f, 0.17395552f, -43.967262f, -0.00016205099f, 0.1674917f, -41.914169f, -0.00015612082f, \
+    0.15994294f, -39.523838f, -0.00014749331f, 0.14921008f, -36.195488f, -0.00013047371f, 0.12875582f, -30.059025f, \
+    -0.00040525809f, 0.44705689f, -121.93137f, -0.00031533951f, 0.34619111f, -93.800354f, -0.00026753487f, 0.29239413f, \
+    -78.741898f, -0.00023722011f, 0.25812969f, -69.103241f, -0.00021611805f, 0.23413986f, -62.310993f, -0.00020056419f, \
+    0.21632446f, -57.224983f, -0.00018864633f, 0.20254229f, -53.249264f, -0.00017924349f, 0.19153619f, -50.03334f, \
+    -0.00017163088f, 0.18249109f, -47.34927f, -0.00016528922f, 0.17482045f, -45.032196f, -0.0001597938f, 0.16804154f, \
+    -42.945488f, -0.00015472609f, 0.16167541f, -40.952602f, -0.00014956047f, 0.15511782f, -38.880436f, -0.00014343169f, \
+    0.14737307f, -36.443439f, -0.00013444436f, 0.13626139f, -33.017071f, -0.00011663223f, 0.11492012f, -26.634741f, \
+    -0.00038408581f, 0.42526132f, -116.33894f, -0.00029870565f, 0.32925603f, -89.506302f, -0.00025298831f, 0.27768552f, \
+    -75.040344f, -0.0002238819f, 0.24470946f, -65.744514f, -0.00020356255f, 0.22155605f, -59.175411f, -0.0001885471f, \
+    0.20431876f, -54.244457f, -0.00017701037f, 0.19094905f, -50.380325f, -0.00016787821f, 0.18023954f, -47.24572f, \
+    -0.00016045288f, 0.17140381f, -44.620281f, -0.00015423109f, 0.16387221f, -42.343601f, -0.00014879709f, 0.15717126f, \
+    -40.281464f, -0.00014373549f, 0.15082493f, -38.297981f, -0.00013851673f, 0.14422368f, -36.218365f, -0.0001322574f, \
+    0.13634951f, -33.750397f, -0.0001229998f, 0.12494762f, -30.247204f, -0.00010453154f, 0.10285743f, -23.653194f, \
+    -0.00036527548f, 0.40597671f, -111.40803f, -0.00028374061f, 0.31408477f, -85.673492f, -0.00023980971f, 0.26441741f, \
+    -71.713654f, -0.000211746f, 0.23255178f, -62.713078f, -0.00019210877f, 0.21012646f, -56.338051f, -0.000177569f, \
+    0.19339925f, -51.543739f, -0.0001663758f, 0.18040058f, -47.779766f, -0.00015749515f, 0.16996558f, -44.720085f, \
+    -0.00015025253f, 0.16133241f, -42.150822f, -0.00014415855f, 0.153946f, -39.915386f, -0.00013880525f, 0.14734086f, \
+    -37.881634f, -0.00013378009f, 0.14104345f, -35.914185f, -0.00012854996f, 0.13443926f, -33.836647f, -0.00012221477f, \
+    0.12648964f, -31.350525f, -0.00011275895f, 0.11486919f, -27.787802f, -9.3744369e-05f, 0.092142075f, -21.010111f, \
+    -0.00034825847f, 0.38861367f, -106.98662f, -0.00027001405f, 0.30023548f, -82.189163f, -0.00022762337f, 0.25220636f, \
+    -68.664589f, -0.00020046455f, 0.22130311f, -59.919727f, -0.00018142482f, 0.1995149f, -53.714436f, -0.00016730769f, \
+    0.18324044f, -49.041325f, -0.00015642625f, 0.17057805f, -45.367981f, -0.00014778109f, 0.16039939f, -42.378017f, \
+    -0.00014071779f, 0.15196379f, -39.863113f, -0.00013475897f, 0.14472868f, -37.669968f, -0.00012950345f, 0.13823549f, \
+    -35.668163f, -0.00012454107f, 0.13201265f, -33.722713f, -0.0001193354f, 0.12544084f, -31.655621f, -0.0001129706f, \
+    0.11746168f, -29.162369f, -0.00010337619f, 0.10568244f, -25.554651f, -8.3902509e-05f, 0.082407676f, -18.615705f, \
+    -0.00033254578f, 0.3726683f, -102.94544f, -0.00025713432f, 0.28730837f, -78.951805f, -0.00021607381f, 0.24069142f, \
+    -65.802086f, -0.00018969928f, 0.2106214f, -57.278568f, -0.00017118173f, 0.18938977f, -51.221607f, -0.00015743954f, \
+    0.17351706f, -46.65609f, -0.00014684134f, 0.16116016f, -43.065083f, -0.00013841761f, 0.15122226f, -40.140476f, \
+    -0.00013153125f, 0.14298081f, -37.678719f, -0.00012571516f, 0.13590392f, -35.529263f, -0.00012057389f, 0.12953877f, \
+    -33.563137f, -0.00011569905f, 0.123415f, -31.645525f, -0.00011055062f, 0.11690829f, -29.596769f, -0.00010419718f, \
+    0.10894063f, -27.10634f, -9.4514209e-05f, 0.097052872f, -23.465921f, -7.4645613e-05f, 0.073295899f, -16.382105f, \
+    -0.00031767323f, 0.35766569f, -99.163506f, -0.00024469895f, 0.2748951f, -75.858337f, -0.00020477644f, 0.22948439f, \
+    -63.028713f, -0.00017907112f, 0.20012535f, -54.694298f, -0.00016100158f, 0.179372f, -48.765144f, -0.0001475864f, \
+    0.16385067f, -44.294064f, -0.00013724243f, 0.15176885f, -40.777428f, -0.00012902594f, 0.14205673f, -37.914207f, \
+    -0.00012231446f, 0.13400704f, -35.504833f, -0.00011664939f, 0.12709658f, -33.401001f, -0.00011163965f, 0.12087686f, \
+    -31.474792f, -0.00010687763f, 0.11487772f, -29.591286f, -0.0001018187f, 0.1084687f, -27.568871f, -9.5514522e-05f, \
+    0.10055073f, -25.09063f, -8.5783591e-05f, 0.088595122f, -21.42742f, -6.5553839e-05f, 0.064389221f, -14.206752f, \
+    -0.00030313071f, 0.34308794f, -95.509773f, -0.00023222122f, 0.26250476f, -72.7855f, -0.00019323852f, 0.21809019f, \
+    -60.220749f, -0.0001680745f, 0.18930848f, -52.040821f, -0.00015036552f, 0.16894314f, -46.216362f, -0.00013721817f, \
+    0.15371267f, -41.824387f, -0.00012709117f, 0.14186829f, -38.3727f, -0.00011906264f, 0.13236286f, -35.566177f, \
+    -0.00011252194f, 0.12450132f, -33.208416f, -0.00010701665f, 0.11776681f, -31.152718f, -0.00010215808f, 0.11171297f, \
+    -29.27165f, -9.7537231e-05f, 0.10586765f, -27.429621f, -9.2602349e-05f, 0.099591546f, -25.442354f, -8.6383596e-05f, \
+    0.091759741f, -22.985294f, -7.6631593e-05f, 0.079762392f, -19.305439f, -5.601962e-05f, 0.055082541f, -11.940654f, \
+    -0.00028823991f, 0.32825038f, -91.812019f, -0.00021898905f, 0.24942179f, -69.554329f, -0.00018069244f, 0.20573986f, \
+    -57.186615f, -0.0001558849f, 0.1773468f, -49.113476f, -0.00013839816f, 0.15723015f, -43.359013f, -0.00012541804f, \
+    0.14219053f, -39.021595f, -0.00011544005f, 0.13051704f, -35.61882f, -0.00010756013f, 0.1211808f, -32.860271f, \
+    -0.00010117576f, 0.113495f, -30.551641f, -9.5836906e-05f, 0.10694508f, -28.546801f, -9.115311e-05f, 0.1010826f, \
+    -26.717716f, -8.6709231e-05f, 0.095428415f, -24.926826f, -8.1939441e-05f, 0.089327239f, -22.985361f, -7.5839918e-05f, \
+    0.081615143f, -20.557709f, -6.6062268e-05f, 0.069568329f, -16.858446f, -4.4912715e-05f, 0.044247471f, -9.3051958f, \
+    -0.00027188516f, 0.31203049f, -87.788811f, -0.00020370296f, 0.23434302f, -65.8395f, -0.00016562553f, 0.19092016f, \
+    -53.549809f, -0.00014078269f, 0.16252394f, -45.486488f, -0.00012319819f, 0.14233929f, -39.724575f, -0.00011013763f, \
+    0.12724787f, -35.383106f, -0.00010013098f, 0.11557336f, -31.9884f, -9.2286537e-05f, 0.10629904f, -29.253033f, \
+    -8.6002197e-05f, 0.098738201f, -26.982662f, -8.0821083e-05f, 0.092369013f, -25.029259f, -7.6340199e-05f, 0.086729884f, \
+    -23.261353f, -7.2124531e-05f, 0.081320651f, -21.535864f, -6.7573994e-05f, 0.075449221f, -19.65419f, -6.1612649e-05f, \
+    0.067873061f, -17.259478f, -5.1697087e-05f, 0.055654079f, -13.507909f, -2.941132e-05f, 0.029061295f, -5.6018734f, \
+    -0.00025168716f, 0.29203701f, -82.841293f, -0.00018315154f, 0.21405011f, -60.838245f, -0.000143896f, 0.16949201f, \
+    -48.281601f, -0.00011775312f, 0.13984187f, -39.921745f, -9.9020661e-05f, 0.11855904f, -33.902485f, -8.5074171e-05f, \
+    0.10263281f, -29.369158f, -7.446824e-05f, 0.090408951f, -25.85298f, -6.629189e-05f, 0.080849491f, -23.060762f, \
+    -5.9904618e-05f, 0.073227875f, -20.787907f, -5.480395e-05f, 0.066975594f, -18.874502f, -5.0535866e-05f, 0.061578847f, \
+    -17.17581f, -4.6601097e-05f, 0.056471255f, -15.531792f, -4.2298572e-05f, 0.050855488f, -13.716608f, -3.6348025e-05f, \
+    0.04327378f, -11.31711f, -2.5676853e-05f, 0.030227169f, -7.3419638f, -6.9594805e-08f, 7.8760175e-05f, 1.5073233f, \
+    -0.00077764678f, 0.83910173f, -224.34216f, -0.00058615266f, 0.62871164f, -166.84131f, -0.00049805315f, 0.53150868f, \
+    -140.14622f, -0.00044706429f, 0.47489789f, -124.488f, -0.00041441381f, 0.4383069f, -114.26056f, -0.00039256513f, \
+    0.41346696f, -107.20766f, -0.00037788949f, 0.39638662f, -102.23703f, -0.00036844128f, 0.38491416f, -98.756172f, \
+    -0.00036311219f, 0.37780935f, -96.418991f, -0.00036125863f, 0.3743324f, -95.013031f, -0.00036251597f, 0.37403646f, \
+    -94.401543f, -0.00036668559f, 0.37663627f, -94.48539f, -0.00037361879f, 0.38186702f, -95.160255f, -0.00038294232f, \
+    0.38915464f, -96.217545f, -0.00039289991f, 0.39626449f, -96.950691f, -0.00039174058f, 0.3894349f, -93.332687f, \
+    -0.00069157552f, 0.74889994f, -200.85005f, -0.00052702904f, 0.56737369f, -151.0405f, -0.00044904757f, 0.48098463f, \
+    -127.22208f, -0.00040313782f, 0.42981312f, -113.01503f, -0.00037329941f, 0.39625558f, -103.60421f, -0.00035298092f, \
+    0.37309667f, -97.013649f, -0.00033897613f, 0.35679722f, -92.271614f, -0.00032953228f, 0.34541342f, -88.841522f, \
+    -0.00032361905f, 0.33779141f, -86.401321f, -0.00032059863f, 0.33320254f, -84.743187f, -0.0003200527f, 0.33115008f, \
+    -83.719612f, -0.00032166395f, 0.33123314f, -83.204529f, -0.00032507273f, 0.33297881f, -83.044106f, -0.00032953324f, \
+    0.33544132f, -82.939949f, -0.00033255658f, 0.33563879f, -81.999649f, -0.00031974021f, 0.31692308f, -75.417801f, \
+    -0.00062716927f, 0.68154609f, -183.33981f, -0.00048139886f, 0.52014446f, -138.89792f, -0.00041077303f, 0.44162038f, \
+    -117.17327f, -0.00036865514f, 0.39451027f, -104.05025f, -0.00034097579f, 0.3632805f, -95.265793f, -0.0003218872f, \
+    0.34146842f, -89.04435f, -0.00030849219f, 0.32586563f, -84.502327f, -0.00029918479f, 0.31468612f, -81.145485f, \
+    -0.00029300063f, 0.30684826f, -78.671623f, -0.00028931911f, 0.30164468f, -76.879501f, -0.00028770181f, 0.29856107f, \
+    -75.61837f, -0.00028777288f, 0.29714f, -74.749146f, -0.00028906195f, 0.29679891f, -74.091805f, -0.00029062017f, \
+    0.29638603f, -73.297218f, -0.00028951644f, 0.29245415f, -71.352608f, -0.00026903336f, 0.26574755f, -62.722713f, \
+    -0.00057703129f, 0.62924594f, -169.77174f, -0.00044502516f, 0.48260036f, -129.26779f, -0.00037997036f, 0.41003296f, \
+    -109.12937f, -0.00034078766f, 0.36606583f, -96.845207f, -0.00031481971f, 0.33667949f, -88.556374f, -0.00029674312f, \
+    0.31597233f, -82.636742f, -0.00028389529f, 0.30098689f, -78.269592f, -0.00027478489f, 0.2900601f, -74.993591f, \
+    -0.00026850268f, 0.28217036f, -72.522858f, -0.0002644482f, 0.27663323f, -70.662849f, -0.00026217723f, 0.27293077f, \
+    -69.262642f, -0.00026128319f, 0.27057588f, -68.176422f, -0.00026123147f, 0.26892155f, -67.20858f, -0.00026094596f, \
+    0.26668417f, -65.97657f, -0.00025717754f, 0.26007068f, -63.374802f, -0.00023103878f, 0.22733356f, -53.15662f, \
+    -0.00053681486f, 0.58742392f, -158.94963f, -0.00041527624f, 0.45199701f, -121.43996f, -0.00035457121f, 0.384078f, \
+    -102.53918f, -0.00031772384f, 0.34260949f, -90.921577f, -0.00029314667f, 0.31471923f, -83.034485f, -0.00027591968f, \
+    0.29493695f, -77.366653f, -0.00026356353f, 0.28050092f, -73.153473f, -0.00025467825f, 0.26984599f, -69.959778f, \
+    -0.00024840087f, 0.26200041f, -67.513168f, -0.00024415075f, 0.256302f, -65.625336f, -0.00024148493f, 0.25223535f, \
+    -64.14653f, -0.00023998041f, 0.24929765f, -62.92741f, -0.00023906259f, 0.24680105f, -61.762238f, -0.00023756827f, \
+    0.24336921f, -60.244263f, -0.00023199568f, 0.23492658f, -57.189686f, -0.00020143107f, 0.1973687f, -45.670536f, \
+    -0.00050377497f, 0.55319458f, -150.12007f, -0.00039041493f, 0.42652559f, -114.94699f, -0.00033318522f, 0.36231622f, \
+    -97.033257f, -0.00029823597f, 0.32287589f, -85.956169f, -0.00027481205f, 0.296224f, -78.40107f, -0.00025831119f, \
+    0.27722973f, -72.947021f, -0.00024640019f, 0.26328719f, -68.870895f, -0.0002377534f, 0.25291064f, -65.758659f, \
+    -0.0002315468f, 0.24517019f, -63.349171f, -0.00022721854f, 0.23942414f, -61.459763f, -0.00022433038f, 0.23516288f, \
+    -59.942493f, -0.00022245121f, 0.23187581f, -58.646278f, -0.00022098096f, 0.22884837f, -57.358582f, -0.00021869362f, \
+    0.22463542f, -55.654057f, -0.00021187677f, 0.21492012f, -52.280491f, -0.00017774887f, 0.17340271f, -39.669147f, \
+    -0.00047607254f, 0.52462882f, -142.78023f, -0.00036923189f, 0.40492958f, -109.46484f, -0.00031482812f, 0.34373116f, \
+    -92.351219f, -0.00028144801f, 0.30596414f, -81.719391f, -0.00025899659f, 0.2803542f, -74.443024f, -0.00024312647f, \
+    0.26204214f, -69.173393f, -0.00023162298f, 0.24854828f, -65.22084f, -0.00022322181f, 0.23845211f, -62.18869f, \
+    -0.00021713217f, 0.23085926f, -59.825275f, -0.00021280962f, 0.22514683f, -57.953011f, -0.00020982268f, 0.22081271f, \
+    -56.426086f, -0.0002077375f, 0.21734361f, -55.092846f, -0.00020593817f, 0.21400787f, -53.736176f, -0.00020315284f, \
+    0.20930834f, -51.916206f, -0.00019549073f, 0.19871941f, -48.320286f, -0.00015846142f, 0.15391362f, -34.782749f, \
+    -0.00045240746f, 0.50036705f, -136.57675f, -0.0003508403f, 0.38629097f, -104.75743f, -0.00029876552f, 0.3275671f, \
+    -88.300072f, -0.00026670014f, 0.29119831f, -78.039513f, -0.00024508056f, 0.26647714f, -71.000275f, -0.00022976664f, \
+    0.24876459f, -65.892067f, -0.00021864113f, 0.23568432f, -62.05257f, -0.00021049098f, 0.22587016f, -59.09948f, \
+    -0.00020455412f, 0.21845819f, -56.789215f, -0.00020030228f, 0.21284279f, -54.948807f, -0.00019731208f, 0.20853049f, \
+    -53.434769f, -0.0001951508f, 0.20500916f, -52.09573f, -0.00019319411f, 0.20153727f, -50.711769f, -0.00019013761f, \
+    0.19657917f, -48.831779f, -0.00018194052f, 0.18542989f, -45.090137f, -0.00014255207f, 0.13789292f, -30.766533f, \
+    -0.00043180867f, 0.47939897f, -131.24823f, -0.00033455133f, 0.36990026f, -100.64322f, -0.0002844143f, 0.31322724f, \
+    -84.728149f, -0.00025346153f, 0.27803752f, -74.779739f, -0.00023256167f, 0.25408277f, -67.944389f, -0.00021774488f, \
+    0.23690422f, -62.979382f, -0.0002069749f, 0.22421092f, -59.244923f, -0.00019908199f, 0.21468231f, -56.37072f, \
+    -0.00019332912f, 0.20748095f, -54.120155f, -0.00018920326f, 0.20201723f, -52.324482f, -0.00018629018f, 0.19780737f, \
+    -50.842731f, -0.00018416156f, 0.19434352f, -49.524563f, -0.00018219084f, 0.19088057f, -48.148762f, -0.00017905282f, \
+    0.18585648f, -46.256039f, -0.00017058401f, 0.17441569f, -42.435272f, -0.00012930558f, 0.1246346f, -27.44957f, \
+    -0.0004135026f, 0.460926f, -126.58939f, -0.00031978765f, 0.35516745f, -96.972191f, -0.00027126988f, 0.30019894f, \
+    -81.505981f, -0.00024126294f, 0.26600707f, -71.820816f, -0.00022099f, 0.24271759f, -65.161865f, -0.00020662231f, \
+    0.22601992f, -60.325333f, -0.00019619132f, 0.21369402f, -56.690014f, -0.00018856415f, 0.20445794f, -53.895695f, \
+    -0.00018302593f, 0.19749735f, -51.711807f, -0.00017907807f, 0.19223781f, -49.97353f, -0.00017631655f, 0.18820611f, \
+    -48.542606f, -0.00017432043f, 0.18490174f, -47.270447f, -0.00017246675f, 0.18158205f, -45.936047f, -0.00016942085f, \
+    0.1766704f, -44.074917f, -0.00016092426f, 0.16519028f, -40.238281f, -0.00011818344f, 0.11361222f, -24.705189f, \
+    -0.00039681586f, 0.44426033f, -122.42519f, -0.00030600661f, 0.34154323f, -93.605904f, -0.00025883407f, 0.28798053f, \
+    -78.507858f, -0.00022962611f, 0.25462708f, -69.043037f, -0.00020989781f, 0.23191373f, -62.536423f, -0.00019593749f, \
+    0.21565141f, -57.815914f, -0.00018583331f, 0.20367892f, -54.275566f, -0.00017848385f, 0.19474688f, -51.56361f, \
+    -0.0001731938f, 0.18806128f, -49.454708f, -0.00016947842f, 0.18306209f, -47.787746f, -0.00016694501f, 0.17928773f, \
+    -46.42741f, -0.000165183f, 0.17624815f, -45.227627f, -0.00016357895f, 0.17320932f, -43.969135f, -0.00016080041f, \
+    0.16859238f, -42.18544f, -0.00015252292f, 0.15733102f, -38.398422f, -0.0001087321f, 0.10438935f, -22.42956f, \
+    -0.00038107051f, 0.42871821f, -118.58358f, -0.00029259958f, 0.32841709f, -90.391792f, -0.00024651262f, 0.27597788f, \
+    -75.585976f, -0.00021795821f, 0.2433067f, -66.299873f, -0.00019869088f, 0.22108033f, -59.922024f, -0.00018509557f, \
+    0.20520867f, -55.305729f, -0.00017530756f, 0.19357857f, -51.857349f, -0.00016825186f, 0.18496767f, -49.232018f, \
+    -0.00016325033f, 0.17859961f, -47.208908f, -0.00015983134f, 0.17392792f, -45.630341f, -0.00015761446f, 0.17050371f, \
+    -44.364182f, -0.00015620256f, 0.16785058f, -43.267681f, -0.00015499801f, 0.16524984f, -42.125027f, -0.00015268306f, \
+    0.16113374f, -40.471176f, -0.00014489787f, 0.15037929f, -36.80748f, -0.00010047899f, 0.096518315f, -20.517395f, \
+    -0.0003654084f, 0.41344222f, -114.8508f, -0.00027870538f, 0.31493008f, -87.116341f, -0.00023341278f, 0.26330224f, \
+    -72.520012f, -0.00020533288f, 0.2311253f, -63.36375f, -0.0001864152f, 0.20927133f, -57.0854f, -0.00017312432f, \
+    0.19372955f, -52.558167f, -0.00016363421f, 0.18242536f, -49.198048f, -0.00015689139f, 0.17415796f, -46.665569f, \
+    -0.00015223169f, 0.16816521f, -44.743465f, -0.00014919504f, 0.16391253f, -43.277058f, -0.00014741323f, 0.16096386f, \
+    -42.137405f, -0.00014650488f, 0.1588591f, -41.185757f, -0.00014589434f, 0.15690155f, -40.211491f, -0.00014429168f, \
+    0.15354878f, -38.754677f, -0.00013733239f, 0.14365447f, -35.305031f, -9.2736329e-05f, 0.089348108f, -18.815363f, \
+    -0.00034839756f, 0.39700592f, -110.8723f, -0.00026275139f, 0.29951522f, -83.390526f, -0.00021779467f, 0.24822198f, \
+    -68.880951f, -0.00018985258f, 0.21619737f, -59.768627f, -0.00017104385f, 0.19447607f, -53.530777f, -0.00015790509f, \
+    0.17911626f, -49.057228f, -0.00014864413f, 0.1680757f, -45.771694f, -0.00014222352f, 0.16016883f, -43.338322f, \
+    -0.00013798672f, 0.15464106f, -41.541626f, -0.00013547865f, 0.15096325f, -40.228268f, -0.00013433781f, 0.14870675f, \
+    -39.271175f, -0.00013419538f, 0.14742516f, -38.535007f, -0.00013449877f, 0.14644574f, -37.814903f, -0.00013399462f, \
+    0.14426145f, -36.658768f, -0.00012833356f, 0.13572459f, -33.550488f, -8.4017855e-05f, 0.081446752f, -16.980495f, \
+    -0.00032683526f, 0.3762134f, -105.85271f, -0.00024072902f, 0.27817249f, -78.220093f, -0.00019471359f, 0.22581008f, \
+    -63.447052f, -0.00016566415f, 0.19270159f, -54.074741f, -0.00014595364f, 0.1701204f, -47.63644f, -0.00013224452f, \
+    0.15424258f, -43.049435f, -0.00012279602f, 0.14307249f, -39.747833f, -0.00011657895f, 0.1354301f, -37.396362f, \
+    -0.00011292111f, 0.13054399f, -35.774918f, -0.00011134009f, 0.12785777f, -34.723232f, -0.00011144343f, 0.12691323f, \
+    -34.106937f, -0.00011283457f, 0.12723838f, -33.784496f, -0.00011494317f, 0.12814543f, -33.547394f, -0.00011651013f, \
+    0.12812237f, -32.941566f, -0.0001131199f, 0.12193775f, -30.424068f, -6.9169582e-05f, 0.067734361f, -13.771824f, \
+    -0.00028859239f, 0.33892453f, -96.762527f, -0.00019201647f, 0.23031116f, -66.484764f, -0.00013364325f, 0.16570003f, \
+    -48.700592f, -9.4249604e-05f, 0.12246859f, -36.873856f, -6.7347231e-05f, 0.092954114f, -28.783611f, -4.9043741e-05f, \
+    0.072736353f, -23.18824f, -3.6974176e-05f, 0.059176575f, -19.357124f, -2.9684012e-05f, 0.050661508f, -16.845238f, \
+    -2.6259764e-05f, 0.04617545f, -15.370908f, -2.6121459e-05f, 0.045063686f, -14.748984f, -2.8885748e-05f, 0.046877258f, \
+    -14.84698f, -3.4232373e-05f, 0.051221125f, -15.541838f, -4.1662719e-05f, 0.057479721f, -16.641775f, -4.9775452e-05f, \
+    0.063994221f, -17.653015f, -5.2788419e-05f, 0.064110518f, -16.662214f, -2.9997059e-07f, 0.00033947596f, 2.6497443f, \
+    -0.00087333814f, 0.9420132f, -251.67247f, -0.00064935465f, 0.69629133f, -184.64389f, -0.00055093551f, 0.58780545f, \
+    -154.88733f, -0.00049578631f, 0.52656877f, -137.94928f, -0.00046173236f, 0.48831406f, -127.22894f, -0.00044013583f, \
+    0.46357238f, -120.14571f, -0.00042697322f, 0.44791579f, -115.48735f, -0.00042020451f, 0.43907773f, -112.6265f, \
+    -0.0004188045f, 0.43588972f, -111.23046f, -0.00042236754f, 0.43784246f, -111.13986f, -0.00043095433f, 0.44490701f, \
+    -112.31636f, -0.00044506867f, 0.45748845f, -114.82346f, -0.00046572511f, 0.47645816f, -118.82187f, -0.00049451424f, \
+    0.50312936f, -124.53243f, -0.00053264404f, 0.53793234f, -131.7881f, -0.00055968785f, 0.55550259f, -132.73611f, \
+    -0.00076918508f, 0.83261883f, -223.1293f, -0.00058029516f, 0.62450665f, -166.12256f, -0.00049421907f, 0.52922386f, \
+    -139.87973f, -0.00044497396f, 0.47432125f, -124.63432f, -0.00041397964f, 0.43938258f, -114.8113f, -0.00039382302f, \
+    0.41624993f, -108.1791f, -0.00038097557f, 0.40102679f, -103.66755f, -0.00037359123f, 0.39165831f, -100.70714f, \
+    -0.00037067637f, 0.38701713f, -98.978638f, -0.00037173438f, 0.38650852f, -98.303902f, -0.00037660185f, 0.38988286f, \
+    -98.592308f, -0.00038536734f, 0.39713275f, -99.808281f, -0.00039829541f, 0.40838295f, -101.93271f, -0.00041553957f, \
+    0.4235144f, -104.84102f, -0.00043521891f, 0.4398658f, -107.61673f, -0.00042502963f, 0.41951859f, -99.138405f, \
+    -0.00069369032f, 0.75351888f, -202.53281f, -0.00052825327f, 0.57055521f, -152.23351f, -0.00045087357f, 0.48457783f, \
+    -128.46886f, -0.00040592835f, 0.43428829f, -114.45657f, -0.00037724982f, 0.40185681f, -105.31126f, -0.00035827322f, \
+    0.38003361f, -99.043297f, -0.00034582516f, 0.36530322f, -94.684319f, -0.00033821058f, 0.35577473f, -91.709282f, \
+    -0.00033447999f, 0.35037205f, -89.81398f, -0.00033410612f, 0.34847394f, -88.815437f, -0.00033682241f, 0.34973055f, \
+    -88.599754f, -0.00034251943f, 0.35393879f, -89.084763f, -0.00035110937f, 0.36087289f, -90.16713f, -0.00036209114f, \
+    0.36975864f, -91.56356f, -0.00037218927f, 0.37651509f, -92.005913f, -0.00033975675f, 0.3328172f, -77.493134f, \
+    -0.00063635426f, 0.69362301f, -186.97525f, -0.00048756821f, 0.52851415f, -141.4399f, -0.0004166135f, 0.44940981f, \
+    -119.50587f, -0.00037493242f, 0.40262002f, -106.42882f, -0.00034806976f, 0.3721514f, -97.813309f, -0.00033007746f, \
+    0.35141426f, -91.845497f, -0.00031804736f, 0.33717731f, -87.632935f, -0.00031040347f, 0.32767826f, -84.685272f, \
+    -0.00030624046f, 0.32189053f, -82.712311f, -0.00030502534f, 0.31919062f, -81.531738f, -0.00030644174f, 0.31918094f, \
+    -81.018921f, -0.00031027672f, 0.32155654f, -81.067604f, -0.00031625506f, 0.32590494f, -81.529518f, -0.00032352467f, \
+    0.33109713f, -82.03434f, -0.00032800535f, 0.3322109f, -81.09848f, -0.00027927404f, 0.27088884f, -61.866924f, \
+    -0.00059132109f, 0.64675337f, -174.83852f, -0.00045485873f, 0.49485013f, -132.82596f, -0.00038881376f, 0.42099279f, \
+    -112.28874f, -0.00034968686f, 0.37693807f, -99.94191f, -0.00032428722f, 0.3480477f, -91.751503f, -0.00030713083f, \
+    0.32822809f, -86.035782f, -0.00029551334f, 0.31446594f, -81.960396f, -0.00028795443f, 0.30510199f, -79.062675f, \
+    -0.00028358918f, 0.2991541f, -77.064735f, -0.00028189053f, 0.29600731f, -75.787292f, -0.00028251886f, 0.29524252f, \
+    -75.101151f, -0.00028520526f, 0.29649997f, -74.887177f, -0.00028956833f, 0.29926088f, -74.97139f, -0.0002945491f, \
+    0.30218384f, -74.930313f, -0.00029552655f, 0.29976398f, -73.125626f, -0.00023376103f, 0.22399361f, -49.915688f, \
+    -0.00055503438f, 0.609164f, -165.14288f, -0.0004279592f, 0.46730423f, -125.80711f, -0.00036575808f, 0.39754725f, \
+    -106.36011f, -0.0003286757f, 0.35567743f, -94.595657f, -0.00030448069f, 0.3280831f, -86.753433f, -0.00028804678f, \
+    0.3090525f, -81.253212f, -0.00027682976f, 0.29574317f, -77.306099f, -0.00026942708f, 0.28657913f, -74.47168f, \
+    -0.00026501046f, 0.2806181f, -72.482964f, -0.00026306417f, 0.27725846f, -71.164642f, -0.00026324062f, 0.27607465f, \
+    -70.386459f, -0.00026524218f, 0.27667889f, -70.022797f, -0.00026862766f, 0.27849215f, -69.884911f, -0.000272212f, \
+    0.28004089f, -69.515388f, -0.00027098213f, 0.27538446f, -67.156036f, -0.00019837444f, 0.18733653f, -40.486835f, \
+    -0.00052518444f, 0.57842839f, -157.2551f, -0.00040539837f, 0.44434613f, -119.9883f, -0.00034625854f, 0.3778452f, \
+    -101.40516f, -0.00031084128f, 0.33774951f, -90.112434f, -0.00028765635f, 0.31123832f, -82.560226f, -0.00027185789f, \
+    0.29289815f, -77.247437f, -0.00026102961f, 0.28002253f, -73.421219f, -0.00025383325f, 0.27110386f, -70.659386f, \
+    -0.00024947335f, 0.26523533f, -68.704445f, -0.00024744906f, 0.26183179f, -67.385727f, -0.0002474144f, 0.26047048f, \
+    -66.574043f, -0.00024906092f, 0.26075354f, -66.141556f, -0.00025191833f, 0.26207224f, -65.892097f, -0.00025472936f, \
+    0.26287493f, -65.347359f, -0.0002521936f, 0.25689051f, -62.654984f, -0.00017034005f, 0.15816201f, -32.913551f, \
+    -0.00050018018f, 0.55288178f, -150.74226f, -0.0003861186f, 0.4248808f, -115.08799f, -0.00032944483f, 0.36099124f, \
+    -97.195282f, -0.00029540164f, 0.32235342f, -86.288818f, -0.00027307711f, 0.2967611f, -78.981613f, -0.00025784766f, \
+    0.27903596f, -73.834732f, -0.00024740031f, 0.26658076f, -70.124138f, -0.00024045074f, 0.257945f, -67.442711f, \
+    -0.00023623351f, 0.2522538f, -65.541473f, -0.00023426479f, 0.2489405f, -64.254723f, -0.00023420787f, 0.24759269f, \
+    -63.456135f, -0.00023575708f, 0.24781604f, -63.018894f, -0.0002384367f, 0.24899602f, -62.745247f, -0.00024095991f, \
+    0.24954621f, -62.146595f, -0.00023782984f, 0.2429589f, -59.299965f, -0.00014791328f, 0.13472642f, -26.768641f, \
+    -0.00047885801f, 0.53131527f, -145.29195f, -0.00036931073f, 0.40807647f, -110.89362f, -0.00031463534f, 0.34628913f, \
+    -93.553825f, -0.00028173614f, 0.30885828f, -82.965569f, -0.00026015445f, 0.28405532f, -75.867798f, -0.00024544369f, \
+    0.26688799f, -70.870407f, -0.00023537519f, 0.25484735f, -67.272484f, -0.00022871046f, 0.24653104f, -64.679543f, \
+    -0.00022471209f, 0.24109375f, -62.850346f, -0.00022291567f, 0.23798952f, -61.624615f, -0.00022300017f, 0.23682271f, \
+    -60.880428f, -0.00022467527f, 0.23721534f, -60.495144f, -0.00022748126f, 0.23856911f, -60.274799f, -0.00023014199f, \
+    0.23930427f, -59.730854f, -0.00022705727f, 0.23277438f, -56.894871f, -0.00013001796f, 0.11595862f, -21.788843f, \
+    -0.00046030644f, 0.51279229f, -140.66444f, -0.00035430206f, 0.39324906f, -107.23205f, -0.00030124269f, 0.33314523f, \
+    -90.331528f, -0.00026929815f, 0.29671383f, -80.005051f, -0.00024836362f, 0.27259481f, -73.087708f, -0.00023413359f, \
+    0.25594214f, -68.227371f, -0.00022444845f, 0.24431838f, -64.741676f, -0.00021810932f, 0.23636238f, -62.246792f, \
+    -0.00021440566f, 0.23125692f, -60.508766f, -0.00021289523f, 0.22847942f, -59.373344f, -0.00021327968f, 0.22765827f, \
+    -58.724766f, -0.00021529672f, 0.22844498f, -58.447796f, -0.00021852615f, 0.23028181f, -58.358376f, -0.00022174638f, \
+    0.23164168f, -57.979607f, -0.00021936231f, 0.22585469f, -55.327518f, -0.00011606493f, 0.10129062f, -17.836782f, \
+    -0.00044373755f, 0.49651662f, -136.65894f, -0.00034045408f, 0.379758f, -103.94308f, -0.00028867688f, 0.32097006f, \
+    -87.38176f, -0.00025751902f, 0.28535405f, -77.267021f, -0.00023714773f, 0.26182696f, -70.504929f, -0.00022336865f, \
+    0.24565564f, -65.772156f, -0.00021407849f, 0.23446f, -62.400936f, -0.00020811307f, 0.22691442f, -60.016502f, \
+    -0.00020478835f, 0.22222927f, -58.391937f, -0.00020368783f, 0.21990903f, -57.379921f, -0.00020454421f, 0.21961488f, \
+    -56.873005f, -0.00020713871f, 0.22104409f, -56.767494f, -0.00021111872f, 0.22370917f, -56.896675f, -0.00021537316f, \
+    0.22619466f, -56.810295f, -0.00021445172f, 0.22195679f, -54.547791f, -0.00010588524f, 0.090603739f, -14.8908f, \
+    -0.00042833798f, 0.4816809f, -133.07529f, -0.00032701355f, 0.36685622f, -100.84191f, -0.00027619227f, 0.30902526f, \
+    -84.52227f, -0.00024565076f, 0.27403969f, -74.569542f, -0.00022575661f, 0.25101218f, -67.938011f, -0.00021240018f, \
+    0.23529246f, -63.324783f, -0.00020352335f, 0.22454523f, -60.073158f, -0.00019799241f, 0.21747556f, -57.816059f, \
+    -0.00019515016f, 0.21332167f, -56.333591f, -0.00019461061f, 0.21162012f, -55.486599f, -0.00019614813f, 0.21207635f, \
+    -55.178871f, -0.00019960792f, 0.21445522f, -55.323788f, -0.00020474367f, 0.21838073f, -55.782505f, -0.00021063407f, \
+    0.22263339f, -56.152912f, -0.00021217314f, 0.22100946f, -54.553391f, -9.9774108e-05f, 0.084298037f, -13.067317f, \
+    -0.00041297468f, 0.46717158f, -129.64008f, -0.00031280221f, 0.35337973f, -97.641716f, -0.0002625527f, 0.29608923f, \
+    -81.452286f, -0.00023240536f, 0.26149935f, -71.600159f, -0.00021286454f, 0.23884422f, -65.066719f, -0.00019988294f, \
+    0.22353037f, -60.562012f, -0.000191438f, 0.2132559f, -57.437183f, -0.00018642237f, 0.20675206f, -55.331493f, \
+    -0.00018420571f, 0.2032849f, -54.03204f, -0.00018443761f, 0.20242894f, -53.409309f, -0.00018694726f, 0.20394827f, \
+    -53.382088f, -0.00019167173f, 0.20770581f, -53.888664f, -0.00019852842f, 0.21349892f, -54.833954f, -0.00020690945f, \
+    0.22043665f, -55.897942f, -0.00021237398f, 0.22299951f, -55.36684f, -9.8696197e-05f, 0.083557405f, -12.698332f, \
+    -0.00039543957f, 0.45081323f, -125.81814f, -0.00029533694f, 0.33686933f, -93.735252f, -0.00024497465f, 0.27940416f, \
+    -77.491241f, -0.00021472474f, 0.24470605f, -67.61319f, -0.00019519839f, 0.22208837f, -61.095982f, -0.00018240686f, \
+    0.20700586f, -56.659252f, -0.00017436054f, 0.1971854f, -53.660217f, -0.0001699728f, 0.19137795f, -51.742607f, \
+    -0.00016863327f, 0.18887083f, -50.698803f, -0.00017002306f, 0.18927366f, -50.40839f, -0.0001740328f, 0.19241847f, \
+    -50.807758f, -0.00018072147f, 0.198301f, -51.869419f, -0.00019025237f, 0.20698296f, -53.565796f, -0.00020253891f, \
+    0.21812759f, -55.717159f, -0.00021438781f, 0.22752663f, -56.938953f, -0.00010477162f, 0.090999328f, -14.524726f, \
+    -0.00036955677f, 0.42647576f, -120.09113f, -0.00026643064f, 0.30917707f, -87.10186f, -0.00021281761f, 0.24838912f, \
+    -70.019852f, -0.00017952944f, 0.2106766f, -59.402767f, -0.00015762178f, 0.18575023f, -52.333202f, -0.00014338072f, \
+    0.16931732f, -47.588009f, -0.0001349449f, 0.15922053f, -44.549812f, -0.0001312516f, 0.15422896f, -42.864906f, \
+    -0.00013165516f, 0.15359469f, -42.316254f, -0.00013577241f, 0.15686908f, -42.769478f, -0.00014342976f, 0.16383334f, \
+    -44.150139f, -0.00015468907f, 0.17450941f, -46.440563f, -0.00016992894f, 0.18921493f, -49.682106f, -0.00018982941f, \
+    0.20845683f, -53.913567f, -0.00021359784f, 0.23060162f, -58.407349f, -0.00012146882f, 0.11141987f, -19.990389f, \
+    -0.00028657672f, 0.34546208f, -100.32758f, -0.00011887154f, 0.16381615f, -51.386639f, -1.7149245e-05f, 0.056096457f, \
+    -22.926493f, 4.7188136e-05f, -0.01130364f, -5.2700014f, 8.9701047e-05f, -0.055528916f, 6.2676582f, 0.00011845993f, \
+    -0.085288465f, 14.023643f, 0.00013799057f, -0.10540375f, 19.277756f, 0.00015088102f, -0.11861377f, 22.753986f, \
+    0.00015848785f, -0.12636012f, 24.837004f, 0.00016120524f, -0.12909329f, 25.658819f, 0.00015843235f, -0.12626302f, \
+    25.103752f, 0.00014817662f, -0.11594478f, 22.724432f, 0.00012593518f, -0.093762159f, 17.491724f, 8.1895996e-05f, \
+    -0.050195061f, 7.1755877f, -5.061288e-06f, 0.034949712f, -12.815884f, -2.7231624e-06f, 0.0030818158f, 5.1100564f, \
+    -0.00090538705f, 0.97648323f, -260.82986f, -0.00067040819f, 0.71880412f, -190.57629f, -0.00056839199f, 0.6063894f, \
+    -159.755f, -0.00051185658f, 0.54361182f, -142.39073f, -0.00047739665f, 0.50486845f, -131.52336f, -0.00045599171f, \
+    0.4802731f, -124.4595f, -0.00044349377f, 0.46525934f, -119.94853f, -0.00043785188f, 0.45754331f, -117.3567f, \
+    -0.00043810529f, 0.45601803f, -116.36517f, -0.00044399095f, 0.4603155f, -116.84821f, -0.00045582338f, 0.47066009f, \
+    -118.82849f, -0.00047454989f, 0.48789921f, -122.47594f, -0.00050199521f, 0.51370883f, -128.14365f, -0.00054134696f, \
+    0.55097616f, -136.42462f, -0.00059713877f, 0.60333228f, -147.8815f, -0.00064767734f, 0.64215451f, -153.17792f, \
+    -0.00079544471f, 0.86094743f, -230.67044f, -0.00059784506f, 0.64333135f, -171.0936f, -0.00050899235f, 0.54500073f, \
+    -144.02089f, -0.00045865102f, 0.48887193f, -128.43423f, -0.0004273247f, 0.45353037f, -118.48905f, -0.00040730499f, \
+    0.43049482f, -111.8661f, -0.00039496156f, 0.41575533f, -107.46376f, -0.00038843096f, 0.40723422f, -104.70507f, \
+    -0.00038675545f, 0.40383717f, -103.27776f, -0.0003895243f, 0.40505368f, -103.02345f, -0.00039672476f, 0.41078344f, \
+    -103.88699f, -0.00040869659f, 0.42126772f, -105.89184f, -0.00042612996f, 0.43704981f, -109.11726f, -0.00044991667f, \
+    0.4587248f, -113.60226f, -0.00047927085f, 0.48460811f, -118.62402f, -0.00047032259f, 0.46282527f, -108.85326f, \
+    -0.0007159771f, 0.77763355f, -208.96562f, -0.00054359616f, 0.58706325f, -156.60207f, -0.0004639214f, 0.49855548f, \
+    -132.14558f, -0.00041805449f, 0.44722939f, -117.84332f, -0.00038909036f, 0.4144488f, -108.5915f, -0.0003702204f, \
+    0.3926962f, -102.32761f, -0.0003581839f, 0.37835857f, -98.056229f, -0.00035126659f, 0.36952081f, -95.244728f, \
+    -0.00034854125f, 0.36512637f, -93.592682f, -0.00034953936f, 0.36461124f, -92.930252f, -0.00035409702f, 0.3677265f, \
+    -93.167259f, -0.00036227095f, 0.37443241f, -94.259766f, -0.0003742392f, 0.38476175f, -96.164032f, -0.00038991089f, \
+    0.39832675f, -98.681198f, -0.00040634212f, 0.41126132f, -100.55317f, -0.00036295841f, 0.35309985f, -81.309311f, \
+    -0.00065612776f, 0.71508223f, -192.71181f, -0.00050145941f, 0.54350638f, -145.41594f, -0.00042850978f, 0.4621937f, \
+    -122.87592f, -0.0003860179f, 0.41448772f, -109.54143f, -0.00035890046f, 0.38370571f, -100.82974f, -0.00034099771f, \
+    0.3630248f, -94.863411f, -0.00032932367f, 0.34912652f, -90.725716f, -0.00032228316f, 0.34022474f, -87.918991f, \
+    -0.00031898587f, 0.33530551f, -86.155136f, -0.00031894355f, 0.33378834f, -85.261581f, -0.00032191773f, 0.33535197f, \
+    -85.131424f, -0.000327819f, 0.33981213f, -85.68631f, -0.00033656121f, 0.34693822f, -86.819054f, -0.00034755186f, \
+    0.3558374f, -88.207565f, -0.00035670196f, 0.36146036f, -88.29512f, -0.00028764055f, 0.27526328f, -61.460045f, \
+    -0.00060945604f, 0.66649389f, -180.12708f, -0.00046777734f, 0.50883639f, -136.5435f, -0.00039993002f, 0.43297648f, \
+    -115.45499f, -0.00036006476f, 0.38808388f, -102.8718f, -0.00033443168f, 0.35890463f, -94.592262f, -0.00031735585f, \
+    0.33913425f, -88.876945f, -0.00030606164f, 0.32567933f, -84.869171f, -0.00029904966f, 0.31685713f, -82.099083f, \
+    -0.00029546669f, 0.31169495f, -80.290207f, -0.0002948227f, 0.30961323f, -79.271172f, -0.00029684283f, 0.31025609f, \
+    -78.92733f, -0.00030135943f, 0.31336233f, -79.162163f, -0.00030814105f, 0.31855622f, -79.833405f, -0.00031631315f, \
+    0.32465777f, -80.547859f, -0.00032107005f, 0.32585561f, -79.549622f, -0.00023095179f, 0.21607116f, -46.143154f, \
+    -0.00057210162f, 0.62780005f, -170.14684f, -0.00044023083f, 0.48063302f, -129.3582f, -0.00037635051f, 0.40900388f, \
+    -109.39428f, -0.00033857717f, 0.36634681f, -97.406967f, -0.00031416406f, 0.33848098f, -89.480522f, -0.00029780742f, \
+    0.31949779f, -83.980721f, -0.00028689607f, 0.30647942f, -80.097603f, -0.00028000912f, 0.29782724f, -77.38385f, \
+    -0.00027632821f, 0.29260671f, -75.573471f, -0.00027537104f, 0.29024819f, -74.498276f, -0.00027684824f, 0.29038286f, \
+    -74.041046f, -0.0002805526f, 0.29271102f, -74.09626f, -0.00028617421f, 0.29677829f, -74.502556f, -0.00029267679f, \
+    0.30123734f, -74.824356f, -0.00029476869f, 0.29974321f, -73.160912f, -0.0001864676f, 0.16915582f, -33.827419f, \
+    -0.00054158363f, 0.59639305f, -162.09032f, -0.00041725716f, 0.45727035f, -123.4402f, -0.0003565131f, 0.38897491f, \
+    -104.3602f, -0.00032043486f, 0.34812325f, -92.852783f, -0.00029704336f, 0.3213532f, -85.219795f, -0.00028132342f, \
+    0.30306295f, -79.908371f, -0.00027079473f, 0.29047358f, -76.145348f, -0.00026410146f, 0.28205588f, -73.501884f, \
+    -0.00026045789f, 0.27691054f, -71.721512f, -0.00025939525f, 0.27448329f, -70.640411f, -0.0002606241f, 0.27440664f, \
+    -70.142128f, -0.00026392311f, 0.27636778f, -70.118263f, -0.00026894786f, 0.27987781f, -70.398994f, -0.00027457971f, \
+    0.28350174f, -70.525627f, -0.00027519913f, 0.28052035f, -68.491364f, -0.00015025817f, 0.13053469f, -23.52372f, \
+    -0.00051620882f, 0.57050127f, -155.4968f, -0.00039774107f, 0.43759367f, -118.4926f, -0.00033950209f, 0.37194756f, \
+    -100.11227f, -0.00030481507f, 0.33257076f, -88.995285f, -0.00028229316f, 0.3067292f, -81.609795f, -0.00026714776f, \
+    0.28906056f, -76.466118f, -0.00025700373f, 0.27689692f, -72.820351f, -0.00025056006f, 0.26876715f, -70.258995f, \
+    -0.00024706198f, 0.26380488f, -68.53434f, -0.00024605883f, 0.26147559f, -67.487885f, -0.00024727188f, 0.26142395f, \
+    -67.006523f, -0.00025048581f, 0.26334435f, -66.98391f, -0.00025535619f, 0.26674831f, -67.250267f, -0.00026074538f, \
+    0.27017769f, -67.339615f, -0.00026084314f, 0.26668012f, -65.174408f, -0.00011981849f, 0.097622864f, -14.572599f, \
+    -0.00049474946f, 0.54884994f, -150.03697f, -0.00038083427f, 0.42073184f, -114.29297f, -0.00032460419f, 0.35719401f, \
+    -96.465988f, -0.0002910686f, 0.31902993f, -85.668198f, -0.00026929757f, 0.29398575f, -78.494041f, -0.00025468093f, \
+    0.27688593f, -73.502724f, -0.0002449287f, 0.2651518f, -69.973671f, -0.00023878716f, 0.25736159f, -67.506302f, \
+    -0.00023553144f, 0.25268072f, -65.861198f, -0.00023473342f, 0.25059861f, -64.886154f, -0.00023613531f, 0.25078246f, \
+    -64.473946f, -0.00023954602f, 0.25295264f, -64.524849f, -0.00024465393f, 0.25665483f, -64.87748f, -0.0002503641f, \
+    0.26047143f, -65.074432f, -0.00025082039f, 0.25736868f, -63.006088f, -9.3472612e-05f, 0.068649195f, -6.5055618f, \
+    -0.00047625115f, 0.5304606f, -145.46091f, -0.000365835f, 0.40597269f, -110.66136f, -0.00031120691f, 0.34409648f, \
+    -93.266281f, -0.00027862532f, 0.30692825f, -82.728561f, -0.00025750935f, 0.28257534f, -75.736397f, -0.0002433886f, \
+    0.26600644f, -70.886284f, -0.00023404272f, 0.25471458f, -67.476143f, -0.00022825922f, 0.24732098f, -65.11647f, \
+    -0.00022534336f, 0.24302246f, -63.575966f, -0.00022489468f, 0.24133773f, -62.709969f, -0.00022668739f, 0.24196801f, \
+    -62.419956f, -0.00023057476f, 0.24468052f, -62.618069f, -0.00023631479f, 0.24909356f, -63.160904f, -0.0002429272f, \
+    0.25390518f, -63.618542f, -0.00024468781f, 0.25218886f, -61.897804f, -7.0033857e-05f, 0.042306226f, 1.0447949f, \
+    -0.00045989445f, 0.51450896f, -141.56157f, -0.00035207666f, 0.39265001f, -107.43176f, -0.0002986927f, 0.33204013f, \
+    -90.360664f, -0.00026688943f, 0.2956745f, -80.030327f, -0.00024634501f, 0.27192092f, -73.19487f, -0.00023269665f, \
+    0.25585622f, -68.478096f, -0.00022378037f, 0.24503039f, -65.192329f, -0.00021842074f, 0.23810257f, -62.957676f, \
+    -0.00021595444f, 0.23430233f, -61.551193f, -0.00021601531f, 0.23318464f, -60.837475f, -0.00021842335f, 0.23449926f, \
+    -60.73037f, -0.00022310176f, 0.2380873f, -61.160679f, -0.00022992583f, 0.24368992f, -62.015701f, -0.00023812783f, \
+    0.25022426f, -62.919159f, -0.00024236451f, 0.25113574f, -61.862518f, -4.8608072e-05f, 0.017529177f, 8.4092836f, \
+    -0.00044482943f, 0.50015765f, -138.13286f, -0.00033876096f, 0.37997574f, -104.41004f, -0.00028626726f, 0.3202413f, \
+    -87.556396f, -0.00025506271f, 0.28448254f, -77.380615f, -0.00023500415f, 0.26123616f, -70.677116f, -0.0002218076f, \
+    0.24565428f, -66.087814f, -0.00021335398f, 0.23533083f, -62.935741f, -0.0002085017f, 0.22895905f, -60.849491f, \
+    -0.00020662147f, 0.22580403f, -59.615097f, -0.00020739059f, 0.22546674f, -59.108875f, -0.00021069363f, 0.22776571f, \
+    -59.26218f, -0.00021655961f, 0.2326543f, -60.034298f, -0.00022505168f, 0.24007185f, -61.362389f, -0.00023576632f, \
+    0.24931568f, -62.964798f, -0.00024413764f, 0.25462577f, -63.026024f, -2.8491297e-05f, -0.0066539035f, 15.940576f, \
+    -0.00042983305f, 0.48621345f, -134.88376f, -0.00032459697f, 0.36667952f, -101.28427f, -0.00027257053f, 0.30735993f, \
+    -84.524368f, -0.00024172643f, 0.27195564f, -74.436943f, -0.00022202735f, 0.24908686f, -67.832321f, -0.00020924336f, \
+    0.23395184f, -63.362137f, -0.00020129063f, 0.22417703f, -60.356812f, -0.00019705865f, 0.21848664f, -58.45245f, \
+    -0.00019595528f, 0.21618474f, -57.444916f, -0.00019771267f, 0.21693103f, -57.225536f, -0.00020230566f, 0.22064099f, \
+    -57.7505f, -0.0002099227f, 0.2274386f, -59.022621f, -0.00022092911f, 0.23758441f, -61.060513f, -0.00023554957f, \
+    0.25103852f, -63.749332f, -0.00025072886f, 0.26361808f, -65.666588f, -9.2230857e-06f, -0.03117205f, 24.076139f, \
+    -0.00041239031f, 0.47020957f, -131.21005f, -0.00030673179f, 0.34994224f, -97.359734f, -0.00025439091f, 0.29021907f, \
+    -80.481697f, -0.00022334377f, 0.25459772f, -70.339119f, -0.0002036267f, 0.23173447f, -63.742668f, -0.00019106235f, \
+    0.21686673f, -59.350487f, -0.00018360118f, 0.20765011f, -56.49889f, -0.00018015897f, 0.20283447f, -54.829899f, \
+    -0.00018017572f, 0.2017587f, -54.148174f, -0.00018344029f, 0.20414563f, -54.361477f, -0.00019004101f, 0.21003583f, \
+    -55.458523f, -0.00020039832f, 0.21980581f, -57.50729f, -0.00021536996f, 0.23424628f, -60.662189f, -0.00023631976f, \
+    0.25453317f, -65.117485f, -0.00026331787f, 0.27979195f, -70.286049f, 8.5621432e-06f, -0.056295805f, 33.323395f, \
+    -0.00038487429f, 0.44458935f, -125.24311f, -0.00027481312f, 0.31946912f, -90.085091f, -0.00021796933f, 0.2551451f, \
+    -72.045212f, -0.00018272414f, 0.21535525f, -60.878368f, -0.00015970135f, 0.18928023f, -53.510551f, -0.00014512571f, \
+    0.17252931f, -48.68475f, -0.00013714058f, 0.1629342f, -45.776363f, -0.00013470481f, 0.15928054f, -44.433769f, \
+    -0.00013722207f, 0.16087271f, -44.452412f, -0.00014439957f, 0.16736391f, -45.724056f, -0.00015623998f, 0.17873456f, \
+    -48.226181f, -0.00017322377f, 0.1954678f, -52.060135f, -0.00019678003f, 0.21901423f, -57.556328f, -0.00023032799f, \
+    0.2528016f, -65.492043f, -0.00028147243f, 0.30405775f, -77.350433f, 1.4459704e-05f, -0.073218398f, 42.604755f, \
+    -0.00025303409f, 0.31533164f, -93.589272f, -2.9659672e-05f, 0.078234047f, -30.881601f, 9.7062235e-05f, -0.053404026f, \
+    3.2752402f, 0.0001751978f, -0.13348332f, 23.821751f, 0.00022693339f, -0.18587686f, 37.144386f, 0.00026401746f, \
+    -0.22293095f, 46.476521f, 0.00029348009f, -0.25189257f, 53.683205f, 0.00031969941f, -0.2771937f, 59.88707f, \
+    0.00034557123f, -0.30169737f, 65.799248f, 0.00037341667f, -0.32762164f, 71.955132f, 0.00040568426f, -0.35721934f, \
+    78.880745f, 0.00044571125f, -0.39346728f, 87.25177f, 0.00049901241f, -0.44116497f, 98.133949f, 0.00057598314f, \
+    -0.5090633f, 113.41698f, 0.0006923069f, -0.60799921f, 135.02957f, -4.1650779e-05f, 0.054977179f, 5.0085378f, \
+    -0.00090538705f, 0.97648555f, -260.83197f, -0.00067208603f, 0.72059828f, -191.04912f, -0.00056977978f, 0.60786682f, \
+    -160.14201f, -0.00051313388f, 0.54496652f, -142.74379f, -0.00047864299f, 0.50618559f, -131.86507f, -0.00045725572f, \
+    0.48160443f, -124.80341f, -0.00044481439f, 0.46664572f, -120.30517f, -0.00043926769f, 0.45902476f, -117.73623f, \
+    -0.00043966106f, 0.45764047f, -116.77908f, -0.00044574463f, 0.46213809f, -117.3112f, -0.00045785637f, 0.47276536f, \
+    -119.36089f, -0.00047698556f, 0.4904117f, -123.10822f, -0.00050503592f, 0.51683182f, -128.92522f, -0.00054535765f, \
+    0.55507374f, -137.44316f, -0.00060285261f, 0.60912657f, -149.30754f, -0.00065588101f, 0.6502198f, -155.07581f, \
+    -0.00079754653f, 0.86321485f, -231.27409f, -0.00059923949f, 0.64482707f, -171.4886f, -0.00051016384f, 0.54625183f, \
+    -144.3493f, -0.00045973549f, 0.4900257f, -128.73557f, -0.00042838388f, 0.45465323f, -118.78098f, -0.00040837692f, \
+    0.43162739f, -112.15926f, -0.00039607624f, 0.41692922f, -107.76634f, -0.00038961746f, 0.4084796f, -105.02475f, \
+    -0.00038804629f, 0.40518752f, -103.62293f, -0.0003909599f, 0.40655026f, -103.40434f, -0.00039835944f, 0.41248128f, \
+    -104.31713f, -0.00041060822f, 0.42324537f, -106.39038f, -0.0004284372f, 0.43942609f, -109.71286f, -0.00045281256f, \
+    0.46169102f, -114.34042f, -0.00048307178f, 0.48846897f, -119.57404f, -0.00047416607f, 0.46645823f, -109.65272f, \
+    -0.00071775605f, 0.77955842f, -209.47914f, -0.00054481323f, 0.58837277f, -156.94864f, -0.00046495468f, 0.49966237f, \
+    -132.43677f, -0.00041901474f, 0.4482542f, -118.11154f, -0.0003900289f, 0.41544691f, -108.85152f, -0.00037116892f, \
+    0.39370155f, -102.58839f, -0.00035916729f, 0.37939739f, -98.324554f, -0.0003523085f, 0.37061781f, -95.526894f, \
+    -0.00034966756f, 0.36630821f, -93.895386f, -0.00035078137f, 0.36590993f, -93.261429f, -0.00035549549f, 0.36918336f, \
+    -93.537056f, -0.00036388205f, 0.37610406f, -94.681931f, -0.00037614477f, 0.3867299f, -96.658165f, -0.00039223416f, \
+    0.40071267f, -99.275734f, -0.00040925056f, 0.41422069f, -101.28134f, -0.00036456849f, 0.35438892f, -81.503136f, \
+    -0.00065770384f, 0.7167927f, -193.16908f, -0.00050256046f, 0.54469472f, -145.73111f, -0.00042945126f, 0.46320543f, \
+    -123.14266f, -0.00038689526f, 0.41542697f, -109.7878f, -0.00035975841f, 0.38462102f, -101.06872f, -0.00034186416f, \
+    0.36394599f, -95.102882f, -0.00033022033f, 0.35007668f, -90.971672f, -0.0003232304f, 0.34122518f, -88.176857f, \
+    -0.00032000573f, 0.33637896f, -86.430649f, -0.00032006219f, 0.33496159f, -85.561386f, -0.00032316844f, 0.3366589f, \
+    -85.463821f, -0.00032924666f, 0.34129786f, -86.062256f, -0.00033822889f, 0.34866568f, -87.253548f, -0.00034954958f, \
+    0.35789457f, -88.72097f, -0.00035912971f, 0.36393532f, -88.904266f, -0.00028770554f, 0.27487743f, -61.203609f, \
+    -0.00061090087f, 0.66806662f, -180.54846f, -0.00046880115f, 0.50994486f, -136.83817f, -0.00040080977f, 0.43392488f, \
+    -115.70559f, -0.00036088613f, 0.38896599f, -103.1037f, -0.00033523532f, 0.3597647f, -94.817329f, -0.00031816715f, \
+    0.33999956f, -89.102394f, -0.00030690039f, 0.32657096f, -85.100479f, -0.00029993433f, 0.31779441f, -82.341217f, \
+    -0.00029641701f, 0.31269836f, -80.548309f, -0.0002958618f, 0.31070647f, -79.551125f, -0.00029799991f, 0.3114689f, \
+    -79.23645f, -0.0003026732f, 0.31473374f, -79.509888f, -0.00030966473f, 0.32013923f, -80.232353f, -0.00031811954f, \
+    0.32652324f, -81.014259f, -0.00032322542f, 0.32805771f, -80.092018f, -0.00022981974f, 0.21435225f, -45.517063f, \
+    -0.00057346158f, 0.62928504f, -170.54562f, -0.00044120377f, 0.48168978f, -129.63977f, -0.00037718919f, 0.40991098f, \
+    -109.63454f, -0.00033936123f, 0.36719164f, -97.629601f, -0.00031493159f, 0.3393051f, -89.696693f, -0.00029858225f, \
+    0.32032698f, -84.197266f, -0.00028769692f, 0.30733356f, -80.31971f, -0.00028085333f, 0.29872459f, -77.616196f, \
+    -0.00027723424f, 0.29356647f, -75.8209f, -0.00027636043f, 0.29129249f, -74.766312f, -0.00027794804f, 0.29153934f, \
+    -74.336464f, -0.00028179839f, 0.29401556f, -74.427765f, -0.00028761436f, 0.29827917f, -74.881622f, -0.00029437596f, \
+    0.30299741f, -75.265305f, -0.0002967763f, 0.30179965f, -73.668098f, -0.00018428841f, 0.16624133f, -32.860573f, \
+    -0.00054289144f, 0.59782571f, -162.47595f, -0.00041819821f, 0.45829591f, -123.71414f, -0.00035732577f, 0.38985687f, \
+    -104.5944f, -0.00032119523f, 0.34894544f, -93.069992f, -0.00029778806f, 0.32215568f, -85.430817f, -0.00028207561f, \
+    0.30387068f, -80.119835f, -0.00027157244f, 0.29130593f, -76.36232f, -0.00026492155f, 0.28293058f, -73.728928f, \
+    -0.00026133828f, 0.27784631f, -71.963356f, -0.00026035696f, 0.27550176f, -70.902451f, -0.00026169326f, 0.27553463f, \
+    -70.430962f, -0.00026513429f, 0.27764028f, -70.44239f, -0.00027034801f, 0.28134182f, -70.769623f, -0.00027623124f, \
+    0.28521806f, -70.956612f, -0.00027714579f, 0.28252044f, -68.985634f, -0.00014703699f, 0.12640378f, -22.201973f, \
+    -0.00051748881f, 0.5719083f, -155.8765f, -0.00039866453f, 0.43860376f, -118.76314f, -0.00034030015f, 0.37281692f, \
+    -100.34376f, -0.00030556216f, 0.33338162f, -89.210098f, -0.00028302535f, 0.30752113f, -81.818611f, -0.0002678879f, \
+    0.28985831f, -76.675537f, -0.00025776975f, 0.27771977f, -73.035431f, -0.00025136882f, 0.26963291f, -70.484314f, \
+    -0.00024793146f, 0.26473236f, -68.774673f, -0.00024701018f, 0.2624867f, -67.748703f, -0.00024833169f, 0.262546f, \
+    -67.294579f, -0.0002516892f, 0.26461306f, -67.307915f, -0.00025675146f, 0.26821232f, -67.621857f, -0.00026239752f, \
+    0.27190065f, -67.773415f, -0.00026279996f, 0.2686978f, -65.674377f, -0.00011544793f, 0.092125766f, -12.844929f, \
+    -0.00049602083f, 0.55025274f, -150.41661f, -0.00038175142f, 0.42173907f, -114.56354f, -0.00032539654f, 0.35806075f, \
+    -96.697472f, -0.00029181052f, 0.31983855f, -85.883072f, -0.00027002525f, 0.29477608f, -78.703072f, -0.00025541743f, \
+    0.27768308f, -73.712624f, -0.00024569232f, 0.26597539f, -70.18959f, -0.00023959512f, 0.25822997f, -67.732964f, \
+    -0.00023640231f, 0.25361335f, -66.103569f, -0.00023568928f, 0.25161847f, -65.149986f, -0.00023720418f, 0.25191844f, \
+    -64.766403f, -0.00024076542f, 0.25424311f, -64.855331f, -0.0002460762f, 0.25815278f, -65.258759f, -0.00025206181f, \
+    0.26224864f, -65.523209f, -0.00025285565f, 0.25947592f, -63.530037f, -8.7719578e-05f, 0.061486095f, -4.2761288f, \
+    -0.00047752989f, 0.53187758f, -145.8456f, -0.00036675495f, 0.40698758f, -110.93492f, -0.0003120006f, 0.3449688f, \
+    -93.500061f, -0.00027936848f, 0.30774206f, -82.945572f, -0.0002582389f, 0.28337145f, -75.947701f, -0.00024412831f, \
+    0.2668108f, -71.098808f, -0.00023481155f, 0.25554767f, -67.69529f, -0.00022907536f, 0.24820212f, -65.347229f, \
+    -0.00022622656f, 0.24397247f, -63.823654f, -0.00022586872f, 0.24238144f, -62.980831f, -0.00022778292f, 0.24313723f, \
+    -62.721916f, -0.00023183366f, 0.24601832f, -62.961746f, -0.00023779673f, 0.25066078f, -63.561073f, -0.00024471857f, \
+    0.25578833f, -64.095634f, -0.00024687889f, 0.25446808f, -62.466862f, -6.2480525e-05f, 0.032951094f, 3.9410138f, \
+    -0.00046119411f, 0.51595622f, -141.95596f, -0.00035300627f, 0.39368111f, -107.71081f, -0.00029949268f, 0.33292425f, \
+    -90.598602f, -0.00026763807f, 0.29649898f, -80.251106f, -0.00024708081f, 0.27272841f, -73.410072f, -0.00023344449f, \
+    0.25667396f, -68.695038f, -0.00022456041f, 0.24588023f, -65.416771f, -0.00021925254f, 0.23900539f, -63.195026f, \
+    -0.00021685973f, 0.23528111f, -61.807343f, -0.00021702056f, 0.23426716f, -61.119442f, -0.00021956344f, 0.2357219f, \
+    -61.047253f, -0.00022442544f, 0.23950054f, -61.525013f, -0.00023150488f, 0.24536754f, -62.445572f, -0.00024007172f, \
+    0.25227726f, -63.441208f, -0.00024481327f, 0.25369662f, -62.504929f, -3.8517534e-05f, 0.0050605093f, 12.259658f, \
+    -0.00044616108f, 0.50164962f, -138.54128f, -0.00033970369f, 0.38102856f, -104.6964f, -0.00028707454f, 0.32113996f, \
+    -87.79953f, -0.00025581714f, 0.28531957f, -77.605949f, -0.00023574654f, 0.26205692f, -70.897018f, -0.00022256465f, \
+    0.24648808f, -66.310165f, -0.00021414764f, 0.23620152f, -63.166847f, -0.00020935368f, 0.22988993f, -61.095406f, \
+    -0.00020755625f, 0.22682114f, -59.882507f, -0.0002084389f, 0.22660248f, -59.406006f, -0.00021189675f, 0.22906336f, \
+    -59.599941f, -0.00021797702f, 0.23417598f, -60.428204f, -0.00022677472f, 0.24191223f, -61.83588f, -0.0002379431f, \
+    0.25162688f, -63.55497f, -0.00024699737f, 0.25763434f, -63.784786f, -1.4477715e-05f, -0.023967076f, 21.284344f, \
+    -0.00043120066f, 0.48775819f, -135.30919f, -0.00032554715f, 0.36775097f, -101.57775f, -0.00027337624f, 0.30826637f, \
+    -84.771477f, -0.00024247645f, 0.27279699f, -74.665222f, -0.00022276593f, 0.24991243f, -68.05526f, -0.00020999998f, \
+    0.23479417f, -63.588486f, -0.00020209007f, 0.22506309f, -60.593708f, -0.00019792584f, 0.21944328f, -58.706898f, \
+    -0.00019691905f, 0.21724275f, -57.72485f, -0.0001988099f, 0.21812956f, -57.540951f, -0.00020358754f, 0.22203413f, \
+    -58.115105f, -0.00021146587f, 0.22910696f, -59.456726f, -0.00022285704f, 0.23965728f, -61.596447f, -0.00023807894f, \
+    0.25374126f, -64.442879f, -0.00025426105f, 0.26735982f, -66.615875f, 1.1656209e-05f, -0.057011731f, 32.062256f, \
+    -0.00041377242f, 0.47179127f, -131.64983f, -0.00030765287f, 0.35099921f, -97.652863f, -0.00025515005f, 0.29109123f, \
+    -80.722954f, -0.00022403873f, 0.25539556f, -70.559074f, -0.00020430768f, 0.2325141f, -63.956661f, -0.00019176425f, \
+    0.21766657f, -59.568848f, -0.00018435433f, 0.20850313f, -56.730343f, -0.00018099452f, 0.20377424f, -55.083187f, \
+    -0.00018112992f, 0.20282404f, -54.433334f, -0.00018456021f, 0.2053868f, -54.69141f, -0.00019139356f, 0.21152411f, \
+    -55.851429f, -0.0002020878f, 0.22165202f, -57.991329f, -0.00021757606f, 0.23664065f, -61.285458f, -0.00023939069f, \
+    0.25784269f, -65.972115f, -0.00026803699f, 0.28483376f, -71.573967f, 4.4033291e-05f, -0.10037078f, 46.993664f, \
+    -0.0003861209f, 0.44606593f, -125.6636f, -0.00027547264f, 0.32028434f, -90.322411f, -0.0002183497f, 0.25565618f, \
+    -72.20047f, -0.00018292965f, 0.21568201f, -60.985176f, -0.00015980334f, 0.18950133f, -53.590206f, -0.00014519374f, \
+    0.17271855f, -48.756519f, -0.00013724604f, 0.16316582f, -45.859272f, -0.00013492201f, 0.15963142f, -44.547306f, \
+    -0.00013763108f, 0.16142581f, -44.617569f, -0.0001450899f, 0.16821289f, -45.964592f, -0.00015731894f, 0.17999336f, \
+    -48.57119f, -0.00017484304f, 0.1972996f, -52.551491f, -0.00019921194f, 0.22171263f, -58.269337f, -0.00023418704f, \
+    0.25702658f, -66.595123f, -0.00028859617f, 0.311768f, -79.33876f, 9.5524032e-05f, -0.17483822f, 74.381645f, \
+    -0.00024812925f, 0.3107267f, -92.509201f, -1.946934e-05f, 0.068421751f, -28.522554f, 0.00010951702f, -0.065342776f, \
+    6.1308513f, 0.00018879279f, -0.1464337f, 26.898756f, 0.0002413014f, -0.19948281f, 40.357147f, 0.0002792695f, \
+    -0.23730402f, 49.85334f, 0.00031006627f, -0.26746854f, 57.329628f, 0.00033827883f, -0.29460025f, 63.952442f, \
+    0.00036705742f, -0.32179463f, 70.48571f, 0.00039917996f, -0.35169187f, 77.562096f, 0.00043799623f, -0.38738233f, \
+    85.901672f, 0.00048879365f, -0.43365791f, 96.601578f, 0.00056201429f, -0.49990654f, 111.7933f, 0.00068422919f, \
+    -0.60994142f, 136.86504f, 0.00090538705f, -0.80637664f, 181.09407f, 8.108357e-05f, 0.021109534f, 7.9468799f, \
+    -0.00090538705f, 0.65796107f, -131.73613f, -0.00090538705f, 0.65853894f, -131.94072f, -0.00090538705f, 0.32560977f, \
+    3.6342053f, -0.00090538705f, 0.24756035f, 35.400707f, -0.00090538705f, 0.22947621f, 42.73856f, -0.00090538705f, \
+    0.22634676f, 19.246078f, -0.00090538705f, 0.22634676f, 17.248184f, -0.00090538705f, 0.22635889f, 16.54324f, \
+    -0.00090538705f, 0.22634676f, 16.015142f, -0.00090538705f, 0.22651184f, 15.141656f, -0.00090538705f, 0.22641535f, \
+    14.388262f, -0.00090538705f, 0.22634678f, 13.445807f, -0.00090538705f, 0.22635101f, 12.711548f, -0.00090538705f, \
+    0.22634676f, 12.033727f, -0.00090538705f, 0.22634682f, 11.482522f, -0.00090538705f, 0.22634676f, 10.594627f, \
+    -0.00090538705f, 0.57418889f, -95.360657f, -0.00090538705f, 0.51095933f, -69.400497f, -0.00090538705f, 0.3019135f, \
+    9.0683479f, -0.00090538705f, 0.32848909f, -0.25679561f, -0.00090538705f, 0.30296549f, 11.681346f, -0.00090538705f, \
+    0.22634679f, 20.556902f, -0.00090538705f, 0.22634676f, 17.510555f, -0.00090538705f, 0.22634676f, 16.544617f, \
+    -0.00090538705f, 0.22634676f, 16.067623f, -0.00090538705f, 0.22701545f, 14.973712f, -0.00090538705f, 0.22634678f, \
+    14.202232f, -0.00090538705f, 0.22634804f, 13.253811f, -0.00090538705f, 0.22634676f, 12.516859f, -0.00090538705f, \
+    0.22634676f, 11.767729f, -0.00090538705f, 0.22655362f, 10.750394f, -0.00090538705f, 0.22634676f, 10.142753f, \
+    -0.00090538705f, 0.57123905f, -98.517555f, -0.00090538705f, 0.47050098f, -60.409225f, -0.00090538705f, 0.22637729f, \
+    33.397572f, -0.00090538705f, 0.22968486f, 30.384066f, -0.00090538705f, 0.23019853f, 26.025909f, -0.00090538705f, \
+    0.22634679f, 20.810192f, -0.00090538705f, 0.22634676f, 18.326893f, -0.00090538705f, 0.22648937f, 16.628368f, \
+    -0.00090538705f, 0.22634676f, 16.203266f, -0.00090538705f, 0.22634678f, 15.166142f, -0.00090538705f, 0.22634676f, \
+    14.054106f, -0.00090538705f, 0.22634676f, 13.20093f, -0.00090538705f, 0.22634688f, 12.343463f, -0.00090538705f, \
+    0.22634676f, 11.185106f, -0.00090538705f, 0.22634676f, 10.379356f, -0.00090538705f, 0.22634676f, 9.6088762f, \
+    -0.00090538705f, 0.60902017f, -118.6547f, -0.00090538705f, 0.49772009f, -77.27076f, -0.00090538705f, 0.24526083f, \
+    19.902998f, -0.00090538705f, 0.22634676f, 30.086456f, -0.00090538705f, 0.23082072f, 24.510798f, -0.00090538705f, \
+    0.22634676f, 21.568239f, -0.00090538705f, 0.2265555f, 18.394594f, -0.00090538705f, 0.22634676f, 17.06753f, \
+    -0.00090538705f, 0.22637516f, 16.208977f, -0.00090538705f, 0.22634676f, 15.068267f, -0.00090538705f, 0.2263747f, \
+    13.874806f, -0.00090538705f, 0.22634676f, 12.927887f, -0.00090538705f, 0.22635855f, 11.753134f, -0.00090538705f, \
+    0.22634676f, 10.656269f, -0.00090538705f, 0.22634684f, 9.8788853f, -0.00090538705f, 0.22634676f, 9.1676798f, \
+    -0.00090538705f, 0.59269446f, -117.57992f, -0.00090538705f, 0.5504961f, -102.61587f, -0.00090538705f, 0.3318623f, \
+    -19.093287f, -0.00090538705f, 0.22687615f, 25.565739f, -0.00090538705f, 0.22669199f, 26.306072f, -0.00090538705f, \
+    0.22685832f, 22.013109f, -0.00090538705f, 0.22682779f, 18.076061f, -0.00090538705f, 0.22635016f, 17.215242f, \
+    -0.00090538705f, 0.22634676f, 16.05978f, -0.00090538705f, 0.22657897f, 14.747233f, -0.00090538705f, 0.22636783f, \
+    13.833638f, -0.00090538705f, 0.22634678f, 12.358186f, -0.00090538705f, 0.22703184f, 11.03736f, -0.00090538705f, \
+    0.2264702f, 10.278061f, -0.00090538705f, 0.22634676f, 9.767725f, 0.00035777508f, -0.68312997f, 172.14352f, \
+    -0.00090538705f, 0.59512514f, -123.59875f, -0.00090538705f, 0.58926463f, -122.23175f, -0.00090538705f, 0.40687025f, \
+    -54.87516f, -0.00090538705f, 0.22634676f, 14.362103f, -0.00090538705f, 0.22639389f, 20.87233f, -0.00090538705f, \
+    0.22996086f, 21.411951f, -0.00090538705f, 0.22634676f, 18.782591f, -0.00090538705f, 0.22634791f, 17.109344f, \
+    -0.00090538705f, 0.22634676f, 15.910059f, -0.00090538705f, 0.22634733f, 14.695662f, -0.00090538705f, 0.22634676f, \
+    13.29145f, -0.00090538705f, 0.22634676f, 12.056894f, -0.00090538705f, 0.22634676f, 10.869569f, -0.00090538705f, \
+    0.22634676f, 9.7348738f, -0.00090538705f, 0.22634676f, 8.8126459f, 0.00049320754f, -0.78064132f, 188.19289f, \
+    -0.00090538705f, 0.60869414f, -135.34457f, -0.00090538705f, 0.60794157f, -133.88408f, -0.00090538705f, 0.47732222f, \
+    -89.060043f, -0.00090538705f, 0.26928049f, -13.27058f, -0.00090538705f, 0.22635217f, 10.473737f, -0.00090538705f, \
+    0.22634913f, 15.157225f, -0.00090538705f, 0.22634676f, 17.125427f, -0.00090538705f, 0.22634676f, 15.353323f, \
+    -0.00090538705f, 0.22635038f, 12.968079f, -0.00090538705f, 0.22634886f, 12.208748f, -0.00090538705f, 0.22634676f, \
+    11.379763f, -0.00090538705f, 0.22634676f, 10.526121f, -0.00090538705f, 0.22634678f, 9.4216261f, 0.00041438715f, \
+    -0.72389066f, 179.18553f, 0.00052939227f, -0.80669433f, 191.82651f, 0.00056742848f, -0.83408046f, 194.22784f, \
+    -0.00090538705f, 0.57212049f, -126.93843f, -0.00090538705f, 0.57572973f, -128.65514f, -0.00090538705f, 0.5481413f, \
+    -121.76315f, -0.00090538705f, 0.28046879f, -30.710596f, -0.00020132927f, -0.28057483f, 87.729248f, 0.00025137753f, \
+    -0.60652375f, 155.1976f, -0.00090538705f, 0.2263478f, 10.166113f, -0.00090538705f, 0.22634676f, 11.938986f, \
+    -0.00090538705f, 0.22634676f, 10.772698f, -0.00090538705f, 0.22638541f, 9.9684143f, 0.00048287239f, -0.77320004f, \
+    187.10629f, 0.00053198059f, -0.80855799f, 191.86147f, 0.00056861254f, -0.83493292f, 194.63216f, 0.00059101975f, \
+    -0.85106617f, 194.72832f, 0.00060340954f, -0.85998678f, 193.27042f, 0.00060798792f, -0.86328322f, 190.63342f, \
+    -0.00090538705f, 0.45007399f, -98.443748f, -0.00090538705f, 0.52467358f, -116.20372f, -0.00090538705f, 0.53653073f, \
+    -119.00892f, -0.00084924046f, 0.28862265f, -51.825947f, -0.00038739722f, -0.13505735f, 45.246983f, 1.8709866e-06f, \
+    -0.42687902f, 107.66286f, 0.00026089416f, -0.61337572f, 148.1544f, 0.00044534521f, -0.74618047f, 177.43799f, \
+    0.00057472347f, -0.83933282f, 194.55836f, 0.00055958953f, -0.82843637f, 194.1198f, 0.00056481326f, -0.83219749f, \
+    194.38667f, 0.00057488919f, -0.83945215f, 194.25642f, 0.00060570316f, -0.86163819f, 193.08047f, 0.0005940526f, \
+    -0.85324979f, 194.23009f, 0.00060863426f, -0.86374861f, 192.18448f, 0.00061301811f, -0.86690491f, 188.40936f, \
+    -0.00090538705f, 0.52515429f, -137.05025f, -0.00090538705f, 0.49157393f, -124.27235f, -0.00090538705f, 0.43735677f, \
+    -97.425591f, -0.00090538705f, 0.42425165f, -99.483528f, -0.00053864799f, 0.078930289f, -20.031658f, -0.00023046583f, \
+    -0.21012466f, 47.495068f, 1.1856481e-05f, -0.43406859f, 99.962395f, 0.00020336063f, -0.57195157f, 130.28645f, \
+    0.00038144804f, -0.70017451f, 152.39517f, 0.00049481168f, -0.78179634f, 170.14142f, 0.00058578106f, -0.84729427f, \
+    184.29123f, 0.00061257835f, -0.86658835f, 188.7614f, 0.00061351975f, -0.86726612f, 189.00426f, 0.00060970162f, \
+    -0.86451709f, 191.88951f, 0.0006124872f, -0.86652267f, 183.1367f, 0.00061152526f, -0.86583006f, 179.89438f, \
+    -0.00090538705f, 0.57151872f, -151.66904f, -0.00090538705f, 0.58035839f, -160.02339f, -0.00090538705f, 0.46089593f, \
+    -111.48425f, -0.00090538705f, 0.51814473f, -140.82425f, -0.00074050523f, 0.31986013f, -87.79528f, -0.00045821042f, \
+    0.055874072f, -26.404238f, -0.00020569682f, -0.14667736f, 12.427238f, -2.5113028e-05f, -0.31583208f, 52.25808f, \
+    0.00012349495f, -0.45584044f, 85.031227f, 0.00024517908f, -0.57003278f, 111.46865f, 0.00034474887f, -0.66415268f, \
+    133.12207f, 0.00042651498f, -0.73262268f, 148.24765f, 0.00049487792f, -0.78184402f, 158.87822f, 0.00060828263f, \
+    -0.86349541f, 174.9791f, 0.00061271456f, -0.8666864f, 181.03546f, 0.00061110314f, -0.8655262f, 180.72882f, \
+    -0.00090538705f, 0.69219166f, -197.8511f, -0.00090538705f, 0.65648085f, -187.30875f, -0.00090538705f, 0.62708461f, \
+    -178.41029f, -0.00090538705f, 0.52865654f, -145.67123f, -0.00089247036f, 0.5469054f, -160.60532f, -0.00065315526f, \
+    0.32196289f, -107.74487f, -0.00044657409f, 0.12677029f, -61.917027f, -0.00027019723f, -0.03993395f, -22.753164f, \
+    -0.00012039114f, -0.18318823f, 10.834391f, 6.6998409e-06f, -0.303323f, 38.876274f, 0.0001143146f, -0.40463254f, \
+    62.438507f, 0.00020535276f, -0.48986858f, 81.879425f, 0.00028271598f, -0.56362444f, 98.976479f, 0.00041640061f, \
+    -0.67849702f, 122.21995f, 0.00047391572f, -0.73233324f, 134.39529f, 0.00063142437f, -0.88015747f, 175.48265f, \
+    -0.00090538705f, 0.80990088f, -234.02908f, -0.00090538705f, 0.73348969f, -212.62363f, -0.00090538705f, 0.70066762f, \
+    -203.31305f, -0.00090538705f, 0.56667989f, -163.30531f, -0.00090538705f, 0.56455207f, -162.61284f, -0.00085215707f, \
+    0.54057473f, -166.69424f, -0.00065820158f, 0.35729548f, -123.52738f, -0.00048757266f, 0.19732104f, -86.160934f, \
+    -0.0003393995f, 0.05687809f, -53.353035f, -0.00021031062f, -0.063897833f, -25.526661f, -9.8747259e-05f, -0.17033975f, \
+    -0.71652013f, -1.5487307e-06f, -0.26199597f, 20.595299f, 0.00011881508f, -0.36398879f, 40.696274f, 0.00020348653f, \
+    -0.44443041f, 59.252094f, 0.00027444525f, -0.51290941f, 75.29921f, 0.00043745097f, -0.67557019f, 115.03762f, \
+    -0.00090538705f, 0.87735665f, -240.82263f, -0.00090538705f, 0.87738431f, -241.16377f, -0.00090538705f, 0.76520127f, \
+    -218.80531f, -0.00090538705f, 0.69234741f, -204.25063f, -0.00090538705f, 0.57493073f, -167.77599f, -0.00090538705f, \
+    0.598984f, -178.72723f, -0.0008405266f, 0.55296391f, -175.3472f, -0.00067732326f, 0.39982492f, -139.72675f, \
+    -0.00053246849f, 0.26392832f, -108.13258f, -0.00040455774f, 0.14313391f, -80.056557f, -0.000291526f, 0.036044907f, \
+    -55.175571f, -0.00019788065f, -0.035369404f, -43.286335f, -9.3054245e-05f, -0.1349083f, -20.215504f, -1.1312919e-06f, \
+    -0.22349738f, 0.60082269f, 7.8721831e-05f, -0.3010363f, 18.857372f, 0.00021026962f, -0.42957303f, 49.609192f, \
+    -0.00090538705f, 0.88585979f, -244.72362f, -0.00090538705f, 0.88634497f, -245.27245f, -0.00090538705f, 0.88694495f, \
+    -245.90027f, -0.00090538705f, 0.88767838f, -246.61693f, -0.00090538705f, 0.64548916f, -193.79208f, -0.00090538705f, \
+    0.60417664f, -181.12219f, -0.00090538705f, 0.62247807f, -189.76685f, -0.00084411568f, 0.57295692f, -184.42535f, \
+    -0.00075994199f, 0.51877987f, -178.42651f, -0.00062763831f, 0.39339727f, -149.1861f, -0.00050436769f, 0.27654707f, \
+    -121.94695f, -0.00039042166f, 0.16829833f, -96.666885f, -0.0002860619f, 0.068859234f, -73.404564f, -0.00019175762f, \
+    -0.021786695f, -52.16877f, -0.00010030761f, -0.10674074f, -33.030041f, -1.8191208e-06f, -0.20309967f, -9.9700813f, \
+    -0.00090538705f, 0.89323294f, -248.09943f, -0.00090538705f, 0.8940596f, -248.80208f, -0.00090538705f, 0.89503032f, \
+    -249.59595f, -0.00090538705f, 0.89617318f, -250.49739f, -0.00090538705f, 0.76914877f, -230.593f, -0.00090538705f, \
+    0.63184822f, -192.43199f, -0.00090538705f, 0.62013936f, -188.23466f, -0.00090538705f, 0.65233201f, -203.81891f, \
+    -0.00090538705f, 0.67089492f, -217.71565f, -0.00078316237f, 0.55476093f, -190.79893f, -0.00066680799f, 0.4454326f, \
+    -165.39861f, -0.00055830053f, 0.34271902f, -141.53218f, -0.00045725293f, 0.24684468f, -119.2281f, -0.00041583658f, \
+    0.21413872f, -113.78338f, -0.00031902088f, 0.12231418f, -92.282883f, -0.00021865178f, 0.023896566f, -68.835915f, \
+    -0.00090538705f, 0.58814085f, -98.84687f, -0.00090538705f, 0.58845967f, -98.923859f, -0.00020790605f, -0.27583957f, \
+    133.32191f, -0.00079893949f, 0.1497045f, 57.557243f, -0.00090538705f, 0.22947621f, 42.73856f, 0.00090538705f, \
+    -1.0465573f, 263.8887f, 0.00090538705f, -1.0312312f, 257.85321f, 0.00090538705f, -1.022521f, 254.37567f, \
+    0.00090538705f, -1.0161623f, 251.83217f, 0.00090538705f, -1.0120091f, 250.15652f, 0.00090538705f, -1.0089287f, \
+    248.90675f, 0.00090538705f, -1.0064355f, 247.88858f, 0.00090538705f, -1.004338f, 247.02766f, 0.00090538705f, \
+    -1.0025145f, 246.27563f, 0.00090538705f, -1.000885f, 245.60085f, 0.00090538705f, -0.99939924f, 244.98282f, \
+    -0.00090538705f, 0.58591211f, -99.643402f, -0.00090538705f, 0.51095933f, -69.400497f, 0.00030077787f, -0.63054913f, \
+    193.52077f, 0.00027494092f, -0.62348938f, 194.80652f, -0.00014932113f, -0.3180207f, 140.50273f, 0.00090538705f, \
+    -1.054875f, 266.79822f, 0.00090538705f, -1.0347531f, 258.86673f, 0.00090538705f, -1.0251262f, 255.04132f, \
+    0.00090538705f, -1.0178421f, 252.12906f, 0.00090538705f, -1.0129248f, 250.1497f, 0.00090538705f, -1.009436f, \
+    248.73718f, 0.00090538705f, -1.0066931f, 247.62076f, 0.00090538705f, -1.0044041f, 246.68236f, 0.00090538705f, \
+    -1.0024384f, 245.87231f, 0.00090538705f, -1.000702f, 245.15324f, 0.00090538705f, -0.99913096f, 244.49957f, \
+    -0.00090538705f, 0.60448331f, -111.30357f, -0.00059181388f, 0.26934969f, -25.864283f, 0.00026035521f, -0.53257489f, \
+    160.50082f, 0.00068292982f, -0.91724139f, 246.63281f, 0.00082326971f, -1.0182861f, 264.69983f, 0.00090538705f, \
+    -1.0609887f, 268.79056f, 0.00090538705f, -1.038865f, 260.0708f, 0.00090538705f, -1.0275933f, 255.60721f, \
+    0.00090538705f, -1.0198115f, 252.50117f, 0.00090538705f, -1.0140252f, 250.17964f, 0.00090538705f, -1.0100379f, \
+    248.56998f, 0.00090538705f, -1.0069703f, 247.3226f, 0.00090538705f, -1.0044687f, 246.29985f, 0.00090538705f, \
+    -1.0023379f, 245.42265f, 0.00090538705f, -1.0004768f, 244.65225f, 0.00090538705f, -0.99880838f, 243.95784f, \
+    -0.00090538705f, 0.65153253f, -133.11928f, -0.00057604682f, 0.31892568f, -50.744808f, 0.00014789867f, -0.37816495f, \
+    115.54062f, 0.00056175585f, -0.76675415f, 205.44087f, 0.00084296055f, -1.0273471f, 264.71219f, 0.00090538705f, \
+    -1.0643272f, 269.64355f, 0.00090538705f, -1.042912f, 261.20267f, 0.00090538705f, -1.0299182f, 256.05423f, \
+    0.00090538705f, -1.0218083f, 252.83661f, 0.00090538705f, -1.0153049f, 250.23456f, 0.00090538705f, -1.0107187f, \
+    248.3886f, 0.00090538705f, -1.0072865f, 246.99718f, 0.00090538705f, -1.0045283f, 245.87167f, 0.00090538705f, \
+    -1.0022086f, 244.91824f, 0.00090538705f, -1.0002017f, 244.08794f, 0.00090538705f, -0.99842149f, 243.34706f, \
+    -0.00090538705f, 0.69744021f, -153.56381f, -0.00063596637f, 0.42583999f, -86.340485f, -5.1260242e-05f, -0.14099783f, \
+    49.873974f, 0.00036361229f, -0.54215819f, 145.93874f, 0.00063937524f, -0.80473459f, 207.67334f, 0.00082690991f, \
+    -0.98008126f, 247.9935f, 0.00090538705f, -1.0460207f, 261.89481f, 0.00090538705f, -1.0326502f, 256.6149f, \
+    0.00090538705f, -1.0236174f, 253.03241f, 0.00090538705f, -1.0167112f, 250.28204f, 0.00090538705f, -1.0114906f, \
+    248.1889f, 0.00090538705f, -1.0076302f, 246.62921f, 0.00090538705f, -1.004575f, 245.38521f, 0.00090538705f, \
+    -1.0020407f, 244.34599f, 0.00090538705f, -0.99986553f, 243.44687f, 0.00090538705f, -0.9979533f, 242.65077f, \
+    -0.00090538705f, 0.73476964f, -170.21385f, -0.00071736641f, 0.54354525f, -122.59557f, -0.00023069742f, 0.069703415f, \
+    -8.1966476f, 0.00013395351f, -0.28500682f, 77.310188f, 0.00041079454f, -0.55383492f, 141.97018f, 0.0006210896f, \
+    -0.75729001f, 190.69801f, 0.00076863973f, -0.89817452f, 223.93704f, 0.00085461239f, -0.97857219f, 242.48917f, \
+    0.0009034996f, -1.023317f, 252.61568f, 0.00090538705f, -1.0180886f, 250.24467f, 0.00090538705f, -1.01232f, \
+    247.94276f, 0.00090538705f, -1.007991f, 246.20073f, 0.00090538705f, -1.0046008f, 244.82442f, 0.00090538705f, \
+    -1.0018132f, 243.68279f, 0.00090538705f, -0.99944115f, 242.70238f, 0.00090538705f, -0.9973706f, 241.83884f, \
+    -0.00090538705f, 0.76547998f, -183.91508f, -0.00080230314f, 0.65776324f, -156.66194f, -0.00038609392f, 0.25115842f, \
+    -58.14035f, -6.2895655e-05f, -0.064437881f, 18.258503f, 0.00019129443f, -0.31244028f, 78.222054f, 0.00039303274f, \
+    -0.50901115f, 125.67609f, 0.00055392046f, -0.6654771f, 163.37021f, 0.0006777331f, -0.78546607f, 192.17722f, \
+    0.00075722492f, -0.86176026f, 210.33521f, 0.0008043542f, -0.90616518f, 220.73241f, 0.00083616422f, -0.93551391f, \
+    227.47574f, 0.00085872691f, -0.95580834f, 232.03094f, 0.00087288948f, -0.96789736f, 234.60976f, 0.00088202429f, \
+    -0.97509414f, 236.01471f, 0.00088800275f, -0.97923052f, 236.68741f, 0.00089179771f, -0.98125571f, 236.8558f, \
+    -0.00090538705f, 0.79101235f, -195.29573f, -0.00088415743f, 0.76394171f, -187.79642f, -0.00052082317f, 0.40800905f, \
+    -101.29645f, -0.00023086787f, 0.12402107f, -32.323235f, 3.1137251e-06f, -0.10503671f, 23.265238f, 0.00019357115f, \
+    -0.29134479f, 68.434868f, 0.0003495827f, -0.4437921f, 105.35043f, 0.00047783993f, -0.5689345f, 135.60864f, \
+    0.00058111834f, -0.66946739f, 159.86322f, 0.00065427524f, -0.74024433f, 176.84955f, 0.00070114166f, -0.78502327f, \
+    187.48396f, 0.00073255866f, -0.81453335f, 194.39078f, 0.00075632182f, -0.83649731f, 199.4593f, 0.00077251234f, \
+    -0.85098678f, 202.70575f, 0.00078320794f, -0.86005741f, 204.63225f, 0.00079046219f, -0.86574346f, 205.73618f, \
+    -0.00090538705f, 0.81242812f, -204.81726f, -0.00090538705f, 0.80761307f, -203.05888f, -0.00063837325f, 0.54462785f, \
+    -138.88939f, -0.00037553677f, 0.2865586f, -76.040909f, -0.00015907992f, 0.074082762f, -24.32378f, 2.0589237e-05f, \
+    -0.10220008f, 18.555201f, 0.00017065337f, -0.24933451f, 54.31488f, 0.00029656652f, -0.37267336f, 84.261559f, \
+    0.00040249972f, -0.47631249f, 109.39489f, 0.00049103342f, -0.56277913f, 130.33075f, 0.00055911427f, -0.62900323f, \
+    146.31078f, 0.00060634711f, -0.67455679f, 157.22533f, 0.00063861103f, -0.70526421f, 164.50169f, 0.00066266238f, \
+    -0.72783691f, 169.78702f, 0.00068103132f, -0.74478632f, 173.69716f, 0.00069375162f, -0.7561391f, 176.23738f, \
+    -0.00090538705f, 0.83049804f, -212.8214f, -0.00090538705f, 0.82712787f, -211.72011f, -0.00074167567f, 0.66457659f, \
+    -171.90613f, -0.00050136069f, 0.42811781f, -114.18717f, -0.00030013113f, 0.23014091f, -65.879623f, -0.00013043378f, \
+    0.063232601f, -25.17214f, 1.3510069e-05f, -0.078282744f, 9.3223343f, 0.00013618061f, -0.19880831f, 38.680088f, \
+    0.00024108817f, -0.30179614f, 63.745064f, 0.00033099845f, -0.38996732f, 85.182549f, 0.00040803821f, -0.46541423f, \
+    103.50403f, 0.00047132833f, -0.52723724f, 118.48472f, 0.00051909819f, -0.57364619f, 129.68015f, 0.00055328081f, \
+    -0.60654688f, 137.5564f, 0.00057809637f, -0.63013554f, 143.14503f, 0.00059770123f, -0.64855319f, 147.46529f, \
+    -0.00090538705f, 0.84582531f, -219.57619f, -0.00090538705f, 0.84360701f, -218.99762f, -0.00083309296f, 0.77067888f, \
+    -201.12498f, -0.00061177701f, 0.55251002f, -147.76318f, -0.00042386257f, 0.36727199f, -102.46761f, -0.00026329039f, \
+    0.20900993f, -63.781208f, -0.00012534022f, 0.073082f, -30.567951f, -6.290144e-06f, -0.04417425f, -1.9313272f, \
+    9.6825454e-05f, -0.14567876f, 22.84355f, 0.00018638947f, -0.23377895f, 44.331486f, 0.00026432591f, -0.31037107f, \
+    62.996849f, 0.00033217788f, -0.37697622f, 79.212112f, 0.0003905755f, -0.43420726f, 93.126099f, 0.0004380098f, \
+    -0.48054007f, 104.36008f, 0.0004741076f, -0.51558435f, 112.81504f, 0.00050097669f, -0.54143351f, 119.00562f, \
+    -0.00090538705f, 0.8588751f, -225.28909f, -0.00090538705f, 0.85757858f, -225.12694f, -0.00090538705f, 0.85621619f, \
+    -224.95911f, -0.00070944265f, 0.66268265f, -177.5457f, -0.00053325348f, 0.48870549f, -134.92419f, -0.00038100791f, \
+    0.33837938f, -98.105309f, -0.00024879863f, 0.20785747f, -66.14637f, -0.00013350006f, 0.094060794f, -38.292702f, \
+    -3.2587501e-05f, -0.0054991976f, -13.934266f, 5.5995704e-05f, -0.09285076f, 7.4262471f, 0.00013393664f, -0.1696585f, \
+    26.197039f, 0.00020262552f, -0.23729469f, 42.714653f, 0.00026320643f, -0.29688895f, 57.256142f, 0.00031658431f, \
+    -0.34933439f, 70.040436f, 0.00036238227f, -0.39424255f, 80.969711f, 0.00039979967f, -0.43079981f, 89.840813f, \
+    -0.00090538705f, 0.87002844f, -230.12814f, -0.00090538705f, 0.86945671f, -230.29756f, -0.00090538705f, 0.86890477f, \
+    -230.49396f, -0.00079643389f, 0.76094031f, -204.14368f, -0.00063064054f, 0.5969792f, -163.90921f, -0.00048599386f, \
+    0.45392892f, -128.81149f, -0.00035922125f, 0.32856423f, -98.059258f, -0.00024767203f, 0.21827127f, -71.011101f, \
+    -0.0001491799f, 0.12091272f, -47.142445f, -6.1960192e-05f, 0.034726862f, -26.020836f, 1.5467725e-05f, -0.041748658f, \
+    -7.2872405f, 8.4339554e-05f, -0.10973483f, 9.3581581f, 0.00014569101f, -0.17025542f, 24.166784f, 0.00020039112f, \
+    -0.22416975f, 37.349678f, 0.00024916243f, -0.27219227f, 49.082291f, 0.00029251119f, -0.31482226f, 59.48698f, \
+    -0.00090538705f, 0.87960321f, -234.24809f, -0.00090538705f, 0.8796066f, -234.66666f, -0.00090538705f, 0.87967473f, \
+    -235.14314f, -0.00087439368f, 0.84910792f, -228.04047f, -0.00071787636f, 0.69410837f, -189.94824f, -0.00058017491f, \
+    0.55773318f, -156.43633f, -0.00045851993f, 0.43725049f, -126.83376f, -0.00035064347f, 0.33042172f, -100.59065f, \
+    -0.00025467286f, 0.23539762f, -77.252632f, -0.00016905039f, 0.15063909f, -56.441502f, -9.2471477e-05f, 0.074856609f, \
+    -37.840305f, -2.3837087e-05f, 0.0069632488f, -21.181858f, 3.7783495e-05f, -0.053961799f, -6.2397704f, 9.3181581e-05f, \
+    -0.10870176f, 7.178545f, 0.00014303144f, -0.15792421f, 19.237251f, 0.00018790638f, -0.2021969f, 30.075966f, \
+    -0.00090538705f, 0.88781339f, -237.74622f, -0.00090538705f, 0.8882674f, -238.3602f, -0.00090538705f, 0.88883311f, \
+    -239.05257f, -0.00090538705f, 0.88952899f, -239.83246f, -0.00079644681f, 0.78171182f, -213.46455f, -0.00066510704f, \
+    0.65147036f, -181.41504f, -0.00054825441f, 0.53558958f, -152.90175f, -0.0004439328f, 0.43213716f, -127.44955f, \
+    -0.00035051236f, 0.33950216f, -104.66224f, -0.00026662555f, 0.25633234f, -84.207214f, -0.00019111772f, 0.18148555f, \
+    -65.803459f, -0.00012300852f, 0.11399139f, -49.212196f, -6.1461084e-05f, 0.053021293f, -34.229507f, -5.7578745e-06f, \
+    -0.0021355178f, -20.680454f, 4.4718621e-05f, -0.052090965f, -8.4143877f, 9.0501264e-05f, -0.097373255f, 2.6987338f, \
+    -0.00090538705f, 0.8949185f, -240.73662f, -0.00090538705f, 0.89570993f, -241.49431f, -0.00090538705f, 0.89664209f, \
+    -242.34151f, -0.00090538705f, 0.89774257f, -243.29398f, -0.00086755707f, 0.86110437f, -234.80273f, -0.00074205908f, \
+    0.73651069f, -204.10387f, -0.0006297066f, 0.62495834f, -176.61945f, -0.00052880042f, 0.5247674f, -151.93599f, \
+    -0.00043791279f, 0.43452573f, -129.70589f, -0.00035583679f, 0.35303894f, -109.63508f, -0.00028154589f, 0.27929083f, \
+    -91.473328f, -0.00021416236f, 0.21241206f, -75.006531f, -0.00015293203f, 0.15165533f, -60.050598f, -9.7203869e-05f, \
+    0.096375287f, -46.446541f, -4.6413665e-05f, 0.04601245f, -34.056503f, -7.0731218e-08f, 8.0046288e-05f, -22.760519f, \
+    -0.00090538705f, 0.73163104f, -152.0818f, -0.00054378482f, 0.3722159f, -64.295685f, 0.00018588974f, -0.30612919f, \
+    91.591644f, 0.0005233257f, -0.62039715f, 163.71281f, 0.00063378946f, -0.72173339f, 186.67513f, 0.00066417293f, \
+    -0.74742335f, 192.09312f, 0.00067720457f, -0.75684696f, 193.76114f, 0.00068201189f, -0.75863528f, 193.68205f, \
+    0.00068221055f, -0.75620097f, 192.64659f, 0.00067996205f, -0.75158441f, 191.12762f, 0.0006763491f, -0.74580264f, \
+    189.35997f, 0.00067190517f, -0.73935139f, 187.45715f, 0.00066692516f, -0.73250055f, 185.48027f, 0.00066159276f, \
+    -0.72541547f, 183.46619f, 0.00065603206f, -0.71820605f, 181.4391f, 0.00065032864f, -0.71094626f, 179.41499f, \
+    -0.00090538705f, 0.7610305f, -165.1394f, -0.00022127829f, 0.10795425f, -10.465497f, 0.00015037591f, -0.24197158f, \
+    70.987366f, 0.00035916505f, -0.43793297f, 116.34853f, 0.00047000081f, -0.54146332f, 140.19728f, 0.00051473262f, \
+    -0.58224678f, 149.40373f, 0.00053512392f, -0.59991163f, 153.21582f, 0.00054659828f, -0.60915041f, 155.06987f, \
+    0.00055294717f, -0.61356825f, 155.80765f, 0.00055605784f, -0.61495888f, 155.84772f, 0.00055718387f, -0.61451495f, \
+    155.46861f, 0.00055705139f, -0.61292636f, 154.83133f, 0.00055606751f, -0.61057854f, 154.0255f, 0.00055447256f, \
+    -0.60769749f, 153.10347f, 0.00055242243f, -0.60442901f, 152.09885f, 0.00055002613f, -0.60087425f, 151.03476f, \
+    -0.00060457224f, 0.50057364f, -108.90206f, -0.00015432536f, 0.068425894f, -5.9870591f, 9.7815086e-05f, -0.17202769f, \
+    50.768009f, 0.00025185998f, -0.31798121f, 84.920647f, 0.0003505073f, -0.41110134f, 106.61263f, 0.00040635301f, \
+    -0.46336183f, 118.69205f, 0.00043426041f, -0.48889369f, 124.48164f, 0.00045014714f, -0.50293779f, 127.57165f, \
+    0.00046030889f, -0.51152974f, 129.38419f, 0.00046687649f, -0.51670921f, 130.39906f, 0.00047099139f, -0.51956791f, \
+    130.87291f, 0.00047346269f, -0.52088064f, 130.98798f, 0.00047481657f, -0.52115136f, 130.86281f, 0.00047537815f, \
+    -0.5206908f, 130.57042f, 0.00047535053f, -0.51969266f, 130.15617f, 0.00047486796f, -0.51828426f, 129.64989f, \
+    -0.00045314888f, 0.37428156f, -82.737984f, -0.00015156898f, 0.083022594f, -12.948962f, 4.2113043e-05f, -0.10360767f, \
+    31.606083f, 0.00016919199f, -0.22535743f, 60.459217f, 0.00025646237f, -0.30856588f, 80.062698f, 0.00031546503f, \
+    -0.36454627f, 93.184357f, 0.00035197014f, -0.3988598f, 101.16136f, 0.00037313841f, -0.41839296f, 105.63131f, \
+    0.00038659881f, -0.43050811f, 108.34398f, 0.00039587705f, -0.43860915f, 110.10802f, 0.00040240693f, -0.44407851f, \
+    111.25135f, 0.00040696847f, -0.44766742f, 111.95199f, 0.00041012152f, -0.44991559f, 112.33785f, 0.00041226644f, \
+    -0.45120895f, 112.50043f, 0.00041367274f, -0.45180723f, 112.50128f, 0.00041451908f, -0.45188239f, 112.38109f, \
+    -0.00039161998f, 0.32895976f, -74.78952f, -0.00016801625f, 0.11197969f, -22.547684f, -1.2334685e-05f, -0.038964551f, \
+    13.73033f, 9.8527446e-05f, -0.14622818f, 39.434467f, 0.00017837179f, -0.22317038f, 57.782688f, 0.00023664773f, \
+    -0.27907807f, 71.047806f, 0.00027790765f, -0.31845027f, 80.340569f, 0.00030559787f, -0.34464934f, 86.477615f, \
+    0.00032337412f, -0.36122519f, 90.312286f, 0.00033544158f, -0.37226686f, 92.82502f, 0.00034416607f, -0.38007501f, \
+    94.566986f, 0.00035063992f, -0.38571078f, 95.792107f, 0.00035546135f, -0.38975453f, 96.639053f, 0.00035904304f, \
+    -0.39260662f, 97.203445f, 0.0003616974f, -0.39457023f, 97.557716f, 0.00036365207f, -0.39586633f, 97.754662f, \
+    -0.00036647575f, 0.31552783f, -73.826447f, -0.00019004646f, 0.14367686f, -32.289425f, -6.0475122e-05f, 0.017510425f, \
+    -1.8267288f, 3.6634454e-05f, -0.076964132f, 20.950655f, 0.00011044408f, -0.14865763f, 38.200348f, 0.00016697035f, \
+    -0.20342271f, 51.338337f, 0.00021015972f, -0.24511226f, 61.300327f, 0.0002421683f, -0.27585307f, 68.610161f, \
+    0.00026510801f, -0.2977246f, 73.777367f, 0.00028099882f, -0.31270608f, 77.282715f, 0.00029227845f, -0.32318512f, \
+    79.703674f, 0.0003006944f, -0.33087319f, 81.453735f, 0.0003071565f, -0.33666071f, 82.747742f, 0.00031217304f, \
+    -0.34104457f, 83.70546f, 0.00031607563f, -0.34434861f, 84.404861f, 0.00031911355f, -0.3468163f, 84.904541f, \
+    -0.00035807866f, 0.31618169f, -75.816902f, -0.00021295206f, 0.17438182f, -41.433022f, -0.00010211983f, 0.066100776f, \
+    -15.194704f, -1.6046262e-05f, -0.017954778f, 5.1549273f, 5.166636e-05f, -0.084026076f, 21.131918f, 0.00010543346f, \
+    -0.13642424f, 33.783607f, 0.00014836006f, -0.17818294f, 43.847008f, 0.00018251057f, -0.21131909f, 51.812092f, \
+    0.00020900591f, -0.23692624f, 57.944847f, 0.00022902637f, -0.25616336f, 62.528309f, 0.00024379228f, -0.27023205f, \
+    65.855988f, 0.00025466998f, -0.28047872f, 68.256104f, 0.00026296562f, -0.28819096f, 70.042114f, 0.00026947897f, \
+    -0.29415682f, 71.405685f, 0.00027467465f, -0.29883376f, 72.457947f, 0.0002788472f, -0.30251136f, 73.269196f, \
+    -0.0003579749f, 0.32338187f, -79.079277f, -0.00023500706f, 0.20291807f, -49.789295f, -0.00013822767f, 0.10810582f, \
+    -26.746758f, -6.0988656e-05f, 0.032452215f, -8.37148f, 1.3496215e-06f, -0.028578347f, 6.4406624f, 5.2104933e-05f, \
+    -0.078232005f, 18.480089f, 9.369653e-05f, -0.11887766f, 28.323732f, 0.0001279086f, -0.15226354f, 36.397415f, \
+    0.00015598921f, -0.17961222f, 42.998867f, 0.00017865794f, -0.20162618f, 48.298882f, 0.00019657149f, -0.21894816f, \
+    52.453926f, 0.00021050991f, -0.23234563f, 55.651283f, 0.00022119451f, -0.24252972f, 58.064613f, 0.00022950441f, \
+    -0.25036997f, 59.906498f, 0.00023612988f, -0.25654969f, 61.344002f, 0.00024151005f, -0.26150337f, 62.483334f, \
+    -0.00036212403f, 0.33360478f, -82.844719f, -0.00025560797f, 0.22902252f, -57.356274f, -0.00016974508f, 0.14470817f, \
+    -36.813675f, -9.9709599e-05f, 0.07594002f, -20.065681f, -4.2025324e-05f, 0.019313894f, -6.2820768f, 5.8647011e-06f, \
+    -0.027676146f, 5.1484404f, 4.5874764e-05f, -0.066907629f, 14.683975f, 7.945839e-05f, -0.099807143f, 22.672668f, \
+    0.00010772764f, -0.12746675f, 29.381058f, 0.00013150559f, -0.15069461f, 35.006351f, 0.00015130578f, -0.16999348f, \
+    39.67099f, 0.00016752904f, -0.18575539f, 43.470413f, 0.00018066679f, -0.19846399f, 46.522709f, 0.00019117173f, \
+    -0.20856567f, 48.936977f, 0.00019954155f, -0.21655281f, 50.833748f, 0.00020630598f, -0.22295086f, 52.341858f, \
+    -0.00036844841f, 0.34509233f, -86.741478f, -0.00027460195f, 0.25276786f, -64.193909f, -0.00019746026f, 0.17686391f, \
+    -45.66024f, -0.00013340593f, 0.11383525f, -30.274672f, -7.9763842e-05f, 0.061058238f, -17.39632f, -3.451974e-05f, \
+    0.016555917f, -6.5421481f, 3.8670091e-06f, -0.021184906f, 2.6576464f, 3.6590682e-05f, -0.053338006f, 10.489971f, \
+    6.4587046e-05f, -0.080823638f, 17.179804f, 8.8593697e-05f, -0.10436752f, 22.904581f, 0.00010918378f, -0.12453365f, \
+    27.802181f, 0.00012674952f, -0.14170717f, 31.966633f, 0.0001415697f, -0.15616114f, 35.464481f, 0.00015393792f, \
+    -0.16818427f, 38.366222f, 0.00016418242f, -0.17810063f, 40.751186f, 0.00017259276f, -0.18619651f, 42.68948f, \
+    -0.00037582527f, 0.35693258f, -90.585533f, -0.00029202076f, 0.27434301f, -70.378349f, -0.00022200591f, 0.20532852f, \
+    -53.494625f, -0.0001629968f, 0.14715685f, -39.26614f, -0.00011288873f, 0.09776096f, -27.187243f, -7.0065187e-05f, \
+    0.055552188f, -16.869213f, -3.3267279e-05f, 0.019292502f, -8.0090609f, -1.5025163e-06f, -0.011994748f, -0.36772096f, \
+    2.601983e-05f, -0.039088134f, 6.2454233f, 4.9935166e-05f, -0.062613629f, 11.983652f, 7.0756767e-05f, -0.083077125f, \
+    16.970854f, 8.8897388e-05f, -0.10088552f, 21.306671f, 0.00010466824f, -0.11634534f, 25.066116f, 0.000118285f, \
+    -0.12966843f, 28.30092f, 0.00012993734f, -0.14104116f, 31.056604f, 0.00013984009f, -0.15067561f, 33.385101f, \
+    -0.00038362679f, 0.368644f, -94.286575f, -0.00030796882f, 0.293966f, -75.98494f, -0.00024388693f, 0.23069909f, \
+    -60.480869f, -0.00018919141f, 0.17669144f, -47.247395f, -0.00014219516f, 0.13028407f, -35.878159f, -0.00010158013f, \
+    0.090180099f, -26.055422f, -6.6303801e-05f, 0.055353127f, -17.527668f, -3.5532419e-05f, 0.024981795f, -10.093582f, \
+    -8.5926149e-06f, -0.0015976387f, -3.5904508f, 1.5064131e-05f, -0.024926141f, 2.1143653f, 3.5887813e-05f, -0.04544773f, \
+    7.1297498f, 5.4249365e-05f, -0.063528568f, 11.545506f, 7.0454633e-05f, -0.079470664f, 15.435707f, 8.4750085e-05f, \
+    -0.093517341f, 18.860012f, 9.7316231e-05f, -0.10584649f, 21.861977f, 0.00010829433f, -0.11659709f, 24.475594f, \
+    -0.00039149512f, 0.3799744f, -97.80304f, -0.00032257367f, 0.31184921f, -81.082352f, -0.00026350791f, 0.25345093f, \
+    -66.749336f, -0.00021254338f, 0.20305343f, -54.380791f, -0.00016830605f, 0.15930408f, -43.644985f, -0.00012970643f, \
+    0.12112971f, -34.278679f, -9.5871001e-05f, 0.08766941f, -26.070671f, -6.6092427e-05f, 0.058225658f, -18.849789f, \
+    -3.9792722e-05f, 0.032228168f, -12.476068f, -1.649578e-05f, 0.0092069395f, -6.8341331f, 4.1934186e-06f, -0.011228184f, \
+    -1.8281945f, 2.2604478e-05f, -0.029402895f, 2.6217248f, 3.9013903e-05f, -0.045590531f, 6.5827532f, 5.3653861e-05f, \
+    -0.060020674f, 10.111277f, 6.6718145e-05f, -0.072884984f, 13.254365f, 7.8362027e-05f, -0.084336944f, 16.049692f, \
+    -0.0003992256f, 0.39079779f, -101.11929f, -0.00033596458f, 0.32818678f, -85.731018f, -0.00028119553f, 0.27396604f, \
+    -72.404694f, -0.00023349051f, 0.22672909f, -60.795101f, -0.00019171492f, 0.18535787f, -50.627743f, -0.00015495732f, \
+    0.14895372f, -41.681957f, -0.00012247825f, 0.11678715f, -33.778564f, -9.367225e-05f, 0.088260531f, -26.770765f, \
+    -6.8039502e-05f, 0.062880278f, -20.537285f, -4.5164303e-05f, 0.040235631f, -14.977187f, -2.46985e-05f, 0.019982444f, \
+    -10.005881f, -6.3489338e-06f, 0.0018307811f, -5.5520954f, 1.0132861e-05f, -0.014465199f, -1.5553859f, 2.4958119e-05f, \
+    -0.029114584f, 2.0356605f, 3.8306964e-05f, -0.04229572f, 5.2649035f, 5.0332834e-05f, -0.05416058f, 8.1697168f, \
+    -0.00040670301f, 0.40105906f, -104.2336f, -0.00034826316f, 0.34315109f, -89.983353f, -0.00029721612f, 0.29255471f, \
+    -77.531883f, -0.00025238356f, 0.24810821f, -66.593758f, -0.00021281737f, 0.20887642f, -56.939144f, -0.00017774706f, \
+    0.17409892f, -48.381134f, -0.00014654081f, 0.14315188f, -40.766357f, -0.00011867624f, 0.1155192f, -33.967911f, \
+    -9.3718139e-05f, 0.090770751f, -27.880011f, -7.1301431e-05f, 0.068545528f, -22.413853f, -5.1117939e-05f, 0.048538629f, \
+    -17.494425f, -3.2905944e-05f, 0.030491026f, -13.057985f, -1.644216e-05f, 0.014181613f, -9.0501194f, -1.5350023e-06f, \
+    -0.00057939457f, -5.4241138f, 1.1980406e-05f, -0.013955392f, -2.1397419f, 2.4246414e-05f, -0.026087493f, 0.83773971f, \
+    -0.00041386552f, 0.41074336f, -107.15162f, -0.00035958012f, 0.35689312f, -93.884537f, -0.00031178852f, 0.30947131f, \
+    -82.200539f, -0.0002695068f, 0.26750702f, -71.860809f, -0.0002319342f, 0.23020971f, -62.670898f, -0.00019841333f, \
+    0.19693002f, -54.471039f, -0.00016839987f, 0.16713005f, -47.128872f, -0.00014143984f, 0.14036097f, -40.533924f, \
+    -0.0001171519f, 0.11624555f, -34.593349f, -9.5213705e-05f, 0.094464824f, -29.228601f, -7.535117e-05f, 0.074747421f, \
+    -24.372862f, -5.7329918e-05f, 0.056861196f, -19.968952f, -4.0948686e-05f, 0.040606719f, -15.967751f, -2.6033609e-05f, \
+    0.025811631f, -12.326789f, -1.2434043e-05f, 0.012326541f, -9.0092564f, -1.8954157e-08f, 2.145036e-05f, -5.9831147f, \
+    -0.00090538705f, 0.78989959f, -174.71892f, -0.00024882556f, 0.16630521f, -27.64484f, 0.00013060712f, -0.19030571f, \
+    55.340546f, 0.00029481019f, -0.34512618f, 91.414673f, 0.00035117377f, -0.39746812f, 103.4558f, 0.0003718904f, \
+    -0.41574496f, 107.47552f, 0.00038128643f, -0.42324603f, 108.96589f, 0.00038585954f, -0.42620417f, 109.39885f, \
+    0.00038777638f, -0.42669281f, 109.26305f, 0.00038804009f, -0.42566803f, 108.78314f, 0.00038722128f, -0.42367139f, \
+    108.08591f, 0.00038568012f, -0.42104316f, 107.25075f, 0.00038365507f, -0.4180074f, 106.32971f, 0.0003813073f, \
+    -0.41471449f, 105.35752f, 0.00037874698f, -0.41126618f, 104.35752f, 0.00037605039f, -0.40773219f, 103.34551f, \
+    -0.00049248524f, 0.41910079f, -91.609032f, -9.8424243e-05f, 0.043689266f, -2.8159587f, 9.1762318e-05f, -0.13693267f, \
+    39.648907f, 0.00019651593f, -0.23636398f, 62.98032f, 0.00025188681f, -0.28867981f, 75.203415f, 0.00027822301f, \
+    -0.31313488f, 80.834175f, 0.0002923604f, -0.32587475f, 83.692047f, 0.00030070936f, -0.33306807f, 85.239578f, \
+    0.00030597721f, -0.33732399f, 86.095993f, 0.00030935186f, -0.33978659f, 86.532623f, 0.00031144914f, -0.34104773f, \
+    86.689651f, 0.00031264024f, -0.34146374f, 86.651306f, 0.00031317046f, -0.34126943f, 86.473045f, 0.00031321056f, \
+    -0.34062803f, 86.193336f, 0.0003128832f, -0.33965641f, 85.839661f, 0.00031227793f, -0.33843964f, 85.431976f, \
+    -0.00028650553f, 0.23634957f, -51.133736f, -6.9590475e-05f, 0.028040752f, -1.4974912f, 5.5677283e-05f, -0.091957979f, \
+    26.971731f, 0.00013352009f, -0.16637343f, 44.569584f, 0.00018289543f, -0.21344782f, 55.668499f, 0.00021244383f, \
+    -0.24142459f, 62.224636f, 0.00022982749f, -0.25765735f, 65.984283f, 0.00024085914f, -0.26775888f, 68.284676f, \
+    0.00024826298f, -0.27436379f, 69.753983f, 0.00025346875f, -0.27885637f, 70.722458f, 0.00025722879f, -0.28196505f, \
+    71.363838f, 0.00025996781f, -0.28410056f, 71.776024f, 0.00026195214f, -0.28552026f, 72.020264f, 0.00026336237f, \
+    -0.28639844f, 72.138031f, 0.00026432757f, -0.28685951f, 72.15889f, 0.0002649432f, -0.28699529f, 72.104622f, \
+    -0.00021494423f, 0.17683075f, -38.84296f, -6.9780384e-05f, 0.036583208f, -5.2255917f, 2.4023715e-05f, -0.05392094f, \
+    16.411697f, 8.7120432e-05f, -0.1146676f, 30.889814f, 0.0001307827f, -0.15660574f, 40.857166f, 0.00016077375f, \
+    -0.18530856f, 47.65498f, 0.00018066635f, -0.20421885f, 52.107372f, 0.00019391076f, -0.21667616f, 55.014019f, \
+    0.00020315479f, -0.22525211f, 56.991581f, 0.00020985209f, -0.23135974f, 58.378937f, 0.00021486498f, -0.23583795f, \
+    59.377335f, 0.00021871126f, -0.23919061f, 60.107639f, 0.00022170717f, -0.24172528f, 60.643593f, 0.00022405809f, \
+    -0.24364156f, 61.033009f, 0.00022590603f, -0.24507731f, 61.308899f, 0.00022735399f, -0.24613255f, 61.495178f, \
+    -0.00018625615f, 0.15592341f, -35.237213f, -7.8598867e-05f, 0.051426969f, -10.071299f, -3.5837268e-06f, -0.021341516f, \
+    7.4272165f, 5.0108076e-05f, -0.07335458f, 19.908863f, 8.9323483e-05f, -0.11127044f, 28.985693f, 0.00011826233f, \
+    -0.13918114f, 35.649757f, 0.00013938543f, -0.1594789f, 40.479519f, 0.00015452394f, -0.17394182f, 43.903591f, \
+    0.0001654243f, -0.18427064f, 46.331902f, 0.00017351536f, -0.19186024f, 48.100883f, 0.00017968612f, -0.19757903f, \
+    49.419979f, 0.00018450424f, -0.20198177f, 50.422993f, 0.00018834366f, -0.20543404f, 51.19809f, 0.00019145058f, \
+    -0.20817651f, 51.803303f, 0.00019399136f, -0.2103717f, 52.277794f, 0.00019608325f, -0.21213412f, 52.649139f, \
+    -0.00017487002f, 0.15017027f, -34.948582f, -8.9864137e-05f, 0.067352913f, -14.927507f, -2.7429174e-05f, 0.0065399176f, \
+    -0.23968638f, 1.9407582e-05f, -0.039047472f, 10.756919f, 5.5098935e-05f, -0.073744267f, 19.112984f, 8.25936e-05f, \
+    -0.10042624f, 25.526239f, 0.00010384172f, -0.12099773f, 30.459133f, 0.00012012501f, -0.13670978f, 34.215252f, \
+    0.00013248135f, -0.14857577f, 37.040169f, 0.00014187813f, -0.15754214f, 39.163212f, 0.00014916316f, -0.16444018f, \
+    40.785892f, 0.00015492814f, -0.16985044f, 42.048946f, 0.00015957232f, -0.17416474f, 43.04734f, 0.00016337443f, \
+    -0.17765671f, 43.847393f, 0.00016653028f, -0.18051864f, 44.495701f, 0.00016917834f, -0.18288641f, 45.025181f, \
+    -0.00017142567f, 0.15108646f, -36.05592f, -0.00010143526f, 0.082688816f, -19.468353f, -4.7986956e-05f, 0.030459158f, \
+    -6.8095174f, -6.4625515e-06f, -0.010103505f, 3.0135889f, 2.6232743e-05f, -0.042018674f, 10.734448f, 5.2235038e-05f, \
+    -0.067372695f, 16.86005f, 7.3049167e-05f, -0.087636851f, 21.748077f, 8.9726716e-05f, -0.10383996f, 25.648716f, \
+    0.00010301462f, -0.11671288f, 28.739683f, 0.00011354114f, -0.12687121f, 31.170681f, 0.00012188252f, -0.13488068f, \
+    33.079323f, 0.000128567f, -0.14126095f, 34.592098f, 0.00013400659f, -0.14641778f, 35.807796f, 0.00013849625f, \
+    -0.15064171f, 36.797142f, 0.00014224973f, -0.15414335f, 37.611404f, 0.00014542445f, -0.15707785f, 38.288338f, \
+    -0.00017190243f, 0.15508811f, -37.76033f, -0.00011253506f, 0.096921355f, -23.615896f, -6.5815118e-05f, 0.051143095f, \
+    -12.488523f, -2.8519204e-05f, 0.014605068f, -3.6120801f, 1.5987598e-06f, -0.014888525f, 3.5479338f, 2.6143156e-05f, \
+    -0.03890755f, 9.3737593f, 4.6283374e-05f, -0.058597203f, 14.144306f, 6.2882762e-05f, -0.074803576f, 18.065681f, \
+    7.6573655e-05f, -0.088146575f, 21.288897f, 8.7826869e-05f, -0.099087834f, 23.926394f, 9.7042837e-05f, -0.10802056f, \
+    26.073992f, 0.00010458672f, -0.11530401f, 27.819313f, 0.00011079739f, -0.12127234f, 29.243925f, 0.00011596536f, \
+    -0.1262124f, 30.417891f, 0.00012031454f, -0.13034542f, 31.395252f, 0.00012401315f, -0.13383766f, 32.216629f, \
+    -0.00017438168f, 0.16050366f, -39.697453f, -0.00012289883f, 0.10994922f, -27.375425f, -8.1401726e-05f, 0.069194756f, \
+    -17.444733f, -4.7547466e-05f, 0.035947736f, -9.3464565f, -1.965095e-05f, 0.0085579194f, -2.6781647f, 3.5257815e-06f, \
+    -0.014188026f, 2.8561065f, 2.2908825e-05f, -0.033198468f, 7.4779835f, 3.9201237e-05f, -0.049163498f, 11.355867f, \
+    5.294173e-05f, -0.062612191f, 14.618891f, 6.4541149e-05f, -0.073948167f, 17.365562f, 7.4315409e-05f, -0.083481818f, \
+    19.671619f, 8.2532373e-05f, -0.091476627f, 21.601387f, 8.9435998e-05f, -0.098172992f, 23.213606f, 9.5251395e-05f, \
+    -0.1037932f, 24.562639f, 0.00010018265f, -0.1085391f, 25.697903f, 0.00010440013f, -0.11257938f, 26.660711f, \
+    -0.00017787899f, 0.16650143f, -41.691772f, -0.00013246664f, 0.1218207f, -30.779057f, -9.514048e-05f, 0.085089043f, \
+    -21.809395f, -6.414167e-05f, 0.054582633f, -14.361835f, -3.8171616e-05f, 0.029027781f, -8.1252642f, -1.6253722e-05f, \
+    0.0074659027f, -2.865483f, 2.3583107e-06f, -0.010836056f, 1.5966483f, 1.824271e-05f, -0.026446443f, 5.4000483f, \
+    3.1852596e-05f, -0.039810915f, 8.6536655f, 4.3545762e-05f, -0.051281549f, 11.443583f, 5.360445e-05f, -0.061136171f, \
+    13.83773f, 6.2251464e-05f, -0.069594122f, 15.88973f, 6.9674352e-05f, -0.076840192f, 17.644768f, 7.6042917e-05f, \
+    -0.083041914f, 19.143848f, 8.151355e-05f, -0.088353895f, 20.424839f, 8.6230277e-05f, -0.092918754f, 21.522709f, \
+    -0.00018186307f, 0.17265104f, -43.6567f, -0.00014126164f, 0.13263428f, -33.865269f, -0.00010734313f, 0.099196933f, \
+    -25.684591f, -7.8752048e-05f, 0.071008548f, -18.789301f, -5.446517e-05f, 0.047064159f, -12.933562f, -3.3697615e-05f, \
+    0.026592314f, -7.9286256f, -1.5838697e-05f, 0.0089924065f, -3.6275051f, -4.0729756e-07f, -0.0062090512f, 0.085698411f, \
+    1.2979796e-05f, -0.019389421f, 3.3033721f, 2.4630624e-05f, -0.030852206f, 6.0998349f, 3.4794459e-05f, -0.040843133f, \
+    8.535265f, 4.3673354e-05f, -0.049561456f, 10.658463f, 5.1430889e-05f, -0.057168506f, 12.50894f, 5.8203961e-05f, \
+    -0.063799366f, 14.11978f, 6.4114982e-05f, -0.069574974f, 15.52062f, 6.9276815e-05f, -0.074607007f, 16.738855f, \
+    -0.00018603748f, 0.178726f, -45.550003f, -0.00014933864f, 0.14249924f, -36.671379f, -0.00011825662f, 0.1118097f, \
+    -29.150265f, -9.172369e-05f, 0.085608043f, -22.729694f, -6.8918453e-05f, 0.06308648f, -17.211807f, -4.9199985e-05f, \
+    0.04361432f, -12.442086f, -3.2061846e-05f, 0.026692891f, -8.2983379f, -1.709931e-05f, 0.01192345f, -4.6828299f, \
+    -3.9856754e-06f, -0.0010160767f, -1.516607f, 7.5451562e-06f, -0.012388156f, 1.2646849f, 1.7711589e-05f, -0.022408323f, \
+    3.7139032f, 2.6693935e-05f, -0.031254608f, 5.8747125f, 3.4641605e-05f, -0.039074585f, 7.7833123f, 4.1678333e-05f, \
+    -0.045990501f, 9.4696894f, 4.7907914e-05f, -0.052104931f, 10.959005f, 5.3421685e-05f, -0.057508219f, 12.273431f, \
+    -0.00019023374f, 0.18460843f, -47.35247f, -0.0001567619f, 0.15152051f, -39.231068f, -0.0001280779f, 0.12315829f, \
+    -32.269699f, -0.00010332497f, 0.098678812f, -26.261681f, -8.1833154e-05f, 0.077422425f, -21.045244f, -6.3071864e-05f, \
+    0.058866449f, -16.492186f, -4.661614e-05f, 0.042592f, -12.499736f, -3.2122152e-05f, 0.02825997f, -8.984683f, \
+    -1.9309111e-05f, 0.015593287f, -5.8790236f, -7.9458123e-06f, 0.0043636691f, -3.1267171f, 2.1595697e-06f, -0.0056183706f, \
+    -0.68123966f, 1.1167186e-05f, -0.014511111f, 1.4962777f, 1.9211549e-05f, -0.022447554f, 3.4385009f, 2.6406027e-05f, \
+    -0.029539835f, 5.1729751f, 3.2846347e-05f, -0.035882674f, 6.7229695f, 3.8613645e-05f, -0.041556381f, 8.1082125f, \
+    -0.00019435577f, 0.19023988f, -49.057087f, -0.00016359547f, 0.1597932f, -41.573818f, -0.00013696552f, 0.13342784f, \
+    -35.093575f, -0.00011376759f, 0.11045589f, -29.447498f, -9.3447627e-05f, 0.090331301f, -24.501532f, -7.5561111e-05f, \
+    0.072615705f, -20.148031f, -5.9747748e-05f, 0.056953635f, -16.29969f, -4.5712812e-05f, 0.043054126f, -12.885036f, \
+    -3.3213168e-05f, 0.030677035f, -9.8450632f, -2.204669e-05f, 0.019622624f, -7.1306858f, -1.204417e-05f, 0.0097235981f, \
+    -4.7007837f, -3.0630429e-06f, 0.00083893479f, -2.520689f, 5.0174708e-06f, -0.0071508912f, -0.56101155f, 1.2300238e-05f, \
+    -0.014347725f, 1.203294f, 1.8873199e-05f, -0.020838663f, 2.7936504f, 2.4811752e-05f, -0.026698414f, 4.2284336f, \
+    -0.00019834987f, 0.19559537f, -50.663361f, -0.00016989907f, 0.16740136f, -43.725105f, -0.00014504844f, 0.14276838f, \
+    -37.662941f, -0.00012322086f, 0.12112738f, -32.337055f, -0.00010395263f, 0.10202091f, -27.635014f, -8.6867389e-05f, \
+    0.085077487f, -23.465513f, -7.1656854e-05f, 0.069992654f, -19.753696f, -5.8066355e-05f, 0.056514792f, -16.437695f, \
+    -4.5883891e-05f, 0.044434331f, -13.465961f, -3.4931731e-05f, 0.033575483f, -10.795255f, -2.5059895e-05f, 0.023789851f, \
+    -8.3890648f, -1.6141053e-05f, 0.014951386f, -6.2163715f, -8.066545e-06f, 0.0069524655f, -4.2506871f, -7.431201e-07f, \
+    -0.00029930042f, -2.4692669f, 5.9095646e-06f, -0.0068835523f, -0.85250294f, 1.1961015e-05f, -0.012869215f, 0.61657697f, \
+    -0.0002021874f, 0.2006688f, -52.174248f, -0.00017572683f, 0.17441839f, -45.706825f, -0.00015243253f, 0.1513028f, \
+    -40.011414f, -0.00013182187f, 0.13084568f, -34.970848f, -0.00011350264f, 0.11265977f, -30.489862f, -9.7153228e-05f, \
+    0.096427336f, -26.490286f, -8.2507657e-05f, 0.081885479f, -22.907423f, -6.9344263e-05f, 0.068815023f, -19.687328f, \
+    -5.7477027e-05f, 0.057031929f, -16.784695f, -4.674881e-05f, 0.046380658f, -14.161229f, -3.702605e-05f, 0.036728963f, \
+    -11.784361f, -2.8194598e-05f, 0.027963752f, -9.626235f, -2.0156411e-05f, 0.019987863f, -7.6629157f, -1.2826825e-05f, \
+    0.012717344f, -5.8737178f, -6.1324408e-06f, 0.0060793897f, -4.2406993f, -9.3581969e-09f, 1.0590637e-05f, -2.7482307f, \
+    -0.00087031472f, 0.77699661f, -174.77348f, -0.0001369255f, 0.085580468f, -12.58927f, 0.00010862731f, -0.14703506f, \
+    42.025288f, 0.00020821657f, -0.24168763f, 64.296501f, 0.00024355107f, -0.27473068f, 71.965546f, 0.00025863186f, \
+    -0.28827551f, 74.999107f, 0.00026648652f, -0.29489359f, 76.391701f, 0.00027082121f, -0.2981641f, 76.99633f, \
+    0.00027317819f, -0.29957464f, 77.167206f, 0.00027434068f, -0.29987919f, 77.083519f, 0.00027474223f, -0.29949334f, \
+    76.84375f, 0.00027463923f, -0.29866159f, 76.505562f, 0.00027419277f, -0.29753643f, 76.104721f, 0.00027350936f, \
+    -0.29621777f, 75.664482f, 0.00027266203f, -0.29477358f, 75.200554f, 0.00027170245f, -0.29325131f, 74.723785f, \
+    -0.00029722415f, 0.25156456f, -54.549911f, -5.0563041e-05f, 0.016210293f, 1.2067376f, 7.1115253e-05f, -0.10004093f, \
+    28.723532f, 0.00013686249f, -0.16290888f, 43.604954f, 0.00017123102f, -0.19561006f, 51.312164f, 0.00018922068f, \
+    -0.21248418f, 55.241375f, 0.00019982069f, -0.22221336f, 57.464531f, 0.00020669795f, -0.22835146f, 58.831905f, \
+    0.00021140915f, -0.2324083f, 59.704895f, 0.0002147398f, -0.23514557f, 60.26577f, 0.00021714139f, -0.23700081f, \
+    60.619194f, 0.00021889221f, -0.23824333f, 60.829498f, 0.00022017206f, -0.23904684f, 60.938137f, 0.00022110216f, \
+    -0.23952809f, 60.972885f, 0.00022176717f, -0.23976837f, 60.953056f, 0.00022222823f, -0.23982619f, 60.892487f, \
+    -0.00017194009f, 0.14055409f, -29.996723f, -3.6624202e-05f, 0.010446463f, 1.0453614f, 4.2574182e-05f, -0.06570445f, \
+    19.188089f, 9.1836191e-05f, -0.11306085f, 30.460192f, 0.000122834f, -0.14279555f, 37.522747f, 0.00014194407f, \
+    -0.16101493f, 41.827553f, 0.00015413662f, -0.17251948f, 44.522091f, 0.00016245301f, -0.18026145f, 46.314514f, \
+    0.00016845946f, -0.18576445f, 47.570816f, 0.00017297668f, -0.18982744f, 48.483002f, 0.00017647214f, -0.19290552f, \
+    49.160439f, 0.00017923629f, -0.19528142f, 49.671051f, 0.00018146033f, -0.19714116f, 50.059509f, 0.0001832752f, \
+    -0.19861197f, 50.35635f, 0.00018477337f, -0.19978368f, 50.583099f, 0.00018602202f, -0.20072138f, 50.755348f, \
+    -0.00012926095f, 0.10530037f, -22.775448f, -3.8838043e-05f, 0.017863184f, -1.7980951f, 1.9895888e-05f, -0.038917389f, \
+    11.806712f, 5.9671442e-05f, -0.077346399f, 21.002909f, 8.7208246e-05f, -0.10391405f, 27.350538f, 0.00010624349f, \
+    -0.12222368f, 31.713072f, 0.00011938258f, -0.13479343f, 34.694134f, 0.00012872621f, -0.1436647f, 36.784622f, \
+    0.00013565409f, -0.15018229f, 38.308552f, 0.00014098882f, -0.15514925f, 39.459579f, 0.00014522296f, -0.15904675f, \
+    40.353794f, 0.00014866312f, -0.16217439f, 41.063465f, 0.00015151105f, -0.16472925f, 41.636143f, 0.00015390578f, \
+    -0.16684718f, 42.104576f, 0.00015594643f, -0.16862492f, 42.4921f, 0.00015770554f, -0.17013328f, 42.815762f, \
+    -0.00011271958f, 0.093577325f, -20.844995f, -4.5623205e-05f, 0.028408742f, -5.1405354f, 1.1860492e-06f, -0.017048815f, \
+    5.803555f, 3.482365e-05f, -0.049695581f, 13.654398f, 5.9499602e-05f, -0.073618971f, 19.399694f, 7.7774028e-05f, \
+    -0.091303706f, 23.639042f, 9.1300717e-05f, -0.10435426f, 26.759075f, 0.00010136771f, -0.11402347f, 29.061895f, \
+    0.00010902558f, -0.12133686f, 30.795286f, 0.00011501801f, -0.12702197f, 32.135242f, 0.00011983446f, -0.13155818f, \
+    33.197815f, 0.00012379614f, -0.13526034f, 34.059231f, 0.00012711753f, -0.13833869f, 34.770405f, 0.00012994657f, \
+    -0.14093828f, 35.366459f, 0.00013238892f, -0.14316268f, 35.872467f, 0.0001345222f, -0.14508797f, 36.306843f, \
+    -0.00010665241f, 0.091012657f, -20.915607f, -5.3588956e-05f, 0.039289374f, -8.4057312f, -1.461068e-05f, 0.0012962208f, \
+    0.77736843f, 1.4675018e-05f, -0.027237842f, 7.6681919f, 3.705778e-05f, -0.049028825f, 12.92491f, 5.4366788e-05f, \
+    -0.065859132f, 16.979465f, 6.7823501e-05f, -0.078919142f, 20.120152f, 7.8302757e-05f, -0.089061804f, 22.55344f, \
+    8.6517946e-05f, -0.09698423f, 24.448193f, 9.3060589e-05f, -0.10326591f, 25.944977f, 9.8377284e-05f, -0.10834517f, \
+    27.150211f, 0.00010278437f, -0.11253279f, 28.139381f, 0.00010650376f, -0.11604693f, 28.965494f, 0.00010969224f, \
+    -0.11904173f, 29.66601f, 0.00011246254f, -0.12162806f, 30.267866f, 0.00011489764f, -0.12388754f, 30.79089f, \
+    -0.00010536277f, 0.092444837f, -21.819164f, -6.1579791e-05f, 0.049640819f, -11.434852f, -2.8150322e-05f, 0.016956285f, \
+    -3.5090702f, -2.1587537e-06f, -0.0084505286f, 2.6481135f, 1.8341258e-05f, -0.028478742f, 7.4979429f, 3.4688641e-05f, \
+    -0.044436097f, 11.358126f, 4.7824644e-05f, -0.057242598f, 14.452192f, 5.8422447e-05f, -0.067556523f, 16.940052f, \
+    6.6996276e-05f, -0.075881153f, 18.943962f, 7.3975512e-05f, -0.082637496f, 20.566278f, 7.9722427e-05f, -0.088181563f, \
+    21.893633f, 8.4525134e-05f, -0.092796884f, 22.995081f, 8.8600151e-05f, -0.096696734f, 23.922588f, 9.2107424e-05f, \
+    -0.10003878f, 24.714582f, 9.5165218e-05f, -0.10293964f, 25.399485f, 9.7861768e-05f, -0.1054863f, 25.998503f, \
+    -0.00010641634f, 0.095707029f, -23.073364f, -6.9189344e-05f, 0.059220489f, -14.198532f, -3.9899543e-05f, 0.030509219f, \
+    -7.2170386f, -1.6505901e-05f, 0.0075796349f, -1.6438553f, 2.408492e-06f, -0.010953532f, 2.8581524f, 1.7853041e-05f, \
+    -0.02607804f, 6.5294447f, 3.0562347e-05f, -0.038513329f, 9.5452032f, 4.1079795e-05f, -0.048791938f, 12.035115f, \
+    4.9814247e-05f, -0.057314791f, 14.096826f, 5.7090554e-05f, -0.064400755f, 15.80801f, 6.3184169e-05f, -0.070320658f, \
+    17.234695f, 6.833121e-05f, -0.075307071f, 18.43363f, 7.2727038e-05f, -0.079552703f, 19.451874f, 7.6525932e-05f, \
+    -0.08320988f, 20.326641f, 7.9846905e-05f, -0.086396173f, 21.086662f, 8.2781313e-05f, -0.08920189f, 21.754009f, \
+    -0.00010865663f, 0.099794321f, -24.459785f, -7.6290795e-05f, 0.068002857f, -16.709375f, -5.02084e-05f, 0.042378634f, \
+    -10.463737f, -2.8921178e-05f, 0.021465247f, -5.367867f, -1.1362588e-05f, 0.0042181197f, -1.1670779f, 3.248824e-06f, \
+    -0.010128734f, 2.3254437f, 1.5496638e-05f, -0.022147791f, 5.2493525f, 2.5823778e-05f, -0.032273863f, 7.7107415f, \
+    3.4570912e-05f, -0.040841598f, 9.7912798f, 4.2004212e-05f, -0.048112627f, 11.554826f, 4.8340506e-05f, -0.054300278f, \
+    13.053467f, 5.3765663e-05f, -0.059587695f, 14.331952f, 5.8441139e-05f, -0.064134218f, 15.429248f, 6.2504449e-05f, \
+    -0.068075746f, 16.378614f, 6.6068722e-05f, -0.071524188f, 17.207449f, 6.9224596e-05f, -0.074569277f, 17.937735f, \
+    -0.00011149274f, 0.10420961f, -25.874023f, -8.2867118e-05f, 0.076037899f, -18.992292f, -5.9343285e-05f, 0.052882195f, \
+    -13.336595f, -3.9800332e-05f, 0.033643745f, -8.6386604f, -2.3413528e-05f, 0.01751353f, -4.7009058f, -9.5643218e-06f, \
+    0.003884316f, -1.3749927f, 2.2190518e-06f, -0.0077073635f, 1.4523259f, 1.2301761e-05f, -0.017620504f, 3.8687906f, \
+    2.0970137e-05f, -0.02613678f, 5.9432602f, 2.8451272e-05f, -0.033479735f, 7.7303905f, 3.4927736e-05f, -0.039829198f, \
+    9.2741613f, 4.0550865e-05f, -0.04533435f, 10.611069f, 4.5451361e-05f, -0.050124213f, 11.772696f, 4.9743976e-05f, \
+    -0.054312214f, 12.786836f, 5.3528503e-05f, -0.057997126f, 13.677703f, 5.6889698e-05f, -0.061262924f, 14.465896f, \
+    -0.0001146072f, 0.10869739f, -27.2651f, -8.8944209e-05f, 0.083398104f, -21.073977f, -6.7509194e-05f, 0.062262002f, \
+    -15.902039f, -4.9435341e-05f, 0.044438165f, -11.541213f, -3.4070563e-05f, 0.029286005f, -7.8348193f, -2.0916032e-05f, \
+    0.016315145f, -4.6628876f, -9.5844416e-06f, 0.0051445994f, -1.9321864f, 2.2892294e-07f, -0.0045255846f, 0.43070176f, \
+    8.7666667e-06f, -0.012934366f, 2.4842794f, 1.6224018e-05f, -0.02027416f, 4.2756643f, 2.2759656e-05f, -0.026701448f, \
+    5.843184f, 2.8504037e-05f, -0.032344967f, 7.2183766f, 3.3566779e-05f, -0.037312966f, 8.4277697f, 3.8043032e-05f, \
+    -0.041699506f, 9.4944296f, 4.2017e-05f, -0.045587942f, 10.438808f, 4.5563029e-05f, -0.049051948f, 11.278998f, \
+    -0.00011782375f, 0.11312448f, -28.608553f, -9.4563118e-05f, 0.090158179f, -22.979279f, -7.4865871e-05f, 0.070705466f, \
+    -18.21139f, -5.8046873e-05f, 0.054092851f, -14.139966f, -4.3580811e-05f, 0.039803606f, -10.638454f, -3.1058928e-05f, \
+    0.027435411f, -7.6082954f, -2.0158959e-05f, 0.01667087f, -4.9717135f, -1.0623774e-05f, 0.007256581f, -2.666604f, \
+    -2.2460038e-06f, -0.0010119369f, -0.642838f, 5.1432435e-06f, -0.0083013251f, 1.1404452f, 1.1682775e-05f, -0.01474862f, \
+    2.7168548f, 1.7487671e-05f, -0.020467496f, 4.1142769f, 2.2654269e-05f, -0.025553172f, 5.3560762f, 2.7264477e-05f, \
+    -0.030086663f, 6.4621358f, 3.1389667e-05f, -0.034138616f, 7.4498072f, 3.5093311e-05f, -0.037771944f, 8.334547f, \
+    -0.00012104292f, 0.11742245f, -29.893581f, -9.9768142e-05f, 0.096387528f, -24.730152f, -8.1539423e-05f, 0.078359827f, \
+    -20.304916f, -6.5805078e-05f, 0.062796362f, -16.484755f, -5.2135114e-05f, 0.049273681f, -13.165824f, -4.0189963e-05f, \
+    0.037457172f, -10.26605f, -2.9698276e-05f, 0.027079292f, -7.7197962f, -2.044089e-05f, 0.017923832f, -5.4740067f, \
+    -1.223906e-05f, 0.0098143499f, -3.4853764f, -4.9456903e-06f, 0.0026055675f, -1.7182385f, 1.5612794e-06f, -0.0038231334f, \
+    -0.14297536f, 7.3839255e-06f, -0.0095726801f, 1.2652016f, 1.2608269e-05f, -0.01472817f, 2.5271976f, 1.7307402e-05f, \
+    -0.01936195f, 3.6607907f, 2.1544138e-05f, -0.023536237f, 4.6812725f, 2.5373423e-05f, -0.027305489f, 5.602036f, \
+    -0.00012420853f, 0.12155831f, -31.116594f, -0.00010460193f, 0.102148f, -26.345566f, -8.7630666e-05f, 0.08534237f, \
+    -22.214678f, -7.2843432e-05f, 0.070696749f, -18.614784f, -5.9883365e-05f, 0.057859309f, -15.459509f, -4.8464968e-05f, \
+    0.046548422f, -12.679696f, -3.8357375e-05f, 0.036536232f, -10.219382f, -2.9372093e-05f, 0.027636597f, -8.0328407f, \
+    -2.1353853e-05f, 0.019696109f, -6.0823755f, -1.4173704e-05f, 0.012587291f, -4.336658f, -7.7237301e-06f, 0.0062034102f, \
+    -2.7694502f, -1.9129816e-06f, 0.00045446289f, -1.3586227f, 3.3357182e-06f, -0.0047359639f, -0.08538343f, 8.0882992e-06f, \
+    -0.0094331792f, 1.0663329f, 1.2401485e-05f, -0.013693404f, 2.1103592f, 1.6324506e-05f, -0.017565459f, 3.0587108f, \
+    -0.0001272896f, 0.12551877f, -32.277809f, -0.00010910354f, 0.1074936f, -27.841776f, -9.3221184e-05f, 0.091747753f, \
+    -23.966532f, -7.9268262e-05f, 0.07791204f, -20.561361f, -6.6945024e-05f, 0.065690637f, -17.553566f, -5.6008885e-05f, \
+    0.054844018f, -14.884264f, -4.6261594e-05f, 0.045176331f, -12.505302f, -3.7539714e-05f, 0.036526036f, -10.376957f, \
+    -2.970742e-05f, 0.028758811f, -8.4661875f, -2.2650969e-05f, 0.021762121f, -6.7453108f, -1.6274456e-05f, 0.015441032f, \
+    -5.1909647f, -1.0496481e-05f, 0.0097149266f, -3.7833092f, -5.2475284e-06f, 0.0045149261f, -2.5053873f, -4.6787582e-07f, \
+    -0.00021817454f, -1.3426216f, 3.8940861e-06f, -0.0045355624f, -0.28240547f, 7.8832327e-06f, -0.008481768f, 0.68623084f, \
+    -0.00013027016f, 0.12930164f, -33.379429f, -0.00011330792f, 0.11247121f, -29.232685f, -9.8377721e-05f, 0.097653255f, \
+    -25.581581f, -8.5165426e-05f, 0.084537603f, -22.349827f, -7.3416581e-05f, 0.072872907f, -19.475588f, -6.2923107e-05f, \
+    0.06245352f, -16.908268f, -5.3513351e-05f, 0.05310972f, -14.606094f, -4.5044573e-05f, 0.044700295f, -12.534309f, \
+    -3.7397178e-05f, 0.037106887f, -10.663773f, -3.0470277e-05f, 0.030229589f, -8.9698839f, -2.4178211e-05f, 0.023983549f, \
+    -7.4317427f, -1.8447818e-05f, 0.018296255f, -6.031486f, -1.3216242e-05f, 0.01310538f, -4.753758f, -8.4292005e-06f, \
+    0.008357076f, -3.5852861f, -4.0395585e-06f, 0.0040045632f, -2.5145404f, -6.1801111e-09f, 6.9940043e-06f, -1.5314491f, \
+    -0.00061371247f, 0.54652065f, -122.43465f, -7.600565e-05f, 0.038634561f, -3.0802422f, 0.00010382771f, -0.13294926f, \
+    37.527016f, 0.00017116066f, -0.19731909f, 52.783649f, 0.0001960175f, -0.2206592f, 58.23159f, 0.00020801481f, \
+    -0.23155376f, 60.699741f, 0.00021491711f, -0.23754145f, 61.997818f, 0.00021927597f, -0.24110124f, 62.72121f, \
+    0.00022219292f, -0.24330175f, 63.126274f, 0.00022421998f, -0.24467681f, 63.340733f, 0.0002256673f, -0.24552497f, \
+    63.435749f, 0.00022672428f, -0.24602751f, 63.454327f, 0.00022751375f, -0.24630117f, 63.424015f, 0.00022811891f, \
+    -0.24642447f, 63.363201f, 0.00022859807f, -0.2464519f, 63.284565f, 0.00022899332f, -0.24642241f, 63.197083f, \
+    -0.00020349665f, 0.17032132f, -36.341587f, -2.3020099e-05f, -0.0023414902f, 4.6768332f, 6.5865104e-05f, -0.087743707f, \
+    25.020367f, 0.00011246813f, -0.13256708f, 35.704475f, 0.00013666406f, -0.15570554f, 41.192932f, 0.00015029492f, \
+    -0.16857854f, 44.214111f, 0.00015901921f, -0.17668535f, 46.090076f, 0.00016512473f, -0.18225504f, 47.357796f, \
+    0.0001696674f, -0.18631734f, 48.265446f, 0.00017320462f, -0.18941557f, 48.943966f, 0.0001760579f, -0.1918629f, \
+    49.468758f, 0.0001784264f, -0.19385292f, 49.886372f, 0.00018044093f, -0.19551258f, 50.227268f, 0.00018219155f, \
+    -0.19692899f, 50.512318f, 0.0001837427f, -0.1981643f, 50.756355f, 0.00018514182f, -0.19926409f, 50.970245f, \
+    -0.00011629506f, 0.093254194f, -19.341478f, -1.7704559e-05f, -0.0017532402f, 3.3791099f, 4.0091792e-05f, -0.057556819f, \
+    16.73605f, 7.5704687e-05f, -0.091961041f, 24.972267f, 9.7896271e-05f, -0.11335222f, 30.083208f, 0.00011197534f, \
+    -0.12684627f, 33.291847f, 0.00012151927f, -0.13591908f, 35.434345f, 0.00012846074f, -0.14245602f, 36.965633f, \
+    0.00013379457f, -0.14742918f, 38.120583f, 0.00013806798f, -0.1513737f, 39.028549f, 0.00014160639f, -0.15460786f, \
+    39.766479f, 0.00014461526f, -0.15733255f, 40.382923f, 0.00014723082f, -0.15968086f, 40.91003f, 0.00014954725f, \
+    -0.1617447f, 41.369984f, 0.00015163209f, -0.16358992f, 41.778648f, 0.00015353526f, -0.1652651f, 42.14772f, \
+    -8.7745575e-05f, 0.070012756f, -14.663844f, -2.1969236e-05f, 0.0063018496f, 0.64755738f, 2.0825488e-05f, -0.035187729f, \
+    10.619941f, 4.978037e-05f, -0.063266262f, 17.367859f, 6.9761751e-05f, -0.082622945f, 22.014915f, 8.3674844e-05f, \
+    -0.096063167f, 25.23378f, 9.3619448e-05f, -0.10562622f, 27.515364f, 0.00010105586f, -0.11273728f, 29.203976f, \
+    0.00010687155f, -0.1182647f, 30.509809f, 0.00011159356f, -0.12272484f, 31.557964f, 0.00011554574f, -0.12643522f, \
+    32.425404f, 0.00011893689f, -0.1296006f, 33.161774f, 0.00012190751f, -0.13235877f, 33.800465f, 0.00012455555f, \
+    -0.13480574f, 34.364758f, 0.00012695152f, -0.13701062f, 34.87138f, 0.00012914761f, -0.13902448f, 35.332706f, \
+    -7.7459619e-05f, 0.063198209f, -13.676371f, -2.8601378e-05f, 0.015684014f, -2.2119811f, 5.5013329e-06f, -0.01749773f, \
+    5.7932506f, 3.0043882e-05f, -0.041379042f, 11.552951f, 4.8067948e-05f, -0.058906928f, 15.777299f, 6.1459032e-05f, \
+    -0.071909443f, 18.906643f, 7.1524068e-05f, -0.081656858f, 21.247353f, 7.9268299e-05f, -0.089130364f, 23.036739f, \
+    8.5418535e-05f, -0.09504167f, 24.447338f, 9.0457754e-05f, -0.099864624f, 25.594172f, 9.4701187e-05f, -0.10390884f, \
+    26.552452f, 9.8358163e-05f, -0.10738002f, 27.372169f, 0.00010157193f, -0.110419f, 28.087557f, 0.00010444356f, \
+    -0.11312515f, 28.722763f, 0.00010704633f, -0.11557051f, 29.295301f, 0.00010943475f, -0.11780863f, 29.818182f, \
+    -7.4393618e-05f, 0.062673524f, -14.05777f, -3.5649504e-05f, 0.024870951f, -4.906301f, -7.1953791e-06f, -0.0029016607f, \
+    1.8159163f, 1.4212821e-05f, -0.02379732f, 6.8719115f, 3.0614192e-05f, -0.039799485f, 10.741635f, 4.334265e-05f, \
+    -0.052206505f, 13.739185f, 5.3314005e-05f, -0.061910685f, 16.080452f, 6.1219544e-05f, -0.069587156f, 17.928989f, \
+    6.7607281e-05f, -0.075772785f, 19.415121f, 7.2889918e-05f, -0.080872849f, 20.637388f, 7.7360703e-05f, -0.085175768f, \
+    21.665981f, 8.1224389e-05f, -0.088883087f, 22.549986f, 8.4625019e-05f, -0.092136703f, 23.323969f, 8.7665867e-05f, \
+    -0.095038354f, 24.01272f, 9.0422574e-05f, -0.09766259f, 24.634407f, 9.2951763e-05f, -0.1000652f, 25.202621f, \
+    -7.4583142e-05f, 0.064851061f, -14.997121f, -4.249857e-05f, 0.033459116f, -7.3760433f, -1.8012239e-05f, 0.0094941817f, \
+    -1.5588812f, 1.0448611e-06f, -0.0091575598f, 2.967258f, 1.6109643e-05f, -0.023897786f, 6.5425482f, 2.8165778e-05f, \
+    -0.035686839f, 9.4000778f, 3.790695e-05f, -0.045202494f, 11.704364f, 4.5844732e-05f, -0.052945171f, 13.576921f, \
+    5.2384261e-05f, -0.059311986f, 15.114297f, 5.7854169e-05f, -0.064625852f, 16.395109f, 6.2511186e-05f, -0.069139503f, \
+    17.480965f, 6.6547385e-05f, -0.073042259f, 18.418055f, 7.0103924e-05f, -0.076473363f, 19.24037f, 7.3284689e-05f, \
+    -0.079535373f, 19.972948f, 7.6167002e-05f, -0.082304604f, 20.634432f, 7.8809266e-05f, -0.08483877f, 21.238913f, \
+    -7.635224e-05f, 0.068243966f, -16.164646f, -4.8957612e-05f, 0.041376594f, -9.6260004f, -2.7414764e-05f, 0.020242488f, \
+    -4.4831929f, -1.0195796e-05f, 0.0033492537f, -0.37329981f, 3.7530071e-06f, -0.010333286f, 2.9542708f, 1.5178895e-05f, \
+    -0.021536326f, 5.6774282f, 2.4624909e-05f, -0.030791681f, 7.9255977f, 3.2495576e-05f, -0.038495857f, 9.7953014f, \
+    3.9104245e-05f, -0.044956356f, 11.361433f, 4.4706638e-05f, -0.050424576f, 12.685285f, 4.9514434e-05f, -0.05510902f, \
+    13.81775f, 5.3698226e-05f, -0.059177991f, 14.799951f, 5.7390971e-05f, -0.062762797f, 15.663995f, 6.0694452e-05f, \
+    -0.065964051f, 16.43449f, 6.3686348e-05f, -0.068858564f, 17.130239f, 6.6426306e-05f, -0.071505353f, 17.765676f, \
+    -7.8912126e-05f, 0.072170988f, -17.413261f, -5.4986936e-05f, 0.04865719f, -11.678436f, -3.5716199e-05f, 0.029712729f, \
+    -7.058352f, -1.9978908e-05f, 0.014240483f, -3.285686f, -6.9767216e-06f, 0.0014584479f, -0.1698401f, 3.8726812e-06f, \
+    -0.009204248f, 2.4283657f, 1.3003115e-05f, -0.018173238f, 4.6127315f, 2.0744139e-05f, -0.02577213f, 6.4621983f, \
+    2.7351514e-05f, -0.032252286f, 8.0381069f, 3.3030268e-05f, -0.03781544f, 9.3897123f, 3.7951293e-05f, -0.042629991f, \
+    10.55817f, 4.2258605e-05f, -0.046838097f, 11.578255f, 4.6071331e-05f, -0.050557509f, 12.478795f, 4.9485447e-05f, \
+    -0.053883184f, 13.283057f, 5.2576936e-05f, -0.056890361f, 14.00948f, 5.540557e-05f, -0.059638251f, 14.672581f, \
+    -8.1863473e-05f, 0.076299481f, -18.673914f, -6.0602648e-05f, 0.05536551f, -13.558509f, -4.3139436e-05f, 0.03816627f, \
+    -9.355876f, -2.8624208e-05f, 0.023868766f, -5.8626924f, -1.6435648e-05f, 0.011863369f, -2.9301143f, -6.1098867e-06f, \
+    0.0016945946f, -0.44690102f, 2.7058127e-06f, -0.0069841873f, 1.6716292f, 1.0284225e-05f, -0.014441235f, 3.4910312f, \
+    1.683978e-05f, -0.020887591f, 5.0628948f, 2.2544142e-05f, -0.026492355f, 6.4285731f, 2.7538403e-05f, -0.03139466f, \
+    7.6221108f, 3.1942061e-05f, -0.035712503f, 8.6724014f, 3.5857407e-05f, -0.03954703f, 9.6042356f, 3.9370905e-05f, \
+    -0.042983849f, 10.438612f, 4.2554151e-05f, -0.046093915f, 11.192944f, 4.5465444e-05f, -0.048935041f, 11.881425f, \
+    -8.4993917e-05f, 0.080461226f, -19.913723f, -6.5840046e-05f, 0.061570514f, -15.289668f, -4.9849212e-05f, 0.045795344f, \
+    -11.428282f, -3.6360165e-05f, 0.032486383f, -8.1708174f, -2.4878429e-05f, 0.021157727f, -5.3984571f, -1.5027521e-05f, \
+    0.011439151f, -3.0206394f, -6.5161039e-06f, 0.0030439675f, -0.96721995f, 8.8461564e-07f, -0.0042531313f, 0.81694525f, \
+    7.3568212e-06f, -0.010631681f, 2.3758109f, 1.3047631e-05f, -0.016236773f, 3.7449107f, 1.807771e-05f, -0.021187503f, \
+    4.9534245f, 2.2548138e-05f, -0.025583738f, 6.0258336f, 2.6545624e-05f, -0.029511245f, 6.9831772f, 3.0145375e-05f, \
+    -0.033044513f, 7.8437419f, 3.3412132e-05f, -0.03624773f, 8.6232977f, 3.6400736e-05f, -0.039175324f, 9.3352232f, \
+    -8.8187087e-05f, 0.084570564f, -21.117558f, -7.0739021e-05f, 0.067336388f, -16.89242f, -5.5970686e-05f, 0.052745443f, \
+    -13.315269f, -4.3355929e-05f, 0.04028032f, -10.259437f, -3.2493761e-05f, 0.029546428f, -7.6282897f, -2.3073653e-05f, \
+    0.020238008f, -5.3469343f, -1.485167e-05f, 0.012114702f, -3.3564782f, -7.6336491e-06f, 0.0049850736f, -1.6100044f, \
+    -1.2631465e-06f, -0.0013052237f, -0.06967289f, 4.3873711e-06f, -0.0068821027f, 1.2953942f, 9.4231409e-06f, -0.011849536f, \
+    2.5107031f, 1.3932168e-05f, -0.016294539f, 3.5976093f, 1.798929e-05f, -0.020291174f, 4.5742979f, 2.1659396e-05f, \
+    -0.023903722f, 5.456562f, 2.4999381e-05f, -0.027188612f, 6.2582755f, 2.8058974e-05f, -0.030195219f, 6.9915857f, \
+    -9.1378446e-05f, 0.088585116f, -22.279322f, -7.5338277e-05f, 0.072719902f, -18.38427f, -6.1601037e-05f, 0.059129186f, \
+    -15.047552f, -4.97402e-05f, 0.047392976f, -12.16621f, -3.94253e-05f, 0.037185669f, -9.6604042f, -3.0396635e-05f, \
+    0.028251229f, -7.4673395f, -2.244747e-05f, 0.020385725f, -5.5369849f, -1.5411306e-05f, 0.013424813f, -3.8290112f, \
+    -9.1525681e-06f, 0.0072345864f, -2.3105505f, -3.5597091e-06f, 0.0017048076f, -0.9545356f, 1.4599683e-06f, -0.0032561943f, \
+    0.26154834f, 5.9843246e-06f, -0.0077254679f, 1.3566316f, 1.0079506e-05f, -0.011768519f, 2.3468146f, 1.3802477e-05f, \
+    -0.015441803f, 3.24598f, 1.7203076e-05f, -0.018794764f, 4.0662923f, 2.0325395e-05f, -0.021871187f, 4.8185315f, \
+    -9.4532559e-05f, 0.092485994f, -23.397612f, -7.9673162e-05f, 0.077770218f, -19.780037f, -6.6817105e-05f, 0.065035403f, \
+    -16.649338f, -5.5613054e-05f, 0.053935178f, -13.920495f, -4.578484e-05f, 0.044197105f, -11.526628f, -3.7112597e-05f, \
+    0.035604194f, -9.4144535f, -2.9419261e-05f, 0.027981589f, -7.5410213f, -2.2560715e-05f, 0.021186881f, -5.8713479f, \
+    -1.6418491e-05f, 0.01510295f, -4.3766508f, -1.0894303e-05f, 0.0096325679f, -3.0330312f, -5.9058671e-06f, 0.0046942923f, \
+    -1.8204646f, -1.3837017e-06f, 0.00021930845f, -0.72202569f, 2.7314231e-06f, -0.0038510829f, 0.27672726f, 6.4904903e-06f, \
+    -0.0075674411f, 1.1882381f, 9.9378931e-06f, -0.010973825f, 2.0233552f, 1.3112769e-05f, -0.014109108f, 2.7916553f, \
+    -9.7630764e-05f, 0.096267194f, -24.47345f, -8.3775129e-05f, 0.082529567f, -21.092258f, -7.1680617e-05f, 0.07053531f, \
+    -18.140032f, -6.1053754e-05f, 0.059994765f, -15.545594f, -5.1660929e-05f, 0.050677229f, -13.252245f, -4.3314001e-05f, \
+    0.042396825f, -11.214289f, -3.5859881e-05f, 0.035002213f, -9.3945141f, -2.9172776e-05f, 0.02836897f, -7.7623219f, \
+    -2.3148392e-05f, 0.022393901f, -6.2923245f, -1.7699542e-05f, 0.016990671f, -4.9632792f, -1.2752737e-05f, 0.012086486f, \
+    -3.7572684f, -8.2455545e-06f, 0.007619468f, -2.6590595f, -4.124553e-06f, 0.0035366204f, -1.6556002f, -3.4361784e-07f, \
+    -0.00020781996f, -0.73561758f, 3.1374016e-06f, -0.0036537221f, 0.11071358f, 6.3537927e-06f, -0.0068361503f, 0.89203751f, \
+    -0.00010066431f, 0.099929847f, -25.509079f, -8.767187e-05f, 0.087034196f, -22.331564f, -7.6241828e-05f, 0.07568679f, \
+    -19.535402f, -6.6126064e-05f, 0.065642461f, -17.060291f, -5.7124817e-05f, 0.05670375f, -14.857646f, -4.9075559e-05f, \
+    0.04870991f, -12.887911f, -4.18448e-05f, 0.041528858f, -11.118573f, -3.5321911e-05f, 0.035051066f, -9.5226727f, \
+    -2.9414467e-05f, 0.029185001f, -8.0776663f, -2.4044642e-05f, 0.023853537f, -6.7645602f, -1.9146439e-05f, 0.018991241f, \
+    -5.5672326f, -1.4663476e-05f, 0.014542184f, -4.4719028f, -1.0547261e-05f, 0.010458243f, -3.4667082f, -6.7557926e-06f, \
+    0.0066977083f, -2.5413651f, -3.252442e-06f, 0.0032241871f, -1.6868976f, -5.0000968e-09f, 5.6585945e-06f, -0.89540601f, \
+    -0.00047361027f, 0.41986972f, -93.42514f, -3.1394156e-05f, 0.00083994173f, 5.3649011f, 0.00011003232f, -0.13506417f, \
+    37.782974f, 0.00015806695f, -0.1811765f, 48.773918f, 0.00017707481f, -0.1990647f, 52.965034f, 0.00018734373f, \
+    -0.2084624f, 55.111942f, 0.00019394526f, -0.21432178f, 56.411942f, 0.00019866218f, -0.2183831f, 57.285679f, \
+    0.00020228875f, -0.22141983f, 57.919739f, 0.00020524111f, -0.22383559f, 58.411152f, 0.00020776236f, -0.22586501f, \
+    58.816113f, 0.00021000582f, -0.22765522f, 59.169678f, 0.00021207392f, -0.2293039f, 59.494987f, 0.00021403826f, \
+    -0.23087884f, 59.808018f, 0.0002159508f, -0.23242891f, 60.120205f, 0.00021785047f, -0.23399048f, 60.440018f, \
+    -0.0001483683f, 0.12142856f, -25.094641f, -1.2020923e-06f, -0.019943517f, 8.6350336f, 6.9332542e-05f, -0.088111557f, \
+    24.979872f, 0.00010478411f, -0.12238365f, 33.1996f, 0.00012337872f, -0.14023846f, 37.457615f, 0.00013467648f, \
+    -0.15097004f, 39.993362f, 0.00014249924f, -0.15831451f, 41.711239f, 0.00014841757f, -0.16381004f, 42.984131f, \
+    0.00015318346f, -0.16819331f, 43.990685f, 0.00015720265f, -0.17186156f, 44.827179f, 0.00016071598f, -0.17505024f, \
+    45.55061f, 0.00016387744f, -0.17790964f, 46.1973f, 0.0001667914f, -0.18054138f, 46.791771f, 0.00016953198f, \
+    -0.18301745f, 47.35136f, 0.00017215387f, -0.18539087f, 47.888809f, 0.00017469881f, -0.18770202f, 48.413795f, \
+    -8.2655264e-05f, 0.063639045f, -12.412454f, -2.6835139e-06f, -0.013696445f, 6.1505284f, 4.3614011e-05f, -0.058610752f, \
+    16.958279f, 7.1620067e-05f, -0.085796967f, 23.503349f, 8.8969864e-05f, -0.10259469f, 27.538603f, 0.00010041198f, \
+    -0.11361472f, 30.174349f, 0.00010864762f, -0.12149739f, 32.049889f, 0.0001150214f, -0.12756088f, 33.485153f, \
+    0.0001202311f, -0.13249016f, 34.646568f, 0.00012466981f, -0.13667127f, 35.627964f, 0.00012857564f, -0.14033806f, \
+    36.486176f, 0.00013210221f, -0.14364128f, 37.257824f, 0.00013535396f, -0.14668337f, 37.967777f, 0.00013840519f, \
+    -0.14953713f, 38.633705f, 0.00014131084f, -0.15225635f, 39.268642f, 0.00014411291f, -0.1548821f, 39.882523f, \
+    -6.2719861e-05f, 0.047905937f, -9.3692427f, -9.3961862e-06f, -0.0038867586f, 3.1140385f, 2.5108948e-05f, -0.037465375f, \
+    11.218487f, 4.8283375e-05f, -0.060031369f, 16.667366f, 6.4202526e-05f, -0.075516395f, 20.403183f, 7.5455559e-05f, \
+    -0.086433105f, 23.03104f, 8.3827224e-05f, -0.094524883f, 24.973017f, 9.0409616e-05f, -0.10086267f, 26.489199f, \
+    9.5833966e-05f, -0.1060667f, 27.730461f, 0.00010047514f, -0.1105057f, 28.786568f, 0.00010456712f, -0.11440995f, \
+    29.713606f, 0.00010826323f, -0.11793038f, 30.548334f, 0.00011166849f, -0.12117032f, 31.315929f, 0.00011485778f, \
+    -0.12420347f, 32.034332f, 0.00011788643f, -0.12708424f, 32.716785f, 0.00012079665f, -0.12985413f, 33.373383f, \
+    -5.6620083e-05f, 0.044588812f, -9.1086655f, -1.6921189e-05f, 0.005898119f, 0.24743478f, 1.0717638e-05f, -0.021072235f, \
+    6.7745876f, 3.0563409e-05f, -0.04044795f, 11.465257f, 4.5124987e-05f, -0.05465886f, 14.904302f, 5.6010613e-05f, \
+    -0.065267384f, 17.468586f, 6.4379441e-05f, -0.073405147f, 19.432093f, 7.1062874e-05f, -0.079887331f, 20.992863f, \
+    7.6608405e-05f, -0.085252196f, 22.281937f, 8.1365732e-05f, -0.089844033f, 23.383236f, 8.5561798e-05f, -0.093886517f, \
+    24.351313f, 8.9348752e-05f, -0.09752965f, 25.222775f, 9.2832161e-05f, -0.10087755f, 26.023035f, 9.6087759e-05f, \
+    -0.10400494f, 26.770325f, 9.9171601e-05f, -0.10696711f, 27.478142f, 0.00010212642f, -0.10980618f, 28.156771f, \
+    -5.5860146e-05f, 0.045887325f, -9.8438759f, -2.424802e-05f, 0.014990352f, -2.3515279f, -1.0682246e-06f, -0.0076845633f, \
+    3.1496818f, 1.6369198e-05f, -0.02474911f, 7.2906108f, 2.9746396e-05f, -0.037838344f, 10.466303f, 4.0174305e-05f, \
+    -0.048034027f, 12.938374f, 4.8445745e-05f, -0.056110393f, 14.894438f, 5.5166769e-05f, -0.062661521f, 16.478872f, \
+    6.0787213e-05f, -0.068129726f, 17.799427f, 6.5622e-05f, -0.072825298f, 18.931801f, 6.9886999e-05f, -0.076961175f, \
+    19.928001f, 7.3731506e-05f, -0.080684759f, 20.824043f, 7.7261029e-05f, -0.084100269f, 21.645407f, 8.0552112e-05f, \
+    -0.087283328f, 22.410583f, 8.3661682e-05f, -0.090290226f, 23.133335f, 8.6633234e-05f, -0.093163937f, 23.824175f, \
+    -5.7463571e-05f, 0.049116425f, -10.96993f, -3.1142874e-05f, 0.023328053f, -4.7011127f, -1.1080563e-05f, 0.0036589405f, \
+    0.081673495f, 4.5417164e-06f, -0.011662098f, 3.8076425f, 1.691846e-05f, -0.023799723f, 6.7590961f, 2.6866999e-05f, \
+    -0.033551838f, 9.1295424f, 3.4972338e-05f, -0.041490525f, 11.057863f, 4.1680891e-05f, -0.048053466f, 12.650505f, \
+    4.7345726e-05f, -0.05358782f, 13.992082f, 5.2237647e-05f, -0.058360506f, 15.147764f, 5.6555768e-05f, -0.062568083f, \
+    16.165604f, 6.0443977e-05f, -0.066352755f, 17.080393f, 6.4006701e-05f, -0.069817796f, 17.917412f, 6.7320856e-05f, \
+    -0.073039308f, 18.695293f, 7.0444228e-05f, -0.076074488f, 19.428053f, 7.3421135e-05f, -0.078967229f, 20.12644f, \
+    -6.0198301e-05f, 0.053191628f, -12.248326f, -3.7583915e-05f, 0.030986866f, -6.8389626f, -1.9820247e-05f, 0.013536181f, \
+    -2.5868471f, -5.6128029e-06f, -0.00042464779f, 0.81517577f, 5.9232079e-06f, -0.011760528f, 3.5773084f, 1.5412632e-05f, \
+    -0.021082893f, 5.8482132f, 2.3310993e-05f, -0.028838037f, 7.7364697f, 2.9963634e-05f, -0.035364855f, 9.3246117f, \
+    3.564556e-05f, -0.04093381f, 10.678608f, 4.0579875e-05f, -0.045764845f, 11.852195f, 4.494291e-05f, -0.050032105f, \
+    12.887982f, 4.8869544e-05f, -0.053868998f, 13.818642f, 5.2461386e-05f, -0.057376098f, 14.668823f, 5.5795019e-05f, \
+    -0.060629278f, 15.457129f, 5.8928799e-05f, -0.063686363f, 16.197744f, 6.1907835e-05f, -0.06659209f, 16.901644f, \
+    -6.3496031e-05f, 0.05762912f, -13.576321f, -4.3610034e-05f, 0.038065907f, -8.8012533f, -2.7609898e-05f, 0.022318935f, \
+    -4.9570632f, -1.4535953e-05f, 0.0094489073f, -1.8150402f, -3.7108246e-06f, -0.0012077547f, 0.78644407f, 5.3568492e-06f, \
+    -0.010132851f, 2.9647899f, 1.3032722e-05f, -0.017685281f, 4.8074937f, 1.9596237e-05f, -0.024139656f, 6.381547f, \
+    2.5268228e-05f, -0.029713312f, 7.7400208f, 3.0229807e-05f, -0.034584828f, 8.9265785f, 3.4631117e-05f, -0.038902543f, \
+    9.97754f, 3.8594015e-05f, -0.042787042f, 10.922462f, 4.221483e-05f, -0.046333738f, 11.784753f, 4.5568595e-05f, \
+    -0.049617037f, 12.58268f, 4.8713675e-05f, -0.052694853f, 13.330462f, 5.1695799e-05f, -0.055612568f, 14.039252f, \
+    -6.7075358e-05f, 0.062200207f, -14.907863f, -4.9274804e-05f, 0.044658422f, -10.618725f, -3.4669283e-05f, 0.030260121f, \
+    -7.0977616f, -2.2523724e-05f, 0.018284438f, -4.1691175f, -1.2305361e-05f, 0.0082084872f, -1.705189f, -3.6188731e-06f, \
+    -0.00035604971f, 0.38882247f, 3.8354633e-06f, -0.0077038514f, 2.1848879f, 1.0289747e-05f, -0.01406333f, 3.7388234f, \
+    1.5927881e-05f, -0.019615674f, 5.094934f, 2.0899741e-05f, -0.024508752f, 6.2894087f, 2.5331014e-05f, -0.028866764f, \
+    7.3526788f, 2.9327904e-05f, -0.032794837f, 8.3105326f, 3.297866e-05f, -0.036380436f, 9.1844463f, 3.6354988e-05f, \
+    -0.039694723f, 9.9919052f, 3.9514365e-05f, -0.04279476f, 10.746939f, 4.2502688e-05f, -0.045726161f, 11.460765f, \
+    -7.0790877e-05f, 0.066794492f, -16.22262f, -5.4631546e-05f, 0.050845213f, -12.31668f, -4.1155257e-05f, 0.037539985f, \
+    -9.0579319f, -2.9783623e-05f, 0.026310625f, -6.307529f, -2.0088024e-05f, 0.016735755f, -3.9624665f, -1.174423e-05f, \
+    0.0084963888f, -1.9447416f, -4.5023512e-06f, 0.0013464733f, -0.19416237f, 1.8336877e-06f, -0.0049072187f, 1.3365617f, \
+    7.4205459e-06f, -0.010419214f, 2.6852696f, 1.2385919e-05f, -0.015315606f, 3.8828576f, 1.6836382e-05f, -0.019701762f, \
+    4.9551654f, 2.086293e-05f, -0.023667775f, 5.9243069f, 2.4543779e-05f, -0.027291201f, 6.8093386f, 2.7945287e-05f, \
+    -0.030637914f, 7.6264606f, 3.112269e-05f, -0.033762801f, 8.3891792f, 3.4121353e-05f, -0.03671097f, 9.1086006f, \
+    -7.456616e-05f, 0.071360014f, -17.512596f, -5.9728751e-05f, 0.056694567f, -13.915854f, -4.7184138e-05f, 0.044291969f, \
+    -10.873824f, -3.6466859e-05f, 0.033694237f, -8.2744141f, -2.7225378e-05f, 0.024555255f, -6.0328913f, -1.918934e-05f, \
+    0.016608644f, -4.0840187f, -1.2147349e-05f, 0.009645978f, -2.3767338f, -5.9315184e-06f, 0.0035015938f, -0.87043524f, \
+    -4.0644679e-07f, -0.0019582193f, 0.46766207f, 4.5388088e-06f, -0.0068431189f, 1.6644598f, 8.9967671e-06f, -0.011244642f, \
+    2.7424278f, 1.3046136e-05f, -0.01524075f, 3.7207181f, 1.675515e-05f, -0.018899119f, 4.6159697f, 2.0183366e-05f, \
+    -0.022278888f, 5.4427361f, 2.3382267e-05f, -0.02543124f, 6.2136221f, 2.6395617e-05f, -0.028399725f, 6.9393582f, \
+    -7.8361692e-05f, 0.075874969f, -18.775928f, -6.4609121e-05f, 0.062263936f, -15.433325f, -5.2844927e-05f, 0.050618008f, \
+    -12.573107f, -4.2687279e-05f, 0.040560938f, -10.10306f, -3.3843044e-05f, 0.031803705f, -7.9523253f, -2.6083519e-05f, \
+    0.024120672f, -6.0655689f, -1.9227586e-05f, 0.017333034f, -4.3989286f, -1.3129826e-05f, 0.011297128f, -2.9171472f, \
+    -7.6718907e-06f, 0.005895955f, -1.5915018f, -2.7561637e-06f, 0.0010329328f, -0.39827126f, 1.6990259e-06f, -0.0033728094f, \
+    0.68241715f, 5.7630796e-06f, -0.0073900577f, 1.6674761f, 9.495996e-06f, -0.011078341f, 2.5715523f, 1.2950487e-05f, \
+    -0.014490019f, 3.4075377f, 1.6173197e-05f, -0.017671475f, 4.1868629f, 1.9205134e-05f, -0.02066353f, 4.9195933f, \
+    -8.2158476e-05f, 0.080333643f, -20.013849f, -6.9309885e-05f, 0.067601822f, -16.883295f, -5.8207548e-05f, 0.05659803f, \
+    -14.17747f, -4.8533013e-05f, 0.047008041f, -11.819263f, -4.0038296e-05f, 0.03858703f, -9.7485714f, -3.2527452e-05f, \
+    0.031141434f, -7.9178662f, -2.5843561e-05f, 0.024516154f, -6.2890506f, -1.9859375e-05f, 0.018585335f, -4.831203f, \
+    -1.4470463e-05f, 0.013245624f, -3.5189202f, -9.5900932e-06f, 0.0084111309f, -2.3310835f, -5.1453635e-06f, 0.0040096012f, \
+    -1.2499194f, -1.0741969e-06f, -2.0534359e-05f, -0.26027563f, 2.6770085e-06f, -0.0037324876f, 0.65095073f, 6.1552419e-06f, \
+    -0.0071729496f, 1.4952638f, 9.4022826e-06f, -0.010383478f, 2.2829101f, 1.2455566e-05f, -0.013401348f, 3.0230858f, \
+    -8.5949294e-05f, 0.084739029f, -21.229136f, -7.3863528e-05f, 0.07274954f, -18.277712f, -6.3328225e-05f, 0.062296182f, \
+    -15.704307f, -5.4073946e-05f, 0.053112742f, -13.443506f, -4.5888217e-05f, 0.044989202f, -11.443689f, -3.8601251e-05f, \
+    0.037757639f, -9.6635752f, -3.2075724e-05f, 0.031282164f, -8.0697479f, -2.6199277e-05f, 0.02545153f, -6.6348405f, \
+    -2.0878977e-05f, 0.020173671f, -5.3362012f, -1.6037136e-05f, 0.015371578f, -4.1548748f, -1.160812e-05f, 0.010980143f, \
+    -3.0748293f, -7.5358494e-06f, 0.0069437055f, -2.0823541f, -3.7718455e-06f, 0.0032141074f, -1.1655806f, -2.7366056e-07f, \
+    -0.00025085045f, -0.31410402f, 2.9963815e-06f, -0.0034886568f, 0.48132446f, 6.0721513e-06f, -0.0065330458f, 1.2290323f, \
+    -8.9733869e-05f, 0.089098893f, -22.425318f, -7.8298544e-05f, 0.077742636f, -19.626764f, -6.8253117e-05f, 0.067765005f, \
+    -17.167852f, -5.9366703e-05f, 0.058937594f, -14.992391f, -5.1455165e-05f, 0.051078185f, -13.055546f, -4.4369917e-05f, \
+    0.044039648f, -11.321102f, -3.7989663e-05f, 0.037701834f, -9.7594833f, -3.221439e-05f, 0.031965613f, -8.3462772f, \
+    -2.6960766e-05f, 0.026748352f, -7.0611315f, -2.2158709e-05f, 0.021980511f, -5.8869119f, -1.7748696e-05f, 0.017603001f, \
+    -4.8090549f, -1.3679683e-05f, 0.013565115f, -3.8150578f, -9.9074323e-06f, 0.0098228799f, -2.8940754f, -6.3931902e-06f, \
+    0.006337747f, -2.0365946f, -3.1025979e-06f, 0.0030755117f, -1.234172f, -4.811116e-09f, 5.4447187e-06f, -0.47921717f, \
+    -0.00038639063f, 0.33984149f, -74.77002f, 1.0998313e-05f, -0.03860122f, 14.910484f, 0.00012503282f, -0.14894965f, \
+    41.438652f, 0.00016019956f, -0.18277164f, 49.528259f, 0.00017581448f, -0.19747928f, 52.982059f, 0.00018529834f, \
+    -0.20621988f, 54.994144f, 0.00019208936f, -0.21236748f, 56.385468f, 0.0001974731f, -0.21718147f, 57.462021f, \
+    0.00020206024f, -0.22125809f, 58.368267f, 0.00020618837f, -0.22492553f, 59.183434f, 0.00021006461f, -0.22838421f, \
+    59.955704f, 0.00021382635f, -0.23176648f, 60.716782f, 0.00021757073f, -0.23516555f, 61.488914f, 0.00022137047f, \
+    -0.23865099f, 62.288677f, 0.00022528299f, -0.24227773f, 63.129147f, 0.00022935626f, -0.24609172f, 64.021271f, \
+    -0.00010811078f, 0.084182836f, -16.166431f, 2.1210346e-05f, -0.040749982f, 13.820127f, 7.977018e-05f, -0.097686879f, \
+    27.565035f, 0.00010778725f, -0.12488881f, 34.124916f, 0.00012313134f, -0.13967501f, 37.668236f, 0.00013326679f, \
+    -0.14935766f, 39.971409f, 0.00014087303f, -0.15657105f, 41.676388f, 0.00014707827f, -0.1624255f, 43.054001f, \
+    0.00015244211f, -0.16747159f, 44.238495f, 0.00015728008f, -0.17201945f, 45.305443f, 0.0001617886f, -0.17626192f, \
+    46.301781f, 0.00016609972f, -0.18032844f, 47.258995f, 0.00017030805f, -0.18431169f, 48.199589f, 0.00017448516f, \
+    -0.18828176f, 49.140591f, 0.00017868806f, -0.19229445f, 50.095566f, 0.00018296436f, -0.19639644f, 51.075855f, \
+    -5.6923396e-05f, 0.039636575f, -6.4992523f, 1.2976008e-05f, -0.028287737f, 9.8896255f, 5.2293955e-05f, -0.066633724f, \
+    19.171848f, 7.5461503e-05f, -0.089229859f, 24.642639f, 8.9952147e-05f, -0.10331853f, 28.045004f, 0.00010003948f, \
+    -0.11308243f, 30.394314f, 0.00010778157f, -0.12054538f, 32.183857f, 0.00011416424f, -0.12667878f, 33.650822f, \
+    0.00011970598f, -0.13199398f, 34.920162f, 0.00012470646f, -0.13678659f, 36.064121f, 0.00012935385f, -0.14124222f, \
+    37.128059f, 0.00013377494f, -0.14548589f, 38.142529f, 0.00013806057f, -0.14960718f, 39.129421f, 0.0001422794f, \
+    -0.15367381f, 40.105286f, 0.00014648597f, -0.15773959f, 41.083275f, 0.00015072555f, -0.16184929f, 42.074348f, \
+    -4.3585234e-05f, 0.029899919f, -4.820024f, 3.1513418e-06f, -0.015680026f, 6.2134738f, 3.2931421e-05f, -0.044794079f, \
+    13.276334f, 5.2663519e-05f, -0.064095348f, 17.961376f, 6.6207838e-05f, -0.077326722f, 21.169935f, 7.6068311e-05f, \
+    -0.086935855f, 23.495607f, 8.377069e-05f, -0.094422534f, 25.303848f, 9.0161047e-05f, -0.10062075f, 26.798374f, \
+    9.5717165e-05f, -0.10600217f, 28.094542f, 0.00010072524f, -0.11084959f, 29.261564f, 0.00010536791f, -0.11534354f, \
+    30.343645f, 0.00010976886f, -0.11960633f, 31.370743f, 0.00011401667f, -0.12372559f, 32.364323f, 0.00011817806f, \
+    -0.12776731f, 33.340569f, 0.00012230572f, -0.13178369f, 34.312271f, 0.00012644318f, -0.1358179f, 35.290031f, \
+    -4.1106316e-05f, 0.029848779f, -5.2975521f, -6.1210967e-06f, -0.0043634302f, 3.0048668f, 1.8028373e-05f, -0.028021326f, \
+    8.7549438f, 3.525288e-05f, -0.044906508f, 12.861584f, 4.7875208e-05f, -0.057274688f, 15.868844f, 5.7446396e-05f, \
+    -0.06664075f, 18.143888f, 6.5055166e-05f, -0.074074045f, 19.947142f, 7.1404807e-05f, -0.080267802f, 21.447945f, \
+    7.6929093e-05f, -0.085650466f, 22.751131f, 8.1900187e-05f, -0.090491176f, 23.922628f, 8.6496017e-05f, -0.094966032f, \
+    25.005608f, 9.0838454e-05f, -0.099195734f, 26.029667f, 9.5014999e-05f, -0.10326699f, 27.016087f, 9.9091456e-05f, \
+    -0.10724505f, 27.980881f, 0.00010311954f, -0.11118122f, 28.936657f, 0.0001071417f, -0.11511765f, 29.89378f, \
+    -4.2652598e-05f, 0.033215504f, -6.4973249f, -1.4604317e-05f, 0.0057249274f, 0.1880096f, 5.8591268e-06f, -0.014358635f, \
+    5.0776849f, 2.1206299e-05f, -0.029430775f, 8.7494974f, 3.2983749e-05f, -0.040996574f, 11.567234f, 4.223577e-05f, \
+    -0.050076142f, 13.778222f, 4.9730221e-05f, -0.057423066f, 15.565888f, 5.6027766e-05f, -0.063589789f, 17.065155f, \
+    6.1512037e-05f, -0.06895528f, 18.368778f, 6.6438784e-05f, -0.073772609f, 19.53878f, 7.0980852e-05f, -0.078212976f, \
+    20.617161f, 7.5258693e-05f, -0.082395799f, 21.633236f, 7.9359488e-05f, -0.086407557f, 22.60825f, 8.3348852e-05f, \
+    -0.090313405f, 23.558212f, 8.7278218e-05f, -0.094164431f, 24.495693f, 9.1189584e-05f, -0.098002397f, 25.430967f, \
+    -4.5928631e-05f, 0.037946332f, -7.960557f, -2.2392638e-05f, 0.014832693f, -2.3291202f, -4.51188e-06f, -0.0027454621f, \
+    1.9573561f, 9.3955741e-06f, -0.016425578f, 5.2950559f, 2.043042e-05f, -0.02728131f, 7.9440937f, 2.9351573e-05f, \
+    -0.036054816f, 10.084623f, 3.6717851e-05f, -0.043294381f, 11.850098f, 4.2962045e-05f, -0.04942622f, 13.344584f, \
+    4.8410908e-05f, -0.0547731f, 14.647082f, 5.3299569e-05f, -0.059567735f, 15.814652f, 5.7794303e-05f, -0.063974932f, \
+    16.887747f, 6.2013984e-05f, -0.068112612f, 17.895336f, 6.6045737e-05f, -0.072067298f, 18.858692f, 6.9955495e-05f, \
+    -0.075904503f, 19.79393f, 7.3794938e-05f, -0.07967563f, 20.713701f, 7.7606113e-05f, -0.083422489f, 21.628307f, \
+    -5.0023697e-05f, 0.043255124f, -9.5180855f, -2.9625706e-05f, 0.02318758f, -4.6205049f, -1.3643198e-05f, 0.007451178f, \
+    -0.77743399f, -8.6411245e-07f, -0.0051374268f, 2.2982397f, 9.5336072e-06f, -0.015381951f, 4.8016863f, 1.8130839e-05f, \
+    -0.023851344f, 6.8712449f, 2.535673e-05f, -0.0309669f, 8.6095362f, 3.1545973e-05f, -0.037058137f, 10.097012f, \
+    3.6966798e-05f, -0.042389929f, 11.398499f, 4.1828222e-05f, -0.047169175f, 12.56474f, 4.6287227e-05f, -0.051551521f, \
+    13.633957f, 5.0460181e-05f, -0.055652481f, 14.634545f, 5.4434106e-05f, -0.059558529f, 15.587779f, 5.8275506e-05f, \
+    -0.063335799f, 16.509937f, 6.2036685e-05f, -0.067036331f, 17.413841f, 6.5760112e-05f, -0.070702434f, 18.309917f, \
+    -5.4538206e-05f, 0.048814651f, -11.103628f, -3.6430458e-05f, 0.030971391f, -6.7421079f, -2.1893253e-05f, 0.016637281f, \
+    -3.2365844f, -1.0014933e-05f, 0.0049200528f, -0.37004438f, -1.5836885e-07f, -0.0048045749f, 2.0094445f, 8.1370081e-06f, \
+    -0.0129885f, 4.0119605f, 1.5215574e-05f, -0.019970182f, 5.7200499f, 2.134512e-05f, -0.026013356f, 7.1981368f, \
+    2.6743011e-05f, -0.031332627f, 8.4987507f, 3.1588308e-05f, -0.036105219f, 9.6653566f, 3.6024754e-05f, -0.040473685f, \
+    10.732975f, 4.0164363e-05f, -0.044549264f, 11.728963f, 4.4093482e-05f, -0.04841781f, 12.674456f, 4.7879203e-05f, \
+    -0.052146081f, 13.585896f, 5.1574665e-05f, -0.05578699f, 14.476331f, 5.5223121e-05f, -0.059383638f, 15.356385f, \
+    -5.9287708e-05f, 0.054486159f, -12.692102f, -4.2912608e-05f, 0.038326185f, -8.7363443f, -2.9505642e-05f, 0.025088543f, \
+    -5.4946847f, -1.8357352e-05f, 0.014077348f, -2.7975128f, -8.9591822e-06f, 0.0047932873f, -0.52306688f, -9.3599635e-07f, \
+    -0.0031323549f, 1.4186307f, 5.9967065e-06f, -0.0099795759f, 3.0959682f, 1.2061167e-05f, -0.015967436f, 4.5625105f, \
+    1.7437085e-05f, -0.021273397f, 5.8617134f, 2.2274826e-05f, -0.026046267f, 7.0300789f, 2.6701335e-05f, -0.030411942f, \
+    8.0985403f, 3.0821408e-05f, -0.034474526f, 9.0927124f, 3.4719415e-05f, -0.038317937f, 10.033263f, 3.8462647e-05f, \
+    -0.042009179f, 10.936707f, 4.2105166e-05f, -0.045602109f, 11.816326f, 4.5691209e-05f, -0.04914083f, 12.683007f, \
+    -6.4187509e-05f, 0.060215671f, -14.276361f, -4.9159225e-05f, 0.045364328f, -10.636074f, -3.6654266e-05f, 0.03300152f, \
+    -7.6048646f, -2.6104799e-05f, 0.022569181f, -5.0464602f, -1.7094944e-05f, 0.013658236f, -2.8609204f, -9.3124245e-06f, \
+    0.0059612347f, -0.97309297f, -2.5171325e-06f, -0.00075846736f, 0.67490876f, 3.4800746e-06f, -0.0066875131f, 2.1287787f, \
+    8.832224e-06f, -0.011977125f, 3.4255779f, 1.3666964e-05f, -0.016753657f, 4.5963135f, 1.8093833e-05f, -0.021125741f, \
+    5.6676826f, 2.2207465e-05f, -0.025187397f, 6.6628242f, 2.6088079e-05f, -0.029018443f, 7.6014042f, 2.9802211e-05f, \
+    -0.032685149f, 8.4997663f, 3.3404587e-05f, -0.036242072f, 9.3713741f, 3.6940524e-05f, -0.039734416f, 10.227386f, \
+    -6.9202855e-05f, 0.065990143f, -15.857567f, -5.5243112e-05f, 0.05217699f, -12.467524f, -4.3469012e-05f, 0.040522721f, \
+    -9.6066751f, -3.3415166e-05f, 0.030569127f, -7.1629381f, -2.4734394e-05f, 0.021974131f, -5.0526032f, -1.7161936e-05f, \
+    0.014476653f, -3.2117507f, -1.0491625e-05f, 0.0078732101f, -1.5905347f, -4.5595571e-06f, 0.0020018667f, -0.14925949f, \
+    7.674825e-07f, -0.0032691394f, 1.1444004f, 5.6004651e-06f, -0.0080497172f, 2.3174353f, 1.0034411e-05f, -0.012434121f, \
+    3.3930185f, 1.4152707e-05f, -0.0165052f, 4.3915443f, 1.802901e-05f, -0.020336252f, 5.331079f, 2.1727379e-05f, \
+    -0.023991104f, 6.2273698f, 2.5302446e-05f, -0.027524242f, 7.0938683f, 2.8800448e-05f, -0.030981809f, 7.9419742f, \
+    -7.4325821e-05f, 0.071817659f, -17.440954f, -6.1226739e-05f, 0.058840461f, -14.252342f, -5.0051232e-05f, 0.047766116f, \
+    -11.530828f, -4.0409952e-05f, 0.038210634f, -9.1823359f, -3.200784e-05f, 0.029882826f, -7.135499f, -2.4616797e-05f, \
+    0.02255743f, -5.3350873f, -1.8057186e-05f, 0.016056899f, -3.7375481f, -1.2184901e-05f, 0.010238688f, -2.3078942f, \
+    -6.8821237e-06f, 0.0049861427f, -1.017475f, -2.0505097e-06f, 0.00020178234f, 0.15766856f, 2.3939615e-06f, -0.0041977754f, \
+    1.23805f, 6.5249196e-06f, -0.0082857022f, 2.2416885f, 1.0408344e-05f, -0.01212766f, 3.1847727f, 1.4103799e-05f, \
+    -0.01578301f, 4.0819521f, 1.7664401e-05f, -0.019304741f, 4.9463153f, 2.1136682e-05f, -0.022739315f, 5.7893448f, \
+    -7.9563892e-05f, 0.07771796f, -19.03389f, -6.7165405e-05f, 0.065420829f, -16.009041f, -5.6483459e-05f, 0.05482417f, \
+    -13.402177f, -4.7186422e-05f, 0.045600384f, -11.132915f, -3.9019502e-05f, 0.03749764f, -9.139451f, -3.178338e-05f, \
+    0.030318821f, -7.373383f, -2.5319479e-05f, 0.023906987f, -5.796165f, -1.9499532e-05f, 0.018135099f, -4.3765779f, \
+    -1.4218003e-05f, 0.012898558f, -3.0889027f, -9.3864937e-06f, 0.0081096618f, -1.9115633f, -4.9294517e-06f, 0.0036933823f, \
+    -0.82608718f, -7.8084287e-07f, -0.00041593233f, 0.18370263f, 3.1184509e-06f, -0.0042771292f, 1.1323193f, 6.822499e-06f, \
+    -0.0079440977f, 2.0330663f, 1.0381175e-05f, -0.011466602f, 2.8982391f, 1.3840071e-05f, -0.014890176f, 3.7390954f, \
+    -8.4934334e-05f, 0.083718024f, -20.645018f, -7.3109739e-05f, 0.071977407f, -17.754045f, -6.2835854e-05f, 0.061775092f, \
+    -15.241683f, -5.3825624e-05f, 0.052827075f, -13.038152f, -4.5855846e-05f, 0.044912446f, -11.089157f, -3.875011e-05f, \
+    0.037856489f, -9.3517447f, -3.236677e-05f, 0.031518839f, -7.7913952f, -2.6590384e-05f, 0.025785029f, -6.3799443f, \
+    -2.132539e-05f, 0.020560235f, -5.0940533f, -1.6491413e-05f, 0.015764644f, -3.9140654f, -1.2019635e-05f, 0.011329864f, \
+    -2.8231282f, -7.8499606e-06f, 0.0071961069f, -1.8065001f, -3.9287279e-06f, 0.0033099393f, -0.85099584f, -2.0689156e-07f, \
+    -0.00037753183f, 0.055458564f, 3.3613169e-06f, -0.00391198f, 0.924151f, 6.8190429e-06f, -0.0073365029f, 1.76574f, \
+    -9.046129e-05f, 0.089849971f, -22.283911f, -7.9107747e-05f, 0.078565411f, -19.502476f, -6.9170652e-05f, 0.068687849f, \
+    -17.067768f, -6.0397895e-05f, 0.059967488f, -14.918329f, -5.2591397e-05f, 0.052207995f, -13.005843f, -4.5593144e-05f, \
+    0.045252673f, -11.291736f, -3.9275248e-05f, 0.038974628f, -9.7447624f, -3.3532742e-05f, 0.033269659f, -8.3392572f, \
+    -2.8278264e-05f, 0.028050976f, -7.0538335f, -2.3438e-05f, 0.023245217f, -5.8704066f, -1.8948609e-05f, 0.01878937f, \
+    -4.7734361f, -1.4754741e-05f, 0.01462834f, -3.7493262f, -1.0807058e-05f, 0.010712969f, -2.7859402f, -7.0605902e-06f, \
+    0.0069984132f, -1.8721987f, -3.4733814e-06f, 0.0034427941f, -0.99774814f, -5.4666867e-09f, 6.1866249e-06f, -0.15271217f, \
+    -0.00032093617f, 0.27798447f, -59.909809f, 5.9122416e-05f, -0.086540073f, 27.116005f, 0.00014847454f, -0.17351493f, \
+    48.169746f, 0.00017518137f, -0.19917111f, 54.310219f, 0.00018893558f, -0.21212496f, 57.355835f, 0.00019831913f, \
+    -0.22083429f, 59.376057f, 0.00020572959f, -0.22766067f, 60.948463f, 0.00021215217f, -0.23357169f, 62.309116f, \
+    0.000218093f, -0.23906255f, 63.578453f, 0.00022385287f, -0.24442652f, 64.827583f, 0.00022963127f, -0.24985771f, \
+    66.103485f, 0.00023557388f, -0.25549781f, 67.440445f, 0.00024179739f, -0.2614606f, 68.866081f, 0.00024840425f, \
+    -0.26784652f, 70.404869f, 0.00025549225f, -0.27475226f, 72.080521f, 0.0002631617f, -0.28227752f, 73.917679f, \
+    -6.9868889e-05f, 0.046835452f, -6.8046374f, 4.829812e-05f, -0.068111405f, 20.989594f, 9.7229e-05f, -0.11596029f, \
+    32.617569f, 0.00011995571f, -0.13809684f, 37.980145f, 0.00013348724f, -0.15118092f, 41.130241f, 0.00014326896f, \
+    -0.16058406f, 43.382915f, 0.0001512111f, -0.16819441f, 45.201244f, 0.00015815668f, -0.17484541f, 46.789677f, \
+    0.0001645514f, -0.18097748f, 48.256226f, 0.00017066511f, -0.18685716f, 49.666225f, 0.00017667959f, -0.19266401f, \
+    51.063709f, 0.00018272895f, -0.19853064f, 52.481213f, 0.00018892071f, -0.20456354f, 53.944923f, 0.00019534798f, \
+    -0.21085528f, 55.477661f, 0.00020209749f, -0.21749236f, 57.100834f, 0.00020925529f, -0.22456104f, 58.835857f, \
+    -3.1354895e-05f, 0.014211545f, 0.062457126f, 3.2445376e-05f, -0.048158884f, 15.209177f, 6.6722067e-05f, -0.08177501f, \
+    23.39823f, 8.642055e-05f, -0.10107321f, 28.096256f, 9.924711e-05f, -0.1135971f, 31.13702f, 0.0001088089f, \
+    -0.12290408f, 33.391075f, 0.00011666058f, -0.13053207f, 35.235798f, 0.00012354821f, -0.13722005f, 36.852737f, \
+    0.00012987872f, -0.14337143f, 38.341061f, 0.00013590106f, -0.14923304f, 39.761475f, 0.00014178327f, -0.15497164f, \
+    41.155033f, 0.00014764916f, -0.16071028f, 42.552044f, 0.0001535975f, -0.16654727f, 43.97678f, 0.00015971316f, \
+    -0.17256729f, 45.450188f, 0.00016607413f, -0.17884839f, 46.991619f, 0.00017275658f, -0.18546703f, 48.62009f, \
+    -2.4409188e-05f, 0.010575113f, 0.28619763f, 1.8651066e-05f, -0.031642873f, 10.564534f, 4.5371311e-05f, -0.057903372f, \
+    16.972887f, 6.2772029e-05f, -0.075005598f, 21.147554f, 7.4898096e-05f, -0.086905181f, 24.049047f, 8.4157262e-05f, \
+    -0.095974796f, 26.2575f, 9.1813796e-05f, -0.10346518f, 28.079773f, 9.8534205e-05f, -0.11003698f, 29.678253f, \
+    0.00010469789f, -0.11606676f, 31.145594f, 0.00011054063f, -0.12178875f, 32.539482f, 0.00011622215f, -0.12736176f, \
+    33.899071f, 0.00012185974f, -0.13290259f, 35.253189f, 0.00012754643f, -0.13850404f, 36.624763f, 0.00013336146f, \
+    -0.14424528f, 38.033413f, 0.00013937699f, -0.15019859f, 39.497074f, 0.00014566274f, -0.15643398f, 41.033154f, \
+    -2.5798672e-05f, 0.014245923f, -1.0867611f, 6.8032946e-06f, -0.017786067f, 6.7257557f, 2.8940918e-05f, -0.0395789f, \
+    12.051139f, 4.4560566e-05f, -0.054963138f, 15.812992f, 5.6053788e-05f, -0.0662762f, 18.578487f, 6.5028631e-05f, \
+    -0.075100891f, 20.734165f, 7.2495037e-05f, -0.082435951f, 22.52495f, 7.904652e-05f, -0.088869832f, 24.095482f, \
+    8.5039457e-05f, -0.094756439f, 25.532883f, 9.0700836e-05f, -0.10032148f, 26.892771f, 9.6185628e-05f, -0.10571922f, \
+    28.213205f, 0.00010160756f, -0.11106301f, 29.52219f, 0.00010705634f, -0.1164424f, 30.841867f, 0.00011260778f, \
+    -0.12193323f, 32.191029f, 0.00011833036f, -0.12760407f, 33.586697f, 0.00012428963f, -0.13352074f, 35.045231f, \
+    -3.007635e-05f, 0.020260932f, -2.9275987f, -3.631975e-06f, -0.0057654749f, 3.4293463f, 1.5455838e-05f, -0.024581989f, \
+    8.03265f, 2.9677676e-05f, -0.038611226f, 11.467501f, 4.0603158e-05f, -0.049387556f, 14.10622f, 4.9328053e-05f, \
+    -0.057988305f, 16.21159f, 5.6635297e-05f, -0.065187134f, 17.973185f, 6.3044688e-05f, -0.071499363f, 19.517639f, \
+    6.8890469e-05f, -0.077256992f, 20.926695f, 7.4392825e-05f, -0.082679093f, 22.254351f, 7.9704281e-05f, -0.087917581f, \
+    23.538103f, 8.4937106e-05f, -0.093084432f, 24.805624f, 9.0179536e-05f, -0.098267764f, 26.078711f, 9.5505675e-05f, \
+    -0.1035417f, 27.375734f, 0.00010098188f, -0.10897274f, 28.713192f, 0.00010667123f, -0.11462414f, 30.106812f, \
+    -3.5537523e-05f, 0.027128596f, -4.9110518f, -1.3084467e-05f, 0.0049981382f, 0.50098395f, 3.8489511e-06f, -0.011714661f, \
+    4.5936594f, 1.6967033e-05f, -0.024671052f, 7.7689967f, 2.7385075e-05f, -0.034962185f, 10.291934f, 3.5888221e-05f, \
+    -0.043359496f, 12.350509f, 4.3069856e-05f, -0.050448768f, 14.088114f, 4.937093e-05f, -0.05666694f, 15.612069f, \
+    5.5100776e-05f, -0.062321309f, 16.998024f, 6.0473107e-05f, -0.067624539f, 18.298409f, 6.5639309e-05f, -0.072727494f, \
+    19.550467f, 7.0711714e-05f, -0.077742241f, 20.781897f, 7.577856e-05f, -0.082756944f, 22.014515f, 8.0913574e-05f, \
+    -0.08784534f, 23.266594f, 8.6182321e-05f, -0.093073115f, 24.554426f, 9.164666e-05f, -0.098502301f, 25.893423f, \
+    -4.1565057e-05f, 0.034344673f, -6.9355927f, -2.1868687e-05f, 0.014906019f, -2.1766064f, -6.5191648e-06f, -0.00025986336f, \
+    1.5405424f, 5.7231696e-06f, -0.0123639f, 4.5094638f, 1.5696214e-05f, -0.022226835f, 6.9296441f, 2.3997187e-05f, \
+    -0.030435538f, 8.9441357f, 3.1080304e-05f, -0.037438039f, 10.662519f, 3.7306178e-05f, -0.04359141f, 12.172429f, \
+    4.2952859e-05f, -0.049171802f, 13.541827f, 4.8225662e-05f, -0.05438355f, 14.821089f, 5.3275202e-05f, -0.05937678f, \
+    16.047279f, 5.8214948e-05f, -0.06426473f, 17.248392f, 6.3134328e-05f, -0.069136761f, 18.446541f, 6.810786e-05f, \
+    -0.074067421f, 19.660191f, 7.3201394e-05f, -0.079122648f, 20.905701f, 7.8476638e-05f, -0.084364317f, 22.198429f, \
+    -4.7927373e-05f, 0.041744806f, -8.9744062f, -3.0218671e-05f, 0.024246924f, -4.6862235f, -1.6064871e-05f, 0.010248529f, \
+    -1.2524158f, -4.5198321e-06f, -0.0011766136f, 1.5520505f, 5.0731092e-06f, -0.010672667f, 3.8839471f, 1.3189798e-05f, \
+    -0.018707562f, 5.8573999f, 2.0192096e-05f, -0.025638158f, 7.5596671f, 2.6370917e-05f, -0.031752303f, 9.0613422f, \
+    3.1966229e-05f, -0.037288196f, 10.42101f, 3.7170117e-05f, -0.042436991f, 11.685789f, 4.2131313e-05f, -0.047346942f, \
+    12.892283f, 4.6964895e-05f, -0.052132919f, 14.068891f, 5.1762461e-05f, -0.056886476f, 15.238264f, 5.6600351e-05f, \
+    -0.061683964f, 16.419319f, 6.1545717e-05f, -0.066592626f, 17.628729f, 6.6661079e-05f, -0.071675114f, 18.882044f, \
+    -5.4550223e-05f, 0.049298275f, -11.028869f, -3.8316524e-05f, 0.033239853f, -7.0897064f, -2.5080042e-05f, 0.020136381f, \
+    -3.8729265f, -1.4089985e-05f, 0.0092512481f, -1.1992019f, -4.8136612e-06f, 6.1030198e-05f, 1.0590473f, 3.1411139e-06f, \
+    -0.0078203473f, 2.9960725f, 1.0074416e-05f, -0.014688938f, 4.6842871f, 1.6226433e-05f, -0.020782322f, 6.1819353f, \
+    2.179884e-05f, -0.026300568f, 7.5381932f, 2.6963962e-05f, -0.031415086f, 8.7952948f, 3.1865115e-05f, -0.036268741f, \
+    9.9885073f, 3.6618392e-05f, -0.04097743f, 11.146479f, 4.1318162e-05f, -0.045635466f, 12.292553f, 4.6043533e-05f, \
+    -0.050321989f, 13.446327f, 5.0863935e-05f, -0.055106502f, 14.625034f, 5.5843659e-05f, -0.060053412f, 15.844649f, \
+    -6.1431914e-05f, 0.057033539f, -13.112237f, -4.63121e-05f, 0.042061005f, -9.4361095f, -3.3784152e-05f, 0.029647708f, \
+    -6.3864722f, -2.3232806e-05f, 0.019188721f, -3.8157675f, -1.4213234e-05f, 0.010246173f, -1.6170926f, -6.3932475e-06f, \
+    0.0024926155f, 0.28958872f, 4.8347908e-07f, -0.004325056f, 1.9662297f, 6.6220923e-06f, -0.010409812f, 3.4625995f, \
+    1.219398e-05f, -0.015931619f, 4.8204603f, 1.7348599e-05f, -0.021039072f, 6.0764046f, 2.2218239e-05f, -0.025864f, \
+    7.2629657f, 2.6917347e-05f, -0.030520653f, 8.4083815f, 3.1542819e-05f, -0.03510588f, 9.5366192f, 3.617724e-05f, \
+    -0.0397023f, 10.668139f, 4.0893305e-05f, -0.044382673f, 11.820975f, 4.5758054e-05f, -0.04921414f, 13.011776f, \
+    -6.8609384e-05f, 0.065009713f, -15.243697f, -5.4336611e-05f, 0.050861418f, -11.766901f, -4.2354226e-05f, 0.0389782f, \
+    -8.8453465f, -3.2144042e-05f, 0.028849527f, -6.3542686f, -2.3325259e-05f, 0.020099888f, -4.2018366f, -1.5609896e-05f, \
+    0.012444972f, -2.3184638f, -8.7738026e-06f, 0.0056631998f, -0.64985782f, -2.6369976e-06f, -0.00042362037f, 0.8477003f, \
+    2.9503321e-06f, -0.0059640864f, 2.2107263f, 8.1182307e-06f, -0.011087455f, 3.4710417f, 1.2984245e-05f, -0.015910815f, \
+    4.6575284f, 1.7656301e-05f, -0.020541886f, 5.796803f, 2.2231678e-05f, -0.025077892f, 6.9129224f, 2.6796455e-05f, \
+    -0.029604947f, 8.0272102f, 3.1427437e-05f, -0.034199927f, 9.1587172f, 3.6195488e-05f, -0.038933776f, 10.325027f, \
+    -7.6144723e-05f, 0.073306166f, -17.446434f, -6.2512758e-05f, 0.059779536f, -14.119581f, -5.094369e-05f, 0.048296232f, \
+    -11.294303f, -4.0990421e-05f, 0.038414884f, -8.862546f, -3.2319778e-05f, 0.029806344f, -6.7436891f, -2.4676956e-05f, \
+    0.022218667f, -4.8759761f, -1.7861999e-05f, 0.015453934f, -3.2108552f, -1.171363e-05f, 0.0093523115f, -1.7090789f, \
+    -6.0976572e-06f, 0.0037806262f, -0.33790487f, -8.9825454e-07f, -0.0013762657f, 0.93101585f, 3.9888614e-06f, -0.0062222164f, \
+    2.1232936f, 8.6614073e-06f, -0.010854719f, 3.2630095f, 1.3212622e-05f, -0.015366945f, 4.3732095f, 1.7730235e-05f, \
+    -0.01984665f, 5.4756231f, 2.2295391e-05f, -0.024375048f, 6.5903702f, 2.6983807e-05f, -0.029027931f, 7.7362337f, \
+    -8.4121042e-05f, 0.082020305f, -19.747473f, -7.0963157e-05f, 0.068951227f, -16.530481f, -5.9695645e-05f, 0.057757579f, \
+    -13.77449f, -4.9924136e-05f, 0.048049293f, -11.383848f, -4.1351264e-05f, 0.039532088f, -9.2863541f, -3.3747387e-05f, \
+    0.031978518f, -7.4261818f, -2.6930937e-05f, 0.025208624f, -5.7591281f, -2.075478e-05f, 0.019076418f, -4.2493086f, \
+    -1.5096337e-05f, 0.013460144f, -2.8667665f, -9.8501223e-06f, 0.0082548968f, -1.5856621f, -4.9218065e-06f, 0.0033667227f, \
+    -0.38282615f, -2.232966e-07f, -0.0012922502f, 0.76344162f, 4.3311011e-06f, -0.0058076261f, 1.8743083f, 8.8265278e-06f, \
+    -0.010264555f, 2.9708514f, 1.3346751e-05f, -0.014746867f, 4.0738354f, 1.7972792e-05f, -0.019335657f, 5.2033525f, \
+    -9.2643459e-05f, 0.091269895f, -22.178526f, -7.981831e-05f, 0.078518853f, -19.037243f, -6.8753623e-05f, 0.067517184f, \
+    -16.32658f, -5.9094255e-05f, 0.057912976f, -13.960096f, -5.0569754e-05f, 0.049438104f, -11.871913f, -4.2969536e-05f, \
+    0.04188367f, -10.010677f, -3.6126003e-05f, 0.035083305f, -8.335474f, -2.9902729e-05f, 0.028901478f, -6.8129525f, \
+    -2.4185831e-05f, 0.023224967f, -5.4152288f, -1.8877452e-05f, 0.017956372f, -4.1182995f, -1.3890518e-05f, 0.01300894f, \
+    -2.900763f, -9.1443153e-06f, 0.0083021503f, -1.7427347f, -4.5605407e-06f, 0.0037578009f, -0.62488204f, -5.9964762e-08f, \
+    -0.00070332346f, 0.47239625f, 4.4395329e-06f, -0.0051633846f, 1.5694451f, 9.0225476e-06f, -0.009707042f, 2.6872344f, \
+    -0.00010184379f, 0.10119876f, -24.777601f, -8.9225199e-05f, 0.088640749f, -21.681347f, -7.8271776e-05f, 0.077740178f, \
+    -18.99366f, -6.8657231e-05f, 0.068173125f, -16.634851f, -6.0131068e-05f, 0.0596908f, -14.543696f, -5.2496864e-05f, \
+    0.052098032f, -12.672153f, -4.5597448e-05f, 0.045238569f, -10.981744f, -3.9304356e-05f, 0.038984627f, -9.4409847f, \
+    -3.3510147e-05f, 0.033229258f, -8.0235128f, -2.8122538e-05f, 0.027880536f, -6.7066579f, -2.3059725e-05f, 0.022856904f, \
+    -5.4702883f, -1.8246368e-05f, 0.018083187f, -4.295836f, -1.3609945e-05f, 0.01348695f, -3.1653955f, -9.0772173e-06f, \
+    0.008994991f, -2.060858f, -4.570923e-06f, 0.0045300317f, -0.96309537f, -7.3849749e-09f, 8.3575414e-06f, 0.14862035f, \
+    -0.00025255492f, 0.21075478f, -43.198891f, 0.00011746379f, -0.1473055f, 43.087563f, 0.00018208093f, -0.21036495f, \
+    58.412338f, 0.000203712f, -0.2310556f, 63.351887f, 0.00021668567f, -0.24326597f, 66.223953f, 0.00022652051f, \
+    -0.25245768f, 68.372192f, 0.00023499643f, -0.26038757f, 70.227852f, 0.00024293097f, -0.26785979f, 71.987732f, \
+    0.00025078599f, -0.27532741f, 73.762466f, 0.00025886594f, -0.2830891f, 75.624969f, 0.00026740198f, -0.29137227f, \
+    77.630959f, 0.0002765953f, -0.30037627f, 79.829552f, 0.00028664331f, -0.31029841f, 82.26976f, 0.00029775847f, \
+    -0.32135278f, 85.005142f, 0.00031018443f, -0.33378679f, 88.097946f, 0.00032421417f, -0.34789932f, 91.623749f, \
+    -2.464106e-05f, 0.00064887101f, 5.1535254f, 8.3031926e-05f, -0.10487245f, 30.875477f, 0.0001226554f, -0.14379318f, \
+    40.38678f, 0.00014187804f, -0.16255701f, 44.948605f, 0.00015464853f, -0.17495181f, 47.947647f, 0.00016473669f, \
+    -0.18471864f, 50.306118f, 0.0001735383f, -0.19324365f, 52.365967f, 0.00018172649f, -0.20119534f, 54.292122f, \
+    0.00018969332f, -0.2089632f, 56.18071f, 0.00019770322f, -0.21681027f, 58.096745f, 0.00020595865f, -0.22493853f, \
+    60.090271f, 0.00021463359f, -0.23352225f, 62.204636f, 0.00022389386f, -0.24272835f, 64.481537f, 0.00023391157f, \
+    -0.25273091f, 66.964645f, 0.00024487753f, -0.2637237f, 69.702736f, 0.00025701401f, -0.27593321f, 72.752991f, \
+    -3.437502e-07f, -0.018103506f, 8.6457386f, 5.8419781e-05f, -0.075932331f, 22.792057f, 8.8077497e-05f, -0.10517212f, \
+    29.959454f, 0.00010526118f, -0.12207487f, 34.09594f, 0.00011731572f, -0.13390052f, 36.984035f, 0.00012701082f, \
+    -0.14339943f, 39.301888f, 0.00013551401f, -0.15173312f, 41.336384f, 0.00014341412f, -0.15948804f, 43.232529f, \
+    0.00015105949f, -0.16701153f, 45.076298f, 0.00015868641f, -0.1745396f, 46.926201f, 0.00016647574f, -0.18225333f, \
+    48.827248f, 0.000174582f, -0.19030796f, 50.818127f, 0.00018315059f, -0.19885005f, 52.935497f, 0.00019233006f, \
+    -0.2080299f, 55.217052f, 0.00020228236f, -0.2180118f, 57.704117f, 0.00021319317f, -0.22898459f, 60.444286f, \
+    -6.4119695e-07f, -0.014550023f, 7.0897641f, 3.9805742e-05f, -0.054451715f, 16.870249f, 6.3980769e-05f, -0.078343183f, \
+    22.737797f, 7.9622943e-05f, -0.093791701f, 26.530985f, 9.103091e-05f, -0.1050433f, 29.291309f, 0.00010030589f, \
+    -0.11418449f, 31.53306f, 0.00010845462f, -0.12221751f, 33.503857f, 0.00011601245f, -0.12967621f, 35.335793f, \
+    0.00012330191f, -0.13688265f, 37.108673f, 0.00013054251f, -0.14405644f, 38.877014f, 0.00013790191f, -0.15136568f, \
+    40.682625f, 0.00014552244f, -0.1589535f, 42.561203f, 0.00015353704f, -0.16695389f, 44.546249f, 0.00016208025f, \
+    -0.17550288f, 46.67186f, 0.0001712973f, -0.18474761f, 48.974998f, 0.00018135324f, -0.19485562f, 51.497822f, \
+    -6.5832851e-06f, -0.0063139088f, 4.576479f, 2.4650844e-05f, -0.037181493f, 12.152999f, 4.5348766e-05f, -0.057671212f, \
+    17.191566f, 5.980971e-05f, -0.071988396f, 20.713827f, 7.0702583e-05f, -0.082766347f, 23.364794f, 7.9630227e-05f, \
+    -0.091595992f, 25.53632f, 8.7472217e-05f, -0.099353127f, 27.444757f, 9.4726347e-05f, -0.10653441f, 29.213028f, \
+    0.00010170005f, -0.11344712f, 30.917301f, 0.0001086039f, -0.12030205f, 32.609921f, 0.00011559828f, -0.1272601f, \
+    34.330921f, 0.00012281863f, -0.13445745f, 36.114262f, 0.00013039057f, -0.14202073f, 37.991585f, 0.00013844043f, \
+    -0.15007749f, 39.994835f, 0.00014710374f, -0.1587649f, 42.158421f, 0.00015653372f, -0.16823816f, 44.521336f, \
+    -1.4233925e-05f, 0.0031086467f, 1.8800867f, 1.1580021e-05f, -0.022437368f, 8.1567965f, 2.9897979e-05f, -0.040593985f, \
+    12.625681f, 4.3428507e-05f, -0.054012056f, 15.930793f, 5.3923748e-05f, -0.064418279f, 18.49444f, 6.258997e-05f, \
+    -0.073008873f, 20.610922f, 7.0192669e-05f, -0.080545925f, 22.46841f, 7.7199969e-05f, -0.087496594f, 24.18252f, \
+    8.3910942e-05f, -0.094159916f, 25.827385f, 9.0532674e-05f, -0.10074328f, 27.454504f, 9.7222794e-05f, -0.10740485f, \
+    29.103233f, 0.00010411373f, -0.11427777f, 30.806755f, 0.00011132753f, -0.12148496f, 32.595772f, 0.00011898622f, \
+    -0.12914956f, 34.501091f, 0.00012722024f, -0.13740334f, 36.555729f, 0.00013617652f, -0.14639498f, 38.79697f, \
+    -2.2529397e-05f, 0.012856255f, -0.82849038f, -2.159353e-07f, -0.0092500746f, 4.6072817f, 1.6400267e-05f, -0.025736114f, \
+    8.6676292f, 2.9185689e-05f, -0.03842992f, 11.796812f, 3.937244e-05f, -0.048544735f, 14.291222f, 4.7857269e-05f, \
+    -0.056968696f, 16.369022f, 5.5289776e-05f, -0.064348139f, 18.189672f, 6.2109175e-05f, -0.071121357f, 19.861607f, \
+    6.8610032e-05f, -0.077582911f, 21.457838f, 7.5000047e-05f, -0.083940856f, 23.030033f, 8.1437793e-05f, -0.090354301f, \
+    24.617765f, 8.8055836e-05f, -0.096956506f, 26.254234f, 9.4975643e-05f, -0.10386972f, 27.969955f, 0.000102318f, \
+    -0.11121572f, 29.795361f, 0.00011021157f, -0.11912432f, 31.762936f, 0.00011880107f, -0.12774169f, 33.909283f, \
+    -3.1180909e-05f, 0.02275065f, -3.5283074f, -1.1261844e-05f, 0.0029983604f, 1.3315035f, 4.1072135e-06f, -0.012262267f, \
+    5.0917921f, 1.6298929e-05f, -0.024376782f, 8.0796804f, 2.6240477e-05f, -0.034257978f, 10.518025f, 3.4610533e-05f, \
+    -0.04257717f, 12.571477f, 4.193946e-05f, -0.049861491f, 14.369916f, 4.8629481e-05f, -0.056512177f, 16.012537f, \
+    5.4970911e-05f, -0.062819511f, 17.571278f, 6.1175058e-05f, -0.068995185f, 19.098686f, 6.7404602e-05f, -0.075202405f, \
+    20.635349f, 7.3795214e-05f, -0.081577517f, 22.215218f, 8.047044e-05f, -0.088244788f, 23.869282f, 8.7552427e-05f, \
+    -0.095327251f, 25.628262f, 9.5170879e-05f, -0.10295562f, 27.524826f, 0.00010347152f, -0.11127685f, 29.595726f, \
+    -4.0159892e-05f, 0.032830942f, -6.2432332f, -2.1933589e-05f, 0.014743159f, -1.7909275f, -7.4870077e-06f, 0.00038935471f, \
+    1.7470529f, 4.24261e-06f, -0.011273277f, 4.6243658f, 1.3989948e-05f, -0.020968178f, 7.0175996f, 2.2293858e-05f, \
+    -0.029227974f, 9.0572491f, 2.9579918e-05f, -0.036475107f, 10.847236f, 3.6199261e-05f, -0.043059532f, 12.473979f, \
+    4.2431901e-05f, -0.049261156f, 14.006804f, 4.8493624e-05f, -0.055296123f, 15.499345f, 5.4554013e-05f, -0.061334558f, \
+    16.993887f, 6.0754755e-05f, -0.067518778f, 18.525856f, 6.7224144e-05f, -0.073977791f, 20.127396f, 7.4088268e-05f, \
+    -0.080838457f, 21.830153f, 8.1480466e-05f, -0.088235013f, 23.667633f, 8.9550456e-05f, -0.09631823f, 25.677496f, \
+    -4.9545521e-05f, 0.043221731f, -9.0135717f, -3.2530043e-05f, 0.026324082f, -4.8527536f, -1.8759913e-05f, 0.012635154f, \
+    -1.4779489f, -7.3754945e-06f, 0.001310398f, 1.3164378f, 2.2290278e-06f, -0.0082470477f, 3.67611f, 1.0501738e-05f, \
+    -0.016480014f, 5.7095003f, 1.7793858e-05f, -0.023736803f, 7.5021815f, 2.440026e-05f, -0.030310938f, 9.1265306f, \
+    3.0577208e-05f, -0.036458388f, 10.645875f, 3.654082e-05f, -0.042395562f, 12.113885f, 4.246907e-05f, -0.048300959f, \
+    13.574906f, 4.8512571e-05f, -0.054325826f, 15.066562f, 5.4807333e-05f, -0.060606845f, 16.622885f, 6.1486149e-05f, \
+    -0.067277521f, 18.277147f, 6.8688765e-05f, -0.07447838f, 20.064386f, 7.6571872e-05f, -0.08236701f, 22.023909f, \
+    -5.9477676e-05f, 0.054096054f, -11.888994f, -4.3316668e-05f, 0.038037043f, -7.9335656f, -3.0024725e-05f, 0.0248175f, \
+    -4.6740732f, -1.8878725e-05f, 0.013725885f, -1.9371048f, -9.3614508e-06f, 0.0042521777f, 0.40189892f, -1.0868464e-06f, \
+    -0.0039852499f, 2.4363682f, 6.2472309e-06f, -0.011285909f, 4.239831f, 1.2891584e-05f, -0.017899197f, 5.8737011f, \
+    1.9068751e-05f, -0.024047138f, 7.3928299f, 2.4983128e-05f, -0.029934254f, 8.847887f, 3.0818112e-05f, -0.035744421f, \
+    10.284523f, 3.6735346e-05f, -0.041639898f, 11.743077f, 4.2881871e-05f, -0.04776838f, 13.260298f, 4.9400489e-05f, \
+    -0.054273341f, 14.871904f, 5.6440571e-05f, -0.061304837f, 16.615273f, 6.4169195e-05f, -0.069030687f, 18.532198f, \
+    -7.0147624e-05f, 0.065671682f, -14.928767f, -5.4557124e-05f, 0.05017041f, -11.109781f, -4.1572381e-05f, 0.037251085f, \
+    -7.9240851f, -3.0562736e-05f, 0.026291968f, -5.2199297f, -2.1072005e-05f, 0.016842652f, -2.8872168f, -1.2757148e-05f, \
+    0.0085638063f, -0.84285206f, -5.3493241e-06f, 0.0011889013f, 0.97857517f, 1.3728234e-06f, -0.0055020628f, 2.6311908f, \
+    7.6031297e-06f, -0.011702273f, 4.1626568f, 1.352329e-05f, -0.017593333f, 5.6179032f, 1.9310575e-05f, -0.023352847f, \
+    7.0409765f, 2.5135272e-05f, -0.029151671f, 8.4743214f, 3.115831e-05f, -0.035151377f, 9.9581079f, 3.7536596e-05f, \
+    -0.041509509f, 11.531527f, 4.4433244e-05f, -0.0483898f, 13.235309f, 5.2029929e-05f, -0.055974502f, 15.114792f, \
+    -8.1806989e-05f, 0.078223608f, -18.205574f, -6.6541907e-05f, 0.06303677f, -14.463161f, -5.3705484e-05f, 0.050259814f, \
+    -11.312411f, -4.2728756e-05f, 0.03933065f, -8.6158924f, -3.3196531e-05f, 0.029838655f, -6.273108f, -2.4794881e-05f, \
+    0.021472935f, -4.207871f, -1.7277393e-05f, 0.013989063f, -2.3601863f, -1.0442153e-05f, 0.0071863607f, -0.68070132f, \
+    -4.1146136e-06f, 0.00089096703f, 0.87343699f, 1.866459e-06f, -0.0050581051f, 2.3420045f, 7.6611241e-06f, -0.010821038f, \
+    3.7646732f, 1.3436092e-05f, -0.016564971f, 5.1829157f, 1.9363837e-05f, -0.022462972f, 6.6397262f, 2.5619378e-05f, \
+    -0.028690681f, 8.1787558f, 3.2385109e-05f, -0.035431039f, 9.8454685f, 3.9863044e-05f, -0.042886496f, 11.690162f, \
+    -9.4791641e-05f, 0.092110693f, -21.812635f, -7.9621015e-05f, 0.077008061f, -18.089996f, -6.6773107e-05f, 0.064214043f, \
+    -14.934833f, -5.5717472e-05f, 0.053203385f, -12.218483f, -4.6064441e-05f, 0.043589965f, -9.8463011f, -3.7518163e-05f, \
+    0.035080332f, -7.7462955f, -2.9846233e-05f, 0.027443722f, -5.8617864f, -2.2858905e-05f, 0.020491445f, -4.1463666f, \
+    -1.6393778e-05f, 0.014061754f, -2.5601861f, -1.030334e-05f, 0.00800745f, -1.0669122f, -4.4434878e-06f, 0.00218447f, \
+    0.3690874f, 1.3378636e-06f, -0.0035594925f, 1.785552f, 7.210524e-06f, -0.0093946867f, 3.2247245f, 1.336462e-05f, \
+    -0.015511792f, 4.7339473f, 2.0007796e-05f, -0.022118952f, 6.3648963f, 2.7370741e-05f, -0.029447163f, 8.1748924f, \
+    -0.00010956518f, 0.10782185f, -25.875658f, -9.4249343e-05f, 0.092563555f, -22.113455f, -8.121541e-05f, 0.079577617f, \
+    -18.910595f, -6.9951864e-05f, 0.068356328f, -16.142481f, -6.0081311e-05f, 0.058524922f, -13.717095f, -5.1316525e-05f, \
+    0.049797986f, -11.564319f, -4.3431861e-05f, 0.041951139f, -9.6289854f, -3.6243746e-05f, 0.034801658f, -7.8661299f, \
+    -2.9596382e-05f, 0.028194301f, -6.2375026f, -2.3350309e-05f, 0.021989923f, -4.708777f, -1.7372025e-05f, 0.01605515f, \
+    -3.246999f, -1.1523076e-05f, 0.010251474f, -1.8178958f, -5.6474105e-06f, 0.0044226223f, -0.38274971f, 4.4242324e-07f, \
+    -0.0016192131f, 1.1050065f, 6.9744424e-06f, -0.0081024375f, 2.7020156f, 1.4217725e-05f, -0.015296312f, 4.4750199f, \
+    -0.00012679634f, 0.12605712f, -30.573521f, -0.0001110595f, 0.11036597f, -26.703014f, -9.7631746e-05f, 0.096979186f, \
+    -23.400635f, -8.6001164e-05f, 0.085387409f, -20.541134f, -7.5789532e-05f, 0.075214162f, -18.03191f, -6.6708883e-05f, \
+    0.066172719f, -15.802411f, -5.8533326e-05f, 0.05803806f, -13.797245f, -5.1079809e-05f, 0.050627738f, -11.971475f, \
+    -4.4194221e-05f, 0.043788057f, -10.287214f, -3.7740425e-05f, 0.037383147f, -8.7109509f, -3.1590596e-05f, 0.031285346f, \
+    -7.2111597f, -2.5615216e-05f, 0.025365183f, -5.7558432f, -1.9670992e-05f, 0.019479342f, -4.3095465f, -1.3584609e-05f, \
+    0.013454408f, -2.8293426f, -7.1311638e-06f, 0.0070653628f, -1.2595149f, -1.2099281e-08f, 1.3692694e-05f, 0.47383311f, \
+    -0.00015383166f, 0.11079676f, -17.797173f, 0.00018426978f, -0.21933995f, 62.528648f, 0.00022882374f, -0.26262769f, \
+    73.021538f, 0.00024781644f, -0.28066367f, 77.302795f, 0.00026078985f, -0.29285505f, 80.168747f, 0.00027156787f, \
+    -0.30299246f, 82.554764f, 0.00028159923f, -0.31250614f, 84.812531f, 0.0002916283f, -0.3221288f, 87.12178f, \
+    0.00030212637f, -0.33232474f, 89.596481f, 0.00031345591f, -0.34345311f, 92.325279f, 0.00032595085f, -0.35584804f, \
+    95.391403f, 0.0003399649f, -0.36986724f, 98.884773f, 0.00035590917f, -0.38593012f, 102.91162f, 0.00037429249f, \
+    -0.40455908f, 107.60499f, 0.00039577446f, -0.42643425f, 113.13873f, 0.00042124555f, -0.45247659f, 119.74887f, \
+    3.2951339e-05f, -0.059896361f, 21.151289f, 0.00012606411f, -0.15177488f, 43.718971f, 0.000157453f, -0.18267128f, \
+    51.295635f, 0.00017485111f, -0.19968434f, 55.445099f, 0.00018774303f, -0.2122553f, 58.504433f, 0.00019875013f, \
+    -0.22299768f, 61.121563f, 0.00020896438f, -0.23300044f, 63.566547f, 0.00021897907f, -0.24285567f, 65.986343f, \
+    0.00022918556f, -0.2529549f, 68.478348f, 0.00023988863f, -0.26360428f, 71.119034f, 0.00025136344f, -0.27508181f, \
+    73.978172f, 0.00026389092f, -0.28767288f, 77.127785f, 0.00027778544f, -0.30169842f, 80.6492f, 0.00029342249f, \
+    -0.31754333f, 84.640274f, 0.00031127312f, -0.3356916f, 89.22438f, 0.00033195177f, -0.35677603f, 94.56308f, \
+    3.9784049e-05f, -0.061095525f, 20.25075f, 9.2331167e-05f, -0.11314107f, 33.074955f, 0.000117511f, -0.13807286f, \
+    39.219894f, 0.00013324729f, -0.15361528f, 43.043957f, 0.00014533201f, -0.16553862f, 45.975948f, 0.00015577822f, \
+    -0.17585367f, 48.51498f, 0.00016548896f, -0.18546367f, 50.885563f, 0.00017496919f, -0.19487451f, 53.213654f, \
+    0.00018455726f, -0.20442605f, 55.584061f, 0.00019451829f, -0.21438555f, 58.063713f, 0.00020509068f, -0.22499432f, \
+    60.713276f, 0.0002165148f, -0.23649664f, 63.594398f, 0.00022905572f, -0.24916285f, 66.775505f, 0.00024302526f, \
+    -0.26331183f, 70.337524f, 0.00025880887f, -0.27933851f, 74.380844f, 0.00027690167f, -0.29775092f, 79.034798f, \
+    3.1094183e-05f, -0.048981346f, 16.522207f, 6.8554415e-05f, -0.086175233f, 25.704985f, 9.011021e-05f, -0.10759244f, \
+    30.99861f, 0.00010460574f, -0.12198202f, 34.554111f, 0.00011597196f, -0.13326116f, 37.341251f, 0.00012585326f, \
+    -0.14307377f, 39.768223f, 0.00013504263f, -0.15221414f, 42.032627f, 0.00014399497f, -0.16113877f, 44.248245f, \
+    0.00015301778f, -0.17015705f, 46.492367f, 0.00016235265f, -0.17951274f, 48.826092f, 0.00017221643f, -0.18942542f, \
+    51.304607f, 0.00018282667f, -0.2001161f, 53.98365f, 0.00019442168f, -0.21182741f, 56.924557f, 0.00020727995f, \
+    -0.22484358f, 60.199318f, 0.00022174352f, -0.2395141f, 63.896568f, 0.00023824889f, -0.25628552f, 68.129677f, \
+    1.9957673e-05f, -0.035406258f, 12.645719f, 4.9785944e-05f, -0.065076187f, 19.980999f, 6.899258e-05f, -0.084202737f, \
+    24.716776f, 8.2602783e-05f, -0.097754873f, 28.07358f, 9.3421753e-05f, -0.10852739f, 30.742859f, 0.00010284338f, \
+    -0.11791428f, 33.07074f, 0.00011159259f, -0.12664223f, 35.23806f, 0.00012009707f, -0.13514082f, 37.351936f, \
+    0.00012864817f, -0.14370337f, 39.485683f, 0.00013747485f, -0.15256104f, 41.69722f, 0.00014678223f, -0.16192143f, \
+    44.038719f, 0.00015677554f, -0.17199285f, 46.562656f, 0.00016767897f, -0.18300326f, 49.32658f, 0.000179754f, \
+    -0.19521897f, 52.397812f, 0.00019332122f, -0.20896678f, 55.859066f, 0.00020878922f, -0.22466359f, 59.815937f, \
+    8.4573594e-06f, -0.022010818f, 8.9331255f, 3.3785946e-05f, -0.047240026f, 15.176631f, 5.1372284e-05f, -0.064780891f, \
+    19.524733f, 6.436641e-05f, -0.077745862f, 22.74098f, 7.4802418e-05f, -0.088159986f, 25.325798f, 8.388031e-05f, \
+    -0.097223371f, 27.577059f, 9.2281101e-05f, -0.10561895f, 29.664709f, 0.0001004206f, -0.11376462f, 31.692963f, \
+    0.00010858468f, -0.12194829f, 33.73378f, 0.0001169978f, -0.13039654f, 35.843922f, 0.00012586039f, -0.13931218f, \
+    38.074318f, 0.00013537255f, -0.14889809f, 40.476028f, 0.00014575265f, -0.15937601f, 43.104946f, 0.0001572555f, \
+    -0.17100497f, 46.026443f, 0.00017019399f, -0.18410325f, 49.320923f, 0.00018496795f, -0.1990778f, 53.091232f, \
+    -3.1144982e-06f, -0.0088751372f, 5.3585448f, 1.9331952e-05f, -0.031257696f, 10.901317f, 3.5763802e-05f, -0.047665775f, \
+    14.971545f, 4.8339745e-05f, -0.060231056f, 18.091566f, 5.8540754e-05f, -0.070426047f, 20.624643f, 6.7387722e-05f, \
+    -0.079271279f, 22.823854f, 7.5528689e-05f, -0.087416679f, 24.850887f, 8.3378509e-05f, -0.095279284f, 26.809727f, \
+    9.1226379e-05f, -0.1031504f, 28.773165f, 9.9299141e-05f, -0.11125902f, 30.798544f, 0.00010779843f, -0.11980903f, \
+    32.937031f, 0.00011692491f, -0.12900367f, 35.239712f, 0.00012689737f, -0.13906485f, 37.762447f, 0.0001379717f, \
+    -0.15025221f, 40.57066f, 0.00015046327f, -0.16288595f, 43.745079f, 0.00016477723f, -0.17737751f, 47.389484f, \
+    -1.4877169e-05f, 0.0042392523f, 1.8372399f, 5.6461035e-06f, -0.016242666f, 6.9114599f, 2.1256596e-05f, -0.031843375f, \
+    10.78298f, 3.3556378e-05f, -0.044144511f, 13.839007f, 4.3651817e-05f, -0.054244533f, 16.350006f, 5.2379703e-05f, \
+    -0.062979005f, 18.522865f, 6.0348706e-05f, -0.070958205f, 20.509295f, 6.7979003e-05f, -0.078604527f, 22.414585f, \
+    7.5570948e-05f, -0.086220533f, 24.31431f, 8.336053e-05f, -0.094044358f, 26.268072f, 9.155622e-05f, -0.10228674f, \
+    28.328711f, 0.00010036444f, -0.11115655f, 30.548668f, 0.00011001002f, -0.12088146f, 32.98518f, 0.00012075651f, \
+    -0.13172853f, 35.705433f, 0.00013293052f, -0.14402874f, 38.792717f, 0.00014695495f, -0.15821061f, 42.354916f, \
+    -2.7076963e-05f, 0.01765386f, -1.726459f, -7.8438816e-06f, -0.0015524373f, 3.032625f, 7.2079647e-06f, -0.016603446f, \
+    6.7682705f, 1.9342751e-05f, -0.028747143f, 9.7857666f, 2.9436056e-05f, -0.038851943f, 12.298581f, 3.8156737e-05f, \
+    -0.047584634f, 14.471461f, 4.6047684e-05f, -0.055489004f, 16.439405f, 5.3530101e-05f, -0.062988371f, 18.307852f, \
+    6.0921622e-05f, -0.070402667f, 20.156672f, 6.8474517e-05f, -0.077986397f, 22.049526f, 7.6410382e-05f, -0.085963421f, \
+    24.042496f, 8.4946987e-05f, -0.094553903f, 26.190796f, 9.4320771e-05f, -0.10399699f, 28.554466f, 0.00010480956f, \
+    -0.11457375f, 31.2041f, 0.0001167599f, -0.12663478f, 34.227772f, 0.00013062486f, -0.14063826f, 37.740612f, \
+    -4.0030776e-05f, 0.031738207f, -5.4350319f, -2.1627024e-05f, 0.013352081f, -0.87934428f, -6.910539e-06f, -0.0013688754f, \
+    2.7740395f, 5.1659522e-06f, -0.013458535f, 5.7778378f, 1.5335923e-05f, -0.02364392f, 8.3105249f, 2.4151452e-05f, \
+    -0.032474574f, 10.507595f, 3.2069107e-05f, -0.040407062f, 12.482147f, 3.9486324e-05f, -0.047840439f, 14.333439f, \
+    4.6736259e-05f, -0.055110145f, 16.145147f, 5.4094387e-05f, -0.062494021f, 17.986712f, 6.1803003e-05f, -0.07023669f, \
+    19.919357f, 7.0098016e-05f, -0.07857646f, 22.002792f, 7.9234065e-05f, -0.087770596f, 24.301506f, 8.9510562e-05f, \
+    -0.098121569f, 26.89135f, 0.00010130364f, -0.11000922f, 29.867582f, 0.00011511078f, -0.12393575f, 33.356144f, \
+    -5.4135817e-05f, 0.046930533f, -9.4051905f, -3.6189525e-05f, 0.028996762f, -4.9627552f, -2.1603048e-05f, 0.01440343f, \
+    -1.3422458f, -9.469828e-06f, 0.0022554882f, 1.6749567f, 8.522012e-07f, -0.0080832299f, 4.244833f, 9.8443024e-06f, \
+    -0.017091284f, 6.4851708f, 1.7895069e-05f, -0.025156587f, 8.4918346f, 2.5349545e-05f, -0.032624997f, 10.350657f, \
+    3.2532629e-05f, -0.039823312f, 12.143037f, 3.9742619e-05f, -0.047052231f, 13.944053f, 4.7250942e-05f, -0.054585651f, \
+    15.82219f, 5.5320805e-05f, -0.062689267f, 17.843935f, 6.4233653e-05f, -0.071647123f, 20.080402f, 7.4319738e-05f, \
+    -0.081792384f, 22.615f, 8.5996551e-05f, -0.093545981f, 25.553102f, 9.9823672e-05f, -0.10747172f, 29.03583f, \
+    -6.9914793e-05f, 0.063789785f, -13.782081f, -5.2087937e-05f, 0.045973577f, -9.370944f, -3.7423932e-05f, 0.03130297f, \
+    -5.7333775f, -2.5102521e-05f, 0.018967798f, -2.6716053f, -1.4538593e-05f, 0.0083884541f, -0.043671928f, -5.2936298e-06f, \
+    -0.00087080232f, 2.2575021f, 2.9810662e-06f, -0.0091575999f, 4.317646f, 1.058572e-05f, -0.016772293f, 6.2111092f, \
+    1.7806229e-05f, -0.024001921f, 8.0092154f, 2.4936588e-05f, -0.031142505f, 9.7857494f, 3.2276868e-05f, -0.038496651f, \
+    11.616282f, 4.0128813e-05f, -0.046368752f, 13.576897f, 4.8813345e-05f, -0.055082411f, 15.748496f, 5.8704507e-05f, \
+    -0.065014496f, 18.225281f, 7.0276998e-05f, -0.076642856f, 21.126656f, 8.4176078e-05f, -0.090616442f, 24.614719f, \
+    -8.8104985e-05f, 0.08309035f, -18.763731f, -7.0043257e-05f, 0.065039836f, -14.297742f, -5.5067147e-05f, 0.050059851f, \
+    -10.586588f, -4.239663e-05f, 0.037379149f, -7.4419656f, -3.1474869e-05f, 0.026446005f, -4.7288518f, -2.1885417e-05f, \
+    0.01684678f, -2.3457377f, -1.3300439e-05f, 0.0082549741f, -0.21225861f, -5.44453e-06f, 0.00039549902f, 1.739517f, \
+    1.9348722e-06f, -0.0069846888f, 3.5722895f, 9.0962585e-06f, -0.014145333f, 5.3506312f, 1.6331594e-05f, -0.021380462f, \
+    7.1478257f, 2.3977174e-05f, -0.029029049f, 9.0484762f, 3.2410015e-05f, -0.037470985f, 11.147426f, 4.206859e-05f, \
+    -0.047147598f, 13.554813f, 5.3508433e-05f, -0.058617294f, 16.40991f, 6.7494359e-05f, -0.072647847f, 19.904095f, \
+    -0.0001098312f, 0.10600212f, -24.646719f, -9.1099115e-05f, 0.087282777f, -20.019211f, -7.5508826e-05f, 0.071693279f, \
+    -16.161196f, -6.2273393e-05f, 0.058453929f, -12.882075f, -5.0834118e-05f, 0.047010507f, -10.046191f, -4.0776154e-05f, \
+    0.03695086f, -7.5524735f, -3.1776592e-05f, 0.027953552f, -5.3219256f, -2.3569535e-05f, 0.019753318f, -3.2891865f, \
+    -1.591926e-05f, 0.012114432f, -1.3960074f, -8.5951733e-06f, 0.004805712f, 0.41490519f, -1.342667e-06f, -0.0024286485f, \
+    2.2071192f, 6.1546129e-06f, -0.0099069718f, 4.0598931f, 1.4312326e-05f, -0.018047659f, 6.0774989f, 2.3660408e-05f, \
+    -0.027383665f, 8.3927288f, 3.4876291e-05f, -0.038595106f, 11.174898f, 4.8898364e-05f, -0.052622378f, 14.657882f, \
+    -0.00013696424f, 0.13446088f, -31.919527f, -0.00011693678f, 0.11444578f, -26.976009f, -0.00010028662f, 0.097801313f, \
+    -22.86183f, -8.6161832e-05f, 0.083680898f, -19.369619f, -7.3963689e-05f, 0.071489267f, -16.353474f, -6.3252817e-05f, \
+    0.06078925f, -13.706144f, -5.3692329e-05f, 0.051245332f, -11.345216f, -4.5010551e-05f, 0.042586617f, -9.2040405f, \
+    -3.6974059e-05f, 0.034579996f, -7.2251568f, -2.9364452e-05f, 0.027006997f, -5.3545918f, -2.1953236e-05f, 0.019638682f, \
+    -3.5356581f, -1.4467159e-05f, 0.012200872f, -1.7003299f, -6.5319946e-06f, 0.0043177688f, 0.24475971f, 2.4155333e-06f, \
+    -0.0045762677f, 2.4402184f, 1.3219326e-05f, -0.015327677f, 5.0963554f, 2.7095775e-05f, -0.029153727f, 8.5152216f, \
+    -0.00017295824f, 0.17203115f, -41.479477f, -0.00015059084f, 0.1496678f, -35.959682f, -0.0001321306f, 0.13121438f, \
+    -31.403393f, -0.0001165666f, 0.11566264f, -27.563009f, -0.00010320052f, 0.10231617f, -24.267471f, -9.1528658e-05f, \
+    0.090672523f, -21.393332f, -8.1172097e-05f, 0.080353677f, -18.847673f, -7.1832452e-05f, 0.071061887f, -16.557268f, \
+    -6.3261374e-05f, 0.062549233f, -14.461094f, -5.5236418e-05f, 0.054593578f, -12.504424f, -4.7537833e-05f, 0.046975363f, \
+    -10.633095f, -3.9919236e-05f, 0.039448265f, -8.7862663f, -3.2060128e-05f, 0.031691689f, -6.884655f, -2.3473811e-05f, \
+    0.023218615f, -4.8077083f, -1.3313966e-05f, 0.013182304f, -2.3457682f, -2.4972094e-08f, 2.8260767e-05f, 0.88586324f, \
+    -1.5655676e-05f, -0.031790555f, 18.986574f, 0.00025509472f, -0.29796067f, 84.234497f, 0.00028927144f, -0.33078572f, \
+    92.114075f, 0.00030716771f, -0.34760937f, 96.071335f, 0.00032067316f, -0.36026323f, 99.039566f, 0.00033280579f, \
+    -0.37173495f, 101.75604f, 0.00034486427f, -0.383304f, 104.53516f, 0.00035758709f, -0.39569741f, 107.5555f, \
+    0.00037151473f, -0.40945089f, 110.94948f, 0.00038714698f, -0.42506614f, 114.84263f, 0.00040502998f, -0.44309875f, \
+    119.37556f, 0.00042582458f, -0.46422762f, 124.7216f, 0.00045038565f, -0.48933718f, 131.10793f, 0.00047987871f, \
+    -0.51963836f, 138.84671f, 0.00051597139f, -0.55686879f, 148.38698f, 0.00056117243f, -0.60364717f, 160.40656f, \
+    0.00010057018f, -0.13243231f, 40.611679f, 0.00017455188f, -0.20576538f, 58.723442f, 0.00020103886f, -0.23184393f, \
+    65.129837f, 0.00021805141f, -0.24851903f, 69.211746f, 0.00023180725f, -0.2620084f, 72.516663f, 0.00024429639f, \
+    -0.27430266f, 75.540245f, 0.00025646802f, -0.28635201f, 78.519272f, 0.00026890542f, -0.29874185f, 81.599983f, \
+    0.00028204924f, -0.31191665f, 84.893982f, 0.00029629914f, -0.32628223f, 88.503769f, 0.00031207397f, -0.34226689f, \
+    92.538193f, 0.00032985985f, -0.36037022f, 97.124847f, 0.00035026128f, -0.38121611f, 102.42361f, 0.00037407089f, \
+    -0.40562469f, 108.64516f, 0.00040237521f, -0.43472236f, 116.07937f, 0.00043673054f, -0.47012463f, 125.14243f, \
+    8.7804961e-05f, -0.11346772f, 34.552254f, 0.00013224091f, -0.15770429f, 45.518692f, 0.00015435113f, -0.17967418f, \
+    50.959846f, 0.00016979349f, -0.1950008f, 54.75391f, 0.00018264793f, -0.20777208f, 57.91964f, 0.00019442693f, \
+    -0.219506f, 60.835957f, 0.0002058933f, -0.23096953f, 63.694653f, 0.00021753206f, -0.24265181f, 66.618416f, \
+    0.00022971691f, -0.25493133f, 69.702591f, 0.00024278759f, -0.26815397f, 73.034691f, 0.00025709698f, -0.28268057f, \
+    76.706436f, 0.00027304911f, -0.29892591f, 80.823616f, 0.00029113973f, -0.31740025f, 85.516701f, 0.00031200904f, \
+    -0.3387638f, 90.954803f, 0.00033651965f, -0.36390737f, 97.366379f, 0.00036588166f, -0.39408165f, 105.07249f, \
+    7.0478316e-05f, -0.0923649f, 28.500662f, 0.0001038091f, -0.12565163f, 36.774616f, 0.00012325434f, -0.14507037f, \
+    41.604607f, 0.00013747875f, -0.15927552f, 45.139862f, 0.00014949906f, -0.17129323f, 48.134991f, 0.00016057034f, \
+    -0.18238528f, 50.905323f, 0.00017135323f, -0.19321729f, 53.617565f, 0.00018227672f, -0.2042228f, 56.380611f, \
+    0.0001936756f, -0.2157414f, 59.280083f, 0.00020585589f, -0.22808474f, 62.394863f, 0.00021913528f, -0.24157754f, \
+    65.807426f, 0.00023387639f, -0.25659144f, 69.612404f, 0.00025052234f, -0.27358148f, 73.925926f, 0.00026964271f, \
+    -0.29313341f, 78.897629f, 0.00029200065f, -0.31603271f, 84.728424f, 0.000318659f, -0.34337401f, 91.698441f, \
+    5.4308384e-05f, -0.07353431f, 23.264135f, 8.1962491e-05f, -0.10121859f, 30.158934f, 9.9713579e-05f, -0.11900306f, \
+    34.594273f, 0.00011307307f, -0.13239455f, 37.937481f, 0.0001244446f, -0.14380603f, 40.790405f, 0.0001349353f, \
+    -0.15435174f, 43.431683f, 0.0001451507f, -0.16464263f, 46.014435f, 0.00015548996f, -0.17508249f, 48.640148f, \
+    0.00016626698f, -0.18598987f, 51.389164f, 0.00017776997f, -0.19765832f, 54.335751f, 0.00019029889f, -0.21039411f, \
+    57.557625f, 0.00020419667f, -0.22454818f, 61.144024f, 0.00021988283f, -0.24055044f, 65.204437f, 0.00023789737f, \
+    -0.25895482f, 69.880074f, 0.00025896472f, -0.28050491f, 75.360641f, 0.0002840946f, -0.30623749f, 81.910782f, \
+    3.9263847e-05f, -0.05644381f, 18.599325f, 6.3582826e-05f, -0.080834977f, 24.682676f, 8.0257269e-05f, -0.097579181f, \
+    28.866085f, 9.3044604e-05f, -0.11042982f, 32.080795f, 0.00010394748f, -0.12139809f, 34.828388f, 0.00011398818f, \
+    -0.13151368f, 37.366425f, 0.00012374816f, -0.14136371f, 39.842113f, 0.00013361523f, -0.15134074f, 42.354149f, \
+    0.00014389532f, -0.16175535f, 44.980846f, 0.00015487001f, -0.17289416f, 47.794685f, 0.00016683311f, -0.18505694f, \
+    50.871643f, 0.00018012176f, -0.19858818f, 54.299198f, 0.00019515034f, -0.21391171f, 58.185089f, 0.00021245501f, \
+    -0.23157632f, 62.668949f, 0.0002327595f, -0.25232303f, 67.939392f, 0.00025707949f, -0.27719194f, 74.261292f, \
+    2.4779976e-05f, -0.040284034f, 14.251027f, 4.7012742e-05f, -0.062615581f, 19.826441f, 6.3035302e-05f, -0.078732491f, \
+    23.858059f, 7.5502736e-05f, -0.0912847f, 27.002409f, 8.6105123e-05f, -0.10196938f, 29.682514f, 9.5816758e-05f, \
+    -0.11176835f, 32.143955f, 0.0001052184f, -0.12126836f, 34.533867f, 0.00011470197f, -0.13086632f, 36.952034f, \
+    0.0001245765f, -0.14087595f, 39.477539f, 0.00013512594f, -0.15158619f, 42.183392f, 0.0001466471f, -0.16329952f, \
+    45.146191f, 0.00015948192f, -0.17636488f, 48.454403f, 0.00017405354f, -0.19121434f, 52.217674f, 0.0001909141f, \
+    -0.20841186f, 56.579227f, 0.00021081646f, -0.22872655f, 61.734428f, 0.00023482957f, -0.25325042f, 67.960732f, \
+    1.0273175e-05f, -0.024331735f, 10.009019f, 3.1199943e-05f, -0.045375608f, 15.266601f, 4.6876045e-05f, -0.061163891f, \
+    19.219147f, 5.9252317e-05f, -0.073641248f, 22.34754f, 6.972369e-05f, -0.084207349f, 25.000193f, 7.9225683e-05f, \
+    -0.093805037f, 27.41283f, 8.8356755e-05f, -0.10303915f, 29.737104f, 9.7528049e-05f, -0.11232615f, 32.077698f, \
+    0.00010706278f, -0.12199418f, 34.517288f, 0.00011725618f, -0.13234349f, 37.131683f, 0.00012841633f, -0.14368774f, \
+    40.000217f, 0.00014089956f, -0.15639009f, 43.21484f, 0.00015515012f, -0.17090341f, 46.890301f, 0.00017175432f, \
+    -0.18782549f, 51.178104f, 0.0001915225f, -0.20798233f, 56.287666f, 0.00021562411f, -0.23256597f, 62.521214f, \
+    -4.8431762e-06f, -0.0079094479f, 5.685627f, 1.5339327e-05f, -0.02822257f, 10.762596f, 3.0907911e-05f, -0.043916829f, \
+    14.693277f, 4.3396481e-05f, -0.056519713f, 17.854717f, 5.3921973e-05f, -0.067150168f, 20.524828f, 6.3348591e-05f, \
+    -0.076678619f, 22.920971f, 7.2299612e-05f, -0.085735016f, 25.201021f, 8.122094e-05f, -0.09477111f, 27.478481f, \
+    9.046308e-05f, -0.10414267f, 29.842941f, 0.00010034281f, -0.11417168f, 32.375629f, 0.00011118854f, -0.12519227f, \
+    35.160954f, 0.00012338067f, -0.13759163f, 38.29681f, 0.00013739758f, -0.15185666f, 41.906361f, 0.00015387876f, \
+    -0.16863817f, 46.15427f, 0.00017372351f, -0.1888511f, 51.272022f, 0.00019825748f, -0.21384364f, 57.600739f, \
+    -2.1223723e-05f, 0.0097050294f, 1.0877124f, -1.3231548e-06f, -0.010336575f, 6.0971637f, 1.4364456e-05f, -0.026160369f, \
+    10.060607f, 2.7136964e-05f, -0.039057951f, 13.296365f, 3.7914506e-05f, -0.049949519f, 16.032406f, 4.7435951e-05f, \
+    -0.059577983f, 18.453815f, 5.6320667e-05f, -0.06856896f, 20.717188f, 6.5059125e-05f, -0.077419288f, 22.947273f, \
+    7.4045318e-05f, -0.086528815f, 25.244682f, 8.3631261e-05f, -0.096255191f, 27.699556f, 9.4177267e-05f, -0.10696471f, \
+    30.404322f, 0.00010609951f, -0.11908045f, 33.465794f, 0.00011992508f, -0.13313815f, 37.019268f, 0.00013636933f, \
+    -0.1498646f, 41.248283f, 0.00015645949f, -0.17030278f, 46.41621f, 0.00018175073f, -0.19603099f, 52.921528f, \
+    -3.9694165e-05f, 0.029395791f, -4.0152817f, -1.9637568e-05f, 0.0091901878f, 1.0336927f, -3.5775822e-06f, -0.0070142029f, \
+    5.0913029f, 9.650249e-06f, -0.02037554f, 8.4425001f, 2.0863172e-05f, -0.031710092f, 11.289055f, 3.0689513e-05f, \
+    -0.041648243f, 13.78754f, 3.9676841e-05f, -0.050742041f, 16.075779f, 4.83316e-05f, -0.059504107f, 18.282293f, \
+    5.7103327e-05f, -0.068390496f, 20.521729f, 6.6398592e-05f, -0.077814154f, 22.898052f, 7.6626624e-05f, -0.088190794f, \
+    25.516037f, 8.8255169e-05f, -0.099995479f, 28.495443f, 0.00010187893f, -0.11383181f, 31.988447f, 0.00011831785f, \
+    -0.13053143f, 36.204674f, 0.00013877921f, -0.15131788f, 41.452435f, 0.00016515276f, -0.17810477f, 48.213799f, \
+    -6.1420062e-05f, 0.052387882f, -9.9374638f, -4.0724673e-05f, 0.031538278f, -4.7314391f, -2.3977622e-05f, 0.014640963f, \
+    -0.50339961f, -1.0074606e-05f, 0.00059847179f, 3.0160921f, 1.7577379e-06f, -0.011360769f, 6.0173144f, 1.2098088e-05f, \
+    -0.021816306f, 8.6438007f, 2.142182e-05f, -0.031246172f, 11.014476f, 3.0174589e-05f, -0.04010044f, 13.241835f, \
+    3.8819173e-05f, -0.048848096f, 15.443552f, 4.7828733e-05f, -0.057969473f, 17.740414f, 5.7687626e-05f, -0.067956388f, \
+    20.256208f, 6.8940433e-05f, -0.079361454f, 23.130047f, 8.22765e-05f, -0.092883527f, 26.537804f, 9.8659875e-05f, \
+    -0.10949882f, 30.725058f, 0.00011955172f, -0.13068531f, 36.063419f, 0.00014733661f, -0.1588524f, 43.15839f, \
+    -8.8226443e-05f, 0.080577396f, -17.159424f, -6.6270004e-05f, 0.058466081f, -11.645936f, -4.8402399e-05f, 0.040445954f, \
+    -7.1429272f, -3.3509194e-05f, 0.025410797f, -3.3796031f, -2.081295e-05f, 0.012586019f, -0.16550109f, -9.7409193e-06f, \
+    0.0013989784f, 2.6407633f, 1.5870415e-07f, -0.0086036073f, 5.1515541f, 9.2788914e-06f, -0.017817417f, 7.4653654f, \
+    1.8012526e-05f, -0.026639482f, 9.6814413f, 2.6816384e-05f, -0.035532739f, 11.915899f, 3.6248133e-05f, -0.045063082f, \
+    14.310937f, 4.6969515e-05f, -0.055901691f, 17.035263f, 5.9811227e-05f, -0.068889916f, 20.300243f, 7.5941447e-05f, \
+    -0.08520899f, 24.402395f, 9.7186108e-05f, -0.10670231f, 29.80409f, 0.00012668496f, -0.13653487f, 37.298592f, \
+    -0.00012330795f, 0.11725701f, -26.508396f, -9.9138822e-05f, 0.092941053f, -20.45911f, -7.9478377e-05f, 0.073133148f, \
+    -15.520396f, -6.310139e-05f, 0.056618437f, -11.395836f, -4.9166225e-05f, 0.042559851f, -7.8803983f, -3.7063015e-05f, \
+    0.030348921f, -4.8244581f, -2.6324349e-05f, 0.019517887f, -2.1125524f, -1.6565005e-05f, 0.0096800784f, 0.35112032f, \
+    -7.4326344e-06f, 0.00048075631f, 2.6547835f, 1.4461489e-06f, -0.0084570842f, 4.89254f, 1.0544863e-05f, -0.017612634f, \
+    7.1843529f, 2.0558216e-05f, -0.027689639f, 9.7066889f, 3.2513566e-05f, -0.039728083f, 12.720338f, 4.7898233e-05f, \
+    -0.055230394f, 16.601641f, 6.9088266e-05f, -0.07659103f, 21.94957f, 0.00010043207f, -0.10818241f, 29.85659f, \
+    -0.0001732002f, 0.16912663f, -39.656883f, -0.00014497477f, 0.14077297f, -32.627045f, -0.00012227391f, 0.11794341f, \
+    -26.95516f, -0.00010352872f, 0.099079341f, -22.260933f, -8.7706154e-05f, 0.083153546f, -18.293402f, -7.4084142e-05f, \
+    0.069446988f, -14.876521f, -6.2128631e-05f, 0.057426821f, -11.879481f, -5.141928e-05f, 0.046672784f, -9.1987963f, \
+    -4.1597785e-05f, 0.036825873f, -6.7457867f, -3.2322248e-05f, 0.027542813f, -4.4353895f, -2.3210941e-05f, 0.018439563f, \
+    -2.1721506f, -1.3745073e-05f, 0.008993295f, 0.17421532f, -3.0557076e-06f, -0.001672641f, 2.8225336f, 1.0558379e-05f, \
+    -0.015274348f, 6.2013698f, 3.03956e-05f, -0.035131976f, 11.138913f, 6.293827e-05f, -0.067747407f, 19.253592f, \
+    -0.00025507095f, 0.25374147f, -60.9743f, -0.00021786074f, 0.21640554f, -51.752712f, -0.00018895864f, 0.18739919f, \
+    -44.579449f, -0.00016574103f, 0.16410145f, -38.812531f, -0.00014659821f, 0.14490509f, -34.058422f, -0.00013047371f, \
+    0.12875582f, -30.059025f, -0.00011663223f, 0.11492012f, -26.634741f, -0.00010453154f, 0.10285743f, -23.653194f, \
+    -9.3744369e-05f, 0.092142075f, -21.010111f, -8.3902509e-05f, 0.082407676f, -18.615705f, -7.4645613e-05f, 0.073295899f, \
+    -16.382105f, -6.5553839e-05f, 0.064389221f, -14.206752f, -5.601962e-05f, 0.055082541f, -11.940654f, -4.4912715e-05f, \
+    0.044247471f, -9.3051958f, -2.941132e-05f, 0.029061295f, -5.6018734f, -6.9594805e-08f, 7.8760175e-05f, 1.5073233f, \
+    0.00012675575f, -0.18123472f, 58.107437f, 0.00032335464f, -0.37488657f, 105.70879f, 0.00035317687f, -0.40310401f, \
+    112.38772f, 0.00037073414f, -0.41940963f, 116.17783f, 0.0003849745f, -0.43269649f, 119.28327f, 0.00039858563f, \
+    -0.4456149f, 122.35625f, 0.0004128126f, -0.45938623f, 125.69595f, 0.00042843557f, -0.47477829f, 129.49106f, \
+    0.00044611786f, -0.49245343f, 133.90666f, 0.00046656598f, -0.51312917f, 139.12434f, 0.00049063459f, -0.53768539f, \
+    145.36945f, 0.00051944173f, -0.56728297f, 152.94157f, 0.0005545406f, -0.60354376f, 162.26126f, 0.0005982102f, \
+    -0.64885521f, 173.94928f, 0.00065399212f, -0.70693529f, 188.97417f, 0.00072777545f, -0.78397495f, 208.95059f, \
+    0.00016259514f, -0.20011704f, 59.028885f, 0.00022067175f, -0.25775659f, 73.29718f, 0.00024536171f, -0.28207019f, \
+    79.278183f, 0.00026289729f, -0.29930887f, 83.514885f, 0.00027792345f, -0.31412897f, 87.169891f, 0.00029215706f, \
+    -0.32825169f, 90.67305f, 0.00030650679f, -0.34258971f, 94.252747f, 0.00032159145f, -0.35776755f, 98.065971f, \
+    0.00033793729f, -0.37432024f, 102.2482f, 0.00035608033f, -0.39279717f, 106.93952f, 0.00037663814f, -0.41383553f, \
+    112.30343f, 0.00040038273f, -0.43823555f, 118.54613f, 0.00042833845f, -0.46706259f, 125.94288f, 0.00046193463f, \
+    -0.50180632f, 134.87936f, 0.00050326681f, -0.54465383f, 145.92261f, 0.00055557606f, -0.59899151f, 159.95137f, \
+    0.00013305039f, -0.16352147f, 48.370041f, 0.00017072921f, -0.20115027f, 57.737347f, 0.00019172243f, -0.2220826f, \
+    62.94529f, 0.00020772111f, -0.23804621f, 66.922073f, 0.00022179171f, -0.25212479f, 70.439476f, 0.00023520565f, \
+    -0.26559898f, 73.818596f, 0.00024867908f, -0.27919233f, 77.241341f, 0.00026272074f, -0.29342109f, 80.838127f, \
+    0.00027777077f, -0.3087346f, 84.723053f, 0.00029427628f, -0.32559168f, 89.013283f, 0.00031274697f, -0.34451795f, \
+    93.843567f, 0.00033381209f, -0.36616421f, 99.381264f, 0.00035829385f, -0.39138284f, 105.84602f, 0.00038731904f, \
+    -0.42134365f, 113.53971f, 0.00042250199f, -0.45772436f, 122.89573f, 0.00046626775f, -0.50304723f, 134.56613f, \
+    0.00010909609f, -0.13539577f, 40.47506f, 0.00013863317f, -0.16502711f, 47.880981f, 0.00015726518f, -0.183727f, \
+    52.560581f, 0.00017200084f, -0.19853717f, 56.273788f, 0.00018515042f, -0.21178544f, 59.603985f, 0.00019775373f, \
+    -0.22452176f, 62.814919f, 0.00021042084f, -0.23736416f, 66.062302f, 0.00022359741f, -0.25076595f, 69.460854f, \
+    0.00023767551f, -0.26512787f, 73.112427f, 0.00025305586f, -0.28086123f, 77.122032f, 0.00027019571f, -0.29843697f, \
+    81.610268f, 0.00028965852f, -0.31843665f, 86.726433f, 0.00031217848f, -0.34161946f, 92.665688f, 0.00033875686f, \
+    -0.36902165f, 99.694748f, 0.00037081822f, -0.40211868f, 108.19364f, 0.00041048185f, -0.44310689f, 118.72845f, \
+    8.9483452e-05f, -0.11293214f, 34.291973f, 0.00011478021f, -0.13839643f, 40.675213f, 0.00013189037f, -0.1556423f, \
+    45.006992f, 0.0001457058f, -0.16959035f, 48.517841f, 0.00015812926f, -0.18216054f, 51.689381f, 0.00017007494f, \
+    -0.1942776f, 54.754169f, 0.00018209519f, -0.20650198f, 57.853577f, 0.00019460121f, -0.21925248f, 61.09367f, \
+    0.00020795972f, -0.23290411f, 64.569801f, 0.00022254883f, -0.24784483f, 68.380951f, 0.00023880243f, -0.26452097f, \
+    72.641296f, 0.00025725726f, -0.28348559f, 77.492577f, 0.00027861536f, -0.30546296f, 83.120621f, 0.00030383692f, \
+    -0.33144429f, 89.779961f, 0.00033429149f, -0.36284405f, 97.834045f, 0.0003720205f, -0.4017714f, 107.82507f, \
+    7.2359988e-05f, -0.093682118f, 29.076746f, 9.5233692e-05f, -0.11676965f, 34.877357f, 0.00011139525f, -0.1331104f, \
+    38.992722f, 0.00012458027f, -0.14646488f, 42.363495f, 0.00013646416f, -0.15852563f, 45.414516f, 0.00014789934f, \
+    -0.17015602f, 48.363079f, 0.00015941213f, -0.18189071f, 51.344166f, 0.00017139893f, -0.19413376f, 54.46014f, \
+    0.00018421665f, -0.20725018f, 57.803795f, 0.00019823636f, -0.22162053f, 61.472172f, 0.00021388705f, -0.23768559f, \
+    65.577904f, 0.00023170363f, -0.25599572f, 70.261826f, 0.00025239124f, -0.27727693f, 75.709877f, 0.00027692251f, \
+    -0.30253106f, 82.178825f, 0.00030669762f, -0.33320069f, 90.038536f, 0.00034382541f, -0.37145895f, 99.846367f, \
+    5.644613e-05f, -0.076078489f, 24.374941f, 7.7939163e-05f, -0.097820386f, 29.847223f, 9.359447e-05f, -0.11368814f, \
+    33.851555f, 0.00010640186f, -0.12669255f, 37.140896f, 0.00011791263f, -0.13840213f, 40.109104f, 0.00012896318f, \
+    -0.14966498f, 42.969738f, 0.00014007904f, -0.16101539f, 45.85775f, 0.0001516578f, -0.17285891f, 48.875893f, \
+    0.00016405896f, -0.18556313f, 52.117603f, 0.00017765859f, -0.19951357f, 55.681107f, 0.00019289505f, -0.21516018f, \
+    59.681259f, 0.0002103204f, -0.23307016f, 64.262993f, 0.0002306706f, -0.25399995f, 69.619751f, 0.00025497415f, \
+    -0.27900684f, 76.021996f, 0.00028473386f, -0.30963585f, 83.865105f, 0.00032225327f, -0.3482551f, 93.755203f, \
+    4.0778104e-05f, -0.058994547f, 19.870409f, 6.1580453e-05f, -0.080076277f, 25.183935f, 7.7113866e-05f, -0.095851913f, \
+    29.171247f, 8.9791392e-05f, -0.10875063f, 32.439289f, 0.00010109041f, -0.12026703f, 35.363338f, 0.00011186885f, \
+    -0.13127176f, 38.162712f, 0.00012267582f, -0.14232349f, 40.978542f, 0.00013392605f, -0.1538454f, 43.918053f, \
+    0.00014599343f, -0.16621983f, 47.078381f, 0.00015927007f, -0.17984846f, 50.561806f, 0.00017421655f, -0.19520365f, \
+    54.48877f, 0.00019141921f, -0.21288703f, 59.012806f, 0.00021167115f, -0.23371252f, 64.341728f, 0.00023609983f, \
+    -0.2588371f, 70.771011f, 0.00026638666f, -0.28998601f, 78.741333f, 0.00030517328f, -0.32986912f, 88.944962f, \
+    2.4485329e-05f, -0.041453063f, 15.297455f, 4.5122815e-05f, -0.062399428f, 20.582415f, 6.0890943e-05f, -0.078439601f, \
+    24.641359f, 7.3716095e-05f, -0.091510534f, 27.957331f, 8.498611e-05f, -0.10301613f, 30.882589f, 9.5608128e-05f, \
+    -0.11387744f, 33.649132f, 0.00010618199f, -0.12470517f, 36.411247f, 0.00011715874f, -0.13595963f, 39.285538f, \
+    0.00012894045f, -0.14805196f, 42.376419f, 0.00014194711f, -0.16141225f, 45.793308f, 0.0001566745f, -0.1765485f, \
+    49.665607f, 0.00017376139f, -0.1941154f, 54.160168f, 0.00019408645f, -0.21501336f, 59.50655f, 0.00021892576f, \
+    -0.24054979f, 66.038101f, 0.00025023325f, -0.27272585f, 74.265068f, 0.00029118039f, -0.31478843f, 85.015366f, \
+    6.6030607e-06f, -0.022406962f, 10.3793f, 2.7562939e-05f, -0.04370673f, 15.757241f, 4.3901066e-05f, -0.060348488f, \
+    19.971811f, 5.720391e-05f, -0.073924936f, 23.41923f, 6.8690497e-05f, -0.08566767f, 26.407913f, 7.9304955e-05f, \
+    -0.096535258f, 29.17915f, 8.9726411e-05f, -0.10721941f, 31.907633f, 0.00010046842f, -0.11824436f, 34.726128f, \
+    0.00011198028f, -0.13006955f, 37.75124f, 0.00012472492f, -0.14316884f, 41.103432f, 0.00013924864f, -0.1581016f, \
+    44.925034f, 0.00015626328f, -0.17559664f, 49.401562f, 0.00017676684f, -0.19667538f, 54.79303f, 0.00020224722f, \
+    -0.22285983f, 61.486885f, 0.0002350596f, -0.25655788f, 70.095978f, 0.00027919188f, -0.30184436f, 81.657349f, \
+    -1.414884e-05f, -0.00049818773f, 4.7641377f, 7.6846154e-06f, -0.02270647f, 10.373258f, 2.4954968e-05f, -0.040315121f, \
+    14.834519f, 3.90979e-05f, -0.054764017f, 18.505367f, 5.1154093e-05f, -0.067102239f, 21.647682f, 6.20028e-05f, \
+    -0.078221262f, 24.485363f, 7.2396404e-05f, -0.088887259f, 27.211748f, 8.2944003e-05f, -0.09972214f, 29.984236f, \
+    9.4172065e-05f, -0.11126427f, 32.939377f, 0.00010660922f, -0.12405461f, 36.214584f, 0.00012087272f, -0.13872488f, \
+    39.970409f, 0.00013777283f, -0.15610389f, 44.417564f, 0.00015846967f, -0.17737757f, 49.857491f, 0.00018474799f, \
+    -0.20436895f, 56.753464f, 0.0002195534f, -0.24008432f, 65.869232f, 0.00026815609f, -0.2898981f, 78.569839f, \
+    -3.9741819e-05f, 0.026337203f, -2.0761864f, -1.6302542e-05f, 0.0024818049f, 3.9477403f, 2.4007322e-06f, -0.01659959f, \
+    8.7816963f, 1.778962e-05f, -0.032331675f, 12.778594f, 3.0850057e-05f, -0.045706663f, 16.185394f, 4.234655e-05f, \
+    -0.057497535f, 19.195488f, 5.2978779e-05f, -0.068415463f, 21.98782f, 6.3433166e-05f, -0.079160981f, 24.739458f, \
+    7.43528e-05f, -0.090391777f, 27.617069f, 8.6371816e-05f, -0.1027568f, 30.785339f, 0.00010021099f, -0.11699345f, \
+    34.431499f, 0.00011681367f, -0.13406605f, 38.800377f, 0.00013755761f, -0.15538153f, 44.249039f, 0.0001646426f, \
+    -0.1831837f, 51.346657f, 0.00020189809f, -0.22137411f, 61.082424f, 0.00025669453f, -0.27745324f, 75.357109f, \
+    -7.3649906e-05f, 0.061708994f, -11.058547f, -4.7468868e-05f, 0.035061862f, -4.3363848f, -2.6531523e-05f, 0.013698945f, \
+    1.0710694f, -9.296843e-06f, -0.0039223223f, 5.5447693f, 5.279865e-06f, -0.018851828f, 9.3452339f, 1.7960127e-05f, \
+    -0.031857789f, 12.663939f, 2.936029e-05f, -0.043564543f, 15.657238f, 4.0070288e-05f, -0.054572433f, 18.476263f, \
+    5.0762341e-05f, -0.065568231f, 21.294683f, 6.2210493e-05f, -0.07734409f, 24.313286f, 7.5300239e-05f, -0.090806082f, \
+    27.761881f, 9.1165231e-05f, -0.10711275f, 31.934233f, 0.00011147697f, -0.12796965f, 37.262486f, 0.00013901666f, \
+    -0.15620999f, 44.46389f, 0.00017896887f, -0.19710641f, 54.872162f, 0.00024236977f, -0.2618638f, 71.319328f, \
+    -0.00012297349f, 0.11295383f, -24.034647f, -9.1958151e-05f, 0.081415132f, -16.098303f, -6.7315654e-05f, 0.056290835f, \
+    -9.7523451f, -4.716191e-05f, 0.03570015f, -4.5348954f, -3.0250067e-05f, 0.018392777f, -0.1371474f, -1.5706019e-05f, \
+    0.0034890173f, 3.6591678f, -2.8732154e-06f, -0.0096741049f, 7.0192423f, 8.7919834e-06f, -0.021647438f, 10.080916f, \
+    1.9813659e-05f, -0.032963969f, 12.978165f, 3.0821611e-05f, -0.044266436f, 15.873233f, 4.2745622e-05f, -0.056505658f, \
+    19.006779f, 5.6982153e-05f, -0.07110931f, 22.740326f, 7.5627686e-05f, -0.090216391f, 27.614969f, 0.00010228071f, \
+    -0.11748911f, 34.555782f, 0.00014425103f, -0.16034797f, 45.43449f, 0.0002195592f, -0.23703939f, 64.847275f, \
+    -0.00020553988f, 0.19835417f, -45.574287f, -0.00016481233f, 0.15707463f, -35.250114f, -0.00013316829f, 0.12490115f, \
+    -27.165718f, -0.00010777565f, 0.099024646f, -20.639221f, -8.686004e-05f, 0.077676907f, -15.23862f, -6.9228416e-05f, \
+    0.059663352f, -10.670154f, -5.4033546e-05f, 0.044132661f, -6.7234287f, -4.0634492e-05f, 0.030439137f, -3.2382433f, \
+    -2.8501327e-05f, 0.018047836f, -0.08143466f, -1.7131424e-05f, 0.0064503504f, 2.8739805f, -5.9400991e-06f, -0.0049460297f, \
+    5.7765388f, 5.9627605e-06f, -0.017045846f, 8.8536358f, 2.0396656e-05f, -0.031701285f, 12.571853f, 4.1799602e-05f, \
+    -0.053428017f, 18.068834f, 8.0912447e-05f, -0.093116224f, 28.082108f, 0.00017074209f, -0.18407501f, 50.961365f, \
+    -0.00039174058f, 0.3894349f, -93.332687f, -0.00031974021f, 0.31692308f, -75.417801f, -0.00026903336f, 0.26574755f, \
+    -62.722713f, -0.00023103878f, 0.22733356f, -53.15662f, -0.00020143107f, 0.1973687f, -45.670536f, -0.00017774887f, \
+    0.17340271f, -39.669147f, -0.00015846142f, 0.15391362f, -34.782749f, -0.00014255207f, 0.13789292f, -30.766533f, \
+    -0.00012930558f, 0.1246346f, -27.44957f, -0.00011818344f, 0.11361222f, -24.705189f, -0.0001087321f, 0.10438935f, \
+    -22.42956f, -0.00010047899f, 0.096518315f, -20.517395f, -9.2736329e-05f, 0.089348108f, -18.815363f, -8.4017855e-05f, \
+    0.081446752f, -16.980495f, -6.9169582e-05f, 0.067734361f, -13.771824f, -2.9997059e-07f, 0.00033947596f, 2.6497443f, \
+    0.00021730419f, -0.27761653f, 83.66011f, 0.00036933494f, -0.42700386f, 120.315f, 0.00039748187f, -0.45331797f, \
+    126.46904f, 0.00041494242f, -0.46937725f, 130.16483f, 0.00042971215f, -0.48311082f, 133.36444f, 0.00044436316f, \
+    -0.49704477f, 136.68745f, 0.00046012746f, -0.51238263f, 140.42758f, 0.00047783527f, -0.52994162f, 144.78584f, \
+    0.00049826212f, -0.55050009f, 149.95726f, 0.00052229274f, -0.57496285f, 156.17241f, 0.00055104971f, -0.6044929f, \
+    163.73103f, 0.00058606162f, -0.64068663f, 173.04753f, 0.00062953925f, -0.68586409f, 184.72655f, 0.00068487308f, \
+    -0.74359328f, 199.70032f, 0.00075761805f, -0.81973064f, 219.50131f, 0.00085766852f, -0.92472053f, 246.86557f, \
+    0.00019954829f, -0.24103005f, 70.299789f, 0.00025065715f, -0.29174185f, 82.858627f, 0.00027503291f, -0.31575671f, \
+    88.772697f, 0.00029319653f, -0.33365363f, 93.183815f, 0.00030922663f, -0.34952554f, 97.115372f, 0.00032475055f, \
+    -0.36500585f, 100.976f, 0.00034067882f, -0.3810111f, 104.99564f, 0.00035767155f, -0.39820999f, 109.34311f, \
+    0.00037633048f, -0.41721743f, 114.1749f, 0.00039730512f, -0.43870273f, 119.66267f, 0.00042137766f, -0.46347702f, \
+    126.01566f, 0.00044956116f, -0.49259555f, 133.5071f, 0.00048324541f, -0.52750999f, 142.51389f, 0.00052443886f, \
+    -0.57032222f, 153.58266f, 0.00057620462f, -0.62424219f, 167.54922f, 0.00064351328f, -0.69448376f, 185.77246f, \
+    0.00016106028f, -0.19484085f, 57.091892f, 0.00019577958f, -0.22957306f, 65.758415f, 0.00021670059f, -0.25048739f, \
+    70.978668f, 0.00023335908f, -0.26717255f, 75.15329f, 0.00024841935f, -0.28231266f, 78.955566f, 0.000263069f, \
+    -0.29710674f, 82.686905f, 0.00027802103f, -0.31227729f, 86.529625f, 0.00029381589f, -0.3283751f, 90.623474f, \
+    0.00031095251f, -0.34591198f, 95.099106f, 0.00032996727f, -0.36544111f, 100.0985f, 0.00035149904f, -0.38762435f, \
+    105.79221f, 0.00037636442f, -0.41331011f, 112.39945f, 0.00040566485f, -0.44364494f, 120.21703f, 0.00044095807f, \
+    -0.48025271f, 129.66586f, 0.00048455541f, -0.52554494f, 141.37161f, 0.00054007472f, -0.58329934f, 156.31522f, \
+    0.00013379517f, -0.16315153f, 48.249939f, 0.0001615878f, -0.19111115f, 55.26218f, 0.0001802317f, -0.20989037f, \
+    59.981598f, 0.00019560751f, -0.22541389f, 63.893486f, 0.00020971311f, -0.23969944f, 67.504906f, 0.00022350883f, \
+    -0.25371945f, 71.060883f, 0.00023759836f, -0.2680876f, 74.71666f, 0.00025245411f, -0.28328654f, 78.594948f, \
+    0.00026852035f, -0.29977247f, 82.812325f, 0.0002862775f, -0.31804094f, 87.495918f, 0.00030629878f, -0.33868495f, \
+    92.798378f, 0.00032931619f, -0.36246338f, 98.915428f, 0.00035631383f, -0.39039806f, 106.11096f, 0.00038867598f, \
+    -0.4239274f, 114.7569f, 0.00042843953f, -0.46516961f, 125.40124f, 0.00047875557f, -0.51740336f, 138.89284f, \
+    0.00011273545f, -0.13915582f, 41.669243f, 0.00013684291f, -0.16351068f, 47.80056f, 0.00015399915f, -0.18087807f, \
+    52.184772f, 0.00016843381f, -0.19552597f, 55.892933f, 0.00018179334f, -0.20912032f, 59.344257f, 0.0001949147f, \
+    -0.2225104f, 62.753071f, 0.00020834114f, -0.23624949f, 66.259552f, 0.00022250849f, -0.25078353f, 69.977188f, \
+    0.00023783343f, -0.26654062f, 74.015396f, 0.00025477138f, -0.28399026f, 78.494598f, 0.00027386949f, -0.30369788f, \
+    83.560158f, 0.00029583031f, -0.32639059f, 89.399323f, 0.00032160257f, -0.35305125f, 96.265465f, 0.00035252571f, \
+    -0.38506833f, 104.51679f, 0.00039057614f, -0.42449158f, 114.68244f, 0.00043881987f, -0.47450188f, 127.58392f, \
+    9.506206e-05f, -0.11936545f, 36.32869f, 0.0001170772f, -0.14168236f, 41.963894f, 0.00013329407f, -0.15816124f, \
+    46.13792f, 0.00014707855f, -0.17220293f, 49.704876f, 0.00015989075f, -0.18528721f, 53.037518f, 0.00017250596f, \
+    -0.19820201f, 56.334927f, 0.00018543881f, -0.2114723f, 59.730232f, 0.00019910923f, -0.22552808f, 63.332943f, \
+    0.00021392445f, -0.24078786f, 67.250031f, 0.00023033476f, -0.25771567f, 71.600449f, 0.00024888662f, -0.27687564f, \
+    76.529091f, 0.00027028832f, -0.29899976f, 82.224197f, 0.00029550566f, -0.32508671f, 88.942833f, 0.00032591596f, \
+    -0.35656145f, 97.051941f, 0.00036357431f, -0.39555046f, 107.09943f, 0.00041170986f, -0.4453958f, 119.94668f, \
+    7.9122918e-05f, -0.10181212f, 31.667061f, 0.0001000221f, -0.12305891f, 37.045506f, 0.00011572862f, -0.1390693f, \
+    41.112164f, 0.00012911228f, -0.15274599f, 44.596386f, 0.00014154975f, -0.16548605f, 47.850395f, 0.00015379967f, \
+    -0.17806159f, 51.069454f, 0.00016637241f, -0.19099382f, 54.385841f, 0.00017968837f, -0.20471355f, 57.909306f, \
+    0.00019415948f, -0.21964419f, 61.74807f, 0.00021024629f, -0.23626013f, 66.023682f, 0.0002285142f, -0.25514457f, \
+    70.885803f, 0.00024970528f, -0.27706346f, 76.531189f, 0.00027484546f, -0.30307615f, 83.232124f, 0.00030542078f, \
+    -0.33471733f, 91.38324f, 0.00034368888f, -0.37431866f, 101.58429f, 0.00039327506f, -0.42562449f, 114.79866f, \
+    6.3767409e-05f, -0.085170686f, 27.316282f, 8.4260755e-05f, -0.10605736f, 32.614861f, 9.9847915e-05f, -0.12198953f, \
+    36.671345f, 0.00011306949f, -0.13553862f, 40.131901f, 0.00012529218f, -0.14809316f, 43.346809f, 0.00013729784f, \
+    -0.16044992f, 46.517704f, 0.00014961597f, -0.17315014f, 49.782024f, 0.00016268301f, -0.18664135f, 53.253819f, \
+    0.00017692863f, -0.20136528f, 57.045967f, 0.00019283756f, -0.21782106f, 61.286308f, 0.00021101229f, -0.23662972f, \
+    66.134087f, 0.00023225546f, -0.25861892f, 71.801697f, 0.00025769655f, -0.28495345f, 78.588173f, 0.00028900555f, \
+    -0.31735545f, 86.935738f, 0.00032878402f, -0.35850742f, 97.533379f, 0.00038133981f, -0.41285068f, 111.52204f, \
+    4.8005728e-05f, -0.068341069f, 22.97979f, 6.8684574e-05f, -0.089463949f, 28.348097f, 8.4566811e-05f, -0.10573747f, \
+    32.500164f, 9.7895645e-05f, -0.119432f, 36.006119f, 0.00011007474f, -0.13197486f, 39.22612f, 0.0001219515f, \
+    -0.14423051f, 42.379051f, 0.00013410195f, -0.15678835f, 45.614632f, 0.00014699674f, -0.17013122f, 49.055927f, \
+    0.0001610975f, -0.18473382f, 52.824242f, 0.00017692779f, -0.20113519f, 57.05756f, 0.00019514619f, -0.22001384f, \
+    61.929771f, 0.00021664523f, -0.24228936f, 67.676643f, 0.00024270802f, -0.26928365f, 74.637192f, 0.00027528231f, \
+    -0.30300277f, 83.32592f, 0.00031750248f, -0.34667397f, 94.570641f, 0.00037477675f, -0.40586427f, 109.79945f, \
+    3.076169e-05f, -0.050165206f, 18.354265f, 5.2190924e-05f, -0.072098374f, 23.937143f, 6.884602e-05f, -0.089201443f, \
+    28.308725f, 8.2641061e-05f, -0.10340951f, 31.954033f, 9.5001094e-05f, -0.11617202f, 35.23864f, 0.00010688279f, \
+    -0.12846571f, 38.409916f, 0.00011894645f, -0.14096676f, 41.639671f, 0.00013172229f, -0.15421954f, 45.066654f, \
+    0.00014572243f, -0.16875081f, 48.825466f, 0.00016152664f, -0.18515752f, 53.068874f, 0.0001798717f, -0.20419849f, \
+    57.991238f, 0.00020177482f, -0.22692128f, 63.860928f, 0.0002287362f, -0.25487006f, 71.073601f, 0.00026310916f, \
+    -0.29046616f, 80.249588f, 0.00030884094f, -0.33776861f, 92.428757f, 0.0003731231f, -0.40416956f, 109.5049f, \
+    1.057186e-05f, -0.029102996f, 13.044505f, 3.3418255e-05f, -0.052528132f, 19.014568f, 5.1398223e-05f, -0.071028098f, \
+    23.750275f, 6.6177796e-05f, -0.08628431f, 27.671888f, 7.9079866e-05f, -0.099640764f, 31.117727f, 9.1172435e-05f, \
+    -0.11218821f, 34.363903f, 0.00010325076f, -0.12474166f, 37.6175f, 0.00011594578f, -0.13794932f, 41.043751f, \
+    0.00012984888f, -0.15241987f, 44.798164f, 0.00014561979f, -0.16883278f, 49.054607f, 0.0001641009f, -0.18805569f, \
+    54.035217f, 0.00018647774f, -0.21130912f, 60.052502f, 0.00021455201f, -0.24044658f, 67.580963f, 0.00025126661f, \
+    -0.27849337f, 77.394897f, 0.0003018289f, -0.33079851f, 90.863029f, 0.00037643846f, -0.40783182f, 110.66409f, \
+    -1.4947395e-05f, -0.0026742364f, 6.4205456f, 1.0287536e-05f, -0.028587105f, 13.030079f, 3.0309679e-05f, -0.049223565f, \
+    18.318647f, 4.6766898e-05f, -0.066245161f, 22.700621f, 6.0840823e-05f, -0.080849431f, 26.476368f, 7.3558011e-05f, \
+    -0.094083361f, 29.910299f, 8.5853491e-05f, -0.10690539f, 33.245781f, 9.8522083e-05f, -0.12013274f, 36.691086f, \
+    0.00011228713f, -0.13451049f, 40.436577f, 0.00012792714f, -0.1508411f, 44.687584f, 0.00014642754f, -0.17014003f, \
+    49.704052f, 0.00016919783f, -0.19385852f, 55.857426f, 0.00019845465f, -0.22427653f, 63.73098f, 0.00023800568f, \
+    -0.26530591f, 74.324989f, 0.00029507602f, -0.32436115f, 89.534416f, 0.00038529283f, -0.41746229f, 113.45244f, \
+    -5.0353548e-05f, 0.033841912f, -2.712249f, -2.1067026e-05f, 0.0037372359f, 4.9673462f, 2.1923124e-06f, -0.020267323f, \
+    11.122316f, 2.1288404e-05f, -0.040050168f, 16.220062f, 3.7471775e-05f, -0.056876879f, 20.577072f, 5.1677664e-05f, \
+    -0.071698405f, 24.432453f, 6.4757704e-05f, -0.085385844f, 28.006681f, 7.7623037e-05f, -0.098876052f, 31.53825f, \
+    9.1205795e-05f, -0.11313015f, 35.272682f, 0.00010648172f, -0.12915528f, 39.467735f, 0.00012464104f, -0.14817946f, \
+    44.437843f, 0.0001473891f, -0.17196007f, 50.632797f, 0.00017750481f, -0.2033563f, 58.783768f, 0.00022007083f, \
+    -0.24758872f, 70.224533f, 0.00028568134f, -0.3155207f, 87.728127f, 0.00040077363f, -0.43421707f, 118.19869f, \
+    -0.00010613193f, 0.091285974f, -17.092995f, -6.9345391e-05f, 0.053468063f, -7.4590178f, -4.0432893e-05f, 0.023614051f, \
+    0.19033152f, -1.6905378e-05f, -0.00078122242f, 6.4760041f, 2.8327072e-06f, -0.021330731f, 11.800035f, 1.9880665e-05f, \
+    -0.039150324f, 16.441969f, 3.5069592e-05f, -0.055087365f, 20.61524f, 4.9132392e-05f, -0.069893017f, 24.510221f, \
+    6.2908883e-05f, -0.084432676f, 28.347584f, 7.7547789e-05f, -0.099893831f, 32.431255f, 9.4557268e-05f, -0.11783627f, \
+    37.160938f, 0.0001160475f, -0.14043944f, 43.094868f, 0.00014552103f, -0.17131244f, 51.15617f, 0.00018988026f, \
+    -0.21754926f, 63.156246f, 0.00026553989f, -0.29597437f, 83.384026f, 0.00042381388f, -0.45903751f, 125.19141f, \
+    -0.00021417503f, 0.20251657f, -44.989265f, -0.00016020275f, 0.14718266f, -30.972975f, -0.0001192224f, 0.10494047f, \
+    -20.193623f, -8.6797685e-05f, 0.071356706f, -11.566268f, -6.0253398e-05f, 0.04373711f, -4.4246478f, -3.787149e-05f, \
+    0.020342464f, 1.6643548f, -1.8474326e-05f, -2.4647172e-05f, 7.0007267f, -1.1900047e-06f, -0.018254682f, 11.808931f, \
+    1.470196e-05f, -0.035086934f, 16.276539f, 2.9913863e-05f, -0.051255859f, 20.591105f, 4.5379835e-05f, -0.067728117f, \
+    25.000509f, 6.2866864e-05f, -0.086334325f, 29.974522f, 8.6337583e-05f, -0.11117403f, 36.563522f, 0.00012470251f, \
+    -0.15143162f, 47.11385f, 0.00020360347f, -0.23340957f, 68.321442f, 0.00044566585f, -0.48217916f, 131.91405f, \
+    -0.00055968785f, 0.55550259f, -132.73611f, -0.00042502963f, 0.41951859f, -99.138405f, -0.00033975675f, 0.3328172f, \
+    -77.493134f, -0.00027927404f, 0.27088884f, -61.866924f, -0.00023376103f, 0.22399361f, -49.915688f, -0.00019837444f, \
+    0.18733653f, -40.486835f, -0.00017034005f, 0.15816201f, -32.913551f, -0.00014791328f, 0.13472642f, -26.768641f, \
+    -0.00013001796f, 0.11595862f, -21.788843f, -0.00011606493f, 0.10129062f, -17.836782f, -0.00010588524f, 0.090603739f, \
+    -14.8908f, -9.9774108e-05f, 0.084298037f, -13.067317f, -9.8696197e-05f, 0.083557405f, -12.698332f, -0.00010477162f, \
+    0.090999328f, -14.524726f, -0.00012146882f, 0.11141987f, -19.990389f, -2.7231624e-06f, 0.0030818158f, 5.1100564f, \
+    0.00024551354f, -0.30790949f, 91.754608f, 0.00038466166f, -0.44440842f, 125.1986f, 0.00041235625f, -0.47018531f, \
+    131.19962f, 0.00042978936f, -0.48616263f, 134.86279f, 0.00044473558f, -0.50004297f, 138.09277f, 0.00045973802f, \
+    -0.51432002f, 141.50026f, 0.00047602699f, -0.53019369f, 145.3777f, 0.00049445312f, -0.54850143f, 149.93114f, \
+    0.00051583443f, -0.57006556f, 155.36699f, 0.00054112246f, -0.59586143f, 161.93431f, 0.00057154062f, -0.62715894f, \
+    169.96106f, 0.00060877588f, -0.66572285f, 179.90611f, 0.00065529865f, -0.71414953f, 192.44722f, 0.00071495189f, \
+    -0.77648902f, 208.64406f, 0.00079414377f, -0.85950589f, 230.26924f, 0.00090456108f, -0.97555256f, 260.56302f, \
+    0.00021101801f, -0.25381824f, 73.843758f, 0.00026042835f, -0.30283692f, 85.983963f, 0.00028479847f, -0.32685122f, \
+    91.900337f, 0.00030320449f, -0.34500152f, 96.378265f, 0.00031958893f, -0.36124516f, 100.40768f, 0.00033555957f, \
+    -0.37719661f, 104.39265f, 0.00035203111f, -0.39377725f, 108.56456f, 0.00036968011f, -0.41167331f, 113.09687f, \
+    0.00038913634f, -0.43152943f, 118.15392f, 0.00041109108f, -0.45405903f, 123.91901f, 0.00043638685f, -0.48013732f, \
+    130.61824f, 0.00046612637f, -0.5109145f, 138.54994f, 0.00050183752f, -0.54798877f, 148.12964f, 0.0005457527f, \
+    -0.59369934f, 159.96652f, 0.00060131954f, -0.65166366f, 175.0038f, 0.00067422114f, -0.72785056f, 194.79922f, \
+    0.00016993553f, -0.20481269f, 59.879917f, 0.00020393642f, -0.23884501f, 68.378212f, 0.00022491624f, -0.25983712f, \
+    73.623634f, 0.00024183077f, -0.27680039f, 77.873978f, 0.00025724442f, -0.29231983f, 81.778107f, 0.000272326f, \
+    -0.30757627f, 85.633102f, 0.00028779087f, -0.32329535f, 89.622299f, 0.00030419225f, -0.34004176f, 93.88916f, \
+    0.00032205117f, -0.35835063f, 98.570557f, 0.00034193665f, -0.37880987f, 103.8176f, 0.00036453488f, -0.40213129f, \
+    109.81401f, 0.00039073167f, -0.42923653f, 116.79828f, 0.00042173298f, -0.46138266f, 125.09629f, 0.00045926112f, \
+    -0.50036728f, 135.17464f, 0.00050589949f, -0.54888934f, 147.73457f, 0.00056574593f, -0.61123312f, 163.89006f, \
+    0.00014173547f, -0.1721095f, 50.767128f, 0.00016910773f, -0.199672f, 57.687675f, 0.00018783101f, -0.21855453f, \
+    62.439861f, 0.00020346032f, -0.23435798f, 66.429031f, 0.00021791323f, -0.24902041f, 70.142632f, 0.00023213179f, \
+    -0.26349661f, 73.821487f, 0.00024672106f, -0.2784023f, 77.621567f, 0.00026216471f, -0.29423246f, 81.6689f, \
+    0.00027892669f, -0.31146413f, 86.085602f, 0.0002975169f, -0.33062407f, 91.007034f, 0.00031855132f, -0.35235047f, \
+    96.597733f, 0.0003428245f, -0.37746829f, 103.07076f, 0.00037141462f, -0.40709835f, 110.71604f, 0.00040585242f, \
+    -0.44283348f, 119.94598f, 0.00044841412f, -0.48704386f, 131.37469f, 0.00050266553f, -0.54344445f, 145.96536f, \
+    0.00012032336f, -0.14774249f, 44.091251f, 0.00014414323f, -0.17183626f, 50.165573f, 0.00016138788f, -0.18931921f, \
+    54.586479f, 0.00017607516f, -0.20424929f, 58.373337f, 0.0001897826f, -0.21822411f, 61.928547f, 0.00020332895f, \
+    -0.2320753f, 65.462234f, 0.0002172582f, -0.24635763f, 69.11515f, 0.00023201692f, -0.26152867f, 73.003937f, \
+    0.00024804092f, -0.27803692f, 77.243416f, 0.0002658146f, -0.29638249f, 81.962082f, 0.0002859275f, -0.31717551f, \
+    87.317047f, 0.00030914444f, -0.3412087f, 93.512756f, 0.00033650812f, -0.36956373f, 100.82848f, 0.00036950462f, \
+    -0.40378323f, 109.66284f, 0.00041035042f, -0.44616905f, 120.61092f, 0.00046252785f, -0.50033909f, 134.60855f, \
+    0.00010260124f, -0.12791984f, 38.749451f, 0.0001244017f, -0.15005185f, 44.347565f, 0.00014071038f, -0.16665289f, \
+    48.560844f, 0.0001547493f, -0.18098189f, 52.208694f, 0.00016791672f, -0.19445734f, 55.648838f, 0.00018096909f, \
+    -0.20784891f, 59.075996f, 0.00019442117f, -0.22168241f, 62.623718f, 0.00020870366f, -0.23639961f, 66.404694f, \
+    0.00022424356f, -0.25244001f, 70.531471f, 0.00024152143f, -0.27029964f, 75.131416f, 0.00026112839f, -0.29058963f, \
+    80.361786f, 0.00028383906f, -0.31411177f, 86.429092f, 0.00031072026f, -0.34197083f, 93.618164f, 0.00034330873f, \
+    -0.37575898f, 102.3397f, 0.0003839235f, -0.41787937f, 113.21387f, 0.00043625859f, -0.47216082f, 127.22918f, \
+    8.6817046e-05f, -0.11056471f, 34.151478f, 0.00010755297f, -0.13168226f, 39.507919f, 0.00012335026f, -0.14781761f, \
+    43.615646f, 0.00013699153f, -0.16178878f, 47.183712f, 0.00014979714f, -0.1749372f, 50.550732f, 0.00016250536f, \
+    -0.18801522f, 53.907242f, 0.00017562587f, -0.20154417f, 57.385773f, 0.00018959027f, -0.21596698f, 61.099373f, \
+    0.00020483168f, -0.23172969f, 65.162262f, 0.00022184369f, -0.24934155f, 69.705162f, 0.00024124111f, -0.26943773f, \
+    74.89138f, 0.00026384043f, -0.29286239f, 80.938126f, 0.0002907826f, -0.32079548f, 88.149231f, 0.00032373806f, \
+    -0.35496488f, 96.969788f, 0.00036527685f, -0.39802918f, 108.08483f, 0.0004195887f, -0.45432264f, 122.61156f, \
+    7.1778501e-05f, -0.094308332f, 29.918076f, 9.2164868e-05f, -0.11512806f, 35.211895f, 0.0001078384f, -0.13118578f, \
+    39.311108f, 0.00012132014f, -0.14503706f, 42.858948f, 0.00013392796f, -0.15802257f, 46.194122f, 0.0001464215f, \
+    -0.17091753f, 49.513119f, 0.00015932822f, -0.18426199f, 52.953327f, 0.0001730962f, -0.19851623f, 56.632278f, \
+    0.00018817857f, -0.21414697f, 60.669479f, 0.00020509739f, -0.23169275f, 65.203148f, 0.00022451194f, -0.25183433f, \
+    70.408188f, 0.00024731195f, -0.27549076f, 76.520905f, 0.00027476411f, -0.30397066f, 83.877899f, 0.00030876414f, \
+    -0.33923233f, 92.983017f, 0.00035230693f, -0.38436928f, 104.63235f, 0.00041043886f, -0.44459358f, 120.16753f, \
+    5.6477591e-05f, -0.078034066f, 25.749302f, 7.7137047e-05f, -0.099186473f, 31.139412f, 9.3105373e-05f, -0.11559232f, \
+    35.33802f, 0.0001066934f, -0.12959498f, 38.934818f, 0.00011927656f, -0.14259528f, 42.283894f, 0.00013167877f, \
+    -0.15543504f, 45.598766f, 0.00014447191f, -0.16870047f, 49.02866f, 0.00015813857f, -0.18288766f, 52.700279f, \
+    0.00017316677f, -0.19849944f, 56.742413f, 0.00019012345f, -0.21612068f, 61.30513f, 0.00020973472f, -0.23650092f, \
+    66.580917f, 0.00023299879f, -0.26067066f, 72.834579f, 0.00026136983f, -0.29013094f, 80.451866f, 0.0002970857f, \
+    -0.32719108f, 90.026375f, 0.00034380652f, -0.37562719f, 102.52878f, 0.00040797982f, -0.44208944f, 119.66887f, \
+    3.9833256e-05f, -0.060583726f, 21.3435f, 6.1380961e-05f, -0.082697533f, 26.989534f, 7.815448e-05f, -0.09997613f, \
+    31.42165f, 9.2204835e-05f, -0.11449821f, 35.162235f, 0.00010498569f, -0.1277453f, 38.585781f, 0.00011743682f, \
+    -0.14067866f, 41.93623f, 0.00013021201f, -0.15396915f, 45.384422f, 0.00014385303f, -0.16817419f, 49.072796f, \
+    0.00015890188f, -0.18385258f, 53.144489f, 0.00017598986f, -0.20165578f, 57.766659f, 0.00019593633f, -0.22242956f, \
+    63.156467f, 0.00021989143f, -0.24736096f, 69.618782f, 0.0002495774f, -0.27822673f, 77.60994f, 0.00028773886f, \
+    -0.31785697f, 87.856804f, 0.00033906972f, -0.37108961f, 101.60185f, 0.00041234182f, -0.44696182f, 121.16621f, \
+    2.0378595e-05f, -0.040421855f, 16.309475f, 4.3541342e-05f, -0.064245097f, 22.402327f, 6.1757943e-05f, -0.083056718f, \
+    27.237631f, 7.6812947e-05f, -0.098662317f, 31.26795f, 9.0146255e-05f, -0.11252879f, 34.863636f, 0.00010285343f, \
+    -0.12577771f, 38.309326f, 0.00011572697f, -0.13922307f, 41.812393f, 0.00012940828f, -0.15352555f, 45.541714f, \
+    0.00014452213f, -0.16932981f, 49.662498f, 0.00016179027f, -0.18738127f, 54.366051f, 0.00018215881f, -0.20865689f, \
+    59.90324f, 0.00020698606f, -0.23455873f, 66.634094f, 0.00023837364f, -0.26725453f, 75.11515f, 0.00027982003f, \
+    -0.31035003f, 86.271912f, 0.00033766413f, -0.37037387f, 101.77979f, 0.00042473077f, -0.46052635f, 125.02614f, \
+    -4.3124674e-06f, -0.015037348f, 10.013914f, 2.1539636e-05f, -0.041679472f, 16.837116f, 4.2036059e-05f, -0.062894426f, \
+    22.300026f, 5.890914e-05f, -0.080432862f, 26.840336f, 7.3452335e-05f, -0.095609672f, 30.788956f, 8.6821492e-05f, \
+    -0.10960767f, 34.445686f, 0.00010000352f, -0.12344147f, 38.069016f, 0.00011381129f, -0.13794939f, 41.873306f, \
+    0.00012900462f, -0.15391657f, 46.059898f, 0.00014643675f, -0.17222537f, 50.8554f, 0.00016722598f, -0.19403191f, \
+    56.556847f, 0.00019301365f, -0.22103159f, 63.599712f, 0.00022643877f, -0.25594744f, 72.683075f, 0.00027214168f, \
+    -0.30356181f, 85.034019f, 0.00033919481f, -0.37321472f, 103.04802f, 0.00044809221f, -0.4859843f, 132.12982f, \
+    -3.9008512e-05f, 0.020489099f, 1.2187885f, -8.5721013e-06f, -0.010928705f, 9.2714424f, 1.5589032e-05f, -0.035988543f, \
+    15.733333f, 3.5452838e-05f, -0.056688733f, 21.103121f, 5.2349795e-05f, -0.074379563f, 25.719564f, 6.7315726e-05f, \
+    -0.090118237f, 29.849604f, 8.1367565e-05f, -0.10494971f, 33.759052f, 9.554252e-05f, -0.11994492f, 37.721794f, \
+    0.00011083883f, -0.13613746f, 42.003117f, 0.00012832251f, -0.15463234f, 46.887222f, 0.0001493554f, -0.17684078f, \
+    52.737221f, 0.00017596259f, -0.20485854f, 60.092052f, 0.0002115433f, -0.2421975f, 69.853905f, 0.00026250471f, \
+    -0.29546565f, 83.718567f, 0.00034273718f, -0.37896383f, 105.35266f, 0.00048913289f, -0.5306161f, 144.47421f, \
+    -9.5160853e-05f, 0.077970676f, -13.052046f, -5.6063647e-05f, 0.037580773f, -2.7055523f, -2.5353e-05f, 0.0056820726f, \
+    5.5227427f, -3.0910786e-07f, -0.020471696f, 12.316133f, 2.0797228e-05f, -0.042634793f, 18.113668f, 3.9157771e-05f, \
+    -0.062022068f, 23.221205f, 5.5693981e-05f, -0.079578251f, 27.878235f, 7.1296774e-05f, -0.096222997f, 32.319714f, \
+    8.7092631e-05f, -0.11312557f, 36.846191f, 0.00010449262f, -0.13175446f, 41.836334f, 0.00012525285f, -0.15393798f, \
+    47.762218f, 0.00015192952f, -0.18233341f, 55.309467f, 0.00018897012f, -0.22155206f, 65.665665f, 0.00024551782f, \
+    -0.28104603f, 81.259911f, 0.00034454232f, -0.38449112f, 108.16482f, 0.00056535681f, -0.61341065f, 167.26085f, \
+    -0.00021033487f, 0.19613034f, -42.548855f, -0.00015031708f, 0.13424888f, -26.771936f, -0.00010495853f, 0.087166965f, \
+    -14.661509f, -6.9007656e-05f, 0.049606379f, -4.9167633f, -3.9375096e-05f, 0.018438675f, 3.2410727f, -1.4100427e-05f, \
+    -0.0083337827f, 10.313404f, 8.15983e-06f, -0.032089442f, 16.649363f, 2.841505e-05f, -0.053872712f, 22.516365f, \
+    4.7535083e-05f, -0.074592605f, 28.150061f, 6.6468339e-05f, -0.095248744f, 33.812191f, 8.6734697e-05f, -0.11744573f, \
+    39.923328f, 0.00011134225f, -0.14435019f, 47.310303f, 0.00014599902f, -0.18194821f, 57.530392f, 0.00020352448f, \
+    -0.24360904f, 74.043961f, 0.00032410878f, -0.3709746f, 107.56951f, 0.00074209447f, -0.80518442f, 219.87909f, \
+    -0.00064767734f, 0.64215451f, -153.17792f, -0.00047032259f, 0.46282527f, -108.85326f, -0.00036295841f, 0.35309985f, \
+    -81.309311f, -0.00028764055f, 0.27526328f, -61.460045f, -0.00023095179f, 0.21607116f, -46.143154f, -0.0001864676f, \
+    0.16915582f, -33.827419f, -0.00015025817f, 0.13053469f, -23.52372f, -0.00011981849f, 0.097622864f, -14.572599f, \
+    -9.3472612e-05f, 0.068649195f, -6.5055618f, -7.0033857e-05f, 0.042306226f, 1.0447949f, -4.8608072e-05f, 0.017529177f, \
+    8.4092836f, -2.8491297e-05f, -0.0066539035f, 15.940576f, -9.2230857e-06f, -0.03117205f, 24.076139f, 8.5621432e-06f, \
+    -0.056295805f, 33.323395f, 1.4459704e-05f, -0.073218398f, 42.604755f, -4.1650779e-05f, 0.054977179f, 5.0085378f, \
+    0.00024770841f, -0.31027308f, 92.387741f, 0.00038588478f, -0.44579789f, 125.58858f, 0.0004135448f, -0.47153327f, \
+    131.57767f, 0.00043097569f, -0.48750392f, 135.23819f, 0.00044593593f, -0.50139588f, 138.47055f, 0.00046096652f, \
+    -0.5157004f, 141.88481f, 0.00047729764f, -0.53161711f, 145.77328f, 0.00049578166f, -0.54998523f, 150.34247f, \
+    0.00051723997f, -0.57163066f, 155.79971f, 0.00054262968f, -0.59753442f, 162.39555f, 0.00057318265f, -0.62897539f, \
+    170.46034f, 0.00061059877f, -0.6677323f, 180.4566f, 0.00065737031f, -0.71642458f, 193.06824f, 0.00071737834f, \
+    -0.77914298f, 209.36568f, 0.00079710357f, -0.86272943f, 231.14195f, 0.00090538705f, -0.9764415f, 260.80032f, \
+    0.00021191699f, -0.25482222f, 74.122383f, 0.00026120315f, -0.30371705f, 86.231956f, 0.00028557453f, -0.32773301f, \
+    92.148933f, 0.00030400048f, -0.34590417f, 96.632355f, 0.00032041359f, -0.36217788f, 100.66969f, 0.0003364202f, \
+    -0.3781673f, 104.66469f, 0.00035293546f, -0.39479429f, 108.84887f, 0.00037063725f, -0.41274649f, 113.39607f, \
+    0.00039015766f, -0.43267092f, 118.47128f, 0.00041219138f, -0.45528477f, 124.25874f, 0.0004375859f, -0.48146838f, \
+    130.98598f, 0.00046745123f, -0.51237983f, 138.95332f, 0.00050332677f, -0.54962927f, 148.57954f, 0.00054746342f, \
+    -0.59557593f, 160.47902f, 0.00060334097f, -0.65387112f, 175.60396f, 0.00067670282f, -0.73054755f, 195.52893f, \
+    0.00017063442f, -0.20559882f, 60.099918f, 0.00020458303f, -0.23958032f, 68.586029f, 0.00022556902f, -0.26058012f, \
+    73.833839f, 0.00024250466f, -0.27756631f, 78.090416f, 0.00025794699f, -0.29311654f, 82.002808f, 0.00027306343f, \
+    -0.30841032f, 85.867798f, 0.00028856963f, -0.32417369f, 89.86882f, 0.00030501987f, -0.34097233f, 94.149643f, \
+    0.000322937f, -0.3593435f, 98.847641f, 0.00034289272f, -0.37987778f, 104.11469f, 0.00036557706f, -0.40329117f, \
+    110.13558f, 0.00039188151f, -0.4305113f, 117.15038f, 0.00042302071f, -0.46280438f, 125.48741f, 0.00046073049f, \
+    -0.50198233f, 135.617f, 0.00050761696f, -0.55076802f, 148.24672f, 0.00056781812f, -0.61348826f, 164.50169f, \
+    0.00014236287f, -0.17281799f, 50.966362f, 0.00016970481f, -0.20035201f, 57.880394f, 0.00018843585f, -0.21924423f, \
+    62.635563f, 0.00020408614f, -0.23507084f, 66.631119f, 0.00021856734f, -0.24976398f, 70.353043f, 0.0002328202f, \
+    -0.26427716f, 74.04187f, 0.00024744985f, -0.27922636f, 77.853638f, 0.00026294103f, -0.29510757f, 81.914658f, \
+    0.00027975926f, -0.3123996f, 86.347496f, 0.00029841682f, -0.33163169f, 91.2882f, 0.00031953325f, -0.3534458f, \
+    96.902267f, 0.00034390832f, -0.37867233f, 103.40422f, 0.00037262781f, -0.40844023f, 111.08611f, 0.00040723465f, \
+    -0.44435519f, 120.36369f, 0.00045002491f, -0.48880818f, 131.85658f, 0.00050459936f, -0.54555106f, 146.5376f, \
+    0.00012092513f, -0.14842407f, 44.283627f, 0.00014472446f, -0.17249939f, 50.354f, 0.0001619776f, -0.18999304f, \
+    54.778217f, 0.00017668595f, -0.20494662f, 58.571613f, 0.0001904219f, -0.21895263f, 62.135342f, 0.00020400285f, \
+    -0.23284137f, 65.679207f, 0.00021797296f, -0.2471679f, 69.344048f, 0.00023277971f, -0.26239073f, 73.246758f, \
+    0.00024886048f, -0.27896002f, 77.502609f, 0.00026670203f, -0.29737842f, 82.240761f, 0.0002868975f, -0.31825987f, \
+    87.619316f, 0.00031021674f, -0.34240228f, 93.844109f, 0.00033771023f, -0.37089565f, 101.19659f, 0.00037087619f, \
+    -0.40529534f, 110.07869f, 0.00041195125f, -0.44792435f, 121.09106f, 0.00046445281f, -0.50243741f, 135.17917f, \
+    0.0001032018f, -0.12860179f, 38.942547f, 0.00012498697f, -0.15072091f, 44.538174f, 0.00014130451f, -0.1673333f, \
+    48.755001f, 0.00015536486f, -0.18168646f, 52.409637f, 0.00016856159f, -0.19519415f, 55.858646f, 0.0001816498f, \
+    -0.20862485f, 59.296455f, 0.00019514436f, -0.22250448f, 62.85667f, 0.00020947686f, -0.23727576f, 66.652237f, \
+    0.00022507596f, -0.25338f, 70.796181f, 0.00024242475f, -0.27131587f, 75.416573f, 0.000262118f, -0.2916984f, \
+    80.671669f, 0.00028493587f, -0.31533512f, 86.769516f, 0.00031195357f, -0.34333971f, 93.997261f, 0.00034472108f, \
+    -0.3773182f, 102.76923f, 0.00038557974f, -0.41969717f, 113.71174f, 0.000438263f, -0.47434676f, 127.82408f, \
+    8.743332e-05f, -0.11126624f, 34.350704f, 0.0001081575f, -0.13237481f, 39.705734f, 0.00012396369f, -0.1485219f, \
+    43.817211f, 0.00013762698f, -0.16251813f, 47.392387f, 0.00015046325f, -0.17570055f, 50.768814f, 0.00016320936f, \
+    -0.18882015f, 54.136707f, 0.00017637506f, -0.20239834f, 57.628632f, 0.00019039284f, -0.21687911f, 61.357922f, \
+    0.00020569764f, -0.23271038f, 65.439293f, 0.00022278586f, -0.25040436f, 70.004272f, 0.00024227636f, -0.27060053f, \
+    75.217255f, 0.00026499186f, -0.29414955f, 81.297188f, 0.00029208287f, -0.32224143f, 88.550537f, 0.00032523548f, \
+    -0.35662049f, 97.426666f, 0.00036704616f, -0.39997292f, 108.61785f, 0.00042175304f, -0.45668378f, 123.25453f, \
+    7.2424693e-05f, -0.095045798f, 30.128136f, 9.2803057e-05f, -0.11586078f, 35.421745f, 0.00010848529f, -0.13193047f, \
+    39.524891f, 0.00012198959f, -0.14580782f, 43.080231f, 0.00013462995f, -0.15882972f, 46.425552f, 0.0001471643f, \
+    -0.17176972f, 49.75695f, 0.00016012005f, -0.18516789f, 53.211838f, 0.00017394632f, -0.19948567f, 56.908054f, \
+    0.00018909825f, -0.2151919f, 60.965687f, 0.00020610102f, -0.23282838f, 65.523796f, 0.0002256187f, -0.25308099f, \
+    70.758636f, 0.00024854834f, -0.27687645f, 76.908516f, 0.00027616817f, -0.30553544f, 84.313202f, 0.00031039325f, \
+    -0.34103653f, 93.481834f, 0.00035425217f, -0.38650855f, 105.21972f, 0.00041285518f, -0.44723028f, 120.88586f, \
+    5.7167155e-05f, -0.078823298f, 25.974842f, 7.7824756e-05f, -0.099977866f, 31.36668f, 9.3801631e-05f, -0.11639614f, \
+    35.569519f, 0.00010741271f, -0.13042597f, 39.174278f, 0.00012003062f, -0.14346556f, 42.534424f, 0.00013247742f, \
+    -0.15635492f, 45.863052f, 0.00014532483f, -0.16968015f, 49.30938f, 0.00015905649f, -0.18393853f, 53.000446f, \
+    0.00017416278f, -0.1996354f, 57.065704f, 0.00019121423f, -0.21735942f, 61.656216f, 0.00021094276f, -0.23786627f, \
+    66.966087f, 0.0002343556f, -0.26219591f, 73.262596f, 0.00026292141f, -0.2918646f, 80.935478f, 0.00029890324f, \
+    -0.32920799f, 90.58519f, 0.00034600691f, -0.37805f, 103.19489f, 0.00041077126f, -0.4451361f, 120.49918f, \
+    4.0580213e-05f, -0.061441649f, 21.589621f, 6.21367e-05f, -0.0835694f, 27.240641f, 7.8920704e-05f, -0.1008633f, \
+    31.677986f, 9.2994298e-05f, -0.11541364f, 35.427071f, 0.00010581224f, -0.12870331f, 38.862797f, 0.0001183127f, \
+    -0.14169209f, 42.228764f, 0.00013114905f, -0.15505049f, 45.695766f, 0.00014486426f, -0.1693373f, 49.406612f, \
+    0.00016000282f, -0.18511397f, 53.505157f, 0.00017720059f, -0.20303679f, 58.159828f, 0.00019728404f, -0.22395907f, \
+    63.589767f, 0.00022141488f, -0.24907996f, 70.10302f, 0.00025133448f, -0.28019628f, 78.161179f, 0.00028982188f, \
+    -0.32017419f, 88.500504f, 0.00034163718f, -0.37392074f, 102.38148f, 0.00041569368f, -0.45062065f, 122.16365f, \
+    2.1198517e-05f, -0.041367851f, 16.582191f, 4.4386215e-05f, -0.065222941f, 22.684977f, 6.2622152e-05f, -0.084060296f, \
+    27.52857f, 7.7701894e-05f, -0.099697031f, 31.568525f, 9.1074377e-05f, -0.11360961f, 35.1777f, 0.00010383646f, \
+    -0.12692112f, 38.641171f, 0.00011678017f, -0.14044523f, 42.166275f, 0.00013054804f, -0.1548439f, 45.922264f, \
+    0.00014576786f, -0.1707651f, 50.07523f, 0.00016316694f, -0.18896013f, 54.818035f, 0.00018370055f, -0.21041566f, \
+    60.40411f, 0.00020874232f, -0.23654985f, 67.197701f, 0.00024042034f, -0.26955819f, 75.762619f, 0.00028228294f, \
+    -0.31309876f, 87.03801f, 0.00034077172f, -0.37380728f, 102.7272f, 0.00042895321f, -0.46513599f, 126.28307f, \
+    -3.4039051e-06f, -0.016092315f, 10.320109f, 2.24984e-05f, -0.042794298f, 17.160995f, 4.3034084e-05f, -0.064057581f, \
+    22.638584f, 5.9942788e-05f, -0.081640534f, 27.1926f, 7.4528849e-05f, -0.096869461f, 31.156912f, 8.7958608e-05f, \
+    -0.11093823f, 34.834217f, 0.00010122205f, -0.12486488f, 38.483948f, 0.00011513344f, -0.13948938f, 42.320957f, \
+    0.0001304561f, -0.15560073f, 46.54763f, 0.0001480502f, -0.17408872f, 51.392559f, 0.00016904621f, -0.19612235f, \
+    57.156197f, 0.00019510665f, -0.22341944f, 64.279907f, 0.00022890906f, -0.25874344f, 73.473358f, 0.00027517072f, \
+    -0.30695748f, 85.984741f, 0.00034313722f, -0.3775824f, 104.25665f, 0.00045376891f, -0.49218214f, 133.82013f, \
+    -3.8005848e-05f, 0.019312501f, 1.5640547f, -7.4735763e-06f, -0.012215601f, 9.6482801f, 1.676415e-05f, -0.037365779f, \
+    16.136641f, 3.6694677e-05f, -0.058146272f, 21.530403f, 5.3655243e-05f, -0.075914539f, 26.17021f, 6.8692338e-05f, \
+    -0.091739058f, 30.325954f, 8.2838393e-05f, -0.1066811f, 34.267715f, 9.7139819e-05f, -0.12182154f, 38.272034f, \
+    0.00011260014f, -0.13819981f, 42.60582f, 0.00013029433f, -0.15693069f, 47.555912f, 0.00015160062f, -0.17944296f, \
+    53.490108f, 0.00017857509f, -0.20786525f, 60.956047f, 0.00021467661f, -0.24577247f, 70.872482f, 0.0002664401f, \
+    -0.29990682f, 84.970337f, 0.000348081f, -0.38490927f, 107.005f, 0.00049755489f, -0.53981179f, 146.98244f, \
+    -9.4123527e-05f, 0.076723307f, -12.676944f, -5.4828601e-05f, 0.036111705f, -2.2685654f, -2.3960507e-05f, 0.0040325634f, \
+    6.0112295f, 1.2195688e-06f, -0.022280354f, 12.850915f, 2.2452008e-05f, -0.044593193f, 18.692682f, 4.0936848e-05f, \
+    -0.064129762f, 23.844793f, 5.7604717e-05f, -0.081844702f, 28.54941f, 7.3365911e-05f, -0.098678358f, 33.046963f, \
+    8.9375899e-05f, -0.11583089f, 37.646175f, 0.00010706667f, -0.13479349f, 42.731846f, 0.00012821986f, -0.15742242f, \
+    48.783657f, 0.00015543943f, -0.18642634f, 56.501003f, 0.00019327292f, -0.22652327f, 67.099808f, 0.00025110031f, \
+    -0.28741586f, 83.07515f, 0.000352595f, -0.39351878f, 110.69299f, 0.00058022945f, -0.62964982f, 171.69067f, \
+    -0.00020977482f, 0.19532815f, -42.269844f, -0.00014922113f, 0.13286221f, -26.334513f, -0.0001034649f, 0.085336939f, \
+    -14.101038f, -6.7182576e-05f, 0.04739916f, -4.2493134f, -3.7248352e-05f, 0.015881877f, 4.0095119f, -1.1679153e-05f, \
+    -0.011237093f, 11.183455f, 1.0884684e-05f, -0.035354223f, 17.62665f, 3.1467815e-05f, -0.057531435f, 23.611519f, \
+    5.0958937e-05f, -0.078699522f, 29.379986f, 7.034195e-05f, -0.099898085f, 35.205021f, 9.1232949e-05f, -0.12283678f, \
+    41.535709f, 0.00011678829f, -0.15084417f, 49.242874f, 0.00015292858f, -0.19013989f, 59.947651f, 0.00021300631f, \
+    -0.25466987f, 77.265739f, 0.00033915712f, -0.38814661f, 112.46412f, 0.00078174035f, -0.84846866f, 231.68617f, \
+    -0.00065588101f, 0.6502198f, -155.07581f, -0.00047416607f, 0.46645823f, -109.65272f, -0.00036456849f, 0.35438892f, \
+    -81.503136f, -0.00028770554f, 0.27487743f, -61.203609f, -0.00022981974f, 0.21435225f, -45.517063f, -0.00018428841f, \
+    0.16624133f, -32.860573f, -0.00014703699f, 0.12640378f, -22.201973f, -0.00011544793f, 0.092125766f, -12.844929f, \
+    -8.7719578e-05f, 0.061486095f, -4.2761288f, -6.2480525e-05f, 0.032951094f, 3.9410138f, -3.8517534e-05f, 0.0050605093f, \
+    12.259658f, -1.4477715e-05f, -0.023967076f, 21.284344f, 1.1656209e-05f, -0.057011731f, 32.062256f, 4.4033291e-05f, \
+    -0.10037078f, 46.993664f, 9.5524032e-05f, -0.17483822f, 74.381645f, 8.108357e-05f, 0.021109534f, 7.9468799f \
+  }}
+
+static const RGBToSpectrumTable srgb_to_spectrum_table = SRGB_TO_SPECTRUM_TABLE;
+// too large for constant memory
+static __device__ const RGBToSpectrumTable device_srgb_to_spectrum_table = SRGB_TO_SPECTRUM_TABLE;
+
+#undef SRGB_TO_SPECTRUM_TABLE
+
+HERMES_DEVICE_CALLABLE const RGBToSpectrumTable &RGBToSpectrumTable::sRGB() {
+#if defined(__CUDA_ARCH__) && __CUDA_ARCH__ > 0
+  return device_srgb_to_spectrum_table;
+#else
+  return srgb_to_spectrum_table;
+#endif
+}
+
+}
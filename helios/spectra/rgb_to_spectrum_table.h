@@ -0,0 +1,130 @@
+/// Copyright (c) 2021, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+///\file rgb_to_spectrum_table.h
+///\author FilipeCN (filipedecn@gmail.com)
+///\date 2021-10-19
+///
+///\brief RGB to spectrum conversion (Jakob and Hanika 2019)
+
+#ifndef HELIOS_HELIOS_SPECTRUM_RGB_TO_SPECTRUM_TABLE_H
+#define HELIOS_HELIOS_SPECTRUM_RGB_TO_SPECTRUM_TABLE_H
+
+#include <helios/base/spectrum.h>
+
+namespace helios {
+
+// *********************************************************************************************************************
+//                                                                                               RGBSigmoidPolynomial
+// *********************************************************************************************************************
+/// Smooth bounded spectrum s(c0 lambda^2 + c1 lambda + c2), with s(x) = 1/2 + x / (2 sqrt(1 + x^2))
+class RGBSigmoidPolynomial {
+public:
+  // *******************************************************************************************************************
+  //                                                                                                   STATIC METHODS
+  // *******************************************************************************************************************
+  /// \param x
+  /// \return sigmoid value in [0, 1]
+  HERMES_DEVICE_CALLABLE static real_t sigmoid(real_t x) {
+    if (isinf(x))
+      return x > 0 ? 1 : 0;
+    return 0.5f + x / (2 * sqrtf(1 + x * x));
+  }
+  // *******************************************************************************************************************
+  //                                                                                                     CONSTRUCTORS
+  // *******************************************************************************************************************
+  RGBSigmoidPolynomial() = default;
+  HERMES_DEVICE_CALLABLE RGBSigmoidPolynomial(real_t c0, real_t c1, real_t c2) : c0_(c0), c1_(c1), c2_(c2) {}
+  // *******************************************************************************************************************
+  //                                                                                                          METHODS
+  // *******************************************************************************************************************
+  /// \param lambda wavelength (nm)
+  /// \return
+  HERMES_DEVICE_CALLABLE real_t operator()(real_t lambda) const {
+    return sigmoid((c0_ * lambda + c1_) * lambda + c2_);
+  }
+  /// \return maximum value over the visible range
+  [[nodiscard]] HERMES_DEVICE_CALLABLE real_t maxValue() const {
+    real_t result = fmaxf((*this)(360), (*this)(830));
+    real_t lambda = -c1_ / (2 * c0_);
+    if (lambda >= 360 && lambda <= 830)
+      result = fmaxf(result, (*this)(lambda));
+    return result;
+  }
+
+private:
+  real_t c0_{0}, c1_{0}, c2_{0};
+};
+
+// *********************************************************************************************************************
+//                                                                                                RGBToSpectrumTable
+// *********************************************************************************************************************
+/// Maps RGB values of a color space to sigmoid polynomial coefficients.
+/// The RGB cube is split by its largest component m and parameterized by (z = rgb[m], x = rgb[m + 1] / z,
+/// y = rgb[m + 2] / z). Coefficients were fitted offline on a resolution^3 grid per largest component, minimizing
+/// the CIELAB distance between the rgb value and the color of the spectrum under the color space illuminant.
+/// A lookup is a trilinear interpolation of the grid.
+struct RGBToSpectrumTable {
+  // *******************************************************************************************************************
+  //                                                                                                   STATIC METHODS
+  // *******************************************************************************************************************
+  /// \return table for the sRGB color space (D65 illuminant)
+  HERMES_DEVICE_CALLABLE static const RGBToSpectrumTable &sRGB();
+  // *******************************************************************************************************************
+  //                                                                                                        OPERATORS
+  // *******************************************************************************************************************
+  /// \param rgb rgb values in [0, 1]
+  /// \return
+  HERMES_DEVICE_CALLABLE RGBSigmoidPolynomial operator()(const real_t rgb[3]) const {
+    // gray values have an exact constant solution
+    if (rgb[0] == rgb[1] && rgb[1] == rgb[2])
+      return {0, 0, (rgb[0] - 0.5f) / sqrtf(rgb[0] * (1 - rgb[0]))};
+    int m = (rgb[0] > rgb[1]) ? ((rgb[0] > rgb[2]) ? 0 : 2) : ((rgb[1] > rgb[2]) ? 1 : 2);
+    real_t z = rgb[m];
+    real_t x = rgb[(m + 1) % 3] * (resolution - 1) / z;
+    real_t y = rgb[(m + 2) % 3] * (resolution - 1) / z;
+    int xi = x < resolution - 2 ? static_cast<int>(x) : resolution - 2;
+    int yi = y < resolution - 2 ? static_cast<int>(y) : resolution - 2;
+    int zi = 0;
+    while (zi < resolution - 2 && z_nodes[zi + 1] < z)
+      zi++;
+    real_t dx = x - xi, dy = y - yi, dz = (z - z_nodes[zi]) / (z_nodes[zi + 1] - z_nodes[zi]);
+    real_t c[3];
+    for (int i = 0; i < 3; ++i) {
+      auto co = [&](int ox, int oy, int oz) { return coefficients[m][zi + oz][yi + oy][xi + ox][i]; };
+      auto lerp = [](real_t t, real_t a, real_t b) { return (1 - t) * a + t * b; };
+      c[i] = lerp(dz,
+                  lerp(dy, lerp(dx, co(0, 0, 0), co(1, 0, 0)), lerp(dx, co(0, 1, 0), co(1, 1, 0))),
+                  lerp(dy, lerp(dx, co(0, 0, 1), co(1, 0, 1)), lerp(dx, co(0, 1, 1), co(1, 1, 1))));
+    }
+    return {c[0], c[1], c[2]};
+  }
+  // *******************************************************************************************************************
+  //                                                                                                    PUBLIC FIELDS
+  // *******************************************************************************************************************
+  static constexpr int resolution = 16;
+  real_t z_nodes[resolution];                                          //!< z grid (denser near 0 and 1)
+  real_t coefficients[3][resolution][resolution][resolution][3];       //!< [m][z][y][x][c]
+};
+
+} // namespace helios
+
+#endif // HELIOS_HELIOS_SPECTRUM_RGB_TO_SPECTRUM_TABLE_H
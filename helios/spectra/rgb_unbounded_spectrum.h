@@ -0,0 +1,94 @@
+/// Copyright (c) 2021, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+///\file rgb_unbounded_spectrum.h
+///\author FilipeCN (filipedecn@gmail.com)
+///\date 2021-10-19
+///
+///\brief Unbounded spectrum from a RGB value
+
+#ifndef HELIOS_HELIOS_SPECTRUM_RGB_UNBOUNDED_SPECTRUM_H
+#define HELIOS_HELIOS_SPECTRUM_RGB_UNBOUNDED_SPECTRUM_H
+
+#include <helios/spectra/rgb_to_spectrum_table.h>
+#include <helios/spectra/sampled_wave_lengths.h>
+
+namespace helios {
+
+// *********************************************************************************************************************
+//                                                                                                  RGBUnboundedSpectrum
+// *********************************************************************************************************************
+/// Spectrum matching an arbitrary non-negative RGB value (e.g. scattering coefficients)
+class RGBUnboundedSpectrum {
+public:
+  // *******************************************************************************************************************
+  //                                                                                                   STATIC METHODS
+  // *******************************************************************************************************************
+  HERMES_DEVICE_CALLABLE static Spectrum createSpectrum(mem::Ptr data_ptr) {
+    return {
+        .data_ptr = data_ptr,
+        .type = SpectrumType::RGB_UNBOUNDED
+    };
+  }
+  // *******************************************************************************************************************
+  //                                                                                                     CONSTRUCTORS
+  // *******************************************************************************************************************
+  /// \param table color space table
+  /// \param rgb non-negative rgb values
+  HERMES_DEVICE_CALLABLE RGBUnboundedSpectrum(const RGBToSpectrumTable &table, const real_t rgb[3]) {
+    real_t m = fmaxf(rgb[0], fmaxf(rgb[1], rgb[2]));
+    // the sigmoid is bounded by 1, so rgb is scaled to put its largest component at 1/2
+    scale_ = 2 * m;
+    real_t scaled_rgb[3] = {0, 0, 0};
+    if (scale_ > 0)
+      for (int i = 0; i < 3; ++i)
+        scaled_rgb[i] = rgb[i] / scale_;
+    rsp_ = table(scaled_rgb);
+  }
+  // *******************************************************************************************************************
+  //                                                                                                          METHODS
+  // *******************************************************************************************************************
+  /// \param lambda
+  /// \return
+  HERMES_DEVICE_CALLABLE real_t operator()(real_t lambda) const {
+    return scale_ * rsp_(lambda);
+  }
+  /// \param lambda
+  /// \return
+  [[nodiscard]] HERMES_DEVICE_CALLABLE SampledSpectrum Sample(const SampledWaveLengths &lambda) const {
+    SampledSpectrum s;
+    for (int i = 0; i < Spectrum::n_samples; ++i)
+      s[i] = (*this)(lambda[i]);
+    return s;
+  }
+  /// \return
+  [[nodiscard]] HERMES_DEVICE_CALLABLE real_t maxValue() const { return scale_ * rsp_.maxValue(); }
+  // *******************************************************************************************************************
+  //                                                                                                    PUBLIC FIELDS
+  // *******************************************************************************************************************
+private:
+  real_t scale_{0};
+  RGBSigmoidPolynomial rsp_;
+};
+
+}
+
+#endif //HELIOS_HELIOS_SPECTRUM_RGB_UNBOUNDED_SPECTRUM_H
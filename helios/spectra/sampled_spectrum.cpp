@@ -26,28 +26,35 @@
 ///\brief
 
 #include <helios/spectra/sampled_spectrum.h>
+#include <helios/spectra/sampled_wave_lengths.h>
 
 namespace helios {
 
-HERMES_DEVICE_CALLABLE SampledSpectrum::SampledSpectrum() {
-
-}
-
-HERMES_DEVICE_CALLABLE SampledSpectrum::SampledSpectrum(real_t v) {
-  c_ = v;
-}
-
 HERMES_DEVICE_CALLABLE SampledSpectrum::SampledSpectrum(hermes::ArraySlice<const real_t> v) {
   HERMES_CHECK_EXP(Spectrum::n_samples == v.size())
   for (int i = 0; i < Spectrum::n_samples; ++i)
     c_[i] = v[i];
 }
 
-HERMES_DEVICE_CALLABLE SampledSpectrum::operator bool() const {
-  for (int i = 0; i < Spectrum::n_samples; ++i)
-    if (c_[i] != 0)
-      return true;
-  return false;
+HERMES_DEVICE_CALLABLE void SampledSpectrum::toXYZ(const SampledWaveLengths &lambda, real_t xyz[3]) const {
+  auto pdf = lambda.pdf();
+  xyz[0] = xyz[1] = xyz[2] = 0;
+  for (int i = 0; i < Spectrum::n_samples; ++i) {
+    if (pdf[i] == 0)
+      continue;
+    real_t m[3];
+    CIEXYZ(lambda[i], m);
+    for (int c = 0; c < 3; ++c)
+      xyz[c] += m[c] * c_[i] / pdf[i];
+  }
+  for (int c = 0; c < 3; ++c)
+    xyz[c] /= Spectrum::n_samples * CIE_Y_integral;
+}
+
+HERMES_DEVICE_CALLABLE real_t SampledSpectrum::y(const SampledWaveLengths &lambda) const {
+  real_t xyz[3];
+  toXYZ(lambda, xyz);
+  return xyz[1];
 }
 
 }
@@ -34,11 +34,15 @@
 
 namespace helios {
 
+class SampledWaveLengths;
+
 // *********************************************************************************************************************
 //                                                                                                    SampledSpectrum
 // *********************************************************************************************************************
 /// Represents a SPD with uniformly spaced samples over a wavelength range.
 /// The wavelengths range covers from 400 nm to 700 nm
+/// \note Samples are stored in a single aligned vector so arithmetic compiles to one 128 bit load/store and
+/// \note packed operations (SSE/NEON lanes on the host, vectorized memory access on the device).
 class SampledSpectrum {
 public:
   // *******************************************************************************************************************
@@ -50,14 +54,22 @@ public:
   // *******************************************************************************************************************
   //                                                                                                     CONSTRUCTORS
   // *******************************************************************************************************************
-  HERMES_DEVICE_CALLABLE SampledSpectrum();
-  HERMES_DEVICE_CALLABLE explicit SampledSpectrum(real_t v);
+  HERMES_DEVICE_CALLABLE SampledSpectrum() : SampledSpectrum(0) {}
+  HERMES_DEVICE_CALLABLE explicit SampledSpectrum(real_t v) {
+    for (int i = 0; i < Spectrum::n_samples; ++i)
+      c_[i] = v;
+  }
   HERMES_DEVICE_CALLABLE explicit SampledSpectrum(hermes::ArraySlice<const real_t> v);
   //                                                                                                       assignment
   // *******************************************************************************************************************
   //                                                                                                        OPERATORS
   // *******************************************************************************************************************
-  HERMES_DEVICE_CALLABLE explicit operator bool() const;
+  HERMES_DEVICE_CALLABLE explicit operator bool() const {
+    bool non_zero = false;
+    for (int i = 0; i < Spectrum::n_samples; ++i)
+      non_zero |= c_[i] != 0;
+    return non_zero;
+  }
   //                                                                                                       assignment
   HERMES_DEVICE_CALLABLE real_t &operator[](int i) { return c_[i]; }
   HERMES_DEVICE_CALLABLE real_t operator[](int i) const { return c_[i]; }
@@ -93,13 +105,31 @@ HERMES_DEVICE_CALLABLE SampledSpectrum operator OP(const SampledSpectrum & s2) c
   // *******************************************************************************************************************
   //                                                                                                          METHODS
   // *******************************************************************************************************************
+  /// \return average of the samples
+  [[nodiscard]] HERMES_DEVICE_CALLABLE real_t average() const {
+    real_t sum = 0;
+    for (int i = 0; i < Spectrum::n_samples; ++i)
+      sum += c_[i];
+    return sum / Spectrum::n_samples;
+  }
+  /// Estimates the XYZ color of the spectrum from its samples (fixed cost, matching functions are
+  /// evaluated with a direct table index)
+  /// \param lambda wavelengths (and their pdfs) the spectrum was sampled at
+  /// \param xyz **[out]**
+  HERMES_DEVICE_CALLABLE void toXYZ(const SampledWaveLengths &lambda, real_t xyz[3]) const;
+  /// \param lambda wavelengths (and their pdfs) the spectrum was sampled at
+  /// \return estimate of the Y coordinate of XYZ color
+  [[nodiscard]] HERMES_DEVICE_CALLABLE real_t y(const SampledWaveLengths &lambda) const;
   // *******************************************************************************************************************
   //                                                                                                    PUBLIC FIELDS
   // *******************************************************************************************************************
 private:
-  hermes::CArray<real_t, Spectrum::n_samples> c_;
+  alignas(Spectrum::n_samples * sizeof(real_t)) real_t c_[Spectrum::n_samples];
 };
 
+static_assert(std::is_trivially_copyable_v<SampledSpectrum>);
+static_assert(sizeof(SampledSpectrum) == Spectrum::n_samples * sizeof(real_t));
+
 }
 
 #endif //HELIOS_HELIOS_SPECTRUM_SAMPLED_SPECTRUM_H
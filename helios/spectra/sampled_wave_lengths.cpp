@@ -26,3 +26,37 @@
 ///\brief
 
 #include "sampled_wave_lengths.h"
+
+namespace helios {
+
+HERMES_DEVICE_CALLABLE SampledWaveLengths SampledWaveLengths::sampleUniform(real_t u,
+                                                                            real_t lambda_min,
+                                                                            real_t lambda_max) {
+  SampledWaveLengths swl;
+  // hero wavelength, the others are equally spaced (wrapping around the range)
+  swl.lambda_[0] = (1 - u) * lambda_min + u * lambda_max;
+  real_t delta = (lambda_max - lambda_min) / Spectrum::n_samples;
+  for (int i = 1; i < Spectrum::n_samples; ++i) {
+    swl.lambda_[i] = swl.lambda_[i - 1] + delta;
+    if (swl.lambda_[i] > lambda_max)
+      swl.lambda_[i] = lambda_min + (swl.lambda_[i] - lambda_max);
+  }
+  for (int i = 0; i < Spectrum::n_samples; ++i)
+    swl.pdf_[i] = 1 / (lambda_max - lambda_min);
+  return swl;
+}
+
+HERMES_DEVICE_CALLABLE SampledWaveLengths SampledWaveLengths::sampleVisible(real_t u) {
+  SampledWaveLengths swl;
+  for (int i = 0; i < Spectrum::n_samples; ++i) {
+    // equally spaced in sample space (rotations of the hero sample)
+    real_t up = u + static_cast<real_t>(i) / Spectrum::n_samples;
+    if (up > 1)
+      up -= 1;
+    swl.lambda_[i] = sampleVisibleWaveLength(up);
+    swl.pdf_[i] = visibleWaveLengthPDF(swl.lambda_[i]);
+  }
+  return swl;
+}
+
+}
@@ -35,11 +35,43 @@ namespace helios {
 // *********************************************************************************************************************
 //                                                                                                 SampledWaveLengths
 // *********************************************************************************************************************
+/// Set of Spectrum::n_samples wavelengths carried by a light path, with the probability density each one was
+/// sampled with. Wavelengths are generated from a single (hero) sample and equally spaced over the sampling
+/// distribution, so a single random number stratifies all of them.
 class SampledWaveLengths {
 public:
   // *******************************************************************************************************************
   //                                                                                                   STATIC METHODS
   // *******************************************************************************************************************
+  /// Samples wavelengths uniformly
+  /// \param u uniform sample in [0, 1)
+  /// \param lambda_min
+  /// \param lambda_max
+  /// \return
+  HERMES_DEVICE_CALLABLE static SampledWaveLengths sampleUniform(real_t u,
+                                                                real_t lambda_min = CIELambdaStart,
+                                                                real_t lambda_max = CIELambdaEnd);
+  /// Samples wavelengths proportionally to visibleWaveLengthPDF (importance sampling of the human visual
+  /// response), which reduces color noise when spectra are converted to XYZ
+  /// \param u uniform sample in [0, 1)
+  /// \return
+  HERMES_DEVICE_CALLABLE static SampledWaveLengths sampleVisible(real_t u);
+  /// Smooth approximation of the luminance response, p(lambda) ~ 1 / cosh^2(0.0072 (lambda - 538)) normalized
+  /// over [360, 830]
+  /// \param lambda
+  /// \return
+  HERMES_DEVICE_CALLABLE static real_t visibleWaveLengthPDF(real_t lambda) {
+    if (lambda < CIELambdaStart || lambda > CIELambdaEnd)
+      return 0;
+    real_t c = coshf(0.0072f * (lambda - 538));
+    return 0.0039398042f / (c * c);
+  }
+  /// Inverse of the visibleWaveLengthPDF cdf
+  /// \param u uniform sample in [0, 1)
+  /// \return wavelength in [360, 830]
+  HERMES_DEVICE_CALLABLE static real_t sampleVisibleWaveLength(real_t u) {
+    return 538 - 138.888889f * atanhf(0.85691062f - 1.82750197f * u);
+  }
   // *******************************************************************************************************************
   //                                                                                                 FRIEND FUNCTIONS
   // *******************************************************************************************************************
@@ -58,6 +90,13 @@ public:
   // *******************************************************************************************************************
   //                                                                                                          METHODS
   // *******************************************************************************************************************
+  /// \return probability density of each wavelength
+  [[nodiscard]] HERMES_DEVICE_CALLABLE SampledSpectrum pdf() const {
+    SampledSpectrum p;
+    for (int i = 0; i < Spectrum::n_samples; ++i)
+      p[i] = pdf_[i];
+    return p;
+  }
   [[nodiscard]] HERMES_DEVICE_CALLABLE bool secondaryTerminated() const {
     for (int i = 1; i < Spectrum::n_samples; ++i)
       if (pdf_[i] != 0)
@@ -0,0 +1,133 @@
+/// Copyright (c) 2021, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+///\file spectrum_cache.cpp
+///\author FilipeCN (filipedecn@gmail.com)
+///\date 2021-10-19
+///
+///\brief
+
+#include <helios/spectra/spectrum_cache.h>
+#include <helios/spectra/densely_sampled_spectrum.h>
+#include <helios/common/hash.h>
+#include <cstring>
+
+namespace helios {
+
+namespace {
+
+u64 hashPayload(SpectrumType type, const void *payload, std::size_t size_in_bytes) {
+  u64 h = hash::values(static_cast<u64>(type), size_in_bytes);
+  const auto *bytes = reinterpret_cast<const u8 *>(payload);
+  std::size_t i = 0;
+  for (; i + sizeof(u64) <= size_in_bytes; i += sizeof(u64)) {
+    u64 word;
+    std::memcpy(&word, bytes + i, sizeof(u64));
+    h = hash::combine(h, word);
+  }
+  for (; i < size_in_bytes; ++i)
+    h = hash::combine(h, bytes[i]);
+  return h;
+}
+
+/// \param lambda wavelength (nm)
+/// \return BK7 index of refraction
+real_t bk7(real_t lambda) {
+  const real_t b[3] = {1.03961212f, 0.231792344f, 1.01046945f};
+  const real_t c[3] = {0.00600069867f, 0.0200179144f, 103.560653f};
+  real_t l2 = lambda * lambda * 1e-6f;
+  real_t n2 = 1;
+  for (int i = 0; i < 3; ++i)
+    n2 += b[i] * l2 / (l2 - c[i]);
+  return sqrtf(n2);
+}
+
+}
+
+Spectrum SpectrumCache::named(const std::string &name) {
+  auto &cache = instance();
+  cache.sync();
+  auto it = cache.named_.find(name);
+  if (it != cache.named_.end())
+    return it->second;
+  static const std::unordered_map<std::string, std::function<real_t(real_t)>> functions = {
+      {"stdillum-D65", illuminantD65},
+      {"cie-x", [](real_t lambda) { real_t xyz[3]; CIEXYZ(lambda, xyz); return xyz[0]; }},
+      {"cie-y", [](real_t lambda) { real_t xyz[3]; CIEXYZ(lambda, xyz); return xyz[1]; }},
+      {"cie-z", [](real_t lambda) { real_t xyz[3]; CIEXYZ(lambda, xyz); return xyz[2]; }},
+      {"glass-BK7", bk7},
+  };
+  auto f = functions.find(name);
+  if (f == functions.end())
+    return {};
+  auto spectrum = get<DenselySampledSpectrum>(DenselySampledSpectrum::sampled(f->second));
+  cache.named_[name] = spectrum;
+  return spectrum;
+}
+
+std::size_t SpectrumCache::size() {
+  instance().sync();
+  return instance().entries_.size();
+}
+
+std::size_t SpectrumCache::hitCount() {
+  return instance().hit_count_;
+}
+
+void SpectrumCache::clear() {
+  auto &cache = instance();
+  cache.entries_.clear();
+  cache.named_.clear();
+  cache.hit_count_ = 0;
+}
+
+SpectrumCache &SpectrumCache::instance() {
+  static SpectrumCache singleton;
+  return singleton;
+}
+
+void SpectrumCache::sync() {
+  if (epoch_ == mem::epoch())
+    return;
+  clear();
+  epoch_ = mem::epoch();
+}
+
+Spectrum SpectrumCache::intern(SpectrumType type, const void *payload, std::size_t size_in_bytes,
+                               const std::function<mem::Ptr()> &allocate) {
+  sync();
+  u64 key = hashPayload(type, payload, size_in_bytes);
+  auto range = entries_.equal_range(key);
+  for (auto it = range.first; it != range.second; ++it)
+    if (it->second.spectrum.type == type && it->second.size_in_bytes == size_in_bytes &&
+        std::memcmp(it->second.spectrum.data_ptr.get<u8>(), payload, size_in_bytes) == 0) {
+      hit_count_++;
+      return it->second.spectrum;
+    }
+  Spectrum spectrum;
+  spectrum.data_ptr = allocate();
+  spectrum.type = type;
+  if (spectrum)
+    entries_.insert({key, {spectrum, size_in_bytes}});
+  return spectrum;
+}
+
+}
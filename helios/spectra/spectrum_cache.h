@@ -0,0 +1,96 @@
+/// Copyright (c) 2021, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+///\file spectrum_cache.h
+///\author FilipeCN (filipedecn@gmail.com)
+///\date 2021-10-19
+///
+///\brief Interning of spectrum payloads
+
+#ifndef HELIOS_HELIOS_SPECTRUM_SPECTRUM_CACHE_H
+#define HELIOS_HELIOS_SPECTRUM_SPECTRUM_CACHE_H
+
+#include <helios/base/spectrum.h>
+#include <functional>
+#include <string>
+#include <unordered_map>
+
+namespace helios {
+
+// *********************************************************************************************************************
+//                                                                                                      SpectrumCache
+// *********************************************************************************************************************
+/// Registry of spectrum payloads living in the mem arena. Spectra are interned by content (type + payload bytes),
+/// so materials and lights that describe the same spectrum share a single mem::Ptr. Commonly used spectra can be
+/// requested by name and are created on first use.
+/// \note Entries belong to the arena they were allocated in, the cache is emptied when mem::init is called
+class SpectrumCache {
+public:
+  // *******************************************************************************************************************
+  //                                                                                                   STATIC METHODS
+  // *******************************************************************************************************************
+  /// Gets the interned spectrum equal to T(params...), allocating it in the mem arena only if no such spectrum
+  /// exists yet
+  /// \tparam T spectrum payload type (must be trivially copyable)
+  /// \tparam P
+  /// \param params T constructor parameters
+  /// \return
+  template<typename T, class... P>
+  static Spectrum get(P &&... params) {
+    static_assert(std::is_trivially_copyable_v<T>, "interned spectra are compared by their bytes");
+    T value(std::forward<P>(params)...);
+    return instance().intern(T::createSpectrum(mem::Ptr()).type, &value, sizeof(T),
+                             [&]() { return mem::allocate<T>(value); });
+  }
+  /// Gets a named spectrum. Available names are:
+  ///   "stdillum-D65" : CIE standard illuminant D65 (unit luminance)
+  ///   "cie-x", "cie-y", "cie-z" : CIE 1931 matching functions
+  ///   "glass-BK7" : BK7 glass index of refraction (Sellmeier equation)
+  /// \param name
+  /// \return empty spectrum if name is unknown
+  static Spectrum named(const std::string &name);
+  /// \return number of distinct interned spectra
+  static std::size_t size();
+  /// \return number of requests resolved to an existing spectrum
+  static std::size_t hitCount();
+  /// Forgets all interned spectra (their payloads stay in the arena)
+  static void clear();
+
+private:
+  static SpectrumCache &instance();
+  /// Drops entries that belonged to a previous arena
+  void sync();
+  Spectrum intern(SpectrumType type, const void *payload, std::size_t size_in_bytes,
+                  const std::function<mem::Ptr()> &allocate);
+
+  struct Entry {
+    Spectrum spectrum;
+    std::size_t size_in_bytes;
+  };
+  std::unordered_multimap<u64, Entry> entries_;
+  std::unordered_map<std::string, Spectrum> named_;
+  std::size_t hit_count_{0};
+  std::size_t epoch_{0};
+};
+
+} // namespace helios
+
+#endif // HELIOS_HELIOS_SPECTRUM_SPECTRUM_CACHE_H
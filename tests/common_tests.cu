@@ -1,4 +1,177 @@
 #include <catch2/catch.hpp>
 
+#include <helios/common/globals.h>
+#include <helios/common/io.h>
+
+#define STB_IMAGE_IMPLEMENTATION
+#define STBI_ONLY_PNG
+#include <stb_image.h>
+
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+using namespace helios;
+
 TEST_CASE("Reduce", "[common][reduce]") {
-}
\ No newline at end of file
+}
+
+TEST_CASE("half precision", "[common]") {
+  REQUIRE(globals::floatToHalf(0.f) == 0);
+  REQUIRE(globals::floatToHalf(1.f) == 0x3c00);
+  REQUIRE(globals::floatToHalf(-2.f) == 0xc000);
+  REQUIRE(globals::floatToHalf(65504.f) == 0x7bff);
+  REQUIRE(globals::floatToHalf(1e6f) == 0x7c00);
+  REQUIRE(globals::halfToFloat(0x0001) == Approx(5.9604645e-8f));
+  // every finite half value survives a round trip
+  for (u32 bits = 0; bits < 0x7c00; ++bits) {
+    REQUIRE(globals::floatToHalf(globals::halfToFloat(bits)) == bits);
+    REQUIRE(globals::floatToHalf(globals::halfToFloat(bits | 0x8000)) == (bits | 0x8000));
+  }
+  REQUIRE(globals::halfToFloat(globals::floatToHalf(0.3f)) == Approx(0.3f).epsilon(1e-3));
+}
+
+TEST_CASE("exr output", "[common][io]") {
+  const int width = 40, height = 24;
+  std::vector<real_t> rgb(3 * width * height);
+  for (int i = 0; i < width * height; ++i) {
+    rgb[3 * i + 0] = 0.1f * (i % width);
+    rgb[3 * i + 1] = 0.05f * (i / width);
+    rgb[3 * i + 2] = 2.5f;
+  }
+  bounds2i bounds({0, 0}, {width, height});
+  io::ExrOptions options;
+  options.compression = io::ExrCompression::NONE;
+  options.pixel_type = io::ExrPixelType::FLOAT;
+  auto raw = io::encodeEXR(rgb.data(), bounds, {width, height}, options);
+  REQUIRE(raw.size() > 4);
+  i32 magic = 0;
+  memcpy(&magic, raw.data(), 4);
+  REQUIRE(magic == 20000630);
+  // the last chunk holds the last scanline as B, G and R planes
+  const u8 *last_line = raw.data() + raw.size() - 3 * width * sizeof(f32);
+  for (int x = 0; x < width; ++x)
+    for (int c = 0; c < 3; ++c) {
+      f32 value = 0;
+      memcpy(&value, last_line + ((2 - c) * width + x) * sizeof(f32), sizeof(f32));
+      REQUIRE(value == rgb[3 * ((height - 1) * width + x) + c]);
+    }
+  // compressed blocks do not depend on how they were spread across threads
+  for (int tile_size : {0, 16}) {
+    options.compression = io::ExrCompression::ZIP;
+    options.pixel_type = io::ExrPixelType::HALF;
+    options.tile_size = tile_size;
+    options.thread_count = 1;
+    auto single_thread = io::encodeEXR(rgb.data(), bounds, {width, height}, options);
+    options.thread_count = 4;
+    auto multi_thread = io::encodeEXR(rgb.data(), bounds, {width, height}, options);
+    REQUIRE(single_thread == multi_thread);
+    REQUIRE(single_thread.size() < raw.size() / 2);
+    // skip the header attributes (name, type, size and value) to reach the offset table
+    size_t pos = 8;
+    while (single_thread[pos]) {
+      pos += strlen(reinterpret_cast<const char *>(&single_thread[pos])) + 1;
+      pos += strlen(reinterpret_cast<const char *>(&single_thread[pos])) + 1;
+      i32 attribute_size = 0;
+      memcpy(&attribute_size, &single_thread[pos], 4);
+      pos += 4 + attribute_size;
+    }
+    u64 chunk_offset = 0;
+    memcpy(&chunk_offset, &single_thread[pos + 1], 8);
+    // the first chunk covers 16 scanlines (or the first 16x16 tile)
+    size_t chunk_header_size = tile_size ? 16 : 4;
+    i32 data_size = 0;
+    memcpy(&data_size, &single_thread[chunk_offset + chunk_header_size], 4);
+    int inflated_size = 0;
+    char *inflated = stbi_zlib_decode_malloc(
+        reinterpret_cast<const char *>(&single_thread[chunk_offset + chunk_header_size + 4]), data_size,
+        &inflated_size);
+    REQUIRE(inflated);
+    const int block_width = tile_size ? tile_size : width, block_height = 16;
+    REQUIRE(inflated_size == 3 * 2 * block_width * block_height);
+    // undo the delta predictor, then interleave both halves back
+    std::vector<u8> reordered(inflated, inflated + inflated_size);
+    free(inflated);
+    for (size_t i = 1; i < reordered.size(); ++i)
+      reordered[i] = static_cast<u8>(reordered[i - 1] + reordered[i] - 128);
+    std::vector<u8> data(reordered.size());
+    for (size_t i = 0, half = (data.size() + 1) / 2; i < data.size(); ++i)
+      data[i] = reordered[(i % 2) ? half + i / 2 : i / 2];
+    // scanlines hold B, G and R planes
+    for (int y = 0; y < block_height; ++y)
+      for (int c = 0; c < 3; ++c)
+        for (int x = 0; x < block_width; ++x) {
+          u16 value = 0;
+          memcpy(&value, &data[2 * ((3 * y + 2 - c) * block_width + x)], 2);
+          REQUIRE(value == globals::floatToHalf(rgb[3 * (y * width + x) + c]));
+        }
+  }
+}
+
+TEST_CASE("png output", "[common][io]") {
+  // quantization table matches the gamma curve
+  for (int i = -16; i < 70000; ++i) {
+    real_t value = i * 1.6e-5f;
+    auto expected = static_cast<u8>(hermes::Numbers::clamp(255.f * globals::gammaCorrect(value) + 0.5f, 0.f, 255.f));
+    REQUIRE(io::linearToSRGB8(value) == expected);
+  }
+  // decoded pixels are the quantized input
+  auto check_decoded = [](const std::vector<u8> &png, const std::vector<real_t> &rgb, int width, int height) {
+    int decoded_width = 0, decoded_height = 0, channel_count = 0;
+    u8 *pixels = stbi_load_from_memory(png.data(), static_cast<int>(png.size()), &decoded_width, &decoded_height,
+                                       &channel_count, 3);
+    REQUIRE(pixels);
+    REQUIRE(decoded_width == width);
+    REQUIRE(decoded_height == height);
+    REQUIRE(channel_count == 3);
+    size_t mismatch_count = 0;
+    for (size_t i = 0; i < rgb.size(); ++i)
+      mismatch_count += pixels[i] != io::linearToSRGB8(rgb[i]);
+    stbi_image_free(pixels);
+    REQUIRE(mismatch_count == 0);
+  };
+  const int width = 300, height = 1000;
+  std::vector<real_t> rgb(3 * width * height);
+  for (int i = 0; i < width * height; ++i) {
+    rgb[3 * i + 0] = static_cast<real_t>(i % width) / width;
+    rgb[3 * i + 1] = static_cast<real_t>(i / width) / height;
+    rgb[3 * i + 2] = 0.5f;
+  }
+  // strips are independent of how they were spread across threads
+  auto single_thread = io::encodePNG(rgb.data(), {width, height}, 1);
+  auto multi_thread = io::encodePNG(rgb.data(), {width, height}, 4);
+  REQUIRE(single_thread.size() > 8);
+  REQUIRE(single_thread == multi_thread);
+  REQUIRE(single_thread[1] == 'P');
+  REQUIRE(single_thread.size() < rgb.size() / 2);
+  // several strips joined into a single stream
+  check_decoded(multi_thread, rgb, width, height);
+  // a single strip holding a few rows
+  std::vector<real_t> small_rgb(rgb.begin(), rgb.begin() + 3 * 7 * 5);
+  check_decoded(io::encodePNG(small_rgb.data(), {7, 5}, 4), small_rgb, 7, 5);
+  // noise (out of range values included) leaves nothing to compress and is stored almost literally
+  std::vector<real_t> noise(3 * 64 * 64);
+  for (size_t i = 0; i < noise.size(); ++i) {
+    u32 h = static_cast<u32>(i) * 0x9e3779b9u;
+    h ^= h >> 16;
+    h *= 0x85ebca6bu;
+    h ^= h >> 13;
+    noise[i] = static_cast<real_t>(h & 0xffff) / 50000.f - 0.1f;
+  }
+  auto noise_png = io::encodePNG(noise.data(), {64, 64}, 4);
+  REQUIRE(noise_png.size() > noise.size() / 2);
+  check_decoded(noise_png, noise, 64, 64);
+  // images read in bands of rows are joined into a single stream
+  auto read_rows = [&](int row_begin, int row_end) {
+    hermes::Array<real_t> rows(3 * width * (row_end - row_begin));
+    std::memcpy(rows.data(), rgb.data() + 3 * width * row_begin, rows.size() * sizeof(real_t));
+    return rows;
+  };
+  bounds2i bounds({0, 0}, {width, height});
+  REQUIRE(io::saveRows(read_rows, "banded.png", bounds, {width, height}, 37));
+  std::ifstream file("banded.png", std::ios::binary);
+  std::vector<u8> banded_png((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  check_decoded(banded_png, rgb, width, height);
+  // short reads are reported
+  REQUIRE(!io::saveRows([](int, int) { return hermes::Array<real_t>(); }, "banded.png", bounds, {width, height}));
+}
@@ -41,6 +41,9 @@
 #include <helios/shapes.h>
 #include <helios/base/bxdf.h>
 
+#include <fstream>
+#include <iterator>
+
 using namespace helios;
 
 #define CUDA_REQUIRE(A) if(!(A)) return;
@@ -88,6 +91,446 @@ TEST_CASE("film") {
   REQUIRE(film.physicalExtent().extends().length() == Approx(0.01));
 }
 
+namespace {
+
+class TentTestFilter : public Filter {
+public:
+  explicit TentTestFilter(const hermes::vec2 &radius) : Filter(radius) {}
+  [[nodiscard]] real_t evaluate(const hermes::point2 &p) const override {
+    return std::max<real_t>(0, radius.x - std::abs(p.x)) * std::max<real_t>(0, radius.y - std::abs(p.y));
+  }
+};
+
+// straightforward per pixel table lookup used as reference for FilmTile::addSample
+void referenceAddSample(const Film &film, const bounds2i &pixel_bounds, FilmTilePixel *pixels,
+                        const hermes::point2 &p, const SpectrumOld &L, real_t sample_weight) {
+  const auto &filter = film.filter;
+  auto width = pixel_bounds.upper().i - pixel_bounds.lower().i;
+  hermes::point2 p_discrete = p - hermes::vec2(0.5f);
+  for (int y = pixel_bounds.lower().j; y < pixel_bounds.upper().j; ++y)
+    for (int x = pixel_bounds.lower().i; x < pixel_bounds.upper().i; ++x) {
+      if (std::abs(x - p_discrete.x) > filter.radius.x || std::abs(y - p_discrete.y) > filter.radius.y)
+        continue;
+      int ifx = std::min((int) std::floor(std::abs((x - p_discrete.x) * filter.inv_radius.x * filter.table_width)),
+                         filter.table_width - 1);
+      int ify = std::min((int) std::floor(std::abs((y - p_discrete.y) * filter.inv_radius.y * filter.table_width)),
+                         filter.table_width - 1);
+      real_t filter_weight = filter.evaluate(ifx, ify);
+      auto &pixel = pixels[(x - pixel_bounds.lower().i) + (y - pixel_bounds.lower().j) * width];
+      pixel.contrib_sum += L * sample_weight * filter_weight;
+      pixel.filter_weight_sum += filter_weight;
+    }
+}
+
+}
+
+TEST_CASE("film tile samples", "[core]") {
+  TentTestFilter filter({2.5, 1.5});
+  Film film({32, 32}, &filter, 10);
+  auto tile = film.filmTile(bounds2i(hermes::index2(4, 4), hermes::index2(20, 20)));
+  auto pixel_bounds = tile.getPixelBounds();
+  std::vector<FilmTilePixel> reference(pixel_bounds.area());
+  hermes::point2 samples[] = {{10.3, 11.7}, {4.1, 4.9}, {19.5, 12.5}, {12.f, 19.99f}, {0.5, 0.5}};
+  for (const auto &sample : samples) {
+    SpectrumOld L(sample.x * 0.1f);
+    tile.addSample(sample, L, 0.75);
+    referenceAddSample(film, pixel_bounds, reference.data(), sample, L, 0.75);
+  }
+  for (auto ij : pixel_bounds) {
+    const auto &pixel = tile.getPixel(ij);
+    const auto &expected = reference[(ij.i - pixel_bounds.lower().i)
+        + (ij.j - pixel_bounds.lower().j) * (pixel_bounds.upper().i - pixel_bounds.lower().i)];
+    REQUIRE(pixel.filter_weight_sum == expected.filter_weight_sum);
+    for (int c = 0; c < 3; ++c)
+      REQUIRE(pixel.contrib_sum[c] == expected.contrib_sum[c]);
+  }
+}
+
+TEST_CASE("film pixel variance", "[core]") {
+  BoxFilter filter({1, 1});
+  Film film({16, 16}, &filter, 10);
+  auto tile = film.filmTile(bounds2i(hermes::index2(0, 0), hermes::index2(16, 16)));
+  // samples of a pixel only count for the pixel containing them
+  for (real_t l : {0.f, 2.f})
+    tile.addSample({3.25f, 5.75f}, SpectrumOld(l), 1);
+  tile.addSample({8.5f, 8.5f}, SpectrumOld(0.5f), 1);
+  REQUIRE(tile.getPixel({3, 5}).sample_count == 2);
+  REQUIRE(tile.getPixel({8, 8}).sample_count == 1);
+  REQUIRE(tile.getPixel({4, 5}).sample_count == 0);
+  FilmPixel pixel;
+  pixel.luminance_sum = tile.getPixel({3, 5}).luminance_sum;
+  pixel.luminance_sq_sum = tile.getPixel({3, 5}).luminance_sq_sum;
+  pixel.sample_count = 2;
+  // mean 1, variance 2, standard error 1
+  REQUIRE(pixel.relativeError() == Approx(1));
+  pixel.sample_count = 1;
+  REQUIRE(pixel.relativeError() > 1e6);
+  FilmPixel flat_pixel;
+  flat_pixel.luminance_sum = 4;
+  flat_pixel.luminance_sq_sum = 2;
+  flat_pixel.sample_count = 8;
+  REQUIRE(flat_pixel.relativeError() == Approx(0).margin(1e-6));
+}
+
+TEST_CASE("reconstruction filters", "[core]") {
+  SECTION("filter functions") {
+    GaussianFilter gaussian({1.5, 1.5}, 0.5);
+    REQUIRE(gaussian.evaluate({0, 0}) == Approx(std::pow(1 - std::exp(-4.5f), 2)));
+    REQUIRE(gaussian.evaluate({1.5, 0}) == Approx(0).margin(1e-6));
+    REQUIRE(gaussian.evaluate({2, 0.5}) == Approx(0));
+    MitchellFilter mitchell({2, 2});
+    // B = C = 1/3: f(0) = 8/9, f(1) = 1/18, f(2) = 0, negative lobe in between
+    REQUIRE(mitchell.evaluate({0, 0}) == Approx(64.f / 81));
+    REQUIRE(mitchell.evaluate({1, 0}) == Approx(8.f / 9 / 18));
+    REQUIRE(mitchell.evaluate({2, 0}) == Approx(0).margin(1e-6));
+    REQUIRE(mitchell.evaluate({1.5, 0}) < 0);
+    LanczosSincFilter lanczos({4, 4}, 3);
+    REQUIRE(lanczos.evaluate({0, 0}) == Approx(1));
+    REQUIRE(lanczos.evaluate({1, 0}) == Approx(0).margin(1e-6));
+    REQUIRE(lanczos.evaluate({1.5, 0}) < 0);
+    REQUIRE(lanczos.evaluate({4.5, 0}) == 0);
+  }
+  SECTION("separable tables") {
+    GaussianFilter gaussian;
+    MitchellFilter mitchell;
+    LanczosSincFilter lanczos;
+    TentTestFilter tent({2, 1});
+    for (const Filter *filter : std::vector<const Filter *>{&gaussian, &mitchell, &lanczos, &tent}) {
+      Film::PCF table(filter);
+      REQUIRE(table.table_width == filter->tableWidth());
+      for (int y = 0; y < table.table_width; ++y)
+        for (int x = 0; x < table.table_width; ++x) {
+          hermes::point2 p((x + 0.5f) * filter->radius.x / table.table_width,
+                           (y + 0.5f) * filter->radius.y / table.table_width);
+          REQUIRE(table.evaluate(x, y) == Approx(filter->evaluate(p)).margin(1e-6));
+        }
+    }
+    REQUIRE(Film::PCF(&mitchell).table_width == MitchellFilter::table_width);
+    BoxFilter box({1, 1});
+    REQUIRE(Film::PCF(&box).table_width == 1);
+    // wide filters are clamped to the largest footprint the film handles
+    BoxFilter wide_box({6, 2});
+    Film::PCF wide_table(&wide_box);
+    REQUIRE(wide_table.radius.x == Approx(Filter::max_radius));
+    REQUIRE(wide_table.radius.y == Approx(2));
+    REQUIRE(wide_table.inv_radius.x == Approx(1.f / Filter::max_radius));
+  }
+  SECTION("negative lobes") {
+    MitchellFilter mitchell;
+    Film::PCF table(&mitchell);
+    const int n = 256;
+    int negative = 0;
+    real_t sum = 0;
+    for (int j = 0; j < n; ++j)
+      for (int i = 0; i < n; ++i) {
+        auto s = table.sample({(i + 0.5f) / n, (j + 0.5f) / n});
+        REQUIRE(std::abs(s.weight) == Approx(table.abs_integral));
+        negative += s.weight < 0;
+        sum += s.weight;
+      }
+    REQUIRE(negative > 0);
+    // estimates the signed integral of the filter (Mitchell integrates to 1 over [-2,2]^2)
+    REQUIRE(sum / (n * n) == Approx(1).margin(0.02));
+  }
+}
+
+TEST_CASE("filter importance sampling", "[core]") {
+  auto check = [](const Film &film, real_t integral, real_t mean_x, real_t mean_y) {
+    const int n = 128;
+    real_t sum_x = 0, sum_abs_x = 0, sum_abs_y = 0;
+    for (int j = 0; j < n; ++j)
+      for (int i = 0; i < n; ++i) {
+        auto s = film.filter.sample({(i + 0.5f) / n, (j + 0.5f) / n});
+        REQUIRE(std::abs(s.p.x) <= film.filter.radius.x);
+        REQUIRE(std::abs(s.p.y) <= film.filter.radius.y);
+        REQUIRE(s.weight == Approx(integral));
+        sum_x += s.p.x;
+        sum_abs_x += std::abs(s.p.x);
+        sum_abs_y += std::abs(s.p.y);
+      }
+    REQUIRE(sum_x / (n * n) == Approx(0).margin(1e-4));
+    REQUIRE(sum_abs_x / (n * n) == Approx(mean_x).margin(0.01));
+    REQUIRE(sum_abs_y / (n * n) == Approx(mean_y).margin(0.01));
+  };
+  // uniform offsets
+  BoxFilter box({1.5, 0.5});
+  check(Film({16, 16}, &box, 10), 3, 0.75, 0.25);
+  // tent offsets concentrate around the center: E|x| = r / 3
+  TentTestFilter tent({2, 1});
+  check(Film({16, 16}, &tent, 10), 4, 2.f / 3, 1.f / 3);
+  // importance sampled films have disjoint tiles
+  Film film({32, 32}, &box, 10, bounds2::unitBox(), FilmFilterMode::IMPORTANCE);
+  REQUIRE(film.sampleBounds() == film.cropped_pixel_bounds);
+  bounds2i tile_bounds(hermes::index2(8, 8), hermes::index2(16, 16));
+  REQUIRE(film.filmTileBounds(tile_bounds) == tile_bounds);
+}
+
+TEST_CASE("film tile samples benchmark", "[.][benchmark]") {
+  TentTestFilter filter({2, 2});
+  Film film({64, 64}, &filter, 10);
+  auto tile = film.filmTile(bounds2i(hermes::index2(16, 16), hermes::index2(32, 32)));
+  const int n_samples = 16 * 16 * 16;
+  BENCHMARK("FilmTile::addSample (4096 samples)") {
+    for (int i = 0; i < n_samples; ++i)
+      tile.addSample(hermes::point2(16 + (i % 256) / 16.f, 16 + (i % 256) % 16 + (i / 256) / 16.f),
+                     SpectrumOld(1.f));
+    return tile.getPixel(hermes::index2(20, 20)).filter_weight_sum;
+  };
+}
+
+TEST_CASE("reconstruction filters benchmark", "[.][benchmark]") {
+  // film path cost grows with the footprint (radius) of each filter
+  auto addSamples = [](const Film &film) {
+    auto tile = film.filmTile(bounds2i(hermes::index2(16, 16), hermes::index2(32, 32)));
+    for (int i = 0; i < 16 * 16 * 16; ++i)
+      tile.addSample(hermes::point2(16 + (i % 256) / 16.f, 16 + (i % 256) % 16 + (i / 256) / 16.f),
+                     SpectrumOld(1.f));
+    return tile.getPixel(hermes::index2(20, 20)).filter_weight_sum;
+  };
+  BoxFilter box({0.5, 0.5});
+  GaussianFilter gaussian;
+  MitchellFilter mitchell;
+  LanczosSincFilter lanczos;
+  Film box_film({64, 64}, &box, 10);
+  Film gaussian_film({64, 64}, &gaussian, 10);
+  Film mitchell_film({64, 64}, &mitchell, 10);
+  Film lanczos_film({64, 64}, &lanczos, 10);
+  BENCHMARK("box (radius 0.5)") { return addSamples(box_film); };
+  BENCHMARK("gaussian (radius 1.5)") { return addSamples(gaussian_film); };
+  BENCHMARK("mitchell (radius 2)") { return addSamples(mitchell_film); };
+  BENCHMARK("lanczos (radius 4)") { return addSamples(lanczos_film); };
+}
+
+HERMES_CUDA_KERNEL(splat)(FilmImageView film_image, int n_threads, bool buffered) {
+  HERMES_CUDA_THREAD_INDEX_I
+  if (i >= n_threads)
+    return;
+  for (int k = 0; k < 200; ++k) {
+    hermes::point2 p((i + k) % 16 + 0.5f, (i * 7 + k / 3) % 16 + 0.5f);
+    SpectrumOld v(0.01f * (k % 5 + 1));
+    if (buffered)
+      film_image.addSplat(i, p, v);
+    else
+      film_image.addSplat(p, v);
+  }
+}
+
+TEST_CASE("film splats", "[core]") {
+  BoxFilter filter({1, 1});
+  int n_threads = 64;
+  FilmImage atomic_image(Film({16, 16}, &filter, 10));
+  HERMES_CUDA_LAUNCH_AND_SYNC((n_threads), splat_k, atomic_image.view(), n_threads, false)
+  auto reference = atomic_image.imagePixels();
+  // small segments are drained into the image several times per thread
+  FilmImage buffered_image(Film({16, 16}, &filter, 10));
+  REQUIRE(buffered_image.prepareSplats(n_threads, 32) == HeResult::SUCCESS);
+  HERMES_CUDA_LAUNCH_AND_SYNC((n_threads), splat_k, buffered_image.view(), n_threads, true)
+  buffered_image.mergeSplats();
+  auto image = buffered_image.imagePixels();
+  REQUIRE(image.size() == reference.size());
+  for (size_t i = 0; i < image.size(); ++i)
+    REQUIRE(image[i] == Approx(reference[i]).margin(1e-4));
+}
+
+HERMES_CUDA_KERNEL(splatPixel)(FilmImageView film_image, int n, hermes::point2 p) {
+  HERMES_CUDA_THREAD_INDEX_I
+  if (i < n)
+    film_image.addSplat(p, SpectrumOld(0.001f));
+}
+
+TEST_CASE("film compact splats", "[core]") {
+  BoxFilter filter({1, 1});
+  Film film({8, 8}, &filter, 10);
+  FilmImage full_image(film);
+  FilmImage compact_image(film, 1, FilmStorageMode::COMPACT);
+  // increments far below the half precision spacing of the sum still add up
+  int n = 8192;
+  HERMES_CUDA_LAUNCH_AND_SYNC((n), splatPixel_k, full_image.view(), n, hermes::point2(3.5f, 2.5f))
+  HERMES_CUDA_LAUNCH_AND_SYNC((n), splatPixel_k, compact_image.view(), n, hermes::point2(3.5f, 2.5f))
+  compact_image.mergeSplats();
+  auto reference = full_image.imagePixels();
+  auto image = compact_image.imagePixels();
+  REQUIRE(image.size() == reference.size());
+  for (size_t i = 0; i < image.size(); ++i)
+    REQUIRE(image[i] == Approx(reference[i]).epsilon(2e-3).margin(1e-4));
+}
+
+TEST_CASE("film compact storage", "[core]") {
+  BoxFilter filter({1, 1});
+  Film film({32, 16}, &filter, 10);
+  FilmImage full_image(film);
+  FilmImage compact_image(film, 1, FilmStorageMode::COMPACT);
+  REQUIRE(compact_image.storageMode() == FilmStorageMode::COMPACT);
+  REQUIRE(compact_image.memorySize() * 2 < full_image.memorySize());
+  hermes::Array<SpectrumOld> img(film.cropped_pixel_bounds.area());
+  for (size_t i = 0; i < img.size(); ++i)
+    img[i] = SpectrumOld(0.001f * i);
+  REQUIRE(full_image.setImage(img) == HeResult::SUCCESS);
+  REQUIRE(compact_image.setImage(img) == HeResult::SUCCESS);
+  auto reference = full_image.imagePixels();
+  auto image = compact_image.imagePixels();
+  REQUIRE(image.size() == reference.size());
+  for (size_t i = 0; i < image.size(); ++i)
+    REQUIRE(image[i] == Approx(reference[i]).epsilon(2e-3).margin(1e-4));
+}
+
+HERMES_CUDA_KERNEL(fillRows)(FilmImageView film_image, bounds2i rows) {
+  HERMES_CUDA_THREAD_INDEX_IJ_LT(rows.upper() - rows.lower())
+  auto p = ij + rows.lower();
+  FilmPixel pixel;
+  pixel.xyz[0] = 0.01f * p.i;
+  pixel.xyz[1] = 0.02f * p.j;
+  pixel.xyz[2] = 0.1f;
+  pixel.filter_weight_sum = 1;
+  film_image.setPixel(p, pixel);
+}
+
+TEST_CASE("film streaming", "[core]") {
+  BoxFilter filter({1, 1});
+  Film film({24, 20}, &filter, 10);
+  FilmImage full_image(film);
+  HERMES_CUDA_LAUNCH_AND_SYNC((hermes::size2(24, 20)), fillRows_k, full_image.view(), film.cropped_pixel_bounds)
+  auto reference = full_image.imagePixels();
+  // same image kept in a band of 4 rows, filled and released 3 rows at a time
+  FilmImage streamed_image(film);
+  REQUIRE(streamed_image.streamTo("film_stream.raw", 4) == HeResult::SUCCESS);
+  REQUIRE(streamed_image.memorySize() * 4 < full_image.memorySize());
+  for (int row = 0; row < 20; row += 3) {
+    REQUIRE(streamed_image.firstResidentRow() == row);
+    bounds2i rows({0, row}, {24, std::min(row + 3, 20)});
+    HERMES_CUDA_LAUNCH_AND_SYNC((hermes::size2(24, rows.upper().j - row)), fillRows_k, streamed_image.view(), rows)
+    // previews only hold finished rows and leave the band in place
+    REQUIRE(streamed_image.imagePixels().size() == row * 24 * 3);
+    REQUIRE(streamed_image.firstResidentRow() == row);
+    REQUIRE(streamed_image.save("film_stream.exr") == HeResult::INVALID_INPUT);
+    // restreaming would discard the samples (and finished rows)
+    REQUIRE(streamed_image.streamTo("film_stream.raw", 4) == HeResult::INVALID_INPUT);
+    REQUIRE(streamed_image.finishRows(row + 3) == HeResult::SUCCESS);
+  }
+  auto partial = streamed_image.readRows(5, 9);
+  REQUIRE(partial.size() == 4 * 24 * 3);
+  for (size_t i = 0; i < partial.size(); ++i)
+    REQUIRE(partial[i] == reference[5 * 24 * 3 + i]);
+  auto image = streamed_image.imagePixels();
+  REQUIRE(image.size() == reference.size());
+  for (size_t i = 0; i < image.size(); ++i)
+    REQUIRE(image[i] == reference[i]);
+  // saving in bands of rows writes the same file
+  auto read_file = [](const char *filename) {
+    std::ifstream file(filename, std::ios::binary);
+    return std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+  };
+  REQUIRE(full_image.save("film_full.exr") == HeResult::SUCCESS);
+  REQUIRE(streamed_image.save("film_stream.exr", 5) == HeResult::SUCCESS);
+  auto full_file = read_file("film_full.exr");
+  REQUIRE(!full_file.empty());
+  REQUIRE(read_file("film_stream.exr") == full_file);
+}
+
+HERMES_CUDA_KERNEL(splatAt)(FilmImageView film_image, hermes::point2 p) {
+  HERMES_CUDA_THREAD_INDEX_I
+  if (i == 0)
+    film_image.addSplat(p, SpectrumOld(0.5f));
+}
+
+TEST_CASE("film dirty regions", "[core]") {
+  BoxFilter filter({1, 1});
+  Film film({40, 20}, &filter, 10);
+  FilmImage film_image(film);
+  REQUIRE(film_image.dirtyBlockCount() == 0);
+  hermes::Array<SpectrumOld> img(film.cropped_pixel_bounds.area());
+  for (size_t i = 0; i < img.size(); ++i)
+    img[i] = SpectrumOld(0.001f * i);
+  REQUIRE(film_image.setImage(img) == HeResult::SUCCESS);
+  REQUIRE(film_image.dirtyBlockCount() == 6);
+  // resolved regions cover the whole image
+  auto check_regions = [&](const bounds2i &region, const real_t *rgb) {
+    auto reference = film_image.imagePixels();
+    int width = region.upper().i - region.lower().i;
+    for (auto p : region)
+      for (int c = 0; c < 3; ++c)
+        REQUIRE(rgb[((p.i - region.lower().i) + (p.j - region.lower().j) * width) * 3 + c]
+                    == Approx(reference[(p.i + p.j * 40) * 3 + c]));
+  };
+  size_t resolved_area = 0;
+  REQUIRE(film_image.resolveDirtyRegions([&](const bounds2i &region, const real_t *rgb) {
+    resolved_area += region.area();
+    check_regions(region, rgb);
+  }) == 6);
+  REQUIRE(resolved_area == film.cropped_pixel_bounds.area());
+  REQUIRE(film_image.resolveDirtyRegions(check_regions) == 0);
+  // a single splat dirties a single block
+  HERMES_CUDA_LAUNCH_AND_SYNC((1), splatAt_k, film_image.view(), hermes::point2(20.5f, 3.5f))
+  REQUIRE(film_image.dirtyBlockCount() == 1);
+  REQUIRE(film_image.resolveDirtyRegions([&](const bounds2i &region, const real_t *rgb) {
+    REQUIRE(region.lower() == hermes::index2(16, 0));
+    REQUIRE(region.upper() == hermes::index2(32, 16));
+    check_regions(region, rgb);
+  }) == 1);
+  REQUIRE(film_image.dirtyBlockCount() == 0);
+  // blocks dirtied while regions are being consumed are reported by the next call
+  HERMES_CUDA_LAUNCH_AND_SYNC((1), splatAt_k, film_image.view(), hermes::point2(2.5f, 2.5f))
+  REQUIRE(film_image.resolveDirtyRegions([&](const bounds2i &region, const real_t *rgb) {
+    HERMES_CUDA_LAUNCH_AND_SYNC((1), splatAt_k, film_image.view(), hermes::point2(35.5f, 18.5f))
+  }) == 1);
+  REQUIRE(film_image.dirtyBlockCount() == 1);
+}
+
+HERMES_CUDA_KERNEL(fillDirtyRows)(FilmImageView film_image, bounds2i rows) {
+  HERMES_CUDA_THREAD_INDEX_IJ_LT(rows.upper() - rows.lower())
+  auto p = ij + rows.lower();
+  FilmPixel pixel;
+  pixel.xyz[0] = 0.01f * p.i;
+  pixel.xyz[1] = 0.02f * p.j;
+  pixel.xyz[2] = 0.1f;
+  pixel.filter_weight_sum = 1;
+  film_image.setPixel(p, pixel);
+  film_image.markDirty(p);
+}
+
+TEST_CASE("film dirty regions streamed", "[core]") {
+  BoxFilter filter({1, 1});
+  Film film({40, 20}, &filter, 10);
+  FilmImage full_image(film);
+  HERMES_CUDA_LAUNCH_AND_SYNC((hermes::size2(40, 20)), fillRows_k, full_image.view(), film.cropped_pixel_bounds)
+  auto reference = full_image.imagePixels();
+  // a band of 6 rows is smaller than (and not aligned to) the 16 rows of a block
+  FilmImage film_image(film);
+  REQUIRE(film_image.streamTo("dirty_stream.raw", 6) == HeResult::SUCCESS);
+  size_t resolved_area = 0;
+  auto check_regions = [&](const bounds2i &region, const real_t *rgb) {
+    resolved_area += region.area();
+    int width = region.upper().i - region.lower().i;
+    for (auto p : region) {
+      REQUIRE(p.j >= film_image.firstResidentRow());
+      REQUIRE(p.j < film_image.firstResidentRow() + film_image.residentRowCount());
+      for (int c = 0; c < 3; ++c)
+        REQUIRE(rgb[((p.i - region.lower().i) + (p.j - region.lower().j) * width) * 3 + c]
+                    == Approx(reference[(p.i + p.j * 40) * 3 + c]));
+    }
+  };
+  // resident parts of the blocks are reported as rows are filled
+  for (int row = 0; row < 20; row += 6) {
+    bounds2i rows({0, row}, {40, std::min(row + 6, 20)});
+    HERMES_CUDA_LAUNCH_AND_SYNC((hermes::size2(40, rows.upper().j - row)), fillDirtyRows_k, film_image.view(), rows)
+    // rows 12 to 17 cross the border between two rows of blocks
+    REQUIRE(film_image.resolveDirtyRegions(check_regions) == (row == 12 ? 6 : 3));
+    REQUIRE(film_image.dirtyBlockCount() == 0);
+    REQUIRE(resolved_area == static_cast<size_t>(40 * rows.upper().j));
+    REQUIRE(film_image.finishRows(rows.upper().j) == HeResult::SUCCESS);
+  }
+  // finished blocks are no longer flagged
+  FilmImage unresolved_image(film);
+  REQUIRE(unresolved_image.streamTo("dirty_stream.raw", 6) == HeResult::SUCCESS);
+  HERMES_CUDA_LAUNCH_AND_SYNC((hermes::size2(40, 6)), fillDirtyRows_k, unresolved_image.view(),
+                              bounds2i({0, 0}, {40, 6}))
+  REQUIRE(unresolved_image.finishRows(6) == HeResult::SUCCESS);
+  REQUIRE(unresolved_image.dirtyBlockCount() == 3);
+  REQUIRE(unresolved_image.finishRows(20) == HeResult::SUCCESS);
+  REQUIRE(unresolved_image.dirtyBlockCount() == 0);
+  REQUIRE(unresolved_image.resolveDirtyRegions(check_regions) == 0);
+}
+
 TEST_CASE("SpectrumOld", "[core]") {
   SpectrumOld s;
   REQUIRE(s.isBlack());
@@ -128,6 +571,60 @@ TEST_CASE("Raw Scene") {
 
 }
 
+TEST_CASE("mem pools", "[core]") {
+  mem::init(4096);
+  auto a = mem::allocateFromPool<Sphere>(Sphere::unitSphere());
+  auto b = mem::allocateFromPool<Sphere>(Sphere::unitSphere());
+  auto c = mem::allocateFromPool<Sphere>(Sphere::unitSphere());
+  REQUIRE(mem::pool<Sphere>().capacity() == 3);
+  REQUIRE(mem::pool<Sphere>().size() == 3);
+  auto available_size = mem::availableSize();
+  // release a slot in the middle of the stack
+  auto *b_address = b.get<Sphere>();
+  REQUIRE(mem::release<Sphere>(b) == HeResult::SUCCESS);
+  REQUIRE(!b);
+  REQUIRE(mem::pool<Sphere>().freeSlotCount() == 1);
+  REQUIRE(mem::pool<Sphere>().size() == 2);
+  // the released slot is reused and no arena memory is consumed
+  auto d = mem::allocateFromPool<Sphere>(Sphere::unitSphere());
+  REQUIRE(d.get<Sphere>() == b_address);
+  REQUIRE(d.get<Sphere>()->radius() == 1.);
+  REQUIRE(mem::availableSize() == available_size);
+  REQUIRE(mem::pool<Sphere>().freeSlotCount() == 0);
+  // create/destroy cycles keep memory bounded
+  for (int i = 0; i < 100; ++i) {
+    auto e = mem::allocateFromPool<Sphere>(Sphere::unitSphere());
+    REQUIRE(mem::release<Sphere>(e) == HeResult::SUCCESS);
+  }
+  REQUIRE(mem::availableSize() == available_size - sizeof(Sphere));
+  // double releases are rejected and do not duplicate the slot
+  auto f = mem::allocateFromPool<Sphere>(Sphere::unitSphere());
+  auto f_copy = f;
+  REQUIRE(mem::release<Sphere>(f) == HeResult::SUCCESS);
+  REQUIRE(mem::release<Sphere>(f_copy) == HeResult::INVALID_INPUT);
+  REQUIRE(mem::pool<Sphere>().freeSlotCount() == 1);
+  REQUIRE(mem::pool<Sphere>().size() == 3);
+  auto g = mem::allocateFromPool<Sphere>(Sphere::unitSphere());
+  auto h = mem::allocateFromPool<Sphere>(Sphere::unitSphere());
+  REQUIRE(g.get<Sphere>() != h.get<Sphere>());
+  // handles the pool does not own are rejected
+  auto foreign = mem::allocate<Sphere>(Sphere::unitSphere());
+  REQUIRE(mem::release<Sphere>(foreign) == HeResult::INVALID_INPUT);
+  REQUIRE(foreign);
+  REQUIRE(mem::pool<Sphere>().freeSlotCount() == 0);
+  REQUIRE(mem::pool<Sphere>().size() == 5);
+  // a new arena discards previous slots
+  mem::init(1024);
+  REQUIRE(mem::pool<Sphere>().capacity() == 0);
+  // failed allocations do not count as slots
+  std::size_t allocated = 0;
+  while (mem::allocateFromPool<Sphere>(Sphere::unitSphere()))
+    allocated++;
+  REQUIRE(allocated > 0);
+  REQUIRE(mem::pool<Sphere>().capacity() == allocated);
+  REQUIRE(mem::pool<Sphere>().size() == allocated);
+}
+
 HERMES_CUDA_KERNEL(checkSceneElements)(bool *r, Scene::View s) {
   HERMES_CUDA_RETURN_IF_NOT_THREAD_0
   *r = false;
@@ -32,32 +32,45 @@
 #include <helios/core/film.h>
 #include <helios/integrators/whitted_integrator.h>
 #include <helios/core/renderer.cuh>
+#include <helios/samplers/sobol_sampler.h>
 #include <helios/shapes.h>
 #include <helios/common/io.h>
 
 using namespace helios;
 
-TEST_CASE("SamplerRenderer") {
-  mem::init(2048);
-  // setup resources
-  auto point_light_data = mem::allocate<PointLight>();
-  auto sphere_shape_data = mem::allocate<Sphere>(Sphere::unitSphere());
-  // setup scene
+namespace {
+
+/// Unit sphere in front of the camera lit by a point light
+struct SphereScene {
+  SphereScene() {
+    mem::init(2048);
+    auto point_light_data = mem::allocate<PointLight>();
+    auto sphere_shape_data = mem::allocate<Sphere>(Sphere::unitSphere());
+    scene.addLight(PointLight::createLight({-10, 0, 0}, point_light_data));
+    auto sphere_shape = scene.addShape(Shapes::createFrom<Sphere>(sphere_shape_data, {0, 0, 5}, {1, 1, 1}));
+    scene.addPrimitive(GeometricPrimitive::createPrimitive(sphere_shape));
+    REQUIRE(scene.prepare() == HeResult::SUCCESS);
+  }
+  /// \return camera looking at the sphere through the whole film
+  static PerspectiveCamera camera(FilmImage &film_image) {
+    return PerspectiveCamera(AnimatedTransform(), {{-1, -1}, {1, 1}}, film_image.film().full_resolution,
+                             0, 1, 0, 1, 45);
+  }
   Scene scene;
-  scene.addLight(PointLight::createLight({-10, 0, 0}, point_light_data));
-  auto sphere_shape = scene.addShape(Shapes::createFrom<Sphere>(sphere_shape_data, {0, 0, 5}, {1, 1, 1}));
-  scene.addPrimitive(GeometricPrimitive::createPrimitive(sphere_shape));
-  REQUIRE(scene.prepare() == HeResult::SUCCESS);
+};
+
+}
+
+TEST_CASE("SamplerRenderer") {
+  SphereScene sphere_scene;
+  auto &scene = sphere_scene.scene;
   // image resolution
   hermes::size2 res(1024, 1024);
   // setup film_image
   BoxFilter filter({1, 1});
   FilmImage film_image(Film(res, &filter, 10));
   // setup camera
-  PerspectiveCamera camera(AnimatedTransform(),
-                           {{-1, -1}, {1, 1}},
-                           film_image.film().full_resolution,
-                           0, 1, 0, 1, 45);
+  auto camera = SphereScene::camera(film_image);
   // setup renderer
   WhittedIntegrator integrator;
   SamplerRenderer renderer((hermes::range2(res)));
@@ -70,3 +83,156 @@ TEST_CASE("SamplerRenderer") {
                    film_image.film().cropped_pixel_bounds,
                    film_image.film().full_resolution));
 }
+
+TEST_CASE("SamplerRenderer deterministic merge") {
+  SphereScene sphere_scene;
+  auto &scene = sphere_scene.scene;
+  hermes::size2 res(128, 96);
+  BoxFilter filter({1.5, 1.5});
+  auto render = [&](FilmMergeMode mode, u32 thread_count) {
+    FilmImage film_image(Film(res, &filter, 10));
+    auto camera = SphereScene::camera(film_image);
+    WhittedIntegrator integrator;
+    SamplerRenderer renderer((hermes::range2(res)));
+    renderer.withMergeMode(mode).withThreadCount(thread_count).render(camera, film_image, integrator, scene.view());
+    return film_image.imagePixels();
+  };
+  auto reference = render(FilmMergeMode::ATOMIC, 0);
+  // one thread per tile, then a few threads looping over many tiles each (different tile-to-thread mapping)
+  auto image = render(FilmMergeMode::DETERMINISTIC, 0);
+  auto image_again = render(FilmMergeMode::DETERMINISTIC, 2);
+  auto image_serial = render(FilmMergeMode::DETERMINISTIC, 1);
+  REQUIRE(image.size() == reference.size());
+  for (size_t i = 0; i < image.size(); ++i) {
+    REQUIRE(image[i] == image_again[i]);
+    REQUIRE(image[i] == image_serial[i]);
+    REQUIRE(image[i] == Approx(reference[i]).margin(1e-5));
+  }
+}
+
+TEST_CASE("SamplerRenderer samplers") {
+  SphereScene sphere_scene;
+  auto &scene = sphere_scene.scene;
+  hermes::size2 res(64, 64);
+  BoxFilter filter({0.5, 0.5});
+  // sphere coverage of the image does not depend on the sampler
+  auto coverage = [&](const auto &sampler) {
+    FilmImage film_image(Film(res, &filter, 10));
+    auto camera = SphereScene::camera(film_image);
+    WhittedIntegrator integrator;
+    SamplerRenderer((hermes::range2(res))).render(camera, film_image, integrator, scene.view(), sampler);
+    auto image = film_image.imagePixels();
+    real_t sum = 0;
+    for (size_t i = 0; i < image.size(); ++i)
+      sum += image[i];
+    return sum / image.size();
+  };
+  auto reference = coverage(StratifiedSampler(hermes::size2(4, 4), true));
+  REQUIRE(reference > 0);
+  REQUIRE(coverage(SobolSampler(16)) == Approx(reference).epsilon(0.01));
+  REQUIRE(coverage(ZSobolSampler(16, res)) == Approx(reference).epsilon(0.01));
+}
+
+TEST_CASE("SamplerRenderer adaptive sampling") {
+  SphereScene sphere_scene;
+  auto &scene = sphere_scene.scene;
+  hermes::size2 res(128, 96);
+  BoxFilter filter({1, 1});
+  real_t error_threshold = 0.05f;
+  FilmImage single_pass(Film(res, &filter, 10));
+  FilmImage adaptive(Film(res, &filter, 10));
+  auto camera = SphereScene::camera(single_pass);
+  WhittedIntegrator integrator;
+  SamplerRenderer((hermes::range2(res))).render(camera, single_pass, integrator, scene.view());
+  SamplerRenderer((hermes::range2(res))).withAdaptiveSampling(error_threshold, 6)
+      .render(camera, adaptive, integrator, scene.view());
+  // only pixels along silhouettes and shading edges keep receiving samples
+  hermes::DeviceArray<u8> mask;
+  REQUIRE(single_pass.refinementMask(hermes::range2(res), error_threshold, mask) < res.total() / 2);
+  REQUIRE(adaptive.sampleCount() > single_pass.sampleCount());
+  REQUIRE(adaptive.sampleCount() < 3 * single_pass.sampleCount());
+  // converged regions are left untouched
+  auto reference = single_pass.imagePixels();
+  auto image = adaptive.imagePixels();
+  REQUIRE(image.size() == reference.size());
+  real_t mean_difference = 0;
+  for (size_t i = 0; i < image.size(); ++i)
+    mean_difference += std::abs(image[i] - reference[i]);
+  REQUIRE(mean_difference / image.size() < 0.01f);
+}
+
+TEST_CASE("SamplerRenderer filter importance sampling") {
+  SphereScene sphere_scene;
+  auto &scene = sphere_scene.scene;
+  hermes::size2 res(128, 96);
+  BoxFilter filter({0.5, 0.5});
+  auto render = [&](FilmFilterMode filter_mode, FilmMergeMode merge_mode) {
+    FilmImage film_image(Film(res, &filter, 10, bounds2::unitBox(), filter_mode));
+    auto camera = SphereScene::camera(film_image);
+    WhittedIntegrator integrator;
+    SamplerRenderer renderer((hermes::range2(res)));
+    renderer.withMergeMode(merge_mode).render(camera, film_image, integrator, scene.view());
+    return film_image.imagePixels();
+  };
+  auto reference = render(FilmFilterMode::SPLAT, FilmMergeMode::ATOMIC);
+  auto image = render(FilmFilterMode::IMPORTANCE, FilmMergeMode::ATOMIC);
+  // disjoint tiles make both merge modes equivalent
+  auto buffered_image = render(FilmFilterMode::IMPORTANCE, FilmMergeMode::DETERMINISTIC);
+  REQUIRE(image.size() == reference.size());
+  real_t mean_difference = 0;
+  for (size_t i = 0; i < image.size(); ++i) {
+    REQUIRE(image[i] == buffered_image[i]);
+    mean_difference += std::abs(image[i] - reference[i]);
+  }
+  // a half pixel box filter reaches a single pixel in both modes
+  REQUIRE(mean_difference / image.size() < 0.01f);
+}
+
+HERMES_CUDA_KERNEL(addFilmSample)(FilmImageView film_image) {
+  HERMES_CUDA_THREAD_INDEX_I
+  FilmPixel pixel;
+  pixel.xyz[1] = 1;
+  pixel.filter_weight_sum = 1;
+  if (i == 0)
+    film_image.setPixel(film_image.film().cropped_pixel_bounds.lower(), pixel);
+}
+
+TEST_CASE("SamplerRenderer streamed film") {
+  SphereScene sphere_scene;
+  auto &scene = sphere_scene.scene;
+  hermes::size2 res(64, 160);
+  BoxFilter filter({1.5, 1.5});
+  WhittedIntegrator integrator;
+  FilmImage reference_image(Film(res, &filter, 10));
+  auto camera = SphereScene::camera(reference_image);
+  REQUIRE(SamplerRenderer((hermes::range2(res))).render(camera, reference_image, integrator, scene.view())
+              == HeResult::SUCCESS);
+  auto reference = reference_image.imagePixels();
+  FilmImage streamed_image(Film(res, &filter, 10));
+  int resident_row_count = SamplerRenderer::minResidentRowCount(streamed_image.film());
+  REQUIRE(resident_row_count < static_cast<int>(res.height));
+  // bands that miss part of a filter footprint are rejected
+  REQUIRE(streamed_image.streamTo("render_stream.raw", 2) == HeResult::INVALID_INPUT);
+  REQUIRE(streamed_image.streamTo("render_stream.raw", resident_row_count - 1) == HeResult::SUCCESS);
+  REQUIRE(SamplerRenderer((hermes::range2(res))).render(camera, streamed_image, integrator, scene.view())
+              == HeResult::INVALID_INPUT);
+  // the smallest valid band gives the same image as the in-memory film
+  REQUIRE(streamed_image.streamTo("render_stream.raw", resident_row_count) == HeResult::SUCCESS);
+  REQUIRE(SamplerRenderer((hermes::range2(res))).render(camera, streamed_image, integrator, scene.view())
+              == HeResult::SUCCESS);
+  auto image = streamed_image.imagePixels();
+  REQUIRE(image.size() == reference.size());
+  for (size_t i = 0; i < image.size(); ++i)
+    REQUIRE(image[i] == Approx(reference[i]).margin(1e-5));
+  // finished rows can not be rendered again nor restreamed
+  REQUIRE(SamplerRenderer((hermes::range2(res))).render(camera, streamed_image, integrator, scene.view())
+              == HeResult::INVALID_INPUT);
+  REQUIRE(streamed_image.streamTo("render_stream.raw", resident_row_count) == HeResult::INVALID_INPUT);
+  // samples already in the film would be discarded by the stream
+  REQUIRE(reference_image.streamTo("render_stream.raw", resident_row_count) == HeResult::INVALID_INPUT);
+  FilmImage sampled_image(Film(res, &filter, 10));
+  REQUIRE(sampled_image.streamTo("render_stream.raw", resident_row_count) == HeResult::SUCCESS);
+  HERMES_CUDA_LAUNCH_AND_SYNC((1), addFilmSample_k, sampled_image.view())
+  REQUIRE(SamplerRenderer((hermes::range2(res))).render(camera, sampled_image, integrator, scene.view())
+              == HeResult::INVALID_INPUT);
+}
@@ -37,6 +37,10 @@
 #include <hermes/logging/memory_dump.h>
 #include <helios/samplers/sample_pool.h>
 #include <helios/samplers/stratified_sampler.h>
+#include <helios/samplers/sobol_sampler.h>
+#include <helios/samplers/halton_sampler.h>
+#include <helios/samplers/pmj02_sampler.h>
+#include <algorithm>
 
 using namespace helios;
 
@@ -92,6 +96,44 @@ HERMES_CUDA_KERNEL(fill_pool)(SamplePool pool, int bounds, int *result) {
   } while (pool.startNextSample());
 }
 
+HERMES_CUDA_KERNEL(stratified_samples)(StratifiedSampler sampler, hermes::point2 *samples, int bounds) {
+  HERMES_CUDA_THREAD_INDEX_I_LT(bounds)
+  // threads visit (pixel, sample) pairs in reverse order
+  int k = bounds - 1 - i;
+  sampler.startPixelSample({k / 16, 0}, k % 16, 3);
+  samples[k] = sampler.get2D();
+}
+
+TEST_CASE("CounterRNG", "[sampling]") {
+  SECTION("known answers") {
+    // Random123 philox4x32_10 test vectors
+    u32 counters[3][4] = {{0, 0, 0, 0},
+                          {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+                          {0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}};
+    u32 keys[3][2] = {{0, 0}, {0xffffffff, 0xffffffff}, {0xa4093822, 0x299f31d0}};
+    u32 expected[3][4] = {{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8},
+                          {0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd},
+                          {0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}};
+    for (int t = 0; t < 3; ++t) {
+      u32 out[4];
+      CounterRNG(keys[t][0], keys[t][1]).generate(counters[t], out);
+      for (int w = 0; w < 4; ++w)
+        REQUIRE(out[w] == expected[t][w]);
+    }
+  }//
+  SECTION("scheduling independence") {
+    StratifiedSampler sampler(hermes::size2(4, 4), true, 7);
+    sampler.setPass(2);
+    const int n = 4 * 16;
+    hermes::UnifiedArray<hermes::point2> samples(n);
+    HERMES_CUDA_LAUNCH_AND_SYNC((n), stratified_samples_k, sampler, samples.data(), n)
+    for (int k = 0; k < n; ++k) {
+      sampler.startPixelSample({k / 16, 0}, k % 16, 3);
+      REQUIRE(sampler.get2D() == samples[k]);
+    }
+  }//
+}
+
 TEST_CASE("SamplePool", "[sampling]") {
   SECTION("Descriptor") {
     SECTION("no arrays") {
@@ -163,6 +205,12 @@ TEST_CASE("SamplePool", "[sampling]") {
       ++sample_count;
     } while (pool.startNextSample());
     REQUIRE(sample_count == descriptor.samples_per_pixel);
+    // samples of a dimension are contiguous
+    for (size_t d = 0; d < descriptor.dimensions; ++d)
+      for (size_t s = 0; s < descriptor.samples_per_pixel; ++s) {
+        REQUIRE(&pool.get1DSample(s, d) == pool.get1DSamples(d) + s);
+        REQUIRE(&pool.get2DSample(s, d) == pool.get2DSamples(d) + s);
+      }
 //    HERMES_LOG_VARIABLE(SamplePool::dumpMemory(pool, 1))
     hermes::UnifiedArray<int> results(1);
     HERMES_CUDA_LAUNCH_AND_SYNC((1), check_pool_k, pool, results.data())
@@ -189,19 +237,324 @@ TEST_CASE("SamplePool", "[sampling]") {
 }
 
 TEST_CASE("StratifiedSampler", "[sampling]") {
-  SECTION("sanity") {
-    StratifiedSampler sampler(hermes::size2(2, 2), true, 3);
-    hermes::UnifiedMemory mem(sampler.memorySize() * 1);
-    REQUIRE(mem.sizeInBytes() == sampler.memorySize());
-    sampler.setDataPtr(mem.ptr());
-    sampler.startPixel({});
-
-    auto pool = sampler.samplePool();
-    HERMES_LOG_VARIABLE(SamplePool::dumpMemory(pool,1))
-    for (auto ij : hermes::range2(hermes::size2(2, 2))) {
-      HERMES_LOG_VARIABLE(ij)
-      HERMES_LOG_VARIABLE(pool.get1DSample());
-      HERMES_LOG_VARIABLE(pool.get2DSample());
+  SECTION("stratification") {
+    StratifiedSampler sampler(hermes::size2(4, 2), true);
+    REQUIRE(sampler.samplesPerPixel() == 8);
+    sampler.startPixel({3, 5});
+    // every dimension visits each stratum exactly once
+    std::vector<int> strata_1d(3 * 8, 0), strata_2d(2 * 8, 0);
+    do {
+      auto cs = sampler.cameraSample({3, 5});
+      REQUIRE(cs.film.x >= 3);
+      REQUIRE(cs.film.x < 4);
+      REQUIRE(cs.film.y >= 5);
+      REQUIRE(cs.film.y < 6);
+      strata_2d[(int) ((cs.film.y - 5) * 2) * 4 + (int) ((cs.film.x - 3) * 4)]++;
+      strata_1d[(int) (cs.time * 8)]++;
+      strata_1d[8 + (int) (sampler.get1D() * 8)]++;
+      strata_1d[16 + (int) (sampler.get1D() * 8)]++;
+      auto u = sampler.get2D();
+      strata_2d[8 + (int) (u.y * 2) * 4 + (int) (u.x * 4)]++;
+    } while (sampler.startNextSample());
+    for (auto count : strata_1d)
+      REQUIRE(count == 1);
+    for (auto count : strata_2d)
+      REQUIRE(count == 1);
+  }//
+  SECTION("on demand") {
+    StratifiedSampler sampler(hermes::size2(4, 4), true);
+    std::vector<real_t> sequential;
+    sampler.startPixel({7, 1});
+    do {
+      sequential.emplace_back(sampler.get1D());
+      auto u = sampler.get2D();
+      sequential.emplace_back(u.x);
+      sequential.emplace_back(u.y);
+    } while (sampler.startNextSample());
+    // any sample can be generated directly from (pixel, sample index, dimension)
+    StratifiedSampler other(hermes::size2(4, 4), true);
+    for (int s = 15; s >= 0; --s) {
+      other.startPixelSample({7, 1}, s, 1);
+      auto u = other.get2D();
+      REQUIRE(u.x == sequential[s * 3 + 1]);
+      REQUIRE(u.y == sequential[s * 3 + 2]);
+      other.startPixelSample({7, 1}, s);
+      REQUIRE(other.get1D() == sequential[s * 3]);
+    }
+    // pixels, passes and seeds produce different samples
+    other.startPixel({7, 2});
+    REQUIRE(other.get1D() != sequential[0]);
+    other.setPass(1);
+    other.startPixel({7, 1});
+    REQUIRE(other.get1D() != sequential[0]);
+    StratifiedSampler seeded(hermes::size2(4, 4), true, 1);
+    seeded.startPixel({7, 1});
+    REQUIRE(seeded.get1D() != sequential[0]);
+  }//
+  SECTION("pool fill") {
+    StratifiedSampler sampler(hermes::size2(4, 4), true, 3);
+    SamplePool::PoolDescriptor descriptor = {
+        .samples_per_pixel = 16,
+        .dimensions = 2,
+        .array1_sizes = {},
+        .array2_sizes = {}
+    };
+    hermes::range2 pixels(hermes::index2(2, 5), hermes::index2(5, 7));
+    const size_t item_size = descriptor.memory_size_in_bytes();
+    hermes::UnifiedMemory m(pixels.area() * item_size);
+    for (int i = 0; i < pixels.area(); ++i)
+      descriptor.write_layout(m.ptr() + i * item_size);
+    SamplePool pool(descriptor, m.ptr());
+    sampler.fillPool(pool, pixels);
+    // pool items hold the same samples the sampler generates on demand
+    for (int j = pixels.lower().j; j < pixels.upper().j; ++j)
+      for (int i = pixels.lower().i; i < pixels.upper().i; ++i) {
+        pool.setPoolIndex((j - pixels.lower().j) * 3 + i - pixels.lower().i);
+        for (u32 s = 0; s < 16; ++s)
+          for (u32 d = 0; d < 2; ++d) {
+            sampler.startPixelSample({i, j}, s, 3 * d);
+            REQUIRE(pool.get1DSample(s, d) == sampler.get1D());
+            REQUIRE(pool.get2DSample(s, d) == sampler.get2D());
+          }
+      }
+  }//
+}
+
+namespace {
+
+/// \return true if each elementary interval of area 1 / points.size() contains exactly one point
+bool isNet(const std::vector<hermes::point2> &points) {
+  int log2_n = 0;
+  while ((1u << log2_n) < points.size())
+    log2_n++;
+  for (int log2_x = 0; log2_x <= log2_n; ++log2_x) {
+    int nx = 1 << log2_x, ny = 1 << (log2_n - log2_x);
+    std::vector<int> counts(points.size(), 0);
+    for (const auto &p : points)
+      if (counts[(int) (p.y * ny) * nx + (int) (p.x * nx)]++)
+        return false;
+  }
+  return true;
+}
+
+}
+
+TEST_CASE("Sobol", "[sampling]") {
+  SECTION("generator matrices") {
+    // dimension 0 is the van der Corput sequence, dimension 1 the classic (0,2)-sequence partner
+    REQUIRE(helios::sobol::sampleBits(1, 0) == 0x80000000u);
+    REQUIRE(helios::sobol::sampleBits(2, 0) == 0x40000000u);
+    REQUIRE(helios::sobol::sampleBits(3, 1) == 0x40000000u);
+    REQUIRE(helios::sobol::matrices.columns[1][1] == 0xc0000000u);
+    // every dimension is a (0,1)-sequence
+    for (int d = 0; d < helios::sobol::dimension_count; ++d) {
+      std::vector<int> counts(64, 0);
+      for (int i = 0; i < 64; ++i)
+        counts[helios::sobol::sampleBits(i, d) >> 26]++;
+      for (auto c : counts)
+        REQUIRE(c == 1);
+    }
+  }//
+  SECTION("owen scrambling preserves nets") {
+    std::vector<hermes::point2> points;
+    for (int i = 0; i < 256; ++i)
+      points.emplace_back(helios::sobol::sample(i, 0, 0x1234567), helios::sobol::sample(i, 1, 0x89abcdef));
+    REQUIRE(isNet(points));
+  }//
+  SECTION("SobolSampler") {
+    SobolSampler sampler(16);
+    REQUIRE(sampler.samplesPerPixel() == 16);
+    std::vector<hermes::point2> film_points;
+    std::vector<real_t> first_sample;
+    sampler.startPixel({2, 3});
+    do {
+      auto cs = sampler.cameraSample({2, 3});
+      film_points.emplace_back(cs.film.x - 2, cs.film.y - 3);
+      first_sample.emplace_back(cs.time);
+    } while (sampler.startNextSample());
+    REQUIRE(isNet(film_points));
+    // samples are a function of (pixel, sample, dimension)
+    sampler.startPixelSample({2, 3}, 5, 2);
+    REQUIRE(sampler.get1D() == first_sample[5]);
+    // the next pass continues the sequence: both passes together are still a net
+    sampler.setPass(1);
+    sampler.startPixel({2, 3});
+    do {
+      auto cs = sampler.cameraSample({2, 3});
+      film_points.emplace_back(cs.film.x - 2, cs.film.y - 3);
+    } while (sampler.startNextSample());
+    REQUIRE(isNet(film_points));
+  }//
+  SECTION("ZSobolSampler") {
+    ZSobolSampler sampler(3, hermes::size2(4, 4));
+    REQUIRE(sampler.samplesPerPixel() == 4);
+    // the samples of all pixels together form a single net
+    std::vector<hermes::point2> points;
+    for (auto ij : hermes::range2(hermes::size2(4, 4))) {
+      sampler.startPixel(ij);
+      do {
+        auto cs = sampler.cameraSample(ij);
+        REQUIRE(cs.film.x >= ij.i);
+        REQUIRE(cs.film.x < ij.i + 1);
+        REQUIRE(cs.time >= 0);
+        REQUIRE(cs.time < 1);
+        points.emplace_back(cs.lens);
+      } while (sampler.startNextSample());
     }
+    REQUIRE(points.size() == 64);
+    REQUIRE(isNet(points));
   }//
-}
\ No newline at end of file
+}
+
+TEST_CASE("Halton", "[sampling]") {
+  SECTION("radical inverse") {
+    REQUIRE(helios::halton::radicalInverse(2, 1) == Approx(0.5));
+    REQUIRE(helios::halton::radicalInverse(2, 6) == Approx(0.375));
+    REQUIRE(helios::halton::radicalInverse(3, 5) == Approx(7.f / 9));
+    // 5 = 12 (base 3) -> 21 (base 3) = 7
+    REQUIRE(helios::halton::inverseRadicalInverse(3, 7, 2) == 5);
+    REQUIRE(helios::halton::inverseRadicalInverse(2, 0b011, 3) == 0b110);
+    REQUIRE(helios::halton::primes.values[0] == 2);
+    REQUIRE(helios::halton::primes.values[63] == 311);
+  }//
+  HaltonSampler::Permutations permutations(7);
+  SECTION("pixel sample indices") {
+    // with one sample per pixel, the pixels of a 2^3 x 3^2 region receive the first 72 Halton points
+    hermes::size2 res(8, 9);
+    HaltonSampler sampler(1, res, permutations);
+    std::vector<std::pair<real_t, real_t>> points, expected;
+    for (auto ij : hermes::range2(res)) {
+      sampler.startPixel(ij);
+      auto u = sampler.get2D();
+      points.emplace_back((ij.i + u.x) / 8, (ij.j + u.y) / 9);
+    }
+    for (int i = 0; i < 72; ++i)
+      expected.emplace_back(helios::halton::radicalInverse(2, i), helios::halton::radicalInverse(3, i));
+    std::sort(points.begin(), points.end());
+    std::sort(expected.begin(), expected.end());
+    for (int i = 0; i < 72; ++i) {
+      REQUIRE(points[i].first == Approx(expected[i].first).margin(1e-5));
+      REQUIRE(points[i].second == Approx(expected[i].second).margin(1e-5));
+    }
+  }//
+  SECTION("scrambled dimensions") {
+    // a single pixel image uses consecutive indices, scrambled dimensions are still stratified
+    HaltonSampler sampler(25, hermes::size2(1, 1), permutations);
+    std::vector<int> counts(25, 0);
+    sampler.startPixel({0, 0});
+    do {
+      auto cs = sampler.cameraSample({0, 0});
+      counts[(int) (cs.time * 25)]++;
+    } while (sampler.startNextSample());
+    for (auto c : counts)
+      REQUIRE(c == 1);
+    // samples are a function of (pixel, sample, dimension)
+    sampler.startPixelSample({0, 0}, 3, 2);
+    real_t t = sampler.get1D();
+    sampler.startPixel({0, 0});
+    for (int i = 0; i < 3; ++i)
+      sampler.startNextSample();
+    REQUIRE(sampler.cameraSample({0, 0}).time == t);
+    REQUIRE(permutations.memorySize() == helios::halton::primes.permutation_offsets[64] * sizeof(u16));
+  }//
+}
+
+TEST_CASE("PMJ02", "[sampling]") {
+  SECTION("tables") {
+    // power of two prefixes of every set are (0,m,2)-nets
+    for (int set = 0; set < helios::pmj02::set_count; ++set)
+      for (int n = 1; n <= helios::pmj02::point_count; n *= 2) {
+        std::vector<hermes::point2> points;
+        for (int i = 0; i < n; ++i) {
+          u32 p = helios::pmj02::packedPoint(set, i);
+          points.emplace_back(((p & 0xffff) + 0.5f) / 65536, ((p >> 16) + 0.5f) / 65536);
+        }
+        REQUIRE(isNet(points));
+      }
+  }//
+  SECTION("progressive") {
+    PMJ02Sampler sampler(32);
+    std::vector<hermes::point2> film, lens;
+    std::vector<real_t> time;
+    for (u32 pass = 0; pass < 2; ++pass) {
+      sampler.setPass(pass);
+      sampler.startPixel({5, 9});
+      do {
+        auto cs = sampler.cameraSample({5, 9});
+        film.emplace_back(cs.film.x - 5, cs.film.y - 9);
+        time.emplace_back(cs.time);
+        lens.emplace_back(cs.lens);
+        // stopping at any power of two sample count leaves a stratified set
+        if ((film.size() & (film.size() - 1)) == 0) {
+          REQUIRE(isNet(film));
+          REQUIRE(isNet(lens));
+          std::vector<int> counts(film.size(), 0);
+          for (auto t : time)
+            counts[(int) (t * film.size())]++;
+          for (auto c : counts)
+            REQUIRE(c == 1);
+        }
+      } while (sampler.startNextSample());
+    }
+    REQUIRE(film.size() == 64);
+    // pixels are decorrelated
+    sampler.setPass(0);
+    sampler.startPixel({6, 9});
+    REQUIRE(sampler.get2D().x != film[0].x);
+  }//
+}
+
+TEST_CASE("samplers benchmark", "[.][benchmark]") {
+  // integrates f(film, time, lens) = x * y + t * u * v (exact value 0.375) inside each pixel of the image
+  const hermes::size2 res(32, 32);
+  auto rmsError = [&](auto sampler) {
+    real_t error = 0;
+    for (auto ij : hermes::range2(res)) {
+      real_t sum = 0;
+      sampler.startPixel(ij);
+      do {
+        auto cs = sampler.cameraSample(ij);
+        sum += (cs.film.x - ij.i) * (cs.film.y - ij.j) + cs.time * cs.lens.x * cs.lens.y;
+      } while (sampler.startNextSample());
+      real_t e = sum / sampler.samplesPerPixel() - 0.375f;
+      error += e * e;
+    }
+    return std::sqrt(error / res.total());
+  };
+  HaltonSampler::Permutations permutations;
+  StratifiedSampler stratified(hermes::size2(4, 4), true);
+  HaltonSampler halton(16, res, permutations);
+  SobolSampler sobol(16);
+  PMJ02Sampler pmj02(16);
+  // error at equal sample count, the benchmarks give the cost of reaching it
+  HERMES_LOG_VARIABLE(rmsError(stratified))
+  HERMES_LOG_VARIABLE(rmsError(halton))
+  HERMES_LOG_VARIABLE(rmsError(sobol))
+  HERMES_LOG_VARIABLE(rmsError(pmj02))
+  BENCHMARK("StratifiedSampler (16 spp)") { return rmsError(stratified); };
+  BENCHMARK("HaltonSampler (16 spp)") { return rmsError(halton); };
+  BENCHMARK("SobolSampler (16 spp)") { return rmsError(sobol); };
+  BENCHMARK("PMJ02Sampler (16 spp)") { return rmsError(pmj02); };
+}
+
+TEST_CASE("SamplePool fill benchmark", "[.][benchmark]") {
+  StratifiedSampler sampler(hermes::size2(4, 4), true);
+  SamplePool::PoolDescriptor descriptor = {
+      .samples_per_pixel = 16,
+      .dimensions = 8,
+      .array1_sizes = {},
+      .array2_sizes = {}
+  };
+  hermes::range2 pixels(hermes::index2(0, 0), hermes::index2(64, 64));
+  const size_t item_size = descriptor.memory_size_in_bytes();
+  hermes::UnifiedMemory m(pixels.area() * item_size);
+  for (int i = 0; i < pixels.area(); ++i)
+    descriptor.write_layout(m.ptr() + i * item_size);
+  SamplePool pool(descriptor, m.ptr());
+  // bytes written by each fill
+  HERMES_LOG_VARIABLE(pixels.area() * item_size)
+  BENCHMARK("StratifiedSampler::fillPool (64x64 pixels, 16 spp, 8 dimensions)") {
+    sampler.fillPool(pool, pixels);
+    return pool.itemSize();
+  };
+}
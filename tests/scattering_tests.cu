@@ -27,6 +27,7 @@
 
 #include <catch2/catch.hpp>
 
+#include <helios/core/bsdf.h>
 #include <helios/scattering/bxdfs.h>
 #include <helios/scattering/microfacet_distributions.h>
 #include <helios/materials.h>
@@ -64,3 +65,95 @@ TEST_CASE("TrowbridgeReitzDistribution") {
   CAST_MICROFACET_DISTRIBUTION(mfd, ptr,
                                ptr->D(hermes::vec3(1.f, 1.f, 1.f));)
 }
+
+TEST_CASE("BSDF") {
+  mem::init(1024);
+  SECTION("inline storage") {
+    REQUIRE(std::is_trivially_copyable_v<DielectricBxDF>);
+    REQUIRE(InlineBxDFStorage::size >= sizeof(DielectricBxDF));
+    auto available = mem::availableSize();
+    BSDF empty;
+    REQUIRE(!empty);
+    REQUIRE(!BSDF(hermes::normal3(0, 0, 1), hermes::vec3(1, 0, 0), BxDF()));
+    DielectricBxDF dielectric(1.5f, TrowbridgeReitzDistribution(0.3f, 0.3f));
+    BSDF bsdf(hermes::normal3(0, 0, 1), hermes::vec3(2, 0, 0), dielectric);
+    REQUIRE(bsdf);
+    REQUIRE(bsdf.flags() == dielectric.flags());
+    // shading happens on the stack
+    REQUIRE(mem::availableSize() == available);
+    // allocated BxDFs are copied in place
+    auto allocated = BxDFs::create<DielectricBxDF>(mem::allocator(), dielectric);
+    REQUIRE(allocated.flags == dielectric.flags());
+    BSDF copy(hermes::normal3(0, 0, 1), hermes::vec3(2, 0, 0), allocated);
+    REQUIRE(copy);
+    REQUIRE(copy.flags() == bsdf.flags());
+  }
+  SECTION("shading frame") {
+    hermes::vec3 n = hermes::normalize(hermes::vec3(1, 2, 3));
+    for (auto dpdu : {hermes::vec3(1, 0, 0), hermes::vec3(1, 2, 3), hermes::vec3(0, 0, 0)}) {
+      auto frame = ShadingFrame::fromXZ(dpdu, n);
+      REQUIRE(frame.x.length() == Approx(1));
+      REQUIRE(frame.y.length() == Approx(1));
+      REQUIRE(hermes::dot(frame.x, frame.y) == Approx(0).margin(1e-6));
+      REQUIRE(hermes::dot(frame.x, frame.z) == Approx(0).margin(1e-6));
+      REQUIRE(hermes::dot(frame.y, frame.z) == Approx(0).margin(1e-6));
+      hermes::vec3 v(0.3f, -0.5f, 0.8f);
+      auto local = frame.toLocal(v);
+      REQUIRE(local.z == Approx(hermes::dot(v, n)));
+      auto world = frame.fromLocal(local);
+      REQUIRE(world.x == Approx(v.x));
+      REQUIRE(world.y == Approx(v.y));
+      REQUIRE(world.z == Approx(v.z));
+    }
+  }
+  SECTION("evaluation") {
+    hermes::vec3 nv = hermes::normalize(hermes::vec3(1, 2, 2));
+    hermes::normal3 n(nv.x, nv.y, nv.z);
+    hermes::vec3 wo = hermes::normalize(nv + hermes::vec3(0.5f, -0.3f, 0.1f));
+    // rough glass
+    BSDF rough(n, hermes::vec3(1, 0, 0), DielectricBxDF(1.5f, TrowbridgeReitzDistribution(0.3f, 0.3f)));
+    REQUIRE(rough.isNonSpecular());
+    REQUIRE(!rough.isSpecular());
+    int reflection_count = 0, transmission_count = 0;
+    for (int i = 0; i < 16; ++i)
+      for (int j = 0; j < 16; ++j) {
+        hermes::point2 u((i + 0.5f) / 16, (j + 0.5f) / 16);
+        auto bs = rough.sample_f(wo, (i * 16 + j + 0.5f) / 256, u);
+        if (!bs)
+          continue;
+        REQUIRE((u32) bs->flags & (u32) bxdf_flags::GLOSSY);
+        if (hermes::dot(bs->wi, nv) > 0)
+          reflection_count++;
+        else
+          transmission_count++;
+        // sampled values match the evaluated ones
+        REQUIRE(rough.f(wo, bs->wi)[0] == Approx(bs->f[0]).epsilon(1e-3));
+        REQUIRE(rough.PDF(wo, bs->wi) == Approx(bs->pdf).epsilon(1e-3));
+        // reflection only
+        auto br = rough.sample_f(wo, (i * 16 + j + 0.5f) / 256, u, TransportMode::RADIANCE,
+                                 bxdf_refl_trans_flags::REFLECTION);
+        if (br)
+          REQUIRE(hermes::dot(br->wi, nv) > 0);
+      }
+    REQUIRE(reflection_count > 0);
+    REQUIRE(transmission_count > reflection_count);
+    // smooth glass
+    BSDF smooth(n, hermes::vec3(1, 0, 0), DielectricBxDF(1.5f, TrowbridgeReitzDistribution(0, 0)));
+    REQUIRE(smooth.isSpecular());
+    REQUIRE(!smooth.isNonSpecular());
+    REQUIRE(!smooth.f(wo, nv));
+    REQUIRE(smooth.PDF(wo, nv) == 0);
+    auto bs = smooth.sample_f(wo, 0, {0.5f, 0.5f});
+    REQUIRE(bs);
+    REQUIRE(bs->flags == bxdf_flags::SPECULAR_REFLECTION);
+    auto mirror = -wo + 2 * hermes::dot(wo, nv) * nv;
+    REQUIRE(bs->wi.x == Approx(mirror.x));
+    REQUIRE(bs->wi.y == Approx(mirror.y));
+    REQUIRE(bs->wi.z == Approx(mirror.z));
+    bs = smooth.sample_f(wo, 0.99f, {0.5f, 0.5f});
+    REQUIRE(bs);
+    REQUIRE(bs->flags == bxdf_flags::SPECULAR_TRANSMISSION);
+    REQUIRE(hermes::dot(bs->wi, nv) < 0);
+    REQUIRE(!smooth.sample_f(wo, 0.5f, {0.5f, 0.5f}, TransportMode::RADIANCE, bxdf_refl_trans_flags::UNSET));
+  }
+}
@@ -28,16 +28,216 @@
 #include <catch2/catch.hpp>
 
 #include <helios/spectra.h>
+#include <array>
+#include <random>
 
 using namespace helios;
 
 TEST_CASE("Spectrum") {
-  mem::init(1024);
+  mem::init(8192);
   SECTION("BlackBody") {
     auto data = mem::allocate<BlackbodySpectrum>(300);
     auto spec = BlackbodySpectrum::createSpectrum(data);
     CAST_SPECTRUM(spec, ptr, /**/
     )
   }
+  SECTION("RGB") {
+    const auto &table = RGBToSpectrumTable::sRGB();
+    // gray values map to constant spectra
+    real_t gray[3] = {0.3f, 0.3f, 0.3f};
+    RGBAlbedoSpectrum albedo(table, gray);
+    for (real_t lambda = 360; lambda <= 830; lambda += 10)
+      REQUIRE(albedo(lambda) == Approx(0.3f));
+    // the spectrum of a reflectance reproduces its color under D65
+    auto toRGB = [](auto spectrum) {
+      real_t xyz[3] = {0, 0, 0}, rgb[3];
+      for (int i = 0; i < nCIESamples; ++i) {
+        real_t v = spectrum(CIE_lambda[i]) * illuminantD65(CIE_lambda[i]) / CIE_Y_integral;
+        xyz[0] += CIE_X[i] * v;
+        xyz[1] += CIE_Y[i] * v;
+        xyz[2] += CIE_Z[i] * v;
+      }
+      XYZToRGB(xyz, rgb);
+      return std::array<real_t, 3>{rgb[0], rgb[1], rgb[2]};
+    };
+    REQUIRE(toRGB(albedo)[1] == Approx(0.3f).margin(1e-3));
+    real_t colors[3][3] = {{0.8f, 0.1f, 0.1f}, {0.2f, 0.6f, 0.3f}, {0.05f, 0.1f, 0.7f}};
+    for (auto &rgb : colors) {
+      auto c = toRGB(RGBAlbedoSpectrum(table, rgb));
+      REQUIRE(c[0] == Approx(rgb[0]).margin(0.02));
+      REQUIRE(c[1] == Approx(rgb[1]).margin(0.02));
+      REQUIRE(c[2] == Approx(rgb[2]).margin(0.02));
+      REQUIRE(RGBAlbedoSpectrum(table, rgb).maxValue() <= 1);
+    }
+    // unbounded values are scaled
+    real_t bright[3] = {1.6f, 0.2f, 0.2f};
+    RGBUnboundedSpectrum unbounded(table, bright);
+    REQUIRE(toRGB(unbounded)[0] == Approx(1.6f).margin(0.05));
+    REQUIRE(unbounded.maxValue() > 1);
+    // white illuminant is D65 with unit luminance
+    real_t white[3] = {1, 1, 1};
+    RGBIlluminantSpectrum illuminant(table, white);
+    real_t y = 0;
+    for (int i = 0; i < nCIESamples; ++i)
+      y += CIE_Y[i] * illuminant(CIE_lambda[i]) / CIE_Y_integral;
+    REQUIRE(y == Approx(1).margin(1e-3));
+    REQUIRE(illuminant(560) == Approx(illuminantD65(560)));
+    // spectra are stored through the generic interface
+    auto data = mem::allocate<RGBAlbedoSpectrum>(table, colors[0]);
+    auto spec = RGBAlbedoSpectrum::createSpectrum(data);
+    real_t value = 0;
+    CAST_CONST_SPECTRUM(spec, ptr, value = (*ptr)(650);)
+    REQUIRE(value == Approx(RGBAlbedoSpectrum(table, colors[0])(650)));
+  }
+  SECTION("DenselySampled") {
+    BlackbodySpectrum blackbody(3000);
+    auto dense = DenselySampledSpectrum::sampled(blackbody);
+    for (int lambda = 360; lambda <= 830; lambda += 7)
+      REQUIRE(dense(lambda) == Approx(blackbody(lambda)));
+    REQUIRE(dense(600.5f) == Approx(blackbody(600.5f)).epsilon(1e-3));
+    REQUIRE(dense(300) == 0);
+    REQUIRE(dense(900) == 0);
+    REQUIRE(dense.maxValue() == Approx(blackbody(830)));
+    // matching functions are evaluated by direct index
+    for (int i = 0; i < nCIESamples; i += 10) {
+      real_t xyz[3];
+      CIEXYZ(CIE_lambda[i], xyz);
+      REQUIRE(xyz[0] == Approx(CIE_X[i]));
+      REQUIRE(xyz[1] == Approx(CIE_Y[i]));
+      REQUIRE(xyz[2] == Approx(CIE_Z[i]));
+    }
+    real_t xyz[3];
+    CIEXYZ(555.5f, xyz);
+    REQUIRE(xyz[1] == Approx(0.5f * (CIE_Y[195] + CIE_Y[196])));
+  }
+  SECTION("PiecewiseLinear") {
+    real_t lambda[4] = {400, 500, 600, 700};
+    real_t values[4] = {0, 1, 0.5f, 0.5f};
+    PiecewiseLinearSpectrum spectrum(lambda, values, 4);
+    REQUIRE(spectrum(380) == 0);
+    REQUIRE(spectrum(400) == Approx(0));
+    REQUIRE(spectrum(450) == Approx(0.5f));
+    REQUIRE(spectrum(500) == Approx(1));
+    REQUIRE(spectrum(525.5f) == Approx(0.8725f));
+    REQUIRE(spectrum(650) == Approx(0.5f));
+    REQUIRE(spectrum(720) == 0);
+    REQUIRE(spectrum.maxValue() == Approx(1));
+    auto data = mem::allocate<PiecewiseLinearSpectrum>(lambda, values, 4);
+    auto spec = PiecewiseLinearSpectrum::createSpectrum(data);
+    real_t value = 0;
+    CAST_CONST_SPECTRUM(spec, ptr, value = (*ptr)(450);)
+    REQUIRE(value == Approx(0.5f));
+  }
+  SECTION("SampledWaveLengths") {
+    // visible distribution is normalized and inverted analytically
+    real_t integral = 0, cdf = 0;
+    for (int lambda = 360; lambda <= 830; ++lambda)
+      integral += SampledWaveLengths::visibleWaveLengthPDF(lambda);
+    REQUIRE(integral == Approx(1).margin(1e-3));
+    for (int lambda = 360; lambda < 830; ++lambda) {
+      cdf += 0.5f * (SampledWaveLengths::visibleWaveLengthPDF(lambda)
+          + SampledWaveLengths::visibleWaveLengthPDF(lambda + 1));
+      if (lambda % 50 == 0)
+        REQUIRE(SampledWaveLengths::sampleVisibleWaveLength(cdf) == Approx(lambda + 1).margin(0.05));
+    }
+    auto visible = SampledWaveLengths::sampleVisible(0.3f);
+    auto uniform = SampledWaveLengths::sampleUniform(0.3f);
+    for (int i = 0; i < Spectrum::n_samples; ++i) {
+      REQUIRE(visible[i] >= 360);
+      REQUIRE(visible[i] <= 830);
+      REQUIRE(visible.pdf()[i] == Approx(SampledWaveLengths::visibleWaveLengthPDF(visible[i])));
+      REQUIRE(uniform.pdf()[i] == Approx(1.f / 470));
+    }
+    REQUIRE(uniform[0] == Approx(501));
+    REQUIRE(uniform[1] == Approx(618.5f));
+    REQUIRE(uniform[3] == Approx(383.5f));
+    // both estimators converge to the XYZ color of D65, visible sampling with less noise
+    auto d65 = DenselySampledSpectrum::sampled(illuminantD65);
+    real_t reference[3] = {0, 0, 0};
+    for (int lambda = 360; lambda <= 830; ++lambda) {
+      real_t xyz[3];
+      CIEXYZ(lambda, xyz);
+      for (int c = 0; c < 3; ++c)
+        reference[c] += xyz[c] * d65(lambda) / CIE_Y_integral;
+    }
+    REQUIRE(reference[1] == Approx(1).margin(1e-3));
+    auto rmsError = [&](int sample_count, bool visible_sampling) {
+      std::mt19937 rng(7);
+      std::uniform_real_distribution<real_t> u(0, 1);
+      real_t error = 0;
+      const int trial_count = 50;
+      for (int trial = 0; trial < trial_count; ++trial) {
+        real_t sum[3] = {0, 0, 0};
+        for (int k = 0; k < sample_count; ++k) {
+          auto lambda = visible_sampling ? SampledWaveLengths::sampleVisible(u(rng)) :
+                        SampledWaveLengths::sampleUniform(u(rng));
+          real_t xyz[3];
+          d65.Sample(lambda).toXYZ(lambda, xyz);
+          for (int c = 0; c < 3; ++c)
+            sum[c] += xyz[c];
+        }
+        for (int c = 0; c < 3; ++c)
+          error += (sum[c] / sample_count - reference[c]) * (sum[c] / sample_count - reference[c]);
+      }
+      return std::sqrt(error / (3 * trial_count));
+    };
+    for (bool visible_sampling : {false, true})
+      REQUIRE(rmsError(1024, visible_sampling) < rmsError(64, visible_sampling) / 2);
+    REQUIRE(rmsError(1024, true) < rmsError(1024, false));
+  }
+  SECTION("SampledSpectrum") {
+    // spectra are plain packed values
+    REQUIRE(std::is_trivially_copyable_v<SampledSpectrum>);
+    REQUIRE(sizeof(SampledSpectrum) == Spectrum::n_samples * sizeof(real_t));
+    REQUIRE(sizeof(RGBSpectrum) == 3 * sizeof(real_t));
+    SampledSpectrum a, b(2);
+    REQUIRE(!a);
+    for (int i = 0; i < Spectrum::n_samples; ++i)
+      a[i] = i + 1;
+    REQUIRE(a);
+    auto c = (a + b) * a / b - 1.f;
+    for (int i = 0; i < Spectrum::n_samples; ++i)
+      REQUIRE(c[i] == Approx((i + 3) * (i + 1) / 2.f - 1));
+    c -= a;
+    c *= 2;
+    for (int i = 0; i < Spectrum::n_samples; ++i)
+      REQUIRE(c[i] == Approx(2 * ((i + 3) * (i + 1) / 2.f - 1 - (i + 1))));
+  }
+  SECTION("SpectrumCache") {
+    auto available = mem::availableSize();
+    auto a = SpectrumCache::get<BlackbodySpectrum>(3000.f);
+    auto used = available - mem::availableSize();
+    REQUIRE(a);
+    REQUIRE(a.type == SpectrumType::BLACKBODY);
+    // identical spectra resolve to the same payload
+    for (int i = 0; i < 10; ++i) {
+      auto b = SpectrumCache::get<BlackbodySpectrum>(3000.f);
+      REQUIRE(b.data_ptr.get<BlackbodySpectrum>() == a.data_ptr.get<BlackbodySpectrum>());
+    }
+    REQUIRE(available - mem::availableSize() == used);
+    REQUIRE(SpectrumCache::hitCount() == 10);
+    auto c = SpectrumCache::get<BlackbodySpectrum>(4000.f);
+    REQUIRE(c.data_ptr.get<BlackbodySpectrum>() != a.data_ptr.get<BlackbodySpectrum>());
+    REQUIRE(SpectrumCache::size() == 2);
+    // named spectra are created once
+    auto d65 = SpectrumCache::named("stdillum-D65");
+    REQUIRE(d65.type == SpectrumType::DENSELY_SAMPLED);
+    REQUIRE(SpectrumCache::named("stdillum-D65").data_ptr.get<DenselySampledSpectrum>() ==
+        d65.data_ptr.get<DenselySampledSpectrum>());
+    for (int lambda = 360; lambda <= 830; lambda += 10)
+      REQUIRE((*d65.data_ptr.get<DenselySampledSpectrum>())(lambda) == Approx(illuminantD65(lambda)));
+    // sampling the same function again hits the interned table
+    auto same = SpectrumCache::get<DenselySampledSpectrum>(DenselySampledSpectrum::sampled(illuminantD65));
+    REQUIRE(same.data_ptr.get<DenselySampledSpectrum>() == d65.data_ptr.get<DenselySampledSpectrum>());
+    auto bk7 = SpectrumCache::named("glass-BK7");
+    REQUIRE((*bk7.data_ptr.get<DenselySampledSpectrum>())(587.6f) == Approx(1.5168f).epsilon(1e-4));
+    REQUIRE(!SpectrumCache::named("unobtainium"));
+    REQUIRE(SpectrumCache::size() == 4);
+    // a new arena invalidates previous entries
+    mem::init(8192);
+    REQUIRE(SpectrumCache::size() == 0);
+    REQUIRE(SpectrumCache::get<BlackbodySpectrum>(3000.f));
+    REQUIRE(SpectrumCache::size() == 1);
+  }
 
 }
@@ -0,0 +1,163 @@
+#!/usr/bin/env python3
+# Copyright (c) 2021, FilipeCN.
+#
+# The MIT License (MIT)
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to
+# deal in the Software without restriction, including without limitation the
+# rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+# sell copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+# IN THE SOFTWARE.
+"""Generates and checks the point sets of helios/samplers/pmj02_tables.h
+
+Each set is made by nested uniform (Owen) scrambling of the first two Sobol'
+dimensions over 16 digits, with an independent random tree per set and axis.
+Every set is checked to be a (0,2)-sequence in base 2: each aligned block of
+2^k points has one point in each elementary interval of area 2^-k.
+
+usage:
+  pmj02_tables.py                  prints the table initializer
+  pmj02_tables.py --check HEADER   checks HEADER holds the generated sets
+"""
+
+import argparse
+import random
+import re
+import sys
+
+SET_COUNT = 8
+POINT_COUNT = 256
+BITS = 16
+SEED = 20211019
+
+
+def sobol(n):
+    """First two dimensions of the Sobol' sequence, BITS digits each"""
+    v0 = [1 << (31 - j) for j in range(32)]
+    v1 = [1 << 31] + [0] * 31
+    for k in range(1, 32):
+        v1[k] = v1[k - 1] ^ (v1[k - 1] >> 1)
+    points = []
+    for i in range(n):
+        x = y = 0
+        j = 0
+        while i:
+            if i & 1:
+                x ^= v0[j]
+                y ^= v1[j]
+            i >>= 1
+            j += 1
+        points.append((x >> (32 - BITS), y >> (32 - BITS)))
+    return points
+
+
+def owen_scramble(values, rng):
+    """Flips each digit with a random bit shared by all values with the same leading digits"""
+    flips = {}
+    scrambled = []
+    for v in values:
+        r = 0
+        for k in range(BITS):
+            key = (k, v >> (BITS - k))
+            if key not in flips:
+                flips[key] = rng.getrandbits(1)
+            r |= (((v >> (BITS - 1 - k)) & 1) ^ flips[key]) << (BITS - 1 - k)
+        scrambled.append(r)
+    return scrambled
+
+
+def is_02_net(points):
+    """True if the 2^m points have one point in each elementary interval of area 2^-m"""
+    m = len(points).bit_length() - 1
+    for x_bits in range(m + 1):
+        y_bits = m - x_bits
+        cells = set()
+        for x, y in points:
+            cell = (x >> (BITS - x_bits) if x_bits else 0, y >> (BITS - y_bits) if y_bits else 0)
+            if cell in cells:
+                return False
+            cells.add(cell)
+    return True
+
+
+def is_02_sequence(points):
+    """Checks every aligned block of 2^k points"""
+    k = 0
+    while (1 << k) <= len(points):
+        for start in range(0, len(points), 1 << k):
+            if not is_02_net(points[start:start + (1 << k)]):
+                return False
+        k += 1
+    return True
+
+
+def generate():
+    rng = random.Random(SEED)
+    base = sobol(POINT_COUNT)
+    sets = []
+    for _ in range(SET_COUNT):
+        xs = owen_scramble([p[0] for p in base], rng)
+        ys = owen_scramble([p[1] for p in base], rng)
+        sets.append(list(zip(xs, ys)))
+    return sets
+
+
+def pack(points):
+    # 16 bit fixed point pairs, x in the low half and y in the high half
+    return [x | (y << 16) for x, y in points]
+
+
+def unpack(values):
+    return [(v & 0xffff, v >> 16) for v in values]
+
+
+def print_tables(sets):
+    for points in sets:
+        values = ['0x%08x' % v for v in pack(points)]
+        print('    {')
+        for i in range(0, len(values), 8):
+            print('        ' + ', '.join(values[i:i + 8]) + ',')
+        print('    },')
+
+
+def check_header(path, sets):
+    with open(path) as f:
+        values = [int(v, 16) for v in re.findall(r'0x[0-9a-f]{8}', f.read())]
+    expected = [v for points in sets for v in pack(points)]
+    if values != expected:
+        print('%s: tables differ from the generated sets' % path)
+        return False
+    for s in range(SET_COUNT):
+        if not is_02_sequence(unpack(values[s * POINT_COUNT:(s + 1) * POINT_COUNT])):
+            print('%s: set %d is not a (0,2)-sequence' % (path, s))
+            return False
+    print('%s: %d sets of %d points ok' % (path, SET_COUNT, POINT_COUNT))
+    return True
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--check', metavar='HEADER', help='header to compare against the generated sets')
+    args = parser.parse_args()
+    sets = generate()
+    for s, points in enumerate(sets):
+        if not is_02_sequence(points):
+            sys.exit('set %d is not a (0,2)-sequence' % s)
+    if args.check:
+        sys.exit(0 if check_header(args.check, sets) else 1)
+    print_tables(sets)
+
+
+if __name__ == '__main__':
+    main()
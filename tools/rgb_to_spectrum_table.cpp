@@ -0,0 +1,449 @@
+/// Copyright (c) 2021, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+///
+///\file rgb_to_spectrum_table.cpp
+///\author FilipeCN (filipedecn@gmail.com)
+///\date 2021-10-19
+///
+///\brief Generates and checks the sRGB table of helios/spectra/rgb_to_spectrum_table.cpp
+///
+/// Each grid point is fitted by Levenberg-Marquardt in CIELAB against the CIE 1931 matching functions under
+/// illuminant D65, warm started from its neighbor along z. The CIE and D65 tables are read from
+/// helios/base/spectrum.cpp, so the tool only needs a C++17 compiler:
+///
+///   c++ -O2 -std=c++17 tools/rgb_to_spectrum_table.cpp -o rgb_to_spectrum_table
+///   rgb_to_spectrum_table SPECTRUM_CPP                   prints the SRGB_TO_SPECTRUM_TABLE macro
+///   rgb_to_spectrum_table SPECTRUM_CPP --check TABLE_CPP checks TABLE_CPP holds the generated table
+///
+/// Both modes report the worst CIELAB fitting error and the RGB round-trip error of table lookups on stderr.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr int resolution = 16;
+constexpr int cie_sample_count = 471;  // 360 nm to 830 nm in 1 nm steps
+constexpr int d65_sample_count = 107;  // 300 nm to 830 nm in 5 nm steps
+constexpr double max_coefficient = 200;
+
+// *********************************************************************************************************************
+//                                                                                                      CIE DATA
+// *********************************************************************************************************************
+/// Reads the values of a "#define NAME \" macro
+std::vector<float> readMacro(const std::string &source, const std::string &name) {
+  std::vector<float> values;
+  auto begin = source.find("#define " + name + " \\");
+  if (begin == std::string::npos)
+    return values;
+  std::istringstream lines(source.substr(source.find('\n', begin) + 1));
+  std::string line;
+  while (std::getline(lines, line)) {
+    bool continues = !line.empty() && line.back() == '\\';
+    const char *s = line.c_str();
+    char *end = nullptr;
+    for (float v = std::strtof(s, &end); end != s; v = std::strtof(s, &end)) {
+      values.emplace_back(v);
+      s = end;
+      while (*s == 'f' || *s == ',' || *s == ' ')
+        s++;
+    }
+    if (!continues)
+      break;
+  }
+  return values;
+}
+
+/// Color matching functions times D65, normalized to Y = 1 for a unit spectrum
+struct Observer {
+  double weights[cie_sample_count][3];
+  double lambda[cie_sample_count];  //!< normalized to [0, 1]
+  double white[3];
+};
+
+bool loadObserver(const char *path, Observer &observer) {
+  std::ifstream file(path);
+  std::stringstream source;
+  source << file.rdbuf();
+  auto x = readMacro(source.str(), "CIE_X_VALUES");
+  auto y = readMacro(source.str(), "CIE_Y_VALUES");
+  auto z = readMacro(source.str(), "CIE_Z_VALUES");
+  auto d65 = readMacro(source.str(), "CIE_ILLUM_D6500_VALUES");
+  if (x.size() != cie_sample_count || y.size() != cie_sample_count || z.size() != cie_sample_count ||
+      d65.size() != d65_sample_count) {
+    std::fprintf(stderr, "%s: CIE tables not found\n", path);
+    return false;
+  }
+  double norm = 0;
+  for (int i = 0; i < cie_sample_count; ++i) {
+    double lambda = 360 + i;
+    observer.lambda[i] = (lambda - 360) / (830 - 360);
+    double t = (lambda - 300) / 5;
+    int k = static_cast<int>(t);
+    double f = t - k;
+    double d = d65[k] * (1 - f) + (k + 1 < d65_sample_count ? d65[k + 1] : 0) * f;
+    observer.weights[i][0] = d * x[i];
+    observer.weights[i][1] = d * y[i];
+    observer.weights[i][2] = d * z[i];
+    norm += observer.weights[i][1];
+  }
+  for (auto &w : observer.weights)
+    for (double &c : w)
+      c /= norm;
+  for (int c = 0; c < 3; ++c) {
+    observer.white[c] = 0;
+    for (auto &w : observer.weights)
+      observer.white[c] += w[c];
+  }
+  return true;
+}
+
+// *********************************************************************************************************************
+//                                                                                                       FITTING
+// *********************************************************************************************************************
+void rgbToXYZ(const double rgb[3], double xyz[3]) {
+  xyz[0] = 0.412453 * rgb[0] + 0.357580 * rgb[1] + 0.180423 * rgb[2];
+  xyz[1] = 0.212671 * rgb[0] + 0.715160 * rgb[1] + 0.072169 * rgb[2];
+  xyz[2] = 0.019334 * rgb[0] + 0.119193 * rgb[1] + 0.950227 * rgb[2];
+}
+
+void xyzToRGB(const double xyz[3], double rgb[3]) {
+  rgb[0] = 3.240479 * xyz[0] - 1.537150 * xyz[1] - 0.498535 * xyz[2];
+  rgb[1] = -0.969256 * xyz[0] + 1.875991 * xyz[1] + 0.041556 * xyz[2];
+  rgb[2] = 0.055648 * xyz[0] - 0.204043 * xyz[1] + 1.057311 * xyz[2];
+}
+
+void xyzToLab(const Observer &observer, const double xyz[3], double lab[3]) {
+  auto f = [](double t) {
+    const double delta = 6.0 / 29;
+    return t > delta * delta * delta ? std::cbrt(t) : t / (3 * delta * delta) + 4.0 / 29;
+  };
+  double fx = f(xyz[0] / observer.white[0]);
+  double fy = f(xyz[1] / observer.white[1]);
+  double fz = f(xyz[2] / observer.white[2]);
+  lab[0] = 116 * fy - 16;
+  lab[1] = 500 * (fx - fy);
+  lab[2] = 200 * (fy - fz);
+}
+
+double sigmoid(double x) {
+  if (std::isinf(x))
+    return x > 0;
+  return .5 + x / (2 * std::sqrt(1 + x * x));
+}
+
+/// CIELAB difference between the spectrum of normalized wavelength coefficients c and the target
+void residual(const Observer &observer, const double c[3], const double target[3], double r[3]) {
+  double xyz[3] = {0, 0, 0};
+  for (int i = 0; i < cie_sample_count; ++i) {
+    double l = observer.lambda[i];
+    double s = sigmoid((c[0] * l + c[1]) * l + c[2]);
+    for (int k = 0; k < 3; ++k)
+      xyz[k] += observer.weights[i][k] * s;
+  }
+  double lab[3];
+  xyzToLab(observer, xyz, lab);
+  for (int k = 0; k < 3; ++k)
+    r[k] = lab[k] - target[k];
+}
+
+double residualNorm(const Observer &observer, const double c[3], const double target[3]) {
+  double r[3];
+  residual(observer, c, target, r);
+  return std::sqrt(r[0] * r[0] + r[1] * r[1] + r[2] * r[2]);
+}
+
+double determinant(const double m[3][3]) {
+  return m[0][0] * (m[1][1] * m[2][2] - m[1][2] * m[2][1]) - m[0][1] * (m[1][0] * m[2][2] - m[1][2] * m[2][0]) +
+      m[0][2] * (m[1][0] * m[2][1] - m[1][1] * m[2][0]);
+}
+
+/// Cramer's rule
+bool solve(const double a[3][3], const double b[3], double x[3]) {
+  double det = determinant(a);
+  if (std::fabs(det) < 1e-15)
+    return false;
+  for (int c = 0; c < 3; ++c) {
+    double m[3][3];
+    for (int i = 0; i < 3; ++i)
+      for (int j = 0; j < 3; ++j)
+        m[i][j] = j == c ? b[i] : a[i][j];
+    x[c] = determinant(m) / det;
+  }
+  return true;
+}
+
+/// Levenberg-Marquardt with a central difference Jacobian, starting from (and writing to) c
+/// \return final CIELAB error
+double fit(const Observer &observer, const double rgb[3], double c[3]) {
+  double xyz[3], target[3];
+  rgbToXYZ(rgb, xyz);
+  xyzToLab(observer, xyz, target);
+  double mu = 1e-3;
+  double error = residualNorm(observer, c, target);
+  for (int iteration = 0; iteration < 300 && error > 1e-6; ++iteration) {
+    double r[3], jacobian[3][3];
+    residual(observer, c, target, r);
+    for (int j = 0; j < 3; ++j) {
+      double c0[3] = {c[0], c[1], c[2]}, c1[3] = {c[0], c[1], c[2]};
+      double h = 1e-5 * std::max(1.0, std::fabs(c[j]));
+      c0[j] -= h;
+      c1[j] += h;
+      double r0[3], r1[3];
+      residual(observer, c0, target, r0);
+      residual(observer, c1, target, r1);
+      for (int i = 0; i < 3; ++i)
+        jacobian[i][j] = (r1[i] - r0[i]) / (2 * h);
+    }
+    double jtj[3][3], jtr[3];
+    for (int i = 0; i < 3; ++i) {
+      jtr[i] = 0;
+      for (int k = 0; k < 3; ++k)
+        jtr[i] += jacobian[k][i] * r[k];
+      for (int j = 0; j < 3; ++j) {
+        jtj[i][j] = 0;
+        for (int k = 0; k < 3; ++k)
+          jtj[i][j] += jacobian[k][i] * jacobian[k][j];
+      }
+    }
+    bool improved = false;
+    for (int attempt = 0; attempt < 20 && !improved; ++attempt) {
+      double a[3][3], step[3];
+      for (int i = 0; i < 3; ++i)
+        for (int j = 0; j < 3; ++j)
+          a[i][j] = jtj[i][j] + (i == j ? mu * (jtj[i][i] + 1e-12) : 0);
+      if (!solve(a, jtr, step)) {
+        mu *= 10;
+        continue;
+      }
+      double candidate[3] = {c[0] - step[0], c[1] - step[1], c[2] - step[2]};
+      // large coefficients make the sigmoid a step function, keep them bounded
+      double m = std::max({std::fabs(candidate[0]), std::fabs(candidate[1]), std::fabs(candidate[2])});
+      if (m > max_coefficient)
+        for (double &v : candidate)
+          v *= max_coefficient / m;
+      double candidate_error = residualNorm(observer, candidate, target);
+      if (candidate_error < error) {
+        std::copy(candidate, candidate + 3, c);
+        error = candidate_error;
+        mu = std::max(mu * 0.3, 1e-9);
+        improved = true;
+      } else
+        mu *= 10;
+    }
+    if (!improved)
+      break;
+  }
+  return error;
+}
+
+struct Table {
+  float z_nodes[resolution];
+  std::vector<float> coefficients; //!< [m][z][y][x][c]
+  double worst_error{0};
+};
+
+double smoothstep(double x) { return x * x * (3 - 2 * x); }
+
+Table generate(const Observer &observer) {
+  Table table;
+  table.coefficients.resize(3 * resolution * resolution * resolution * 3);
+  double z_nodes[resolution];
+  for (int k = 0; k < resolution; ++k) {
+    z_nodes[k] = smoothstep(smoothstep(k / double(resolution - 1)));
+    table.z_nodes[k] = z_nodes[k];
+  }
+  // coefficients are fitted over normalized wavelengths and stored for wavelengths in nm
+  const double c0 = 360, c1 = 1.0 / (830 - 360);
+  for (int m = 0; m < 3; ++m)
+    for (int j = 0; j < resolution; ++j) {
+      double y = j / double(resolution - 1);
+      for (int i = 0; i < resolution; ++i) {
+        double x = i / double(resolution - 1);
+        double c[3] = {0, 0, 0};
+        auto fitNode = [&](int k) {
+          double rgb[3];
+          rgb[m] = z_nodes[k];
+          rgb[(m + 1) % 3] = x * z_nodes[k];
+          rgb[(m + 2) % 3] = y * z_nodes[k];
+          double error = fit(observer, rgb, c);
+          table.worst_error = std::max(table.worst_error, error);
+          float *out = &table.coefficients[3 * (((size_t(m) * resolution + k) * resolution + j) * resolution + i)];
+          out[0] = c[0] * c1 * c1;
+          out[1] = c[1] * c1 - 2 * c[0] * c0 * c1 * c1;
+          out[2] = c[2] - c[1] * c0 * c1 + c[0] * c0 * c0 * c1 * c1;
+        };
+        // the fit converges poorly near black, so nodes are warm started from the middle of z outwards
+        const int start = resolution / 5;
+        for (int k = start; k < resolution; ++k)
+          fitNode(k);
+        c[0] = c[1] = c[2] = 0;
+        for (int k = start; k >= 0; --k)
+          fitNode(k);
+      }
+    }
+  return table;
+}
+
+// *********************************************************************************************************************
+//                                                                                                        OUTPUT
+// *********************************************************************************************************************
+std::string formatFloat(float v) {
+  char buffer[32];
+  std::snprintf(buffer, sizeof(buffer), "%.8g", v);
+  std::string s = buffer;
+  if (s.find_first_of(".e") == std::string::npos)
+    s += ".0";
+  return s + "f";
+}
+
+/// Pads line with spaces up to the continuation backslash at column
+std::string padded(const std::string &line, size_t column) {
+  return line + std::string(line.size() + 1 < column ? column - 1 - line.size() : 0, ' ') + "\\";
+}
+
+std::vector<std::string> tableLines(const Table &table) {
+  std::vector<std::string> lines;
+  lines.emplace_back(padded("#define SRGB_TO_SPECTRUM_TABLE {", 119));
+  lines.emplace_back(padded("  { /* z nodes */", 117));
+  std::string z_line = "   ";
+  for (float z : table.z_nodes)
+    z_line += " " + formatFloat(z) + ",";
+  z_line.back() = ' ';
+  lines.emplace_back(z_line + "\\");
+  lines.emplace_back(padded("  }, {", 117));
+  for (size_t i = 0; i < table.coefficients.size(); i += 8) {
+    std::string line = "   ";
+    for (size_t j = i; j < i + 8 && j < table.coefficients.size(); ++j)
+      line += " " + formatFloat(table.coefficients[j]) + ",";
+    if (i + 8 >= table.coefficients.size())
+      line.back() = ' ';
+    else
+      line += " ";
+    lines.emplace_back(line + "\\");
+  }
+  lines.emplace_back("  }}");
+  return lines;
+}
+
+// *********************************************************************************************************************
+//                                                                                                    VALIDATION
+// *********************************************************************************************************************
+/// Same lookup as RGBToSpectrumTable::operator()
+void lookup(const Table &table, const float rgb[3], float c[3]) {
+  if (rgb[0] == rgb[1] && rgb[1] == rgb[2]) {
+    c[0] = c[1] = 0;
+    c[2] = (rgb[0] - .5f) / std::sqrt(rgb[0] * (1 - rgb[0]));
+    return;
+  }
+  int m = (rgb[0] > rgb[1]) ? ((rgb[0] > rgb[2]) ? 0 : 2) : ((rgb[1] > rgb[2]) ? 1 : 2);
+  float z = rgb[m];
+  float x = rgb[(m + 1) % 3] * (resolution - 1) / z;
+  float y = rgb[(m + 2) % 3] * (resolution - 1) / z;
+  int xi = std::min(static_cast<int>(x), resolution - 2);
+  int yi = std::min(static_cast<int>(y), resolution - 2);
+  int zi = 0;
+  while (zi < resolution - 2 && table.z_nodes[zi + 1] < z)
+    zi++;
+  float dx = x - xi, dy = y - yi, dz = (z - table.z_nodes[zi]) / (table.z_nodes[zi + 1] - table.z_nodes[zi]);
+  for (int i = 0; i < 3; ++i) {
+    auto co = [&](int ox, int oy, int oz) {
+      return table.coefficients[3 * (((size_t(m) * resolution + zi + oz) * resolution + yi + oy) * resolution + xi + ox)
+          + i];
+    };
+    auto lerp = [](float t, float a, float b) { return (1 - t) * a + t * b; };
+    c[i] = lerp(dz,
+                lerp(dy, lerp(dx, co(0, 0, 0), co(1, 0, 0)), lerp(dx, co(0, 1, 0), co(1, 1, 0))),
+                lerp(dy, lerp(dx, co(0, 0, 1), co(1, 0, 1)), lerp(dx, co(0, 1, 1), co(1, 1, 1))));
+  }
+}
+
+/// Converts random rgb values to spectra and back
+void reportRoundTrip(const Observer &observer, const Table &table) {
+  std::mt19937 rng(1);
+  std::uniform_real_distribution<float> u(0, 1);
+  const int n = 20000;
+  double max_error = 0, sum = 0;
+  for (int s = 0; s < n; ++s) {
+    float rgb[3] = {u(rng), u(rng), u(rng)};
+    float c[3];
+    lookup(table, rgb, c);
+    double xyz[3] = {0, 0, 0};
+    for (int i = 0; i < cie_sample_count; ++i) {
+      float lambda = 360 + i;
+      float v = (c[0] * lambda + c[1]) * lambda + c[2];
+      v = .5f + v / (2 * std::sqrt(1 + v * v));
+      for (int k = 0; k < 3; ++k)
+        xyz[k] += observer.weights[i][k] * v;
+    }
+    double result[3];
+    xyzToRGB(xyz, result);
+    for (int k = 0; k < 3; ++k) {
+      double e = std::fabs(result[k] - rgb[k]);
+      max_error = std::max(max_error, e);
+      sum += e;
+    }
+  }
+  std::fprintf(stderr, "worst CIELAB fitting error %.3g\n", table.worst_error);
+  std::fprintf(stderr, "rgb round trip error: max %.4f mean %.4f (%d samples)\n", max_error, sum / (3 * n), n);
+}
+
+bool checkSource(const char *path, const std::vector<std::string> &lines) {
+  std::ifstream file(path);
+  std::string line;
+  while (std::getline(file, line) && line != lines.front()) {}
+  for (size_t i = 1; i < lines.size(); ++i)
+    if (!std::getline(file, line) || line != lines[i]) {
+      std::fprintf(stderr, "%s: table differs from the generated one at its line %zu\n", path, i + 1);
+      return false;
+    }
+  std::fprintf(stderr, "%s: table ok\n", path);
+  return true;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  bool check = argc == 4 && std::string(argv[2]) == "--check";
+  if (argc != 2 && !check) {
+    std::fprintf(stderr, "usage: %s SPECTRUM_CPP [--check TABLE_CPP]\n", argv[0]);
+    return 2;
+  }
+  static Observer observer;
+  if (!loadObserver(argv[1], observer))
+    return 1;
+  Table table = generate(observer);
+  auto lines = tableLines(table);
+  reportRoundTrip(observer, table);
+  if (check)
+    return checkSource(argv[3], lines) ? 0 : 1;
+  for (const auto &line : lines)
+    std::printf("%s\n", line.c_str());
+  return 0;
+}
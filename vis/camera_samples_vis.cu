@@ -86,11 +86,6 @@ struct CameraSamplesVis : public circe::gl::BaseApp {
     }
 
 #ifdef HELIOS_DEBUG_DATA
-    {// dump samples
-      HostMemory hm = renderer.debug_samples;
-      renderer.debug_pool.setData(hm.ptr());
-      SamplePool::dumpMemory(renderer.debug_pool, renderer.debug_render_info.n_tiles.total());
-    }
     Array<RayDifferential> hm;// = renderer.debug_rays;
     MemoryDumper::dump(hm.data(), 4, sizeof(RayDifferential),
                        RayDifferential::memoryDumpLayout().withCount(4),